@@ -0,0 +1,67 @@
+#include "BinaryFrame.h"
+
+BinaryFrame::BinaryFrame(const char* name, size_t capacity) : name(name) {
+  buffer = static_cast<uint8_t*>(PsramAllocator().allocate(capacity));
+  if (buffer) {
+    this->capacity = capacity;
+  }
+}
+
+BinaryFrame::~BinaryFrame() {
+  if (buffer) {
+    PsramAllocator().deallocate(buffer);
+  }
+}
+
+void BinaryFrame::begin(uint8_t type) {
+  used = 0;
+  overflowed = false;
+  put8(type);
+}
+
+size_t BinaryFrame::finish() {
+  if (overflowed) {
+    Serial.printf("[BinaryFrame] %s: frame exceeds capacity %u\n", name, (unsigned)capacity);
+    overflows++;
+    used = 0;
+  }
+  peak = max(peak, used);
+  return used;
+}
+
+void BinaryFrame::put(const void* data, size_t length) {
+  if (overflowed || used + length > capacity) {
+    overflowed = true;
+    return;
+  }
+  memcpy(buffer + used, data, length);
+  used += length;
+}
+
+void BinaryFrame::put8(uint8_t value) {
+  put(&value, 1);
+}
+
+void BinaryFrame::put16(uint16_t value) {
+  uint8_t bytes[2] = {(uint8_t)value, (uint8_t)(value >> 8)};
+  put(bytes, sizeof(bytes));
+}
+
+void BinaryFrame::put32(uint32_t value) {
+  uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+  put(bytes, sizeof(bytes));
+}
+
+void BinaryFrame::putFloat(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  put32(bits);
+}
+
+void BinaryFrame::putString(const char* value) {
+  size_t length = value ? min(strlen(value), (size_t)255) : 0;
+  put8(length);
+  if (length > 0) {
+    put(value, length);
+  }
+}
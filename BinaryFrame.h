@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CommonTypes.h"
+
+// Little-endian frame builder over a buffer allocated once. Writes past the
+// capacity are dropped and reported by finish(), so encoders don't have to
+// check every field.
+class BinaryFrame {
+public:
+  BinaryFrame(const char* name, size_t capacity);
+  ~BinaryFrame();
+
+  BinaryFrame(const BinaryFrame&) = delete;
+  BinaryFrame& operator=(const BinaryFrame&) = delete;
+
+  void begin(uint8_t type);
+  size_t finish();
+
+  void put8(uint8_t value);
+  void put16(uint16_t value);
+  void put32(uint32_t value);
+  void putFloat(float value);
+  void putString(const char* value);
+
+  const uint8_t* data() const { return buffer; }
+  size_t length() const { return used; }
+  size_t highWater() const { return peak; }
+  uint32_t getOverflows() const { return overflows; }
+
+private:
+  const char* name;
+  uint8_t* buffer = nullptr;
+  size_t capacity = 0;
+  size_t used = 0;
+  size_t peak = 0;
+  bool overflowed = false;
+  uint32_t overflows = 0;
+
+  void put(const void* data, size_t length);
+};
@@ -4,10 +4,12 @@
 #include <ArduinoJson.h>
 #include <Arduino.h>
 #include <vector>
+#include "MemTrack.h"
 
 #ifdef ESP32
 #include <WiFi.h>
 #include <SPIFFS.h>
+#include "esp_memory_utils.h"
 #elif defined(ESP8266)
 #include <FS.h>
 #include <ESP8266WiFi.h>
@@ -16,29 +18,152 @@
 #ifndef PSRAM_ALLOCATOR_DEFINED
 #define PSRAM_ALLOCATOR_DEFINED
 
+// Every block carries a small header with its size and the MemTag that was
+// active at allocation time, so frees are charged back to the right subsystem.
 struct PsramAllocator {
+  struct Header {
+    uint32_t size;
+    uint32_t tag;
+  };
+
   void* allocate(size_t size) {
+    Header* header = static_cast<Header*>(rawAllocate(size + sizeof(Header)));
+    if (!header) return nullptr;
 
-    #ifdef ESP32
-      return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    #else
-      return malloc(size);
-    #endif
+    header->size = size;
+    header->tag = MemTrack::current();
+    MemTrack::recordAlloc((MemTag)header->tag, size);
+    return header + 1;
   }
 
   void deallocate(void* pointer) {
-    free(pointer);
+    if (!pointer) return;
+
+    Header* header = static_cast<Header*>(pointer) - 1;
+    MemTrack::recordFree((MemTag)header->tag, header->size);
+    free(header);
   }
 
   void* reallocate(void* ptr, size_t new_size) {
+    if (!ptr) return allocate(new_size);
+
+    Header* header = static_cast<Header*>(ptr) - 1;
+    size_t oldSize = header->size;
+    header = static_cast<Header*>(rawReallocate(header, new_size + sizeof(Header)));
+    if (!header) return nullptr;
+
+    header->size = new_size;
+    MemTrack::recordResize((MemTag)header->tag, oldSize, new_size);
+    return header + 1;
+  }
+
+private:
+  static void* rawAllocate(size_t size) {
+    #ifdef ESP32
+      void* pointer = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+      return pointer ? pointer : malloc(size);
+    #else
+      return malloc(size);
+    #endif
+  }
+
+  static void* rawReallocate(void* ptr, size_t new_size) {
     #ifdef ESP32
-      return heap_caps_realloc(ptr, new_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+      void* pointer = heap_caps_realloc(ptr, new_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+      return pointer ? pointer : realloc(ptr, new_size);
     #else
       return realloc(ptr, new_size);
     #endif
   }
 };
 
+template <typename T>
+struct PsramStdAllocator {
+  using value_type = T;
+
+  PsramStdAllocator() = default;
+  template <typename U>
+  PsramStdAllocator(const PsramStdAllocator<U>&) {}
+
+  T* allocate(size_t count) {
+    void* pointer = PsramAllocator().allocate(count * sizeof(T));
+    if (!pointer) abort();
+    return static_cast<T*>(pointer);
+  }
+
+  void deallocate(T* pointer, size_t) {
+    PsramAllocator().deallocate(pointer);
+  }
+
+  template <typename U>
+  bool operator==(const PsramStdAllocator<U>&) const { return true; }
+  template <typename U>
+  bool operator!=(const PsramStdAllocator<U>&) const { return false; }
+};
+
 #endif
 
 using PsramJsonDocument = BasicJsonDocument<PsramAllocator>;
+
+template <typename T>
+using PsramVector = std::vector<T, PsramStdAllocator<T>>;
+
+inline bool isPsramPointer(const void* pointer) {
+#ifdef ESP32
+  return pointer && esp_ptr_external_ram(pointer);
+#else
+  return false;
+#endif
+}
+
+struct MemoryPlacementReport {
+  struct Entry {
+    const char* subsystem;
+    size_t internalBytes;
+    size_t psramBytes;
+  };
+
+  std::vector<Entry> entries;
+
+  void add(const char* subsystem, const void* pointer, size_t bytes) {
+    if (!pointer || bytes == 0) return;
+
+    for (auto& entry : entries) {
+      if (strcmp(entry.subsystem, subsystem) == 0) {
+        (isPsramPointer(pointer) ? entry.psramBytes : entry.internalBytes) += bytes;
+        return;
+      }
+    }
+
+    entries.push_back({subsystem, isPsramPointer(pointer) ? 0 : bytes, isPsramPointer(pointer) ? bytes : 0});
+  }
+
+  template <typename T, typename A>
+  void add(const char* subsystem, const std::vector<T, A>& vector) {
+    add(subsystem, vector.data(), vector.capacity() * sizeof(T));
+  }
+
+  void add(const char* subsystem, JsonDocument& doc) {
+    add(subsystem, doc.memoryPool().buffer(), doc.capacity());
+  }
+
+  size_t format(char* buffer, size_t bufferSize) const {
+    size_t offset = snprintf(buffer, bufferSize, "%-12s %10s %10s\n", "Subsystem", "Internal", "PSRAM");
+    size_t totalInternal = 0;
+    size_t totalPsram = 0;
+
+    for (const auto& entry : entries) {
+      if (offset >= bufferSize) break;
+      offset += snprintf(buffer + offset, bufferSize - offset, "%-12s %10u %10u\n",
+                         entry.subsystem, (unsigned)entry.internalBytes, (unsigned)entry.psramBytes);
+      totalInternal += entry.internalBytes;
+      totalPsram += entry.psramBytes;
+    }
+
+    if (offset < bufferSize) {
+      offset += snprintf(buffer + offset, bufferSize - offset, "%-12s %10u %10u\n",
+                         "Total", (unsigned)totalInternal, (unsigned)totalPsram);
+    }
+    return offset < bufferSize ? offset : bufferSize - 1;
+  }
+};
@@ -0,0 +1,371 @@
+#include "ConfigBundle.h"
+#include "DeviceManager.h"
+
+const char* const ConfigBundle::FILES[] = {
+  "/settings.json",
+  "/devices.json",
+  DEVICE_JOURNAL_FILE
+};
+const size_t ConfigBundle::FILE_COUNT = sizeof(FILES) / sizeof(FILES[0]);
+
+static const uint8_t BUNDLE_HEADER[CONFIG_BUNDLE_HEADER_LENGTH] = {
+  'C', 'F', 'G', 'Z', CONFIG_BUNDLE_VERSION, LZSS_WINDOW_BITS, LZSS_LENGTH_BITS, 0
+};
+
+size_t ConfigBundle::Exporter::fillContainer(uint8_t* buffer, size_t bufferSize) {
+  size_t length = 0;
+
+  switch (state) {
+    case ENTRY: {
+      while (fileIndex < FILE_COUNT && !SPIFFS.exists(FILES[fileIndex])) {
+        fileIndex++;
+      }
+      if (fileIndex == FILE_COUNT) {
+        state = TERMINATOR;
+        return fillContainer(buffer, bufferSize);
+      }
+
+      file = SPIFFS.open(FILES[fileIndex], "r");
+      if (!file) {
+        fileIndex++;
+        return fillContainer(buffer, bufferSize);
+      }
+
+      size_t nameLength = strlen(FILES[fileIndex]);
+      uint32_t size = file.size();
+      buffer[length++] = nameLength;
+      memcpy(buffer + length, FILES[fileIndex], nameLength);
+      length += nameLength;
+      for (uint8_t i = 0; i < 4; i++) {
+        buffer[length++] = size >> (8 * i);
+      }
+      remaining = size;
+      state = DATA;
+      break;
+    }
+
+    case DATA:
+      // Exactly the size declared in the entry header, even if the main task
+      // appends to or replaces the file while the export runs.
+      if (remaining == 0) {
+        file.close();
+        fileIndex++;
+        state = ENTRY;
+        return fillContainer(buffer, bufferSize);
+      }
+      length = file.read(buffer, min(bufferSize, (size_t)remaining));
+      if (length == 0) {
+        Serial.printf("[ConfigBundle] %s shrank during export, aborting\n", FILES[fileIndex]);
+        file.close();
+        state = FAILED;
+        return 0;
+      }
+      remaining -= length;
+      break;
+
+    case TERMINATOR:
+      buffer[length++] = 0;
+      state = CHECKSUM;
+      break;
+
+    case CHECKSUM: {
+      uint32_t value = ~crc;
+      for (uint8_t i = 0; i < 4; i++) {
+        buffer[i] = value >> (8 * i);
+      }
+      state = DONE;
+      return 4;
+    }
+
+    case DONE:
+    case FAILED:
+      return 0;
+  }
+
+  crc = CrcPrint::update(crc, buffer, length);
+  return length;
+}
+
+size_t ConfigBundle::Exporter::read(uint8_t* out, size_t maxLength) {
+  size_t produced = 0;
+  while (headerSent < CONFIG_BUNDLE_HEADER_LENGTH && produced < maxLength) {
+    out[produced++] = BUNDLE_HEADER[headerSent++];
+  }
+
+  while (produced < maxLength && !encoder.isFinished()) {
+    if (pendingSent < pendingLength) {
+      pendingSent += encoder.sink(pending + pendingSent, pendingLength - pendingSent);
+    } else if (state == FAILED) {
+      // Ending the stream early leaves a bundle the importer rejects as truncated.
+      break;
+    } else if (state != DONE) {
+      pendingLength = fillContainer(pending, sizeof(pending));
+      pendingSent = 0;
+      continue;
+    } else {
+      encoder.finish();
+    }
+    produced += encoder.poll(out + produced, maxLength - produced);
+  }
+  return produced;
+}
+
+ConfigBundle::Importer::Importer(const char*& error) : error(error), decoder(*this) {}
+
+size_t ConfigBundle::Importer::fail(const char* reason) {
+  if (!error) error = reason;
+  if (file) file.close();
+  return 0;
+}
+
+bool ConfigBundle::Importer::startEntry() {
+  size_t index = 0;
+  while (index < FILE_COUNT && strcmp(FILES[index], name) != 0) {
+    index++;
+  }
+  if (index == FILE_COUNT) return fail("unknown_file");
+  if (hasFile(index)) return fail("duplicate_file");
+
+  if (SPIFFS.totalBytes() - SPIFFS.usedBytes() < remaining + 512) return fail("no_space");
+
+  file = SPIFFS.open(importPath(name), "w");
+  if (!file) return fail("write_failed");
+
+  imported |= 1UL << index;
+  return true;
+}
+
+bool ConfigBundle::Importer::flushBuffer() {
+  bool written = file.write(buffer, bufferLength) == bufferLength;
+  bufferLength = 0;
+  return written || fail("write_failed");
+}
+
+size_t ConfigBundle::Importer::write(uint8_t value) {
+  if (state == DONE) return fail("trailing_data");
+  if (state != CHECKSUM) crc = CrcPrint::update(crc, &value, 1);
+
+  switch (state) {
+    case NAME_LENGTH:
+      position = 0;
+      field = 0;
+      if (value == 0) {
+        state = CHECKSUM;
+      } else if (value > CONFIG_BUNDLE_NAME_MAX) {
+        return fail("bad_name");
+      } else {
+        nameLength = value;
+        state = NAME;
+      }
+      break;
+
+    case NAME:
+      name[position++] = value;
+      if (position == nameLength) {
+        name[position] = '\0';
+        position = 0;
+        state = SIZE;
+      }
+      break;
+
+    case SIZE:
+      field |= (uint32_t)value << (8 * position++);
+      if (position == 4) {
+        remaining = field;
+        if (!startEntry()) return 0;
+        if (remaining == 0) {
+          file.close();
+          state = NAME_LENGTH;
+        } else {
+          state = DATA;
+        }
+      }
+      break;
+
+    case DATA:
+      buffer[bufferLength++] = value;
+      if (--remaining == 0 || bufferLength == sizeof(buffer)) {
+        if (!flushBuffer()) return 0;
+      }
+      if (remaining == 0) {
+        file.close();
+        state = NAME_LENGTH;
+      }
+      break;
+
+    case CHECKSUM:
+      field |= (uint32_t)value << (8 * position++);
+      if (position == 4) {
+        if (field != ~crc) return fail("bad_checksum");
+        state = DONE;
+      }
+      break;
+
+    case DONE:
+      break;
+  }
+  return 1;
+}
+
+bool ConfigBundle::Importer::feed(const uint8_t* data, size_t length) {
+  return decoder.write(data, length);
+}
+
+ConfigBundle::ConfigBundle(Persistence& persistence) : persistence(persistence) {}
+
+void ConfigBundle::begin() {
+  for (size_t i = 0; i < FILE_COUNT; i++) {
+    String backup = backupPath(FILES[i]);
+    if (!SPIFFS.exists(backup)) continue;
+    if (SPIFFS.exists(FILES[i])) {
+      SPIFFS.remove(backup);
+    } else if (SPIFFS.rename(backup, FILES[i])) {
+      Serial.printf("[ConfigBundle] Restored %s from backup\n", FILES[i]);
+    }
+  }
+  discardImport();
+}
+
+std::shared_ptr<ConfigBundle::Exporter> ConfigBundle::createExporter() {
+  auto exporter = std::make_shared<Exporter>();
+  if (!exporter->isValid()) {
+    return nullptr;
+  }
+  return exporter;
+}
+
+void ConfigBundle::beginImport() {
+  if (commitPending) {
+    error = "busy";
+    return;
+  }
+  discardImport();
+  error = nullptr;
+  headerReceived = 0;
+  importActivity = millis();
+
+  importer.reset(new Importer(error));
+  if (!importer->isValid()) {
+    error = "no_memory";
+  }
+  Serial.println("[ConfigBundle] Import started");
+}
+
+bool ConfigBundle::writeImport(const uint8_t* data, size_t length) {
+  if (!importer || error) {
+    return false;
+  }
+  importActivity = millis();
+
+  if (headerReceived < CONFIG_BUNDLE_HEADER_LENGTH) {
+    size_t chunk = min(length, CONFIG_BUNDLE_HEADER_LENGTH - headerReceived);
+    memcpy(header + headerReceived, data, chunk);
+    headerReceived += chunk;
+    data += chunk;
+    length -= chunk;
+
+    if (headerReceived == CONFIG_BUNDLE_HEADER_LENGTH && memcmp(header, BUNDLE_HEADER, 7) != 0) {
+      error = "bad_header";
+      return false;
+    }
+  }
+
+  if (length > 0 && !importer->feed(data, length)) {
+    if (!error) error = "corrupt";
+    return false;
+  }
+  return true;
+}
+
+bool ConfigBundle::endImport() {
+  bool success = importer && !error && importer->isComplete();
+  if (importer && !error && !success) {
+    error = "truncated";
+  }
+
+  if (success) {
+    commitPending = true;
+    Serial.println("[ConfigBundle] Import staged");
+  } else {
+    if (importer) discardImport();
+    Serial.printf("[ConfigBundle] Import rejected: %s\n", error ? error : "no_import");
+  }
+  return success;
+}
+
+bool ConfigBundle::commitImport() {
+  // Pending write-behind jobs and the shutdown flush must not overwrite what
+  // was just restored; files missing from the bundle are moved aside too so
+  // the result matches the exported state exactly.
+  persistence.discardPending();
+
+  for (size_t i = 0; i < FILE_COUNT; i++) {
+    String path = FILES[i];
+    String tempPath = path + ".tmp";
+    String backup = backupPath(FILES[i]);
+    if (SPIFFS.exists(tempPath)) SPIFFS.remove(tempPath);
+    if (SPIFFS.exists(backup)) SPIFFS.remove(backup);
+
+    bool moved = !SPIFFS.exists(path) || SPIFFS.rename(path, backup);
+    if (!moved || (importer->hasFile(i) && !SPIFFS.rename(importPath(FILES[i]), path))) {
+      Serial.printf("[ConfigBundle] Rename to %s failed\n", path.c_str());
+      error = "rename_failed";
+      rollbackImport(i);
+      return false;
+    }
+  }
+
+  for (size_t i = 0; i < FILE_COUNT; i++) {
+    String backup = backupPath(FILES[i]);
+    if (SPIFFS.exists(backup)) SPIFFS.remove(backup);
+  }
+  return true;
+}
+
+// Files before `failed` were replaced and are undone; at `failed` itself the
+// live file is either still in place or sits in its .bak.
+void ConfigBundle::rollbackImport(size_t failed) {
+  for (size_t i = 0; i <= failed; i++) {
+    if (i < failed && importer->hasFile(i)) SPIFFS.remove(FILES[i]);
+
+    String backup = backupPath(FILES[i]);
+    if (SPIFFS.exists(backup) && !SPIFFS.rename(backup, FILES[i])) {
+      Serial.printf("[ConfigBundle] Restore of %s failed\n", FILES[i]);
+    }
+  }
+}
+
+void ConfigBundle::discardImport() {
+  importer.reset();
+  for (size_t i = 0; i < FILE_COUNT; i++) {
+    String path = importPath(FILES[i]);
+    if (SPIFFS.exists(path)) SPIFFS.remove(path);
+  }
+}
+
+void ConfigBundle::loop() {
+  if (commitPending) {
+    bool success = commitImport();
+    discardImport();
+    commitPending = false;
+
+    if (success) {
+      if (reloadHandler) reloadHandler();
+      restartAt = max(1UL, millis());
+      Serial.println("[ConfigBundle] Import committed, restarting");
+    } else {
+      Serial.printf("[ConfigBundle] Import commit failed: %s\n", error);
+    }
+    return;
+  }
+
+  if (importer && millis() - importActivity > CONFIG_BUNDLE_IMPORT_TIMEOUT_MS) {
+    Serial.println("[ConfigBundle] Import timed out");
+    error = "timeout";
+    discardImport();
+  }
+
+  if (restartAt && millis() - restartAt > CONFIG_BUNDLE_RESTART_DELAY_MS) {
+    ESP.restart();
+  }
+}
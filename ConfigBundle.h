@@ -0,0 +1,126 @@
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+#include <memory>
+#include "CommonTypes.h"
+#include "Persistence.h"
+#include "Lzss.h"
+
+#define CONFIG_BUNDLE_VERSION 1
+#define CONFIG_BUNDLE_HEADER_LENGTH 8
+#define CONFIG_BUNDLE_NAME_MAX 31
+#define CONFIG_BUNDLE_RESTART_DELAY_MS 500
+#define CONFIG_BUNDLE_IMPORT_TIMEOUT_MS 15000
+
+// Bundle: 8-byte header ("CFGZ", version, window bits, length bits, 0), then an
+// LZSS stream of entries [nameLength:u8][name][size:u32le][data], a zero
+// nameLength and the CRC32 of everything before it (u32le). Files are stored
+// raw, including their persistence footers.
+class ConfigBundle {
+public:
+  static const char* const FILES[];
+  static const size_t FILE_COUNT;
+
+  // Pulled from the chunked /backup response on the async_tcp task, so it
+  // reads the files as they are on flash and never runs Persistence recovery.
+  class Exporter {
+  public:
+    size_t read(uint8_t* out, size_t maxLength);
+    bool isValid() const { return encoder.isValid(); }
+
+  private:
+    enum State : uint8_t { ENTRY, DATA, TERMINATOR, CHECKSUM, DONE, FAILED };
+
+    LzssEncoder encoder;
+    File file;
+    State state = ENTRY;
+    size_t fileIndex = 0;
+    uint32_t remaining = 0;
+    size_t headerSent = 0;
+    uint32_t crc = 0xFFFFFFFF;
+
+    uint8_t pending[256];
+    size_t pendingLength = 0;
+    size_t pendingSent = 0;
+
+    size_t fillContainer(uint8_t* buffer, size_t bufferSize);
+  };
+
+  typedef std::function<void()> ReloadHandler;
+
+  explicit ConfigBundle(Persistence& persistence);
+
+  // After SPIFFS is mounted: puts back files a commit interrupted by a reset
+  // had already moved aside.
+  void begin();
+
+  std::shared_ptr<Exporter> createExporter();
+
+  // Called from the upload handler: the bundle is decoded into *.imp files
+  // next to the live ones. endImport() only validates; the live files are
+  // replaced by loop() on the main task.
+  void beginImport();
+  bool writeImport(const uint8_t* data, size_t length);
+  bool endImport();
+  const char* importError() const { return error; }
+
+  // Runs on the main task after a successful commit, before the restart.
+  void onReload(ReloadHandler handler) { reloadHandler = handler; }
+
+  void loop();
+  bool isBusy() const { return importer != nullptr || commitPending || restartAt != 0; }
+  // Devices were reloaded under Control; it must not run until the restart.
+  bool isRestarting() const { return restartAt != 0; }
+
+private:
+  class Importer : public Print {
+  public:
+    explicit Importer(const char*& error);
+
+    size_t write(uint8_t value) override;
+    bool feed(const uint8_t* data, size_t length);
+    bool isValid() const { return decoder.isValid(); }
+    bool isComplete() const { return state == DONE; }
+    bool hasFile(size_t index) const { return imported & (1UL << index); }
+
+  private:
+    enum State : uint8_t { NAME_LENGTH, NAME, SIZE, DATA, CHECKSUM, DONE };
+
+    const char*& error;
+    LzssDecoder decoder;
+    State state = NAME_LENGTH;
+    uint32_t crc = 0xFFFFFFFF;
+    uint32_t imported = 0;
+
+    char name[CONFIG_BUNDLE_NAME_MAX + 1];
+    uint8_t nameLength = 0;
+    uint8_t position = 0;
+    uint32_t field = 0;
+    uint32_t remaining = 0;
+    File file;
+
+    uint8_t buffer[256];
+    size_t bufferLength = 0;
+
+    bool startEntry();
+    bool flushBuffer();
+    size_t fail(const char* reason);
+  };
+
+  Persistence& persistence;
+  std::unique_ptr<Importer> importer;
+  uint8_t header[CONFIG_BUNDLE_HEADER_LENGTH];
+  size_t headerReceived = 0;
+  const char* error = nullptr;
+  unsigned long importActivity = 0;
+  unsigned long restartAt = 0;
+  volatile bool commitPending = false;
+  ReloadHandler reloadHandler;
+
+  static String importPath(const char* path) { return String(path) + ".imp"; }
+  static String backupPath(const char* path) { return String(path) + ".bak"; }
+  void discardImport();
+  bool commitImport();
+  void rollbackImport(size_t failed);
+};
@@ -1,7 +1,8 @@
 #include "ConfigSettings.h"
 
-Settings::Settings(AppState& appState) :
+Settings::Settings(AppState& appState, Persistence& persistence) :
 appState(appState),
+persistence(persistence),
 ws() {}
 
 void Settings::printFsInfo() {
@@ -28,12 +29,18 @@ void Settings::begin() {
     Serial.println("\nSPIFFS mounted successfully\n");
 
     printFsInfo();
+    persistence.begin();
   } else {
     Serial.println("\nFailed to mount SPIFFS\n");
   }
 
 }
 
+void Settings::reportMemoryPlacement(MemoryPlacementReport& report) {
+  report.add("Settings", ws.networkSettings);
+  report.add("Settings", ws.telegramSettings.telegramUsers);
+}
+
 bool Settings::isFSMounted() {
   if (spiffsMounted) {
     return true;
@@ -140,7 +147,7 @@ ws.telegramSettings.lastMessage = "";
 
 if (saveToFile) {
 Serial.println("Saving default settings to file");
-return saveSettings();
+return saveSettingsNow();
 }
 
 Serial.println("Loaded default settings (not saved to file)");
@@ -148,7 +155,7 @@ return true;
 }
 
 String Settings::serializeSettings(const WiFiSettings& settings) {
-  DynamicJsonDocument doc(4096);
+  PsramJsonDocument doc(4096);
 
   doc["isWifiTurnedOn"] = settings.isWifiTurnedOn;
   doc["currentIdNetworkSetting"] = settings.currentIdNetworkSetting;
@@ -287,16 +294,12 @@ bool Settings::loadSettings() {
 bool Settings::loadSettingsFromFile(const char* filename) {
   if (!isFSMounted()) return false;
 
-  if (!SPIFFS.exists(filename)) {
+  PersistedFile file;
+  if (!persistence.openRead(filename, file)) {
     return false;
   }
 
-  File file = SPIFFS.open(filename, "r");
-  if (!file) {
-    return false;
-  }
-
-  DynamicJsonDocument doc(4096);
+  PsramJsonDocument doc(4096);
   DeserializationError error = deserializeJson(doc, file);
   file.close();
 
@@ -308,25 +311,26 @@ bool Settings::loadSettingsFromFile(const char* filename) {
   return deserializeSettings(doc.as<JsonObject>(), ws);
 }
 
-bool Settings::saveSettings() {
-
-  File file = SPIFFS.open("/settings.json", "w");
-
-  if (!file) {
-    Serial.println("Ошибка открытия файла для записи");
-    return false;
-  }
-
-   String jsonString = serializeSettings(ws);
-   yield();
-   file.print(jsonString);
+bool Settings::writeSettings(Print& out) {
+  String jsonString = serializeSettings(ws);
+  yield();
+  return out.print(jsonString) == jsonString.length();
+}
 
-  file.close();
-  return true;
+void Settings::saveSettings() {
+  persistence.submit("/settings.json", [this](Print& out) {
+    return writeSettings(out);
+  }, SETTINGS_SAVE_QUIET_MS);
+}
 
+bool Settings::saveSettingsNow() {
+  return persistence.writeNow("/settings.json", [this](Print& out) {
+    return writeSettings(out);
+  });
 }
 
 void Settings::format() {
+  persistence.discardPending();
   WiFi.disconnect(true);
   delay(100);
   WiFi.mode(WIFI_OFF);
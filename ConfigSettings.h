@@ -4,9 +4,12 @@
 #include <IPAddress.h>
 #include <WString.h>
 #include "AppState.h"
+#include "Persistence.h"
 
 #include "CommonTypes.h"
 
+#define SETTINGS_SAVE_QUIET_MS 2000
+
 struct TelegramUser {
   String id;
   bool reading;
@@ -57,10 +60,13 @@ struct WiFiSettings {
 
 class Settings {
 public:
-    Settings(AppState& appState);
+    Settings(AppState& appState, Persistence& persistence);
 
     bool loadSettings();
-    bool saveSettings();
+    // Queues a write-behind save; use saveSettingsNow() when the caller
+    // reports the result or restarts right after.
+    void saveSettings();
+    bool saveSettingsNow();
     bool loadDefaults(bool saveToFile = false);
 
     bool isFSMounted();
@@ -68,18 +74,20 @@ public:
     bool freeSpaceFS();
     void format();
     void begin();
+    void reportMemoryPlacement(MemoryPlacementReport& report);
 
     WiFiSettings ws;
 
 private:
     AppState& appState;
+    Persistence& persistence;
     bool spiffsMounted = false;
 
     String serializeSettings(const WiFiSettings& settings);
+    bool writeSettings(Print& out);
 
     bool deserializeSettings(JsonObject doc, WiFiSettings& settings);
 
     bool loadSettingsFromFile(const char* filename);
-    bool saveSettingsToFile(const char* filename, const String& jsonString);
 
 };
@@ -24,6 +24,8 @@
  void Control::loop() {
     unsigned long now = millis();
 
+      adoptShadowDevice();
+
       readSensors();
 
     static unsigned long lastSensorRead = 0;
@@ -202,9 +204,9 @@
   }
 
   void Control::updatePins() {
-    if (myDevices.empty()) return;
-
-    Device& currentDevice = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) return;
+    Device& currentDevice = *current;
     static std::unordered_map<int, bool> lastPinStates;
     static std::unordered_map<int, uint8_t> lastPwmValues;
 
@@ -212,8 +214,10 @@
 
       if (relay.isOutput) {
 
+        size_t relayIndex = currentDevice.indexOf(relay);
+
         if (relay.isPwm) {
-          uint8_t newPwmValue = relay.pwm;
+          uint8_t newPwmValue = currentDevice.runtime.pwmValue(relayIndex);
 
           if (lastPwmValues[relay.pin] != newPwmValue) {
             analogWrite(relay.pin, newPwmValue);
@@ -228,7 +232,7 @@
         }
 
         else {
-          bool newState = relay.statePin;
+          bool newState = currentDevice.runtime.output(relayIndex);
 
           if (lastPinStates[relay.pin] != newState) {
             digitalWrite(relay.pin, newState ? HIGH : LOW);
@@ -248,24 +252,25 @@
   void Control::controlOutputs(OutPower& outPower) {
     if (!outPower.isUseSetting) return;
 
-    if (myDevices.empty()) return;
-    Device& device = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) return;
+    Device& device = *current;
 
     Relay* relay = findRelayById(device, outPower.relayId);
 
     if (relay) {
 
       if (relay->isOutput && !relay->manualMode) {
-        relay->statePin = outPower.statePin;
+        device.runtime.setOutput(device.indexOf(*relay), outPower.statePin);
       }
     }
   }
 
 void Control::setTemperature() {
 
-  if (myDevices.empty()) return;
-
-  Device& device = myDevices[currentDeviceIndex];
+  Device* current = deviceManager.currentDevice();
+  if (!current) return;
+  Device& device = *current;
   Temperature& temp = device.temperature;
 
   static bool wasActive = false;
@@ -286,9 +291,10 @@ void Control::setTemperature() {
     if (wasActive) {
 
       if (temp.relayPtr) {
-        temp.relayPtr->statePin = temp.relayPtr->lastState;
+        size_t relayIndex = device.indexOf(*temp.relayPtr);
+        device.runtime.setOutput(relayIndex, device.runtime.savedOutput(relayIndex));
         temp.relayPtr->isPwm = false;
-        temp.relayPtr->pwm = 0;
+        device.runtime.setPwm(relayIndex, 0);
       }
 
       if (myPID) {
@@ -313,12 +319,13 @@ void Control::setTemperature() {
       return;
     }
 
-    temp.relayPtr->lastState = temp.relayPtr->statePin;
+    size_t relayIndex = device.indexOf(*temp.relayPtr);
+    device.runtime.setSavedOutput(relayIndex, device.runtime.output(relayIndex));
 
     if (temp.collectionSettings.get(0) && temp.selectedPidIndex < device.pids.size()) {
       Pid& pidSettings = device.pids[temp.selectedPidIndex];
 
-      inputPid = static_cast<double>(temp.sensorPtr->currentValue);
+      inputPid = static_cast<double>(device.runtime.sensorValue(device.indexOf(*temp.sensorPtr)));
       setpointPid = static_cast<double>(temp.setTemperature);
       outputPid = 0.0;
 
@@ -345,7 +352,7 @@ void Control::setTemperature() {
     return;
   }
 
-  temp.currentTemp = temp.sensorPtr->currentValue;
+  temp.currentTemp = device.runtime.sensorValue(device.indexOf(*temp.sensorPtr));
 
   if (temp.sensorId != lastSensorId || temp.relayId != lastRelayId) {
     lastSensorId = temp.sensorId;
@@ -364,7 +371,7 @@ void Control::setTemperature() {
     temp.relayPtr->isPwm = true;
     uint8_t pwmValue = map(static_cast<long>(outputPid), 0, pidWindowSize, 0, 255);
     if (!temp.relayPtr->manualMode) {
-      temp.relayPtr->pwm = pwmValue;
+      device.runtime.setPwm(device.indexOf(*temp.relayPtr), pwmValue);
     }
 
     static unsigned long lastPidLog = 0;
@@ -383,16 +390,59 @@ void Control::setTemperature() {
 
     if (temp.isIncrease) {
 
-      if (temp.collectionSettings.get(0) && !temp.relayPtr->manualMode) { temp.relayPtr->statePin = (temp.currentTemp < temp.setTemperature); }
+      if (temp.collectionSettings.get(0) && !temp.relayPtr->manualMode) { device.runtime.setOutput(device.indexOf(*temp.relayPtr), temp.currentTemp < temp.setTemperature); }
       else if (temp.collectionSettings.get(1) ) {  device.isTimersEnabled = (temp.pidOutputMs > 0); }
     } else {
 
-       if (temp.collectionSettings.get(0) && !temp.relayPtr->manualMode) {  temp.relayPtr->statePin = (temp.currentTemp > temp.setTemperature); }
+       if (temp.collectionSettings.get(0) && !temp.relayPtr->manualMode) {  device.runtime.setOutput(device.indexOf(*temp.relayPtr), temp.currentTemp > temp.setTemperature); }
          else if (temp.collectionSettings.get(1) ) {  device.isTimersEnabled = (temp.pidOutputMs < pidWindowSize * 0.5); }
     }
   }
 }
 
+// Runs at the top of loop(), before any stage touches the device. DHT
+// drivers move to the sensor with the same id, type and input; the PID and
+// its timing stay as they are, only the temperature bindings are re-resolved.
+void Control::adoptShadowDevice() {
+  Device* next = deviceManager.shadow();
+  if (!next) return;
+
+  uint8_t index = deviceManager.shadowIndex();
+  bool isCurrent = index == currentDeviceIndex && index < myDevices.size();
+  Device* live = isCurrent ? deviceManager.currentDevice() : nullptr;
+
+  if (live) {
+    for (Sensor& sensor : live->sensors) {
+      if (!sensor.dht) continue;
+
+      Sensor* match = findSensorById(*next, sensor.sensorId);
+      if (match && !match->dht && match->relayId == sensor.relayId && match->typeSensor.bits == sensor.typeSensor.bits) {
+        match->dht = sensor.dht;
+      } else {
+        delete sensor.dht;
+      }
+      sensor.dht = nullptr;
+    }
+  }
+
+  uint16_t sections = deviceManager.commitShadowDevice();
+  if (!live) return;
+
+  Device& device = *live;
+  Temperature& temp = device.temperature;
+  temp.sensorPtr = temp.isUseSetting ? findSensorById(device, temp.sensorId) : nullptr;
+  temp.relayPtr = temp.isUseSetting ? findRelayById(device, temp.relayId) : nullptr;
+
+  currentlyReadingDhtSensor = nullptr;
+  dhtReadState = DHT_IDLE;
+  nextDhtSensorIndex = 0;
+
+  if (sections & (DEVICE_SECTION_RELAYS | DEVICE_SECTION_PINS | DEVICE_SECTION_SENSORS)) {
+    setupControl();
+  }
+  logger.addLog("Настройки устройства применены");
+}
+
 Relay* Control::findRelayById(Device& device, int id) {
 
   for (auto& relay : device.relays) {
@@ -423,8 +473,9 @@ Sensor* Control::findSensorById(Device& device, int id) {
   void Control::collectionSettingsTimer(uint8_t currentTimerIndex) {
     static bool prevHadTempControl = false;
 
-    if (myDevices.empty()) return;
-    Device& device = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) return;
+    Device& device = *current;
     Timer& currentTimer = device.timers[currentTimerIndex];
 
     if (prevHadTempControl && !currentTimer.collectionSettings.get(0)) {
@@ -450,13 +501,14 @@ Sensor* Control::findSensorById(Device& device, int id) {
     static unsigned long timerStartTime = 0;
     static bool timersCompleted = false;
 
-    if (myDevices.empty()) return;
-    Device& device = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) return;
+    Device& device = *current;
 
     if (!device.isTimersEnabled || device.timers.empty()) {
 
-      for (auto& timer : device.timers) {
-        timer.progress = {0, 0, false, false};
+      for (size_t i = 0; i < device.timers.size(); i++) {
+        device.runtime.setTimer(i, {0, 0, false, false});
       }
 
       currentTimerIndex = 0;
@@ -468,7 +520,7 @@ Sensor* Control::findSensorById(Device& device, int id) {
       return;
     }
 
-    if (!device.timers[currentTimerIndex].progress.isRunning) {
+    if (!device.runtime.timer(currentTimerIndex).isRunning) {
 
       while (currentTimerIndex < device.timers.size() && !device.timers[currentTimerIndex].isUseSetting) {
         currentTimerIndex++;
@@ -478,20 +530,18 @@ Sensor* Control::findSensorById(Device& device, int id) {
         return;
       }
 
-      device.timers[currentTimerIndex].progress.isStopped = false;
       timerStartTime = millis();
-      device.timers[currentTimerIndex].progress.isRunning = true;
+      device.runtime.setTimerRunning(currentTimerIndex, true, false);
       controlOutputs(device.timers[currentTimerIndex].initialStateRelay);
       timersCompleted = false;
     }
 
-    if (device.timers[currentTimerIndex].progress.isRunning) {
+    if (device.runtime.timer(currentTimerIndex).isRunning) {
 
       if (!device.timers[currentTimerIndex].isUseSetting) {
         Serial.printf("Таймер %d был отключен пользователем во время работы. Останавливаю.\n", currentTimerIndex);
 
-        device.timers[currentTimerIndex].progress.isRunning = false;
-        device.timers[currentTimerIndex].progress.isStopped = true;
+        device.runtime.setTimerRunning(currentTimerIndex, false, true);
 
         currentTimerIndex = 0;
         timersCompleted = false;
@@ -503,17 +553,16 @@ Sensor* Control::findSensorById(Device& device, int id) {
         unsigned long elapsedTime = (currentTime - timerStartTime) / 1000;
         unsigned long remainingTime = (timerDuration > elapsedTime) ? (timerDuration - elapsedTime) : 0;
 
-        device.timers[currentTimerIndex].progress = {
+        device.runtime.setTimer(currentTimerIndex, {
           elapsedTime,
           remainingTime,
           true,
           false,
-        };
+        });
 
         if (elapsedTime >= timerDuration) {
           collectionSettingsTimer(currentTimerIndex);
-          device.timers[currentTimerIndex].progress.isRunning = false;
-          device.timers[currentTimerIndex].progress.isStopped = true;
+          device.runtime.setTimerRunning(currentTimerIndex, false, true);
 
           size_t nextTimerIndex = currentTimerIndex + 1;
           while (nextTimerIndex < device.timers.size() && !device.timers[nextTimerIndex].isUseSetting) {
@@ -548,8 +597,9 @@ Sensor* Control::findSensorById(Device& device, int id) {
     static bool lastStateTemperature = false;
     static bool prevTimersEnabled = false;
 
-    if (myDevices.empty()) return;
-    Device& device = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) return;
+    Device& device = *current;
     bool stateChanged = (device.isTimersEnabled != prevTimersEnabled);
     prevTimersEnabled = device.isTimersEnabled;
 
@@ -558,18 +608,20 @@ Sensor* Control::findSensorById(Device& device, int id) {
       logger.addLog("Сохраняем таймеры");
 
       std::unordered_set<uint8_t> relayIds;
-      for (auto& timer : device.timers) {
+      for (size_t i = 0; i < device.timers.size(); i++) {
+        const Timer& timer = device.timers[i];
         if (timer.isUseSetting) {
           relayIds.insert(timer.initialStateRelay.relayId);
           relayIds.insert(timer.endStateRelay.relayId);
         }
-        timer.progress.clear();
+        device.runtime.setTimer(i, TimerInfo());
       }
 
       for (uint8_t relayId : relayIds) {
         Relay* relay = findRelayById(device, relayId);
         if (relay && relay->isOutput) {
-          relay->lastState = relay->statePin;
+          size_t relayIndex = device.indexOf(*relay);
+          device.runtime.setSavedOutput(relayIndex, device.runtime.output(relayIndex));
         }
       }
 
@@ -592,7 +644,8 @@ Sensor* Control::findSensorById(Device& device, int id) {
       for (uint8_t relayId : relayIds) {
         Relay* relay = findRelayById(device, relayId);
         if (relay && relay->isOutput) {
-          relay->statePin = relay->lastState;
+          size_t relayIndex = device.indexOf(*relay);
+          device.runtime.setOutput(relayIndex, device.runtime.savedOutput(relayIndex));
         }
       }
 
@@ -604,62 +657,69 @@ Sensor* Control::findSensorById(Device& device, int id) {
   }
 
   void Control::saveRelayStates(uint8_t relayId) {
-    if (myDevices.empty()) return;
-    Device& device = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) return;
+    Device& device = *current;
 
     Relay* relay = findRelayById(device, relayId);
     if (relay && relay->isOutput) {
-      relay->lastState = relay->statePin;
+      size_t relayIndex = device.indexOf(*relay);
+      device.runtime.setSavedOutput(relayIndex, device.runtime.output(relayIndex));
     }
   }
 
   void Control::restoreRelayStates(uint8_t relayId) {
-    if (myDevices.empty()) return;
-    Device& device = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) return;
+    Device& device = *current;
 
     Relay* relay = findRelayById(device, relayId);
     if (relay && relay->isOutput && !relay->manualMode) {
-      relay->statePin = relay->lastState;
+      size_t relayIndex = device.indexOf(*relay);
+      device.runtime.setOutput(relayIndex, device.runtime.savedOutput(relayIndex));
     }
   }
 
   void Control::collectionSettingsSchedule(bool start, ScheduleScenario& scenario) {
-    if (myDevices.empty()) return;
-    Device& device = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) return;
+    Device& device = *current;
+    DeviceRuntime& runtime = device.runtime;
+    size_t scenarioIndex = device.indexOf(scenario);
 
     if (start) {
 
-      scenario.scenarioProcessed = false;
+      runtime.setScenarioFlag(scenarioIndex, SCENARIO_PROCESSED, false);
 
       if (scenario.collectionSettings.get(2)) {
         saveRelayStates(scenario.initialStateRelay.relayId);
       }
 
-      if (scenario.collectionSettings.get(0) && !scenario.temperatureUpdated) {
+      if (scenario.collectionSettings.get(0) && !runtime.scenarioFlag(scenarioIndex, SCENARIO_TEMPERATURE_UPDATED)) {
 
         device.temperature.isUseSetting = true;
-        scenario.temperatureUpdated = true;
+        runtime.setScenarioFlag(scenarioIndex, SCENARIO_TEMPERATURE_UPDATED, true);
         logger.addLog("Температурный контроль активирован (schedule)");
       }
 
-      if (scenario.collectionSettings.get(1) && !scenario.timersExecuted) {
+      if (scenario.collectionSettings.get(1) && !runtime.scenarioFlag(scenarioIndex, SCENARIO_TIMERS_EXECUTED)) {
 
         device.isTimersEnabled = true;
-        scenario.timersExecuted = true;
+        runtime.setScenarioFlag(scenarioIndex, SCENARIO_TIMERS_EXECUTED, true);
         logger.addLog("Таймеры активированы (schedule)");
       }
 
-      if (scenario.collectionSettings.get(2) && !scenario.initialStateApplied) {
+      if (scenario.collectionSettings.get(2) && !runtime.scenarioFlag(scenarioIndex, SCENARIO_INITIAL_APPLIED)) {
 
         controlOutputs(scenario.initialStateRelay);
-        scenario.initialStateApplied = true;
+        runtime.setScenarioFlag(scenarioIndex, SCENARIO_INITIAL_APPLIED, true);
         logger.addLog("Применено начальное состояние реле (schedule)");
       }
 
     } else {
 
-      if (!scenario.scenarioProcessed) {
-        scenario.scenarioProcessed = true;
+      if (!runtime.scenarioFlag(scenarioIndex, SCENARIO_PROCESSED)) {
+        runtime.setScenarioFlag(scenarioIndex, SCENARIO_PROCESSED, true);
 
         if (scenario.collectionSettings.get(0)) {
           device.temperature.isUseSetting = false;
@@ -684,10 +744,10 @@ Sensor* Control::findSensorById(Device& device, int id) {
         }
       }
 
-      scenario.temperatureUpdated = false;
-      scenario.timersExecuted = false;
-      scenario.initialStateApplied = false;
-      scenario.endStateApplied = false;
+      runtime.setScenarioFlag(scenarioIndex, SCENARIO_TEMPERATURE_UPDATED, false);
+      runtime.setScenarioFlag(scenarioIndex, SCENARIO_TIMERS_EXECUTED, false);
+      runtime.setScenarioFlag(scenarioIndex, SCENARIO_INITIAL_APPLIED, false);
+      runtime.setScenarioFlag(scenarioIndex, SCENARIO_END_APPLIED, false);
     }
   }
 
@@ -732,8 +792,9 @@ Sensor* Control::findSensorById(Device& device, int id) {
   }
 
   void Control::setSchedules() {
-    if (myDevices.empty()) return;
-    Device& device = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) return;
+    Device& device = *current;
 
     static bool lastScheduleState = device.isScheduleEnabled;
     if (lastScheduleState != device.isScheduleEnabled) {
@@ -764,7 +825,7 @@ Sensor* Control::findSensorById(Device& device, int id) {
       if (!scenario.isUseSetting) {
         if (scenario.isActive) {
           String message = "Deactivating scenario '";
-          message += scenario.description;
+          message += scenario.description.c_str();
           message += "' (isUseSetting is now false)";
           logger.addLog(message);
 
@@ -781,7 +842,7 @@ Sensor* Control::findSensorById(Device& device, int id) {
       if (currentDate < startDate || (endDate != 0 && currentDate > endDate)) {
         if (scenario.isActive) {
           String message = "Scenario '";
-          message += scenario.description;
+          message += scenario.description.c_str();
           message += "' expired";
           logger.addLog(message);
 
@@ -794,7 +855,7 @@ Sensor* Control::findSensorById(Device& device, int id) {
       if (!scenario.months.get(currentTime.tm_mon)) {
         if (scenario.isActive) {
           String message = "Scenario '";
-          message += scenario.description;
+          message += scenario.description.c_str();
           message += "' inactive this month";
           logger.addLog(message);
 
@@ -807,7 +868,7 @@ Sensor* Control::findSensorById(Device& device, int id) {
       if (!scenario.week.get(shiftWeekDay(currentTime.tm_wday))) {
         if (scenario.isActive) {
           String message = "Scenario '";
-          message += scenario.description;
+          message += scenario.description.c_str();
           message += "' inactive today";
           logger.addLog(message);
 
@@ -830,7 +891,7 @@ Sensor* Control::findSensorById(Device& device, int id) {
 
         if (startTimeStr.length() < 5 || endTimeStr.length() < 5) {
           String message = "Invalid time format in scenario: ";
-          message += scenario.description;
+          message += scenario.description.c_str();
           logger.addLog(message);
           continue;
         }
@@ -858,7 +919,7 @@ Sensor* Control::findSensorById(Device& device, int id) {
         timeStr += String(currentTime.tm_min);
 
         String message = "Activating scenario: ";
-        message += scenario.description;
+        message += scenario.description.c_str();
         message += " | Time: ";
         message += timeStr;
         message += " | Active period: ";
@@ -882,7 +943,7 @@ Sensor* Control::findSensorById(Device& device, int id) {
       }
       else if (!shouldBeActive && scenario.isActive) {
         String message = "Deactivating scenario: ";
-        message += scenario.description;
+        message += scenario.description.c_str();
         message += " (time period ended)";
         logger.addLog(message);
 
@@ -903,7 +964,12 @@ Sensor* Control::findSensorById(Device& device, int id) {
       logger.addLog("Error: Invalid device index! Reset to 0");
     }
 
-    Device& device = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) {
+      logger.addLog("Error: Current device could not be loaded");
+      return;
+    }
+    Device& device = *current;
 
     for (auto& sensor : device.sensors) {
       if ((sensor.typeSensor.get(0) || sensor.typeSensor.get(1)) && sensor.dht == nullptr) {
@@ -954,10 +1020,11 @@ Sensor* Control::findSensorById(Device& device, int id) {
       if (relay.isOutput) {
 
         pinMode(relay.pin, OUTPUT);
-        digitalWrite(relay.pin, relay.statePin ? HIGH : LOW);
+        bool state = device.runtime.output(device.indexOf(relay));
+        digitalWrite(relay.pin, state ? HIGH : LOW);
 
         logger.addLog("Relay init: pin " + String(relay.pin) +
-                      ", state " + String(relay.statePin));
+                      ", state " + String(state));
 
       } else {
 
@@ -1033,7 +1100,8 @@ Sensor* Control::findSensorById(Device& device, int id) {
   float Control::readNTCTemperature(const Sensor& sensor) {
     if (!sensor.typeSensor.get(2)) return -999.0;
 
-    Relay* inputRelay = findRelayById(myDevices[currentDeviceIndex], sensor.relayId);
+    Device* current = deviceManager.currentDevice();
+    Relay* inputRelay = current ? findRelayById(*current, sensor.relayId) : nullptr;
 
     if (!inputRelay || inputRelay->isOutput) {
       return -999.0;
@@ -1063,7 +1131,8 @@ Sensor* Control::findSensorById(Device& device, int id) {
       return -1;
     }
 
-    Relay* inputRelay = findRelayById(myDevices[currentDeviceIndex], sensor.relayId);
+    Device* current = deviceManager.currentDevice();
+    Relay* inputRelay = current ? findRelayById(*current, sensor.relayId) : nullptr;
 
     if (!inputRelay || inputRelay->isOutput) {
       return -1;
@@ -1108,16 +1177,16 @@ Sensor* Control::findSensorById(Device& device, int id) {
     static unsigned long lastDHTRead = 0;
     static unsigned long lastFastRead = 0;
 
-    if (myDevices.empty()) return;
-    if (currentDeviceIndex >= myDevices.size()) return;
-
-    Device& device = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) return;
+    Device& device = *current;
     unsigned long now = millis();
 
     bool timeToReadFast = (now - lastFastRead >= 200);
     bool timeToReadDHT = (now - lastDHTRead >= 1000);
 
-    for (auto& sensor : device.sensors) {
+    for (size_t i = 0; i < device.sensors.size(); i++) {
+      Sensor& sensor = device.sensors[i];
       if (!sensor.isUseSetting) continue;
 
       if (sensor.typeSensor.get(0) || sensor.typeSensor.get(1)) {
@@ -1127,8 +1196,8 @@ Sensor* Control::findSensorById(Device& device, int id) {
             float temp = sensor.dht->readTemperature();
             float hum  = sensor.dht->readHumidity();
 
-            if (!isnan(temp)) sensor.currentValue = temp;
-            if (!isnan(hum))  sensor.humidityValue = hum;
+            if (!isnan(temp)) device.runtime.setSensorValue(i, temp);
+            if (!isnan(hum))  device.runtime.setHumidityValue(i, hum);
           }
         }
       }
@@ -1137,20 +1206,20 @@ Sensor* Control::findSensorById(Device& device, int id) {
 
         if (timeToReadFast) {
           if (sensor.typeSensor.get(2)) {
-            sensor.currentValue = readNTCTemperature(sensor);
+            device.runtime.setSensorValue(i, readNTCTemperature(sensor));
           }
           else if (sensor.typeSensor.get(3)) {
             Relay* inputRelay = findRelayById(device, sensor.relayId);
             if (inputRelay && !inputRelay->isOutput) {
-              sensor.currentValue = checkTouchSensor(inputRelay->pin) ? 1.0f : 0.0f;
+              device.runtime.setSensorValue(i, checkTouchSensor(inputRelay->pin) ? 1.0f : 0.0f);
             }
           }
           else if (sensor.typeSensor.get(4)) {
             int analogVal = readAnalog(sensor);
             if (analogVal != -1) {
-              sensor.currentValue = static_cast<float>(analogVal);
+              device.runtime.setSensorValue(i, static_cast<float>(analogVal));
             } else {
-              sensor.currentValue = -1.0f;
+              device.runtime.setSensorValue(i, -1.0f);
             }
           }
         }
@@ -1166,32 +1235,34 @@ Sensor* Control::findSensorById(Device& device, int id) {
   }
 
   String Control::currentStateSensors() {
-    if (myDevices.empty()) return "No devices available";
-    Device& device = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) return "No devices available";
+    Device& device = *current;
 
     String result = "Состояние сенсоров устройства:\n";
 
     for (size_t i = 0; i < device.sensors.size(); i++) {
       Sensor& sensor = device.sensors[i];
+      float currentValue = device.runtime.sensorValue(i);
       String msg = "Сенсор " + String(i) + ": ";
 
       if (sensor.typeSensor.get(2)) {
-        msg += "Температура = " + String(sensor.currentValue, 2) + " °C";
+        msg += "Температура = " + String(currentValue, 2) + " °C";
       }
       else if (sensor.typeSensor.get(3)) {
         Relay* inputRelay = findRelayById(device, sensor.relayId);
         if (inputRelay && !inputRelay->isOutput) {
-          msg += "Состояние = " + String(sensor.currentValue > 0.5 ? "НАЖАТО" : "ОТПУЩЕНО");
+          msg += "Состояние = " + String(currentValue > 0.5 ? "НАЖАТО" : "ОТПУЩЕНО");
         } else {
           msg += "Ошибка: сенсор привязан к реле или не найден";
         }
       }
       else if (sensor.typeSensor.get(0) || sensor.typeSensor.get(1)) {
-        msg += "Температура = " + String(sensor.currentValue, 2) + " °C, ";
-        msg += "Влажность = " + String(sensor.humidityValue, 1) + " %";
+        msg += "Температура = " + String(currentValue, 2) + " °C, ";
+        msg += "Влажность = " + String(device.runtime.humidityValue(i), 1) + " %";
       }
       else {
-        msg += "Значение = " + String(sensor.currentValue, 2);
+        msg += "Значение = " + String(currentValue, 2);
       }
 
       result += msg + "\n";
@@ -1201,23 +1272,23 @@ Sensor* Control::findSensorById(Device& device, int id) {
   }
 
  void Control::setSensorActions() {
-    if (myDevices.empty()) return;
-    Device& device = myDevices[currentDeviceIndex];
+    Device* current = deviceManager.currentDevice();
+    if (!current) return;
+    Device& device = *current;
 
     static bool lastIsActionEnabled = false;
     static bool firstCall = true;
 
 if (firstCall) {
+    device.runtime.actionTriggeredMask = 0;
     for (auto& action : device.actions) {
-        action.wasTriggered = false;
-
         if (action.collectionSettings.get(1)) {
             for (auto& output : action.outputs) {
                 if (output.isUseSetting) {
                     deviceManager.saveRelayStates(output.relayId);
                     #ifdef DEBUG_SENSOR_ACTIONS
                         logger.addLog("First run: Saved state for relay " + String(output.relayId) +
-                                     " in action: " + String(action.description));
+                                     " in action: " + String(action.description.c_str()));
                     #endif
                 }
             }
@@ -1231,8 +1302,8 @@ if (firstCall) {
 
     if (lastIsActionEnabled && !device.isActionEnabled) {
         logger.addLog("Actions disabled, resetting all triggers.");
+        device.runtime.actionTriggeredMask = 0;
         for (auto& action : device.actions) {
-            action.wasTriggered = false;
                 resetActionEffects(action, device);
         }
     }
@@ -1244,8 +1315,9 @@ if (firstCall) {
     }
 
     for (auto& action : device.actions) {
+        size_t actionIndex = device.indexOf(action);
         if (!action.isUseSetting) {
-            action.wasTriggered = false;
+            device.runtime.setActionTriggered(actionIndex, false);
             continue;
         }
 
@@ -1257,11 +1329,18 @@ if (firstCall) {
             }
         }
 
-        if (!targetSensor || targetSensor->currentValue <= -998.0f) {
+        if (!targetSensor) {
+            continue;
+        }
+
+        size_t sensorIndex = device.indexOf(*targetSensor);
+        if (device.runtime.sensorValue(sensorIndex) <= -998.0f) {
             continue;
         }
 
-        float currentValue = action.isHumidity ? targetSensor->humidityValue : targetSensor->currentValue;
+        float currentValue = action.isHumidity ? device.runtime.humidityValue(sensorIndex)
+                                               : device.runtime.sensorValue(sensorIndex);
+        bool wasTriggered = device.runtime.actionTriggered(actionIndex);
 
         bool shouldTrigger = false;
         bool shouldReset = false;
@@ -1274,8 +1353,8 @@ if (firstCall) {
             shouldReset = (currentValue > action.triggerValueMin);
         }
 
-        if (shouldTrigger && !action.wasTriggered) {
-            logger.addLog("Action TRIGGERED: " + String(action.description));
+        if (shouldTrigger && !wasTriggered) {
+            logger.addLog("Action TRIGGERED: " + String(action.description.c_str()));
 
             if (action.collectionSettings.get(0)) {
                 device.temperature.isUseSetting = true;
@@ -1294,14 +1373,14 @@ if (firstCall) {
             }
 
             if (action.collectionSettings.get(3) && action.sendMsg.length() > 0) {
-                logger.addLog(action.sendMsg, 2);
+                logger.addLog(action.sendMsg.c_str(), 2);
             }
 
-            action.wasTriggered = true;
+            device.runtime.setActionTriggered(actionIndex, true);
         }
 
-        else if (shouldReset && action.wasTriggered) {
-            logger.addLog("Action RESET: " + String(action.description));
+        else if (shouldReset && wasTriggered) {
+            logger.addLog("Action RESET: " + String(action.description.c_str()));
 
             if (action.isReturnSetting) {
 
@@ -1324,7 +1403,7 @@ if (firstCall) {
                 }
             }
 
-            action.wasTriggered = false;
+            device.runtime.setActionTriggered(actionIndex, false);
         }
     }
 }
@@ -1349,11 +1428,12 @@ void Control::resetActionEffects(Action& action, Device& device) {
 }
 
   String Control::sendHelp() {
-    if (myDevices.empty()) {
+    const Device* current = deviceManager.currentDevice();
+    if (!current) {
       return "Нет устройств для отображения справки\n";
     }
 
-    const Device& currentDevice = myDevices[currentDeviceIndex];
+    const Device& currentDevice = *current;
 
     String helpMessage = "Доступные команды для устройства: ";
     helpMessage += currentDevice.nameDevice;
@@ -1365,7 +1445,7 @@ void Control::resetActionEffects(Action& action, Device& device) {
         String commandOn = "/on" + String(relayIndex);
         String commandOff = "/off" + String(relayIndex);
 
-        helpMessage += commandOn + " " + commandOff + " - " + String(relay.description) + "\n";
+        helpMessage += commandOn + " " + commandOff + " - " + String(relay.description.c_str()) + "\n";
         relayIndex++;
       }
     }
@@ -1426,11 +1506,12 @@ void Control::resetActionEffects(Action& action, Device& device) {
     ssid = WiFi.SSID();
   #endif
 
-    if (myDevices.empty()) {
+    const Device* current = deviceManager.currentDevice();
+    if (!current) {
       return "Нет устройств для отображения статуса\n";
     }
 
-    const Device& currentDevice = myDevices[currentDeviceIndex];
+    const Device& currentDevice = *current;
 
     String helpText;
 
@@ -1447,9 +1528,9 @@ void Control::resetActionEffects(Action& action, Device& device) {
         String commandOn = "/on" + String(relayIndex);
         String commandOff = "/off" + String(relayIndex);
         String mode_ = relay.manualMode ? "Ручной" : "Авто";
-        String state_ = relay.statePin ? "Вкл" : "Выкл";
+        String state_ = currentDevice.runtime.output(currentDevice.indexOf(relay)) ? "Вкл" : "Выкл";
 
-        helpText += commandOn + " " + commandOff + " - " + String(relay.description) +
+        helpText += commandOn + " " + commandOff + " - " + String(relay.description.c_str()) +
                     " (Режим: " + mode_ + ", " + state_ + ")\n";
         relayIndex++;
       }
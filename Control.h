@@ -25,7 +25,7 @@ private:
     Logger& logger;
      DeviceManager& deviceManager;
 
-    std::vector<Device>& myDevices;
+    PsramVector<Device>& myDevices;
     uint8_t& currentDeviceIndex;
 
     std::unordered_map<uint8_t, TouchSensorState> touchStates;
@@ -73,6 +73,7 @@ enum DhtReadState {
     float readNTCTemperature(const Sensor& sensor);
     int readAnalog(const Sensor& sensor);
     void resetActionEffects(Action& action, Device& device);
+    void adoptShadowDevice();
 
  struct {
     bool isActive = false;
@@ -1,11 +1,16 @@
 #include "DeviceManager.h"
+#include "DeviceSchema.h"
   #include <cstring>
+  #include <algorithm>
+
+  DeviceManager::DeviceManager(Persistence& persistence) : persistence(persistence) {}
 
   void DeviceManager::initializeDevice(const char* name, bool activ, bool isNewDevice) {
     if (!isNewDevice) {
       if (!myDevices.empty()) {
         myDevices.clear();
       }
+      deviceSlots.clear();
     }
 
     myDevices.emplace_back();
@@ -48,14 +53,14 @@
       relay.id = nextId++;
       relay.pin = output_pins[i];
       relay.manualMode = output_manual_mode[i];
-      relay.statePin = output_state_pin[i];
       relay.isOutput = true;
       relay.isDigital = true;
-      relay.lastState = false;
       relay.isPwm = false;
-      relay.pwm = 0;
-      snprintf(relay.description, MAX_DESCRIPTION_LENGTH, "Выход_%d", i + 1);
+      char description[MAX_DESCRIPTION_LENGTH];
+      snprintf(description, sizeof(description), "Выход_%d", i + 1);
+      relay.description = description;
       newDevice.relays.push_back(relay);
+      newDevice.runtime.setOutput(newDevice.indexOf(newDevice.relays.back()), output_state_pin[i]);
     }
 
     Relay dhtInput;
@@ -64,9 +69,8 @@
     dhtInput.manualMode = false;
     dhtInput.isOutput = false;
     dhtInput.isDigital = true;
-    dhtInput.statePin = false;
-    dhtInput.lastState = false;
-    strncpy_safe(dhtInput.description, "DHT-11 Датчик", MAX_DESCRIPTION_LENGTH);
+    dhtInput.isPwm = false;
+    dhtInput.description = "DHT-11 Датчик";
     newDevice.relays.push_back(dhtInput);
 
     Relay currentInput;
@@ -75,9 +79,8 @@
     currentInput.manualMode = false;
     currentInput.isOutput = false;
     currentInput.isDigital = false;
-    currentInput.statePin = false;
-    currentInput.lastState = false;
-    strncpy_safe(currentInput.description, "Вход датчик тока", MAX_DESCRIPTION_LENGTH);
+    currentInput.isPwm = false;
+    currentInput.description = "Вход датчик тока";
     newDevice.relays.push_back(currentInput);
 
   #else
@@ -93,14 +96,14 @@
       relay.id = nextId++;
       relay.pin = output_pins[i];
       relay.manualMode = output_manual_mode[i];
-      relay.statePin = output_state_pin[i];
       relay.isOutput = true;
       relay.isDigital = true;
-      relay.lastState = false;
       relay.isPwm = false;
-      relay.pwm = 0;
-      snprintf(relay.description, MAX_DESCRIPTION_LENGTH, "Выход_%d", i + 1);
+      char description[MAX_DESCRIPTION_LENGTH];
+      snprintf(description, sizeof(description), "Выход_%d", i + 1);
+      relay.description = description;
       newDevice.relays.push_back(relay);
+      newDevice.runtime.setOutput(newDevice.indexOf(newDevice.relays.back()), output_state_pin[i]);
     }
 
     Relay dhtInput;
@@ -109,9 +112,8 @@
     dhtInput.manualMode = false;
     dhtInput.isOutput = false;
     dhtInput.isDigital = true;
-    dhtInput.statePin = false;
-    dhtInput.lastState = false;
-    strncpy_safe(dhtInput.description, "DHT-11 Датчик", MAX_DESCRIPTION_LENGTH);
+    dhtInput.isPwm = false;
+    dhtInput.description = "DHT-11 Датчик";
     newDevice.relays.push_back(dhtInput);
 
     Relay currentInput;
@@ -120,14 +122,13 @@
     currentInput.manualMode = false;
     currentInput.isOutput = false;
     currentInput.isDigital = false;
-    currentInput.statePin = false;
-    currentInput.lastState = false;
-    strncpy_safe(currentInput.description, "Вход датчик тока", MAX_DESCRIPTION_LENGTH);
+    currentInput.isPwm = false;
+    currentInput.description = "Вход датчик тока";
     newDevice.relays.push_back(currentInput);
   #endif
 
     Sensor dhtSensor;
-    strncpy_safe(dhtSensor.description, "Сенсор DHT11", MAX_DESCRIPTION_LENGTH);
+    dhtSensor.description = "Сенсор DHT11";
     dhtSensor.isUseSetting = true;
     dhtSensor.sensorId = nextId++;
     dhtSensor.relayId = 4;
@@ -135,13 +136,11 @@
     dhtSensor.typeSensor.set(0, true);
     dhtSensor.serial_r = 20000;
     dhtSensor.thermistor_r = 10000;
-    dhtSensor.currentValue = 0.0;
-    dhtSensor.humidityValue = 0.0;
     dhtSensor.dht = nullptr;
     newDevice.sensors.push_back(dhtSensor);
 
     Sensor currentSensor;
-    strncpy_safe(currentSensor.description, "Датчик тока", MAX_DESCRIPTION_LENGTH);
+    currentSensor.description = "Датчик тока";
     currentSensor.isUseSetting = true;
     currentSensor.sensorId = nextId++;
     currentSensor.relayId = 5;
@@ -149,12 +148,10 @@
     currentSensor.typeSensor.set(4, true);
     currentSensor.serial_r = 20000;
     currentSensor.thermistor_r = 10000;
-    currentSensor.currentValue = 0.0;
-    currentSensor.humidityValue = 0.0;
     newDevice.sensors.push_back(currentSensor);
 
     Action touchAction;
-    strncpy_safe(touchAction.description, "Действие - превышение тока", MAX_DESCRIPTION_LENGTH);
+    touchAction.description = "Действие - превышение тока";
     touchAction.isUseSetting = true;
     touchAction.targetSensorId = currentSensor.sensorId;
     touchAction.triggerValueMax = 1;
@@ -162,7 +159,6 @@
     touchAction.isHumidity = false;
     touchAction.actionMoreOrEqual = true;
     touchAction.isReturnSetting = true;
-    touchAction.wasTriggered = false;
     touchAction.collectionSettings.clear();
     touchAction.collectionSettings.set(1, true);
 
@@ -172,12 +168,12 @@
     defaultTouchOutput.statePin = false;
     defaultTouchOutput.lastState = false;
     defaultTouchOutput.isReturn = true;
-    strncpy_safe(defaultTouchOutput.description, "Touch Action Output", MAX_DESCRIPTION_LENGTH);
+    defaultTouchOutput.description = "Touch Action Output";
     touchAction.outputs.push_back(defaultTouchOutput);
     newDevice.actions.push_back(touchAction);
 
     ScheduleScenario scenario;
-    strncpy_safe(scenario.description, "Мой первый сценарий 1", MAX_DESCRIPTION_LENGTH);
+    scenario.description = "Мой первый сценарий 1";
     scenario.isUseSetting = false;
     scenario.isActive = false;
     scenario.collectionSettings.clear();
@@ -196,19 +192,14 @@
     scenario.initialStateRelay.relayId = newDevice.relays[0].id;
     scenario.initialStateRelay.statePin = true;
     scenario.initialStateRelay.lastState = false;
-    strncpy_safe(scenario.initialStateRelay.description, "Initial State", MAX_DESCRIPTION_LENGTH);
+    scenario.initialStateRelay.description = "Initial State";
 
     scenario.endStateRelay.isUseSetting = false;
     scenario.endStateRelay.relayId = newDevice.relays[0].id;
     scenario.endStateRelay.statePin = false;
     scenario.endStateRelay.lastState = false;
-    strncpy_safe(scenario.endStateRelay.description, "End State", MAX_DESCRIPTION_LENGTH);
+    scenario.endStateRelay.description = "End State";
 
-    scenario.temperatureUpdated = false;
-    scenario.timersExecuted = false;
-    scenario.initialStateApplied = false;
-    scenario.endStateApplied = false;
-    scenario.scenarioProcessed = false;
     newDevice.scheduleScenarios.push_back(scenario);
 
     newDevice.temperature.isUseSetting = false;
@@ -225,16 +216,16 @@
 
     Pid pid1, pid2, pid3;
 
-    strncpy_safe(pid1.description, "Стандартный", MAX_DESCRIPTION_LENGTH);
-    strncpy_safe(pid1.descriptionDetailed, "Сбалансированный набор. Хорошее соотношение скорости реакции и стабильности. Подходит для большинства систем.", MAX_TXT_DESCRIPTION_LENGTH);
+    pid1.description = "Стандартный";
+    pid1.descriptionDetailed = "Сбалансированный набор. Хорошее соотношение скорости реакции и стабильности. Подходит для большинства систем.";
     pid1.Kp = 2.0; pid1.Ki = 0.5; pid1.Kd = 1.0;
 
-    strncpy_safe(pid2.description, "Быстрый", MAX_DESCRIPTION_LENGTH);
-    strncpy_safe(pid2.descriptionDetailed, "Быстрый набор с высоким Kp. Реагирует резко на изменения температуры. Может вызывать перерегулирование (overshoot). Идеален для малых инерционных систем.", MAX_TXT_DESCRIPTION_LENGTH);
+    pid2.description = "Быстрый";
+    pid2.descriptionDetailed = "Быстрый набор с высоким Kp. Реагирует резко на изменения температуры. Может вызывать перерегулирование (overshoot). Идеален для малых инерционных систем.";
     pid2.Kp = 1.5; pid2.Ki = 0.4; pid2.Kd = 0.9;
 
-    strncpy_safe(pid3.description, "Плавный", MAX_DESCRIPTION_LENGTH);
-    strncpy_safe(pid3.descriptionDetailed, "Плавный набор с низким Kp. Медленно и плавно достигает заданной температуры, минимизируя перерегулирование. Подходит для больших инерционных систем (например, отопление дома).", MAX_TXT_DESCRIPTION_LENGTH);
+    pid3.description = "Плавный";
+    pid3.descriptionDetailed = "Плавный набор с низким Kp. Медленно и плавно достигает заданной температуры, минимизируя перерегулирование. Подходит для больших инерционных систем (например, отопление дома).";
     pid3.Kp = 1.0; pid3.Ki = 0.3; pid3.Kd = 0.8;
 
     newDevice.pids.push_back(pid1);
@@ -251,567 +242,673 @@
     timer.initialStateRelay.relayId = newDevice.relays[0].id;
     timer.initialStateRelay.statePin = true;
     timer.initialStateRelay.lastState = false;
-    strncpy_safe(timer.initialStateRelay.description, "Initial Timer Power", MAX_DESCRIPTION_LENGTH);
+    timer.initialStateRelay.description = "Initial Timer Power";
 
     timer.endStateRelay.isUseSetting = true;
     timer.endStateRelay.relayId = newDevice.relays[0].id;
     timer.endStateRelay.statePin = false;
     timer.endStateRelay.lastState = false;
-    strncpy_safe(timer.endStateRelay.description, "End Timer Power", MAX_DESCRIPTION_LENGTH);
+    timer.endStateRelay.description = "End Timer Power";
 
     newDevice.timers.push_back(timer);
+    newDevice.syncRuntime();
 
     Serial.printf("Free heap after device initialization: %d\n", ESP.getFreeHeap());
   }
 
-  String DeviceManager::serializeDevice(const Device& device) {
+  String DeviceManager::serializeDevice(const Device& device, bool withRuntime) {
 
-    DynamicJsonDocument doc(8192);
+    PsramJsonDocument doc(8192);
+    serializeDeviceSections(device, withRuntime ? (DEVICE_SECTION_ALL | DEVICE_SECTION_RUNTIME) : DEVICE_SECTION_ALL,
+                            doc.to<JsonObject>());
 
-    doc["nameDevice"] = device.nameDevice;
-    doc["isSelected"] = device.isSelected;
+    String output;
+    serializeJson(doc, output);
+    return output;
+  }
 
-    JsonArray relays = doc.createNestedArray("relays");
-    for (const auto& relay : device.relays) {
-      JsonObject relayObj = relays.createNestedObject();
-      relayObj["id"] = relay.id;
-      relayObj["pin"] = relay.pin;
-      relayObj["isPwm"] = relay.isPwm;
-      relayObj["manualMode"] = relay.manualMode;
-      relayObj["statePin"] = relay.statePin;
-      relayObj["isOutput"] = relay.isOutput;
-      relayObj["isDigital"] = relay.isDigital;
-      relayObj["lastState"] = relay.lastState;
-      relayObj["description"] = relay.description;
-    }
+  void DeviceManager::serializeDeviceSections(const Device& device, uint16_t sections, JsonObject doc) {
 
-    JsonArray pins = doc.createNestedArray("pins");
-    for (const auto& pin : device.pins) {
-      pins.add(pin);
+    if (sections & DEVICE_SECTION_META) {
+      DeviceSchema::toJson(DEVICE_META_SCHEMA, &device, doc);
     }
 
-    JsonArray sensors = doc.createNestedArray("sensors");
-    for (const auto& sensor : device.sensors) {
-      JsonObject sensorObj = sensors.createNestedObject();
+    if (sections & DEVICE_SECTION_RELAYS) {
+      JsonArray relays = doc.createNestedArray("relays");
+      for (const auto& relay : device.relays) {
+        JsonObject relayObj = relays.createNestedObject();
+        DeviceSchema::toJson(relay, relayObj);
+        relayObj["statePin"] = device.runtime.output(device.indexOf(relay));
+        if (sections & DEVICE_SECTION_RUNTIME) {
+          relayObj["lastState"] = device.runtime.savedOutput(device.indexOf(relay));
+        }
+      }
+    }
 
-      sensorObj["description"] = sensor.description;
-      sensorObj["isUseSetting"] = sensor.isUseSetting;
-      sensorObj["sensorId"] = sensor.sensorId;
-      sensorObj["relayId"] = sensor.relayId;
+    if (sections & DEVICE_SECTION_PINS) {
+      JsonArray pins = doc.createNestedArray("pins");
+      for (const auto& pin : device.pins) {
+        pins.add(pin);
+      }
+    }
 
-      JsonArray typeSensor = sensorObj.createNestedArray("typeSensor");
-      for (int i = 0; i < 7; i++) {
-        typeSensor.add(sensor.typeSensor.get(i));
+    if (sections & DEVICE_SECTION_SENSORS) {
+      JsonArray sensors = doc.createNestedArray("sensors");
+      for (const auto& sensor : device.sensors) {
+        JsonObject sensorObj = sensors.createNestedObject();
+        DeviceSchema::toJson(sensor, sensorObj);
+        if (sections & DEVICE_SECTION_RUNTIME) {
+          sensorObj["currentValue"] = device.runtime.sensorValue(device.indexOf(sensor));
+          sensorObj["humidityValue"] = device.runtime.humidityValue(device.indexOf(sensor));
+        }
       }
+    }
 
-      sensorObj["serial_r"] = sensor.serial_r;
-      sensorObj["thermistor_r"] = sensor.thermistor_r;
-      sensorObj["currentValue"] = sensor.currentValue;
-      sensorObj["humidityValue"] = sensor.humidityValue;
+    if (sections & DEVICE_SECTION_ACTIONS) {
+      JsonArray actions = doc.createNestedArray("actions");
+      for (const auto& action : device.actions) {
+        JsonObject actionObj = actions.createNestedObject();
+        DeviceSchema::toJson(action, actionObj);
+        if (sections & DEVICE_SECTION_RUNTIME) {
+          actionObj["wasTriggered"] = device.runtime.actionTriggered(device.indexOf(action));
+        }
+
+        JsonArray outputs = actionObj.createNestedArray("outputs");
+        for (const auto& output : action.outputs) {
+          DeviceSchema::toJson(output, outputs.createNestedObject());
+        }
+      }
     }
 
-    JsonArray actions = doc.createNestedArray("actions");
-    for (const auto& action : device.actions) {
-      JsonObject actionObj = actions.createNestedObject();
+    if (sections & DEVICE_SECTION_SCHEDULES) {
+      JsonArray scheduleScenarios = doc.createNestedArray("scheduleScenarios");
+      for (const auto& scenario : device.scheduleScenarios) {
+        JsonObject scenarioObj = scheduleScenarios.createNestedObject();
+        DeviceSchema::toJson(scenario, scenarioObj);
 
-      actionObj["description"] = action.description;
-      actionObj["isUseSetting"] = action.isUseSetting;
-      actionObj["targetSensorId"] = action.targetSensorId;
-      actionObj["triggerValueMax"] = action.triggerValueMax;
-      actionObj["triggerValueMin"] = action.triggerValueMin;
-      actionObj["isHumidity"] = action.isHumidity;
-      actionObj["actionMoreOrEqual"] = action.actionMoreOrEqual;
-      actionObj["isReturnSetting"] = action.isReturnSetting;
-      actionObj["wasTriggered"] = action.wasTriggered;
-      actionObj["sendMsg"] = action.sendMsg;
+        JsonArray startEndTimes = scenarioObj.createNestedArray("startEndTimes");
+        for (const auto& timeInterval : scenario.startEndTimes) {
+          DeviceSchema::toJson(timeInterval, startEndTimes.createNestedObject());
+        }
+      }
+    }
 
-      JsonArray collectionSettings = actionObj.createNestedArray("collectionSettings");
-      for (int i = 0; i < 4; i++) {
-        collectionSettings.add(action.collectionSettings.get(i));
+    if (sections & DEVICE_SECTION_TEMPERATURE) {
+      DeviceSchema::toJson(device.temperature, doc.createNestedObject("temperature"));
+    }
+
+    if (sections & DEVICE_SECTION_PIDS) {
+      JsonArray pidsArray = doc.createNestedArray("pids");
+      for (const auto& pid : device.pids) {
+        DeviceSchema::toJson(pid, pidsArray.createNestedObject());
       }
+    }
 
-      JsonArray outputs = actionObj.createNestedArray("outputs");
-      for (const auto& output : action.outputs) {
-        JsonObject outputObj = outputs.createNestedObject();
-        outputObj["isUseSetting"] = output.isUseSetting;
-        outputObj["relayId"] = output.relayId;
-        outputObj["statePin"] = output.statePin;
-        outputObj["lastState"] = output.lastState;
-        outputObj["isReturn"] = output.isReturn;
-        outputObj["description"] = output.description;
+    if (sections & DEVICE_SECTION_TIMERS) {
+      JsonArray timers = doc.createNestedArray("timers");
+      for (const auto& timer : device.timers) {
+        DeviceSchema::toJson(timer, timers.createNestedObject());
       }
     }
 
-    JsonArray scheduleScenarios = doc.createNestedArray("scheduleScenarios");
-    for (const auto& scenario : device.scheduleScenarios) {
-      JsonObject scenarioObj = scheduleScenarios.createNestedObject();
-      scenarioObj["isUseSetting"] = scenario.isUseSetting;
-      scenarioObj["description"] = scenario.description;
-      scenarioObj["isActive"] = scenario.isActive;
+    if (sections & DEVICE_SECTION_FLAGS) {
+      DeviceSchema::toJson(DEVICE_FLAGS_SCHEMA, &device, doc);
+    }
+  }
 
-      JsonArray collectionSettings = scenarioObj.createNestedArray("collectionSettings");
-      for (int i = 0; i < 4; i++) {
-        collectionSettings.add(scenario.collectionSettings.get(i));
-      }
+  // Runtime masks hold MAX_RUNTIME_ITEMS bits; past that, state would be
+  // dropped silently, so such a device is refused wherever it comes from.
+  static bool withinRuntimeLimits(const Device& device) {
+    return device.relays.size() <= MAX_RUNTIME_ITEMS && device.sensors.size() <= MAX_RUNTIME_ITEMS &&
+           device.timers.size() <= MAX_RUNTIME_ITEMS && device.actions.size() <= MAX_RUNTIME_ITEMS &&
+           device.scheduleScenarios.size() <= MAX_RUNTIME_ITEMS;
+  }
 
-      scenarioObj["startDate"] = scenario.startDate;
-      scenarioObj["endDate"] = scenario.endDate;
+  bool DeviceManager::deserializeDevice(JsonObject doc, Device& device) {
 
-      JsonArray startEndTimes = scenarioObj.createNestedArray("startEndTimes");
-      for (const auto& timeInterval : scenario.startEndTimes) {
-        JsonObject intervalObj = startEndTimes.createNestedObject();
-        intervalObj["startTime"] = timeInterval.startTime;
-        intervalObj["endTime"] = timeInterval.endTime;
-      }
+    for (JsonPairConst kv : JsonObjectConst(doc)) {
+      applyDeviceKey(device, kv.key().c_str(), kv.value());
+    }
 
-      JsonArray week = scenarioObj.createNestedArray("week");
-      for (int i = 0; i < 7; i++) {
-        week.add(scenario.week.get(i));
-      }
+    if (!withinRuntimeLimits(device)) {
+      Serial.printf("[DeviceManager] %s: более %d элементов в секции\n", device.nameDevice, MAX_RUNTIME_ITEMS);
+      return false;
+    }
 
-      JsonArray months = scenarioObj.createNestedArray("months");
-      for (int i = 0; i < 12; i++) {
-        months.add(scenario.months.get(i));
+    device.syncRuntime();
+    device.runtime.bumpAll();
+    return true;
+  }
+
+  // A change is built on a copy of the staged device if one is already waiting
+  // for Control, otherwise on a copy of the live one. Either way the staged
+  // device only changes once the copy has validated, so a rejected change
+  // leaves nothing behind.
+  Device* DeviceManager::beginStage(uint8_t deviceIndex, PsramVector<Device>& candidate, const char*& error) {
+    if (!shadowDevice.empty()) {
+      if (shadowDeviceIndex != deviceIndex) {
+        error = "pending_operation";
+        return nullptr;
       }
+      candidate.push_back(shadowDevice.front());
+      return &candidate.front();
+    }
 
-      JsonObject initialStateRelay = scenarioObj.createNestedObject("initialStateRelay");
-      initialStateRelay["isUseSetting"] = scenario.initialStateRelay.isUseSetting;
-      initialStateRelay["relayId"] = scenario.initialStateRelay.relayId;
-      initialStateRelay["statePin"] = scenario.initialStateRelay.statePin;
-      initialStateRelay["lastState"] = scenario.initialStateRelay.lastState;
-      initialStateRelay["description"] = scenario.initialStateRelay.description;
+    Device* live = acquireDevice(deviceIndex);
+    if (!live) {
+      error = "bad_device";
+      return nullptr;
+    }
+
+    candidate.push_back(*live);
+    Device& next = candidate.front();
 
-      JsonObject endStateRelay = scenarioObj.createNestedObject("endStateRelay");
-      endStateRelay["isUseSetting"] = scenario.endStateRelay.isUseSetting;
-      endStateRelay["relayId"] = scenario.endStateRelay.relayId;
-      endStateRelay["statePin"] = scenario.endStateRelay.statePin;
-      endStateRelay["lastState"] = scenario.endStateRelay.lastState;
-      endStateRelay["description"] = scenario.endStateRelay.description;
+    // DHT objects and the temperature bindings belong to the live device until
+    // the swap; Control moves or rebinds them in commitShadowDevice's caller.
+    for (Sensor& sensor : next.sensors) {
+      sensor.dht = nullptr;
     }
+    next.temperature.sensorPtr = nullptr;
+    next.temperature.relayPtr = nullptr;
+    return &next;
+  }
 
-    JsonObject temperature = doc.createNestedObject("temperature");
-    temperature["isUseSetting"] = device.temperature.isUseSetting;
-    temperature["relayId"] = device.temperature.relayId;
-    temperature["lastState"] = device.temperature.lastState;
-    temperature["sensorId"] = device.temperature.sensorId;
-    temperature["setTemperature"] = device.temperature.setTemperature;
-    temperature["currentTemp"] = device.temperature.currentTemp;
-    temperature["isSmoothly"] = device.temperature.isSmoothly;
-    temperature["isIncrease"] = device.temperature.isIncrease;
+  bool DeviceManager::finishStage(uint8_t deviceIndex, PsramVector<Device>& candidate, uint16_t sections, const char*& error) {
+    Device& next = candidate.front();
+    next.syncRuntime();
 
-    JsonArray tempCollectionSettings = temperature.createNestedArray("collectionSettings");
-    for (int i = 0; i < 4; i++) {
-      tempCollectionSettings.add(device.temperature.collectionSettings.get(i));
+    error = validateDevice(next);
+    if (error) {
+      Serial.printf("[DeviceManager] Настройки устройства %u отклонены: %s\n", deviceIndex, error);
+      return false;
+    }
+
+    if (shadowDevice.empty()) {
+      shadowDevice.swap(candidate);
+      shadowSections = DEVICE_SECTION_NONE;
+    } else {
+      std::swap(shadowDevice.front(), next);
+    }
+    shadowDeviceIndex = deviceIndex;
+    shadowSections |= sections;
+    return true;
+  }
+
+  bool DeviceManager::stageDevice(uint8_t deviceIndex, JsonObjectConst settings, const char*& error) {
+    PsramVector<Device> candidate;
+    Device* next = beginStage(deviceIndex, candidate, error);
+    if (!next) {
+      return false;
     }
 
-    temperature["selectedPidIndex"] = device.temperature.selectedPidIndex;
+    for (JsonPairConst kv : settings) {
+      applyDeviceKey(*next, kv.key().c_str(), kv.value());
+    }
+    return finishStage(deviceIndex, candidate, sectionsFromJson(settings), error);
+  }
 
-    JsonArray pidsArray = doc.createNestedArray("pids");
-    for (const auto& pid : device.pids) {
-      JsonObject pidObject = pidsArray.createNestedObject();
-      pidObject["description"] = pid.description;
-      pidObject["descriptionDetailed"] = pid.descriptionDetailed;
-      pidObject["Kp"] = pid.Kp;
-      pidObject["Ki"] = pid.Ki;
-      pidObject["Kd"] = pid.Kd;
+  // Runtime state keeps flowing into the live device while the shadow waits,
+  // so whatever the save did not replace is taken from the live copy.
+  static void carryRuntime(const Device& live, Device& next, uint16_t sections) {
+    const DeviceRuntime& from = live.runtime;
+    DeviceRuntime& to = next.runtime;
+
+    memcpy(to.versions, from.versions, sizeof(to.versions));
+    memcpy(to.snapshotVersions, from.snapshotVersions, sizeof(to.snapshotVersions));
+    to.publishedFlags = from.publishedFlags;
+
+    // Item stamps made after staging must survive, or a change that landed in
+    // between looks already seen to a client. Where the item count changed the
+    // stamps no longer line up and the topic gets a fresh snapshot instead.
+    const size_t liveCounts[] = {live.relays.size(), live.sensors.size(), live.timers.size()};
+    const size_t nextCounts[] = {next.relays.size(), next.sensors.size(), next.timers.size()};
+    const RuntimeTopic itemTopics[] = {RUNTIME_RELAYS, RUNTIME_SENSORS, RUNTIME_TIMERS};
+    for (uint8_t i = 0; i < 3; i++) {
+      RuntimeTopic topic = itemTopics[i];
+      if (liveCounts[i] == nextCounts[i] && from.itemVersions[topic].size() == liveCounts[i]) {
+        to.itemVersions[topic] = from.itemVersions[topic];
+      } else {
+        to.invalidate(topic);
+      }
     }
 
-    JsonArray timers = doc.createNestedArray("timers");
-    for (const auto& timer : device.timers) {
-      JsonObject timerObj = timers.createNestedObject();
-      timerObj["isUseSetting"] = timer.isUseSetting;
-      timerObj["time"] = timer.time;
+    if (!(sections & DEVICE_SECTION_RELAYS) && live.relays.size() == next.relays.size()) {
+      to.outputMask = from.outputMask;
+      to.savedOutputMask = from.savedOutputMask;
+      to.pwm = from.pwm;
+    }
 
-      JsonArray collectionSettings = timerObj.createNestedArray("collectionSettings");
-      for (int i = 0; i < 4; i++) {
-        collectionSettings.add(timer.collectionSettings.get(i));
+    for (size_t i = 0; i < next.relays.size(); i++) {
+      for (size_t j = 0; j < live.relays.size() && j < from.switchCounts.size(); j++) {
+        if (live.relays[j].id == next.relays[i].id) {
+          to.switchCounts[i] = from.switchCounts[j];
+          break;
+        }
       }
+    }
 
-      JsonObject initialStateRelay = timerObj.createNestedObject("initialStateRelay");
-      initialStateRelay["isUseSetting"] = timer.initialStateRelay.isUseSetting;
-      initialStateRelay["relayId"] = timer.initialStateRelay.relayId;
-      initialStateRelay["statePin"] = timer.initialStateRelay.statePin;
-      initialStateRelay["lastState"] = timer.initialStateRelay.lastState;
-      initialStateRelay["description"] = timer.initialStateRelay.description;
+    for (size_t i = 0; i < next.sensors.size(); i++) {
+      for (size_t j = 0; j < live.sensors.size() && j < from.sensorReadAt.size(); j++) {
+        if (live.sensors[j].sensorId == next.sensors[i].sensorId) {
+          to.sensorValues[i] = from.sensorValue(j);
+          to.humidityValues[i] = from.humidityValue(j);
+          to.sensorReadAt[i] = from.sensorReadAt[j];
+          break;
+        }
+      }
+    }
 
-      JsonObject endStateRelay = timerObj.createNestedObject("endStateRelay");
-      endStateRelay["isUseSetting"] = timer.endStateRelay.isUseSetting;
-      endStateRelay["relayId"] = timer.endStateRelay.relayId;
-      endStateRelay["statePin"] = timer.endStateRelay.statePin;
-      endStateRelay["lastState"] = timer.endStateRelay.lastState;
-      endStateRelay["description"] = timer.endStateRelay.description;
+    if (live.timers.size() == next.timers.size()) {
+      to.timerElapsed = from.timerElapsed;
+      to.timerRemaining = from.timerRemaining;
+      to.timerRunningMask = from.timerRunningMask;
+      to.timerStoppedMask = from.timerStoppedMask;
     }
 
-    doc["isTimersEnabled"] = device.isTimersEnabled;
-    doc["isEncyclateTimers"] = device.isEncyclateTimers;
-    doc["isScheduleEnabled"] = device.isScheduleEnabled;
-    doc["isActionEnabled"] = device.isActionEnabled;
+    if (!(sections & DEVICE_SECTION_ACTIONS)) {
+      to.actionTriggeredMask = from.actionTriggeredMask;
+    }
+    if (!(sections & DEVICE_SECTION_SCHEDULES)) {
+      memcpy(to.scenarioFlags, from.scenarioFlags, sizeof(to.scenarioFlags));
+    }
 
-    String output;
-    serializeJson(doc, output);
-    return output;
+    next.dirtySections |= live.dirtySections;
+    next.dirtyRelays |= live.dirtyRelays;
   }
 
-  bool DeviceManager::deserializeDevice(JsonObject doc, Device& device) {
+  uint16_t DeviceManager::commitShadowDevice() {
+    if (shadowDevice.empty()) {
+      return DEVICE_SECTION_NONE;
+    }
+
+    uint16_t sections = shadowSections;
+    Device* live = acquireDevice(shadowDeviceIndex);
+    if (live) {
+      Device& next = shadowDevice.front();
+      carryRuntime(*live, next, sections);
+      std::swap(*live, next);
+      live->syncRuntime();
+
+      // Only the topics a section feeds get a new snapshot; resize() in
+      // syncRuntime() already covers item counts that changed.
+      DeviceRuntime& runtime = live->runtime;
+      if (sections & (DEVICE_SECTION_RELAYS | DEVICE_SECTION_PINS)) runtime.invalidate(RUNTIME_RELAYS);
+      if (sections & DEVICE_SECTION_SENSORS) runtime.invalidate(RUNTIME_SENSORS);
+      if (sections & DEVICE_SECTION_TIMERS) runtime.invalidate(RUNTIME_TIMERS);
+      if (sections & (DEVICE_SECTION_META | DEVICE_SECTION_FLAGS | DEVICE_SECTION_TEMPERATURE)) {
+        runtime.invalidate(RUNTIME_FLAGS);
+      }
+      markDirty(shadowDeviceIndex, sections);
+    } else {
+      Serial.printf("[DeviceManager] Устройство %u недоступно, настройки отброшены\n", shadowDeviceIndex);
+      sections = DEVICE_SECTION_NONE;
+    }
 
-    if (doc.containsKey("nameDevice")) {
-      strncpy_safe(device.nameDevice, doc["nameDevice"], MAX_DESCRIPTION_LENGTH);
+    shadowDevice.clear();
+    shadowSections = DEVICE_SECTION_NONE;
+    compactStrings();
+    return sections;
+  }
+
+  const char* DeviceManager::validateDevice(const Device& device) const {
+    if (!withinRuntimeLimits(device)) {
+      return "too_many_items";
     }
 
-    if (doc.containsKey("isSelected")) {
-      device.isSelected = doc["isSelected"].as<bool>();
+    auto hasRelay = [&](int relayId) {
+      for (const Relay& relay : device.relays) {
+        if (relay.id == relayId) return true;
+      }
+      return false;
+    };
+    auto hasSensor = [&](int sensorId) {
+      for (const Sensor& sensor : device.sensors) {
+        if (sensor.sensorId == sensorId) return true;
+      }
+      return false;
+    };
+    auto checkOutput = [&](const OutPower& output) {
+      return !output.isUseSetting || hasRelay(output.relayId);
+    };
+
+    for (size_t i = 0; i < device.relays.size(); i++) {
+      const Relay& relay = device.relays[i];
+      if (DeviceSchema::validate(relay)) return "invalid_relay";
+      for (size_t j = 0; j < i; j++) {
+        if (device.relays[j].id == relay.id) return "duplicate_relay_id";
+        if (device.relays[j].pin == relay.pin) return "duplicate_relay_pin";
+      }
     }
 
-    if (doc.containsKey("relays")) {
-      device.relays.clear();
-      JsonArray relays = doc["relays"];
-      for (JsonObject relayObj : relays) {
-        Relay relay;
-        if (relayObj.containsKey("id")) relay.id = relayObj["id"];
-        if (relayObj.containsKey("pin")) relay.pin = relayObj["pin"];
-        if (relayObj.containsKey("manualMode")) relay.manualMode = relayObj["manualMode"].as<bool>();
-        if (relayObj.containsKey("statePin")) relay.statePin = relayObj["statePin"].as<bool>();
-        if (relayObj.containsKey("lastState")) relay.lastState = relayObj["lastState"].as<bool>();
-        if (relayObj.containsKey("isOutput")) relay.isOutput = relayObj["isOutput"].as<bool>();
-        if (relayObj.containsKey("isPwm")) relay.isPwm = relayObj["isPwm"].as<bool>();
-        if (relayObj.containsKey("isDigital")) relay.isDigital = relayObj["isDigital"].as<bool>();
-        if (relayObj.containsKey("description")) {
-          strncpy_safe(relay.description, relayObj["description"], MAX_DESCRIPTION_LENGTH);
-        }
-        device.relays.push_back(relay);
+    for (size_t i = 0; i < device.sensors.size(); i++) {
+      const Sensor& sensor = device.sensors[i];
+      if (DeviceSchema::validate(sensor)) return "invalid_sensor";
+      for (size_t j = 0; j < i; j++) {
+        if (device.sensors[j].sensorId == sensor.sensorId) return "duplicate_sensor_id";
       }
+      if (sensor.isUseSetting && !hasRelay(sensor.relayId)) return "sensor_relay_missing";
     }
 
-    if (doc.containsKey("pins")) {
-      device.pins.clear();
-      JsonArray pins = doc["pins"];
-      for (JsonVariant pin : pins) {
-        device.pins.push_back(pin.as<uint8_t>());
+    const Temperature& temperature = device.temperature;
+    if (DeviceSchema::validate(temperature)) return "invalid_temperature";
+    if (temperature.isUseSetting && (!hasSensor(temperature.sensorId) || !hasRelay(temperature.relayId))) {
+      return "temperature_binding_missing";
+    }
+
+    for (const Action& action : device.actions) {
+      if (DeviceSchema::validate(action)) return "invalid_action";
+      if (!action.isUseSetting) continue;
+      if (!hasSensor(action.targetSensorId)) return "action_sensor_missing";
+      for (const OutPower& output : action.outputs) {
+        if (!checkOutput(output)) return "action_relay_missing";
       }
     }
 
-    if (doc.containsKey("sensors")) {
-      JsonArray sensorsJson = doc["sensors"];
-      std::vector<Sensor> newSensors;
+    for (const ScheduleScenario& scenario : device.scheduleScenarios) {
+      if (DeviceSchema::validate(scenario)) return "invalid_schedule";
+      if (scenario.isUseSetting && (!checkOutput(scenario.initialStateRelay) || !checkOutput(scenario.endStateRelay))) {
+        return "schedule_relay_missing";
+      }
+    }
 
-      for (JsonObject sensorObj : sensorsJson) {
-        Sensor sensor;
+    for (const Timer& timer : device.timers) {
+      if (DeviceSchema::validate(timer)) return "invalid_timer";
+      if (timer.isUseSetting && (!checkOutput(timer.initialStateRelay) || !checkOutput(timer.endStateRelay))) {
+        return "timer_relay_missing";
+      }
+    }
 
-        if (sensorObj.containsKey("description")) {
-          strncpy_safe(sensor.description, sensorObj["description"], MAX_DESCRIPTION_LENGTH);
-        }
-        if (sensorObj.containsKey("isUseSetting")) sensor.isUseSetting = sensorObj["isUseSetting"].as<bool>();
-        if (sensorObj.containsKey("sensorId")) sensor.sensorId = sensorObj["sensorId"];
-        if (sensorObj.containsKey("relayId")) sensor.relayId = sensorObj["relayId"];
-
-        if (sensorObj.containsKey("typeSensor")) {
-          JsonArray typeSensor = sensorObj["typeSensor"];
-          for (int i = 0; i < 7 && i < typeSensor.size(); i++) {
-            sensor.typeSensor.set(i, typeSensor[i].as<bool>());
-          }
-        }
+    for (const Pid& pid : device.pids) {
+      if (DeviceSchema::validate(pid)) return "invalid_pid";
+    }
+    return nullptr;
+  }
 
-        if (sensorObj.containsKey("serial_r")) sensor.serial_r = sensorObj["serial_r"];
-        if (sensorObj.containsKey("thermistor_r")) sensor.thermistor_r = sensorObj["thermistor_r"];
+  bool DeviceManager::applyDeviceKey(Device& device, const char* key, JsonVariantConst value) {
+    if (DeviceSchema::applyField(DEVICE_META_SCHEMA, &device, key, value) ||
+        DeviceSchema::applyField(DEVICE_FLAGS_SCHEMA, &device, key, value)) {
+      return true;
+    }
 
+    if (strcmp(key, "relays") == 0) {
+      device.relays.clear();
+      device.runtime.outputMask = 0;
+      device.runtime.savedOutputMask = 0;
+      for (JsonObjectConst relayObj : value.as<JsonArrayConst>()) {
+        Relay relay;
+        size_t relayIndex = device.relays.size();
+        DeviceSchema::fromJson(relay, relayObj, [&](const char* relayKey, JsonVariantConst relayValue) {
+          if (strcmp(relayKey, "statePin") == 0) device.runtime.setOutput(relayIndex, relayValue.as<bool>());
+          else if (strcmp(relayKey, "lastState") == 0) device.runtime.setSavedOutput(relayIndex, relayValue.as<bool>());
+        });
+        device.relays.push_back(relay);
+      }
+    } else if (strcmp(key, "pins") == 0) {
+      device.pins.clear();
+      for (JsonVariantConst pin : value.as<JsonArrayConst>()) {
+        device.pins.push_back(pin.as<uint8_t>());
+      }
+    } else if (strcmp(key, "sensors") == 0) {
+      PsramVector<Sensor> newSensors;
+      for (JsonObjectConst sensorObj : value.as<JsonArrayConst>()) {
+        Sensor sensor;
+        DeviceSchema::fromJson(sensor, sensorObj);
         newSensors.push_back(sensor);
       }
 
       noInterrupts();
       device.sensors = std::move(newSensors);
       interrupts();
-    }
-
-    if (doc.containsKey("actions")) {
-      JsonArray actionsJson = doc["actions"];
-      std::vector<Action> newActions;
+    } else if (strcmp(key, "actions") == 0) {
+      PsramVector<Action> newActions;
+      uint32_t triggeredMask = 0;
 
-      for (JsonObject actionObj : actionsJson) {
+      for (JsonObjectConst actionObj : value.as<JsonArrayConst>()) {
         Action action;
-
-        if (actionObj.containsKey("description")) {
-          strncpy_safe(action.description, actionObj["description"], MAX_DESCRIPTION_LENGTH);
-        }
-        if (actionObj.containsKey("isUseSetting")) action.isUseSetting = actionObj["isUseSetting"].as<bool>();
-        if (actionObj.containsKey("targetSensorId")) action.targetSensorId = actionObj["targetSensorId"];
-        if (actionObj.containsKey("triggerValueMax")) action.triggerValueMax = actionObj["triggerValueMax"];
-        if (actionObj.containsKey("triggerValueMin")) action.triggerValueMin = actionObj["triggerValueMin"];
-        if (actionObj.containsKey("isHumidity")) action.isHumidity = actionObj["isHumidity"].as<bool>();
-        if (actionObj.containsKey("actionMoreOrEqual")) action.actionMoreOrEqual = actionObj["actionMoreOrEqual"].as<bool>();
-        if (actionObj.containsKey("isReturnSetting")) action.isReturnSetting = actionObj["isReturnSetting"].as<bool>();
-        if (actionObj.containsKey("wasTriggered")) action.wasTriggered = actionObj["wasTriggered"].as<bool>();
-        if (actionObj.containsKey("sendMsg")) action.sendMsg = actionObj["sendMsg"].as<String>();
-
-        if (actionObj.containsKey("collectionSettings")) {
-          JsonArray collectionSettings = actionObj["collectionSettings"];
-          for (int i = 0; i < 4 && i < collectionSettings.size(); i++) {
-            action.collectionSettings.set(i, collectionSettings[i].as<bool>());
-          }
-        }
-
-        if (actionObj.containsKey("outputs")) {
-          JsonArray outputsJson = actionObj["outputs"];
-          action.outputs.clear();
-          for (JsonObject outputObj : outputsJson) {
-            OutPower output;
-            if (outputObj.containsKey("isUseSetting")) output.isUseSetting = outputObj["isUseSetting"].as<bool>();
-            if (outputObj.containsKey("relayId")) output.relayId = outputObj["relayId"];
-            if (outputObj.containsKey("statePin")) output.statePin = outputObj["statePin"].as<bool>();
-            if (outputObj.containsKey("lastState")) output.lastState = outputObj["lastState"].as<bool>();
-            if (outputObj.containsKey("isReturn")) output.isReturn = outputObj["isReturn"].as<bool>();
-            if (outputObj.containsKey("description")) {
-              strncpy_safe(output.description, outputObj["description"], MAX_DESCRIPTION_LENGTH);
+        DeviceSchema::fromJson(action, actionObj, [&](const char* actionKey, JsonVariantConst actionValue) {
+          if (strcmp(actionKey, "wasTriggered") == 0) {
+            DeviceRuntime::setBit(triggeredMask, newActions.size(), actionValue.as<bool>());
+          } else if (strcmp(actionKey, "outputs") == 0) {
+            action.outputs.clear();
+            for (JsonObjectConst outputObj : actionValue.as<JsonArrayConst>()) {
+              OutPower output;
+              DeviceSchema::fromJson(output, outputObj);
+              action.outputs.push_back(output);
             }
-            action.outputs.push_back(output);
           }
-        }
-
+        });
         newActions.push_back(action);
       }
 
       noInterrupts();
       device.actions = std::move(newActions);
+      device.runtime.actionTriggeredMask = triggeredMask;
       interrupts();
-    }
-
-    if (doc.containsKey("scheduleScenarios")) {
+    } else if (strcmp(key, "scheduleScenarios") == 0) {
       device.scheduleScenarios.clear();
-      JsonArray scenarios = doc["scheduleScenarios"];
-      for (JsonObject scenarioObj : scenarios) {
+      for (auto& flags : device.runtime.scenarioFlags) {
+        flags = 0;
+      }
+      for (JsonObjectConst scenarioObj : value.as<JsonArrayConst>()) {
         ScheduleScenario scenario;
-        scenario.temperatureUpdated = false;
-        scenario.timersExecuted = false;
-        scenario.initialStateApplied = false;
-        scenario.endStateApplied = false;
-        scenario.scenarioProcessed = false;
-
-        if (scenarioObj.containsKey("isUseSetting")) {
-          scenario.isUseSetting = scenarioObj["isUseSetting"].as<bool>();
-        }
-        if (scenarioObj.containsKey("description")) {
-          strncpy_safe(scenario.description, scenarioObj["description"], MAX_DESCRIPTION_LENGTH);
-        }
-        if (scenarioObj.containsKey("isActive")) {
-          scenario.isActive = scenarioObj["isActive"].as<bool>();
-        }
-
-        if (scenarioObj.containsKey("collectionSettings")) {
-          JsonArray collectionSettings = scenarioObj["collectionSettings"];
-          for (int i = 0; i < 4 && i < collectionSettings.size(); i++) {
-            scenario.collectionSettings.set(i, collectionSettings[i].as<bool>());
-          }
-        }
-
-        if (scenarioObj.containsKey("startDate")) {
-          strncpy_safe(scenario.startDate, scenarioObj["startDate"], MAX_DATE_LENGTH);
-        }
-        if (scenarioObj.containsKey("endDate")) {
-          strncpy_safe(scenario.endDate, scenarioObj["endDate"], MAX_DATE_LENGTH);
-        }
-
-        if (scenarioObj.containsKey("startEndTimes")) {
-          JsonArray startEndTimes = scenarioObj["startEndTimes"];
-          for (JsonObject intervalObj : startEndTimes) {
+        DeviceSchema::fromJson(scenario, scenarioObj, [&](const char* scenarioKey, JsonVariantConst scenarioValue) {
+          if (strcmp(scenarioKey, "startEndTimes") != 0) return;
+          for (JsonObjectConst intervalObj : scenarioValue.as<JsonArrayConst>()) {
             startEndTime timeInterval;
-            if (intervalObj.containsKey("startTime")) {
-              strncpy_safe(timeInterval.startTime, intervalObj["startTime"], MAX_TIME_LENGTH);
-            }
-            if (intervalObj.containsKey("endTime")) {
-              strncpy_safe(timeInterval.endTime, intervalObj["endTime"], MAX_TIME_LENGTH);
-            }
+            DeviceSchema::fromJson(timeInterval, intervalObj);
             scenario.startEndTimes.push_back(timeInterval);
           }
-        }
+        });
+        device.scheduleScenarios.push_back(scenario);
+      }
+    } else if (strcmp(key, "temperature") == 0) {
+      DeviceSchema::fromJson(device.temperature, value.as<JsonObjectConst>());
+    } else if (strcmp(key, "pids") == 0) {
+      device.pids.clear();
+      for (JsonObjectConst pidObject : value.as<JsonArrayConst>()) {
+        Pid pid;
+        DeviceSchema::fromJson(pid, pidObject);
+        device.pids.push_back(pid);
+      }
+    } else if (strcmp(key, "timers") == 0) {
+      device.timers.clear();
+      for (JsonObjectConst timerObj : value.as<JsonArrayConst>()) {
+        Timer timer;
+        DeviceSchema::fromJson(timer, timerObj);
+        device.timers.push_back(timer);
+      }
+    } else {
+      return false;
+    }
 
-        if (scenarioObj.containsKey("week")) {
-          JsonArray week = scenarioObj["week"];
-          for (int i = 0; i < 7 && i < week.size(); i++) {
-            scenario.week.set(i, week[i].as<bool>());
-          }
-        }
+    return true;
+  }
 
-        if (scenarioObj.containsKey("months")) {
-          JsonArray months = scenarioObj["months"];
-          for (int i = 0; i < 12 && i < months.size(); i++) {
-            scenario.months.set(i, months[i].as<bool>());
-          }
-        }
+  static bool parsePatchIndex(const char* text, size_t size, size_t& index) {
+    char* end = nullptr;
+    unsigned long value = strtoul(text, &end, 10);
+    if (end == text || *end != '\0' || value >= size) return false;
+    index = value;
+    return true;
+  }
 
-        if (scenarioObj.containsKey("initialStateRelay")) {
-          JsonObject initialStateRelay = scenarioObj["initialStateRelay"];
-          if (initialStateRelay.containsKey("isUseSetting")) {
-            scenario.initialStateRelay.isUseSetting = initialStateRelay["isUseSetting"].as<bool>();
-          }
-          if (initialStateRelay.containsKey("relayId")) {
-            scenario.initialStateRelay.relayId = initialStateRelay["relayId"];
-          }
-          if (initialStateRelay.containsKey("statePin")) {
-            scenario.initialStateRelay.statePin = initialStateRelay["statePin"].as<bool>();
-          }
-          if (initialStateRelay.containsKey("lastState")) {
-            scenario.initialStateRelay.lastState = initialStateRelay["lastState"].as<bool>();
-          }
-          if (initialStateRelay.containsKey("description")) {
-            strncpy_safe(scenario.initialStateRelay.description, initialStateRelay["description"], MAX_DESCRIPTION_LENGTH);
-          }
-        }
+  // {"3": {"time": "00:10:00"}} patches element 3 in place. Each element is
+  // patched on a copy and only committed once the copy validates; keys outside
+  // the field table go to `nested`, which returns false for unknown ones and
+  // may set `error` itself.
+  template <typename T, typename Nested>
+  static bool patchItems(PsramVector<T>& items, JsonObjectConst patch, Nested&& nested, const char*& error) {
+    for (JsonPairConst kv : patch) {
+      size_t index;
+      JsonObjectConst itemPatch = kv.value().as<JsonObjectConst>();
+      if (!parsePatchIndex(kv.key().c_str(), items.size(), index) || itemPatch.isNull()) {
+        error = "bad_index";
+        return false;
+      }
 
-        if (scenarioObj.containsKey("endStateRelay")) {
-          JsonObject endStateRelay = scenarioObj["endStateRelay"];
-          if (endStateRelay.containsKey("isUseSetting")) {
-            scenario.endStateRelay.isUseSetting = endStateRelay["isUseSetting"].as<bool>();
-          }
-          if (endStateRelay.containsKey("relayId")) {
-            scenario.endStateRelay.relayId = endStateRelay["relayId"];
-          }
-          if (endStateRelay.containsKey("statePin")) {
-            scenario.endStateRelay.statePin = endStateRelay["statePin"].as<bool>();
-          }
-          if (endStateRelay.containsKey("lastState")) {
-            scenario.endStateRelay.lastState = endStateRelay["lastState"].as<bool>();
-          }
-          if (endStateRelay.containsKey("description")) {
-            strncpy_safe(scenario.endStateRelay.description, endStateRelay["description"], MAX_DESCRIPTION_LENGTH);
-          }
-        }
+      T copy = items[index];
+      bool known = true;
+      DeviceSchema::fromJson(copy, itemPatch, [&](const char* key, JsonVariantConst value) {
+        if (!nested(copy, index, key, value)) known = false;
+      });
 
-        device.scheduleScenarios.push_back(scenario);
+      if (!known) {
+        if (!error) error = "unknown_field";
+        return false;
+      }
+      if (DeviceSchema::validate(copy)) {
+        error = "invalid_value";
+        return false;
       }
+      items[index] = std::move(copy);
     }
+    return true;
+  }
 
-    if (doc.containsKey("temperature")) {
-      JsonObject temperature = doc["temperature"];
-      if (temperature.containsKey("isUseSetting")) {
-        device.temperature.isUseSetting = temperature["isUseSetting"].as<bool>();
-      }
-      if (temperature.containsKey("relayId")) {
-        device.temperature.relayId = temperature["relayId"];
-      }
-      if (temperature.containsKey("lastState")) {
-        device.temperature.lastState = temperature["lastState"].as<bool>();
-      }
-      if (temperature.containsKey("sensorId")) {
-        device.temperature.sensorId = temperature["sensorId"];
-      }
-      if (temperature.containsKey("setTemperature")) {
-        device.temperature.setTemperature = temperature["setTemperature"];
-      }
-      if (temperature.containsKey("currentTemp")) {
-        device.temperature.currentTemp = temperature["currentTemp"];
-      }
-      if (temperature.containsKey("isSmoothly")) {
-        device.temperature.isSmoothly = temperature["isSmoothly"].as<bool>();
-      }
-      if (temperature.containsKey("isIncrease")) {
-        device.temperature.isIncrease = temperature["isIncrease"].as<bool>();
-      }
-      if (temperature.containsKey("collectionSettings")) {
-        JsonArray collectionSettings = temperature["collectionSettings"];
-        for (int i = 0; i < 4 && i < collectionSettings.size(); i++) {
-          device.temperature.collectionSettings.set(i, collectionSettings[i].as<bool>());
+  // Nested lists follow RFC 7386: an array replaces the list, an object
+  // addressed by index patches single elements.
+  template <typename T>
+  static bool patchList(PsramVector<T>& items, JsonVariantConst value, const char*& error) {
+    if (value.is<JsonArrayConst>()) {
+      PsramVector<T> replacement;
+      for (JsonObjectConst itemObj : value.as<JsonArrayConst>()) {
+        T item{};
+        DeviceSchema::fromJson(item, itemObj);
+        if (DeviceSchema::validate(item)) {
+          error = "invalid_value";
+          return false;
         }
+        replacement.push_back(item);
       }
-      if (temperature.containsKey("selectedPidIndex")) {
-        device.temperature.selectedPidIndex = temperature["selectedPidIndex"];
-      }
+      items = std::move(replacement);
+      return true;
     }
 
-    if (doc.containsKey("pids")) {
-      device.pids.clear();
-      JsonArray pidsArray = doc["pids"].as<JsonArray>();
-      for (JsonObject pidObject : pidsArray) {
-        Pid pid;
-        if (pidObject.containsKey("description")) {
-          strncpy_safe(pid.description, pidObject["description"], MAX_DESCRIPTION_LENGTH);
-        }
-        if (pidObject.containsKey("descriptionDetailed")) {
-
-          strncpy_safe(pid.descriptionDetailed, pidObject["descriptionDetailed"], MAX_TXT_DESCRIPTION_LENGTH);
+    if (!value.is<JsonObjectConst>()) {
+      error = "invalid_value";
+      return false;
+    }
+    return patchItems(items, value.as<JsonObjectConst>(),
+                      [](T&, size_t, const char*, JsonVariantConst) { return false; }, error);
+  }
 
-        }
-        if (pidObject.containsKey("Kp")) pid.Kp = pidObject["Kp"];
-        if (pidObject.containsKey("Ki")) pid.Ki = pidObject["Ki"];
-        if (pidObject.containsKey("Kd")) pid.Kd = pidObject["Kd"];
-        device.pids.push_back(pid);
+  bool DeviceManager::applyPatch(Device& device, JsonObjectConst patch, uint16_t& sections, const char*& error) {
+    auto noNested = [](auto&, size_t, const char*, JsonVariantConst) { return false; };
+
+    for (JsonPairConst kv : patch) {
+      const char* key = kv.key().c_str();
+      JsonObjectConst items = kv.value().as<JsonObjectConst>();
+      bool applied;
+
+      if (items.isNull() || strcmp(key, "temperature") == 0) {
+        applied = applyDeviceKey(device, key, kv.value());
+        if (!applied) error = "unknown_field";
+      } else if (strcmp(key, "relays") == 0) {
+        applied = patchItems(device.relays, items, [&](Relay&, size_t index, const char* relayKey, JsonVariantConst value) {
+          if (strcmp(relayKey, "statePin") == 0) device.runtime.setOutput(index, value.as<bool>());
+          else if (strcmp(relayKey, "lastState") == 0) device.runtime.setSavedOutput(index, value.as<bool>());
+          else return false;
+          return true;
+        }, error);
+      } else if (strcmp(key, "sensors") == 0) {
+        applied = patchItems(device.sensors, items, noNested, error);
+      } else if (strcmp(key, "actions") == 0) {
+        applied = patchItems(device.actions, items, [&error](Action& action, size_t, const char* actionKey, JsonVariantConst value) {
+          return strcmp(actionKey, "outputs") == 0 && patchList(action.outputs, value, error);
+        }, error);
+      } else if (strcmp(key, "scheduleScenarios") == 0) {
+        applied = patchItems(device.scheduleScenarios, items, [&error](ScheduleScenario& scenario, size_t, const char* scenarioKey, JsonVariantConst value) {
+          return strcmp(scenarioKey, "startEndTimes") == 0 && patchList(scenario.startEndTimes, value, error);
+        }, error);
+      } else if (strcmp(key, "pids") == 0) {
+        applied = patchItems(device.pids, items, noNested, error);
+      } else if (strcmp(key, "timers") == 0) {
+        applied = patchItems(device.timers, items, noNested, error);
+      } else {
+        applied = false;
+        error = "unknown_field";
       }
-    }
 
-    if (doc.containsKey("timers")) {
-      device.timers.clear();
-      JsonArray timers = doc["timers"];
-      for (JsonObject timerObj : timers) {
-        Timer timer;
-        if (timerObj.containsKey("isUseSetting")) {
-          timer.isUseSetting = timerObj["isUseSetting"].as<bool>();
-        }
-        if (timerObj.containsKey("time")) {
-          strncpy_safe(timer.time, timerObj["time"], MAX_TIME_LENGTH);
-        }
-        if (timerObj.containsKey("collectionSettings")) {
-          JsonArray collectionSettings = timerObj["collectionSettings"];
-          for (int i = 0; i < 4 && i < collectionSettings.size(); i++) {
-            timer.collectionSettings.set(i, collectionSettings[i].as<bool>());
-          }
-        }
-        if (timerObj.containsKey("initialStateRelay")) {
-          JsonObject initialStateRelay = timerObj["initialStateRelay"];
-          if (initialStateRelay.containsKey("isUseSetting")) {
-            timer.initialStateRelay.isUseSetting = initialStateRelay["isUseSetting"].as<bool>();
-          }
-          if (initialStateRelay.containsKey("relayId")) {
-            timer.initialStateRelay.relayId = initialStateRelay["relayId"];
-          }
-          if (initialStateRelay.containsKey("statePin")) {
-            timer.initialStateRelay.statePin = initialStateRelay["statePin"].as<bool>();
-          }
-          if (initialStateRelay.containsKey("lastState")) {
-            timer.initialStateRelay.lastState = initialStateRelay["lastState"].as<bool>();
-          }
-          if (initialStateRelay.containsKey("description")) {
-            strncpy_safe(timer.initialStateRelay.description, initialStateRelay["description"], MAX_DESCRIPTION_LENGTH);
-          }
-        }
-        if (timerObj.containsKey("endStateRelay")) {
-          JsonObject endStateRelay = timerObj["endStateRelay"];
-          if (endStateRelay.containsKey("isUseSetting")) {
-            timer.endStateRelay.isUseSetting = endStateRelay["isUseSetting"].as<bool>();
-          }
-          if (endStateRelay.containsKey("relayId")) {
-            timer.endStateRelay.relayId = endStateRelay["relayId"];
-          }
-          if (endStateRelay.containsKey("statePin")) {
-            timer.endStateRelay.statePin = endStateRelay["statePin"].as<bool>();
-          }
-          if (endStateRelay.containsKey("lastState")) {
-            timer.endStateRelay.lastState = endStateRelay["lastState"].as<bool>();
-          }
-          if (endStateRelay.containsKey("description")) {
-            strncpy_safe(timer.endStateRelay.description, endStateRelay["description"], MAX_DESCRIPTION_LENGTH);
-          }
-        }
-        device.timers.push_back(timer);
+      if (!applied) {
+        Serial.printf("[DeviceManager] Patch '%s' отклонен: %s\n", key, error);
+        return false;
       }
+      sections |= sectionForKey(key);
     }
 
-    if (doc.containsKey("isTimersEnabled")) {
-      device.isTimersEnabled = doc["isTimersEnabled"].as<bool>();
+    return true;
+  }
+
+  bool DeviceManager::patchDevice(uint8_t deviceIndex, JsonObjectConst patch, const char*& error) {
+    if (deviceIndex >= myDevices.size()) {
+      error = "bad_device";
+      return false;
     }
-    if (doc.containsKey("isEncyclateTimers")) {
-      device.isEncyclateTimers = doc["isEncyclateTimers"].as<bool>();
+
+    // Patched like a full save: on a staged copy that Control swaps in, so
+    // its sensor and relay bindings are rebound and a bad key changes nothing.
+    PsramVector<Device> candidate;
+    Device* next = beginStage(deviceIndex, candidate, error);
+    if (!next) {
+      return false;
     }
-    if (doc.containsKey("isScheduleEnabled")) {
-      device.isScheduleEnabled = doc["isScheduleEnabled"].as<bool>();
+
+    uint16_t sections = DEVICE_SECTION_NONE;
+    if (!applyPatch(*next, patch, sections, error)) {
+      return false;
     }
-    if (doc.containsKey("isActionEnabled")) {
-      device.isActionEnabled = doc["isActionEnabled"].as<bool>();
+    return finishStage(deviceIndex, candidate, sections, error);
+  }
+
+  // Merges a "relays/3/description"-style path into a patch object.
+  static bool mergePatchPath(JsonObject root, const char* path, JsonVariantConst value, const char*& error) {
+    char buffer[96];
+    if (!path || !*path || strlen(path) >= sizeof(buffer)) {
+      error = "bad_path";
+      return false;
     }
+    strcpy(buffer, path);
 
+    JsonObject node = root;
+    char* segment = strtok(buffer, "/");
+    while (segment) {
+      char* next = strtok(nullptr, "/");
+      if (next) {
+        JsonObject child = node[segment];
+        node = child.isNull() ? node.createNestedObject(segment) : child;
+      } else {
+        node[segment].set(value);
+      }
+      segment = next;
+    }
     return true;
   }
 
+  bool DeviceManager::patchDevice(uint8_t deviceIndex, JsonObjectConst patch, JsonArrayConst ops, const char*& error) {
+    JsonDocument& doc = patchArena.acquire();
+    JsonObject root = doc.to<JsonObject>();
+    if (!patch.isNull()) {
+      root.set(patch);
+    }
+    for (JsonObjectConst op : ops) {
+      if (!mergePatchPath(root, op["path"] | "", op["value"], error)) {
+        return false;
+      }
+    }
+
+    if (doc.overflowed()) {
+      error = "too_large";
+      return false;
+    }
+    if (root.size() == 0) {
+      return true;
+    }
+    return patchDevice(deviceIndex, doc.as<JsonObjectConst>(), error);
+  }
+
   bool DeviceManager::deserializeDevice(const char* jsonString, Device& device) {
 
-    DynamicJsonDocument doc(8192);
+    PsramJsonDocument doc(8192);
 
     DeserializationError error = deserializeJson(doc, jsonString);
     if (error) {
@@ -827,15 +924,15 @@
   void DeviceManager::setRelayStateForAllDevices(uint8_t targetRelayId, bool state) {
     for (auto& device : myDevices) {
 
-      Relay* relay = findRelayById(device, targetRelayId);
-      if (relay) {
-        relay->statePin = state;
+      int relayIndex = findRelayIndexById(device, targetRelayId);
+      if (relayIndex >= 0) {
+        device.runtime.setOutput(relayIndex, state);
       }
 
       if (device.temperature.isUseSetting && device.temperature.relayId == targetRelayId) {
 
-        if (relay) {
-          relay->statePin = state;
+        if (relayIndex >= 0) {
+          device.runtime.setOutput(relayIndex, state);
         }
       }
 
@@ -866,32 +963,32 @@
   void DeviceManager::saveRelayStates(uint8_t targetRelayId) {
     for (auto& device : myDevices) {
 
-      Relay* relay = findRelayById(device, targetRelayId);
-      if (relay) {
-        relay->lastState = relay->statePin;
+      int relayIndex = findRelayIndexById(device, targetRelayId);
+      if (relayIndex >= 0) {
+        device.runtime.setSavedOutput(relayIndex, device.runtime.output(relayIndex));
       }
 
       if (device.temperature.relayId == targetRelayId) {
-        if (relay) {
-          device.temperature.lastState = relay->statePin;
+        if (relayIndex >= 0) {
+          device.temperature.lastState = device.runtime.output(relayIndex);
         }
       }
 
       for (auto& timer : device.timers) {
         if (timer.initialStateRelay.relayId == targetRelayId) {
-          timer.initialStateRelay.lastState = relay ? relay->statePin : false;
+          timer.initialStateRelay.lastState = relayIndex >= 0 && device.runtime.output(relayIndex);
         }
         if (timer.endStateRelay.relayId == targetRelayId) {
-          timer.endStateRelay.lastState = relay ? relay->statePin : false;
+          timer.endStateRelay.lastState = relayIndex >= 0 && device.runtime.output(relayIndex);
         }
       }
 
       for (auto& scenario : device.scheduleScenarios) {
         if (scenario.initialStateRelay.relayId == targetRelayId) {
-          scenario.initialStateRelay.lastState = relay ? relay->statePin : false;
+          scenario.initialStateRelay.lastState = relayIndex >= 0 && device.runtime.output(relayIndex);
         }
         if (scenario.endStateRelay.relayId == targetRelayId) {
-          scenario.endStateRelay.lastState = relay ? relay->statePin : false;
+          scenario.endStateRelay.lastState = relayIndex >= 0 && device.runtime.output(relayIndex);
         }
       }
     }
@@ -900,174 +997,618 @@
   void DeviceManager::restoreRelayStates(uint8_t targetRelayId) {
     for (auto& device : myDevices) {
 
-      Relay* relay = findRelayById(device, targetRelayId);
-      if (relay) {
-        relay->statePin = relay->lastState;
+      int relayIndex = findRelayIndexById(device, targetRelayId);
+      if (relayIndex >= 0) {
+        device.runtime.setOutput(relayIndex, device.runtime.savedOutput(relayIndex));
       }
 
       if (device.temperature.relayId == targetRelayId) {
-        if (relay) {
-          relay->statePin = device.temperature.lastState;
+        if (relayIndex >= 0) {
+          device.runtime.setOutput(relayIndex, device.temperature.lastState);
+        }
+      }
+
+      for (auto& timer : device.timers) {
+        if (timer.initialStateRelay.relayId == targetRelayId) {
+          if (relayIndex >= 0) {
+            device.runtime.setOutput(relayIndex, timer.initialStateRelay.lastState);
+          }
+        }
+        if (timer.endStateRelay.relayId == targetRelayId) {
+          if (relayIndex >= 0) {
+            device.runtime.setOutput(relayIndex, timer.endStateRelay.lastState);
+          }
+        }
+      }
+
+      for (auto& scenario : device.scheduleScenarios) {
+        if (scenario.initialStateRelay.relayId == targetRelayId) {
+          if (relayIndex >= 0) {
+            device.runtime.setOutput(relayIndex, scenario.initialStateRelay.lastState);
+          }
+        }
+        if (scenario.endStateRelay.relayId == targetRelayId) {
+          if (relayIndex >= 0) {
+            device.runtime.setOutput(relayIndex, scenario.endStateRelay.lastState);
+          }
+        }
+      }
+    }
+  }
+
+  Relay* DeviceManager::findRelayById(Device& device, uint8_t relayId) {
+    for (auto& relay : device.relays) {
+      if (relay.id == relayId) {
+        return &relay;
+      }
+    }
+    return nullptr;
+  }
+
+  int DeviceManager::findRelayIndexById(const Device& device, uint8_t relayId) {
+    for (size_t i = 0; i < device.relays.size(); i++) {
+      if (device.relays[i].id == relayId) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  int DeviceManager::findSensorIndexById(const Device& device, int sensorId) {
+    for (size_t i = 0; i < device.sensors.size(); i++) {
+      if (device.sensors[i].sensorId == sensorId) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  void DeviceManager::validateAndSetRelayId(uint8_t& relayId, const PsramVector<Relay>& relays) {
+    bool found = false;
+    for (const auto& relay : relays) {
+      if (relay.id == relayId) {
+        found = true;
+        break;
+      }
+    }
+    if (!found && !relays.empty()) {
+      relayId = relays[0].id;
+    }
+  }
+
+  void DeviceManager::validateRelayIds(Device& device) {
+    validateAndSetRelayId(device.temperature.relayId, device.relays);
+
+    for (auto& scenario : device.scheduleScenarios) {
+      validateAndSetRelayId(scenario.initialStateRelay.relayId, device.relays);
+      validateAndSetRelayId(scenario.endStateRelay.relayId, device.relays);
+    }
+
+    for (auto& timer : device.timers) {
+      validateAndSetRelayId(timer.initialStateRelay.relayId, device.relays);
+      validateAndSetRelayId(timer.endStateRelay.relayId, device.relays);
+    }
+  }
+
+  bool DeviceManager::writeDevicesToFile(const PsramVector<Device>& myDevices, const char* filename) {
+    syncSlots();
+
+    // Devices that are not resident are copied byte for byte from the current
+    // snapshot, so the source has to be opened before the temp file exists.
+    PersistedFile source;
+    bool needsSource = std::any_of(deviceSlots.begin(), deviceSlots.end(),
+                                   [](const DeviceSlot& slot) { return !slot.resident; });
+    if (needsSource && !persistence.openRead(storeFilename, source)) {
+      Serial.printf("[DeviceManager] %s unavailable, snapshot skipped\n", storeFilename);
+      return false;
+    }
+
+    PsramVector<DeviceSlot> written = deviceSlots;
+    bool success = persistence.writeNow(filename, [this, &myDevices, &source, &written](Print& out) {
+      uint32_t offset = 0;
+      for (size_t i = 0; i < myDevices.size(); i++) {
+        DeviceSlot& slot = written[i];
+        size_t length = 0;
+
+        if (slot.resident) {
+          String json = serializeDevice(myDevices[i]);
+          length = out.print(json);
+          if (length != json.length()) {
+            return false;
+          }
+        } else {
+          uint8_t buffer[256];
+          source.seek(slot.offset);
+          while (length < slot.length) {
+            size_t chunk = source.readBytes((char*)buffer, min((size_t)(slot.length - length), sizeof(buffer)));
+            if (chunk == 0 || out.write(buffer, chunk) != chunk) {
+              return false;
+            }
+            length += chunk;
+          }
         }
+
+        if (out.println() != 2) {
+          return false;
+        }
+
+        slot.offset = offset;
+        slot.length = length;
+        offset += length + 2;
+        yield();
+      }
+
+      source.close();
+      return true;
+    });
+
+    if (success) {
+      for (auto& slot : written) {
+        slot.modified = false;
+      }
+      deviceSlots = written;
+      storeFilename = filename;
+      evictDevices(currentDeviceIndex);
+    } else {
+      Serial.println("Ошибка открытия файла для записи");
+    }
+
+    return success;
+  }
+
+  void DeviceManager::buildDeviceLoadFilter(JsonDocument& filter) {
+    filter.clear();
+    filter["*"] = true;
+
+    filter["sensors"][0]["*"] = true;
+    filter["sensors"][0]["currentValue"] = false;
+    filter["sensors"][0]["humidityValue"] = false;
+
+    filter["actions"][0]["*"] = true;
+    filter["actions"][0]["wasTriggered"] = false;
+
+    filter["temperature"]["*"] = true;
+    filter["temperature"]["currentTemp"] = false;
+  }
+
+  bool DeviceManager::readDevicesFromFile(PsramVector<Device>& myDevices, const char* filename) {
+    Serial.println("readDevicesFromFile");
+    Serial.printf("Free heap before: %d\n", ESP.getFreeHeap());
+
+    PersistedFile file;
+    if (!persistence.openRead(filename, file)) {
+      Serial.println("Ошибка открытия файла для чтения");
+      return false;
+    }
+
+    if (file.size() <= 2) {
+      Serial.printf("File too small: %d bytes\n", file.size());
+      file.close();
+      return false;
+    }
+
+    storeFilename = filename;
+
+    // Only name and selection are kept for every device; the rest of each line
+    // is parsed when the device is first used.
+    StaticJsonDocument<64> filter;
+    filter["nameDevice"] = true;
+    filter["isSelected"] = true;
+    StaticJsonDocument<256> doc;
+
+    myDevices.clear();
+    deviceSlots.clear();
+    size_t lineCount = 0;
+    size_t errorCount = 0;
+
+    while (file.available()) {
+      while (isspace(file.peek())) {
+        file.read();
       }
 
-      for (auto& timer : device.timers) {
-        if (timer.initialStateRelay.relayId == targetRelayId) {
-          if (relay) {
-            relay->statePin = timer.initialStateRelay.lastState;
-          }
-        }
-        if (timer.endStateRelay.relayId == targetRelayId) {
-          if (relay) {
-            relay->statePin = timer.endStateRelay.lastState;
-          }
-        }
+      size_t startPosition = file.position();
+      DeserializationError error = deserializeJson(doc, file, DeserializationOption::Filter(filter));
+
+      if (error == DeserializationError::EmptyInput) {
+        break;
+      }
+
+      lineCount++;
+
+      if (error) {
+        errorCount++;
+        Serial.printf("Line %d: Deserialization failed: %s\n", lineCount, error.c_str());
+
+        while (file.available() && file.read() != '\n') {
+        }
+        continue;
+      }
+
+      myDevices.emplace_back();
+      Device& device = myDevices.back();
+      strncpy_safe(device.nameDevice, doc["nameDevice"] | "", MAX_DESCRIPTION_LENGTH);
+      device.isSelected = doc["isSelected"] | false;
+
+      DeviceSlot slot;
+      slot.offset = startPosition;
+      slot.length = file.position() - startPosition;
+      slot.resident = false;
+      deviceSlots.push_back(slot);
+
+      doc.clear();
+      yield();
+    }
+
+    file.close();
+
+    // A device that indexed but does not parse in full is dropped, and the
+    // next one is selected instead.
+    while (!myDevices.empty()) {
+      int selected = getSelectedDeviceIndex(myDevices);
+      uint8_t index = selected < 0 ? 0 : selected;
+      if (loadDevice(index)) {
+        // Set before the journal replay and compaction can evict anything:
+        // the current device is never released.
+        currentDeviceIndex = index;
+        break;
+      }
+      errorCount++;
+      Serial.printf("Device %u (%s) skipped\n", index, myDevices[index].nameDevice);
+      myDevices.erase(myDevices.begin() + index);
+      deviceSlots.erase(deviceSlots.begin() + index);
+    }
+
+    Serial.printf("Total lines: %d, skipped: %d, devices indexed: %d\n",
+                  lineCount, errorCount, myDevices.size());
+    Serial.printf("Free heap after: %d\n", ESP.getFreeHeap());
+
+    return !myDevices.empty();
+  }
+
+  void DeviceManager::syncSlots() {
+    if (deviceSlots.size() > myDevices.size()) {
+      deviceSlots.resize(myDevices.size());
+    }
+    while (deviceSlots.size() < myDevices.size()) {
+      DeviceSlot slot;
+      slot.modified = true;
+      deviceSlots.push_back(slot);
+    }
+  }
+
+  bool DeviceManager::isResident(uint8_t deviceIndex) const {
+    return deviceIndex >= deviceSlots.size() || deviceSlots[deviceIndex].resident;
+  }
+
+  bool DeviceManager::loadDevice(uint8_t deviceIndex) {
+    syncSlots();
+    if (deviceIndex >= myDevices.size()) {
+      return false;
+    }
+
+    DeviceSlot& slot = deviceSlots[deviceIndex];
+    if (slot.resident) {
+      return true;
+    }
+
+    PersistedFile file;
+    if (!persistence.openRead(storeFilename, file)) {
+      Serial.printf("[DeviceManager] Device %u: %s unavailable\n", deviceIndex, storeFilename);
+      return false;
+    }
+
+    StaticJsonDocument<384> filter;
+    buildDeviceLoadFilter(filter);
+
+    size_t capacity = constrain((size_t)slot.length * 2, DEVICE_JSON_MIN_CAPACITY, DEVICE_JSON_MAX_CAPACITY);
+    PsramJsonDocument doc(capacity);
+    DeserializationError error;
+
+    while (true) {
+      file.seek(slot.offset);
+      error = deserializeJson(doc, file, DeserializationOption::Filter(filter));
+      if (error != DeserializationError::NoMemory || capacity >= DEVICE_JSON_MAX_CAPACITY) {
+        break;
+      }
+      capacity = min(capacity * 2, DEVICE_JSON_MAX_CAPACITY);
+      doc = PsramJsonDocument(capacity);
+    }
+    file.close();
+    trackLoadHeap();
+
+    if (error || !deserializeDevice(doc.as<JsonObject>(), myDevices[deviceIndex])) {
+      Serial.printf("[DeviceManager] Device %u: load failed: %s\n", deviceIndex, error.c_str());
+      return false;
+    }
+
+    slot.resident = true;
+    Serial.printf("[DeviceManager] Device %u loaded (%u bytes at %u, %d bytes used)\n",
+                  deviceIndex, slot.length, slot.offset, doc.memoryUsage());
+    return true;
+  }
+
+  void DeviceManager::releaseDevice(uint8_t deviceIndex) {
+    Device& device = myDevices[deviceIndex];
+
+    Device shell{};
+    strncpy_safe(shell.nameDevice, device.nameDevice, MAX_DESCRIPTION_LENGTH);
+    shell.isSelected = device.isSelected;
+    device = std::move(shell);
+
+    deviceSlots[deviceIndex].resident = false;
+  }
+
+  void DeviceManager::evictDevices(uint8_t keepIndex) {
+    size_t resident = std::count_if(deviceSlots.begin(), deviceSlots.end(),
+                                    [](const DeviceSlot& slot) { return slot.resident; });
+
+    while (resident > DEVICE_RESIDENT_MAX) {
+      int victim = -1;
+      for (size_t i = 0; i < deviceSlots.size(); i++) {
+        const DeviceSlot& slot = deviceSlots[i];
+        if (!slot.resident || slot.modified || i == keepIndex || i == currentDeviceIndex) continue;
+        if (victim < 0 || slot.lastUse < deviceSlots[victim].lastUse) victim = i;
       }
 
-      for (auto& scenario : device.scheduleScenarios) {
-        if (scenario.initialStateRelay.relayId == targetRelayId) {
-          if (relay) {
-            relay->statePin = scenario.initialStateRelay.lastState;
-          }
-        }
-        if (scenario.endStateRelay.relayId == targetRelayId) {
-          if (relay) {
-            relay->statePin = scenario.endStateRelay.lastState;
-          }
-        }
+      if (victim < 0) {
+        break;
       }
+      releaseDevice(victim);
+      resident--;
     }
   }
 
-  Relay* DeviceManager::findRelayById(Device& device, uint8_t relayId) {
-    for (auto& relay : device.relays) {
-      if (relay.id == relayId) {
-        return &relay;
-      }
+  Device* DeviceManager::acquireDevice(uint8_t deviceIndex) {
+    if (deviceIndex >= myDevices.size() || !loadDevice(deviceIndex)) {
+      return nullptr;
     }
-    return nullptr;
+
+    deviceSlots[deviceIndex].lastUse = ++slotClock;
+    evictDevices(deviceIndex);
+    return &myDevices[deviceIndex];
   }
 
-  int DeviceManager::findRelayIndexById(const Device& device, uint8_t relayId) {
-    for (size_t i = 0; i < device.relays.size(); i++) {
-      if (device.relays[i].id == relayId) {
-        return i;
-      }
+  void DeviceManager::trackLoadHeap() {
+    size_t freeHeap = ESP.getFreeHeap();
+    if (freeHeap < loadLowestFreeHeap) {
+      loadLowestFreeHeap = freeHeap;
     }
-    return -1;
   }
 
-  int DeviceManager::findSensorIndexById(const Device& device, int sensorId) {
-    for (size_t i = 0; i < device.sensors.size(); i++) {
-      if (device.sensors[i].sensorId == sensorId) {
-        return i;
-      }
+  void DeviceManager::markDirty(uint8_t deviceIndex, uint16_t sections) {
+    if (deviceIndex < myDevices.size()) {
+      myDevices[deviceIndex].dirtySections |= sections;
+      syncSlots();
+      deviceSlots[deviceIndex].modified = true;
     }
-    return -1;
   }
 
-  void DeviceManager::validateAndSetRelayId(uint8_t& relayId, const std::vector<Relay>& relays) {
-    bool found = false;
-    for (const auto& relay : relays) {
-      if (relay.id == relayId) {
-        found = true;
-        break;
+  void DeviceManager::markRelayDirty(uint8_t deviceIndex, size_t relayIndex) {
+    if (deviceIndex >= myDevices.size()) {
+      return;
+    }
+
+    if (relayIndex < 32) {
+      myDevices[deviceIndex].dirtyRelays |= (1UL << relayIndex);
+    } else {
+      myDevices[deviceIndex].dirtySections |= DEVICE_SECTION_RELAYS;
+    }
+    syncSlots();
+    deviceSlots[deviceIndex].modified = true;
+  }
+
+  bool DeviceManager::hasDirtyDevices() const {
+    for (const auto& device : myDevices) {
+      if (device.dirtySections || device.dirtyRelays) {
+        return true;
       }
     }
-    if (!found && !relays.empty()) {
-      relayId = relays[0].id;
+    return false;
+  }
+
+  bool DeviceManager::isSaveDue() const {
+    return hasDirtyDevices() && (lastSaveFailure == 0 || millis() - lastSaveFailure >= DEVICE_SAVE_RETRY_MS);
+  }
+
+  void DeviceManager::clearDirty() {
+    for (auto& device : myDevices) {
+      device.dirtySections = DEVICE_SECTION_NONE;
+      device.dirtyRelays = 0;
     }
   }
 
-  void DeviceManager::validateRelayIds(Device& device) {
-    validateAndSetRelayId(device.temperature.relayId, device.relays);
+  uint16_t DeviceManager::sectionForKey(const char* key) {
+    static const struct {
+      const char* key;
+      uint16_t section;
+    } arraySections[] = {
+      {"relays", DEVICE_SECTION_RELAYS},
+      {"pins", DEVICE_SECTION_PINS},
+      {"sensors", DEVICE_SECTION_SENSORS},
+      {"actions", DEVICE_SECTION_ACTIONS},
+      {"scheduleScenarios", DEVICE_SECTION_SCHEDULES},
+      {"temperature", DEVICE_SECTION_TEMPERATURE},
+      {"pids", DEVICE_SECTION_PIDS},
+      {"timers", DEVICE_SECTION_TIMERS}
+    };
 
-    for (auto& scenario : device.scheduleScenarios) {
-      validateAndSetRelayId(scenario.initialStateRelay.relayId, device.relays);
-      validateAndSetRelayId(scenario.endStateRelay.relayId, device.relays);
+    if (DeviceSchema::find(DEVICE_META_SCHEMA, key)) return DEVICE_SECTION_META;
+    if (DeviceSchema::find(DEVICE_FLAGS_SCHEMA, key)) return DEVICE_SECTION_FLAGS;
+    for (const auto& entry : arraySections) {
+      if (strcmp(entry.key, key) == 0) return entry.section;
     }
+    return DEVICE_SECTION_NONE;
+  }
 
-    for (auto& timer : device.timers) {
-      validateAndSetRelayId(timer.initialStateRelay.relayId, device.relays);
-      validateAndSetRelayId(timer.endStateRelay.relayId, device.relays);
+  uint16_t DeviceManager::sectionsFromJson(JsonObjectConst doc) const {
+    uint16_t sections = DEVICE_SECTION_NONE;
+    for (JsonPairConst kv : doc) {
+      sections |= sectionForKey(kv.key().c_str());
     }
+    return sections;
   }
 
-  bool DeviceManager::writeDevicesToFile(const std::vector<Device>& myDevices, const char* filename) {
-    isSaveControl = true;
-    File file = SPIFFS.open(filename, "w");
-    if (!file) {
-      Serial.println("Ошибка открытия файла для записи");
-      isSaveControl = false;
-      return false;
+  bool DeviceManager::saveDevices(const char* filename) {
+    bool isFullSave = persistence.fileSize(DEVICE_JOURNAL_FILE) >= DEVICE_JOURNAL_MAX_SIZE;
+
+    if (!isFullSave) {
+      if (appendJournal()) {
+        clearDirty();
+        lastSaveFailure = 0;
+        return true;
+      }
+      Serial.println("[DeviceManager] Journal append failed, writing full snapshot");
     }
 
-    for (const auto& device : myDevices) {
-      String json = serializeDevice(device);
-      file.println(json);
-      yield();
+    if (compactJournal(filename)) {
+      lastSaveFailure = 0;
+      return true;
     }
 
-    file.close();
-    isSaveControl = false;
-    return true;
+    // Dirty flags stay set; isSaveDue() holds the next attempt back.
+    lastSaveFailure = max(1UL, millis());
+    Serial.printf("[DeviceManager] Devices not saved, retry in %lu s\n", DEVICE_SAVE_RETRY_MS / 1000);
+    return false;
   }
 
-  bool DeviceManager::readDevicesFromFile(std::vector<Device>& myDevices, const char* filename) {
-    Serial.println("readDevicesFromFile");
-    Serial.printf("Free heap before: %d\n", ESP.getFreeHeap());
-
-    File file = SPIFFS.open(filename, "r");
-    if (!file) {
-      Serial.println("Ошибка открытия файла для чтения");
+  bool DeviceManager::compactJournal(const char* filename) {
+    if (!writeDevicesToFile(myDevices, filename)) {
       return false;
     }
 
-    if (file.size() <= 2) {
-      Serial.printf("File too small: %d bytes\n", file.size());
-      file.close();
-      return false;
+    if (SPIFFS.exists(DEVICE_JOURNAL_FILE)) {
+      SPIFFS.remove(DEVICE_JOURNAL_FILE);
     }
 
-    myDevices.clear();
-    size_t lineCount = 0;
-    size_t errorCount = 0;
+    clearDirty();
+    Serial.println("[DeviceManager] Devices snapshot written, journal compacted");
+    return true;
+  }
 
-    while (file.available()) {
-      lineCount++;
-      String json = file.readStringUntil('\n');
-      json.trim();
+  // Records are keyed by device name, so a record still finds its device
+  // after other devices were added, deleted or reordered. A rename or a
+  // duplicate name would make the key ambiguous; those take a full snapshot.
+  bool DeviceManager::appendJournal() {
+    for (size_t i = 0; i < myDevices.size(); i++) {
+      const Device& device = myDevices[i];
+      if (!device.dirtySections && !device.dirtyRelays) {
+        continue;
+      }
+      if (device.dirtySections & DEVICE_SECTION_META || findDeviceByName(device.nameDevice) != (int)i) {
+        return false;
+      }
+    }
 
-      if (json.length() == 0) {
+    PsramJsonDocument doc(8192);
+    size_t written = 0;
+
+    for (size_t i = 0; i < myDevices.size(); i++) {
+      const Device& device = myDevices[i];
+      if (!device.dirtySections && !device.dirtyRelays) {
         continue;
       }
 
-      Device device;
-      if (deserializeDevice(json.c_str(), device)) {
-        myDevices.push_back(device);
-        Serial.printf("Line %d: Device deserialized successfully\n", lineCount);
-      } else {
-        errorCount++;
-        Serial.printf("Line %d: Deserialization failed: %s\n", lineCount, json.c_str());
+      doc.clear();
+      doc["n"] = device.nameDevice;
+
+      if (device.dirtySections) {
+        serializeDeviceSections(device, device.dirtySections, doc.createNestedObject("v"));
+      }
+
+      if (device.dirtyRelays && !(device.dirtySections & DEVICE_SECTION_RELAYS)) {
+        JsonArray relays = doc.createNestedArray("r");
+        for (size_t r = 0; r < device.relays.size() && r < 32; r++) {
+          if (!(device.dirtyRelays & (1UL << r))) continue;
+
+          const Relay& relay = device.relays[r];
+          JsonObject relayObj = relays.createNestedObject();
+          relayObj["id"] = relay.id;
+          relayObj["statePin"] = device.runtime.output(r);
+          relayObj["manualMode"] = relay.manualMode;
+        }
+      }
+
+      if (doc.overflowed()) {
+        return false;
       }
 
+      bool appended = persistence.appendRecord(DEVICE_JOURNAL_FILE, [&doc](Print& out) {
+        return serializeJson(doc, out) > 0;
+      });
+      if (!appended) {
+        return false;
+      }
+      written++;
       yield();
+    }
+
+    Serial.printf("[DeviceManager] Journal: %u records appended\n", written);
+    return true;
+  }
+
+  int DeviceManager::findDeviceByName(const char* name) const {
+    for (size_t i = 0; i < myDevices.size(); i++) {
+      if (strcmp(myDevices[i].nameDevice, name) == 0) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  bool DeviceManager::applyJournalRecord(JsonObject record) {
+    int deviceIndex = findDeviceByName(record["n"] | "");
+    if (deviceIndex < 0) {
+      return false;
+    }
+
+    Device* target = acquireDevice(deviceIndex);
+    if (!target) {
+      return false;
+    }
+    deviceSlots[deviceIndex].modified = true;
+    Device& device = *target;
 
-      if (lineCount % 5 == 0) {
-        Serial.printf("Free heap after line %d: %d\n", lineCount, ESP.getFreeHeap());
+    if (record.containsKey("v")) {
+      if (!deserializeDevice(record["v"].as<JsonObject>(), device)) {
+        return false;
       }
     }
 
-    file.close();
+    if (record.containsKey("r")) {
+      for (JsonObject relayObj : record["r"].as<JsonArray>()) {
+        int relayIndex = findRelayIndexById(device, relayObj["id"] | 0);
+        if (relayIndex < 0) continue;
 
-    Serial.printf("Total lines: %d, errors: %d, devices loaded: %d\n",
-                  lineCount, errorCount, myDevices.size());
-    Serial.printf("Free heap after: %d\n", ESP.getFreeHeap());
+        if (relayObj.containsKey("statePin")) device.runtime.setOutput(relayIndex, relayObj["statePin"].as<bool>());
+        if (relayObj.containsKey("manualMode")) {
+          device.relays[relayIndex].manualMode = relayObj["manualMode"].as<bool>();
+          device.runtime.touch(RUNTIME_RELAYS, relayIndex);
+        }
+      }
+    }
+
+    return true;
+  }
+
+  int DeviceManager::replayJournal() {
+    PsramJsonDocument doc(8192);
+    int applied = 0;
+
+    persistence.readRecords(DEVICE_JOURNAL_FILE, [this, &doc, &applied](const char* record, size_t length) {
+      DeserializationError error = deserializeJson(doc, record, length);
+      if (error || !applyJournalRecord(doc.as<JsonObject>())) {
+        Serial.printf("[DeviceManager] Journal: record skipped (%s)\n", error.c_str());
+        return;
+      }
+      applied++;
+    });
 
-    return errorCount == 0;
+    Serial.printf("[DeviceManager] Journal: %d records applied\n", applied);
+    return applied;
   }
 
-  int DeviceManager::getSelectedDeviceIndex(const std::vector<Device>& myDevices) {
+
+  int DeviceManager::getSelectedDeviceIndex(const PsramVector<Device>& myDevices) {
     for (size_t i = 0; i < myDevices.size(); ++i) {
       if (myDevices[i].isSelected) {
         return i;
@@ -1077,13 +1618,35 @@
   }
 
   int DeviceManager::deviceInit() {
-    if (!SPIFFS.exists("/devices.json")) {
+    size_t heapBefore = ESP.getFreeHeap();
+    loadLowestFreeHeap = heapBefore;
+
+    int result = loadDevices();
+    compactStrings();
+    printStringFootprint();
+
+    trackLoadHeap();
+    Serial.printf("[DeviceManager] deviceInit heap: before=%u, after=%u, peak use=%u bytes\n",
+                  heapBefore, ESP.getFreeHeap(), heapBefore - loadLowestFreeHeap);
+    return result;
+  }
+
+  int DeviceManager::loadDevices() {
+    shadowDevice.clear();
+    shadowSections = DEVICE_SECTION_NONE;
+
+    if (!persistence.exists("/devices.json")) {
+      currentDeviceIndex = 0;
       initializeDevice("MyDevice1", true);
-      writeDevicesToFile(myDevices, "/devices.json");
+      compactJournal("/devices.json");
       Serial.println("Устройство инициализировано и сохранено в файл.");
     } else {
       if (readDevicesFromFile(myDevices, "/devices.json")) {
-        return currentDeviceIndex = getSelectedDeviceIndex(myDevices);
+        if (SPIFFS.exists(DEVICE_JOURNAL_FILE)) {
+          replayJournal();
+          compactJournal("/devices.json");
+        }
+        return currentDeviceIndex;
       } else {
         Serial.println("Ошибка загрузки устройств из файла.");
         initializeDevice("MyDevice1", true);
@@ -1096,12 +1659,13 @@
   String DeviceManager::debugInfo() {
     String debugString;
 
-    if (myDevices.empty()) {
+    const Device* current = currentDevice();
+    if (!current) {
       debugString += "Нет устройств для отладки\n";
       return debugString;
     }
 
-    const Device& currentDevice = myDevices[currentDeviceIndex];
+    const Device& currentDevice = *current;
 
     debugString += "\nУстройство: " + String(currentDevice.nameDevice) + "\n";
     debugString += "Выбрано: " + String(currentDevice.isSelected ? "Да" : "Нет") + "\n";
@@ -1111,9 +1675,9 @@
       debugString += "ID: " + String(relay.id);
       debugString += ", Pin: " + String(relay.pin);
       debugString += ", ManualMode: " + String(relay.manualMode ? "Вкл" : "Выкл");
-      debugString += ", Состояние: " + String(relay.statePin ? "Вкл" : "Выкл");
-      debugString += ", Последнее: " + String(relay.lastState ? "Вкл" : "Выкл");
-      debugString += ", Описание: " + String(relay.description);
+      debugString += ", Состояние: " + String(currentDevice.runtime.output(currentDevice.indexOf(relay)) ? "Вкл" : "Выкл");
+      debugString += ", Последнее: " + String(currentDevice.runtime.savedOutput(currentDevice.indexOf(relay)) ? "Вкл" : "Выкл");
+      debugString += ", Описание: " + String(relay.description.c_str());
       debugString += "\n";
     }
 
@@ -1157,11 +1721,11 @@
       }
       debugString += "\n";
 
-      debugString += "  Нач. состояние: " + String(scenario.initialStateRelay.description);
+      debugString += "  Нач. состояние: " + String(scenario.initialStateRelay.description.c_str());
       debugString += " (Реле ID " + String(scenario.initialStateRelay.relayId);
       debugString += ", " + String(scenario.initialStateRelay.statePin ? "Вкл" : "Выкл") + ")\n";
 
-      debugString += "  Кон. состояние: " + String(scenario.endStateRelay.description);
+      debugString += "  Кон. состояние: " + String(scenario.endStateRelay.description.c_str());
       debugString += " (Реле ID " + String(scenario.endStateRelay.relayId);
       debugString += ", " + String(scenario.endStateRelay.statePin ? "Вкл" : "Выкл") + ")\n";
     }
@@ -1170,7 +1734,7 @@
     for (size_t i = 0; i < currentDevice.pids.size(); i++) {
       const auto& pid = currentDevice.pids[i];
       debugString += "PID #" + String(i + 1) + ": ";
-      debugString += String(pid.description) + " (Kp=" + String(pid.Kp, 2);
+      debugString += String(pid.description.c_str()) + " (Kp=" + String(pid.Kp, 2);
       debugString += ", Ki=" + String(pid.Ki, 2);
       debugString += ", Kd=" + String(pid.Kd, 2) + ")\n";
     }
@@ -1188,11 +1752,12 @@
   }
 
   size_t DeviceManager::formatFullSystemStatus(char* buffer, size_t bufferSize) {
-    if (myDevices.empty() || currentDeviceIndex >= myDevices.size()) {
+    const Device* current = currentDevice();
+    if (!current) {
       return snprintf(buffer, bufferSize, "Нет устройств для отображения статуса\n");
     }
 
-    const Device& device = myDevices[currentDeviceIndex];
+    const Device& device = *current;
     size_t offset = 0;
 
     offset += snprintf(buffer + offset, bufferSize - offset, "📡 **Датчики:**\n");
@@ -1204,6 +1769,8 @@
         const Sensor& sensor = device.sensors[i];
         if (!sensor.isUseSetting) continue;
 
+        float sensorValue = device.runtime.sensorValue(i);
+        float humidityValue = device.runtime.humidityValue(i);
         hasActiveSensors = true;
         offset += snprintf(buffer + offset, bufferSize - offset,
                            "  • Сенсор #%d (ID: %d): ", i + 1, sensor.sensorId);
@@ -1219,7 +1786,7 @@
 
         bool isSensorOk = true;
         if (sensor.typeSensor.get(0) || sensor.typeSensor.get(1)) {
-          if (isnan(sensor.currentValue) || sensor.currentValue < -100.0 || isnan(sensor.humidityValue)) {
+          if (isnan(sensorValue) || sensorValue < -100.0 || isnan(humidityValue)) {
             isSensorOk = false;
           }
         }
@@ -1227,17 +1794,17 @@
         if (isSensorOk) {
           if (sensor.typeSensor.get(0) || sensor.typeSensor.get(1) || sensor.typeSensor.get(2)) {
             offset += snprintf(buffer + offset, bufferSize - offset,
-                               " - Значение: %.2f°C", (double)sensor.currentValue);
+                               " - Значение: %.2f°C", (double)sensorValue);
             if (sensor.typeSensor.get(0) || sensor.typeSensor.get(1)) {
               offset += snprintf(buffer + offset, bufferSize - offset,
-                                 ", Влажность: %.1f%%", (double)sensor.humidityValue);
+                                 ", Влажность: %.1f%%", (double)humidityValue);
             }
           } else if (sensor.typeSensor.get(3)) {
             offset += snprintf(buffer + offset, bufferSize - offset,
-                               " - Состояние: %s", sensor.currentValue > 0.5f ? "Нажато" : "Отпущено");
+                               " - Состояние: %s", sensorValue > 0.5f ? "Нажато" : "Отпущено");
           } else if (sensor.typeSensor.get(4)) {
             offset += snprintf(buffer + offset, bufferSize - offset,
-                               " - Значение: %.0f", (double)sensor.currentValue);
+                               " - Значение: %.0f", (double)sensorValue);
           }
         } else {
           offset += snprintf(buffer + offset, bufferSize - offset, " - Датчик не подключен");
@@ -1264,11 +1831,11 @@
 
       if (tempSensor) {
         offset += snprintf(buffer + offset, bufferSize - offset,
-                           "  • Текущая температура: %.2f°C\n", (double)tempSensor->currentValue);
+                           "  • Текущая температура: %.2f°C\n", (double)device.runtime.sensorValue(device.indexOf(*tempSensor)));
 
         if (tempSensor->typeSensor.get(0) || tempSensor->typeSensor.get(1)) {
           offset += snprintf(buffer + offset, bufferSize - offset,
-                             "  • Влажность: %.2f%%\n", (double)tempSensor->humidityValue);
+                             "  • Влажность: %.2f%%\n", (double)device.runtime.humidityValue(device.indexOf(*tempSensor)));
         }
       } else {
         offset += snprintf(buffer + offset, bufferSize - offset,
@@ -1298,8 +1865,8 @@
 
       if (tempRelay) {
         offset += snprintf(buffer + offset, bufferSize - offset,
-                           "  • Управляющее реле: %s (Состояние: %s)\n", tempRelay->description,
-                           tempRelay->statePin ? "Вкл" : "Выкл");
+                           "  • Управляющее реле: %s (Состояние: %s)\n", tempRelay->description.c_str(),
+                           device.runtime.output(device.indexOf(*tempRelay)) ? "Вкл" : "Выкл");
       } else {
         offset += snprintf(buffer + offset, bufferSize - offset,
                            "  • Реле управления не найдено (ID: %d)\n", device.temperature.relayId);
@@ -1319,7 +1886,7 @@
           if (!scenario.isUseSetting) continue;
 
           offset += snprintf(buffer + offset, bufferSize - offset,
-                             "  • Сценарий #%d: %s [Активен]", i + 1, scenario.description);
+                             "  • Сценарий #%d: %s [Активен]", i + 1, scenario.description.c_str());
 
           if (scenario.isActive) {
             offset += snprintf(buffer + offset, bufferSize - offset, " [Выполняется]");
@@ -1378,9 +1945,9 @@
           if (!action.isUseSetting) continue;
 
           offset += snprintf(buffer + offset, bufferSize - offset,
-                             "  • Действие #%d: %s [Активен]", i + 1, action.description);
+                             "  • Действие #%d: %s [Активен]", i + 1, action.description.c_str());
 
-          if (action.wasTriggered) {
+          if (device.runtime.actionTriggered(i)) {
             offset += snprintf(buffer + offset, bufferSize - offset, " [Сработало]");
           } else {
             offset += snprintf(buffer + offset, bufferSize - offset, " [Ожидает]");
@@ -1398,9 +1965,10 @@
           if (targetSensor) {
 
             offset += snprintf(buffer + offset, bufferSize - offset,
-                               "  Датчик: %s (ID: %d)\n", targetSensor->description, targetSensor->sensorId);
+                               "  Датчик: %s (ID: %d)\n", targetSensor->description.c_str(), targetSensor->sensorId);
 
-            float currentValue = action.isHumidity ? targetSensor->humidityValue : targetSensor->currentValue;
+            size_t sensorIndex = device.indexOf(*targetSensor);
+            float currentValue = action.isHumidity ? device.runtime.humidityValue(sensorIndex) : device.runtime.sensorValue(sensorIndex);
             if (!isnan(currentValue)) {
               offset += snprintf(buffer + offset, bufferSize - offset,
                                  "  Текущее значение: %.2f\n", (double)currentValue);
@@ -1465,17 +2033,18 @@
         const Timer& timer = device.timers[i];
         if (!timer.isUseSetting) continue;
 
+        TimerInfo progress = device.runtime.timer(i);
         offset += snprintf(buffer + offset, bufferSize - offset,
                            "  • Таймер #%d: %s\n", i + 1, timer.time);
 
-        if (timer.progress.isRunning) {
+        if (progress.isRunning) {
           offset += snprintf(buffer + offset, bufferSize - offset,
                              "  - Статус: Выполняется\n");
           offset += snprintf(buffer + offset, bufferSize - offset,
-                             "  - Прошло: %d сек\n", timer.progress.elapsedTime / 1000);
+                             "  - Прошло: %d сек\n", progress.elapsedTime / 1000);
           offset += snprintf(buffer + offset, bufferSize - offset,
-                             "  - Осталось: %d сек\n", timer.progress.remainingTime / 1000);
-        } else if (timer.progress.isStopped) {
+                             "  - Осталось: %d сек\n", progress.remainingTime / 1000);
+        } else if (progress.isStopped) {
           offset += snprintf(buffer + offset, bufferSize - offset, "  - Статус: Остановлен\n");
         } else {
           offset += snprintf(buffer + offset, bufferSize - offset, "  - Статус: Ожидает\n");
@@ -1518,7 +2087,7 @@
     return result;
   }
 
-  void DeviceManager::printDevices(const std::vector<Device>& devices) {
+  void DeviceManager::printDevices(const PsramVector<Device>& devices) {
     if (devices.empty()) {
       Serial.println("Устройства не найдены.");
       return;
@@ -1548,176 +2117,186 @@
     }
   }
 
-  bool DeviceManager::checkSettingsChanged() {
-
-    static struct {
-
-      bool timersEnabled;
-      bool scheduleEnabled;
-      bool tempEnabled;
-      bool actionEnabled;
-      bool encyclate;
-
-      size_t relaysCount;
-      size_t sensorsCount;
-      size_t timersCount;
-      size_t actionsCount;
-      size_t scenariosCount;
-      size_t pidsCount;
-    } lastState = {false, false, false, false, false, 0, 0, 0, 0, 0, 0};
-
-    Device& device = myDevices[currentDeviceIndex];
-
-    bool flagsChanged = (device.isTimersEnabled != lastState.timersEnabled) ||
-                        (device.isScheduleEnabled != lastState.scheduleEnabled) ||
-                        (device.temperature.isUseSetting != lastState.tempEnabled) ||
-                        (device.isActionEnabled != lastState.actionEnabled) ||
-                        (device.isEncyclateTimers != lastState.encyclate);
-
-    bool countsChanged = (device.relays.size() != lastState.relaysCount) ||
-                         (device.sensors.size() != lastState.sensorsCount) ||
-                         (device.timers.size() != lastState.timersCount) ||
-                         (device.actions.size() != lastState.actionsCount) ||
-                         (device.scheduleScenarios.size() != lastState.scenariosCount) ||
-                         (device.pids.size() != lastState.pidsCount);
-
-    bool anyChanged = flagsChanged || countsChanged;
+  uint8_t DeviceManager::packDeviceFlags(const Device& device) {
+    return (device.isSelected ? 0x01 : 0) |
+           (device.isTimersEnabled ? 0x02 : 0) |
+           (device.isEncyclateTimers ? 0x04 : 0) |
+           (device.isScheduleEnabled ? 0x08 : 0) |
+           (device.isActionEnabled ? 0x10 : 0) |
+           (device.temperature.isUseSetting ? 0x20 : 0);
+  }
 
-    if (anyChanged) {
-      Serial.println(">>> КРИТИЧЕСКИЕ ИЗМЕНЕНИЯ НАСТРОЕК ОБНАРУЖЕНЫ <<<");
+  uint32_t DeviceManager::runtimeVersion(RuntimeTopic topic) {
+    Device* device = currentDevice();
+    if (!device) {
+      return 0;
+    }
 
-      lastState.timersEnabled = device.isTimersEnabled;
-      lastState.scheduleEnabled = device.isScheduleEnabled;
-      lastState.tempEnabled = device.temperature.isUseSetting;
-      lastState.actionEnabled = device.isActionEnabled;
-      lastState.encyclate = device.isEncyclateTimers;
+    DeviceRuntime& runtime = device->runtime;
 
-      lastState.relaysCount = device.relays.size();
-      lastState.sensorsCount = device.sensors.size();
-      lastState.timersCount = device.timers.size();
-      lastState.actionsCount = device.actions.size();
-      lastState.scenariosCount = device.scheduleScenarios.size();
-      lastState.pidsCount = device.pids.size();
+    if (topic == RUNTIME_FLAGS) {
+      uint8_t flags = packDeviceFlags(*device);
+      if (flags != runtime.publishedFlags) {
+        runtime.publishedFlags = flags;
+        runtime.bump(RUNTIME_FLAGS);
+      }
     }
 
-    return anyChanged;
+    return runtime.versions[topic];
   }
 
-  uint32_t DeviceManager::calculateOutputRelayChecksum() {
-    Device& device = myDevices[currentDeviceIndex];
-    uint32_t hash = 5381;
-
-    auto addToHash = [&hash](const void* data, size_t size) {
-      const uint8_t* bytes = static_cast<const uint8_t*>(data);
-      for (size_t i = 0; i < size; ++i) {
-        hash = ((hash << 5) + hash) + bytes[i];
-      }
-    };
+  uint32_t DeviceManager::runtimeDeltaBase(RuntimeTopic topic, uint32_t seen) {
+    const Device* device = topic == RUNTIME_FLAGS ? nullptr : currentDevice();
+    if (!device) {
+      return 0;
+    }
+    return device->runtime.needsSnapshot(topic, seen) ? 0 : seen;
+  }
 
-    for (const auto& relay : device.relays) {
+  size_t DeviceManager::serializeRuntimeTopic(RuntimeTopic topic, uint32_t since) {
+    JsonDocument& doc = runtimeArena.acquire();
 
-      if (relay.isOutput) {
+    switch (topic) {
+      case RUNTIME_RELAYS: serializeRelaysForControlTab(doc, since); break;
+      case RUNTIME_SENSORS: serializeSensorValues(doc, since); break;
+      case RUNTIME_TIMERS: serializeTimersProgress(doc, since); break;
+      case RUNTIME_FLAGS: serializeDeviceFlags(doc); break;
+      default: return 0;
+    }
 
-        addToHash(&relay.id, sizeof(relay.id));
-        addToHash(&relay.pin, sizeof(relay.pin));
-        addToHash(&relay.isOutput, sizeof(relay.isOutput));
-        addToHash(&relay.isPwm, sizeof(relay.isPwm));
-        addToHash(&relay.pwm, sizeof(relay.pwm));
-        addToHash(&relay.manualMode, sizeof(relay.manualMode));
-        addToHash(relay.description, strnlen(relay.description, MAX_DESCRIPTION_LENGTH));
+    return runtimeArena.serialize();
+  }
 
-        bool state = relay.statePin;
-        addToHash(&state, sizeof(state));
-      }
+  size_t DeviceManager::encodeRuntimeTopic(RuntimeTopic topic, uint32_t since) {
+    if (topic >= RUNTIME_TOPIC_COUNT) {
+      return 0;
     }
-    return hash;
-  }
 
-  uint32_t DeviceManager::calculateSensorValuesChecksum() {
-    Device& device = myDevices[currentDeviceIndex];
-    uint32_t hash = 5381;
+    runtimeFrame.begin((RUNTIME_FRAME_BASE + topic) | (since == 0 ? RUNTIME_FRAME_SNAPSHOT : 0));
 
-    auto addToHash = [&hash](const void* data, size_t size) {
-      const uint8_t* bytes = static_cast<const uint8_t*>(data);
-      for (size_t i = 0; i < size; ++i) {
-        hash = ((hash << 5) + hash) + bytes[i];
+    const Device* current = currentDevice();
+    if (!current) {
+      runtimeFrame.put8(0);
+      if (topic == RUNTIME_FLAGS) {
+        runtimeFrame.putString("");
       }
-    };
+      return runtimeFrame.finish();
+    }
 
-    for (const auto& sensor : device.sensors) {
+    const Device& device = *current;
 
-      if (sensor.isUseSetting) {
+    switch (topic) {
+      case RUNTIME_RELAYS: {
+        uint8_t count = 0;
+        for (const auto& relay : device.relays) {
+          if (relay.isOutput && device.runtime.changedSince(topic, device.indexOf(relay), since)) count++;
+        }
+        runtimeFrame.put8(count);
 
-        addToHash(&sensor.currentValue, sizeof(sensor.currentValue));
+        for (const auto& relay : device.relays) {
+          size_t index = device.indexOf(relay);
+          if (!relay.isOutput || !device.runtime.changedSince(topic, index, since)) continue;
 
-        addToHash(&sensor.humidityValue, sizeof(sensor.humidityValue));
+          runtimeFrame.put8(relay.id);
+          runtimeFrame.put8((device.runtime.output(index) ? 0x01 : 0) |
+                            (relay.manualMode ? 0x02 : 0));
+          if (since == 0) runtimeFrame.putString(relay.description.c_str());
+        }
+        break;
       }
-    }
-    return hash;
-  }
 
-  bool DeviceManager::relayStateChanged() {
+      case RUNTIME_SENSORS: {
+        uint8_t count = 0;
+        for (const auto& sensor : device.sensors) {
+          if (sensor.isUseSetting && device.runtime.changedSince(topic, device.indexOf(sensor), since)) count++;
+        }
+        runtimeFrame.put8(count);
 
-    if (millis() - lastRelayCheckTime < RELAY_CHECK_INTERVAL) {
-      return false;
-    }
-    lastRelayCheckTime = millis();
+        for (const auto& sensor : device.sensors) {
+          size_t index = device.indexOf(sensor);
+          if (!sensor.isUseSetting || !device.runtime.changedSince(topic, index, since)) continue;
 
-    uint32_t currentChecksum = calculateOutputRelayChecksum();
+          runtimeFrame.put16((int16_t)sensor.sensorId);
+          runtimeFrame.putFloat(device.runtime.sensorValue(index));
+          runtimeFrame.putFloat(device.runtime.humidityValue(index));
+          if (since == 0) runtimeFrame.putString(sensor.description.c_str());
+        }
+        break;
+      }
 
-    if (currentChecksum != lastOutputRelayChecksum) {
+      case RUNTIME_TIMERS: {
+        size_t timerCount = min(device.timers.size(), (size_t)UINT8_MAX);
+        uint8_t count = 0;
+        for (size_t i = 0; i < timerCount; ++i) {
+          if (device.runtime.changedSince(topic, i, since)) count++;
+        }
+        runtimeFrame.put8(count);
+
+        for (size_t i = 0; i < timerCount; ++i) {
+          if (!device.runtime.changedSince(topic, i, since)) continue;
+          TimerInfo progress = device.runtime.timer(i);
+
+          runtimeFrame.put8(i);
+          runtimeFrame.put8((device.timers[i].isUseSetting ? 0x01 : 0) |
+                            (progress.isRunning ? 0x02 : 0) |
+                            (progress.isStopped ? 0x04 : 0));
+          runtimeFrame.put32(progress.elapsedTime);
+          runtimeFrame.put32(progress.remainingTime);
+        }
+        break;
+      }
 
-      lastOutputRelayChecksum = currentChecksum;
+      case RUNTIME_FLAGS:
+        runtimeFrame.put8(packDeviceFlags(device));
+        runtimeFrame.putString(device.nameDevice);
+        break;
 
-      return true;
+      default:
+        break;
     }
 
-    return false;
+    return runtimeFrame.finish();
   }
 
-  String DeviceManager::serializeRelaysForControlTab() {
-    if (myDevices.empty() || currentDeviceIndex >= myDevices.size()) {
-
-      return "{\"type\":\"relays_update\",\"relays\":[]}";
-    }
-
-    const Device& device = myDevices[currentDeviceIndex];
-
-    DynamicJsonDocument doc(2048);
-
+  void DeviceManager::serializeRelaysForControlTab(JsonDocument& doc, uint32_t since) {
     doc["type"] = "relays_update";
+    doc["full"] = since == 0;
 
     JsonArray relaysArray = doc.createNestedArray("relays");
 
+    const Device* current = currentDevice();
+    if (!current) {
+      return;
+    }
+
+    const Device& device = *current;
+
     for (const auto& relay : device.relays) {
+      size_t index = device.indexOf(relay);
 
-      if (relay.isOutput) {
+      if (relay.isOutput && device.runtime.changedSince(RUNTIME_RELAYS, index, since)) {
 
         JsonObject relayObj = relaysArray.createNestedObject();
 
-        relayObj["description"] = relay.description;
-        relayObj["statePin"] = relay.statePin;
+        if (since == 0) relayObj["description"] = relay.description.forJson();
+        relayObj["statePin"] = device.runtime.output(index);
         relayObj["id"] = relay.id;
         relayObj["manualMode"] = relay.manualMode;
       }
     }
-
-    String jsonString;
-    serializeJson(doc, jsonString);
-
-    return jsonString;
   }
 
   bool DeviceManager::handleRelayCommand(const JsonObject& command, uint32_t clientNum) {
 
-    if (myDevices.empty()) {
+    Device* current = currentDevice();
+    if (!current) {
       Serial.println("[DeviceManager] Error: No devices configured.");
       return false;
     }
 
     Serial.println("[DeviceManager] Received relay command.");
 
-    Device& device = myDevices[currentDeviceIndex];
+    Device& device = *current;
 
     int relayId = command["relay"];
     const char* action = command["action"];
@@ -1732,11 +2311,17 @@
       bool anyRelayFound = false;
       for (auto& relay : device.relays) {
         if (relay.isOutput) {
-          relay.statePin = false;
+          device.runtime.setOutput(device.indexOf(relay), false);
           relay.manualMode = false;
           anyRelayFound = true;
         }
       }
+      if (anyRelayFound) {
+        for (size_t i = 0; i < device.relays.size(); i++) {
+          if (device.relays[i].isOutput) device.runtime.touch(RUNTIME_RELAYS, i);
+        }
+        markDirty(currentDeviceIndex, DEVICE_SECTION_RELAYS);
+      }
       return anyRelayFound;
     }
 
@@ -1752,21 +2337,26 @@
       if (relay.id == relayId) {
 
         found = true;
-        Serial.printf("[DeviceManager] Found relay '%s' (ID: %d). Executing command '%s'\n", relay.description, relay.id, action);
+        Serial.printf("[DeviceManager] Found relay '%s' (ID: %d). Executing command '%s'\n", relay.description.c_str(), relay.id, action);
 
         if (strcmp(action, "reset") == 0) {
           relay.manualMode = false;
+          device.runtime.touch(RUNTIME_RELAYS, device.indexOf(relay));
+          markRelayDirty(currentDeviceIndex, device.indexOf(relay));
           Serial.printf("[DeviceManager] Relay ID %d set to Auto mode.\n", relay.id);
         }
 
         else if (strcmp(action, "on") == 0 || strcmp(action, "off") == 0) {
           bool newState = (strcmp(action, "on") == 0);
 
-          if (relay.statePin != newState || !relay.manualMode) {
-            relay.statePin = newState;
+          size_t relayIndex = device.indexOf(relay);
+          if (device.runtime.output(relayIndex) != newState || !relay.manualMode) {
+            device.runtime.setOutput(relayIndex, newState);
             relay.manualMode = true;
+            device.runtime.touch(RUNTIME_RELAYS, relayIndex);
+            markRelayDirty(currentDeviceIndex, relayIndex);
 
-            Serial.printf("[DeviceManager] Relay ID %d state set to '%s' and mode to Manual.\n", relay.id,  relay.statePin ? "ON" : "OFF");
+            Serial.printf("[DeviceManager] Relay ID %d state set to '%s' and mode to Manual.\n", relay.id, newState ? "ON" : "OFF");
           } else {
             Serial.printf("[DeviceManager] Relay ID %d already in desired state '%s'. No action taken.\n", relay.id, newState ? "ON" : "OFF");
           }
@@ -1786,23 +2376,24 @@
     return found;
   }
 
-  String DeviceManager::serializeTimersProgress() {
-    if (myDevices.empty() || currentDeviceIndex >= myDevices.size()) {
-
-      return "{\"type\":\"timers_update\",\"timers\":[]}";
-    }
-
-    const Device& device = myDevices[currentDeviceIndex];
-
-    DynamicJsonDocument doc(2048);
-
+  void DeviceManager::serializeTimersProgress(JsonDocument& doc, uint32_t since) {
     doc["type"] = "timers_update";
+    doc["full"] = since == 0;
 
     JsonArray timersJson = doc.createNestedArray("timers");
 
+    const Device* current = currentDevice();
+    if (!current) {
+      return;
+    }
+
+    const Device& device = *current;
+
     for (size_t i = 0; i < device.timers.size(); ++i) {
+      if (!device.runtime.changedSince(RUNTIME_TIMERS, i, since)) continue;
+
       const Timer& timer = device.timers[i];
-      const TimerInfo& progress = timer.progress;
+      TimerInfo progress = device.runtime.timer(i);
 
       JsonObject timerObj = timersJson.createNestedObject();
       timerObj["i"] = i;
@@ -1812,21 +2403,17 @@
       timerObj["r"] = progress.isRunning;
       timerObj["s"] = progress.isStopped;
     }
-
-    String jsonString;
-    serializeJson(doc, jsonString);
-    return jsonString;
   }
 
-  String DeviceManager::serializeDeviceFlags() {
-    if (myDevices.empty() || currentDeviceIndex >= myDevices.size()) {
+  void DeviceManager::serializeDeviceFlags(JsonDocument& doc) {
+    const Device* current = currentDevice();
+    if (!current) {
 
-      return "{\"type\":\"device_flags_update\"}";
+      doc["type"] = "device_flags_update";
+      return;
     }
 
-    const Device& device = myDevices[currentDeviceIndex];
-
-    DynamicJsonDocument doc(512);
+    const Device& device = *current;
 
     doc["type"] = "device_flags_update";
 
@@ -1837,106 +2424,123 @@
     doc["se"] = device.isScheduleEnabled;
     doc["ae"] = device.isActionEnabled;
     doc["tu"] = device.temperature.isUseSetting;
-
-    String jsonString;
-    serializeJson(doc, jsonString);
-    return jsonString;
   }
 
-  bool DeviceManager::sensorValuesChanged() {
-
-    if (millis() - lastSensorCheckTime < SENSOR_CHECK_INTERVAL) {
-      return false;
-    }
-    lastSensorCheckTime = millis();
-
-    uint32_t currentChecksum = calculateSensorValuesChecksum();
-
-    if (currentChecksum != lastSensorValuesChecksum) {
+  void DeviceManager::serializeSensorValues(JsonDocument& doc, uint32_t since) {
+    doc["type"] = "sensor_values_update";
+    doc["full"] = since == 0;
 
-      lastSensorValuesChecksum = currentChecksum;
+    JsonArray sensorsArray = doc.createNestedArray("sensors");
 
-      return true;
+    const Device* current = currentDevice();
+    if (!current) {
+      return;
     }
 
-    return false;
-  }
+    const Device& device = *current;
 
-  uint32_t DeviceManager::calculateTimersProgressChecksum() {
-    if (myDevices.empty() || currentDeviceIndex >= myDevices.size()) {
-      return 0;
-    }
-    const Device& device = myDevices[currentDeviceIndex];
-    uint32_t hash = 5381;
+    for (const auto& sensor : device.sensors) {
+      size_t index = device.indexOf(sensor);
 
-    auto addToHash = [&hash](const void* data, size_t size) {
-      const uint8_t* bytes = static_cast<const uint8_t*>(data);
-      for (size_t i = 0; i < size; ++i) {
-        hash = ((hash << 5) + hash) + bytes[i];
-      }
-    };
+      if (sensor.isUseSetting && device.runtime.changedSince(RUNTIME_SENSORS, index, since)) {
 
-    for (const auto& timer : device.timers) {
-      if (timer.isUseSetting) {
+        JsonObject sensorObj = sensorsArray.createNestedObject();
 
-        addToHash(&timer.progress.elapsedTime, sizeof(timer.progress.elapsedTime));
-        addToHash(&timer.progress.remainingTime, sizeof(timer.progress.remainingTime));
-        addToHash(&timer.progress.isRunning, sizeof(timer.progress.isRunning));
-        addToHash(&timer.progress.isStopped, sizeof(timer.progress.isStopped));
+        sensorObj["id"] = sensor.sensorId;
+        if (since == 0) sensorObj["ds"] = sensor.description.forJson();
+        sensorObj["cv"] = device.runtime.sensorValue(index);
+        sensorObj["hv"] = device.runtime.humidityValue(index);
       }
     }
-    return hash;
   }
 
-  bool DeviceManager::timersProgressChanged() {
-    static unsigned long lastCheckTime = 0;
-    if (millis() - lastCheckTime < 500) {
-      return false;
-    }
-    lastCheckTime = millis();
+  void DeviceManager::reportMemoryPlacement(MemoryPlacementReport& report) {
+    report.add("Devices", myDevices);
 
-    uint32_t currentChecksum = calculateTimersProgressChecksum();
+    for (const auto& device : myDevices) {
+      report.add("Devices", device.relays);
+      report.add("Devices", device.pins);
+      report.add("Devices", device.pids);
+      report.add("Devices", device.sensors);
+      report.add("Devices", device.timers);
+      report.add("Devices", device.actions);
+      report.add("Devices", device.scheduleScenarios);
 
-    if (currentChecksum != lastTimersProgressChecksum) {
-      Serial.printf(">>> ИЗМЕНЕНИЕ ПРОГРЕССА ТАЙМЕРОВ ОБНАРУЖЕНО! New checksum: %u\n", currentChecksum);
-      lastTimersProgressChecksum = currentChecksum;
-      return true;
-    }
+      for (const auto& action : device.actions) {
+        report.add("Devices", action.outputs);
+      }
+      for (const auto& scenario : device.scheduleScenarios) {
+        report.add("Devices", scenario.startEndTimes);
+      }
 
-    return false;
+      report.add("Runtime", device.runtime.pwm);
+      report.add("Runtime", device.runtime.switchCounts);
+      report.add("Runtime", device.runtime.sensorValues);
+      report.add("Runtime", device.runtime.humidityValues);
+      report.add("Runtime", device.runtime.sensorReadAt);
+      report.add("Runtime", device.runtime.timerElapsed);
+      report.add("Runtime", device.runtime.timerRemaining);
+    }
   }
 
-  String DeviceManager::serializeSensorValues() {
-    if (myDevices.empty() || currentDeviceIndex >= myDevices.size()) {
-
-      return "{\"type\":\"sensor_values_update\",\"sensors\":[]}";
+  void DeviceManager::compactStrings() {
+    size_t reclaimed = StringPool::instance().compact();
+    if (reclaimed > 0) {
+      Serial.printf("[DeviceManager] String pool compacted, %u bytes reclaimed\n", (unsigned)reclaimed);
     }
+  }
 
-    const Device& device = myDevices[currentDeviceIndex];
-
-    DynamicJsonDocument doc(2048);
-
-    doc["type"] = "sensor_values_update";
-
-    JsonArray sensorsArray = doc.createNestedArray("sensors");
+  void DeviceManager::printStringFootprint() {
+    for (size_t d = 0; d < myDevices.size(); d++) {
+      const Device& device = myDevices[d];
+      std::vector<uint16_t> handles;
+      size_t fields = 0;
+      size_t embeddedBytes = 0;
 
-    for (const auto& sensor : device.sensors) {
+      auto visit = [&](const PooledString& text, size_t embeddedSize) {
+        fields++;
+        embeddedBytes += embeddedSize;
+        if (text.handle() != 0) handles.push_back(text.handle());
+      };
+      auto visitOutput = [&](const OutPower& output) {
+        visit(output.description, MAX_DESCRIPTION_LENGTH);
+      };
 
-      if (sensor.isUseSetting) {
+      for (const auto& relay : device.relays) visit(relay.description, MAX_DESCRIPTION_LENGTH);
+      for (const auto& sensor : device.sensors) visit(sensor.description, MAX_DESCRIPTION_LENGTH);
+      for (const auto& pid : device.pids) {
+        visit(pid.description, MAX_DESCRIPTION_LENGTH);
+        visit(pid.descriptionDetailed, MAX_TXT_DESCRIPTION_LENGTH);
+      }
+      for (const auto& action : device.actions) {
+        visit(action.description, MAX_DESCRIPTION_LENGTH);
+        visit(action.sendMsg, sizeof(String) + (action.sendMsg.length() ? action.sendMsg.length() + 1 : 0));
+        for (const auto& output : action.outputs) visitOutput(output);
+      }
+      for (const auto& scenario : device.scheduleScenarios) {
+        visit(scenario.description, MAX_DESCRIPTION_LENGTH);
+        visitOutput(scenario.initialStateRelay);
+        visitOutput(scenario.endStateRelay);
+      }
+      for (const auto& timer : device.timers) {
+        visitOutput(timer.initialStateRelay);
+        visitOutput(timer.endStateRelay);
+      }
 
-        JsonObject sensorObj = sensorsArray.createNestedObject();
+      std::sort(handles.begin(), handles.end());
+      handles.erase(std::unique(handles.begin(), handles.end()), handles.end());
 
-        sensorObj["id"] = sensor.sensorId;
-        sensorObj["ds"] = sensor.description;
-        sensorObj["cv"] = sensor.currentValue;
-        sensorObj["hv"] = sensor.humidityValue;
+      size_t poolBytes = 0;
+      for (uint16_t handle : handles) {
+        poolBytes += StringPool::instance().entrySize(handle);
       }
-    }
 
-    String jsonString;
-    serializeJson(doc, jsonString);
+      Serial.printf("[DeviceManager] %s: %u text fields, embedded %u bytes -> handles %u + pool %u bytes (%u unique)\n",
+                    device.nameDevice, (unsigned)fields, (unsigned)embeddedBytes,
+                    (unsigned)(fields * sizeof(PooledString)), (unsigned)poolBytes, (unsigned)handles.size());
+    }
 
-    return jsonString;
+    StringPool::instance().printStats();
   }
 
   void DeviceManager::showMemoryInfo() {
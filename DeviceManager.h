@@ -2,12 +2,41 @@
 
 #include <DHT.h>
 #include "CommonTypes.h"
+#include "Persistence.h"
+#include "JsonArena.h"
+#include "BinaryFrame.h"
+#include "StringPool.h"
 
 #define MAX_DESCRIPTION_LENGTH 120
 #define MAX_TXT_DESCRIPTION_LENGTH 512
 #define MAX_TIME_LENGTH 10
 #define MAX_DATE_LENGTH 11
 
+#define DEVICE_JSON_MIN_CAPACITY ((size_t)4096)
+#define DEVICE_JSON_MAX_CAPACITY ((size_t)65536)
+
+#define DEVICE_JOURNAL_FILE "/devices.jnl"
+#define DEVICE_JOURNAL_MAX_SIZE ((size_t)16384)
+#define DEVICE_SAVE_RETRY_MS 30000UL
+
+#define DEVICE_RESIDENT_MAX 2
+
+enum DeviceSection : uint16_t {
+  DEVICE_SECTION_NONE        = 0,
+  DEVICE_SECTION_META        = 1 << 0,
+  DEVICE_SECTION_RELAYS      = 1 << 1,
+  DEVICE_SECTION_PINS        = 1 << 2,
+  DEVICE_SECTION_SENSORS     = 1 << 3,
+  DEVICE_SECTION_ACTIONS     = 1 << 4,
+  DEVICE_SECTION_SCHEDULES   = 1 << 5,
+  DEVICE_SECTION_TEMPERATURE = 1 << 6,
+  DEVICE_SECTION_PIDS        = 1 << 7,
+  DEVICE_SECTION_TIMERS      = 1 << 8,
+  DEVICE_SECTION_FLAGS       = 1 << 9,
+  DEVICE_SECTION_ALL         = 0x03FF,
+  DEVICE_SECTION_RUNTIME     = 1 << 10
+};
+
 struct TouchSensorState {
   unsigned long lastDebounceTime = 0;
   bool lastState = HIGH;
@@ -61,11 +90,8 @@ struct Relay {
   bool manualMode;
   bool isOutput;
   bool isDigital;
-  bool statePin;
   bool isPwm;
-  uint8_t pwm;
-  bool lastState;
-  char description[MAX_DESCRIPTION_LENGTH];
+  PooledString description;
 };
 
 struct OutPower {
@@ -76,7 +102,7 @@ struct OutPower {
   bool isPwm;
   uint8_t pwm;
   bool isReturn;
-  char description[MAX_DESCRIPTION_LENGTH];
+  PooledString description;
 };
 
 struct startEndTime {
@@ -85,28 +111,22 @@ struct startEndTime {
 };
 
 struct ScheduleScenario {
-  char description[MAX_DESCRIPTION_LENGTH];
+  PooledString description;
   bool isUseSetting;
   bool isActive;
   BitArray4 collectionSettings;
   char startDate[MAX_DATE_LENGTH];
   char endDate[MAX_DATE_LENGTH];
-  std::vector<startEndTime> startEndTimes;
+  PsramVector<startEndTime> startEndTimes;
   BitArray7 week;
   BitArray12 months;
   OutPower initialStateRelay;
   OutPower endStateRelay;
-
-  bool temperatureUpdated;
-  bool timersExecuted;
-  bool initialStateApplied;
-  bool endStateApplied;
-  bool scenarioProcessed;
 };
 
 struct Pid {
-  char description[MAX_DESCRIPTION_LENGTH];
-  char descriptionDetailed[MAX_TXT_DESCRIPTION_LENGTH];
+  PooledString description;
+  PooledString descriptionDetailed;
   double Kp;
   double Ki;
   double Kd;
@@ -119,25 +139,22 @@ struct Sensor {
   BitArray7 typeSensor;
   uint16_t serial_r;
   uint16_t thermistor_r;
-  float currentValue = 0.0;
-  float humidityValue = 0.0;
   DHT* dht = nullptr;
-  char description[MAX_DESCRIPTION_LENGTH];
+  PooledString description;
 };
 
 struct Action {
    bool isUseSetting;
-   char description[MAX_DESCRIPTION_LENGTH];
+   PooledString description;
    int targetSensorId;
    float triggerValueMax;
    float triggerValueMin;
    bool isHumidity;
    bool actionMoreOrEqual;
-   std::vector<OutPower> outputs;
+   PsramVector<OutPower> outputs;
    BitArray4 collectionSettings;
-   String sendMsg;
+   PooledString sendMsg;
    bool isReturnSetting;
-   bool wasTriggered;
 };
 
 struct Temperature {
@@ -177,35 +194,235 @@ struct Timer {
   BitArray4 collectionSettings;
   OutPower initialStateRelay;
   OutPower endStateRelay;
-  TimerInfo progress;
+};
+
+#define MAX_RUNTIME_ITEMS 32
+
+enum ScenarioFlag : uint8_t {
+  SCENARIO_TEMPERATURE_UPDATED = 0,
+  SCENARIO_TIMERS_EXECUTED,
+  SCENARIO_INITIAL_APPLIED,
+  SCENARIO_END_APPLIED,
+  SCENARIO_PROCESSED,
+  SCENARIO_FLAG_COUNT
+};
+
+enum RuntimeTopic : uint8_t {
+  RUNTIME_RELAYS,
+  RUNTIME_SENSORS,
+  RUNTIME_TIMERS,
+  RUNTIME_FLAGS,
+  RUNTIME_TOPIC_COUNT
+};
+
+// Binary runtime frames (little-endian), first byte is RUNTIME_FRAME_BASE + topic,
+// with RUNTIME_FRAME_SNAPSHOT set when the frame lists every item. Deltas carry
+// only the items changed since the client's version and omit descriptions:
+//   relays:  u8 count, { u8 id, u8 bits (1 = on, 2 = manual), [str description] }
+//   sensors: u8 count, { i16 id, f32 value, f32 humidity, [str description] }
+//   timers:  u8 count, { u8 index, u8 bits (1 = enabled, 2 = running, 4 = stopped), u32 elapsed, u32 remaining }
+//   flags:   u8 packDeviceFlags(), str name
+// str is u8 length + UTF-8 bytes.
+#define RUNTIME_FRAME_BASE 0x01
+#define RUNTIME_FRAME_SNAPSHOT 0x80
+#define RUNTIME_FRAME_CAPACITY 2048
+
+// versions[] advance on every change; itemVersions[] remember the version at
+// which each relay/sensor/timer last changed, so a client that has seen
+// version v only needs the items stamped after v. Anything older than
+// snapshotVersions[] (a config change) needs a full snapshot.
+struct DeviceRuntime {
+  uint32_t versions[RUNTIME_TOPIC_COUNT] = {1, 1, 1, 1};
+  uint32_t snapshotVersions[RUNTIME_TOPIC_COUNT] = {1, 1, 1, 1};
+  std::vector<uint32_t> itemVersions[RUNTIME_TOPIC_COUNT];
+  uint8_t publishedFlags = 0;
+
+  uint32_t outputMask = 0;
+  uint32_t savedOutputMask = 0;
+  std::vector<uint8_t> pwm;
+  std::vector<uint32_t> switchCounts;
+
+  std::vector<float> sensorValues;
+  std::vector<float> humidityValues;
+  std::vector<uint32_t> sensorReadAt;
+
+  std::vector<uint32_t> timerElapsed;
+  std::vector<uint32_t> timerRemaining;
+  uint32_t timerRunningMask = 0;
+  uint32_t timerStoppedMask = 0;
+
+  uint32_t actionTriggeredMask = 0;
+  uint32_t scenarioFlags[SCENARIO_FLAG_COUNT] = {0};
+
+  void bump(RuntimeTopic topic) {
+    if (++versions[topic] == 0) versions[topic] = 1;
+  }
+
+  // Subscribers behind this version get a full snapshot of the topic.
+  void invalidate(RuntimeTopic topic) {
+    bump(topic);
+    snapshotVersions[topic] = versions[topic];
+  }
+
+  void bumpAll() {
+    for (uint8_t i = 0; i < RUNTIME_TOPIC_COUNT; i++) {
+      invalidate(static_cast<RuntimeTopic>(i));
+    }
+  }
+
+  void touch(RuntimeTopic topic, size_t index) {
+    bump(topic);
+    if (index < itemVersions[topic].size()) itemVersions[topic][index] = versions[topic];
+  }
+
+  bool changedSince(RuntimeTopic topic, size_t index, uint32_t version) const {
+    return index >= itemVersions[topic].size() || itemVersions[topic][index] > version;
+  }
+
+  bool needsSnapshot(RuntimeTopic topic, uint32_t version) const {
+    return version == 0 || version < snapshotVersions[topic] || version > versions[topic];
+  }
+
+  static bool getBit(uint32_t mask, size_t index) {
+    return index < MAX_RUNTIME_ITEMS && ((mask >> index) & 1);
+  }
+
+  static void setBit(uint32_t& mask, size_t index, bool value) {
+    if (index >= MAX_RUNTIME_ITEMS) return;
+    if (value) mask |= (1UL << index);
+    else mask &= ~(1UL << index);
+  }
+
+  void resize(size_t relayCount, size_t sensorCount, size_t timerCount) {
+    if (pwm.size() != relayCount || sensorValues.size() != sensorCount || timerElapsed.size() != timerCount) {
+      bumpAll();
+    }
+    pwm.resize(relayCount, 0);
+    switchCounts.resize(relayCount, 0);
+    sensorValues.resize(sensorCount, 0.0f);
+    humidityValues.resize(sensorCount, 0.0f);
+    sensorReadAt.resize(sensorCount, 0);
+    timerElapsed.resize(timerCount, 0);
+    timerRemaining.resize(timerCount, 0);
+    itemVersions[RUNTIME_RELAYS].resize(relayCount, versions[RUNTIME_RELAYS]);
+    itemVersions[RUNTIME_SENSORS].resize(sensorCount, versions[RUNTIME_SENSORS]);
+    itemVersions[RUNTIME_TIMERS].resize(timerCount, versions[RUNTIME_TIMERS]);
+  }
+
+  bool output(size_t index) const { return getBit(outputMask, index); }
+  void setOutput(size_t index, bool state) {
+    if (output(index) == state) return;
+    setBit(outputMask, index, state);
+    if (index < switchCounts.size()) switchCounts[index]++;
+    touch(RUNTIME_RELAYS, index);
+  }
+
+  bool savedOutput(size_t index) const { return getBit(savedOutputMask, index); }
+  void setSavedOutput(size_t index, bool state) { setBit(savedOutputMask, index, state); }
+
+  uint8_t pwmValue(size_t index) const { return index < pwm.size() ? pwm[index] : 0; }
+  void setPwm(size_t index, uint8_t value) {
+    if (index < pwm.size()) pwm[index] = value;
+  }
+
+  float sensorValue(size_t index) const { return index < sensorValues.size() ? sensorValues[index] : 0.0f; }
+  float humidityValue(size_t index) const { return index < humidityValues.size() ? humidityValues[index] : 0.0f; }
+  // sensorReadAt is stamped on every reading, changed or not, so the age of a
+  // steady value stays small.
+  void setSensorValue(size_t index, float value) {
+    if (index >= sensorValues.size()) return;
+    sensorReadAt[index] = millis();
+    if (sensorValues[index] == value) return;
+    sensorValues[index] = value;
+    touch(RUNTIME_SENSORS, index);
+  }
+  void setHumidityValue(size_t index, float value) {
+    if (index >= humidityValues.size()) return;
+    sensorReadAt[index] = millis();
+    if (humidityValues[index] == value) return;
+    humidityValues[index] = value;
+    touch(RUNTIME_SENSORS, index);
+  }
+
+  TimerInfo timer(size_t index) const {
+    TimerInfo info;
+    if (index < timerElapsed.size()) {
+      info.elapsedTime = timerElapsed[index];
+      info.remainingTime = timerRemaining[index];
+    }
+    info.isRunning = getBit(timerRunningMask, index);
+    info.isStopped = getBit(timerStoppedMask, index);
+    return info;
+  }
+  void setTimer(size_t index, const TimerInfo& info) {
+    if (index < timerElapsed.size() &&
+        (timerElapsed[index] != info.elapsedTime || timerRemaining[index] != info.remainingTime)) {
+      timerElapsed[index] = info.elapsedTime;
+      timerRemaining[index] = info.remainingTime;
+      touch(RUNTIME_TIMERS, index);
+    }
+    setTimerRunning(index, info.isRunning, info.isStopped);
+  }
+  void setTimerRunning(size_t index, bool isRunning, bool isStopped) {
+    if (getBit(timerRunningMask, index) == isRunning && getBit(timerStoppedMask, index) == isStopped) return;
+    setBit(timerRunningMask, index, isRunning);
+    setBit(timerStoppedMask, index, isStopped);
+    touch(RUNTIME_TIMERS, index);
+  }
+
+  bool actionTriggered(size_t index) const { return getBit(actionTriggeredMask, index); }
+  void setActionTriggered(size_t index, bool value) { setBit(actionTriggeredMask, index, value); }
+
+  bool scenarioFlag(size_t index, ScenarioFlag flag) const { return getBit(scenarioFlags[flag], index); }
+  void setScenarioFlag(size_t index, ScenarioFlag flag, bool value) { setBit(scenarioFlags[flag], index, value); }
 };
 
 struct Device {
   char nameDevice[MAX_DESCRIPTION_LENGTH];
   bool isSelected;
-  std::vector<Relay> relays;
-  std::vector<uint8_t> pins;
-  std::vector<ScheduleScenario> scheduleScenarios;
+  PsramVector<Relay> relays;
+  PsramVector<uint8_t> pins;
+  PsramVector<ScheduleScenario> scheduleScenarios;
   Temperature temperature;
 
-  std::vector<Pid> pids;
-  std::vector<Timer> timers;
-  std::vector<Sensor> sensors;
-  std::vector<Action> actions;
+  PsramVector<Pid> pids;
+  PsramVector<Timer> timers;
+  PsramVector<Sensor> sensors;
+  PsramVector<Action> actions;
 
   bool isTimersEnabled;
   bool isEncyclateTimers;
   bool isScheduleEnabled;
   bool isActionEnabled;
+
+  uint16_t dirtySections = DEVICE_SECTION_NONE;
+  uint32_t dirtyRelays = 0;
+
+  DeviceRuntime runtime;
+
+  size_t indexOf(const Relay& relay) const { return &relay - relays.data(); }
+  size_t indexOf(const Sensor& sensor) const { return &sensor - sensors.data(); }
+  size_t indexOf(const Action& action) const { return &action - actions.data(); }
+  size_t indexOf(const ScheduleScenario& scenario) const { return &scenario - scheduleScenarios.data(); }
+  void syncRuntime() { runtime.resize(relays.size(), sensors.size(), timers.size()); }
+};
+
+// Where a device lives in the current devices.json snapshot. Devices that are
+// not resident keep only name/isSelected in memory and are parsed on demand.
+struct DeviceSlot {
+  uint32_t offset = 0;
+  uint32_t length = 0;
+  uint32_t lastUse = 0;
+  bool resident = true;
+  bool modified = false;
 };
 
 class DeviceManager {
 public:
-    DeviceManager() = default;
+    DeviceManager(Persistence& persistence);
 
-    std::vector<Device> myDevices;
+    PsramVector<Device> myDevices;
     uint8_t currentDeviceIndex = 0;
-    bool isSaveControl = false;
     bool isResultSaveControl = false;
 
     struct {
@@ -219,59 +436,112 @@ public:
     void initializeDevice(const char* name, bool activ, bool isNewDevice = false);
     int deviceInit();
 
-    String serializeDevice(const Device& device);
+    String serializeDevice(const Device& device, bool withRuntime = false);
     bool deserializeDevice(JsonObject doc, Device& device);
     bool deserializeDevice(const char* jsonString, Device& device);
-    bool writeDevicesToFile(const std::vector<Device>& myDevices, const char* filename);
-    bool readDevicesFromFile(std::vector<Device>& myDevices, const char* filename);
+    bool writeDevicesToFile(const PsramVector<Device>& myDevices, const char* filename);
+    bool readDevicesFromFile(PsramVector<Device>& myDevices, const char* filename);
+    void serializeDeviceSections(const Device& device, uint16_t sections, JsonObject doc);
+
+    void markDirty(uint8_t deviceIndex, uint16_t sections);
+    void markRelayDirty(uint8_t deviceIndex, size_t relayIndex);
+    bool hasDirtyDevices() const;
+    // Dirty devices, and no failed save within the last DEVICE_SAVE_RETRY_MS.
+    bool isSaveDue() const;
+    uint16_t sectionsFromJson(JsonObjectConst doc) const;
+    bool patchDevice(uint8_t deviceIndex, JsonObjectConst patch, const char*& error);
+    // A merge patch plus path ops, applied together or not at all.
+    bool patchDevice(uint8_t deviceIndex, JsonObjectConst patch, JsonArrayConst ops, const char*& error);
+
+    // Full device saves and patches are applied to a shadow copy and validated
+    // there. Control publishes the shadow with commitShadowDevice() between
+    // passes, so nothing it holds pointers into changes in the middle of a cycle.
+    bool stageDevice(uint8_t deviceIndex, JsonObjectConst settings, const char*& error);
+    Device* shadow() { return shadowDevice.empty() ? nullptr : &shadowDevice.front(); }
+    uint8_t shadowIndex() const { return shadowDeviceIndex; }
+    uint16_t commitShadowDevice();
+    const char* validateDevice(const Device& device) const;
+    bool saveDevices(const char* filename);
+    Device* acquireDevice(uint8_t deviceIndex);
+    // The current device is pinned resident; consumers still go through here
+    // rather than indexing myDevices.
+    Device* currentDevice() { return acquireDevice(currentDeviceIndex); }
+    bool isResident(uint8_t deviceIndex) const;
 
     void setRelayStateForAllDevices(uint8_t targetRelayId, bool state);
     void saveRelayStates(uint8_t targetRelayId);
     void restoreRelayStates(uint8_t targetRelayId);
-    void validateAndSetRelayId(uint8_t& relayId, const std::vector<Relay>& relays);
+    void validateAndSetRelayId(uint8_t& relayId, const PsramVector<Relay>& relays);
     void validateRelayIds(Device& device);
 
-    int getSelectedDeviceIndex(const std::vector<Device>& myDevices);
+    int getSelectedDeviceIndex(const PsramVector<Device>& myDevices);
     String debugInfo();
-    void printDevices(const std::vector<Device>& devices);
+    void printDevices(const PsramVector<Device>& devices);
     void showMemoryInfo();
-
-    bool checkSettingsChanged();
-    bool relayStateChanged();
-    bool sensorValuesChanged();
-    bool timersProgressChanged();
+    void reportMemoryPlacement(MemoryPlacementReport& report);
+    void compactStrings();
+    void printStringFootprint();
+
+    uint32_t runtimeVersion(RuntimeTopic topic);
+    uint32_t runtimeDeltaBase(RuntimeTopic topic, uint32_t seen);
+    size_t serializeRuntimeTopic(RuntimeTopic topic, uint32_t since = 0);
+    const char* runtimeTopicText() const { return runtimeArena.text(); }
+    size_t encodeRuntimeTopic(RuntimeTopic topic, uint32_t since = 0);
+    const uint8_t* runtimeTopicFrame() const { return runtimeFrame.data(); }
     bool handleRelayCommand(const JsonObject& command, uint32_t clientNum);
-    String serializeRelaysForControlTab();
-    String serializeTimersProgress();
-    String serializeDeviceFlags();
-    String serializeSensorValues();
+    void serializeRelaysForControlTab(JsonDocument& doc, uint32_t since = 0);
+    void serializeTimersProgress(JsonDocument& doc, uint32_t since = 0);
+    void serializeDeviceFlags(JsonDocument& doc);
+    void serializeSensorValues(JsonDocument& doc, uint32_t since = 0);
 
     String getActiveDaysString(const BitArray7& week);
     String getActiveMonthsString(const BitArray12& months);
 
 private:
+    Persistence& persistence;
+    JsonArena runtimeArena{"dm.runtime", 2048, 4096};
+    BinaryFrame runtimeFrame{"dm.frame", RUNTIME_FRAME_CAPACITY};
+    JsonArena patchArena{"dm.patch", 4096};
+
+    PsramVector<Device> shadowDevice;
+    uint8_t shadowDeviceIndex = 0;
+    uint16_t shadowSections = DEVICE_SECTION_NONE;
+
+    PsramVector<DeviceSlot> deviceSlots;
+    uint32_t slotClock = 0;
+    const char* storeFilename = "/devices.json";
 
     int findRelayIndexById(const Device& device, uint8_t relayId);
     int findSensorIndexById(const Device& device, int sensorId);
     Relay* findRelayById(Device& device, uint8_t relayId);
 
+    int loadDevices();
+    void buildDeviceLoadFilter(JsonDocument& filter);
+    void trackLoadHeap();
+    void syncSlots();
+    bool loadDevice(uint8_t deviceIndex);
+    void releaseDevice(uint8_t deviceIndex);
+    void evictDevices(uint8_t keepIndex);
+    size_t loadLowestFreeHeap = 0;
+    unsigned long lastSaveFailure = 0;
+
+    bool appendJournal();
+    bool compactJournal(const char* filename);
+    int replayJournal();
+    bool applyJournalRecord(JsonObject record);
+    int findDeviceByName(const char* name) const;
+    void clearDirty();
+    bool applyDeviceKey(Device& device, const char* key, JsonVariantConst value);
+    bool applyPatch(Device& device, JsonObjectConst patch, uint16_t& sections, const char*& error);
+    Device* beginStage(uint8_t deviceIndex, PsramVector<Device>& candidate, const char*& error);
+    bool finishStage(uint8_t deviceIndex, PsramVector<Device>& candidate, uint16_t sections, const char*& error);
+    static uint16_t sectionForKey(const char* key);
+
     void strncpy_safe(char* dest, const char* src, size_t destSize) {
         strncpy(dest, src, destSize - 1);
         dest[destSize - 1] = '\0';
     }
 
-    uint32_t lastOutputRelayChecksum = 0;
-    unsigned long lastRelayCheckTime = 0;
-    const unsigned long RELAY_CHECK_INTERVAL = 500;
-
-    unsigned long lastSensorCheckTime = 0;
-    uint32_t lastSensorValuesChecksum = 0;
-    const unsigned long SENSOR_CHECK_INTERVAL = 200;
-
-    uint32_t lastTimersProgressChecksum = 0;
-    uint32_t calculateTimersProgressChecksum();
-
-    uint32_t calculateOutputRelayChecksum();
-    uint32_t calculateSensorValuesChecksum();
+    static uint8_t packDeviceFlags(const Device& device);
 
 };
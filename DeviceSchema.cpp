@@ -0,0 +1,389 @@
+#include "DeviceSchema.h"
+#include <float.h>
+
+// Device and Action hold vectors, so they are not standard-layout; GCC still
+// computes offsetof for them, it only warns.
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+
+#define SCHEMA(name, fields) { name, fields, (uint8_t)(sizeof(fields) / sizeof(fields[0])) }
+
+static constexpr FieldDesc RELAY_FIELDS[] = {
+  SCHEMA_INT(Relay, id, -1, 255),
+  SCHEMA_U8(Relay, pin, 0, 255),
+  SCHEMA_BOOL(Relay, isPwm),
+  SCHEMA_BOOL(Relay, manualMode),
+  SCHEMA_BOOL(Relay, isOutput),
+  SCHEMA_BOOL(Relay, isDigital),
+  SCHEMA_STRING(Relay, description, MAX_DESCRIPTION_LENGTH)
+};
+
+static constexpr FieldDesc OUTPOWER_FIELDS[] = {
+  SCHEMA_BOOL(OutPower, isUseSetting),
+  SCHEMA_U8(OutPower, relayId, 0, 255),
+  SCHEMA_BOOL(OutPower, statePin),
+  SCHEMA_BOOL(OutPower, lastState),
+  SCHEMA_BOOL(OutPower, isReturn),
+  SCHEMA_STRING(OutPower, description, MAX_DESCRIPTION_LENGTH)
+};
+
+static constexpr FieldDesc START_END_TIME_FIELDS[] = {
+  SCHEMA_CHARS(startEndTime, startTime),
+  SCHEMA_CHARS(startEndTime, endTime)
+};
+
+const StructSchema OUTPOWER_SCHEMA = SCHEMA("OutPower", OUTPOWER_FIELDS);
+const StructSchema START_END_TIME_SCHEMA = SCHEMA("startEndTime", START_END_TIME_FIELDS);
+
+static constexpr FieldDesc SCENARIO_FIELDS[] = {
+  SCHEMA_BOOL(ScheduleScenario, isUseSetting),
+  SCHEMA_STRING(ScheduleScenario, description, MAX_DESCRIPTION_LENGTH),
+  SCHEMA_BOOL(ScheduleScenario, isActive),
+  SCHEMA_BITS(ScheduleScenario, collectionSettings, 4),
+  SCHEMA_CHARS(ScheduleScenario, startDate),
+  SCHEMA_CHARS(ScheduleScenario, endDate),
+  SCHEMA_BITS(ScheduleScenario, week, 7),
+  SCHEMA_BITS(ScheduleScenario, months, 12),
+  SCHEMA_OBJECT(ScheduleScenario, initialStateRelay, OUTPOWER_SCHEMA),
+  SCHEMA_OBJECT(ScheduleScenario, endStateRelay, OUTPOWER_SCHEMA)
+};
+
+static constexpr FieldDesc PID_FIELDS[] = {
+  SCHEMA_STRING(Pid, description, MAX_DESCRIPTION_LENGTH),
+  SCHEMA_STRING(Pid, descriptionDetailed, MAX_TXT_DESCRIPTION_LENGTH),
+  SCHEMA_DOUBLE(Pid, Kp, -FLT_MAX, FLT_MAX),
+  SCHEMA_DOUBLE(Pid, Ki, -FLT_MAX, FLT_MAX),
+  SCHEMA_DOUBLE(Pid, Kd, -FLT_MAX, FLT_MAX)
+};
+
+static constexpr FieldDesc SENSOR_FIELDS[] = {
+  SCHEMA_STRING(Sensor, description, MAX_DESCRIPTION_LENGTH),
+  SCHEMA_BOOL(Sensor, isUseSetting),
+  SCHEMA_INT(Sensor, sensorId, -1, 255),
+  SCHEMA_INT(Sensor, relayId, -1, 255),
+  SCHEMA_BITS(Sensor, typeSensor, 7),
+  SCHEMA_U16(Sensor, serial_r, 0, 65535),
+  SCHEMA_U16(Sensor, thermistor_r, 0, 65535)
+};
+
+static constexpr FieldDesc ACTION_FIELDS[] = {
+  SCHEMA_STRING(Action, description, MAX_DESCRIPTION_LENGTH),
+  SCHEMA_BOOL(Action, isUseSetting),
+  SCHEMA_INT(Action, targetSensorId, -1, 255),
+  SCHEMA_FLOAT(Action, triggerValueMax, -FLT_MAX, FLT_MAX),
+  SCHEMA_FLOAT(Action, triggerValueMin, -FLT_MAX, FLT_MAX),
+  SCHEMA_BOOL(Action, isHumidity),
+  SCHEMA_BOOL(Action, actionMoreOrEqual),
+  SCHEMA_BOOL(Action, isReturnSetting),
+  SCHEMA_STRING(Action, sendMsg, STRING_POOL_MAX_LENGTH),
+  SCHEMA_BITS(Action, collectionSettings, 4)
+};
+
+static constexpr FieldDesc TEMPERATURE_FIELDS[] = {
+  SCHEMA_BOOL(Temperature, isUseSetting),
+  SCHEMA_U8(Temperature, relayId, 0, 255),
+  SCHEMA_BOOL(Temperature, lastState),
+  SCHEMA_U8(Temperature, sensorId, 0, 255),
+  SCHEMA_INT(Temperature, setTemperature, -100, 1000),
+  SCHEMA_FLOAT(Temperature, currentTemp, -FLT_MAX, FLT_MAX),
+  SCHEMA_BOOL(Temperature, isSmoothly),
+  SCHEMA_BOOL(Temperature, isIncrease),
+  SCHEMA_BITS(Temperature, collectionSettings, 4),
+  SCHEMA_U8(Temperature, selectedPidIndex, 0, 255)
+};
+
+static constexpr FieldDesc TIMER_FIELDS[] = {
+  SCHEMA_BOOL(Timer, isUseSetting),
+  SCHEMA_CHARS(Timer, time),
+  SCHEMA_BITS(Timer, collectionSettings, 4),
+  SCHEMA_OBJECT(Timer, initialStateRelay, OUTPOWER_SCHEMA),
+  SCHEMA_OBJECT(Timer, endStateRelay, OUTPOWER_SCHEMA)
+};
+
+static constexpr FieldDesc DEVICE_META_FIELDS[] = {
+  SCHEMA_CHARS(Device, nameDevice),
+  SCHEMA_BOOL(Device, isSelected)
+};
+
+static constexpr FieldDesc DEVICE_FLAGS_FIELDS[] = {
+  SCHEMA_BOOL(Device, isTimersEnabled),
+  SCHEMA_BOOL(Device, isEncyclateTimers),
+  SCHEMA_BOOL(Device, isScheduleEnabled),
+  SCHEMA_BOOL(Device, isActionEnabled)
+};
+
+const StructSchema RELAY_SCHEMA = SCHEMA("Relay", RELAY_FIELDS);
+const StructSchema SCENARIO_SCHEMA = SCHEMA("ScheduleScenario", SCENARIO_FIELDS);
+const StructSchema PID_SCHEMA = SCHEMA("Pid", PID_FIELDS);
+const StructSchema SENSOR_SCHEMA = SCHEMA("Sensor", SENSOR_FIELDS);
+const StructSchema ACTION_SCHEMA = SCHEMA("Action", ACTION_FIELDS);
+const StructSchema TEMPERATURE_SCHEMA = SCHEMA("Temperature", TEMPERATURE_FIELDS);
+const StructSchema TIMER_SCHEMA = SCHEMA("Timer", TIMER_FIELDS);
+const StructSchema DEVICE_META_SCHEMA = SCHEMA("DeviceMeta", DEVICE_META_FIELDS);
+const StructSchema DEVICE_FLAGS_SCHEMA = SCHEMA("DeviceFlags", DEVICE_FLAGS_FIELDS);
+
+namespace {
+
+  template <typename T>
+  T& at(void* base, const FieldDesc& field) {
+    return *reinterpret_cast<T*>(static_cast<uint8_t*>(base) + field.offset);
+  }
+
+  template <typename T>
+  const T& at(const void* base, const FieldDesc& field) {
+    return *reinterpret_cast<const T*>(static_cast<const uint8_t*>(base) + field.offset);
+  }
+
+  // BitArray4/7/2 store their bits in a uint8_t, BitArray12 in a uint16_t.
+  uint16_t readBits(const void* base, const FieldDesc& field) {
+    return field.size > 8 ? at<uint16_t>(base, field) : at<uint8_t>(base, field);
+  }
+
+  void writeBits(void* base, const FieldDesc& field, uint16_t bits) {
+    if (field.size > 8) at<uint16_t>(base, field) = bits;
+    else at<uint8_t>(base, field) = (uint8_t)bits;
+  }
+
+  template <typename T>
+  T clampTo(double value, const FieldDesc& field) {
+    if (value < field.minValue) value = field.minValue;
+    if (value > field.maxValue) value = field.maxValue;
+    return (T)value;
+  }
+
+  double numericValue(const void* base, const FieldDesc& field) {
+    switch (field.type) {
+      case FIELD_U8: return at<uint8_t>(base, field);
+      case FIELD_U16: return at<uint16_t>(base, field);
+      case FIELD_INT: return at<int>(base, field);
+      case FIELD_FLOAT: return at<float>(base, field);
+      case FIELD_DOUBLE: return at<double>(base, field);
+      default: return 0;
+    }
+  }
+
+  const char* textValue(const void* base, const FieldDesc& field) {
+    return field.type == FIELD_STRING ? at<PooledString>(base, field).c_str() : &at<char>(base, field);
+  }
+
+  size_t writeRaw(Print& out, const void* data, size_t size) {
+    return out.write(static_cast<const uint8_t*>(data), size);
+  }
+
+  bool readRaw(Stream& in, void* data, size_t size) {
+    return in.readBytes(static_cast<char*>(data), size) == size;
+  }
+
+  // Width of the fixed-size payload for scalar fields, 0 for everything else.
+  size_t scalarSize(const FieldDesc& field) {
+    switch (field.type) {
+      case FIELD_BOOL: return sizeof(bool);
+      case FIELD_U8: return sizeof(uint8_t);
+      case FIELD_U16: return sizeof(uint16_t);
+      case FIELD_INT: return sizeof(int);
+      case FIELD_FLOAT: return sizeof(float);
+      case FIELD_DOUBLE: return sizeof(double);
+      case FIELD_BITS: return field.size > 8 ? sizeof(uint16_t) : sizeof(uint8_t);
+      default: return 0;
+    }
+  }
+}
+
+namespace DeviceSchema {
+
+  const FieldDesc* find(const StructSchema& schema, const char* key) {
+    for (uint8_t i = 0; i < schema.count; i++) {
+      if (strcmp(schema.fields[i].name, key) == 0) return &schema.fields[i];
+    }
+    return nullptr;
+  }
+
+  void toJson(const StructSchema& schema, const void* base, JsonObject obj) {
+    for (uint8_t i = 0; i < schema.count; i++) {
+      const FieldDesc& field = schema.fields[i];
+      switch (field.type) {
+        case FIELD_BOOL: obj[field.name] = at<bool>(base, field); break;
+        case FIELD_U8: obj[field.name] = at<uint8_t>(base, field); break;
+        case FIELD_U16: obj[field.name] = at<uint16_t>(base, field); break;
+        case FIELD_INT: obj[field.name] = at<int>(base, field); break;
+        case FIELD_FLOAT: obj[field.name] = at<float>(base, field); break;
+        case FIELD_DOUBLE: obj[field.name] = at<double>(base, field); break;
+        case FIELD_CHARS:
+          obj[field.name] = textValue(base, field);
+          break;
+        case FIELD_STRING:
+          obj[field.name] = at<PooledString>(base, field).forJson();
+          break;
+        case FIELD_BITS: {
+          JsonArray bits = obj.createNestedArray(field.name);
+          uint16_t value = readBits(base, field);
+          for (uint16_t bit = 0; bit < field.size; bit++) {
+            bits.add((bool)((value >> bit) & 1));
+          }
+          break;
+        }
+        case FIELD_OBJECT:
+          toJson(*field.nested, static_cast<const uint8_t*>(base) + field.offset, obj.createNestedObject(field.name));
+          break;
+      }
+    }
+  }
+
+  bool applyField(const StructSchema& schema, void* base, const char* key, JsonVariantConst value) {
+    const FieldDesc* found = find(schema, key);
+    if (!found) return false;
+
+    const FieldDesc& field = *found;
+    switch (field.type) {
+      case FIELD_BOOL: at<bool>(base, field) = value.as<bool>(); break;
+      case FIELD_U8: at<uint8_t>(base, field) = clampTo<uint8_t>(value.as<double>(), field); break;
+      case FIELD_U16: at<uint16_t>(base, field) = clampTo<uint16_t>(value.as<double>(), field); break;
+      case FIELD_INT: at<int>(base, field) = clampTo<int>(value.as<double>(), field); break;
+      case FIELD_FLOAT: at<float>(base, field) = clampTo<float>(value.as<double>(), field); break;
+      case FIELD_DOUBLE: at<double>(base, field) = value.as<double>(); break;
+      case FIELD_CHARS: {
+        const char* text = value.as<const char*>();
+        char* dest = &at<char>(base, field);
+        strncpy(dest, text ? text : "", field.size - 1);
+        dest[field.size - 1] = '\0';
+        break;
+      }
+      case FIELD_STRING:
+        at<PooledString>(base, field).assign(value.as<const char*>(), field.size);
+        break;
+      case FIELD_BITS: {
+        uint16_t current = readBits(base, field);
+        uint16_t index = 0;
+        for (JsonVariantConst bit : value.as<JsonArrayConst>()) {
+          if (index >= field.size) break;
+          if (bit.as<bool>()) current |= (1 << index);
+          else current &= ~(1 << index);
+          index++;
+        }
+        // Merge patches address single bits as {"3": true}.
+        for (JsonPairConst kv : value.as<JsonObjectConst>()) {
+          char* end = nullptr;
+          unsigned long bit = strtoul(kv.key().c_str(), &end, 10);
+          if (*end != '\0' || bit >= field.size) continue;
+          if (kv.value().as<bool>()) current |= (1 << bit);
+          else current &= ~(1 << bit);
+        }
+        writeBits(base, field, current);
+        break;
+      }
+      case FIELD_OBJECT:
+        fromJson(*field.nested, static_cast<uint8_t*>(base) + field.offset, value.as<JsonObjectConst>());
+        break;
+    }
+    return true;
+  }
+
+  const char* validate(const StructSchema& schema, const void* base) {
+    for (uint8_t i = 0; i < schema.count; i++) {
+      const FieldDesc& field = schema.fields[i];
+      switch (field.type) {
+        case FIELD_U8:
+        case FIELD_U16:
+        case FIELD_INT:
+        case FIELD_FLOAT:
+        case FIELD_DOUBLE: {
+          double value = numericValue(base, field);
+          if (value != value || value < field.minValue || value > field.maxValue) return field.name;
+          break;
+        }
+        case FIELD_CHARS:
+          if (strnlen(textValue(base, field), field.size) >= field.size) return field.name;
+          break;
+        case FIELD_STRING:
+          if (at<PooledString>(base, field).length() >= field.size) return field.name;
+          break;
+        case FIELD_OBJECT: {
+          const char* nested = validate(*field.nested, static_cast<const uint8_t*>(base) + field.offset);
+          if (nested) return nested;
+          break;
+        }
+        default:
+          break;
+      }
+    }
+    return nullptr;
+  }
+
+  uint32_t checksum(const StructSchema& schema, const void* base, uint32_t crc) {
+    for (uint8_t i = 0; i < schema.count; i++) {
+      const FieldDesc& field = schema.fields[i];
+      size_t size = scalarSize(field);
+      if (size > 0) {
+        crc = CrcPrint::update(crc, static_cast<const uint8_t*>(base) + field.offset, size);
+      } else if (field.type == FIELD_OBJECT) {
+        crc = checksum(*field.nested, static_cast<const uint8_t*>(base) + field.offset, crc);
+      } else {
+        const char* text = textValue(base, field);
+        crc = CrcPrint::update(crc, reinterpret_cast<const uint8_t*>(text), strlen(text) + 1);
+      }
+    }
+    return crc;
+  }
+
+  uint32_t diff(const StructSchema& schema, const void* a, const void* b) {
+    uint32_t changed = 0;
+    for (uint8_t i = 0; i < schema.count && i < 32; i++) {
+      const FieldDesc& field = schema.fields[i];
+      size_t size = scalarSize(field);
+      bool differs;
+      if (size > 0) {
+        differs = memcmp(static_cast<const uint8_t*>(a) + field.offset,
+                         static_cast<const uint8_t*>(b) + field.offset, size) != 0;
+      } else if (field.type == FIELD_OBJECT) {
+        differs = diff(*field.nested, static_cast<const uint8_t*>(a) + field.offset,
+                       static_cast<const uint8_t*>(b) + field.offset) != 0;
+      } else if (field.type == FIELD_STRING) {
+        // Interned strings compare equal exactly when their handles match.
+        differs = at<PooledString>(a, field).handle() != at<PooledString>(b, field).handle();
+      } else {
+        differs = strncmp(textValue(a, field), textValue(b, field), field.size) != 0;
+      }
+      if (differs) changed |= (1UL << i);
+    }
+    return changed;
+  }
+
+  size_t writeBinary(const StructSchema& schema, const void* base, Print& out) {
+    size_t written = 0;
+    for (uint8_t i = 0; i < schema.count; i++) {
+      const FieldDesc& field = schema.fields[i];
+      size_t size = scalarSize(field);
+      if (size > 0) {
+        written += writeRaw(out, static_cast<const uint8_t*>(base) + field.offset, size);
+      } else if (field.type == FIELD_OBJECT) {
+        written += writeBinary(*field.nested, static_cast<const uint8_t*>(base) + field.offset, out);
+      } else {
+        const char* text = textValue(base, field);
+        uint16_t length = strnlen(text, field.size);
+        written += writeRaw(out, &length, sizeof(length));
+        written += writeRaw(out, text, length);
+      }
+    }
+    return written;
+  }
+
+  bool readBinary(const StructSchema& schema, void* base, Stream& in) {
+    char text[STRING_POOL_MAX_LENGTH];
+    for (uint8_t i = 0; i < schema.count; i++) {
+      const FieldDesc& field = schema.fields[i];
+      size_t size = scalarSize(field);
+      if (size > 0) {
+        if (!readRaw(in, static_cast<uint8_t*>(base) + field.offset, size)) return false;
+      } else if (field.type == FIELD_OBJECT) {
+        if (!readBinary(*field.nested, static_cast<uint8_t*>(base) + field.offset, in)) return false;
+      } else {
+        uint16_t length = 0;
+        if (!readRaw(in, &length, sizeof(length)) || length >= sizeof(text) || length >= field.size) return false;
+        if (!readRaw(in, text, length)) return false;
+        text[length] = '\0';
+        if (field.type == FIELD_STRING) at<PooledString>(base, field).assign(text, field.size);
+        else memcpy(&at<char>(base, field), text, length + 1);
+      }
+    }
+    return true;
+  }
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <stddef.h>
+#include "DeviceManager.h"
+
+enum FieldType : uint8_t {
+  FIELD_BOOL,
+  FIELD_U8,
+  FIELD_U16,
+  FIELD_INT,
+  FIELD_FLOAT,
+  FIELD_DOUBLE,
+  FIELD_CHARS,
+  FIELD_STRING,
+  FIELD_BITS,
+  FIELD_OBJECT
+};
+
+struct StructSchema;
+
+// size: capacity for FIELD_CHARS/FIELD_STRING, bit count for FIELD_BITS.
+struct FieldDesc {
+  const char* name;
+  uint16_t offset;
+  FieldType type;
+  uint16_t size;
+  float minValue;
+  float maxValue;
+  const StructSchema* nested;
+};
+
+struct StructSchema {
+  const char* name;
+  const FieldDesc* fields;
+  uint8_t count;
+};
+
+#define SCHEMA_FIELD(S, member, type, size, lo, hi) \
+  { #member, (uint16_t)offsetof(S, member), type, (uint16_t)(size), (float)(lo), (float)(hi), nullptr }
+#define SCHEMA_BOOL(S, member) SCHEMA_FIELD(S, member, FIELD_BOOL, 0, 0, 1)
+#define SCHEMA_U8(S, member, lo, hi) SCHEMA_FIELD(S, member, FIELD_U8, 0, lo, hi)
+#define SCHEMA_U16(S, member, lo, hi) SCHEMA_FIELD(S, member, FIELD_U16, 0, lo, hi)
+#define SCHEMA_INT(S, member, lo, hi) SCHEMA_FIELD(S, member, FIELD_INT, 0, lo, hi)
+#define SCHEMA_FLOAT(S, member, lo, hi) SCHEMA_FIELD(S, member, FIELD_FLOAT, 0, lo, hi)
+#define SCHEMA_DOUBLE(S, member, lo, hi) SCHEMA_FIELD(S, member, FIELD_DOUBLE, 0, lo, hi)
+#define SCHEMA_CHARS(S, member) SCHEMA_FIELD(S, member, FIELD_CHARS, sizeof(((S*)nullptr)->member), 0, 0)
+#define SCHEMA_STRING(S, member, capacity) SCHEMA_FIELD(S, member, FIELD_STRING, capacity, 0, 0)
+#define SCHEMA_BITS(S, member, bitCount) SCHEMA_FIELD(S, member, FIELD_BITS, bitCount, 0, 0)
+#define SCHEMA_OBJECT(S, member, schema) \
+  { #member, (uint16_t)offsetof(S, member), FIELD_OBJECT, 0, 0, 0, &(schema) }
+
+extern const StructSchema RELAY_SCHEMA;
+extern const StructSchema OUTPOWER_SCHEMA;
+extern const StructSchema START_END_TIME_SCHEMA;
+extern const StructSchema SCENARIO_SCHEMA;
+extern const StructSchema PID_SCHEMA;
+extern const StructSchema SENSOR_SCHEMA;
+extern const StructSchema ACTION_SCHEMA;
+extern const StructSchema TEMPERATURE_SCHEMA;
+extern const StructSchema TIMER_SCHEMA;
+extern const StructSchema DEVICE_META_SCHEMA;
+extern const StructSchema DEVICE_FLAGS_SCHEMA;
+
+template <typename T> struct SchemaOf;
+template <> struct SchemaOf<Relay> { static const StructSchema& get() { return RELAY_SCHEMA; } };
+template <> struct SchemaOf<OutPower> { static const StructSchema& get() { return OUTPOWER_SCHEMA; } };
+template <> struct SchemaOf<startEndTime> { static const StructSchema& get() { return START_END_TIME_SCHEMA; } };
+template <> struct SchemaOf<ScheduleScenario> { static const StructSchema& get() { return SCENARIO_SCHEMA; } };
+template <> struct SchemaOf<Pid> { static const StructSchema& get() { return PID_SCHEMA; } };
+template <> struct SchemaOf<Sensor> { static const StructSchema& get() { return SENSOR_SCHEMA; } };
+template <> struct SchemaOf<Action> { static const StructSchema& get() { return ACTION_SCHEMA; } };
+template <> struct SchemaOf<Temperature> { static const StructSchema& get() { return TEMPERATURE_SCHEMA; } };
+template <> struct SchemaOf<Timer> { static const StructSchema& get() { return TIMER_SCHEMA; } };
+
+namespace DeviceSchema {
+  const FieldDesc* find(const StructSchema& schema, const char* key);
+  void toJson(const StructSchema& schema, const void* base, JsonObject obj);
+  bool applyField(const StructSchema& schema, void* base, const char* key, JsonVariantConst value);
+  const char* validate(const StructSchema& schema, const void* base);
+  uint32_t checksum(const StructSchema& schema, const void* base, uint32_t crc = 0xFFFFFFFF);
+  uint32_t diff(const StructSchema& schema, const void* a, const void* b);
+  size_t writeBinary(const StructSchema& schema, const void* base, Print& out);
+  bool readBinary(const StructSchema& schema, void* base, Stream& in);
+
+  // One pass over the object: table fields are applied directly, everything
+  // else (runtime values, nested vectors) goes to the caller's handler.
+  template <typename Handler>
+  size_t fromJson(const StructSchema& schema, void* base, JsonObjectConst obj, Handler&& unknown) {
+    size_t applied = 0;
+    for (JsonPairConst kv : obj) {
+      if (applyField(schema, base, kv.key().c_str(), kv.value())) applied++;
+      else unknown(kv.key().c_str(), kv.value());
+    }
+    return applied;
+  }
+
+  inline size_t fromJson(const StructSchema& schema, void* base, JsonObjectConst obj) {
+    return fromJson(schema, base, obj, [](const char*, JsonVariantConst) {});
+  }
+
+  template <typename T>
+  void toJson(const T& value, JsonObject obj) { toJson(SchemaOf<T>::get(), &value, obj); }
+
+  template <typename T, typename Handler>
+  size_t fromJson(T& value, JsonObjectConst obj, Handler&& unknown) {
+    return fromJson(SchemaOf<T>::get(), &value, obj, unknown);
+  }
+
+  template <typename T>
+  size_t fromJson(T& value, JsonObjectConst obj) { return fromJson(SchemaOf<T>::get(), &value, obj); }
+
+  template <typename T>
+  const char* validate(const T& value) { return validate(SchemaOf<T>::get(), &value); }
+
+  template <typename T>
+  uint32_t checksum(const T& value, uint32_t crc = 0xFFFFFFFF) { return checksum(SchemaOf<T>::get(), &value, crc); }
+
+  template <typename T>
+  uint32_t diff(const T& a, const T& b) { return diff(SchemaOf<T>::get(), &a, &b); }
+
+  template <typename T>
+  size_t writeBinary(const T& value, Print& out) { return writeBinary(SchemaOf<T>::get(), &value, out); }
+
+  template <typename T>
+  bool readBinary(T& value, Stream& in) { return readBinary(SchemaOf<T>::get(), &value, in); }
+}
@@ -0,0 +1,89 @@
+#include "JsonArena.h"
+
+JsonArena* JsonArena::first = nullptr;
+
+JsonArena::JsonArena(const char* name, size_t capacity, size_t outputCapacity)
+  : name(name), doc(capacity), outputCapacity(outputCapacity) {
+  if (outputCapacity > 0) {
+    output = static_cast<char*>(PsramAllocator().allocate(outputCapacity));
+    if (output) {
+      output[0] = '\0';
+    } else {
+      this->outputCapacity = 0;
+    }
+  }
+
+  next = first;
+  first = this;
+}
+
+JsonArena::~JsonArena() {
+  for (JsonArena** link = &first; *link; link = &(*link)->next) {
+    if (*link == this) {
+      *link = next;
+      break;
+    }
+  }
+
+  if (output) {
+    PsramAllocator().deallocate(output);
+  }
+}
+
+void JsonArena::trackUsage() {
+  docPeak = max(docPeak, doc.memoryUsage());
+  if (doc.overflowed()) {
+    overflows++;
+  }
+}
+
+JsonDocument& JsonArena::acquire() {
+  if (uses > 0) {
+    trackUsage();
+  }
+
+  uses++;
+  outputLength = 0;
+  doc.clear();
+  return doc;
+}
+
+size_t JsonArena::serialize() {
+  if (!output) {
+    return 0;
+  }
+
+  size_t required = measureJson(doc);
+  if (required >= outputCapacity) {
+    Serial.printf("[JsonArena] %s: output needs %u bytes, capacity %u\n",
+                  name, (unsigned)required + 1, (unsigned)outputCapacity);
+    overflows++;
+    outputLength = 0;
+    output[0] = '\0';
+    return 0;
+  }
+
+  outputLength = serializeJson(doc, output, outputCapacity);
+  outputPeak = max(outputPeak, outputLength + 1);
+  return outputLength;
+}
+
+size_t JsonArena::highWater() const {
+  return max(docPeak, doc.memoryUsage());
+}
+
+void JsonArena::printStats() {
+  for (JsonArena* arena = first; arena; arena = arena->next) {
+    Serial.printf("[JsonArena] %s: doc %u/%u, output %u/%u, uses=%u, overflows=%u\n",
+                  arena->name, (unsigned)arena->highWater(), (unsigned)arena->capacity(),
+                  (unsigned)arena->outputPeak, (unsigned)arena->outputCapacity,
+                  arena->uses, arena->overflows);
+  }
+}
+
+void JsonArena::reportMemoryPlacement(MemoryPlacementReport& report) {
+  for (JsonArena* arena = first; arena; arena = arena->next) {
+    report.add("JSON arenas", arena->doc);
+    report.add("JSON arenas", arena->output, arena->outputCapacity);
+  }
+}
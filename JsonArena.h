@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CommonTypes.h"
+
+class JsonArena {
+public:
+  JsonArena(const char* name, size_t capacity, size_t outputCapacity = 0);
+  ~JsonArena();
+
+  JsonArena(const JsonArena&) = delete;
+  JsonArena& operator=(const JsonArena&) = delete;
+
+  JsonDocument& acquire();
+  size_t serialize();
+
+  const char* text() const { return output ? output : ""; }
+  size_t textLength() const { return outputLength; }
+
+  const char* getName() const { return name; }
+  size_t capacity() const { return doc.capacity(); }
+  size_t highWater() const;
+  size_t outputHighWater() const { return outputPeak; }
+  uint32_t getUses() const { return uses; }
+  uint32_t getOverflows() const { return overflows; }
+
+  static void printStats();
+  static void reportMemoryPlacement(MemoryPlacementReport& report);
+
+private:
+  const char* name;
+  PsramJsonDocument doc;
+  char* output = nullptr;
+  size_t outputCapacity = 0;
+  size_t outputLength = 0;
+
+  size_t docPeak = 0;
+  size_t outputPeak = 0;
+  uint32_t uses = 0;
+  uint32_t overflows = 0;
+
+  void trackUsage();
+
+  JsonArena* next = nullptr;
+  static JsonArena* first;
+};
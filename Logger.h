@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "CommonTypes.h"
+#include "Persistence.h"
 
 constexpr uint8_t MAX_LOG_MESSAGES = 50;
 constexpr size_t MAX_MESSAGE_LENGTH = 128;
@@ -27,6 +28,7 @@ struct LogEntry {
 class Logger {
 private:
 
+    Persistence& persistence;
     LogEntry* logList = nullptr;
 
     uint8_t currentIndex = 0;
@@ -53,6 +55,7 @@ private:
 
     uint8_t _unsentCount = 0;
     uint8_t _sentSinceLastSave = 0;
+    uint32_t _droppedCount = 0;
     static constexpr uint8_t SAVE_TRIGGER_COUNT = 10;
 
     void initMemory() {
@@ -85,7 +88,7 @@ private:
 
 public:
 
-    Logger() {
+    Logger(Persistence& persistence) : persistence(persistence) {
         initMemory();
     }
 
@@ -99,6 +102,8 @@ public:
 
     uint8_t getUnsentCount() const { return _unsentCount; }
     uint8_t getSentSinceLastSave() const { return _sentSinceLastSave; }
+    // Entries overwritten in the ring before they were delivered.
+    uint32_t getDroppedCount() const { return _droppedCount; }
     bool isPsramUsed() const { return _isPsramUsed; }
 
     void forceSave() {
@@ -130,10 +135,12 @@ public:
 
     void addLog(const String& message, uint8_t typeMsg = LOG_INFO) {
         if (!_loggingEnabled || !logList) return;
+        MemScope memScope(MEM_TAG_LOGGER);
 
         if (logCount >= MAX_LOG_MESSAGES) {
             if (!logList[currentIndex].isSay) {
                 _unsentCount--;
+                _droppedCount++;
             }
         }
 
@@ -225,64 +232,62 @@ public:
 
     void saveLogsToSPIFFS() {
         if (!logList) return;
+        MemScope memScope(MEM_TAG_LOGGER);
 
         const char* filename = "/log.txt";
-        const char* tempFilename = "/log.tmp";
-
-        File originalFile = SPIFFS.open(filename, FILE_READ);
-        File tempFile = SPIFFS.open(tempFilename, FILE_WRITE);
-        if (!originalFile || !tempFile) {
-            Serial.println("Ошибка открытия файлов для ротации");
-            if (originalFile) originalFile.close();
-            if (tempFile) tempFile.close();
-            return;
-        }
 
         std::vector<String> oldLines;
-        while (originalFile.available()) {
-            String line = originalFile.readStringUntil('\n');
-            line.trim();
-            if (line.length() > 0) {
-                oldLines.push_back(line);
+        PersistedFile originalFile;
+        if (persistence.openRead(filename, originalFile)) {
+            while (originalFile.available()) {
+                String line = originalFile.readStringUntil('\n');
+                line.trim();
+                if (line.length() > 0) {
+                    oldLines.push_back(line);
+                }
+                  yield();
             }
-              yield();
+            originalFile.close();
         }
-        originalFile.close();
 
-        int linesToKeep = MAX_FILE_LOG_LINES - logCount;
-        if (linesToKeep > 0 && oldLines.size() > 0) {
-            auto start_it = oldLines.end() - min(linesToKeep, (int)oldLines.size());
-            for (auto it = start_it; it != oldLines.end(); ++it) {
-                tempFile.println(*it);
+        bool saved = persistence.writeNow(filename, [this, &oldLines](Print& out) {
+            int linesToKeep = MAX_FILE_LOG_LINES - logCount;
+            if (linesToKeep > 0 && oldLines.size() > 0) {
+                auto start_it = oldLines.end() - min(linesToKeep, (int)oldLines.size());
+                for (auto it = start_it; it != oldLines.end(); ++it) {
+                    out.println(*it);
+                }
             }
-        }
 
-        if (oldLines.size() >= MAX_FILE_LOG_LINES) {
-            tempFile.println("[]==================[]=================[]\n");
-        }
+            if (oldLines.size() >= MAX_FILE_LOG_LINES) {
+                out.println("[]==================[]=================[]\n");
+            }
 
-        uint8_t startIdx = (logCount < MAX_LOG_MESSAGES) ? 0 : currentIndex;
-        for (size_t i = 0; i < logCount; ++i) {
-            uint8_t idx = (startIdx + i) % MAX_LOG_MESSAGES;
+            uint8_t startIdx = (logCount < MAX_LOG_MESSAGES) ? 0 : currentIndex;
+            for (size_t i = 0; i < logCount; ++i) {
+                uint8_t idx = (startIdx + i) % MAX_LOG_MESSAGES;
+
+                char logBuffer[MAX_MESSAGE_LENGTH + MAX_TIMESTAMP_LENGTH + 10];
+                snprintf(logBuffer, sizeof(logBuffer), "%s;%c;%d;%s",
+                         logList[idx].timestamp,
+                         logList[idx].isSay ? '1' : '0',
+                         logList[idx].typeMsg,
+                         logList[idx].message);
+                out.println(logBuffer);
+
+               if (i % 20 == 0) {
+                yield();
+                delay(1);
+              }
+            }
+            return true;
+        });
 
-            char logBuffer[MAX_MESSAGE_LENGTH + MAX_TIMESTAMP_LENGTH + 10];
-            snprintf(logBuffer, sizeof(logBuffer), "%s;%c;%d;%s",
-                     logList[idx].timestamp,
-                     logList[idx].isSay ? '1' : '0',
-                     logList[idx].typeMsg,
-                     logList[idx].message);
-            tempFile.println(logBuffer);
-
-           if (i % 20 == 0) {
-            yield();
-            delay(1);
-          }
+        if (!saved) {
+            Serial.println("Ошибка открытия файлов для ротации");
+            return;
         }
 
-        tempFile.close();
-        SPIFFS.remove(filename);
-        SPIFFS.rename(tempFilename, filename);
-
         _sentSinceLastSave = 0;
 
         #ifdef LOGGER_DEBUG
@@ -295,13 +300,13 @@ public:
 
         const char* filename = "/log.txt";
 
-        if (!SPIFFS.exists(filename)) {
+        if (!persistence.exists(filename)) {
             Serial.println("Файл лога не найден.");
             return;
         }
 
-        File file = SPIFFS.open(filename, FILE_READ);
-        if (!file) {
+        PersistedFile file;
+        if (!persistence.openRead(filename, file)) {
             Serial.println("Ошибка открытия файла лога для чтения.");
             return;
         }
@@ -353,9 +358,13 @@ public:
 
     uint8_t getLogCount() const { return logCount; }
 
+    void reportMemoryPlacement(MemoryPlacementReport& report) const {
+        report.add("Logger", logList, logList ? sizeof(LogEntry) * MAX_LOG_MESSAGES : 0);
+    }
+
     String getAllLogsJSON() const {
 
-        StaticJsonDocument<8192> jsonDoc;
+        PsramJsonDocument jsonDoc(8192);
         JsonArray logsArray = jsonDoc.to<JsonArray>();
 
         if (logCount == 0 || !logList) {
@@ -404,12 +413,9 @@ public:
         _sentSinceLastSave = 0;
 
         const char* filename = "/log.txt";
-        File file = SPIFFS.open(filename, FILE_WRITE);
-        if (!file) {
+        if (!persistence.writeNow(filename, [](Print&) { return true; })) {
             Serial.println("Не удалось открыть файл лога для очистки.");
-            return;
         }
-        file.close();
     }
 
     std::vector<LogEntry*> getLogsByType(uint8_t type, uint8_t maxCount = 10) {
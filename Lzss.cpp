@@ -0,0 +1,188 @@
+#include "Lzss.h"
+#include "CommonTypes.h"
+
+LzssEncoder::LzssEncoder() {
+  window = static_cast<uint8_t*>(PsramAllocator().allocate(2 * LZSS_WINDOW_SIZE));
+  head = static_cast<uint16_t*>(PsramAllocator().allocate((1 << LZSS_HASH_BITS) * sizeof(uint16_t)));
+  prev = static_cast<uint16_t*>(PsramAllocator().allocate(2 * LZSS_WINDOW_SIZE * sizeof(uint16_t)));
+  if (head) {
+    memset(head, 0xFF, (1 << LZSS_HASH_BITS) * sizeof(uint16_t));
+  }
+}
+
+LzssEncoder::~LzssEncoder() {
+  PsramAllocator().deallocate(window);
+  PsramAllocator().deallocate(head);
+  PsramAllocator().deallocate(prev);
+}
+
+uint16_t LzssEncoder::hashAt(size_t pos) const {
+  uint32_t value = (window[pos] << 16) | (window[pos + 1] << 8) | window[pos + 2];
+  return (uint32_t)(value * 2654435761u) >> (32 - LZSS_HASH_BITS);
+}
+
+void LzssEncoder::insert(size_t pos) {
+  if (pos + LZSS_MIN_MATCH > end) return;
+
+  uint16_t hash = hashAt(pos);
+  prev[pos] = head[hash];
+  head[hash] = pos;
+}
+
+void LzssEncoder::slide() {
+  memmove(window, window + LZSS_WINDOW_SIZE, LZSS_WINDOW_SIZE);
+  start -= LZSS_WINDOW_SIZE;
+  end -= LZSS_WINDOW_SIZE;
+
+  for (size_t i = 0; i < (1 << LZSS_HASH_BITS); i++) {
+    head[i] = head[i] != NIL && head[i] >= LZSS_WINDOW_SIZE ? head[i] - LZSS_WINDOW_SIZE : NIL;
+  }
+  for (size_t i = 0; i < LZSS_WINDOW_SIZE; i++) {
+    uint16_t link = prev[i + LZSS_WINDOW_SIZE];
+    prev[i] = link != NIL && link >= LZSS_WINDOW_SIZE ? link - LZSS_WINDOW_SIZE : NIL;
+  }
+}
+
+size_t LzssEncoder::sink(const uint8_t* data, size_t length) {
+  if (finishing || !isValid()) return 0;
+
+  if (end == 2 * LZSS_WINDOW_SIZE) {
+    if (start < LZSS_WINDOW_SIZE) return 0;
+    slide();
+  }
+
+  size_t taken = min(length, 2 * LZSS_WINDOW_SIZE - end);
+  memcpy(window + end, data, taken);
+  end += taken;
+  return taken;
+}
+
+void LzssEncoder::encodeOne() {
+  size_t available = end - start;
+  size_t limit = min(available, (size_t)LZSS_MAX_MATCH);
+  size_t bestLength = 0;
+  size_t bestDistance = 0;
+
+  if (available >= LZSS_MIN_MATCH) {
+    uint16_t candidate = head[hashAt(start)];
+    for (uint8_t chain = 0; candidate != NIL && chain < LZSS_MAX_CHAIN; chain++) {
+      size_t distance = start - candidate;
+      if (distance > LZSS_WINDOW_SIZE) break;
+
+      size_t length = 0;
+      while (length < limit && window[candidate + length] == window[start + length]) {
+        length++;
+      }
+      if (length > bestLength) {
+        bestLength = length;
+        bestDistance = distance;
+        if (length == limit) break;
+      }
+      candidate = prev[candidate];
+    }
+  }
+
+  if (bestLength >= LZSS_MIN_MATCH) {
+    uint16_t token = ((bestDistance - 1) << LZSS_LENGTH_BITS) | (bestLength - LZSS_MIN_MATCH);
+    group[groupLength++] = token >> 8;
+    group[groupLength++] = token & 0xFF;
+  } else {
+    bestLength = 1;
+    group[0] |= 1 << groupItems;
+    group[groupLength++] = window[start];
+  }
+
+  for (size_t i = 0; i < bestLength; i++) {
+    insert(start + i);
+  }
+  start += bestLength;
+
+  if (++groupItems == 8) {
+    closeGroup();
+  }
+}
+
+void LzssEncoder::closeGroup() {
+  groupReady = true;
+  groupSent = 0;
+}
+
+size_t LzssEncoder::poll(uint8_t* out, size_t maxLength) {
+  if (!isValid()) return 0;
+
+  size_t produced = 0;
+  while (produced < maxLength) {
+    if (groupReady) {
+      size_t chunk = min((size_t)(groupLength - groupSent), maxLength - produced);
+      memcpy(out + produced, group + groupSent, chunk);
+      groupSent += chunk;
+      produced += chunk;
+
+      if (groupSent == groupLength) {
+        groupReady = false;
+        group[0] = 0;
+        groupLength = 1;
+        groupItems = 0;
+      }
+      continue;
+    }
+
+    if (start < end && (finishing || end - start >= LZSS_MAX_MATCH)) {
+      encodeOne();
+    } else if (finishing && groupItems > 0) {
+      closeGroup();
+    } else {
+      break;
+    }
+  }
+  return produced;
+}
+
+LzssDecoder::LzssDecoder(Print& out) : out(out) {
+  window = static_cast<uint8_t*>(PsramAllocator().allocate(LZSS_WINDOW_SIZE));
+}
+
+LzssDecoder::~LzssDecoder() {
+  PsramAllocator().deallocate(window);
+}
+
+bool LzssDecoder::put(uint8_t value) {
+  window[produced++ & (LZSS_WINDOW_SIZE - 1)] = value;
+  return out.write(value) == 1;
+}
+
+bool LzssDecoder::write(const uint8_t* data, size_t length) {
+  if (!isValid()) return false;
+
+  for (size_t i = 0; i < length; i++) {
+    uint8_t value = data[i];
+
+    if (flagBits == 0) {
+      flags = value;
+      flagBits = 8;
+      continue;
+    }
+
+    if (flags & 1) {
+      if (!put(value)) return false;
+    } else if (pendingHigh < 0) {
+      pendingHigh = value;
+      continue;
+    } else {
+      uint16_t token = (pendingHigh << 8) | value;
+      pendingHigh = -1;
+
+      uint32_t distance = (token >> LZSS_LENGTH_BITS) + 1;
+      uint8_t count = (token & ((1 << LZSS_LENGTH_BITS) - 1)) + LZSS_MIN_MATCH;
+      if (distance > produced) return false;
+
+      for (uint8_t n = 0; n < count; n++) {
+        if (!put(window[(produced - distance) & (LZSS_WINDOW_SIZE - 1)])) return false;
+      }
+    }
+
+    flags >>= 1;
+    flagBits--;
+  }
+  return true;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Byte-aligned LZSS: a flag byte (LSB first, 1 = literal) precedes up to eight
+// items. A match is two bytes, big-endian ((distance - 1) << 5 | (length - 3)).
+// Both sides stream: the encoder works on a 2 * window buffer, the decoder on
+// a window-sized ring. tools/config_bundle.py implements the same format.
+#define LZSS_WINDOW_BITS 11
+#define LZSS_LENGTH_BITS 5
+#define LZSS_WINDOW_SIZE (1 << LZSS_WINDOW_BITS)
+#define LZSS_MIN_MATCH 3
+#define LZSS_MAX_MATCH (LZSS_MIN_MATCH + (1 << LZSS_LENGTH_BITS) - 1)
+#define LZSS_HASH_BITS 10
+#define LZSS_MAX_CHAIN 32
+
+class LzssEncoder {
+public:
+  LzssEncoder();
+  ~LzssEncoder();
+
+  LzssEncoder(const LzssEncoder&) = delete;
+  LzssEncoder& operator=(const LzssEncoder&) = delete;
+
+  // Returns how many bytes were taken; 0 means poll() must drain first.
+  size_t sink(const uint8_t* data, size_t length);
+  size_t poll(uint8_t* out, size_t maxLength);
+  void finish() { finishing = true; }
+  bool isFinished() const { return finishing && start == end && !groupReady && groupItems == 0; }
+  bool isValid() const { return window && head && prev; }
+
+private:
+  static constexpr uint16_t NIL = 0xFFFF;
+
+  uint8_t* window = nullptr;
+  uint16_t* head = nullptr;
+  uint16_t* prev = nullptr;
+  size_t start = 0;
+  size_t end = 0;
+  bool finishing = false;
+
+  uint8_t group[1 + 2 * 8] = {0};
+  uint8_t groupLength = 1;
+  uint8_t groupItems = 0;
+  uint8_t groupSent = 0;
+  bool groupReady = false;
+
+  uint16_t hashAt(size_t pos) const;
+  void insert(size_t pos);
+  void slide();
+  void encodeOne();
+  void closeGroup();
+};
+
+class LzssDecoder {
+public:
+  explicit LzssDecoder(Print& out);
+  ~LzssDecoder();
+
+  LzssDecoder(const LzssDecoder&) = delete;
+  LzssDecoder& operator=(const LzssDecoder&) = delete;
+
+  bool write(const uint8_t* data, size_t length);
+  bool isValid() const { return window != nullptr; }
+
+private:
+  Print& out;
+  uint8_t* window = nullptr;
+  uint32_t produced = 0;
+  uint8_t flags = 0;
+  uint8_t flagBits = 0;
+  int16_t pendingHigh = -1;
+
+  bool put(uint8_t value);
+};
@@ -0,0 +1,240 @@
+#include "MemTrack.h"
+
+#ifdef ESP32
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+
+volatile MemTag MemTrack::currentTag = MEM_TAG_SYSTEM;
+MemTrack::TagStats MemTrack::tagStats[MEM_TAG_COUNT] = {};
+MemTrack::LoopStats MemTrack::loop_ = {};
+MemTrack::HeapSample MemTrack::history[MEM_HISTORY_SIZE] = {};
+uint8_t MemTrack::historyHead = 0;
+uint8_t MemTrack::historyCount = 0;
+uint32_t MemTrack::lastSample = 0;
+uint32_t MemTrack::lastHistory = 0;
+void* MemTrack::ownerTask = nullptr;
+
+MemScope* MemScope::top = nullptr;
+
+// The allocation counters are updated from every task that uses PsramAllocator.
+#ifdef ESP32
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+#define STATS_LOCK() portENTER_CRITICAL(&statsMux)
+#define STATS_UNLOCK() portEXIT_CRITICAL(&statsMux)
+#else
+#define STATS_LOCK()
+#define STATS_UNLOCK()
+#endif
+
+static const char* const TAG_NAMES[MEM_TAG_COUNT] = {
+  "system", "web", "telegram", "control", "logger", "ota", "wifi", "async"
+};
+
+const char* MemTrack::tagName(MemTag tag) {
+  return tag < MEM_TAG_COUNT ? TAG_NAMES[tag] : "?";
+}
+
+void MemTrack::recordAlloc(MemTag tag, size_t bytes) {
+  STATS_LOCK();
+  TagStats& entry = tagStats[tag];
+  entry.allocations++;
+  entry.currentBytes += bytes;
+  if (entry.currentBytes > (int32_t)entry.peakBytes) {
+    entry.peakBytes = entry.currentBytes;
+  }
+  STATS_UNLOCK();
+}
+
+void MemTrack::recordFree(MemTag tag, size_t bytes) {
+  STATS_LOCK();
+  TagStats& entry = tagStats[tag];
+  entry.frees++;
+  entry.currentBytes -= bytes;
+  STATS_UNLOCK();
+}
+
+void MemTrack::recordResize(MemTag tag, size_t oldBytes, size_t newBytes) {
+  STATS_LOCK();
+  TagStats& entry = tagStats[tag];
+  entry.allocations++;
+  entry.currentBytes += (int32_t)newBytes - (int32_t)oldBytes;
+  if (entry.currentBytes > (int32_t)entry.peakBytes) {
+    entry.peakBytes = entry.currentBytes;
+  }
+  STATS_UNLOCK();
+}
+
+uint32_t MemTrack::totalAllocations() {
+  uint32_t total = 0;
+  STATS_LOCK();
+  for (const auto& entry : tagStats) {
+    total += entry.allocations;
+  }
+  STATS_UNLOCK();
+  return total;
+}
+
+void MemTrack::recordStage(MemTag tag, uint32_t micros) {
+  TagStats& entry = tagStats[tag];
+  entry.stageMicros += micros;
+  entry.stageRuns++;
+  if (micros > entry.stageMaxMicros) {
+    entry.stageMaxMicros = micros;
+  }
+}
+
+void MemTrack::recordLoop(uint32_t micros) {
+  loop_.micros += micros;
+  loop_.runs++;
+  if (micros > loop_.maxMicros) {
+    loop_.maxMicros = micros;
+  }
+}
+
+uint32_t MemTrack::freeHeap() {
+#ifdef ESP32
+  return heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
+  return 0;
+#endif
+}
+
+uint32_t MemTrack::largestFreeBlock() {
+#ifdef ESP32
+  return heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
+  return 0;
+#endif
+}
+
+uint8_t MemTrack::fragmentation() {
+  uint32_t freeBytes = freeHeap();
+  if (freeBytes == 0) return 0;
+  return 100 - (uint8_t)((uint64_t)largestFreeBlock() * 100 / freeBytes);
+}
+
+bool MemTrack::onOwnerTask() {
+#ifdef ESP32
+  return ownerTask && xTaskGetCurrentTaskHandle() == ownerTask;
+#else
+  return true;
+#endif
+}
+
+void MemTrack::loop() {
+#ifdef ESP32
+  if (!ownerTask) ownerTask = xTaskGetCurrentTaskHandle();
+#endif
+
+  uint32_t now = millis();
+  if (now - lastSample < MEM_SAMPLE_INTERVAL_MS) return;
+
+  uint32_t elapsed = now - lastSample;
+  lastSample = now;
+  STATS_LOCK();
+  for (auto& entry : tagStats) {
+    entry.allocationsPerSecond = (entry.allocations - entry.lastAllocations) * 1000UL / elapsed;
+    entry.lastAllocations = entry.allocations;
+  }
+  STATS_UNLOCK();
+
+  if (historyCount > 0 && now - lastHistory < MEM_HISTORY_INTERVAL_MS) return;
+  lastHistory = now;
+
+  HeapSample& sample = history[historyHead];
+  sample.uptimeSeconds = now / 1000;
+  sample.freeBytes = freeHeap();
+  sample.largestBlock = largestFreeBlock();
+  sample.fragmentation = fragmentation();
+  historyHead = (historyHead + 1) % MEM_HISTORY_SIZE;
+  if (historyCount < MEM_HISTORY_SIZE) historyCount++;
+}
+
+size_t MemTrack::format(char* buffer, size_t bufferSize) {
+  size_t offset = snprintf(buffer, bufferSize,
+                           "Heap: free %u, largest %u, frag %u%%\n"
+                           "%-9s %8s %8s %6s %8s\n",
+                           (unsigned)freeHeap(), (unsigned)largestFreeBlock(), (unsigned)fragmentation(),
+                           "Tag", "Current", "Peak", "Alloc/s", "HeapNet");
+
+  for (uint8_t i = 0; i < MEM_TAG_COUNT && offset < bufferSize; i++) {
+    const TagStats& entry = tagStats[i];
+    offset += snprintf(buffer + offset, bufferSize - offset, "%-9s %8d %8u %6u %8d\n",
+                       TAG_NAMES[i], (int)entry.currentBytes, (unsigned)entry.peakBytes,
+                       (unsigned)entry.allocationsPerSecond, (int)entry.heapDelta);
+  }
+
+  if (historyCount > 0 && offset < bufferSize) {
+    offset += snprintf(buffer + offset, bufferSize - offset, "Free/frag, last %u samples:\n", historyCount);
+    for (uint8_t i = 0; i < historyCount && offset < bufferSize; i++) {
+      const HeapSample& sample = history[(historyHead + MEM_HISTORY_SIZE - historyCount + i) % MEM_HISTORY_SIZE];
+      offset += snprintf(buffer + offset, bufferSize - offset, "%lus %u/%u%%%s",
+                         (unsigned long)sample.uptimeSeconds, (unsigned)sample.freeBytes,
+                         (unsigned)sample.fragmentation, i + 1 < historyCount ? ", " : "\n");
+    }
+  }
+
+  return offset < bufferSize ? offset : bufferSize - 1;
+}
+
+void MemTrack::toJson(JsonObject obj) {
+  obj["free"] = freeHeap();
+  obj["largest"] = largestFreeBlock();
+  obj["frag"] = fragmentation();
+
+  JsonArray tags = obj.createNestedArray("tags");
+  for (uint8_t i = 0; i < MEM_TAG_COUNT; i++) {
+    const TagStats& entry = tagStats[i];
+    JsonObject tagObj = tags.createNestedObject();
+    tagObj["tag"] = TAG_NAMES[i];
+    tagObj["current"] = entry.currentBytes;
+    tagObj["peak"] = entry.peakBytes;
+    tagObj["allocs"] = entry.allocations;
+    tagObj["rate"] = entry.allocationsPerSecond;
+    tagObj["heap"] = entry.heapDelta;
+  }
+
+  JsonArray samples = obj.createNestedArray("history");
+  for (uint8_t i = 0; i < historyCount; i++) {
+    const HeapSample& sample = history[(historyHead + MEM_HISTORY_SIZE - historyCount + i) % MEM_HISTORY_SIZE];
+    JsonArray point = samples.createNestedArray();
+    point.add(sample.uptimeSeconds);
+    point.add(sample.freeBytes);
+    point.add(sample.largestBlock);
+    point.add(sample.fragmentation);
+  }
+}
+
+void MemTrack::print() {
+  char buffer[1024];
+  format(buffer, sizeof(buffer));
+  Serial.print("[MemTrack]\n");
+  Serial.print(buffer);
+}
+
+MemScope::MemScope(MemTag tag)
+  : active(MemTrack::onOwnerTask()), tag(tag), previousTag(MemTrack::currentTag), parent(top), freeAtEntry(0) {
+  if (!active) return;
+
+  freeAtEntry = MemTrack::freeHeap();
+  startMicros = micros();
+  top = this;
+  MemTrack::currentTag = tag;
+}
+
+MemScope::~MemScope() {
+  if (!active) return;
+
+  int32_t delta = (int32_t)freeAtEntry - (int32_t)MemTrack::freeHeap();
+  MemTrack::chargeHeap(tag, delta - childDelta);
+  if (parent) {
+    parent->childDelta += delta;
+  } else {
+    MemTrack::recordStage(tag, micros() - startMicros);
+  }
+
+  top = parent;
+  MemTrack::currentTag = previousTag;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#define MEM_HISTORY_SIZE 30
+#define MEM_SAMPLE_INTERVAL_MS 1000
+#define MEM_HISTORY_INTERVAL_MS 10000
+
+enum MemTag : uint8_t {
+  MEM_TAG_SYSTEM,
+  MEM_TAG_WEB,
+  MEM_TAG_TELEGRAM,
+  MEM_TAG_CONTROL,
+  MEM_TAG_LOGGER,
+  MEM_TAG_OTA,
+  MEM_TAG_WIFI,
+  MEM_TAG_ASYNC,
+  MEM_TAG_COUNT
+};
+
+// Allocations made through PsramAllocator on the main task are charged exactly
+// to the tag that was active when they were made; those from other tasks
+// (async_tcp: WebSocket frames, chunked responses) all go to MEM_TAG_ASYNC.
+// Everything else (String, library buffers) is charged as the net internal
+// heap change observed while a MemScope was open. Scopes only take effect on
+// the task that runs MemTrack::loop(); elsewhere they are no-ops so the scope
+// stack is never shared between tasks.
+class MemTrack {
+public:
+  struct TagStats {
+    int32_t currentBytes;
+    uint32_t peakBytes;
+    uint32_t allocations;
+    uint32_t frees;
+    uint32_t allocationsPerSecond;
+    int32_t heapDelta;
+    uint32_t lastAllocations;
+    uint64_t stageMicros;
+    uint32_t stageRuns;
+    uint32_t stageMaxMicros;
+  };
+
+  struct LoopStats {
+    uint64_t micros;
+    uint32_t runs;
+    uint32_t maxMicros;
+  };
+
+  struct HeapSample {
+    uint32_t uptimeSeconds;
+    uint32_t freeBytes;
+    uint32_t largestBlock;
+    uint8_t fragmentation;
+  };
+
+  static MemTag current() { return onMainTask() ? currentTag : MEM_TAG_ASYNC; }
+  static const char* tagName(MemTag tag);
+
+  static void recordAlloc(MemTag tag, size_t bytes);
+  static void recordFree(MemTag tag, size_t bytes);
+  static void recordResize(MemTag tag, size_t oldBytes, size_t newBytes);
+
+  static void loop();
+  static const TagStats& stats(MemTag tag) { return tagStats[tag]; }
+  static uint32_t totalAllocations();
+
+  // Time spent in outermost scopes, i.e. the loop() stages.
+  static void recordStage(MemTag tag, uint32_t micros);
+  static void recordLoop(uint32_t micros);
+  static const LoopStats& loopStats() { return loop_; }
+
+  // True on the task that runs loop(), and anywhere before loop() first ran.
+  static bool onMainTask() { return !ownerTask || onOwnerTask(); }
+
+  static uint32_t freeHeap();
+  static uint32_t largestFreeBlock();
+  static uint8_t fragmentation();
+
+  static size_t format(char* buffer, size_t bufferSize);
+  static void toJson(JsonObject obj);
+  static void print();
+
+private:
+  friend class MemScope;
+
+  static volatile MemTag currentTag;
+  static TagStats tagStats[MEM_TAG_COUNT];
+  static LoopStats loop_;
+  static HeapSample history[MEM_HISTORY_SIZE];
+  static uint8_t historyHead;
+  static uint8_t historyCount;
+  static uint32_t lastSample;
+  static uint32_t lastHistory;
+  static void* ownerTask;
+
+  static bool onOwnerTask();
+
+  static void chargeHeap(MemTag tag, int32_t bytes) { tagStats[tag].heapDelta += bytes; }
+};
+
+class MemScope {
+public:
+  explicit MemScope(MemTag tag);
+  ~MemScope();
+
+  MemScope(const MemScope&) = delete;
+  MemScope& operator=(const MemScope&) = delete;
+
+private:
+  bool active;
+  MemTag tag;
+  MemTag previousTag;
+  MemScope* parent;
+  uint32_t freeAtEntry;
+  uint32_t startMicros = 0;
+  int32_t childDelta = 0;
+
+  static MemScope* top;
+};
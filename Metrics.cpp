@@ -0,0 +1,245 @@
+#include "Metrics.h"
+#include "MemTrack.h"
+#include <SPIFFS.h>
+#include <stdarg.h>
+
+Metrics::Metrics(DeviceManager& deviceManager, WiFiManager& wifiManager, WebServer& webServer,
+                 TelegramBot& telegramBot, Logger& logger)
+    : deviceManager(deviceManager), wifiManager(wifiManager), webServer(webServer),
+      telegramBot(telegramBot), logger(logger) {}
+
+void Metrics::serve(AsyncWebServerRequest* request) {
+  if (streaming || buffer.use_count() > 1) {
+    request->send(503, "text/plain", "scrape in progress\n");
+    return;
+  }
+
+  if (!buffer) {
+    MemScope scope(MEM_TAG_WEB);
+    char* memory = static_cast<char*>(PsramAllocator().allocate(METRICS_BUFFER_BYTES));
+    if (memory) {
+      buffer.reset(memory, [](char* p) { PsramAllocator().deallocate(p); });
+    }
+  }
+  if (!buffer) {
+    request->send(503, "text/plain", "no metrics buffer\n");
+    return;
+  }
+
+  render();
+  if (overflow) {
+    Serial.printf("Metrics: буфер %u байт переполнен, вывод обрезан\n", METRICS_BUFFER_BYTES);
+  }
+
+  streaming = true;
+  size_t total = length;
+  std::shared_ptr<char> page = buffer;
+
+  // A scraper that goes away mid-response never pulls the last chunk.
+  request->onDisconnect([this]() { streaming = false; });
+
+  AsyncWebServerResponse* response = request->beginChunkedResponse("text/plain; version=0.0.4; charset=utf-8",
+  [this, page, total](uint8_t* out, size_t maxLength, size_t index) -> size_t {
+    if (index >= total) {
+      streaming = false;
+      return 0;
+    }
+    size_t chunk = min(maxLength, total - index);
+    memcpy(out, page.get() + index, chunk);
+    return chunk;
+  });
+  request->send(response);
+}
+
+void Metrics::render() {
+  length = 0;
+  overflow = false;
+  buffer.get()[0] = '\0';
+
+  renderSystem();
+  renderLoop();
+  renderDevice();
+  renderTransport();
+}
+
+void Metrics::renderSystem() {
+  family("esp_heap_free_bytes", "gauge", "Free internal heap.");
+  append("esp_heap_free_bytes %u\n", ESP.getFreeHeap());
+  family("esp_heap_min_free_bytes", "gauge", "Lowest free internal heap since boot.");
+  append("esp_heap_min_free_bytes %u\n", ESP.getMinFreeHeap());
+  family("esp_heap_largest_block_bytes", "gauge", "Largest allocatable internal heap block.");
+  append("esp_heap_largest_block_bytes %u\n", ESP.getMaxAllocHeap());
+
+  family("esp_psram_size_bytes", "gauge", "PSRAM size.");
+  append("esp_psram_size_bytes %u\n", ESP.getPsramSize());
+  family("esp_psram_free_bytes", "gauge", "Free PSRAM.");
+  append("esp_psram_free_bytes %u\n", ESP.getFreePsram());
+
+  family("esp_spiffs_total_bytes", "gauge", "SPIFFS capacity.");
+  append("esp_spiffs_total_bytes %u\n", (unsigned)SPIFFS.totalBytes());
+  family("esp_spiffs_used_bytes", "gauge", "SPIFFS space in use.");
+  append("esp_spiffs_used_bytes %u\n", (unsigned)SPIFFS.usedBytes());
+
+  family("esp_uptime_seconds", "counter", "Seconds since boot.");
+  append("esp_uptime_seconds %lu\n", millis() / 1000);
+
+  bool connected = WiFi.isConnected();
+  family("esp_wifi_connected", "gauge", "1 while the station is connected.");
+  append("esp_wifi_connected %d\n", connected ? 1 : 0);
+  if (connected) {
+    family("esp_wifi_rssi_dbm", "gauge", "Station RSSI.");
+    append("esp_wifi_rssi_dbm %d\n", WiFi.RSSI());
+  }
+  family("esp_wifi_disconnects_total", "counter", "Station disconnect events.");
+  append("esp_wifi_disconnects_total %u\n", wifiManager.getDisconnects());
+  family("esp_wifi_reconnect_attempts_total", "counter", "Reconnect attempts made by WiFiManager.");
+  append("esp_wifi_reconnect_attempts_total %u\n", wifiManager.getReconnectAttempts());
+}
+
+void Metrics::renderLoop() {
+  const MemTrack::LoopStats& loop = MemTrack::loopStats();
+  family("esp_loop_seconds_total", "counter", "Time spent in loop().");
+  append("esp_loop_seconds_total %.6f\n", loop.micros / 1e6);
+  family("esp_loop_runs_total", "counter", "loop() iterations.");
+  append("esp_loop_runs_total %u\n", loop.runs);
+  family("esp_loop_max_seconds", "gauge", "Longest loop() iteration since boot.");
+  append("esp_loop_max_seconds %.6f\n", loop.maxMicros / 1e6);
+
+  family("esp_loop_stage_seconds_total", "counter", "Time spent in each loop() stage.");
+  for (uint8_t tag = 0; tag < MEM_TAG_COUNT; tag++) {
+    const MemTrack::TagStats& stats = MemTrack::stats((MemTag)tag);
+    if (stats.stageRuns == 0) continue;
+    append("esp_loop_stage_seconds_total{stage=\"%s\"} %.6f\n", MemTrack::tagName((MemTag)tag), stats.stageMicros / 1e6);
+  }
+  family("esp_loop_stage_runs_total", "counter", "Runs of each loop() stage.");
+  for (uint8_t tag = 0; tag < MEM_TAG_COUNT; tag++) {
+    const MemTrack::TagStats& stats = MemTrack::stats((MemTag)tag);
+    if (stats.stageRuns == 0) continue;
+    append("esp_loop_stage_runs_total{stage=\"%s\"} %u\n", MemTrack::tagName((MemTag)tag), stats.stageRuns);
+  }
+  family("esp_loop_stage_max_seconds", "gauge", "Longest run of each loop() stage since boot.");
+  for (uint8_t tag = 0; tag < MEM_TAG_COUNT; tag++) {
+    const MemTrack::TagStats& stats = MemTrack::stats((MemTag)tag);
+    if (stats.stageRuns == 0) continue;
+    append("esp_loop_stage_max_seconds{stage=\"%s\"} %.6f\n", MemTrack::tagName((MemTag)tag), stats.stageMaxMicros / 1e6);
+  }
+}
+
+void Metrics::renderDevice() {
+  const Device* current = deviceManager.currentDevice();
+  if (!current) {
+    return;
+  }
+
+  const Device& device = *current;
+  const DeviceRuntime& runtime = device.runtime;
+
+  family("esp_relay_state", "gauge", "Output relay state, 1 = on.");
+  for (const auto& relay : device.relays) {
+    if (!relay.isOutput) continue;
+    append("esp_relay_state{relay=\"%d\",name=\"", relay.id);
+    label(relay.description.c_str());
+    append("\"} %d\n", runtime.output(device.indexOf(relay)) ? 1 : 0);
+  }
+  family("esp_relay_switches_total", "counter", "Output relay state changes since boot.");
+  for (const auto& relay : device.relays) {
+    if (!relay.isOutput) continue;
+    size_t index = device.indexOf(relay);
+    append("esp_relay_switches_total{relay=\"%d\"} %u\n", relay.id,
+           index < runtime.switchCounts.size() ? runtime.switchCounts[index] : 0);
+  }
+
+  uint32_t now = millis();
+  family("esp_sensor_value", "gauge", "Last sensor reading.");
+  for (const auto& sensor : device.sensors) {
+    if (!sensor.isUseSetting) continue;
+    append("esp_sensor_value{sensor=\"%d\",name=\"", sensor.sensorId);
+    label(sensor.description.c_str());
+    append("\"} %g\n", runtime.sensorValue(device.indexOf(sensor)));
+  }
+  family("esp_sensor_humidity", "gauge", "Last humidity reading.");
+  for (const auto& sensor : device.sensors) {
+    if (!sensor.isUseSetting) continue;
+    append("esp_sensor_humidity{sensor=\"%d\"} %g\n", sensor.sensorId, runtime.humidityValue(device.indexOf(sensor)));
+  }
+  family("esp_sensor_age_seconds", "gauge", "Seconds since the sensor was last read.");
+  for (const auto& sensor : device.sensors) {
+    size_t index = device.indexOf(sensor);
+    if (!sensor.isUseSetting || index >= runtime.sensorReadAt.size() || runtime.sensorReadAt[index] == 0) continue;
+    append("esp_sensor_age_seconds{sensor=\"%d\"} %.3f\n", sensor.sensorId, (now - runtime.sensorReadAt[index]) / 1000.0);
+  }
+}
+
+void Metrics::renderTransport() {
+  WebServer::WsTotals ws = webServer.wsTotals();
+  family("esp_ws_clients", "gauge", "Connected WebSocket clients.");
+  append("esp_ws_clients %u\n", ws.clients);
+  family("esp_ws_sent_bytes_total", "counter", "Bytes sent to WebSocket clients.");
+  append("esp_ws_sent_bytes_total %u\n", ws.bytesSent);
+  family("esp_ws_dropped_commands_total", "counter", "Incoming WebSocket commands dropped on a full queue.");
+  append("esp_ws_dropped_commands_total %u\n", ws.droppedCommands);
+  family("esp_ws_outbox_dropped_total", "counter", "Outgoing messages dropped on full client outboxes.");
+  append("esp_ws_outbox_dropped_total %u\n", ws.outboxDropped);
+  family("esp_ws_outbox_coalesced_total", "counter", "Outgoing messages replaced by a newer version before sending.");
+  append("esp_ws_outbox_coalesced_total %u\n", ws.outboxCoalesced);
+
+  RestApi& api = webServer.api();
+  family("esp_http_api_requests_total", "counter", "Requests served by /api/v1.");
+  append("esp_http_api_requests_total %u\n", api.getRequests());
+  family("esp_http_api_not_modified_total", "counter", "/api/v1 requests answered with 304.");
+  append("esp_http_api_not_modified_total %u\n", api.getNotModified());
+  family("esp_http_api_rejected_total", "counter", "/api/v1 requests rejected with 503.");
+  append("esp_http_api_rejected_total %u\n", api.getRejected());
+
+  family("esp_telegram_messages_total", "counter", "Telegram messages by send result.");
+  append("esp_telegram_messages_total{result=\"sent\"} %u\n", telegramBot.getSentMessages());
+  append("esp_telegram_messages_total{result=\"failed\"} %u\n", telegramBot.getFailedMessages());
+
+  family("esp_log_dropped_total", "counter", "Log entries overwritten before they were sent.");
+  append("esp_log_dropped_total %u\n", logger.getDroppedCount());
+  family("esp_log_unsent", "gauge", "Log entries waiting to be sent.");
+  append("esp_log_unsent %u\n", logger.getUnsentCount());
+}
+
+void Metrics::append(const char* format, ...) {
+  if (overflow) return;
+
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(buffer.get() + length, METRICS_BUFFER_BYTES - length, format, args);
+  va_end(args);
+
+  if (written < 0 || (size_t)written >= METRICS_BUFFER_BYTES - length) {
+    // Drop the partial sample; everything before it stays well-formed.
+    overflow = true;
+    while (length > 0 && buffer.get()[length - 1] != '\n') length--;
+    buffer.get()[length] = '\0';
+    return;
+  }
+  length += written;
+}
+
+void Metrics::family(const char* name, const char* type, const char* help) {
+  append("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+void Metrics::label(const char* value) {
+  if (!value) return;
+
+  char escaped[2 * MAX_DESCRIPTION_LENGTH + 1];
+  size_t out = 0;
+  for (; *value && out + 2 < sizeof(escaped); value++) {
+    char c = *value;
+    if (c == '\\' || c == '"') {
+      escaped[out++] = '\\';
+      escaped[out++] = c;
+    } else if (c == '\n') {
+      escaped[out++] = '\\';
+      escaped[out++] = 'n';
+    } else {
+      escaped[out++] = c;
+    }
+  }
+  escaped[out] = '\0';
+  append("%s", escaped);
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CommonTypes.h"
+#include "DeviceManager.h"
+#include "WiFiManager.h"
+#include "WebServer.h"
+#include "TelegramBot.h"
+#include "Logger.h"
+#include <ESPAsyncWebServer.h>
+#include <memory>
+
+#define METRICS_BUFFER_BYTES 12288
+
+// Prometheus text exposition (version 0.0.4) for GET /metrics. The page is
+// rendered on the main task into one PSRAM buffer allocated on first use and
+// streamed from it in chunks, so a scrape allocates nothing per request. The
+// response holds a reference to the buffer until the request is freed, and
+// the buffer is not re-rendered while one does.
+class Metrics {
+public:
+  Metrics(DeviceManager& deviceManager, WiFiManager& wifiManager, WebServer& webServer,
+          TelegramBot& telegramBot, Logger& logger);
+  Metrics(const Metrics&) = delete;
+  Metrics& operator=(const Metrics&) = delete;
+
+  // Must be called on the main task, e.g. through RestApi::onGet().
+  void serve(AsyncWebServerRequest* request);
+
+private:
+  DeviceManager& deviceManager;
+  WiFiManager& wifiManager;
+  WebServer& webServer;
+  TelegramBot& telegramBot;
+  Logger& logger;
+
+  std::shared_ptr<char> buffer;
+  size_t length = 0;
+  bool overflow = false;
+  volatile bool streaming = false;
+
+  void render();
+  void renderSystem();
+  void renderLoop();
+  void renderDevice();
+  void renderTransport();
+
+  void append(const char* format, ...) __attribute__((format(printf, 2, 3)));
+  void family(const char* name, const char* type, const char* help);
+  void label(const char* value);
+};
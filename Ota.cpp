@@ -121,6 +121,7 @@ Ota::ProcessStatus Ota::handleUpdate(const String & file_path, const String & fi
         Serial.printf("❌ Not enough memory: %u bytes (need %u bytes)\n",
         freeMemory, MIN_FREE_MEMORY);
         Serial.println("🔄 Restarting due to low memory...");
+        MemTrack::print();
       }
       delay(1000);
       ESP.restart();
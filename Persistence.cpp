@@ -0,0 +1,381 @@
+#include "Persistence.h"
+
+#ifdef ESP32
+#include "esp_system.h"
+#endif
+
+Persistence* Persistence::instance = nullptr;
+
+uint32_t CrcPrint::update(uint32_t crc, const uint8_t* data, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    crc ^= data[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return crc;
+}
+
+size_t CrcPrint::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t CrcPrint::write(const uint8_t* buffer, size_t size) {
+  size_t written = target.write(buffer, size);
+  if (written > 0) {
+    crcValue = update(crcValue, buffer, written);
+    count += written;
+    last = buffer[written - 1];
+  }
+  return written;
+}
+
+int PersistedFile::available() {
+  size_t pos = file.position();
+  return pos < payloadLength ? (int)(payloadLength - pos) : 0;
+}
+
+int PersistedFile::read() {
+  if (file.position() >= payloadLength) return -1;
+  return file.read();
+}
+
+int PersistedFile::peek() {
+  if (file.position() >= payloadLength) return -1;
+  return file.peek();
+}
+
+size_t PersistedFile::readBytes(char* buffer, size_t length) {
+  size_t remaining = available();
+  if (length > remaining) length = remaining;
+  if (length == 0) return 0;
+  return file.read((uint8_t*)buffer, length);
+}
+
+void Persistence::begin() {
+  instance = this;
+#ifdef ESP32
+  esp_register_shutdown_handler(onShutdown);
+#endif
+}
+
+void Persistence::onShutdown() {
+  if (instance && instance->hasPending()) {
+    Serial.println("[Persistence] Flushing pending writes before restart");
+    instance->flush();
+  }
+}
+
+void Persistence::loop() {
+  if (pending.empty()) return;
+
+  unsigned long now = millis();
+  for (size_t i = 0; i < pending.size(); i++) {
+    PendingWrite& job = pending[i];
+    if (job.failedAttempts > 0) {
+      unsigned long backoff = min((unsigned long)PERSIST_RETRY_MAX_MS,
+                                  (unsigned long)PERSIST_RETRY_BASE_MS << min(job.failedAttempts - 1, 5));
+      if (now - job.lastAttempt < backoff) continue;
+    }
+    if (now - job.lastSubmit >= job.quietMs || now - job.firstSubmit >= PERSIST_MAX_DELAY_MS) {
+      PendingWrite ready = std::move(job);
+      pending.erase(pending.begin() + i);
+      if (!commit(ready.path, ready.writer)) {
+        // Keep the write; a newer submit for the same path may not come.
+        ready.failedAttempts = min(ready.failedAttempts + 1, 255);
+        ready.lastAttempt = millis();
+        Serial.printf("[Persistence] %s not saved, retry #%u scheduled\n", ready.path.c_str(), ready.failedAttempts);
+        pending.push_back(std::move(ready));
+      }
+      return;
+    }
+  }
+}
+
+void Persistence::submit(const char* path, Writer writer, uint32_t quietMs) {
+  unsigned long now = millis();
+
+  for (auto& job : pending) {
+    if (job.path == path) {
+      job.writer = std::move(writer);
+      job.quietMs = quietMs;
+      job.lastSubmit = now;
+      statsFor(job.path).coalesced++;
+      return;
+    }
+  }
+
+  pending.push_back({String(path), std::move(writer), quietMs, now, now, 0, 0});
+}
+
+bool Persistence::writeNow(const char* path, Writer writer) {
+  for (size_t i = 0; i < pending.size(); i++) {
+    if (pending[i].path == path) {
+      pending.erase(pending.begin() + i);
+      statsFor(String(path)).coalesced++;
+      break;
+    }
+  }
+
+  return commit(String(path), writer);
+}
+
+void Persistence::recordAppend(const char* path, size_t bytes) {
+  FileStats& fileStats = statsFor(String(path));
+  fileStats.writes++;
+  fileStats.bytes += bytes;
+}
+
+bool Persistence::appendRecord(const char* path, const Writer& writer) {
+  File file = SPIFFS.open(path, "a");
+  if (!file) {
+    statsFor(String(path)).failures++;
+    return false;
+  }
+
+  CrcPrint out(file);
+  bool success = writer(out) && out.length() > 0;
+  if (success && out.lastByte() != '\n') {
+    success = out.write('\n') == 1;
+  }
+
+  char footer[PERSIST_FOOTER_LENGTH + 1];
+  snprintf(footer, sizeof(footer), "#CRC32:%08X:%08X\n", out.crc(), (uint32_t)out.length());
+  success = success && file.print(footer) == PERSIST_FOOTER_LENGTH;
+  file.close();
+
+  if (!success) {
+    statsFor(String(path)).failures++;
+    return false;
+  }
+
+  recordAppend(path, out.length() + PERSIST_FOOTER_LENGTH);
+  return true;
+}
+
+int Persistence::readRecords(const char* path, const RecordReader& reader) {
+  File file = SPIFFS.open(path, "r");
+  if (!file) {
+    return 0;
+  }
+
+  int count = 0;
+  bool damaged = false;
+  while (file.available()) {
+    String record = file.readStringUntil('\n');
+    String footer = file.readStringUntil('\n');
+
+    unsigned int expectedCrc = 0;
+    unsigned int expectedLength = 0;
+    if (sscanf(footer.c_str(), "#CRC32:%8x:%8x", &expectedCrc, &expectedLength) != 2 ||
+        expectedLength != record.length() + 1) {
+      damaged = true;
+      break;
+    }
+
+    uint32_t crc = CrcPrint::update(0xFFFFFFFF, (const uint8_t*)record.c_str(), record.length());
+    crc = CrcPrint::update(crc, (const uint8_t*)"\n", 1);
+    if (~crc != expectedCrc) {
+      damaged = true;
+      break;
+    }
+
+    reader(record.c_str(), record.length());
+    count++;
+    yield();
+  }
+
+  file.close();
+  if (damaged) {
+    Serial.printf("[Persistence] %s: stopped at a damaged record after %d\n", path, count);
+  }
+  return count;
+}
+
+void Persistence::flush() {
+  while (!pending.empty()) {
+    PendingWrite job = std::move(pending.front());
+    pending.erase(pending.begin());
+    commit(job.path, job.writer);
+  }
+}
+
+void Persistence::discardPending() {
+  pending.clear();
+}
+
+bool Persistence::commit(const String& path, const Writer& writer) {
+  String tempPath = path + ".tmp";
+
+  File file = SPIFFS.open(tempPath, "w");
+  if (!file) {
+    Serial.printf("[Persistence] Ошибка открытия %s для записи\n", tempPath.c_str());
+    statsFor(path).failures++;
+    return false;
+  }
+
+  CrcPrint out(file);
+  bool success = writer(out);
+
+  if (success && out.length() > 0 && out.lastByte() != '\n') {
+    success = out.write('\n') == 1;
+  }
+
+  char footer[PERSIST_FOOTER_LENGTH + 1];
+  snprintf(footer, sizeof(footer), "#CRC32:%08X:%08X\n", out.crc(), (uint32_t)out.length());
+  success = success && file.print(footer) == PERSIST_FOOTER_LENGTH;
+  file.close();
+
+  if (!success) {
+    Serial.printf("[Persistence] Write of %s failed, previous version kept\n", path.c_str());
+    SPIFFS.remove(tempPath);
+    statsFor(path).failures++;
+    return false;
+  }
+
+  if (SPIFFS.exists(path)) {
+    SPIFFS.remove(path);
+  }
+
+  if (!SPIFFS.rename(tempPath, path)) {
+    Serial.printf("[Persistence] Rename %s -> %s failed\n", tempPath.c_str(), path.c_str());
+    statsFor(path).failures++;
+    return false;
+  }
+
+  FileStats& fileStats = statsFor(path);
+  fileStats.writes++;
+  fileStats.bytes += out.length() + PERSIST_FOOTER_LENGTH;
+  return true;
+}
+
+bool Persistence::verify(File& file, size_t& payloadLength, bool& legacy) {
+  size_t size = file.size();
+  payloadLength = size;
+  legacy = true;
+
+  if (size < PERSIST_FOOTER_LENGTH) {
+    return true;
+  }
+
+  char footer[PERSIST_FOOTER_LENGTH + 1] = {0};
+  file.seek(size - PERSIST_FOOTER_LENGTH);
+  file.read((uint8_t*)footer, PERSIST_FOOTER_LENGTH);
+  file.seek(0);
+
+  unsigned int expectedCrc = 0;
+  unsigned int expectedLength = 0;
+  if (footer[PERSIST_FOOTER_LENGTH - 1] != '\n' ||
+      sscanf(footer, "#CRC32:%8x:%8x", &expectedCrc, &expectedLength) != 2) {
+    return true;
+  }
+
+  legacy = false;
+  payloadLength = size - PERSIST_FOOTER_LENGTH;
+  if (expectedLength != payloadLength) {
+    return false;
+  }
+
+  uint8_t buffer[256];
+  uint32_t crc = 0xFFFFFFFF;
+  size_t remaining = payloadLength;
+  while (remaining > 0) {
+    size_t chunk = file.read(buffer, min(remaining, sizeof(buffer)));
+    if (chunk == 0) break;
+    crc = CrcPrint::update(crc, buffer, chunk);
+    remaining -= chunk;
+  }
+  file.seek(0);
+
+  return remaining == 0 && ~crc == expectedCrc;
+}
+
+void Persistence::recover(const char* path) {
+  String tempPath = String(path) + ".tmp";
+  if (!SPIFFS.exists(tempPath)) {
+    return;
+  }
+
+  File file = SPIFFS.open(tempPath, "r");
+  size_t payloadLength = 0;
+  bool legacy = true;
+  bool valid = file && verify(file, payloadLength, legacy) && !legacy;
+  if (file) file.close();
+
+  if (!valid) {
+    SPIFFS.remove(tempPath);
+    return;
+  }
+
+  if (SPIFFS.exists(path)) {
+    SPIFFS.remove(path);
+  }
+
+  if (SPIFFS.rename(tempPath, path)) {
+    Serial.printf("[Persistence] %s restored from interrupted write\n", path);
+  }
+}
+
+bool Persistence::exists(const char* path) {
+  recover(path);
+  return SPIFFS.exists(path);
+}
+
+size_t Persistence::fileSize(const char* path) {
+  if (!exists(path)) return 0;
+
+  File file = SPIFFS.open(path, "r");
+  size_t size = file ? file.size() : 0;
+  file.close();
+  return size;
+}
+
+bool Persistence::openRead(const char* path, PersistedFile& out) {
+  if (!exists(path)) {
+    return false;
+  }
+
+  out.file = SPIFFS.open(path, "r");
+  if (!out.file) {
+    return false;
+  }
+
+  if (!verify(out.file, out.payloadLength, out.legacy)) {
+    Serial.printf("[Persistence] CRC mismatch in %s\n", path);
+    out.file.close();
+    return false;
+  }
+
+  return true;
+}
+
+bool Persistence::openPayload(const char* path, PersistedFile& out) {
+  out.file = SPIFFS.open(path, "r");
+  if (!out.file) {
+    return false;
+  }
+
+  if (!verify(out.file, out.payloadLength, out.legacy)) {
+    Serial.printf("[Persistence] CRC mismatch in %s, serving it anyway\n", path);
+  }
+  return true;
+}
+
+Persistence::FileStats& Persistence::statsFor(const String& path) {
+  for (auto& fileStats : stats) {
+    if (fileStats.path == path) return fileStats;
+  }
+
+  FileStats fileStats;
+  fileStats.path = path;
+  stats.push_back(fileStats);
+  return stats.back();
+}
+
+void Persistence::printStats() {
+  for (const auto& fileStats : stats) {
+    Serial.printf("[Persistence] %s: writes=%u, bytes=%u, coalesced=%u, failures=%u\n",
+                  fileStats.path.c_str(), fileStats.writes, fileStats.bytes,
+                  fileStats.coalesced, fileStats.failures);
+  }
+}
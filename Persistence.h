@@ -0,0 +1,123 @@
+#pragma once
+
+#include <functional>
+#include "CommonTypes.h"
+
+#define PERSIST_DEFAULT_QUIET_MS 1500
+#define PERSIST_MAX_DELAY_MS 15000
+#define PERSIST_RETRY_BASE_MS 2000
+#define PERSIST_RETRY_MAX_MS 60000
+#define PERSIST_FOOTER_LENGTH 25
+
+class CrcPrint : public Print {
+public:
+  explicit CrcPrint(Print& target) : target(target) {}
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+
+  uint32_t crc() const { return ~crcValue; }
+  size_t length() const { return count; }
+  uint8_t lastByte() const { return last; }
+
+  static uint32_t update(uint32_t crc, const uint8_t* data, size_t size);
+
+private:
+  Print& target;
+  uint32_t crcValue = 0xFFFFFFFF;
+  size_t count = 0;
+  uint8_t last = '\n';
+};
+
+class PersistedFile : public Stream {
+public:
+  PersistedFile() { setTimeout(0); }
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t readBytes(char* buffer, size_t length) override;
+  size_t write(uint8_t) override { return 0; }
+  void flush() override {}
+
+  size_t size() const { return payloadLength; }
+  size_t position() { return file.position(); }
+  bool seek(size_t pos) { return file.seek(min(pos, payloadLength)); }
+  bool isLegacy() const { return legacy; }
+  void close() { file.close(); }
+  operator bool() { return (bool)file; }
+
+private:
+  friend class Persistence;
+
+  File file;
+  size_t payloadLength = 0;
+  bool legacy = false;
+};
+
+class Persistence {
+public:
+  using Writer = std::function<bool(Print& out)>;
+  using RecordReader = std::function<void(const char* record, size_t length)>;
+
+  struct FileStats {
+    String path;
+    uint32_t writes = 0;
+    uint32_t bytes = 0;
+    uint32_t coalesced = 0;
+    uint32_t failures = 0;
+  };
+
+  Persistence() = default;
+
+  void begin();
+  void loop();
+
+  void submit(const char* path, Writer writer, uint32_t quietMs = PERSIST_DEFAULT_QUIET_MS);
+  bool writeNow(const char* path, Writer writer);
+  void recordAppend(const char* path, size_t bytes);
+
+  // Append-only logs: each record is one payload line followed by the same
+  // CRC footer a snapshot ends with. Reading stops at the first record that
+  // does not verify, so a torn tail from a crash is ignored.
+  bool appendRecord(const char* path, const Writer& writer);
+  int readRecords(const char* path, const RecordReader& reader);
+  void flush();
+  void discardPending();
+  bool hasPending() const { return !pending.empty(); }
+
+  bool exists(const char* path);
+  // Raw size on flash, footers included; 0 if the file is missing.
+  size_t fileSize(const char* path);
+  bool openRead(const char* path, PersistedFile& out);
+
+  // Opens a file for handing its payload to a user (download, Telegram), with
+  // the footer left out. Read-only and safe off the main task: no recovery is
+  // attempted, and a payload that fails its CRC is still served.
+  static bool openPayload(const char* path, PersistedFile& out);
+
+  const std::vector<FileStats>& getStats() const { return stats; }
+  void printStats();
+
+private:
+  struct PendingWrite {
+    String path;
+    Writer writer;
+    uint32_t quietMs;
+    unsigned long firstSubmit;
+    unsigned long lastSubmit;
+    uint8_t failedAttempts;
+    unsigned long lastAttempt;
+  };
+
+  std::vector<PendingWrite> pending;
+  std::vector<FileStats> stats;
+
+  bool commit(const String& path, const Writer& writer);
+  static bool verify(File& file, size_t& payloadLength, bool& legacy);
+  void recover(const char* path);
+  FileStats& statsFor(const String& path);
+
+  static void onShutdown();
+  static Persistence* instance;
+};
@@ -0,0 +1,309 @@
+#include "RestApi.h"
+
+RestApi::RestApi(DeviceManager& deviceManager) : deviceManager(deviceManager) {}
+
+void RestApi::begin(AsyncWebServer& server) {
+  if (attached) return;
+  attached = true;
+  this->server = &server;
+
+  // Version counters restart at boot; the tag keeps a reboot from matching
+  // an ETag a poller kept from before it.
+  bootTag = esp_random();
+
+  server.on("/api/v1/state", HTTP_GET, [this](AsyncWebServerRequest* request) {
+    onRequest(request, REST_STATE);
+  });
+  server.on("/api/v1/sensors", HTTP_GET, [this](AsyncWebServerRequest* request) {
+    onRequest(request, REST_SENSORS);
+  });
+  server.on("/api/v1/timers", HTTP_GET, [this](AsyncWebServerRequest* request) {
+    onRequest(request, REST_TIMERS);
+  });
+
+  // Also matches /api/v1/relays/{id}.
+  server.on("/api/v1/relays", HTTP_GET | HTTP_POST,
+  [this](AsyncWebServerRequest* request) {
+    onRelayRequest(request);
+  },
+  nullptr,
+  [this](AsyncWebServerRequest* request, uint8_t* data, size_t length, size_t index, size_t total) {
+    onBody(request, data, length, index, total);
+  });
+
+  for (uint8_t i = 0; i < customCount; i++) {
+    attachCustom(i);
+  }
+}
+
+bool RestApi::onGet(const char* uri, Handler handler) {
+  if (customCount >= REST_CUSTOM_MAX) return false;
+
+  customRoutes[customCount].uri = uri;
+  customRoutes[customCount].handler = handler;
+  customCount++;
+
+  if (attached) {
+    attachCustom(customCount - 1);
+  }
+  return true;
+}
+
+void RestApi::attachCustom(uint8_t index) {
+  server->on(customRoutes[index].uri, HTTP_GET, [this, index](AsyncWebServerRequest* request) {
+    if (!enqueue(request, REST_CUSTOM, 0, nullptr, index)) {
+      sendError(request, 503, "busy");
+    }
+  });
+}
+
+void RestApi::onBody(AsyncWebServerRequest* request, uint8_t* data, size_t length, size_t index, size_t total) {
+  if (total > REST_BODY_MAX_BYTES) return;
+
+  // _tempObject is released with free() together with the request.
+  if (index == 0) {
+    Body* body = static_cast<Body*>(malloc(sizeof(Body)));
+    if (body) body->length = 0;
+    request->_tempObject = body;
+  }
+
+  Body* body = static_cast<Body*>(request->_tempObject);
+  if (!body || index + length > REST_BODY_MAX_BYTES) return;
+
+  memcpy(body->data + index, data, length);
+  body->length = index + length;
+  body->data[body->length] = '\0';
+}
+
+void RestApi::onRequest(AsyncWebServerRequest* request, RestResource resource) {
+  if (!enqueue(request, resource)) {
+    sendError(request, 503, "busy");
+  }
+}
+
+void RestApi::onRelayRequest(AsyncWebServerRequest* request) {
+  const String& url = request->url();
+  const char* tail = url.c_str() + strlen("/api/v1/relays");
+
+  if (*tail == '\0' || strcmp(tail, "/") == 0) {
+    if (request->method() != HTTP_GET) {
+      sendError(request, 405, "method_not_allowed");
+    } else if (!enqueue(request, REST_RELAYS)) {
+      sendError(request, 503, "busy");
+    }
+    return;
+  }
+
+  char* end = nullptr;
+  long relayId = strtol(tail + 1, &end, 10);
+  if (end == tail + 1 || *end != '\0') {
+    sendError(request, 404, "not_found");
+    return;
+  }
+  if (request->method() != HTTP_POST) {
+    sendError(request, 405, "method_not_allowed");
+    return;
+  }
+
+  String action;
+  if (request->hasParam("action", true)) {
+    action = request->getParam("action", true)->value();
+  } else if (request->hasParam("action")) {
+    action = request->getParam("action")->value();
+  } else if (request->_tempObject) {
+    StaticJsonDocument<128> body;
+    Body* raw = static_cast<Body*>(request->_tempObject);
+    if (!deserializeJson(body, raw->data, raw->length)) {
+      action = body["action"] | "";
+    }
+  }
+
+  if (action != "on" && action != "off" && action != "reset") {
+    sendError(request, 400, "bad_action");
+    return;
+  }
+
+  if (!enqueue(request, REST_RELAY_COMMAND, relayId, action.c_str())) {
+    sendError(request, 503, "busy");
+  }
+}
+
+bool RestApi::enqueue(AsyncWebServerRequest* request, RestResource resource, int relayId, const char* action,
+                      uint8_t custom) {
+  int8_t index = -1;
+
+  portENTER_CRITICAL(&lock);
+  for (uint8_t i = 0; i < REST_PENDING_MAX; i++) {
+    if (pending[i].state == SLOT_FREE) {
+      index = i;
+      break;
+    }
+  }
+  if (index >= 0) {
+    Pending& slot = pending[index];
+    slot.request = nullptr;
+    slot.resource = resource;
+    slot.relayId = relayId;
+    strlcpy(slot.action, action ? action : "", sizeof(slot.action));
+    slot.custom = custom;
+    slot.state = SLOT_QUEUED;
+  }
+  portEXIT_CRITICAL(&lock);
+
+  if (index < 0) {
+    rejected++;
+    return false;
+  }
+
+  // The request is freed on the async_tcp task when its client goes away. A
+  // queued slot is simply dropped; one being served is waited for, so loop()
+  // never writes to a request that no longer exists. loop() only picks the
+  // slot up once the request is set, after the callback is in place.
+  request->onDisconnect([this, index, request]() {
+    Pending& slot = pending[index];
+    portENTER_CRITICAL(&lock);
+    while (slot.request == request && slot.state == SLOT_SERVING) {
+      portEXIT_CRITICAL(&lock);
+      vTaskDelay(1);
+      portENTER_CRITICAL(&lock);
+    }
+    if (slot.request == request) {
+      slot.request = nullptr;
+      slot.state = SLOT_FREE;
+    }
+    portEXIT_CRITICAL(&lock);
+  });
+
+  portENTER_CRITICAL(&lock);
+  pending[index].request = request;
+  portEXIT_CRITICAL(&lock);
+  return true;
+}
+
+void RestApi::loop() {
+  for (uint8_t i = 0; i < REST_PENDING_MAX; i++) {
+    Pending& slot = pending[i];
+
+    portENTER_CRITICAL(&lock);
+    bool ready = slot.state == SLOT_QUEUED && slot.request;
+    if (ready) slot.state = SLOT_SERVING;
+    portEXIT_CRITICAL(&lock);
+
+    if (!ready) continue;
+
+    serve(slot);
+
+    portENTER_CRITICAL(&lock);
+    slot.request = nullptr;
+    slot.state = SLOT_FREE;
+    portEXIT_CRITICAL(&lock);
+  }
+}
+
+void RestApi::serve(Pending& slot) {
+  requests++;
+
+  if (slot.resource == REST_RELAY_COMMAND) {
+    serveRelayCommand(slot.request, slot.relayId, slot.action);
+  } else if (slot.resource == REST_CUSTOM) {
+    customRoutes[slot.custom].handler(slot.request);
+  } else {
+    serveRead(slot.request, slot.resource);
+  }
+}
+
+void RestApi::formatETag(char* buffer, size_t size, RestResource resource) {
+  uint8_t device = deviceManager.currentDeviceIndex;
+
+  switch (resource) {
+    case REST_RELAYS:
+    case REST_SENSORS:
+    case REST_TIMERS: {
+      RuntimeTopic topic = resource == REST_RELAYS ? RUNTIME_RELAYS :
+                           resource == REST_SENSORS ? RUNTIME_SENSORS : RUNTIME_TIMERS;
+      snprintf(buffer, size, "\"%08x-%u-%u\"", bootTag, device, deviceManager.runtimeVersion(topic));
+      break;
+    }
+    default:
+      snprintf(buffer, size, "\"%08x-%u-%u.%u.%u.%u\"", bootTag, device,
+               deviceManager.runtimeVersion(RUNTIME_RELAYS), deviceManager.runtimeVersion(RUNTIME_SENSORS),
+               deviceManager.runtimeVersion(RUNTIME_TIMERS), deviceManager.runtimeVersion(RUNTIME_FLAGS));
+      break;
+  }
+}
+
+// The WebSocket serializers are reused; their "type"/"full" envelope is
+// replaced by the version the ETag is built from.
+void RestApi::writeTopic(Print& out, RuntimeTopic topic) {
+  JsonDocument& doc = arena.acquire();
+
+  switch (topic) {
+    case RUNTIME_RELAYS: deviceManager.serializeRelaysForControlTab(doc); break;
+    case RUNTIME_SENSORS: deviceManager.serializeSensorValues(doc); break;
+    case RUNTIME_TIMERS: deviceManager.serializeTimersProgress(doc); break;
+    case RUNTIME_FLAGS: deviceManager.serializeDeviceFlags(doc); break;
+    default: break;
+  }
+
+  doc.remove("type");
+  doc.remove("full");
+  doc["version"] = deviceManager.runtimeVersion(topic);
+  serializeJson(doc, out);
+}
+
+void RestApi::serveRead(AsyncWebServerRequest* request, RestResource resource) {
+  char etag[48];
+  formatETag(etag, sizeof(etag), resource);
+
+  const AsyncWebHeader* ifNoneMatch = request->getHeader("If-None-Match");
+  if (ifNoneMatch && ifNoneMatch->value() == etag) {
+    notModified++;
+    AsyncWebServerResponse* response = request->beginResponse(304);
+    response->addHeader("ETag", etag);
+    request->send(response);
+    return;
+  }
+
+  AsyncResponseStream* response = request->beginResponseStream("application/json");
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", "no-cache");
+
+  switch (resource) {
+    case REST_RELAYS: writeTopic(*response, RUNTIME_RELAYS); break;
+    case REST_SENSORS: writeTopic(*response, RUNTIME_SENSORS); break;
+    case REST_TIMERS: writeTopic(*response, RUNTIME_TIMERS); break;
+    default:
+      response->printf("{\"device\":%u,\"relays\":", deviceManager.currentDeviceIndex);
+      writeTopic(*response, RUNTIME_RELAYS);
+      response->print(",\"sensors\":");
+      writeTopic(*response, RUNTIME_SENSORS);
+      response->print(",\"timers\":");
+      writeTopic(*response, RUNTIME_TIMERS);
+      response->print(",\"flags\":");
+      writeTopic(*response, RUNTIME_FLAGS);
+      response->print("}");
+      break;
+  }
+  request->send(response);
+}
+
+void RestApi::serveRelayCommand(AsyncWebServerRequest* request, int relayId, const char* action) {
+  StaticJsonDocument<64> command;
+  command["relay"] = relayId;
+  command["action"] = action;
+
+  if (!deviceManager.handleRelayCommand(command.as<JsonObject>(), 0xFF)) {
+    sendError(request, 404, "relay_not_found");
+    return;
+  }
+
+  // Answer with the new relay list, so the caller also gets the ETag to poll with.
+  serveRead(request, REST_RELAYS);
+}
+
+void RestApi::sendError(AsyncWebServerRequest* request, int code, const char* error) {
+  AsyncResponseStream* response = request->beginResponseStream("application/json");
+  response->setCode(code);
+  response->printf("{\"error\":\"%s\"}", error);
+  request->send(response);
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CommonTypes.h"
+#include "DeviceManager.h"
+#include "JsonArena.h"
+#include <ESPAsyncWebServer.h>
+#include <functional>
+
+#define REST_PENDING_MAX 4
+#define REST_BODY_MAX_BYTES 256
+#define REST_CUSTOM_MAX 4
+
+enum RestResource : uint8_t {
+  REST_STATE,
+  REST_RELAYS,
+  REST_SENSORS,
+  REST_TIMERS,
+  REST_RELAY_COMMAND,
+  REST_CUSTOM
+};
+
+// Small HTTP API for integration pollers:
+//   GET  /api/v1/state | relays | sensors | timers
+//   POST /api/v1/relays/{id}   action=on|off|reset (query, form or JSON body)
+// Requests arrive on the async_tcp task and are only queued there; loop()
+// answers them on the main task, where device state is safe to read. ETags
+// are built from the runtime version counters, so an unchanged resource costs
+// a bodiless 304.
+class RestApi {
+public:
+  typedef std::function<void(AsyncWebServerRequest*)> Handler;
+
+  explicit RestApi(DeviceManager& deviceManager);
+
+  RestApi(const RestApi&) = delete;
+  RestApi& operator=(const RestApi&) = delete;
+
+  void begin(AsyncWebServer& server);
+  void loop();
+
+  // Extra GET route whose handler runs on the main task, like the built-in ones.
+  bool onGet(const char* uri, Handler handler);
+
+  uint32_t getRequests() const { return requests; }
+  uint32_t getNotModified() const { return notModified; }
+  uint32_t getRejected() const { return rejected; }
+
+private:
+  enum SlotState : uint8_t { SLOT_FREE, SLOT_QUEUED, SLOT_SERVING };
+
+  struct Pending {
+    AsyncWebServerRequest* request = nullptr;
+    volatile SlotState state = SLOT_FREE;
+    RestResource resource = REST_STATE;
+    int relayId = 0;
+    char action[12] = {0};
+    uint8_t custom = 0;
+  };
+
+  struct CustomRoute {
+    const char* uri = nullptr;
+    Handler handler;
+  };
+
+  struct Body {
+    char data[REST_BODY_MAX_BYTES + 1];
+    size_t length;
+  };
+
+  DeviceManager& deviceManager;
+  JsonArena arena{"api.doc", 4096};
+  Pending pending[REST_PENDING_MAX];
+  CustomRoute customRoutes[REST_CUSTOM_MAX];
+  uint8_t customCount = 0;
+  AsyncWebServer* server = nullptr;
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+  uint32_t bootTag = 0;
+  bool attached = false;
+
+  uint32_t requests = 0;
+  uint32_t notModified = 0;
+  uint32_t rejected = 0;
+
+  void onRequest(AsyncWebServerRequest* request, RestResource resource);
+  void onRelayRequest(AsyncWebServerRequest* request);
+  void onBody(AsyncWebServerRequest* request, uint8_t* data, size_t length, size_t index, size_t total);
+  bool enqueue(AsyncWebServerRequest* request, RestResource resource, int relayId = 0, const char* action = nullptr,
+               uint8_t custom = 0);
+  void attachCustom(uint8_t index);
+
+  void serve(Pending& slot);
+  void serveRead(AsyncWebServerRequest* request, RestResource resource);
+  void serveRelayCommand(AsyncWebServerRequest* request, int relayId, const char* action);
+
+  void writeTopic(Print& out, RuntimeTopic topic);
+  void formatETag(char* buffer, size_t size, RestResource resource);
+  void sendError(AsyncWebServerRequest* request, int code, const char* error);
+};
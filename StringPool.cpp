@@ -0,0 +1,253 @@
+#include "StringPool.h"
+
+StringPool& StringPool::instance() {
+  static StringPool* pool = new StringPool();
+  return *pool;
+}
+
+StringPool::StringPool() {
+  buffer.resize(3, 0);
+  slots.push_back({0, hashOf("", 0), 0});
+}
+
+uint32_t StringPool::hashOf(const char* text, size_t length) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= (uint8_t)text[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+bool StringPool::matches(const Slot& slot, const char* text, size_t length) const {
+  uint16_t stored;
+  memcpy(&stored, buffer.data() + slot.offset, sizeof(stored));
+  return stored == length && memcmp(buffer.data() + slot.offset + sizeof(stored), text, length) == 0;
+}
+
+uint16_t StringPool::allocateSlot() {
+  if (!freeSlots.empty()) {
+    uint16_t handle = freeSlots.back();
+    freeSlots.pop_back();
+    return handle;
+  }
+
+  if (slots.size() >= STRING_POOL_MAX_HANDLES) {
+    return 0;
+  }
+
+  slots.push_back({0, 0, 0});
+  return slots.size() - 1;
+}
+
+uint16_t StringPool::find(uint32_t hash, const char* text, size_t length) const {
+  if (index.empty()) return 0;
+
+  size_t mask = index.size() - 1;
+  for (size_t i = hash & mask; index[i] != 0; i = (i + 1) & mask) {
+    const Slot& slot = slots[index[i]];
+    if (slot.hash == hash && matches(slot, text, length)) {
+      return index[i];
+    }
+  }
+  return 0;
+}
+
+void StringPool::addToIndex(uint16_t handle) {
+  if (2 * (indexed + 1) > index.size()) {
+    rebuildIndex();
+    return;
+  }
+
+  size_t mask = index.size() - 1;
+  size_t i = slots[handle].hash & mask;
+  while (index[i] != 0) i = (i + 1) & mask;
+  index[i] = handle;
+  indexed++;
+}
+
+void StringPool::rebuildIndex() {
+  size_t live = 0;
+  for (size_t i = 1; i < slots.size(); i++) {
+    if (slots[i].offset != 0) live++;
+  }
+
+  size_t size = STRING_POOL_MIN_INDEX;
+  while (size < 2 * live) size <<= 1;
+  index.assign(size, 0);
+
+  size_t mask = size - 1;
+  for (size_t handle = 1; handle < slots.size(); handle++) {
+    if (slots[handle].offset == 0) continue;
+    size_t i = slots[handle].hash & mask;
+    while (index[i] != 0) i = (i + 1) & mask;
+    index[i] = handle;
+  }
+  indexed = live;
+}
+
+uint16_t StringPool::intern(const char* text, size_t length) {
+  if (!text || length == 0) {
+    return 0;
+  }
+  if (!MemTrack::onMainTask()) {
+    Serial.println("[StringPool] intern() off the main task refused");
+    return 0;
+  }
+  length = min(length, (size_t)STRING_POOL_MAX_LENGTH);
+
+  uint32_t hash = hashOf(text, length);
+  uint16_t found = find(hash, text, length);
+  if (found != 0) {
+    slots[found].refs++;
+    hits++;
+    return found;
+  }
+
+  // Growing or compacting the buffer below would free text that points into it.
+  PsramVector<char> copy;
+  const char* begin = reinterpret_cast<const char*>(buffer.data());
+  if (text >= begin && text < begin + buffer.size()) {
+    copy.assign(text, text + length);
+    text = copy.data();
+  }
+
+  uint16_t handle = allocateSlot();
+  if (handle == 0) {
+    compact();
+    handle = allocateSlot();
+    if (handle == 0) {
+      Serial.println("[StringPool] Handle table exhausted");
+      return 0;
+    }
+  }
+
+  uint16_t stored = length;
+  size_t offset = buffer.size();
+  buffer.resize(offset + sizeof(stored) + length + 1);
+  memcpy(buffer.data() + offset, &stored, sizeof(stored));
+  memcpy(buffer.data() + offset + sizeof(stored), text, length);
+  buffer[offset + sizeof(stored) + length] = '\0';
+
+  slots[handle] = {(uint32_t)offset, hash, 1};
+  addToIndex(handle);
+  misses++;
+  return handle;
+}
+
+void StringPool::retain(uint16_t handle) {
+  if (handle != 0 && handle < slots.size()) {
+    slots[handle].refs++;
+  }
+}
+
+void StringPool::release(uint16_t handle) {
+  if (handle != 0 && handle < slots.size() && slots[handle].refs > 0) {
+    slots[handle].refs--;
+  }
+}
+
+const char* StringPool::get(uint16_t handle) const {
+  if (handle >= slots.size() || (handle != 0 && slots[handle].offset == 0)) {
+    handle = 0;
+  }
+  return reinterpret_cast<const char*>(buffer.data() + slots[handle].offset + sizeof(uint16_t));
+}
+
+size_t StringPool::length(uint16_t handle) const {
+  if (handle == 0 || handle >= slots.size() || slots[handle].offset == 0) {
+    return 0;
+  }
+  uint16_t stored;
+  memcpy(&stored, buffer.data() + slots[handle].offset, sizeof(stored));
+  return stored;
+}
+
+size_t StringPool::entrySize(uint16_t handle) const {
+  size_t stringLength = length(handle);
+  return stringLength ? sizeof(uint16_t) + stringLength + 1 : 0;
+}
+
+size_t StringPool::compact() {
+  if (!MemTrack::onMainTask()) {
+    return 0;
+  }
+
+  PsramVector<uint8_t> compacted;
+  compacted.reserve(buffer.size());
+  compacted.resize(3, 0);
+
+  for (size_t i = 1; i < slots.size(); i++) {
+    Slot& slot = slots[i];
+    if (slot.offset == 0) {
+      continue;
+    }
+
+    if (slot.refs == 0) {
+      slot = {0, 0, 0};
+      freeSlots.push_back(i);
+      continue;
+    }
+
+    size_t size = entrySize(i);
+    size_t offset = compacted.size();
+    compacted.insert(compacted.end(), buffer.begin() + slot.offset, buffer.begin() + slot.offset + size);
+    slot.offset = offset;
+  }
+
+  size_t reclaimed = buffer.size() - compacted.size();
+  compacted.shrink_to_fit();
+  buffer.swap(compacted);
+  rebuildIndex();
+  compactions++;
+  return reclaimed;
+}
+
+StringPool::Stats StringPool::getStats() const {
+  Stats stats;
+  stats.entries = slots.size() - 1 - freeSlots.size();
+  stats.bufferBytes = buffer.capacity();
+  stats.hits = hits;
+  stats.misses = misses;
+  stats.compactions = compactions;
+
+  for (size_t i = 1; i < slots.size(); i++) {
+    if (slots[i].offset != 0 && slots[i].refs > 0) {
+      stats.liveEntries++;
+      stats.liveBytes += entrySize(i);
+    }
+  }
+  return stats;
+}
+
+void StringPool::printStats() const {
+  Stats stats = getStats();
+  Serial.printf("[StringPool] entries=%u (live %u), live bytes=%u, buffer=%u, hits=%u, misses=%u, compactions=%u\n",
+                (unsigned)stats.entries, (unsigned)stats.liveEntries, (unsigned)stats.liveBytes,
+                (unsigned)stats.bufferBytes, stats.hits, stats.misses, stats.compactions);
+}
+
+PooledString& PooledString::operator=(const PooledString& other) {
+  if (this != &other) {
+    StringPool::instance().retain(other.id);
+    StringPool::instance().release(id);
+    id = other.id;
+  }
+  return *this;
+}
+
+PooledString& PooledString::operator=(PooledString&& other) noexcept {
+  if (this != &other) {
+    StringPool::instance().release(id);
+    id = other.id;
+    other.id = 0;
+  }
+  return *this;
+}
+
+void PooledString::assign(const char* text, size_t capacity) {
+  size_t textLength = text ? strnlen(text, capacity > 0 ? capacity - 1 : 0) : 0;
+  uint16_t handle = StringPool::instance().intern(text, textLength);
+  StringPool::instance().release(id);
+  id = handle;
+}
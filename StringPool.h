@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CommonTypes.h"
+
+#define STRING_POOL_MAX_HANDLES 0xFFFF
+#define STRING_POOL_MAX_LENGTH 1024
+#define STRING_POOL_MIN_INDEX 64
+
+// The pool belongs to the main task: intern() and compact() move the backing
+// buffer, so a c_str() pointer is only valid until the next one of them, and
+// both refuse to run on another task. Strings put into a JsonDocument must be
+// copied (PooledString::forJson()), not linked.
+class StringPool {
+public:
+  struct Stats {
+    size_t entries = 0;
+    size_t liveEntries = 0;
+    size_t liveBytes = 0;
+    size_t bufferBytes = 0;
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t compactions = 0;
+  };
+
+  static StringPool& instance();
+
+  uint16_t intern(const char* text, size_t length);
+  void retain(uint16_t handle);
+  void release(uint16_t handle);
+
+  const char* get(uint16_t handle) const;
+  size_t length(uint16_t handle) const;
+  size_t entrySize(uint16_t handle) const;
+
+  size_t compact();
+  Stats getStats() const;
+  void printStats() const;
+
+private:
+  struct Slot {
+    uint32_t offset;
+    uint32_t hash;
+    uint32_t refs;
+  };
+
+  StringPool();
+
+  PsramVector<uint8_t> buffer;
+  PsramVector<Slot> slots;
+  PsramVector<uint16_t> freeSlots;
+  // Open-addressed hash -> handle table (0 = empty), at most half full.
+  // Entries only go away in compact(), which rebuilds it.
+  PsramVector<uint16_t> index;
+  size_t indexed = 0;
+
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  uint32_t compactions = 0;
+
+  static uint32_t hashOf(const char* text, size_t length);
+  bool matches(const Slot& slot, const char* text, size_t length) const;
+  uint16_t allocateSlot();
+  uint16_t find(uint32_t hash, const char* text, size_t length) const;
+  void addToIndex(uint16_t handle);
+  void rebuildIndex();
+};
+
+class PooledString {
+public:
+  PooledString() = default;
+  PooledString(const char* text) { assign(text); }
+  PooledString(const PooledString& other) : id(other.id) { StringPool::instance().retain(id); }
+  PooledString(PooledString&& other) noexcept : id(other.id) { other.id = 0; }
+  ~PooledString() { StringPool::instance().release(id); }
+
+  PooledString& operator=(const PooledString& other);
+  PooledString& operator=(PooledString&& other) noexcept;
+  PooledString& operator=(const char* text) { assign(text); return *this; }
+  PooledString& operator=(const String& text) { assign(text.c_str()); return *this; }
+
+  void assign(const char* text, size_t capacity = STRING_POOL_MAX_LENGTH);
+
+  const char* c_str() const { return StringPool::instance().get(id); }
+  // ArduinoJson copies a char* but only links a const char*.
+  char* forJson() const { return const_cast<char*>(c_str()); }
+  size_t length() const { return StringPool::instance().length(id); }
+  uint16_t handle() const { return id; }
+
+private:
+  uint16_t id = 0;
+};
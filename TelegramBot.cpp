@@ -1,7 +1,6 @@
 #include "TelegramBot.h"
 
 constexpr size_t MESSAGE_BUFFER_SIZE = 4096;
-constexpr size_t JSON_BUFFER_SIZE = 1024;
 const int MAX_PART_LENGTH = 3000;
 
 TelegramBot::TelegramBot(Settings& ws, WebServer& webServer, Logger& logger, AppState& appState, Ota& ota, Info& sysInfo, DeviceManager& deviceManager)
@@ -65,10 +64,11 @@ void TelegramBot::begin() {
 }
 
 void TelegramBot::sendSimpleStatus(int64_t chatId) {
-  if (deviceManager.myDevices.empty()) {
+  const Device* current = deviceManager.currentDevice();
+  if (!current) {
     TBMessage msg;
     msg.chatId = chatId;
-    myBot.sendMessage(msg, "❌ Устройства не настроены.");
+    sendMessage(msg, "❌ Устройства не настроены.");
     return;
   }
 
@@ -76,7 +76,7 @@ void TelegramBot::sendSimpleStatus(int64_t chatId) {
   char messageBuffer[STATUS_BUFFER_SIZE];
   int offset = 0;
 
-  const Device& currentDevice = deviceManager.myDevices[deviceManager.currentDeviceIndex];
+  const Device& currentDevice = *current;
 
   offset += snprintf(messageBuffer + offset, STATUS_BUFFER_SIZE - offset,
                      "📊 Текущий статус системы\n\n"
@@ -90,10 +90,10 @@ void TelegramBot::sendSimpleStatus(int64_t chatId) {
       outputRelayCount++;
       offset += snprintf(messageBuffer + offset, STATUS_BUFFER_SIZE - offset,
                          "%s | /on%d /off%d | %s | %s\n\n",
-                         relay.description,
+                         relay.description.c_str(),
                          outputRelayCount,
                          outputRelayCount,
-                         relay.statePin ? "✅ ВКЛ" : "❌ ВЫКЛ",
+                         currentDevice.runtime.output(i) ? "✅ ВКЛ" : "❌ ВЫКЛ",
                          relay.manualMode ? "🔧 Ручной" : "🤖 Авто");
     }
   }
@@ -127,7 +127,7 @@ void TelegramBot::sendSimpleStatus(int64_t chatId) {
 
   TBMessage msg;
   msg.chatId = chatId;
-  myBot.sendMessage(msg, messageBuffer);
+  sendMessage(msg, messageBuffer);
 }
 
 void TelegramBot::sendHelpMessage(int64_t chatId) {
@@ -152,13 +152,14 @@ void TelegramBot::sendHelpMessage(int64_t chatId) {
                          "• /reset — Перезагрузить устройство\n"
                          "• /update — Обновить файл или прошивку\n"
                          "• /get — Получить файл с устройства (/get log.txt)\n"
+                         "• /mem — Расход памяти по подсистемам\n"
                          "• /newtoken &lt;token&gt; — Установить новый токен\n\n"
                          "📌 <i>Некоторые команды требуют прав доступа.</i>";
 
   TBMessage msg;
   msg.chatId = chatId;
   myBot.setFormattingStyle(AsyncTelegram2::FormatStyle::HTML);
-  myBot.sendMessage(msg, messageBuffer);
+  sendMessage(msg, messageBuffer);
   myBot.setFormattingStyle(AsyncTelegram2::FormatStyle::MARKDOWN);
 }
 
@@ -173,7 +174,9 @@ bool TelegramBot::hasPermission(const String& userId, const String& permission)
 }
 
 int TelegramBot::getOutputRelayNumber(size_t relayIndex) {
-  const Device& currentDevice = deviceManager.myDevices[deviceManager.currentDeviceIndex];
+  const Device* current = deviceManager.currentDevice();
+  if (!current) return 0;
+  const Device& currentDevice = *current;
   int outputNumber = 0;
   for (size_t i = 0; i <= relayIndex; i++) {
     if (i < currentDevice.relays.size() && currentDevice.relays[i].isOutput) {
@@ -187,7 +190,7 @@ void TelegramBot::handleRelayCommand(int64_t chatId, const String& command) {
   TBMessage msg;
   msg.chatId = chatId;
   if (!hasPermission(String(chatId), "writing")) {
-    myBot.sendMessage(msg, "❌ У вас нет прав для выполнения этой команды.");
+    sendMessage(msg, "❌ У вас нет прав для выполнения этой команды.");
     return;
   }
 
@@ -207,12 +210,18 @@ void TelegramBot::handleRelayCommand(int64_t chatId, const String& command) {
     action = "reset_all";
   }
 
+  const Device* current = deviceManager.currentDevice();
+  if (!current) {
+    sendMessage(msg, "❌ Устройства не настроены.");
+    return;
+  }
+  const Device& currentDevice = *current;
+
   if (action != "reset_all") {
     if (relayNumber <= 0) {
-      myBot.sendMessage(msg, "❌ Неверный формат команды. Используйте /on1, /off2 и т.д.");
+      sendMessage(msg, "❌ Неверный формат команды. Используйте /on1, /off2 и т.д.");
       return;
     }
-    const Device& currentDevice = deviceManager.myDevices[deviceManager.currentDeviceIndex];
     int currentOutputNumber = 0;
     bool relayFound = false;
     for (size_t i = 0; i < currentDevice.relays.size(); ++i) {
@@ -226,16 +235,15 @@ void TelegramBot::handleRelayCommand(int64_t chatId, const String& command) {
       }
     }
     if (!relayFound || relayIndex < 0) {
-      myBot.sendMessage(msg, "❌ Реле с номером " + String(relayNumber) + " не существует.");
+      sendMessage(msg, "❌ Реле с номером " + String(relayNumber) + " не существует.");
       return;
     }
   }
 
-  StaticJsonDocument<JSON_BUFFER_SIZE> doc;
+  JsonDocument& doc = commandArena.acquire();
   if (action == "reset_all") {
     doc["action"] = "reset_all";
   } else {
-    const Device& currentDevice = deviceManager.myDevices[deviceManager.currentDeviceIndex];
     doc["relay"] = currentDevice.relays[relayIndex].id;
     doc["action"] = action;
   }
@@ -245,14 +253,13 @@ void TelegramBot::handleRelayCommand(int64_t chatId, const String& command) {
     if (action == "reset_all") {
       successMsg += "Все реле сброшены в автоматический режим";
     } else {
-      const Device& currentDevice = deviceManager.myDevices[deviceManager.currentDeviceIndex];
-      String relayName = currentDevice.relays[relayIndex].description;
+      String relayName = currentDevice.relays[relayIndex].description.c_str();
       successMsg += String(action == "on" ? "Включено" : "Выключено") + " реле " + String(relayNumber) + " (" + relayName + ")";
     }
-    myBot.sendMessage(msg, successMsg.c_str());
+    sendMessage(msg, successMsg.c_str());
     sendSimpleStatus(chatId);
   } else {
-    myBot.sendMessage(msg, "❌ Не удалось выполнить команду: " + command);
+    sendMessage(msg, "❌ Не удалось выполнить команду: " + command);
   }
 }
 
@@ -260,14 +267,15 @@ void TelegramBot::handleSystemToggleCommand(int64_t chatId, const String& comman
   if (!hasPermission(String(chatId), "writing")) {
     TBMessage msg;
     msg.chatId = chatId;
-    myBot.sendMessage(msg, "❌ У вас нет прав для выполнения этой команды.");
+    sendMessage(msg, "❌ У вас нет прав для выполнения этой команды.");
     return;
   }
-  if (deviceManager.myDevices.empty() || deviceManager.currentDeviceIndex >= deviceManager.myDevices.size()) {
+  Device* current = deviceManager.currentDevice();
+  if (!current) {
     return;
   }
 
-  Device& device = deviceManager.myDevices[deviceManager.currentDeviceIndex];
+  Device& device = *current;
   bool stateChanged = false;
 
   if (command == "/timers_on") {
@@ -356,7 +364,11 @@ void TelegramBot::handleSystemToggleCommand(int64_t chatId, const String& comman
   }
 
   if (stateChanged) {
-    settings.saveSettings();
+    if (command.startsWith("/push_")) {
+      settings.saveSettings();
+    } else {
+      deviceManager.markDirty(deviceManager.currentDeviceIndex, DEVICE_SECTION_FLAGS | DEVICE_SECTION_TEMPERATURE);
+    }
   }
   sendSimpleStatus(chatId);
 }
@@ -397,7 +409,7 @@ void TelegramBot::loop() {
     if (myBot.getNewMessage(msg)) {
       String userId = String(msg.sender.id);
       if (!hasPermission(userId, "reading")) {
-        myBot.sendMessage(msg, "❌ Доступ запрещен.");
+        sendMessage(msg, "❌ Доступ запрещен.");
         return;
       }
       if (msg.messageType == MessageText) {
@@ -412,15 +424,18 @@ void TelegramBot::loop() {
         }
         else if (text == "/reset" || text == "reset") {
           if (hasPermission(userId, "writing")) {
-            myBot.sendMessage(msg, "🔄 Перезагрузка устройства...");
+            sendMessage(msg, "🔄 Перезагрузка устройства...");
             doRestart = true;
           }
           else {
-            myBot.sendMessage(msg, "❌ Нет прав на перезагрузку.");
+            sendMessage(msg, "❌ Нет прав на перезагрузку.");
           }
         }
+        else if (text == "/mem" || text == "mem") {
+          sendMemoryReport(msg.sender.id);
+        }
         else if (text == "/update" || text == "update") {
-          myBot.sendMessage(msg, "📲 Отправьте файл прошивки (.bin) для обновления.");
+          sendMessage(msg, "📲 Отправьте файл прошивки (.bin) для обновления.");
         }
         else if (text.startsWith("/newtoken")) {
           if (hasPermission(userId, "writing")) {
@@ -428,15 +443,18 @@ void TelegramBot::loop() {
             newToken.trim();
             if (isValidTokenFormat(newToken)) {
               settings.ws.telegramSettings.botId = newToken;
-              settings.saveSettings();
-              myBot.sendMessage(msg, "✅ Новый токен сохранен. Бот будет перезапущен.");
+              if (settings.saveSettingsNow()) {
+                sendMessage(msg, "✅ Новый токен сохранен. Бот будет перезапущен.");
+              } else {
+                sendMessage(msg, "⚠️ Токен применен, но не сохранен. Бот будет перезапущен.");
+              }
               isBegin = false;
               begin();
             } else {
-              myBot.sendMessage(msg, "❌ Неверный формат токена.");
+              sendMessage(msg, "❌ Неверный формат токена.");
             }
           } else {
-            myBot.sendMessage(msg, "❌ Нет прав на смену токена.");
+            sendMessage(msg, "❌ Нет прав на смену токена.");
           }
         }
         else if (text == "/resetmanual" || text == "resetmanual") {
@@ -463,14 +481,14 @@ void TelegramBot::loop() {
               sendDocument(msg, AsyncTelegram2::DocumentType::TEXT, fullPath.c_str(), "This is caption");
             } else {
               Serial.println("File not found: " + fullPath);
-              myBot.sendMessage(msg, "❌ File not found: " + filename);
+              sendMessage(msg, "❌ File not found: " + filename);
             }
           } else {
-            myBot.sendMessage(msg, "📁 Please specify a filename: /get filename.txt");
+            sendMessage(msg, "📁 Please specify a filename: /get filename.txt");
           }
         }
         else {
-          myBot.sendMessage(msg, "❓ Неизвестная команда. Используйте /help для списка команд.");
+          sendMessage(msg, "❓ Неизвестная команда. Используйте /help для списка команд.");
         }
       }
       else if (msg.messageType == MessageQuery) {
@@ -489,10 +507,10 @@ void TelegramBot::loop() {
           }
         }
         else if (callbackData == "update") {
-          myBot.sendMessage(msg, "📲 Отправьте файл прошивки (.bin) для обновления.");
+          sendMessage(msg, "📲 Отправьте файл прошивки (.bin) для обновления.");
         }
         else if (callbackData == "newtoken") {
-          myBot.sendMessage(msg, "🔑 Отправьте команду в виде: /newtoken ВАШ_НОВЫЙ_ТОКЕН");
+          sendMessage(msg, "🔑 Отправьте команду в виде: /newtoken ВАШ_НОВЫЙ_ТОКЕН");
         }
         else if (callbackData == "resetmanual") {
           handleRelayCommand(msg.sender.id, "resetmanual");
@@ -521,9 +539,9 @@ void TelegramBot::loop() {
           InlineKeyboard confirmKbd;
           confirmKbd.addButton("✅ FLASH", CONFIRM, KeyboardButtonQuery);
           confirmKbd.addButton("❌ CANCEL", CANCEL, KeyboardButtonQuery);
-          myBot.sendMessage(msg, report.c_str(), confirmKbd);
+          sendMessage(msg, report.c_str(), confirmKbd);
         } else {
-          myBot.sendMessage(msg, "❌ Файл недоступен. Возможно превышен лимит 20MB или файл удален.");
+          sendMessage(msg, "❌ Файл недоступен. Возможно превышен лимит 20MB или файл удален.");
         }
       }
     }
@@ -585,9 +603,22 @@ void TelegramBot::checkMemory() {
 #elif defined(ESP32)
   Serial.printf("Free heap: %d bytes\n", ESP.getFreeHeap());
   Serial.printf("Free sketch space: %d bytes\n", ESP.getFreeSketchSpace());
+  MemTrack::print();
 #endif
 }
 
+void TelegramBot::sendMemoryReport(int64_t chatId) {
+  char buffer[1536];
+  size_t offset = snprintf(buffer, sizeof(buffer), "🧠 Память\n<pre>");
+  offset += MemTrack::format(buffer + offset, sizeof(buffer) - offset - 8);
+  snprintf(buffer + offset, sizeof(buffer) - offset, "</pre>");
+
+  TBMessage msg;
+  msg.chatId = chatId;
+  myBot.setFormattingStyle(AsyncTelegram2::FormatStyle::HTML);
+  sendMessage(msg, buffer);
+}
+
 void TelegramBot::sendDocument(TBMessage &msg, AsyncTelegram2::DocumentType fileType, const char* filename, const char* caption) {
   Serial.print("\nFilename: "); Serial.println(filename);
 
@@ -600,10 +631,11 @@ void TelegramBot::sendDocument(TBMessage &msg, AsyncTelegram2::DocumentType file
     return;
   }
 
-  File file = SPIFFS.open(filename, "r");
-  if (file) {
-    myBot.sendDocument(msg, file, file.size(), fileType, file.name(), caption);
-    myBot.sendMessage(msg, "✅ Log file sent");
+  PersistedFile file;
+  if (Persistence::openPayload(filename, file)) {
+    const char* name = strrchr(filename, '/');
+    myBot.sendDocument(msg, file, file.size(), fileType, name ? name + 1 : filename, caption);
+    sendMessage(msg, "✅ Log file sent");
     file.close();
   } else {
     Serial.println("❌ Can't open file. Upload \"data\" folder to filesystem");
@@ -711,7 +743,7 @@ bool TelegramBot::sendLogMessage(const LogEntry & logEntry, int64_t chatId) {
            typePrefix,
            logEntry.message);
 
-  bool success = myBot.sendMessage(msg, formattedMessage, nullptr, true);
+  bool success = sendMessage(msg, formattedMessage, nullptr, true);
 
 #ifdef LOGGER_DEBUG
   if (success) {
@@ -783,7 +815,8 @@ void TelegramBot::updateBotCommandsOnServer(bool start) {
     {"status", "Текущий статус устройства"},
     {"help", "Справка по командам"},
     {"reset", "Перезагрузить устройство"},
-    {"update", "Обновить прошивку"}
+    {"update", "Обновить прошивку"},
+    {"mem", "Расход памяти по подсистемам"}
   };
   const int numCommands = sizeof(commands) / sizeof(commands[0]);
 
@@ -24,6 +24,9 @@ public:
     void checkMemory();
     bool isValidTokenFormat(const String& token);
 
+    uint32_t getSentMessages() const { return sentMessages; }
+    uint32_t getFailedMessages() const { return failedMessages; }
+
     AsyncTelegram2 myBot;
 
 private:
@@ -35,6 +38,18 @@ private:
     Info& sysInfo;
     DeviceManager& deviceManager;
 
+    uint32_t sentMessages = 0;
+    uint32_t failedMessages = 0;
+
+    // Every outgoing message goes through here so sends can be counted.
+    template <typename... Args>
+    bool sendMessage(Args&&... args) {
+      bool sent = myBot.sendMessage(std::forward<Args>(args)...);
+      if (sent) sentMessages++;
+      else failedMessages++;
+      return sent;
+    }
+
     unsigned long lastLogCheckTime = 0;
     const unsigned long LOG_CHECK_INTERVAL = 5000;
 
@@ -50,6 +65,7 @@ private:
 
     void sendSimpleStatus(int64_t chatId);
     void sendHelpMessage(int64_t chatId);
+    void sendMemoryReport(int64_t chatId);
     void handleRelayCommand(int64_t chatId, const String& command);
     void handleSystemToggleCommand(int64_t chatId, const String& command);
     bool hasPermission(const String& userId, const String& permission);
@@ -58,6 +74,7 @@ private:
     void doRestartProcedure();
 
     std::vector<std::pair<LogEntry*, uint8_t>> _unsentLogsBuffer;
+    JsonArena commandArena{"tg.command", 256};
 
 #ifdef ESP32
     static constexpr uint32_t MIN_FREE_MEMORY = 8 * 1024;
@@ -2,18 +2,19 @@
 
 WebServer* WebServer::instance = nullptr;
 
-WebServer::WebServer(WiFiManager& wifiManager, Settings& ws, DeviceManager& deviceManager,  TimeModule& timeModule, Info& sysInfo, Ota& ota, Logger& logger, AppState& appState)
+WebServer::WebServer(WiFiManager& wifiManager, Settings& ws, DeviceManager& deviceManager,  TimeModule& timeModule, Info& sysInfo, Ota& ota, Logger& logger, AppState& appState, ConfigBundle& configBundle)
   : wifiManager(wifiManager),
     appState(appState),
+    configBundle(configBundle),
     settings(ws),
     deviceManager(deviceManager),
     timeModule(timeModule),
     sysInfo(sysInfo),
     ota(ota),
-    logger(logger),
-    isControlOpen(false)
+    logger(logger)
 {
   instance = this;
+  buildRouteTable();
 
   logger.setNewLogCallback([this](const LogEntry & entry) {
     this->broadcastNewLog(entry);
@@ -24,7 +25,7 @@ WebServer::~WebServer() {
   logger.removeNewLogCallback();
 
   if (saveJson.rawPayload != nullptr) {
-    free(saveJson.rawPayload);
+    PsramAllocator().deallocate(saveJson.rawPayload);
     saveJson.rawPayload = nullptr;
     Serial.println("[WebServer] Destructor: Cleaned up pending saveJson buffer.");
   }
@@ -32,17 +33,12 @@ WebServer::~WebServer() {
 
 void WebServer::begin() {
 
-  webSocket.begin();
+  selectIndexAsset();
 
-webSocket.onEvent([](uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
-if (WebServer::instance) {
-
-WebServer::instance->handleWebSocketEvent(num, type, payload, length);
-
-}
-});
-
-  DefaultHeaders::Instance().addHeader("Connection", "close");
+  webSocket.onEvent([this](uint8_t num, WsEventType type, uint8_t* payload, size_t length) {
+    handleWebSocketEvent(num, type, payload, length);
+  });
+  webSocket.begin(server);
 
   server.on("/", HTTP_GET, [this](AsyncWebServerRequest * request) {
 _webServerIsBusy = true;
@@ -50,6 +46,15 @@ _webServerIsBusy = true;
     _webServerIsBusy = false;
   });
 
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset& asset = WEB_ASSETS[i];
+    if (strcmp(asset.path, "/") == 0) continue;
+
+    server.on(asset.path, HTTP_GET, [this, &asset](AsyncWebServerRequest * request) {
+      request->send(getAssetResponse(request, asset));
+    });
+  }
+
   server.onNotFound([this](AsyncWebServerRequest * request) {
     request->send(getIndexResponse(request));
   });
@@ -68,6 +73,9 @@ _webServerIsBusy = true;
     this->ota.handleFileUpload(request, filename, index, data, len, final);
 
      if (final) {
+        if (filename.startsWith("index.html")) {
+          selectIndexAsset();
+        }
         _webServerIsBusy = false;
         Serial.println("[WebServer] File upload finished. Server is now free.");
       }
@@ -87,17 +95,62 @@ _webServerIsBusy = true;
         Serial.println("Failed to mount SPIFFS");
       }
 
-      if (!SPIFFS.exists(filename)) {
+      // Persisted files end in a CRC footer that is not part of their content.
+      std::shared_ptr<PersistedFile> file = std::make_shared<PersistedFile>();
+      if (!Persistence::openPayload(filename.c_str(), *file)) {
         request->send(404, "text/plain", "Файл не найден");
         return;
       }
 
-      request->send(SPIFFS, filename, "application/octet-stream");
+      request->send(request->beginResponse("application/octet-stream", file->size(),
+      [file](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+        return file->readBytes(reinterpret_cast<char*>(buffer), maxLen);
+      }));
     } else {
       request->send(400, "text/plain", "Некорректный запрос");
     }
   });
 
+  server.on("/backup", HTTP_GET, [this](AsyncWebServerRequest * request) {
+    std::shared_ptr<ConfigBundle::Exporter> exporter = configBundle.createExporter();
+    if (!exporter) {
+      request->send(503, "text/plain", "Недостаточно памяти");
+      return;
+    }
+
+    AsyncWebServerResponse* response = request->beginChunkedResponse("application/octet-stream",
+    [exporter](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+      return exporter->read(buffer, maxLen);
+    });
+    response->addHeader("Content-Disposition", "attachment; filename=\"config.cfgz\"");
+    request->send(response);
+  });
+
+  server.on("/restore", HTTP_POST,
+  [this](AsyncWebServerRequest * request) {
+    if (configBundle.importError()) {
+      request->send(400, "text/plain", configBundle.importError());
+    } else {
+      request->send(200, "text/plain", "Accepted, restarting");
+    }
+  },
+  [this](AsyncWebServerRequest * request, String filename, size_t index,
+         uint8_t *data, size_t len, bool final) {
+    if (index == 0) {
+      _webServerIsBusy = true;
+      configBundle.beginImport();
+    }
+
+    configBundle.writeImport(data, len);
+
+    if (final) {
+      configBundle.endImport();
+      _webServerIsBusy = false;
+    }
+  });
+
+  restApi.begin(server);
+
   server.begin();
   Serial.println("WEB SERVER IS BEGIN");
 }
@@ -111,23 +164,16 @@ void WebServer::stopServer() {
   Serial.println("WEB SERVER IS STOP");
 }
 
-AsyncWebServerResponse * WebServer::getIndexResponse(AsyncWebServerRequest * request) {
-
+void WebServer::selectIndexAsset() {
   bool hasHtml = SPIFFS.exists("/index.html");
   bool hasGz = SPIFFS.exists("/index.html.gz");
   time_t htmlTime = 0, gzTime = 0;
 
-  time_t now = time(nullptr);
-
-  Serial.printf("[WebServer] File check: HTML=%s, GZ=%s\n",
-                hasHtml ? "yes" : "no", hasGz ? "yes" : "no");
-
   if (hasHtml) {
     File htmlFile = SPIFFS.open("/index.html", "r");
     if (htmlFile) {
       htmlTime = htmlFile.getLastWrite();
       htmlFile.close();
-      Serial.printf("[WebServer] HTML file time: %s", ctime(&htmlTime));
     }
   }
 
@@ -136,51 +182,83 @@ AsyncWebServerResponse * WebServer::getIndexResponse(AsyncWebServerRequest * req
     if (gzFile) {
       gzTime = gzFile.getLastWrite();
       gzFile.close();
-      Serial.printf("[WebServer] GZ file time: %s", ctime(&gzTime));
     }
   }
 
-  AsyncWebServerResponse *response = nullptr;
-  String selectedFile = "";
-  String reason = "";
-
   if (hasHtml && (!hasGz || htmlTime > gzTime)) {
-    response = request->beginResponse(SPIFFS, "/index.html", "text/html");
-    selectedFile = "/index.html";
-    if (!hasGz) {
-      reason = "GZ file not exists";
-    } else {
-      reason = "HTML is newer (HTML: " + String(htmlTime) + " > GZ: " + String(gzTime) + ")";
-    }
+    indexAsset.path = "/index.html";
+    indexAsset.gzip = false;
+  } else if (hasGz) {
+    indexAsset.path = "/index.html.gz";
+    indexAsset.gzip = true;
+  } else {
+    indexAsset.path = nullptr;
+    indexAsset.gzip = true;
+    indexAsset.size = WEB_ASSETS[0].length;
+    strncpy(indexAsset.etag, WEB_ASSETS[0].etag, sizeof(indexAsset.etag) - 1);
   }
-  else if (hasGz) {
-    response = request->beginResponse(SPIFFS, "/index.html.gz", "text/html");
-    response->addHeader("Content-Encoding", "gzip");
-    selectedFile = "/index.html.gz";
-    if (!hasHtml) {
-      reason = "HTML file not exists";
-    } else {
-      reason = "GZ is newer or equal (GZ: " + String(gzTime) + " >= HTML: " + String(htmlTime) + ")";
+
+  if (indexAsset.path) {
+    uint32_t crc = 0xFFFFFFFF;
+    File file = SPIFFS.open(indexAsset.path, "r");
+    indexAsset.size = file ? file.size() : 0;
+
+    uint8_t buffer[256];
+    size_t chunk;
+    while (file && (chunk = file.read(buffer, sizeof(buffer))) > 0) {
+      crc = CrcPrint::update(crc, buffer, chunk);
+      yield();
     }
+    if (file) file.close();
+    snprintf(indexAsset.etag, sizeof(indexAsset.etag), "\"%08x\"", ~crc);
+  }
+
+  Serial.printf("[WebServer] Index asset: %s, %u bytes, ETag %s\n",
+                indexAsset.path ? indexAsset.path : "EMBEDDED", indexAsset.size, indexAsset.etag);
+}
+
+AsyncWebServerResponse * WebServer::getIndexResponse(AsyncWebServerRequest * request) {
+  AsyncWebServerResponse *response = nullptr;
+  const AsyncWebHeader* ifNoneMatch = request->getHeader("If-None-Match");
+  bool notModified = ifNoneMatch && ifNoneMatch->value() == indexAsset.etag;
+
+  if (notModified) {
+    response = request->beginResponse(304);
+  } else if (indexAsset.path && SPIFFS.exists(indexAsset.path)) {
+    response = request->beginResponse(SPIFFS, indexAsset.path, "text/html; charset=utf-8");
+  } else {
+    response = request->beginResponse_P(200, WEB_ASSETS[0].contentType, WEB_ASSETS[0].data, WEB_ASSETS[0].length);
   }
-  else {
-    response = request->beginResponse_P(200, "text/html", index_html_gz, index_html_gz_len);
+
+  if (!notModified && indexAsset.gzip) {
     response->addHeader("Content-Encoding", "gzip");
-    selectedFile = "EMBEDDED";
-    reason = "No files in SPIFFS, using built-in";
   }
 
-  Serial.printf("[WebServer] Selected: %s, Reason: %s\n",  selectedFile.c_str(), reason.c_str());
+  // Navigations within a day come from the browser cache. A reload, or any
+  // request after that, revalidates against the content ETag and gets a
+  // bodiless 304 unless the UI was replaced; the hashed assets it references
+  // are cached for good either way.
+  response->addHeader("ETag", indexAsset.etag);
+  response->addHeader("Date", getHTTPDate(time(nullptr)));
+  response->addHeader("Cache-Control", INDEX_CACHE_CONTROL);
+  response->addHeader("Access-Control-Allow-Origin", "*");
 
-  response->addHeader("Content-Type", "text/html; charset=utf-8");
-  response->addHeader("ETag", "\"" + String(now) + "\"");
-  response->addHeader("Date", getHTTPDate(now));
+  return response;
+}
 
-  response->addHeader("Cache-Control", "no-store");
-  response->addHeader("Access-Control-Allow-Origin", "*");
+AsyncWebServerResponse * WebServer::getAssetResponse(AsyncWebServerRequest * request, const WebAsset& asset) {
+  AsyncWebServerResponse *response = nullptr;
+  const AsyncWebHeader* ifNoneMatch = request->getHeader("If-None-Match");
 
-  Serial.printf("Free heap after call WEB PAGE: %d\n", ESP.getFreeHeap());
+  if (ifNoneMatch && ifNoneMatch->value() == asset.etag) {
+    response = request->beginResponse(304);
+  } else {
+    response = request->beginResponse_P(200, asset.contentType, asset.data, asset.length);
+    response->addHeader("Content-Encoding", "gzip");
+  }
 
+  response->addHeader("ETag", asset.etag);
+  response->addHeader("Cache-Control", asset.immutable ? "public, max-age=31536000, immutable" : "no-cache");
   return response;
 }
 
@@ -194,22 +272,22 @@ String WebServer::getHTTPDate(time_t timestamp) {
 
 void WebServer::broadcastNewLog(const LogEntry& entry) {
 
-  if (loggingClients.empty()) {
+  if (!(subscribedTopics() & bit(WS_TOPIC_LOGS))) {
     return;
   }
 
-  DynamicJsonDocument doc(512);
+  JsonDocument& doc = logArena.acquire();
   doc["event"] = "new_log";
   doc["timestamp"] = entry.timestamp;
   doc["message"] = entry.message;
   doc["isSay"] = entry.isSay;
 
-  String json;
-  serializeJson(doc, json);
-
-  for (uint8_t clientId : loggingClients) {
-    webSocket.sendTXT(clientId, json);
+  size_t length = logArena.serialize();
+  if (length == 0) {
+    return;
   }
+
+  sendToSubscribers(WS_TOPIC_LOGS, logArena.text(), length);
   yield();
 }
 
@@ -251,7 +329,7 @@ void WebServer::handleSaveNetworkWS(uint8_t num, JsonObject doc) {
 
   const char* ssid = doc["ssid"] | "";
   if (strlen(ssid) == 0) {
-    webSocket.sendTXT(num, "{\"event\":\"error\",\"message\":\"ssid_required\"}");
+    sendText(num, "{\"event\":\"error\",\"message\":\"ssid_required\"}");
     return;
   }
 
@@ -300,7 +378,7 @@ void WebServer::handleDeleteNetworkWS(uint8_t num, JsonObject doc) {
   int deletedIndex = -1;
 
   if (strlen(ssid) == 0) {
-    webSocket.sendTXT(num, "{\"event\":\"error\",\"message\":\"missing_ssid\"}");
+    sendText(num, "{\"event\":\"error\",\"message\":\"missing_ssid\"}");
     return;
   }
 
@@ -313,7 +391,7 @@ void WebServer::handleDeleteNetworkWS(uint8_t num, JsonObject doc) {
   }
 
   if (deletedIndex == -1) {
-    webSocket.sendTXT(num, "{\"event\":\"error\",\"message\":\"network_not_found\"}");
+    sendText(num, "{\"event\":\"error\",\"message\":\"network_not_found\"}");
     return;
   }
 
@@ -334,7 +412,7 @@ void WebServer::handleDeleteNetworkWS(uint8_t num, JsonObject doc) {
 }
 
 void  WebServer::sendCurrentState(uint8_t num) {
-  StaticJsonDocument<2048> doc;
+  PsramJsonDocument doc(2048);
 
   doc["event"] = "state";
   doc["currentNetwork"] = settings.ws.currentIdNetworkSetting;
@@ -353,7 +431,7 @@ void  WebServer::sendCurrentState(uint8_t num) {
 
   char buffer[2048];
   size_t len = serializeJson(doc, buffer, sizeof(buffer));
-  webSocket.sendTXT(num, buffer, len);
+  sendText(num, buffer, len);
 }
 
 void WebServer::sendNetworkList(uint8_t num) {
@@ -391,7 +469,7 @@ void WebServer::sendNetworkList(uint8_t num) {
 
   char buffer[1600];
   size_t len = serializeJson(doc, buffer, sizeof(buffer));
-  webSocket.sendTXT(num, buffer, len);
+  sendText(num, buffer, len);
 }
 
 void WebServer::sendSettingsTelegram(uint8_t num) {
@@ -418,59 +496,73 @@ void WebServer::sendSettingsTelegram(uint8_t num) {
 
   char buffer[1024];
   size_t len = serializeJson(doc, buffer, sizeof(buffer));
-  webSocket.sendTXT(num, buffer, len);
+  sendText(num, buffer, len);
 }
 
 void WebServer::sendSettingsDevice(uint8_t num) {
-  const Device& currentDevice = deviceManager.myDevices[deviceManager.currentDeviceIndex];
+  const Device* current = deviceManager.currentDevice();
+  if (!current) {
+    sendText(num, "{\"event\":\"device_error\",\"message\":\"No device\"}");
+    return;
+  }
+  const Device& currentDevice = *current;
 
-  StaticJsonDocument<4096> doc;
+  JsonDocument& doc = deviceArena.acquire();
 
   doc["event"] = "device_setting";
+  deviceManager.serializeDeviceSections(currentDevice, DEVICE_SECTION_ALL | DEVICE_SECTION_RUNTIME, doc.as<JsonObject>());
 
-  String deviceJson = deviceManager.serializeDevice(currentDevice);
-  DynamicJsonDocument deviceDoc(4096);
-  DeserializationError error = deserializeJson(deviceDoc, deviceJson);
-
-  if (error) {
-    Serial.printf("[WebServer] ERROR: Failed to parse device JSON for sending to client. Error: %s\n", error.c_str());
-
-    webSocket.sendTXT(num, "{\"event\":\"device_error\",\"message\":\"Failed to serialize device data\"}");
+  size_t length = doc.overflowed() ? 0 : deviceArena.serialize();
+  if (length > 0) {
+    sendText(num, deviceArena.text(), length);
     return;
   }
 
-  JsonObject deviceObj = deviceDoc.as<JsonObject>();
-  for (JsonPair kv : deviceObj) {
-    doc[kv.key()] = kv.value();
+  // A large device outgrows the arena; this one reply gets its own buffers.
+  Serial.println("[WebServer] Device settings exceed the reply arena, using a one-off buffer");
+  PsramJsonDocument large(doc.overflowed() ? DEVICE_JSON_MAX_CAPACITY : 0);
+  JsonDocument& source = doc.overflowed() ? static_cast<JsonDocument&>(large) : doc;
+  if (doc.overflowed()) {
+    large["event"] = "device_setting";
+    deviceManager.serializeDeviceSections(currentDevice, DEVICE_SECTION_ALL | DEVICE_SECTION_RUNTIME, large.as<JsonObject>());
   }
 
-  String output;
-  serializeJson(doc, output);
-  webSocket.sendTXT(num, output);
+  size_t required = source.overflowed() ? 0 : measureJson(source);
+  char* text = required > 0 && required < WS_MESSAGE_MAX_BYTES ?
+               static_cast<char*>(PsramAllocator().allocate(required + 1)) : nullptr;
+  if (!text) {
+    Serial.printf("[WebServer] ERROR: Device settings do not fit (%u bytes).\n", (unsigned)required);
+    sendText(num, "{\"event\":\"device_error\",\"message\":\"Failed to serialize device data\"}");
+    return;
+  }
+
+  length = serializeJson(source, text, required + 1);
+  sendText(num, text, length);
+  PsramAllocator().deallocate(text);
 }
 
 void WebServer::handleSaveSettingsDevice(uint8_t num, JsonObject json) {
   bool success = false;
+  const char* error = nullptr;
 
   if (json.containsKey("deviceSettings")) {
     Serial.println("DeviceSettings: call seve");
 
-    JsonObject deviceSettings = json["deviceSettings"];
-    Device& currentDevice = deviceManager.myDevices[deviceManager.currentDeviceIndex];
-    success = deviceManager.deserializeDevice(deviceSettings, currentDevice);
-
-    deviceManager.isSaveControl = true;
+    // Control swaps the validated copy in on its next pass.
+    success = deviceManager.stageDevice(deviceManager.currentDeviceIndex, json["deviceSettings"], error);
   } else {
     Serial.println("ERROR: Key 'deviceSettings' not found in JSON");
     success = false;
   }
 
   if (success) {
-    webSocket.sendTXT(num, "{\"event\":\"device\",\"success\":true,\"message\":\"DeviceManager settings saved successfully\"}");
-    deviceManager.isSaveControl = true;
+    sendText(num, "{\"event\":\"device\",\"success\":true,\"message\":\"DeviceManager settings saved successfully\"}");
     Serial.println("DeviceManager settings saved successfully");
   } else {
-    webSocket.sendTXT(num, "{\"event\":\"device\",\"success\":false,\"message\":\"Failed to save DeviceManager settings\"}");
+    String response = "{\"event\":\"device\",\"success\":false,\"message\":\"Failed to save DeviceManager settings\"";
+    if (error) response += ",\"error\":\"" + String(error) + "\"";
+    response += "}";
+    sendText(num, response);
     Serial.println("Failed to save DeviceManager settings");
   }
 }
@@ -532,274 +624,438 @@ void WebServer::handleSaveDateTime(uint8_t num, JsonObject json) {
                  "\"success\":" + String(success ? "true" : "false") + ","
                  "\"message\":\"" + String(success ? "Time settings saved successfully" : "Time settings saved failed") + "\""
                  "}";
-    webSocket.sendTXT(num, msg);
+    sendText(num, msg);
     return;
   }
 
-  webSocket.sendTXT(num,
+  sendText(num,
                     "{\"event\":\"timeStatus\","
                     "\"success\":false,"
                     "\"message\":\"Invalid date or time format\""
                     "}");
 }
 
-void WebServer::handleWebSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
+void WebServer::handleWebSocketEvent(uint8_t num, WsEventType type, uint8_t* payload, size_t length) {
 
-   if (type == WStype_TEXT && WiFi.status() != WL_CONNECTED && !(WiFi.getMode() & WIFI_AP)) {
+   if (type == WS_EVENT_TEXT && WiFi.status() != WL_CONNECTED && !(WiFi.getMode() & WIFI_AP)) {
     Serial.printf("[WebServer] Rejecting request from %d, WiFi not connected and AP is not running.\n", num);
     webSocket.disconnect(num);
     return;
 }
 
   switch (type) {
-    case WStype_DISCONNECTED:
+    case WS_EVENT_DISCONNECTED:
       Serial.printf("[%u] Disconnected\n", num);
-
-      loggingClients.erase(std::remove(loggingClients.begin(), loggingClients.end(), num), loggingClients.end());
+      resetClientSync(num);
+      if (num < WS_MAX_CLIENTS) {
+        clientLink[num] = ClientLink();
+        outbox[num].clear();
+      }
       if (lastResult.clientNum == num ) {
         isClientConnect = false;
       }
 
       break;
 
-    case WStype_CONNECTED: {
+    case WS_EVENT_CONNECTED: {
         IPAddress ip = webSocket.remoteIP(num);
         Serial.printf("[%u] Connected from %d.%d.%d.%d\n", num, ip[0], ip[1], ip[2], ip[3]);
 
+        if (num < WS_MAX_CLIENTS) {
+          clientLink[num] = ClientLink();
+          clientLink[num].since = millis();
+          outbox[num].clear();
+        }
+
         if (lastResult.clientNum == num ) {
           isClientConnect = true;
         }
         break;
       }
 
-   case WStype_TEXT: {
+    case WS_EVENT_TEXT:
+      dispatchCommand(num, payload, length);
+      break;
 
-      DynamicJsonDocument doc(8192);
-      DeserializationError error = deserializeJson(doc, payload, length);
+    default:
+      break;
+  }
+  _webServerIsBusy = false;
+}
 
-      if (error) {
-        Serial.printf("[%u] JSON parse error: %s\n", num, error.c_str());
+#define WS_ROUTE(name, handler, arena, maxPayload, busy) \
+  { wsEventHash(name), name, &WebServer::handler, arena, maxPayload, busy }
+
+// Small commands parse into commandArena; anything that carries settings gets
+// the 8 KB requestArena. saveDeviceSettings is parsed later, in loop().
+const WebServer::WsRoute WebServer::WS_ROUTES[] = {
+  WS_ROUTE("ping", onPing, &WebServer::commandArena, 128, false),
+  WS_ROUTE("get_mem", onGetMem, &WebServer::commandArena, 128, false),
+  WS_ROUTE("get_route_stats", onGetRouteStats, &WebServer::commandArena, 128, false),
+  WS_ROUTE("scan", onScan, &WebServer::commandArena, 128, true),
+  WS_ROUTE("get_networks", onGetNetworks, &WebServer::commandArena, 128, true),
+  WS_ROUTE("get_current_state", onGetCurrentState, &WebServer::commandArena, 128, true),
+  WS_ROUTE("get_settings_telegram", onGetSettingsTelegram, &WebServer::commandArena, 128, true),
+  WS_ROUTE("get_settings_device", onGetSettingsDevice, &WebServer::commandArena, 128, true),
+  WS_ROUTE("saveTelegramSettings", onSaveTelegramSettings, &WebServer::requestArena, 4096, true),
+  WS_ROUTE("saveDeviceSettings", onSaveDeviceSettings, nullptr, WS_MESSAGE_MAX_BYTES, true),
+  WS_ROUTE("patchDevice", onPatchDevice, &WebServer::requestArena, 4096, true),
+  WS_ROUTE("addNetwork", onAddNetwork, &WebServer::commandArena, 512, true),
+  WS_ROUTE("updateNetwork", onUpdateNetwork, &WebServer::commandArena, 512, true),
+  WS_ROUTE("deleteNetwork", onDeleteNetwork, &WebServer::commandArena, 256, true),
+  WS_ROUTE("saveSettings", onSaveSettings, &WebServer::requestArena, 2048, true),
+  WS_ROUTE("saveDateTime", onSaveDateTime, &WebServer::commandArena, 256, true),
+  WS_ROUTE("test_connection", onTestConnection, &WebServer::commandArena, 512, true),
+  WS_ROUTE("subscribe", onSubscribe, &WebServer::commandArena, 256, true),
+  WS_ROUTE("unsubscribe", onUnsubscribe, &WebServer::commandArena, 256, true),
+  WS_ROUTE("event_logs_clear", onLogsClear, &WebServer::commandArena, 128, false),
+  WS_ROUTE("event_logs_save", onLogsSave, &WebServer::commandArena, 128, true),
+  WS_ROUTE("set_protocol", onSetProtocol, &WebServer::commandArena, 128, false),
+  WS_ROUTE("relay", onRelay, &WebServer::commandArena, 256, true),
+  WS_ROUTE("reboot", onReboot, &WebServer::commandArena, 128, true),
+  WS_ROUTE("full_reset", onFullReset, &WebServer::commandArena, 128, true),
+};
+
+const size_t WebServer::WS_ROUTE_COUNT = sizeof(WS_ROUTES) / sizeof(WS_ROUTES[0]);
+
+static const uint32_t WS_LATENCY_BOUNDS_US[WS_LATENCY_BUCKETS - 1] = {1000, 5000, 20000, 100000, 500000};
+
+void WebServer::buildRouteTable() {
+  memset(routeTable, 0xFF, sizeof(routeTable));
+
+  if (WS_ROUTE_COUNT > WS_ROUTE_MAX) {
+    Serial.printf("[WebServer] %u routes exceed WS_ROUTE_MAX, extra routes ignored\n", (unsigned)WS_ROUTE_COUNT);
+  }
 
-        webSocket.sendTXT(num, "{\"event\":\"error\",\"message\":\"invalid_json\"}");
-        return;
+  for (size_t i = 0; i < WS_ROUTE_COUNT && i < WS_ROUTE_MAX; i++) {
+    size_t slot = WS_ROUTES[i].hash % WS_ROUTE_TABLE_SIZE;
+    while (routeTable[slot] != 0xFF) {
+      if (WS_ROUTES[routeTable[slot]].hash == WS_ROUTES[i].hash) {
+        Serial.printf("[WebServer] Route hash collision: %s / %s\n", WS_ROUTES[i].name, WS_ROUTES[routeTable[slot]].name);
       }
+      slot = (slot + 1) % WS_ROUTE_TABLE_SIZE;
+    }
+    routeTable[slot] = i;
+  }
+}
 
-      String event = doc["event"] | "";
+int WebServer::findRoute(const char* event) const {
+  uint32_t hash = wsEventHash(event);
 
-      if (event == "ping") {
+  for (size_t slot = hash % WS_ROUTE_TABLE_SIZE, probes = 0;
+       routeTable[slot] != 0xFF && probes < WS_ROUTE_TABLE_SIZE;
+       slot = (slot + 1) % WS_ROUTE_TABLE_SIZE, probes++) {
+    const WsRoute& route = WS_ROUTES[routeTable[slot]];
+    if (route.hash == hash && strcmp(route.name, event) == 0) {
+      return routeTable[slot];
+    }
+  }
+  return -1;
+}
 
-        StaticJsonDocument<256> doc;
-        doc["event"] = "pong";
-        doc["dt"] = timeModule.getFormattedDateTime();
-        doc["freeMem"] = ESP.getFreeHeap();
+void WebServer::dispatchCommand(uint8_t num, uint8_t* payload, size_t length) {
+  // First pass keeps only "event", so unknown or oversized commands never
+  // touch a full document.
+  StaticJsonDocument<16> filter;
+  filter["event"] = true;
 
-        String response;
-        serializeJson(doc, response);
-        webSocket.sendTXT(num, response);
-      }
-      else if (event == "scan") {
-        _webServerIsBusy = true;
-        Serial.println("Handling scan request");
-        handleScanRequest(num);
-        wifiManager.clientID = num;
-      }
-      else if (event == "get_networks") {
-        _webServerIsBusy = true;
-        Serial.println("Handling get_networks request");
-        sendNetworkList(num);
-      }
-      else if (event == "get_current_state") {
-        _webServerIsBusy = true;
-        Serial.println("Handling get_current_state request");
-        sendCurrentState(num);
-      }
-      else if (event == "get_settings_telegram") {
-        _webServerIsBusy = true;
-        Serial.println("Handling get_settings_telegram request");
-        sendSettingsTelegram(num);
-      }
-      else if (event == "get_settings_device") {
-        _webServerIsBusy = true;
-        Serial.println("Handling get_settings_device request");
-        sendSettings.isSend = true;
-        sendSettings.idClient = num;
-      }
-      else if (event == "saveTelegramSettings") {
-        _webServerIsBusy = true;
-        Serial.println("Handling saveTelegramSettings request");
+  StaticJsonDocument<96> head;
+  DeserializationError error = deserializeJson(head, (const char*)payload, length, DeserializationOption::Filter(filter));
+  if (error) {
+    Serial.printf("[%u] JSON parse error: %s\n", num, error.c_str());
+    sendText(num, "{\"event\":\"error\",\"message\":\"invalid_json\"}");
+    return;
+  }
 
-        handleSaveTelegramSettingsWS(num, doc.as<JsonObject>());
-      }
-      else if (event == "saveDeviceSettings") {
-        _webServerIsBusy = true;
-        Serial.println("Handling saveDeviceSettings request");
-        Serial.printf("Payload size: %d bytes\n", length);
+  const char* event = head["event"] | "";
+  int index = findRoute(event);
+  if (index < 0) {
+    Serial.printf("[%u] Unknown event: %s\n", num, event);
+    return;
+  }
 
-        if (saveJson.isSave) {
-          Serial.println("[WS] Error: A previous save operation is still pending. Rejecting new request.");
-          webSocket.sendTXT(num, "{\"event\":\"error\",\"message\":\"pending_operation\"}");
-          break;
-        }
+  const WsRoute& route = WS_ROUTES[index];
+  if (length > route.maxPayload) {
+    Serial.printf("[%u] %s: payload %u bytes exceeds %u\n", num, route.name, (unsigned)length, (unsigned)route.maxPayload);
+    sendText(num, "{\"event\":\"error\",\"message\":\"payload_too_large\"}");
+    return;
+  }
 
-        saveJson.rawPayload = (char*)malloc(length);
-        if (!saveJson.rawPayload) {
-          Serial.println("[WS] FATAL: Failed to allocate memory for device settings payload!");
-          webSocket.sendTXT(num, "{\"event\":\"error\",\"message\":\"memory_allocation_failed\"}");
-          break;
-        }
+  unsigned long start = micros();
+  uint32_t outBefore = bytesOut;
+
+  // Parsed in place: strings point into the frame buffer, which WsHub keeps
+  // alive until the handler returns. Handlers copy whatever they keep.
+  JsonObject doc;
+  if (route.arena) {
+    JsonDocument& document = (this->*route.arena).acquire();
+    error = deserializeJson(document, reinterpret_cast<char*>(payload), length);
+    if (error) {
+      Serial.printf("[%u] %s: JSON parse error: %s\n", num, route.name, error.c_str());
+      sendText(num, "{\"event\":\"error\",\"message\":\"invalid_json\"}");
+      return;
+    }
+    doc = document.as<JsonObject>();
+  }
 
-        memcpy(saveJson.rawPayload, payload, length);
-        saveJson.payloadLength = length;
-        saveJson.receivedTime = millis();
-        saveJson.idClient = num;
-        saveJson.isSave = true;
+  if (route.busy) {
+    _webServerIsBusy = true;
+  }
+  (this->*route.handler)(num, doc, payload, length);
+
+  uint32_t elapsed = micros() - start;
+  WsRouteStats& stats = routeStats[index];
+  stats.calls++;
+  stats.bytesIn += length;
+  stats.bytesOut += bytesOut - outBefore;
+  stats.maxMicros = max(stats.maxMicros, elapsed);
+
+  uint8_t bucket = 0;
+  while (bucket < WS_LATENCY_BUCKETS - 1 && elapsed >= WS_LATENCY_BOUNDS_US[bucket]) {
+    bucket++;
+  }
+  stats.latency[bucket]++;
+}
 
-        Serial.printf("Payload (%d bytes) saved. Will be processed in the main loop.\n", length);
-      }
-      else if (event == "addNetwork") {
-        _webServerIsBusy = true;
-        Serial.println("Handling addNetwork request");
+void WebServer::onGetRouteStats(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  JsonDocument& reply = memArena.acquire();
+  reply["event"] = "route_stats";
 
-        String ssid = doc["ssid"] | "";
-        if (ssid.isEmpty() ) {
-          Serial.printf("Rejected invalid SSID: '%s'\n", ssid.c_str());
-          webSocket.sendTXT(num, "{\"event\":\"error\",\"message\":\"invalid_ssid\"}");
-          return;
-        }
-        handleAddNetwork(num, doc.as<JsonObject>());
-      }
-      else if (event == "updateNetwork") {
-        _webServerIsBusy = true;
-        Serial.println("Handling updateNetwork request");
+  JsonArray bounds = reply.createNestedArray("boundsUs");
+  for (uint32_t bound : WS_LATENCY_BOUNDS_US) {
+    bounds.add(bound);
+  }
 
-        handleUpdateNetwork(num, doc.as<JsonObject>());
-      }
-      else if (event == "deleteNetwork") {
-        _webServerIsBusy = true;
-        Serial.println("Handling deleteNetwork request");
+  JsonArray routes = reply.createNestedArray("routes");
+  for (size_t i = 0; i < WS_ROUTE_COUNT; i++) {
+    const WsRouteStats& stats = routeStats[i];
+    if (stats.calls == 0) continue;
+
+    JsonObject route = routes.createNestedObject();
+    route["name"] = WS_ROUTES[i].name;
+    route["calls"] = stats.calls;
+    route["in"] = stats.bytesIn;
+    route["out"] = stats.bytesOut;
+    route["maxUs"] = stats.maxMicros;
+    JsonArray latency = route.createNestedArray("latency");
+    for (uint32_t count : stats.latency) {
+      latency.add(count);
+    }
+  }
 
-        const char* ssid = doc["ssid"] | "";
-        Serial.printf("SSID to delete: %s\n", ssid);
-        handleDeleteNetworkWS(num, doc.as<JsonObject>());
-      }
-      else if (event == "saveSettings") {
-        _webServerIsBusy = true;
-        Serial.println("Handling saveSettings request");
+  size_t replyLength = memArena.serialize();
+  if (replyLength > 0) {
+    sendText(num, memArena.text(), replyLength);
+  }
+}
 
-        handleSaveSettingsWS(num, doc.as<JsonObject>());
-      }
-      else if (event == "saveDateTime") {
-        _webServerIsBusy = true;
+void WebServer::onPing(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  JsonDocument& reply = replyArena.acquire();
+  reply["event"] = "pong";
+  reply["dt"] = timeModule.getFormattedDateTime();
+  reply["freeMem"] = ESP.getFreeHeap();
 
-        handleSaveDateTime(num, doc.as<JsonObject>());
-      }
-      else if (event == "test_connection") {
-        _webServerIsBusy = true;
+  size_t replyLength = replyArena.serialize();
+  if (replyLength > 0) {
+    sendText(num, replyArena.text(), replyLength);
+  }
+}
 
-        String ssid = doc["ssid"] | "";
-        String bssid = doc["bssid"] | "";
-        String password = doc["password"] | "";
-        int channel = doc["channel"] | 0;
+void WebServer::onGetMem(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  JsonDocument& reply = memArena.acquire();
+  reply["event"] = "mem";
+  MemTrack::toJson(reply.createNestedObject("mem"));
+  reportProtocolStats(reply.createNestedObject("ws"));
 
-        Serial.printf("Test connection to: %s\n", ssid.c_str());
+  size_t replyLength = memArena.serialize();
+  if (replyLength > 0) {
+    sendText(num, memArena.text(), replyLength);
+  }
+}
 
-        if (ssid.length() > 0) {
-          tryConnectToWiFi(num, ssid, bssid, password, channel);
-          Serial.println("Started new connection test");
-        }
-      }
+void WebServer::onScan(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Handling scan request");
+  subscribe(num, bit(WS_TOPIC_SCAN));
+  handleScanRequest(num);
+  wifiManager.clientID = num;
+}
 
-      else if (event == "event_logs_open") {
-        _webServerIsBusy = true;
+void WebServer::onGetNetworks(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Handling get_networks request");
+  sendNetworkList(num);
+}
 
-        Serial.printf("[%u] Opened logs tab. Sending history.\n", num);
+void WebServer::onGetCurrentState(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Handling get_current_state request");
+  sendCurrentState(num);
+}
 
-        if (std::find(loggingClients.begin(), loggingClients.end(), num) == loggingClients.end()) {
-          loggingClients.push_back(num);
-        }
+void WebServer::onGetSettingsTelegram(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Handling get_settings_telegram request");
+  sendSettingsTelegram(num);
+}
 
-        yield();
-        delay(1);
+void WebServer::onGetSettingsDevice(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Handling get_settings_device request");
+  sendSettings.isSend = true;
+  sendSettings.idClient = num;
+}
 
-        String response = "{\"event\":\"all_logs\",\"logs\":" + logger.getAllLogsJSON() + "}";
-        webSocket.sendTXT(num, response);
+void WebServer::onSaveTelegramSettings(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Handling saveTelegramSettings request");
+  handleSaveTelegramSettingsWS(num, doc);
+}
 
-      }
-      else if (event == "event_logs_close") {
-        _webServerIsBusy = true;
-        Serial.printf("[%u] Closed logs tab.\n", num);
+void WebServer::onSaveDeviceSettings(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Handling saveDeviceSettings request");
+  Serial.printf("Payload size: %d bytes\n", length);
 
-        loggingClients.erase(std::remove(loggingClients.begin(), loggingClients.end(), num), loggingClients.end());
+  if (saveJson.isSave) {
+    Serial.println("[WS] Error: A previous save operation is still pending. Rejecting new request.");
+    sendText(num, "{\"event\":\"error\",\"message\":\"pending_operation\"}");
+    return;
+  }
 
-        webSocket.sendTXT(num, "{\"event\":\"logs_closed\",\"message\":\"Log streaming stopped\"}");
-        logger.saveLogsToSPIFFS();
-      }
-      else if (event == "event_logs_clear") {
-        logger.clearLogs();
-      }
-      else if (event == "event_logs_save") {
-        _webServerIsBusy = true;
-        logger.saveLogsToSPIFFS();
-      }
+  // The frame buffer itself is kept until loop() parses it; nothing is copied.
+  saveJson.rawPayload = reinterpret_cast<char*>(webSocket.takePayload());
+  if (!saveJson.rawPayload) {
+    Serial.println("[WS] Error: device settings payload is no longer available");
+    sendText(num, "{\"event\":\"error\",\"message\":\"memory_allocation_failed\"}");
+    return;
+  }
 
-      else if (event == "tab_control_open") {
-        _webServerIsBusy = true;
-        isControlOpen = true;
-      }
-      else if (event == "tab_control_close") {
-        _webServerIsBusy = true;
-        isControlOpen = false;
-      }
+  saveJson.payloadLength = length;
+  saveJson.receivedTime = millis();
+  saveJson.idClient = num;
+  saveJson.isSave = true;
 
-      else if (event == "relay") {
-        _webServerIsBusy = true;
-        Serial.println("Handling relay command request");
+  Serial.printf("Payload (%d bytes) saved. Will be processed in the main loop.\n", length);
+}
 
-        bool success = deviceManager.handleRelayCommand(doc.as<JsonObject>(), num);
-        String response = "{\"event\":\"relay_command_status\",\"success\":" + String(success ? "true" : "false") + "}";
-        webSocket.sendTXT(num, response);
-      }
-      else if (event == "reboot") {
-        _webServerIsBusy = true;
-        Serial.println("Rebooting...");
+void WebServer::onPatchDevice(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  const char* patchError = nullptr;
+  bool success = deviceManager.patchDevice(deviceManager.currentDeviceIndex, doc["patch"].as<JsonObjectConst>(),
+                                           doc["ops"].as<JsonArrayConst>(), patchError);
 
-        webSocket.sendTXT(num, "{\"event\":\"reboot\",\"status\":\"initiated\"}");
+  JsonDocument& reply = replyArena.acquire();
+  reply["event"] = "device_patch";
+  reply["success"] = success;
+  if (patchError) reply["error"] = patchError;
 
-        delay(50);
+  size_t replyLength = replyArena.serialize();
+  if (replyLength > 0) {
+    sendText(num, replyArena.text(), replyLength);
+  }
+}
 
-        WiFi.disconnect(true);
-        delay(100);
-        WiFi.mode(WIFI_OFF);
-        delay(100);
+void WebServer::onAddNetwork(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Handling addNetwork request");
 
-        logger.saveLogsToSPIFFS();
+  String ssid = doc["ssid"] | "";
+  if (ssid.isEmpty() ) {
+    Serial.printf("Rejected invalid SSID: '%s'\n", ssid.c_str());
+    sendText(num, "{\"event\":\"error\",\"message\":\"invalid_ssid\"}");
+    return;
+  }
+  handleAddNetwork(num, doc);
+}
 
-        delay(100);
-        ESP.restart();
-      }
-      else if (event == "full_reset") {
-        _webServerIsBusy = true;
-        Serial.println("full reset...");
-        webSocket.sendTXT(num, "{\"event\":\"reboot\",\"status\":\"formatting\"}");
-        appState.isFormat = true;
-      }
+void WebServer::onUpdateNetwork(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Handling updateNetwork request");
+  handleUpdateNetwork(num, doc);
+}
 
-      else {
-        Serial.printf("[%u] Unknown event: %s\n", num, event.c_str());
-      }
-      break;
-    }
+void WebServer::onDeleteNetwork(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Handling deleteNetwork request");
 
-    default:
-      break;
+  const char* ssid = doc["ssid"] | "";
+  Serial.printf("SSID to delete: %s\n", ssid);
+  handleDeleteNetworkWS(num, doc);
+}
+
+void WebServer::onSaveSettings(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Handling saveSettings request");
+  handleSaveSettingsWS(num, doc);
+}
+
+void WebServer::onSaveDateTime(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  handleSaveDateTime(num, doc);
+}
+
+void WebServer::onTestConnection(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  String ssid = doc["ssid"] | "";
+  String bssid = doc["bssid"] | "";
+  String password = doc["password"] | "";
+  int channel = doc["channel"] | 0;
+
+  Serial.printf("Test connection to: %s\n", ssid.c_str());
+
+  if (ssid.length() > 0) {
+    tryConnectToWiFi(num, ssid, bssid, password, channel);
+    Serial.println("Started new connection test");
   }
-  _webServerIsBusy = false;
+}
+
+void WebServer::onSubscribe(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  subscribe(num, parseTopics(doc["topics"]));
+}
+
+void WebServer::onUnsubscribe(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  unsubscribe(num, parseTopics(doc["topics"]));
+}
+
+void WebServer::onLogsClear(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  logger.clearLogs();
+}
+
+void WebServer::onLogsSave(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  logger.saveLogsToSPIFFS();
+}
+
+void WebServer::onSetProtocol(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  if (num < WS_MAX_CLIENTS) {
+    clientLink[num].binary = doc["binary"] | false;
+    resetClientSync(num);
+    Serial.printf("[%u] Runtime updates: %s\n", num, clientLink[num].binary ? "binary" : "json");
+  }
+}
+
+void WebServer::onRelay(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Handling relay command request");
+
+  bool success = deviceManager.handleRelayCommand(doc, num);
+  String response = "{\"event\":\"relay_command_status\",\"success\":" + String(success ? "true" : "false") + "}";
+  sendText(num, response);
+}
+
+void WebServer::onReboot(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("Rebooting...");
+
+  sendText(num, "{\"event\":\"reboot\",\"status\":\"initiated\"}");
+
+  delay(50);
+
+  WiFi.disconnect(true);
+  delay(100);
+  WiFi.mode(WIFI_OFF);
+  delay(100);
+
+  logger.saveLogsToSPIFFS();
+
+  delay(100);
+  ESP.restart();
+}
+
+void WebServer::onFullReset(uint8_t num, JsonObject doc, uint8_t* payload, size_t length) {
+  Serial.println("full reset...");
+  sendText(num, "{\"event\":\"reboot\",\"status\":\"formatting\"}");
+  appState.isFormat = true;
 }
 
 void WebServer::handleUpdateNetwork(uint8_t num, JsonObject doc) {
   const char* originalSsid = doc["originalSsid"] | "";
   if (strlen(originalSsid) == 0) {
-    webSocket.sendTXT(num, "{\"event\":\"error\",\"message\":\"missing_original_ssid\"}");
+    sendText(num, "{\"event\":\"error\",\"message\":\"missing_original_ssid\"}");
     return;
   }
 
@@ -836,7 +1092,7 @@ void WebServer::handleUpdateNetwork(uint8_t num, JsonObject doc) {
   }
 
   if (!found) {
-    webSocket.sendTXT(num, "{\"event\":\"error\",\"message\":\"network_not_found\"}");
+    sendText(num, "{\"event\":\"error\",\"message\":\"network_not_found\"}");
     return;
   }
 
@@ -869,7 +1125,7 @@ void WebServer::handleAddNetwork(uint8_t num, JsonObject doc) {
 
   for (const auto& savedNet : settings.ws.networkSettings) {
     if (savedNet.ssid == net.ssid) {
-      webSocket.sendTXT(num, "{\"event\":\"error\",\"message\":\"network_already_exists\"}");
+      sendText(num, "{\"event\":\"error\",\"message\":\"network_already_exists\"}");
       return;
     }
   }
@@ -887,11 +1143,11 @@ void WebServer::handleAddNetwork(uint8_t num, JsonObject doc) {
 
 void WebServer::handleScanRequest(uint8_t num) {
   if (wifiManager.isScanning) {
-    webSocket.sendTXT(num, "{\"event\":\"error\",\"message\":\"scan_already_in_progress\"}");
+    sendText(num, "{\"event\":\"error\",\"message\":\"scan_already_in_progress\"}");
     return;
   }
   wifiManager.scanNetworks();
-  webSocket.sendTXT(num, "{\"event\":\"scan_started\"}");
+  sendText(num, "{\"event\":\"scan_started\"}");
 }
 
 unsigned long connectStartTime;
@@ -1116,7 +1372,7 @@ void WebServer::processPendingResultsScan() {
     char buffer[250];
     size_t len = serializeJson(doc, buffer, sizeof(buffer));
 
-    lastResult.sent = webSocket.sendTXT(lastResult.clientNum, buffer, len);
+    lastResult.sent = sendText(lastResult.clientNum, buffer, len);
     Serial.printf("[%u] Result: %s\n", lastResult.clientNum,
                   lastResult.success ? "success" : "failed");
     lastResult.sent = true;
@@ -1125,33 +1381,35 @@ void WebServer::processPendingResultsScan() {
 
 void WebServer::loop() {
   webSocket.loop();
+  drainOutboxes();
+  restApi.loop();
 
   if (saveJson.isSave) {
 
     if (millis() - saveJson.receivedTime > 5000) {
       Serial.println("[WS] Save request timeout");
-      webSocket.sendTXT(saveJson.idClient, "{\"event\":\"error\",\"message\":\"timeout\"}");
+      sendText(saveJson.idClient, "{\"event\":\"error\",\"message\":\"timeout\"}");
 
-      free(saveJson.rawPayload);
+      PsramAllocator().deallocate(saveJson.rawPayload);
       saveJson.rawPayload = nullptr;
       saveJson.isSave = false;
     } else {
 
-      DynamicJsonDocument doc(8192);
+      JsonDocument& doc = saveArena.acquire();
 
       Serial.printf("[WS] Deserializing JSON, size=%d, heap=%d\n", saveJson.payloadLength, ESP.getFreeHeap());
       DeserializationError error = deserializeJson(doc, saveJson.rawPayload, saveJson.payloadLength);
 
       if (error) {
         Serial.printf("[WS] JSON deserialize error: %s\n", error.c_str());
-        webSocket.sendTXT(saveJson.idClient, "{\"event\":\"error\",\"message\":\"deserialize_failed\"}");
+        sendText(saveJson.idClient, "{\"event\":\"error\",\"message\":\"deserialize_failed\"}");
       } else {
         Serial.println("[WS] JSON deserialized successfully, calling handler.");
         yield();
         handleSaveSettingsDevice(saveJson.idClient, doc.as<JsonObject>());
       }
 
-      free(saveJson.rawPayload);
+      PsramAllocator().deallocate(saveJson.rawPayload);
       saveJson.rawPayload = nullptr;
       saveJson.isSave = false;
       Serial.println("[WS] Memory for saveJson freed.");
@@ -1159,21 +1417,21 @@ void WebServer::loop() {
   }
 
   if (saveNetwork.isSaveNetwork) {
-    bool result = settings.saveSettings();
+    bool result = settings.saveSettingsNow();
 
     delay(10);
     Serial.println("isSaveNetwork " + String(result));
 
     if (result) {
-      webSocket.sendTXT(saveNetwork.idClient, "{\"event\":\"settingsStatus\",\"success\":true,\"message\":\"Settings saved successfully\"}");
+      sendText(saveNetwork.idClient, "{\"event\":\"settingsStatus\",\"success\":true,\"message\":\"Settings saved successfully\"}");
 
       if (saveNetwork.isSendNetworkList) {
-        webSocket.sendTXT(saveNetwork.idClient, "{\"event\":\"network_updated\",\"success\":true}");
+        sendText(saveNetwork.idClient, "{\"event\":\"network_updated\",\"success\":true}");
         sendNetworkList(saveNetwork.idClient);
         saveNetwork.isSendNetworkList = false;
       }
     } else {
-      webSocket.sendTXT(saveNetwork.idClient, "{\"event\":\"settingsStatus\",\"success\":false,\"message\":\"Failed to save settings\"}");
+      sendText(saveNetwork.idClient, "{\"event\":\"settingsStatus\",\"success\":false,\"message\":\"Failed to save settings\"}");
     }
 
     saveNetwork.isSaveNetwork = false;
@@ -1195,67 +1453,328 @@ void WebServer::loop() {
       Serial.printf("[SCAN] Scan completed with %d networks found\n", scanStatus);
       wifiManager.processScanResults(scanStatus);
 
-      webSocket.broadcastTXT("{\"event\":\"scan_complete\"}");
+      static const char SCAN_COMPLETE[] = "{\"event\":\"scan_complete\"}";
+      sendToSubscribers(WS_TOPIC_SCAN, SCAN_COMPLETE, strlen(SCAN_COMPLETE));
 
       Serial.println("[SCAN] Broadcast scan_complete event");
 
-      String json = "{\"event\":\"scan_results\",\"networks\":" + wifiManager.scannedNetworks + "}";
-      webSocket.sendTXT(wifiManager.clientID, json);
+      String networks;
+      serializeJson(wifiManager.scannedNetworks, networks);
+      String json = "{\"event\":\"scan_results\",\"networks\":" + networks + "}";
+      sendToSubscribers(WS_TOPIC_SCAN, json.c_str(), json.length());
 
     } else if (scanStatus == WIFI_SCAN_FAILED) {
       Serial.println("[SCAN] Scan failed (WIFI_SCAN_FAILED)");
 
-      webSocket.broadcastTXT("{\"event\":\"scan_failed\"}");
+      static const char SCAN_FAILED[] = "{\"event\":\"scan_failed\"}";
+      sendToSubscribers(WS_TOPIC_SCAN, SCAN_FAILED, strlen(SCAN_FAILED));
     }
   }
 
-  if (webSocket.connectedClients() > 0 && isControlOpen) {
-    Device& currentDevice = deviceManager.myDevices[deviceManager.currentDeviceIndex];
+  if (subscribedTopics() & WS_RUNTIME_TOPICS) {
+    publishRuntimeTopics();
+  }
 
-    if (deviceManager.relayStateChanged()) {
-      String output = deviceManager.serializeRelaysForControlTab();
-      yield();
-      webSocket.broadcastTXT(output);
+  if ( appState.isFormat ) {
+    settings.format();
+  }
+
+}
+
+void WebServer::resetClientSync(uint8_t num) {
+  if (num < WS_MAX_CLIENTS) {
+    clientSync[num] = ClientSync();
+  }
+}
+
+void WebServer::publishRuntimeTopics() {
+  static const unsigned long TOPIC_MIN_INTERVAL[RUNTIME_TOPIC_COUNT] = {0, 500, 500, 0};
+
+  uint8_t subscribed = subscribedTopics();
+
+  for (uint8_t t = 0; t < RUNTIME_TOPIC_COUNT; t++) {
+    RuntimeTopic topic = static_cast<RuntimeTopic>(t);
+    if (!(subscribed & bit(t)) || millis() - lastTopicSend[t] < TOPIC_MIN_INTERVAL[t]) {
+      continue;
+    }
+
+    uint32_t version = deviceManager.runtimeVersion(topic);
+    size_t length[ENCODE_FORMAT_COUNT] = {0};
+    bool encoded[ENCODE_FORMAT_COUNT] = {false};
+    uint32_t encodedSince[ENCODE_FORMAT_COUNT] = {0};
+    bool sent = false;
+
+    for (uint8_t num = 0; num < WS_MAX_CLIENTS; num++) {
+      if (!(clientLink[num].topics & bit(t)) || !webSocket.clientIsConnected(num)) {
+        continue;
+      }
+
+      ClientSync& sync = clientSync[num];
+      if (sync.deviceIndex != deviceManager.currentDeviceIndex) {
+        sync = ClientSync();
+        sync.deviceIndex = deviceManager.currentDeviceIndex;
+      }
+
+      if (sync.seen[t] == version || outbox[num].queuedVersion(t) == version) {
+        continue;
+      }
+
+      // Clients normally share the same base version, so one delta serves all.
+      uint32_t since = deviceManager.runtimeDeltaBase(topic, sync.seen[t]);
+      if (millis() - sync.snapshotAt[t] >= RUNTIME_RESYNC_INTERVAL_MS) {
+        since = 0;
+      }
+
+      auto encode = [&](EncodeFormat format) {
+        if (!encoded[format] || encodedSince[format] != since) {
+          length[format] = encodeTopic(topic, format, since);
+          encoded[format] = true;
+          encodedSince[format] = since;
+          yield();
+        }
+        return length[format];
+      };
+
+      // Binary clients fall back to JSON if the frame did not fit.
+      EncodeFormat format = ENCODE_JSON;
+      if (clientLink[num].binary && encode(ENCODE_BINARY) > 0) {
+        format = ENCODE_BINARY;
+      } else {
+        encode(ENCODE_JSON);
+      }
+
+      if (length[format] == 0) {
+        continue;
+      }
+
+      // seen[] advances when the message is actually written (messageWritten),
+      // so a queued delta that gets replaced is re-based on what the client has.
+      const uint8_t* payload = format == ENCODE_BINARY ? deviceManager.runtimeTopicFrame()
+                                                       : (const uint8_t*)deviceManager.runtimeTopicText();
+      if (!sendMessage(num, payload, length[format], format == ENCODE_BINARY, t, version)) {
+        continue;
+      }
+      if (since == 0) {
+        sync.snapshotAt[t] = millis();
+      }
+      sent = true;
+    }
+
+    if (sent) {
+      lastTopicSend[t] = millis();
     }
+  }
+}
+
+bool WebServer::writeMessage(uint8_t num, const uint8_t* data, size_t length, bool binary) {
+  bool written = binary ? webSocket.sendBIN(num, data, length)
+                        : webSocket.sendTXT(num, data, length);
+  if (written) {
+    clientLink[num].bytesSent += length;
+  }
+  return written;
+}
+
+void WebServer::messageWritten(uint8_t num, uint8_t key, uint32_t version) {
+  if (key < RUNTIME_TOPIC_COUNT) {
+    clientSync[num].seen[key] = version;
+  }
+}
+
+bool WebServer::sendMessage(uint8_t num, const uint8_t* data, size_t length, bool binary, uint8_t key, uint32_t version) {
+  if (num >= WS_MAX_CLIENTS || !webSocket.clientIsConnected(num)) {
+    return false;
+  }
+
+  WsOutbox& queue = outbox[num];
+  if (queue.empty() && webSocket.canWrite(num)) {
+    if (!writeMessage(num, data, length, binary)) {
+      return false;
+    }
+    messageWritten(num, key, version);
+    bytesOut += length;
+    return true;
+  }
+
+  if (!queue.push(key, data, length, binary, version)) {
+    Serial.printf("[%u] Outbox full (%u msgs, %u bytes), message dropped\n",
+                  num, (unsigned)queue.size(), (unsigned)queue.bytes());
+    return false;
+  }
+  bytesOut += length;
+  return true;
+}
+
+bool WebServer::sendText(uint8_t num, const char* text, size_t length) {
+  return sendMessage(num, (const uint8_t*)text, length ? length : strlen(text), false);
+}
+
+bool WebServer::sendText(uint8_t num, const String& text) {
+  return sendMessage(num, (const uint8_t*)text.c_str(), text.length(), false);
+}
 
-    if (deviceManager.checkSettingsChanged()) {
-      String output = deviceManager.serializeDeviceFlags();
-       webSocket.broadcastTXT(output);
+void WebServer::drainOutboxes() {
+  for (uint8_t num = 0; num < WS_MAX_CLIENTS; num++) {
+    WsOutbox& queue = outbox[num];
+    if (queue.empty()) {
+      queue.behindSince = 0;
+      continue;
     }
 
-   if (deviceManager.timersProgressChanged()) {
+    // A bounded share per client and pass, so one backlog can't delay the rest.
+    size_t budget = WS_DRAIN_BUDGET_BYTES;
+    while (!queue.empty() && budget > 0 && webSocket.canWrite(num)) {
+      const WsOutbox::Message& message = queue.front();
+      if (!writeMessage(num, message.data, message.length, message.binary)) {
+        break;
+      }
+      messageWritten(num, message.key, message.version);
+      budget -= min(budget, message.length);
+      queue.pop();
+    }
 
-    static unsigned long lastTimerUpdate = 0;
-    const unsigned long TIMER_UPDATE_INTERVAL = 500;
+    if (queue.empty()) {
+      queue.behindSince = 0;
+    } else if (queue.behindSince == 0) {
+      queue.behindSince = max(1UL, millis());
+    } else if (millis() - queue.behindSince > WS_CLIENT_BEHIND_MS) {
+      Serial.printf("[%u] Client is %lu ms behind (%u msgs queued), disconnecting\n",
+                    num, millis() - queue.behindSince, (unsigned)queue.size());
+      queue.clear();
+      queue.behindSince = 0;
+      webSocket.disconnect(num);
+    }
+  }
+}
 
-    if (millis() - lastTimerUpdate >= TIMER_UPDATE_INTERVAL) {
-      lastTimerUpdate = millis();
+uint8_t WebServer::parseTopics(JsonVariantConst value) {
+  static const char* const TOPIC_NAMES[WS_TOPIC_COUNT] = {"relays", "sensors", "timers", "flags", "logs", "scan"};
 
-        String output = deviceManager.serializeTimersProgress();
-        webSocket.broadcastTXT(output);
+  uint8_t topics = 0;
+  auto add = [&](const char* name) {
+    if (!name) return;
+    for (uint8_t t = 0; t < WS_TOPIC_COUNT; t++) {
+      if (strcmp(name, TOPIC_NAMES[t]) == 0) topics |= bit(t);
+    }
+  };
 
+  if (value.is<JsonArrayConst>()) {
+    for (JsonVariantConst name : value.as<JsonArrayConst>()) {
+      add(name.as<const char*>());
     }
+  } else {
+    add(value.as<const char*>());
   }
+  return topics;
+}
+
+void WebServer::subscribe(uint8_t num, uint8_t topics) {
+  if (num >= WS_MAX_CLIENTS) return;
 
-     static unsigned long lastBroadcastTime = 0;
-     const unsigned long BROADCAST_INTERVAL = 500;
+  ClientLink& link = clientLink[num];
+  uint8_t added = topics & ~link.topics;
+  link.topics |= topics;
+
+  // A (re)subscribed runtime topic starts with a full snapshot.
+  for (uint8_t t = 0; t < RUNTIME_TOPIC_COUNT; t++) {
+    if (added & bit(t)) {
+      clientSync[num].seen[t] = 0;
+    }
+  }
 
-if (deviceManager.sensorValuesChanged() && (millis() - lastBroadcastTime > BROADCAST_INTERVAL)) {
-    String output = deviceManager.serializeSensorValues();
-    webSocket.broadcastTXT(output);
+  if (added & bit(WS_TOPIC_LOGS)) {
+    Serial.printf("[%u] Opened logs tab. Sending history.\n", num);
     yield();
 
-    lastBroadcastTime = millis();
+    String response = "{\"event\":\"all_logs\",\"logs\":" + logger.getAllLogsJSON() + "}";
+    sendText(num, response);
+  }
 }
 
+void WebServer::unsubscribe(uint8_t num, uint8_t topics) {
+  if (num >= WS_MAX_CLIENTS) return;
+
+  ClientLink& link = clientLink[num];
+  uint8_t removed = topics & link.topics;
+  link.topics &= ~topics;
+
+  if (removed & bit(WS_TOPIC_LOGS)) {
+    Serial.printf("[%u] Closed logs tab.\n", num);
+    sendText(num, "{\"event\":\"logs_closed\",\"message\":\"Log streaming stopped\"}");
+    logger.saveLogsToSPIFFS();
   }
+}
 
-  if ( appState.isFormat ) {
-    settings.format();
+uint8_t WebServer::subscribedTopics() const {
+  uint8_t topics = 0;
+  for (uint8_t num = 0; num < WS_MAX_CLIENTS; num++) {
+    topics |= clientLink[num].topics;
+  }
+  return topics;
+}
+
+void WebServer::sendToSubscribers(WsTopic topic, const char* text, size_t length) {
+  for (uint8_t num = 0; num < WS_MAX_CLIENTS; num++) {
+    if ((clientLink[num].topics & bit(topic)) && webSocket.clientIsConnected(num)) {
+      sendText(num, text, length);
+    }
   }
+}
+
+size_t WebServer::encodeTopic(RuntimeTopic topic, EncodeFormat format, uint32_t since) {
+  unsigned long start = micros();
+  size_t length = format == ENCODE_BINARY ? deviceManager.encodeRuntimeTopic(topic, since)
+                                          : deviceManager.serializeRuntimeTopic(topic, since);
 
+  EncodeStats& stats = encodeStats[format];
+  stats.count++;
+  stats.micros += micros() - start;
+  stats.bytes += length;
+  return length;
+}
+
+void WebServer::reportProtocolStats(JsonObject out) {
+  static const char* const FORMAT_NAMES[ENCODE_FORMAT_COUNT] = {"json", "binary"};
+
+  for (uint8_t f = 0; f < ENCODE_FORMAT_COUNT; f++) {
+    const EncodeStats& stats = encodeStats[f];
+    JsonObject format = out.createNestedObject(FORMAT_NAMES[f]);
+    format["frames"] = stats.count;
+    format["avgUs"] = stats.count ? stats.micros / stats.count : 0;
+    format["avgBytes"] = stats.count ? stats.bytes / stats.count : 0;
+  }
+
+  JsonArray clients = out.createNestedArray("clients");
+  for (uint8_t num = 0; num < WS_MAX_CLIENTS; num++) {
+    if (!webSocket.clientIsConnected(num)) {
+      continue;
+    }
+
+    const ClientLink& link = clientLink[num];
+    unsigned long elapsed = millis() - link.since;
+
+    JsonObject client = clients.createNestedObject();
+    client["num"] = num;
+    client["binary"] = link.binary;
+    client["topics"] = link.topics;
+    client["queued"] = outbox[num].size();
+    client["queuedBytes"] = outbox[num].bytes();
+    client["dropped"] = outbox[num].dropped;
+    client["coalesced"] = outbox[num].coalesced;
+    client["bytes"] = link.bytesSent;
+    client["bps"] = elapsed > 0 ? (uint32_t)((uint64_t)link.bytesSent * 1000 / elapsed) : 0;
+  }
 }
 
 bool WebServer::isBusy() const {
     return _webServerIsBusy;
 }
+
+WebServer::WsTotals WebServer::wsTotals() const {
+    WsTotals totals = {webSocket.connectedClients(), bytesOut, webSocket.getDroppedCommands(), 0, 0};
+    for (uint8_t i = 0; i < WS_MAX_CLIENTS; i++) {
+        totals.outboxDropped += outbox[i].dropped;
+        totals.outboxCoalesced += outbox[i].coalesced;
+    }
+    return totals;
+}
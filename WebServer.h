@@ -7,10 +7,36 @@
 #include "Info.h"
 #include "Logger.h"
 #include "Ota.h"
-#include "index_html_gz.h"
+#include "web_assets_gz.h"
 #include "AppState.h"
+#include "ConfigBundle.h"
+#include "WsOutbox.h"
+#include "WsHub.h"
+#include "RestApi.h"
 #include <ESPAsyncWebServer.h>
-#include <WebSocketsServer.h>
+
+#define RUNTIME_RESYNC_INTERVAL_MS 60000UL
+#define INDEX_CACHE_CONTROL "public, max-age=86400, must-revalidate"
+
+// Per-client subscriptions; the runtime topics share RuntimeTopic numbering.
+enum WsTopic : uint8_t {
+  WS_TOPIC_RELAYS = RUNTIME_RELAYS,
+  WS_TOPIC_SENSORS = RUNTIME_SENSORS,
+  WS_TOPIC_TIMERS = RUNTIME_TIMERS,
+  WS_TOPIC_FLAGS = RUNTIME_FLAGS,
+  WS_TOPIC_LOGS = RUNTIME_TOPIC_COUNT,
+  WS_TOPIC_SCAN,
+  WS_TOPIC_COUNT
+};
+
+#define WS_RUNTIME_TOPICS ((uint8_t)((1 << RUNTIME_TOPIC_COUNT) - 1))
+
+#define WS_DRAIN_BUDGET_BYTES ((size_t)4096)
+
+#define WS_ROUTE_MAX 32
+#define WS_ROUTE_TABLE_SIZE 64
+#define WS_LATENCY_BUCKETS 6
+#define WS_CLIENT_BEHIND_MS 10000UL
 
 class WebServer {
 
@@ -18,11 +44,12 @@ class WebServer {
     AsyncWebServer server{80};
     static WebServer* instance;
 
-    WebServer(WiFiManager& wifiManager, Settings& ws, DeviceManager& deviceManager,  TimeModule& timeModule, Info& sysInfo, Ota& ota, Logger& logger, AppState& appState );
+    WebServer(WiFiManager& wifiManager, Settings& ws, DeviceManager& deviceManager,  TimeModule& timeModule, Info& sysInfo, Ota& ota, Logger& logger, AppState& appState, ConfigBundle& configBundle);
     ~WebServer();
 
     void begin();
     void loop();
+    void idle(uint32_t timeoutMs) { webSocket.waitForCommand(timeoutMs); }
     void startServer();
     void stopServer();
     bool isTryConnect = false;
@@ -37,6 +64,17 @@ class WebServer {
 
      bool isBusy() const;
 
+    struct WsTotals {
+      uint8_t clients;
+      uint32_t bytesSent;
+      uint32_t droppedCommands;
+      uint32_t outboxDropped;
+      uint32_t outboxCoalesced;
+    };
+
+    WsTotals wsTotals() const;
+    RestApi& api() { return restApi; }
+
   private:
     Settings& settings;
     WiFiManager& wifiManager;
@@ -46,13 +84,101 @@ class WebServer {
     Ota& ota;
     Logger& logger;
     AppState& appState;
+    ConfigBundle& configBundle;
 
-    WebSocketsServer webSocket{81};
+    WsHub webSocket{"/ws"};
+    RestApi restApi{deviceManager};
+    WsOutbox outbox[WS_MAX_CLIENTS];
 
+    bool sendMessage(uint8_t num, const uint8_t* data, size_t length, bool binary,
+                     uint8_t key = WS_OUTBOX_KEY_NONE, uint32_t version = 0);
+    bool sendText(uint8_t num, const char* text, size_t length = 0);
+    bool sendText(uint8_t num, const String& text);
+    bool writeMessage(uint8_t num, const uint8_t* data, size_t length, bool binary);
+    void messageWritten(uint8_t num, uint8_t key, uint32_t version);
+    void drainOutboxes();
+
+    JsonArena commandArena{"ws.command", 1024};
+    JsonArena requestArena{"ws.request", 8192};
+    JsonArena saveArena{"ws.save", 8192};
+    JsonArena deviceArena{"ws.device", 8192, 8192};
+    JsonArena replyArena{"ws.reply", 256, 512};
+    JsonArena logArena{"ws.log", 512, 768};
+    JsonArena memArena{"ws.mem", 4096, 4096};
+
+    struct IndexAsset {
+      const char* path = nullptr;
+      bool gzip = true;
+      size_t size = 0;
+      char etag[11] = "\"0\"";
+    };
+
+    IndexAsset indexAsset;
+
+    void selectIndexAsset();
     AsyncWebServerResponse* getIndexResponse(AsyncWebServerRequest *request);
+    AsyncWebServerResponse* getAssetResponse(AsyncWebServerRequest *request, const WebAsset& asset);
     String getHTTPDate(time_t timestamp);
 
-    void handleWebSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
+    void handleWebSocketEvent(uint8_t num, WsEventType type, uint8_t* payload, size_t length);
+
+    typedef void (WebServer::*WsHandler)(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+
+    // One entry per WebSocket event. arena is the document the payload is
+    // parsed into before the handler runs (nullptr: handler parses itself).
+    struct WsRoute {
+      uint32_t hash;
+      const char* name;
+      WsHandler handler;
+      JsonArena WebServer::*arena;
+      size_t maxPayload;
+      bool busy;
+    };
+
+    struct WsRouteStats {
+      uint32_t calls = 0;
+      uint32_t bytesIn = 0;
+      uint32_t bytesOut = 0;
+      uint32_t maxMicros = 0;
+      uint32_t latency[WS_LATENCY_BUCKETS] = {0};
+    };
+
+    static const WsRoute WS_ROUTES[];
+    static const size_t WS_ROUTE_COUNT;
+
+    uint8_t routeTable[WS_ROUTE_TABLE_SIZE];
+    WsRouteStats routeStats[WS_ROUTE_MAX];
+    uint32_t bytesOut = 0;
+
+    void buildRouteTable();
+    int findRoute(const char* event) const;
+    void dispatchCommand(uint8_t num, uint8_t* payload, size_t length);
+
+    void onPing(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onGetMem(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onGetRouteStats(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onScan(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onGetNetworks(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onGetCurrentState(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onGetSettingsTelegram(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onGetSettingsDevice(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onSaveTelegramSettings(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onSaveDeviceSettings(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onPatchDevice(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onAddNetwork(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onUpdateNetwork(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onDeleteNetwork(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onSaveSettings(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onSaveDateTime(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onTestConnection(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onSubscribe(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onUnsubscribe(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onLogsClear(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onLogsSave(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onSetProtocol(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onRelay(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onReboot(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
+    void onFullReset(uint8_t num, JsonObject doc, uint8_t* payload, size_t length);
 
     void handleSaveSettingsWS(uint8_t num, JsonObject doc);
     void handleSaveNetworkWS(uint8_t num, JsonObject doc);
@@ -73,8 +199,6 @@ class WebServer {
 
     void printWiFiStatus(wl_status_t status);
 
-std::vector<uint8_t> loggingClients;
-
 void broadcastNewLog(const LogEntry& entry);
 
     struct SaveJson {
@@ -119,7 +243,43 @@ void broadcastNewLog(const LogEntry& entry);
     ConnectionResult lastResult;
     uint8_t currentClientNum;
 
-    bool isControlOpen;
+    struct ClientSync {
+      uint8_t deviceIndex = 255;
+      uint32_t seen[RUNTIME_TOPIC_COUNT] = {0};
+      unsigned long snapshotAt[RUNTIME_TOPIC_COUNT] = {0};
+    };
+
+    struct ClientLink {
+      uint8_t topics = 0;
+      bool binary = false;
+      uint32_t bytesSent = 0;
+      unsigned long since = 0;
+    };
+
+    enum EncodeFormat : uint8_t { ENCODE_JSON, ENCODE_BINARY, ENCODE_FORMAT_COUNT };
+
+    struct EncodeStats {
+      uint32_t count = 0;
+      uint32_t micros = 0;
+      uint32_t bytes = 0;
+    };
+
+    ClientSync clientSync[WS_MAX_CLIENTS];
+    ClientLink clientLink[WS_MAX_CLIENTS];
+    EncodeStats encodeStats[ENCODE_FORMAT_COUNT];
+    unsigned long lastTopicSend[RUNTIME_TOPIC_COUNT] = {0};
+
+    void resetClientSync(uint8_t num);
+    void publishRuntimeTopics();
+    size_t encodeTopic(RuntimeTopic topic, EncodeFormat format, uint32_t since);
+    void reportProtocolStats(JsonObject out);
+
+    uint8_t parseTopics(JsonVariantConst value);
+    void subscribe(uint8_t num, uint8_t topics);
+    void unsubscribe(uint8_t num, uint8_t topics);
+    uint8_t subscribedTopics() const;
+    void sendToSubscribers(WsTopic topic, const char* text, size_t length);
+
     bool isClientConnect = false;
     bool _webServerIsBusy = false;
 };
@@ -130,6 +130,7 @@ void WiFiManager::handleReconnectStateMachine() {
       break;
 
     case RECONNECT_ATTEMPTING:
+      reconnectTotal++;
       if (connectWithFallback()) {
         reconnectState = RECONNECT_IDLE;
         reconnectAttempts = 0;
@@ -187,6 +188,7 @@ void WiFiManager::handleWiFiEvent(WiFiEvent_t event) {
 
     case WIFI_EVENT_STAMODE_DISCONNECTED:
       Serial.println("WiFi disconnected");
+      disconnects++;
       wasConnected = false;
        appState.isStartWifi = false;
 
@@ -208,6 +210,7 @@ void WiFiManager::handleWiFiEvent(WiFiEvent_t event) {
 
     case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
       Serial.println("WiFi disconnected");
+      disconnects++;
       wasConnected = false;
       appState.isStartWifi = false;
 
@@ -619,33 +622,26 @@ bool WiFiManager::isReconnecting() const {
 
 void WiFiManager::processScanResults(int numNetworks) {
   if (numNetworks <= 0) {
-    scannedNetworks = "[]";
+    scannedNetworks.clear();
+    scannedNetworks.to<JsonArray>();
     isScanning = false;
     return;
   }
 
-  int estimatedSize = numNetworks * 100 + 10;
-  scannedNetworks = "";
-  scannedNetworks.reserve(estimatedSize);
-  scannedNetworks = "[";
+  size_t capacity = JSON_ARRAY_SIZE(numNetworks) + numNetworks * (JSON_OBJECT_SIZE(6) + 96);
+  scannedNetworks = PsramJsonDocument(capacity);
+  JsonArray networks = scannedNetworks.to<JsonArray>();
 
   for (int i = 0; i < numNetworks; ++i) {
-    if (i > 0) scannedNetworks += ",";
-
-    scannedNetworks += "{\"ssid\":\"";
-    scannedNetworks += WiFi.SSID(i);
-    scannedNetworks += "\",\"rssi\":";
-    scannedNetworks += String(WiFi.RSSI(i));
-    scannedNetworks += ",\"channel\":";
-    scannedNetworks += String(WiFi.channel(i));
-    scannedNetworks += ",\"encryption\":\"";
-    scannedNetworks += getEncryptionType(i);
-    scannedNetworks += "\",\"bssid\":\"";
-    scannedNetworks += WiFi.BSSIDstr(i);
-    scannedNetworks += "\"}";
+    JsonObject network = networks.createNestedObject();
+
+    network["ssid"] = WiFi.SSID(i);
+    network["rssi"] = WiFi.RSSI(i);
+    network["channel"] = WiFi.channel(i);
+    network["encryption"] = getEncryptionType(i);
+    network["bssid"] = WiFi.BSSIDstr(i);
   }
 
-  scannedNetworks += "]";
   WiFi.scanDelete();
   isScanning = false;
 }
@@ -653,7 +649,8 @@ void WiFiManager::processScanResults(int numNetworks) {
 void WiFiManager::scanNetworks() {
   if (isScanning) return;
   isScanning = true;
-  scannedNetworks = "[]";
+  scannedNetworks.clear();
+  scannedNetworks.to<JsonArray>();
 
   WiFi.mode(WIFI_AP_STA);
   delay(100);
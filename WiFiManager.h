@@ -40,6 +40,8 @@ public:
     bool connectWithFallback();
     void startAPMode();
     bool isReconnecting() const;
+    uint32_t getDisconnects() const { return disconnects; }
+    uint32_t getReconnectAttempts() const { return reconnectTotal; }
 
 #ifdef ESP8266
     static void onWiFiEvent(WiFiEvent_t event);
@@ -54,8 +56,9 @@ public:
 void handleWiFiEvent(WiFiEvent_t event);
 
     String getEncryptionType(uint8_t i);
+    void reportMemoryPlacement(MemoryPlacementReport& report) { report.add("WiFi scan", scannedNetworks); }
 
-    String scannedNetworks;
+    PsramJsonDocument scannedNetworks{512};
     bool isScanning = false;
     uint8_t clientID;
     bool checkTime = false;
@@ -86,6 +89,8 @@ private:
 
     ReconnectState reconnectState;
     int reconnectAttempts;
+    volatile uint32_t disconnects = 0;
+    uint32_t reconnectTotal = 0;
     unsigned long reconnectDelay;
     unsigned long lastReconnectTime;
 
@@ -0,0 +1,292 @@
+#include "WsHub.h"
+
+WsHub::WsHub(const char* path) : socket(path) {
+  commands = xQueueCreate(WS_COMMAND_QUEUE_LENGTH, sizeof(Command));
+  clientLock = xSemaphoreCreateRecursiveMutex();
+}
+
+WsHub::~WsHub() {
+  Command command;
+  while (commands && xQueueReceive(commands, &command, 0) == pdTRUE) {
+    PsramAllocator().deallocate(command.payload);
+  }
+  if (commands) {
+    vQueueDelete(commands);
+  }
+  if (clientLock) {
+    vSemaphoreDelete(clientLock);
+  }
+}
+
+void WsHub::begin(AsyncWebServer& server) {
+  if (attached) return;
+
+  socket.onEvent([this](AsyncWebSocket*, AsyncWebSocketClient* client, AwsEventType type,
+                        void* arg, uint8_t* data, size_t length) {
+    onSocketEvent(client, type, arg, data, length);
+  });
+  server.addHandler(&socket);
+  attached = true;
+}
+
+// Runs on the async_tcp task: no application state is touched here.
+void WsHub::onSocketEvent(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t length) {
+  switch (type) {
+    case WS_EVT_CONNECT:
+      if (!post(WS_EVENT_CONNECTED, client->id())) {
+        rememberConnect(client->id());
+      }
+      break;
+
+    case WS_EVT_DISCONNECT: {
+      // The client is freed once this returns; wait out any send in progress.
+      xSemaphoreTakeRecursive(clientLock, portMAX_DELAY);
+      xSemaphoreGiveRecursive(clientLock);
+
+      Assembly* assembly = static_cast<Assembly*>(client->_tempObject);
+      if (assembly) {
+        PsramAllocator().deallocate(assembly->data);
+        delete assembly;
+        client->_tempObject = nullptr;
+      }
+      post(WS_EVENT_DISCONNECTED, client->id());
+      break;
+    }
+
+    case WS_EVT_DATA:
+      onSocketData(client, static_cast<AwsFrameInfo*>(arg), data, length);
+      break;
+
+    default:
+      break;
+  }
+}
+
+void WsHub::onSocketData(AsyncWebSocketClient* client, AwsFrameInfo* info, uint8_t* data, size_t length) {
+  if (info->message_opcode != WS_TEXT) return;
+
+  // Whole message in one frame: the common case, no reassembly.
+  if (info->final && info->num == 0 && info->index == 0 && info->len == length) {
+    if (length > WS_MESSAGE_MAX_BYTES) return;
+
+    uint8_t* payload = static_cast<uint8_t*>(PsramAllocator().allocate(length + 1));
+    if (!payload) {
+      droppedCommands++;
+      return;
+    }
+    memcpy(payload, data, length);
+    payload[length] = '\0';
+    post(WS_EVENT_TEXT, client->id(), payload, length);
+    return;
+  }
+
+  Assembly* assembly = static_cast<Assembly*>(client->_tempObject);
+  if (!assembly) {
+    assembly = new Assembly();
+    client->_tempObject = assembly;
+  }
+
+  if (assembly->length + length > WS_MESSAGE_MAX_BYTES) {
+    PsramAllocator().deallocate(assembly->data);
+    *assembly = Assembly();
+    droppedCommands++;
+    return;
+  }
+
+  uint8_t* grown = static_cast<uint8_t*>(PsramAllocator().reallocate(assembly->data, assembly->length + length + 1));
+  if (!grown) {
+    PsramAllocator().deallocate(assembly->data);
+    *assembly = Assembly();
+    droppedCommands++;
+    return;
+  }
+  memcpy(grown + assembly->length, data, length);
+  assembly->data = grown;
+  assembly->length += length;
+
+  if (info->final && info->index + length == info->len) {
+    assembly->data[assembly->length] = '\0';
+    post(WS_EVENT_TEXT, client->id(), assembly->data, assembly->length);
+    *assembly = Assembly();
+  }
+}
+
+bool WsHub::post(WsEventType type, uint32_t clientId, uint8_t* payload, size_t length) {
+  Command command = {type, clientId, payload, length};
+
+  // Connection changes may wait for room; text frames are dropped instead of
+  // stalling the TCP task. Lost connects and disconnects are caught by sweep().
+  TickType_t wait = type == WS_EVENT_TEXT ? 0 : pdMS_TO_TICKS(100);
+  if (commands && xQueueSend(commands, &command, wait) == pdTRUE) {
+    return true;
+  }
+
+  PsramAllocator().deallocate(payload);
+  droppedCommands++;
+  return false;
+}
+
+void WsHub::loop() {
+  Command command;
+  while (commands && xQueueReceive(commands, &command, 0) == pdTRUE) {
+    currentPayload = command.payload;
+    dispatch(command);
+    PsramAllocator().deallocate(currentPayload);
+    currentPayload = nullptr;
+  }
+
+  if (millis() - lastSweep > 1000) {
+    lastSweep = millis();
+    sweep();
+  }
+}
+
+uint8_t* WsHub::takePayload() {
+  uint8_t* payload = currentPayload;
+  currentPayload = nullptr;
+  return payload;
+}
+
+void WsHub::waitForCommand(uint32_t timeoutMs) {
+  Command command;
+  if (!commands) {
+    delay(timeoutMs);
+    return;
+  }
+  xQueuePeek(commands, &command, pdMS_TO_TICKS(timeoutMs));
+}
+
+void WsHub::dispatch(const Command& command) {
+  int8_t num = slotOf(command.clientId);
+
+  switch (command.type) {
+    case WS_EVENT_CONNECTED:
+      if (num >= 0) return;
+      num = slotOf(0);
+      if (num < 0) {
+        Serial.printf("[WsHub] No free slot for client %u, closing\n", command.clientId);
+        socket.close(command.clientId);
+        return;
+      }
+      slots[num] = command.clientId;
+      break;
+
+    case WS_EVENT_DISCONNECTED:
+      if (num < 0) return;
+      slots[num] = 0;
+      break;
+
+    case WS_EVENT_TEXT:
+      if (num < 0) return;
+      break;
+  }
+
+  if (handler) {
+    handler(num, command.type, command.payload, command.length);
+  }
+}
+
+void WsHub::rememberConnect(uint32_t clientId) {
+  portENTER_CRITICAL(&missedMux);
+  for (uint8_t i = 0; i < WS_MAX_CLIENTS; i++) {
+    if (missedConnects[i] == 0) {
+      missedConnects[i] = clientId;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&missedMux);
+}
+
+void WsHub::sweep() {
+  socket.cleanupClients(WS_MAX_CLIENTS);
+
+  uint32_t missed[WS_MAX_CLIENTS];
+  portENTER_CRITICAL(&missedMux);
+  memcpy(missed, missedConnects, sizeof(missed));
+  memset(missedConnects, 0, sizeof(missedConnects));
+  portEXIT_CRITICAL(&missedMux);
+
+  for (uint8_t i = 0; i < WS_MAX_CLIENTS; i++) {
+    if (missed[i] != 0 && socket.hasClient(missed[i])) {
+      dispatch({WS_EVENT_CONNECTED, missed[i], nullptr, 0});
+    }
+  }
+
+  for (uint8_t num = 0; num < WS_MAX_CLIENTS; num++) {
+    if (slots[num] != 0 && !socket.hasClient(slots[num])) {
+      dispatch({WS_EVENT_DISCONNECTED, slots[num], nullptr, 0});
+    }
+  }
+}
+
+int8_t WsHub::slotOf(uint32_t clientId) const {
+  for (uint8_t num = 0; num < WS_MAX_CLIENTS; num++) {
+    if (slots[num] == clientId) return num;
+  }
+  return -1;
+}
+
+AsyncWebSocketClient* WsHub::client(uint8_t num) {
+  if (!clientIsConnected(num)) return nullptr;
+
+  AsyncWebSocketClient* found = socket.client(slots[num]);
+  return found && found->status() == WS_CONNECTED ? found : nullptr;
+}
+
+uint8_t WsHub::connectedClients() const {
+  uint8_t count = 0;
+  for (uint8_t num = 0; num < WS_MAX_CLIENTS; num++) {
+    if (slots[num] != 0) count++;
+  }
+  return count;
+}
+
+IPAddress WsHub::remoteIP(uint8_t num) {
+  xSemaphoreTakeRecursive(clientLock, portMAX_DELAY);
+  AsyncWebSocketClient* found = client(num);
+  IPAddress ip = found ? found->remoteIP() : IPAddress();
+  xSemaphoreGiveRecursive(clientLock);
+  return ip;
+}
+
+void WsHub::disconnect(uint8_t num) {
+  xSemaphoreTakeRecursive(clientLock, portMAX_DELAY);
+  AsyncWebSocketClient* found = client(num);
+  if (found) {
+    found->close();
+  }
+  xSemaphoreGiveRecursive(clientLock);
+}
+
+// Same signal as the select() check this replaced: the TCP send buffer only
+// frees up as the peer acknowledges bytes in flight. The client queues
+// whatever does not fit and tops the buffer up again on each ack.
+bool WsHub::canWrite(uint8_t num) {
+  xSemaphoreTakeRecursive(clientLock, portMAX_DELAY);
+  AsyncWebSocketClient* found = client(num);
+  bool writable = found && found->client() && found->client()->space() >= WS_SEND_LOW_WATER_BYTES;
+  xSemaphoreGiveRecursive(clientLock);
+  return writable;
+}
+
+bool WsHub::send(uint8_t num, const uint8_t* payload, size_t length, bool binary) {
+  xSemaphoreTakeRecursive(clientLock, portMAX_DELAY);
+  AsyncWebSocketClient* found = client(num);
+  if (found) {
+    if (binary) {
+      found->binary(reinterpret_cast<const char*>(payload), length);
+    } else {
+      found->text(reinterpret_cast<const char*>(payload), length);
+    }
+  }
+  xSemaphoreGiveRecursive(clientLock);
+  return found != nullptr;
+}
+
+bool WsHub::sendTXT(uint8_t num, const uint8_t* payload, size_t length) {
+  return send(num, payload, length, false);
+}
+
+bool WsHub::sendBIN(uint8_t num, const uint8_t* payload, size_t length) {
+  return send(num, payload, length, true);
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CommonTypes.h"
+#include <functional>
+#include <ESPAsyncWebServer.h>
+
+#define WS_MAX_CLIENTS 8
+#define WS_COMMAND_QUEUE_LENGTH 16
+#define WS_MESSAGE_MAX_BYTES ((size_t)32768)
+// A client is writable while its TCP send buffer has room for at least one
+// segment, i.e. the peer keeps acknowledging what is in flight.
+#define WS_SEND_LOW_WATER_BYTES 1436
+
+// FNV-1a; constexpr so routing tables can hash event names at compile time.
+constexpr uint32_t wsEventHash(const char* name, uint32_t hash = 2166136261u) {
+  return *name ? wsEventHash(name + 1, (hash ^ (uint8_t)*name) * 16777619u) : hash;
+}
+
+enum WsEventType : uint8_t {
+  WS_EVENT_CONNECTED,
+  WS_EVENT_DISCONNECTED,
+  WS_EVENT_TEXT
+};
+
+// WebSocket endpoint on the shared AsyncWebServer. Socket events arrive on the
+// async_tcp task, which only copies them into a command queue; loop() hands
+// them to the handler on the main task. Clients are addressed by a small slot
+// number (0..WS_MAX_CLIENTS-1) that is assigned there as well.
+//
+// AsyncWebSocketClient objects are deleted on the async_tcp task. Every use of
+// one from the main task holds clientLock, which the disconnect event also
+// takes before the client goes away.
+class WsHub {
+public:
+  typedef std::function<void(uint8_t num, WsEventType type, uint8_t* payload, size_t length)> EventHandler;
+
+  explicit WsHub(const char* path);
+  ~WsHub();
+
+  WsHub(const WsHub&) = delete;
+  WsHub& operator=(const WsHub&) = delete;
+
+  void begin(AsyncWebServer& server);
+  void onEvent(EventHandler handler) { this->handler = handler; }
+  void loop();
+  // Sleeps up to timeoutMs, returning as soon as a command is queued.
+  void waitForCommand(uint32_t timeoutMs);
+
+  bool clientIsConnected(uint8_t num) const { return num < WS_MAX_CLIENTS && slots[num] != 0; }
+  uint8_t connectedClients() const;
+  IPAddress remoteIP(uint8_t num);
+  void disconnect(uint8_t num);
+
+  // Only valid inside the event handler: takes ownership of the current text
+  // payload (PSRAM, NUL-terminated) so loop() does not free it. Release it
+  // with PsramAllocator().deallocate().
+  uint8_t* takePayload();
+
+  bool canWrite(uint8_t num);
+  bool sendTXT(uint8_t num, const uint8_t* payload, size_t length);
+  bool sendBIN(uint8_t num, const uint8_t* payload, size_t length);
+
+  uint32_t getDroppedCommands() const { return droppedCommands; }
+
+private:
+  struct Command {
+    WsEventType type;
+    uint32_t clientId;
+    uint8_t* payload;
+    size_t length;
+  };
+
+  struct Assembly {
+    uint8_t* data = nullptr;
+    size_t length = 0;
+  };
+
+  AsyncWebSocket socket;
+  QueueHandle_t commands = nullptr;
+  EventHandler handler;
+  bool attached = false;
+
+  SemaphoreHandle_t clientLock = nullptr;
+
+  uint32_t slots[WS_MAX_CLIENTS] = {0};
+  uint8_t* currentPayload = nullptr;
+  unsigned long lastSweep = 0;
+  volatile uint32_t droppedCommands = 0;
+
+  // Connects that did not fit into the command queue; sweep() adopts them.
+  portMUX_TYPE missedMux = portMUX_INITIALIZER_UNLOCKED;
+  uint32_t missedConnects[WS_MAX_CLIENTS] = {0};
+
+  void onSocketEvent(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t length);
+  void onSocketData(AsyncWebSocketClient* client, AwsFrameInfo* info, uint8_t* data, size_t length);
+  bool post(WsEventType type, uint32_t clientId, uint8_t* payload = nullptr, size_t length = 0);
+  void dispatch(const Command& command);
+  void sweep();
+  void rememberConnect(uint32_t clientId);
+
+  // Caller holds clientLock.
+  AsyncWebSocketClient* client(uint8_t num);
+  bool send(uint8_t num, const uint8_t* payload, size_t length, bool binary);
+  int8_t slotOf(uint32_t clientId) const;
+};
@@ -0,0 +1,72 @@
+#include "WsOutbox.h"
+
+void WsOutbox::release(Message& message) {
+  PsramAllocator().deallocate(message.data);
+  message = Message();
+}
+
+WsOutbox::Message* WsOutbox::find(uint8_t key) {
+  if (key == WS_OUTBOX_KEY_NONE) return nullptr;
+
+  for (uint8_t i = 0; i < count; i++) {
+    Message& message = slots[(head + i) % WS_OUTBOX_SLOTS];
+    if (message.key == key) return &message;
+  }
+  return nullptr;
+}
+
+uint32_t WsOutbox::queuedVersion(uint8_t key) const {
+  Message* message = const_cast<WsOutbox*>(this)->find(key);
+  return message ? message->version : 0;
+}
+
+bool WsOutbox::push(uint8_t key, const uint8_t* data, size_t length, bool binary, uint32_t version) {
+  Message* stale = find(key);
+  size_t freed = stale ? stale->length : 0;
+
+  if ((!stale && count == WS_OUTBOX_SLOTS) || queuedBytes - freed + length > WS_OUTBOX_MAX_BYTES) {
+    dropped++;
+    return false;
+  }
+
+  uint8_t* copy = static_cast<uint8_t*>(PsramAllocator().allocate(max(length, (size_t)1)));
+  if (!copy) {
+    dropped++;
+    return false;
+  }
+  memcpy(copy, data, length);
+
+  Message* message = stale;
+  if (stale) {
+    queuedBytes -= stale->length;
+    release(*stale);
+    coalesced++;
+  } else {
+    message = &slots[(head + count) % WS_OUTBOX_SLOTS];
+    count++;
+  }
+
+  message->data = copy;
+  message->length = length;
+  message->version = version;
+  message->key = key;
+  message->binary = binary;
+  queuedBytes += length;
+  return true;
+}
+
+void WsOutbox::pop() {
+  if (count == 0) return;
+
+  queuedBytes -= slots[head].length;
+  release(slots[head]);
+  head = (head + 1) % WS_OUTBOX_SLOTS;
+  count--;
+}
+
+void WsOutbox::clear() {
+  while (count > 0) {
+    pop();
+  }
+  head = 0;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CommonTypes.h"
+
+#define WS_OUTBOX_SLOTS 16
+#define WS_OUTBOX_MAX_BYTES ((size_t)16384)
+#define WS_OUTBOX_KEY_NONE 0xFF
+
+// Outgoing messages for one WebSocket client that could not be written yet.
+// Messages with a key (a runtime topic) hold the latest value only: pushing
+// a newer one replaces the unsent older one in place. Payloads are copied to
+// PSRAM.
+class WsOutbox {
+public:
+  struct Message {
+    uint8_t* data = nullptr;
+    size_t length = 0;
+    uint32_t version = 0;
+    uint8_t key = WS_OUTBOX_KEY_NONE;
+    bool binary = false;
+  };
+
+  WsOutbox() = default;
+  ~WsOutbox() { clear(); }
+
+  WsOutbox(const WsOutbox&) = delete;
+  WsOutbox& operator=(const WsOutbox&) = delete;
+
+  // False if the message was dropped because the outbox is full.
+  bool push(uint8_t key, const uint8_t* data, size_t length, bool binary, uint32_t version = 0);
+  const Message& front() const { return slots[head]; }
+  void pop();
+  void clear();
+
+  bool empty() const { return count == 0; }
+  size_t size() const { return count; }
+  size_t bytes() const { return queuedBytes; }
+  uint32_t queuedVersion(uint8_t key) const;
+
+  unsigned long behindSince = 0;
+  uint32_t dropped = 0;
+  uint32_t coalesced = 0;
+
+private:
+  Message slots[WS_OUTBOX_SLOTS];
+  uint8_t head = 0;
+  uint8_t count = 0;
+  size_t queuedBytes = 0;
+
+  Message* find(uint8_t key);
+  static void release(Message& message);
+};
@@ -1,2977 +0,0 @@
-#ifndef INDEX_HTML_GZ_H
-  #define INDEX_HTML_GZ_H
-
-  #include <stdint.h>
-
-  static const uint8_t index_html_gz[] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x08, 0x85, 0xb0, 0x46, 0x69, 0x02, 0x03, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x00, 0xec, 0xbd, 0x6b,
-  0x77, 0x1c, 0xc7, 0x91, 0x28, 0xf8, 0x59, 0xf8, 0x15, 0xc5, 0x96, 0xec,
-  0xee, 0x5e, 0xa1, 0x9b, 0x78, 0x90, 0x12, 0x09, 0x10, 0xe0, 0x52, 0x7c,
-  0xd8, 0x58, 0x5b, 0x24, 0x8f, 0x40, 0xda, 0x7b, 0x2f, 0xcd, 0x15, 0x1a,
-  0xe8, 0x02, 0x50, 0x56, 0xa3, 0x1b, 0xd3, 0xdd, 0x10, 0x48, 0xcb, 0x38,
-  0x47, 0x0f, 0x7b, 0xec, 0x39, 0xf2, 0xb5, 0x7c, 0x75, 0xe5, 0xb1, 0x77,
-  0xae, 0x2d, 0x8f, 0x3d, 0xbb, 0x67, 0x3e, 0xec, 0xd9, 0x33, 0xd4, 0xcb,
-  0xa6, 0x5e, 0xf4, 0x39, 0xf3, 0x0b, 0x1a, 0x7f, 0xc1, 0xbf, 0x60, 0x7f,
-  0xc2, 0x46, 0x44, 0xbe, 0x22, 0x5f, 0x55, 0xd5, 0x40, 0x83, 0xa2, 0x67,
-  0x3c, 0x1e, 0x49, 0xe8, 0xaa, 0xac, 0xc8, 0xc8, 0xc8, 0xcc, 0xc8, 0xc8,
-  0x78, 0x5e, 0x38, 0x75, 0xe5, 0xc6, 0xe5, 0x5b, 0xff, 0xe5, 0xe6, 0xd5,
-  0x64, 0x7b, 0xb8, 0xd3, 0x59, 0x9e, 0xba, 0xa0, 0xfe, 0x93, 0xb6, 0xda,
-  0xcb, 0x53, 0x49, 0x72, 0x61, 0x27, 0x1d, 0xb6, 0x92, 0x8d, 0xed, 0x56,
-  0x7f, 0x90, 0x0e, 0x97, 0x2a, 0xb7, 0x6f, 0x5d, 0x6b, 0x9c, 0xab, 0x98,
-  0x17, 0xdd, 0xd6, 0x4e, 0xba, 0x54, 0x79, 0x35, 0x4b, 0xf7, 0x77, 0x7b,
-  0xfd, 0x61, 0x25, 0xd9, 0xe8, 0x75, 0x87, 0x69, 0x17, 0x1a, 0xee, 0x67,
-  0xed, 0xe1, 0xf6, 0x52, 0x3b, 0x7d, 0x35, 0xdb, 0x48, 0x1b, 0xf4, 0x63,
-  0x3a, 0xc9, 0xba, 0xd9, 0x30, 0x6b, 0x75, 0x1a, 0x83, 0x8d, 0x56, 0x27,
-  0x5d, 0x9a, 0x6d, 0xce, 0x08, 0x40, 0xc3, 0x6c, 0xd8, 0x49, 0x97, 0x57,
-  0x77, 0x5a, 0xfd, 0x61, 0x72, 0x85, 0x3e, 0xb8, 0x70, 0x5a, 0x3c, 0xc3,
-  0xb7, 0x83, 0xe1, 0x7d, 0xf1, 0x57, 0x92, 0xac, 0xf7, 0xda, 0xf7, 0x93,
-  0xd7, 0xe8, 0xcf, 0x24, 0xd9, 0x84, 0x9e, 0x1a, 0x9b, 0xad, 0x9d, 0xac,
-  0x73, 0x7f, 0x21, 0xb9, 0xd4, 0x07, 0xb8, 0xd3, 0xc9, 0xa0, 0xd5, 0x1d,
-  0x34, 0x06, 0x69, 0x3f, 0xdb, 0x5c, 0x94, 0xad, 0x76, 0x5a, 0xf7, 0x44,
-  0xef, 0x0b, 0xc9, 0xb9, 0x99, 0x99, 0xdd, 0x7b, 0xe6, 0x79, 0x7f, 0x2b,
-  0xeb, 0x2e, 0x24, 0x33, 0x49, 0x6b, 0x6f, 0xd8, 0x53, 0x4f, 0x77, 0x5b,
-  0xed, 0x76, 0xd6, 0xdd, 0x5a, 0x48, 0xe6, 0x58, 0xd3, 0xf5, 0xd6, 0xc6,
-  0x2b, 0x5b, 0xfd, 0xde, 0x5e, 0xb7, 0xdd, 0xd8, 0xe8, 0x75, 0x7a, 0xfd,
-  0x85, 0xe4, 0xe9, 0xcd, 0xb3, 0xf8, 0x3f, 0xd1, 0xe0, 0x80, 0xfe, 0xdd,
-  0x1c, 0xb6, 0xd6, 0x07, 0x1a, 0xb7, 0x76, 0x36, 0xd8, 0xed, 0xb4, 0x00,
-  0xaf, 0xcd, 0x4e, 0xea, 0x74, 0xd9, 0x58, 0xef, 0x0d, 0x87, 0xbd, 0x1d,
-  0xa7, 0x8b, 0x5e, 0xbf, 0x9d, 0xf6, 0xf5, 0xab, 0xd9, 0xdd, 0x7b, 0xc9,
-  0xa0, 0xd7, 0xc9, 0xda, 0xc9, 0xd3, 0xed, 0x76, 0xdb, 0xed, 0x46, 0xf7,
-  0xa2, 0xb1, 0x9d, 0x05, 0x50, 0x16, 0xbc, 0x8d, 0xbd, 0xfe, 0x00, 0x11,
-  0xdd, 0xed, 0x65, 0x30, 0x1d, 0xfd, 0xbc, 0x91, 0xcc, 0xe2, 0xff, 0x6c,
-  0x3c, 0xc2, 0x08, 0x78, 0x58, 0x76, 0x7b, 0xdd, 0xd4, 0x79, 0xd5, 0x6f,
-  0xb5, 0xb3, 0xbd, 0xc1, 0x42, 0x72, 0x16, 0xbe, 0xc7, 0x7f, 0x66, 0x92,
-  0x19, 0x67, 0xf4, 0xfd, 0x6c, 0x6b, 0x7b, 0x48, 0x0d, 0xdc, 0x61, 0x35,
-  0x5b, 0x1b, 0xc3, 0xec, 0xd5, 0x54, 0x8f, 0x2e, 0x80, 0xec, 0x99, 0xcb,
-  0x97, 0xae, 0x9d, 0xd5, 0x10, 0xe5, 0xd3, 0xfd, 0xed, 0x6c, 0x98, 0xba,
-  0xc0, 0x1a, 0x72, 0x1d, 0xfa, 0x33, 0x62, 0x61, 0xad, 0xbb, 0xb0, 0xc0,
-  0xc4, 0xd6, 0x81, 0x3d, 0xc6, 0x19, 0x3d, 0xca, 0xb3, 0xbc, 0xcd, 0xbd,
-  0xc6, 0x60, 0xbb, 0xd5, 0xee, 0xed, 0x63, 0x83, 0x39, 0xd9, 0xa0, 0xbf,
-  0xb5, 0xde, 0xaa, 0xcd, 0x4c, 0xd3, 0xff, 0x9a, 0xb3, 0xf5, 0x18, 0xb2,
-  0x2e, 0x05, 0x34, 0xce, 0xeb, 0x9d, 0xde, 0xc6, 0x2b, 0xd6, 0x57, 0xdd,
-  0x74, 0xb8, 0xdf, 0xeb, 0xbf, 0xd2, 0xe8, 0x64, 0x83, 0xe1, 0x34, 0x00,
-  0x49, 0x3b, 0xe9, 0x56, 0xbf, 0xb5, 0xd3, 0xd8, 0x83, 0xc5, 0x6f, 0x96,
-  0x21, 0xbe, 0x6d, 0xd0, 0xfe, 0xb1, 0xc7, 0xad, 0x87, 0x37, 0x13, 0x04,
-  0x0a, 0x84, 0xd8, 0x09, 0x4c, 0x03, 0xae, 0x96, 0xf3, 0xf8, 0xbf, 0xc8,
-  0x82, 0x9e, 0x8d, 0xd3, 0xea, 0xac, 0xf7, 0xa6, 0x93, 0x6e, 0xc2, 0x32,
-  0x38, 0x63, 0xd6, 0x99, 0x3d, 0xb7, 0xbd, 0x57, 0xd3, 0xfe, 0x66, 0x07,
-  0xa9, 0xb8, 0x9d, 0xb5, 0xdb, 0x69, 0xd7, 0xc2, 0x13, 0x07, 0x59, 0x1a,
-  0x49, 0xb3, 0x49, 0xce, 0xee, 0xde, 0x3b, 0x71, 0xcc, 0x1d, 0x4a, 0xe2,
-  0x84, 0xf6, 0xba, 0x83, 0x69, 0x89, 0xb3, 0xfc, 0xa9, 0xd1, 0x96, 0x68,
-  0x0c, 0x7b, 0xbb, 0x36, 0x0e, 0x41, 0xf6, 0xb1, 0xd5, 0xb2, 0x5a, 0x89,
-  0x9e, 0xd6, 0xf7, 0x60, 0x04, 0x5d, 0x9f, 0x23, 0x3c, 0x07, 0xe8, 0xcd,
-  0xce, 0x85, 0x78, 0x58, 0x89, 0x6d, 0x64, 0xf8, 0x40, 0xce, 0x16, 0x3f,
-  0x53, 0xc8, 0x6d, 0x88, 0x41, 0x0f, 0xb2, 0x1f, 0xc0, 0xe2, 0x33, 0xa8,
-  0x70, 0xb4, 0x17, 0xb6, 0x71, 0x9a, 0xc3, 0x93, 0x78, 0xe6, 0x6c, 0x6b,
-  0xe6, 0xcc, 0x79, 0xff, 0x9b, 0x66, 0x1b, 0x96, 0xfa, 0x30, 0x8d, 0xcc,
-  0xfc, 0x99, 0x33, 0xf3, 0xf3, 0xcf, 0x45, 0x3f, 0xca, 0xeb, 0xaf, 0x3d,
-  0x3f, 0xb7, 0x39, 0xb7, 0x19, 0xf8, 0x74, 0x90, 0xc2, 0xee, 0x6c, 0xb7,
-  0xfa, 0xf7, 0xc3, 0xdf, 0xcd, 0xcd, 0x9e, 0x7f, 0xee, 0xda, 0x7c, 0xde,
-  0x77, 0x79, 0xbd, 0xce, 0xac, 0x3f, 0xdf, 0x6e, 0xb7, 0x02, 0x5f, 0x0f,
-  0xd3, 0xc1, 0x30, 0xfc, 0xc9, 0xb5, 0x6b, 0xe7, 0xe1, 0x20, 0x8b, 0x7c,
-  0x92, 0xd7, 0xd7, 0xb5, 0xb3, 0xcf, 0x5f, 0x0e, 0x7e, 0xb8, 0xd1, 0xea,
-  0x6e, 0xa4, 0x9d, 0xf0, 0x47, 0xe7, 0x53, 0xfc, 0x5f, 0xf4, 0xa3, 0xbc,
-  0xfe, 0x9e, 0x3f, 0x8b, 0xff, 0xe3, 0x9f, 0x6e, 0xf6, 0xfa, 0x3b, 0xf9,
-  0x47, 0x24, 0xfe, 0xdd, 0x68, 0x67, 0xfd, 0x94, 0x36, 0xca, 0x02, 0xae,
-  0xcd, 0xbd, 0x9d, 0xae, 0xbd, 0x03, 0xfc, 0x6d, 0x4c, 0xfb, 0x27, 0x7c,
-  0x62, 0xc7, 0xd9, 0xc1, 0x5c, 0x89, 0x3d, 0x2f, 0x77, 0x33, 0xe2, 0xdd,
-  0x40, 0x78, 0xbb, 0xc7, 0xc6, 0xbe, 0x0c, 0x0f, 0x12, 0xbd, 0x76, 0x5a,
-  0xeb, 0x6c, 0x52, 0x68, 0x2f, 0xed, 0xa7, 0xe2, 0xf0, 0x5c, 0xef, 0x75,
-  0x2c, 0xa1, 0x20, 0xeb, 0xee, 0xee, 0xc1, 0x29, 0x30, 0x80, 0x45, 0xbe,
-  0x31, 0xf4, 0x79, 0xc1, 0x39, 0x77, 0xa0, 0x05, 0xe7, 0x7b, 0x60, 0x87,
-  0xf3, 0xad, 0x7c, 0xc6, 0xa1, 0xce, 0xc6, 0x76, 0xba, 0xf1, 0x0a, 0x9e,
-  0x7b, 0x25, 0x28, 0xd4, 0xea, 0x64, 0x5b, 0x5d, 0x62, 0xdd, 0x00, 0x7f,
-  0x23, 0xe5, 0xdc, 0x82, 0xc8, 0x73, 0xce, 0x81, 0x3d, 0x18, 0xb6, 0x86,
-  0x7b, 0xc5, 0xfc, 0x32, 0x3e, 0xd4, 0x71, 0x07, 0x33, 0xd8, 0xdb, 0xd8,
-  0x48, 0x07, 0x83, 0x3c, 0x21, 0xa4, 0xbd, 0xb9, 0x39, 0xd3, 0x3e, 0xe7,
-  0x70, 0xcf, 0xa7, 0xe7, 0x37, 0x9e, 0x7f, 0x6e, 0xde, 0x16, 0xd5, 0xd2,
-  0x7e, 0xbf, 0xd7, 0xcf, 0x83, 0xb4, 0x39, 0xd7, 0x4e, 0xdb, 0xa9, 0x0b,
-  0xa9, 0x75, 0xfe, 0xcc, 0x99, 0x33, 0x73, 0x16, 0xa4, 0xac, 0xbb, 0xd9,
-  0xcb, 0x45, 0xe9, 0x7c, 0xda, 0xde, 0x7c, 0xde, 0x43, 0x69, 0xf6, 0xf9,
-  0x99, 0x73, 0x16, 0x4b, 0x6b, 0x8a, 0xc3, 0x34, 0x4f, 0x28, 0x3a, 0x98,
-  0xb2, 0x4f, 0x30, 0xbc, 0x06, 0xb0, 0x1d, 0x6e, 0x4e, 0xd3, 0xd8, 0xe1,
-  0x92, 0x9e, 0xdb, 0x3c, 0x9b, 0x9e, 0xcb, 0x3d, 0xc9, 0xbe, 0xbf, 0x37,
-  0x18, 0x66, 0x9b, 0xf7, 0x95, 0xd8, 0xb3, 0x90, 0x0c, 0x76, 0x5b, 0x70,
-  0x49, 0x58, 0x87, 0x2e, 0xd3, 0xb4, 0x5b, 0x62, 0xad, 0x04, 0x0f, 0x9c,
-  0x83, 0x10, 0xe2, 0xb9, 0x2c, 0xff, 0x5c, 0x9a, 0xaa, 0x89, 0x74, 0x3e,
-  0xde, 0x69, 0xc1, 0x32, 0xb3, 0xa8, 0x7e, 0xa4, 0xe5, 0xcc, 0x89, 0x84,
-  0xdf, 0xc1, 0x93, 0x60, 0x77, 0xb8, 0x48, 0x7b, 0xce, 0x2a, 0x8f, 0x09,
-  0x67, 0x74, 0x31, 0x9a, 0xd0, 0x2e, 0xcb, 0xc7, 0xca, 0xd9, 0x7c, 0xc1,
-  0xe3, 0x9c, 0x33, 0x54, 0xe0, 0x29, 0xcf, 0x45, 0xf7, 0xdf, 0x7c, 0x6c,
-  0xb9, 0xcc, 0xc3, 0xb1, 0xdb, 0x76, 0x97, 0xee, 0xec, 0xf9, 0xe7, 0x9f,
-  0x6b, 0xcf, 0xe5, 0x89, 0x54, 0xee, 0xc2, 0x9c, 0x08, 0xbb, 0xd1, 0x7d,
-  0xc0, 0xce, 0xdd, 0x2f, 0x1a, 0xf8, 0xb0, 0x0f, 0x97, 0xcd, 0x4c, 0x70,
-  0x7a, 0xfa, 0x9b, 0x8e, 0xb7, 0x99, 0xe6, 0xfc, 0x20, 0x49, 0x5b, 0x03,
-  0xbd, 0xad, 0x77, 0x60, 0x25, 0xc9, 0x0b, 0x28, 0x3f, 0xba, 0x86, 0xe9,
-  0xbd, 0x61, 0x83, 0xf0, 0xb3, 0x31, 0x73, 0x30, 0x69, 0xc3, 0x1d, 0x3b,
-  0xeb, 0x0c, 0x02, 0xfb, 0xef, 0x6c, 0xa9, 0xe3, 0x4e, 0xce, 0x82, 0xe0,
-  0x98, 0xf1, 0x5b, 0xa5, 0xea, 0x6e, 0x32, 0x27, 0x34, 0x13, 0xf6, 0xd8,
-  0x01, 0xca, 0x49, 0x7a, 0x54, 0xd0, 0xcf, 0x95, 0x3a, 0x3e, 0x59, 0xa7,
-  0xae, 0xc4, 0x5d, 0x46, 0xb2, 0x76, 0xce, 0x99, 0xf8, 0x91, 0x3d, 0xe7,
-  0xf5, 0x39, 0x00, 0xb1, 0xe8, 0x78, 0x7d, 0xea, 0xf1, 0xb0, 0x6e, 0xa3,
-  0xcb, 0x58, 0x75, 0xdb, 0xda, 0x05, 0x5c, 0xb7, 0xb6, 0x18, 0x5f, 0x50,
-  0x3c, 0x64, 0x96, 0x6e, 0xe1, 0x8b, 0xa5, 0xb9, 0xf7, 0xe6, 0xcc, 0xe6,
-  0xb9, 0xcd, 0xcd, 0xa3, 0xdf, 0x85, 0x7c, 0x71, 0x18, 0x91, 0xdb, 0xcc,
-  0xd2, 0x4e, 0x3b, 0x72, 0x8c, 0x87, 0x58, 0x49, 0x1c, 0xbd, 0xd0, 0xe2,
-  0x8e, 0xa2, 0x17, 0x5b, 0xf2, 0x52, 0x6e, 0xd9, 0xeb, 0xf7, 0x81, 0x96,
-  0x8d, 0xf5, 0x56, 0x7b, 0xcb, 0x10, 0x4e, 0x72, 0xa0, 0xad, 0x3e, 0x3b,
-  0x89, 0x22, 0xc2, 0x57, 0xee, 0x0d, 0x87, 0x44, 0x97, 0x6c, 0xa3, 0x91,
-  0x79, 0xa3, 0xd7, 0xcb, 0x61, 0xab, 0x9f, 0x69, 0x48, 0xf8, 0x77, 0x03,
-  0x26, 0x18, 0xde, 0x0c, 0xd3, 0x86, 0x58, 0xf9, 0x30, 0xa4, 0xd9, 0xcd,
-  0x3e, 0xfe, 0x53, 0x6e, 0xa1, 0x86, 0x04, 0xa2, 0xd9, 0x99, 0xf8, 0x44,
-  0xc3, 0xff, 0x8a, 0x84, 0x25, 0x39, 0x96, 0x7e, 0xfa, 0x77, 0x7b, 0xb0,
-  0x2f, 0xdb, 0x62, 0x28, 0x72, 0x24, 0x8a, 0xc6, 0x73, 0x86, 0xc6, 0x9b,
-  0x9b, 0xad, 0xb3, 0x33, 0x33, 0xc9, 0xa9, 0x6c, 0x07, 0x95, 0x81, 0xad,
-  0xee, 0x50, 0x40, 0x09, 0x89, 0x3e, 0x9b, 0x9b, 0xe7, 0xd2, 0xe7, 0x9c,
-  0x96, 0xd8, 0x9b, 0x90, 0x9a, 0x8a, 0x3b, 0x9a, 0x99, 0x29, 0xdb, 0x51,
-  0xfa, 0x5c, 0x5e, 0x47, 0x3b, 0x20, 0xed, 0xb5, 0xf4, 0xfc, 0xcb, 0xaf,
-  0x60, 0xa8, 0x8b, 0x53, 0xd1, 0x09, 0xe6, 0x44, 0x97, 0x6b, 0x8e, 0xd6,
-  0x14, 0x5e, 0xf9, 0x70, 0xe7, 0xdb, 0x47, 0x53, 0x60, 0xf7, 0x97, 0x91,
-  0x7f, 0xa2, 0x7b, 0x3e, 0xc2, 0x83, 0x04, 0x06, 0xe6, 0xa6, 0x02, 0xd2,
-  0x4b, 0x27, 0xeb, 0xaa, 0x71, 0xb9, 0xac, 0x15, 0x78, 0x71, 0x41, 0x37,
-  0x45, 0x38, 0xca, 0x5d, 0xa4, 0xb4, 0x31, 0xd4, 0x31, 0xb6, 0x05, 0xc1,
-  0xa9, 0xe8, 0x54, 0xf6, 0x56, 0x71, 0xce, 0x31, 0x1d, 0xe5, 0x8a, 0x6a,
-  0x17, 0x17, 0xe8, 0x82, 0xb8, 0x8c, 0x17, 0x61, 0x30, 0x27, 0xa8, 0xc5,
-  0x1a, 0x57, 0x28, 0x29, 0xb3, 0x30, 0xfc, 0x81, 0x2f, 0x43, 0x3f, 0xaf,
-  0x1e, 0x53, 0x50, 0x0d, 0xd3, 0xd5, 0x99, 0xd5, 0xd0, 0x45, 0xd8, 0xa1,
-  0xde, 0x4c, 0x31, 0x14, 0x47, 0x65, 0x55, 0x0c, 0x20, 0x2e, 0xeb, 0x71,
-  0xf5, 0x54, 0xfe, 0x4a, 0x69, 0x0e, 0xf6, 0xb3, 0xe1, 0xc6, 0xb6, 0x04,
-  0xb1, 0xdb, 0x53, 0x82, 0x5b, 0x3f, 0x05, 0x86, 0x9b, 0xbd, 0x2a, 0xa1,
-  0x68, 0xc0, 0x62, 0xf3, 0x34, 0x98, 0xde, 0x55, 0x8a, 0x70, 0xcf, 0xe9,
-  0xd5, 0xb1, 0x2d, 0xcf, 0x83, 0xf9, 0x33, 0x16, 0x0b, 0x10, 0xdd, 0xd0,
-  0x8d, 0x5c, 0x76, 0xd6, 0x83, 0x39, 0xcc, 0x86, 0xf7, 0xf5, 0xd0, 0x24,
-  0xa4, 0x19, 0x1b, 0xcc, 0x0c, 0x83, 0x01, 0x2b, 0x49, 0x8f, 0xd6, 0xa0,
-  0xda, 0x5a, 0x87, 0x35, 0xb6, 0xa7, 0x74, 0x74, 0xc1, 0x2b, 0x10, 0xb1,
-  0x24, 0x09, 0x58, 0x2c, 0x4d, 0xf9, 0xa3, 0xcf, 0x3a, 0xc1, 0xc5, 0x6b,
-  0xd1, 0x3a, 0xc0, 0x35, 0x37, 0x36, 0x36, 0x24, 0x44, 0x26, 0xe4, 0x36,
-  0xcf, 0x0c, 0x16, 0xa7, 0x42, 0xa2, 0xbd, 0x4d, 0x01, 0xc2, 0x7e, 0x61,
-  0x3d, 0x85, 0x69, 0x4f, 0x8b, 0x06, 0xa1, 0xd6, 0x79, 0xa5, 0x62, 0x53,
-  0x63, 0x4e, 0x0b, 0x7a, 0x92, 0x5a, 0xe6, 0x81, 0xde, 0x72, 0xf6, 0x58,
-  0xcc, 0x03, 0x6f, 0x34, 0x4c, 0xb3, 0x59, 0x66, 0x38, 0x67, 0x67, 0xbe,
-  0xa6, 0x47, 0x43, 0xf3, 0xb8, 0x40, 0x1a, 0x8e, 0xb4, 0x9d, 0x3c, 0xeb,
-  0xcc, 0x4d, 0xae, 0x85, 0x22, 0xef, 0x7b, 0x9b, 0x3a, 0xfa, 0xf2, 0x20,
-  0xef, 0x11, 0x28, 0x02, 0xfc, 0xef, 0x35, 0x1c, 0x71, 0x5d, 0x03, 0x92,
-  0xbc, 0x56, 0x5c, 0xc9, 0x40, 0x64, 0xe9, 0x74, 0x7a, 0x6c, 0x0f, 0x71,
-  0x0a, 0x6f, 0x66, 0xf7, 0x52, 0x2d, 0x56, 0x18, 0xfa, 0x70, 0x75, 0x97,
-  0x22, 0xa2, 0x1c, 0x29, 0xbb, 0xce, 0x78, 0x58, 0x34, 0xa0, 0x4d, 0x9d,
-  0x41, 0xf3, 0x46, 0x2c, 0x4d, 0x1b, 0x89, 0xfc, 0xff, 0xe6, 0xf3, 0xac,
-  0x35, 0x3b, 0xec, 0xcd, 0xc3, 0xb8, 0xd1, 0x2a, 0xba, 0xb0, 0x72, 0xd4,
-  0x36, 0x51, 0x76, 0x90, 0x24, 0x3f, 0x80, 0x23, 0xb0, 0x8d, 0xb7, 0xdb,
-  0xf3, 0xf0, 0x7f, 0xe6, 0xb1, 0xbb, 0x1d, 0xdd, 0x65, 0x21, 0xdf, 0xc3,
-  0x50, 0xce, 0xda, 0x17, 0x39, 0x23, 0x88, 0xcc, 0x6b, 0x7e, 0x4f, 0x1f,
-  0xee, 0xb6, 0x50, 0x8e, 0x54, 0xcd, 0xcc, 0xc1, 0x68, 0x4f, 0x96, 0xa7,
-  0x5a, 0x0a, 0xc1, 0x7b, 0xfa, 0xcc, 0x46, 0x6b, 0xd3, 0x9c, 0x1f, 0x51,
-  0x58, 0xb6, 0x6a, 0x29, 0x08, 0x89, 0xeb, 0xc2, 0x09, 0x52, 0x13, 0x79,
-  0xdd, 0x7d, 0x79, 0x0d, 0x9b, 0xb2, 0x1e, 0x38, 0xa7, 0xa8, 0x77, 0x0c,
-  0x91, 0xf8, 0x00, 0x28, 0xf4, 0x69, 0x94, 0xec, 0xc4, 0xb0, 0xc1, 0xca,
-  0x3f, 0xdb, 0xe9, 0x60, 0xa3, 0x9f, 0xed, 0x22, 0x39, 0x09, 0x5c, 0x50,
-  0x7c, 0xe6, 0xd7, 0x62, 0xb1, 0x08, 0x0c, 0x2c, 0x54, 0xbc, 0xb0, 0x63,
-  0xc6, 0x3b, 0xd1, 0x22, 0xa7, 0x99, 0x25, 0x57, 0xb0, 0xd5, 0x32, 0xd3,
-  0x3c, 0x9f, 0xee, 0x10, 0x7c, 0xad, 0x21, 0xe5, 0xac, 0x05, 0x2d, 0xc4,
-  0x72, 0xa4, 0x4a, 0xc2, 0xd2, 0x26, 0xe3, 0xd9, 0x19, 0xdc, 0x22, 0x53,
-  0x6c, 0xdd, 0xca, 0x23, 0xdf, 0x48, 0x09, 0xea, 0xb9, 0x64, 0xb1, 0xb3,
-  0x33, 0x1b, 0xdb, 0xf2, 0x0b, 0xb2, 0x05, 0x66, 0x3f, 0xa0, 0xc5, 0xae,
-  0x4d, 0xa7, 0xf7, 0xa4, 0xe8, 0xd4, 0xec, 0xf4, 0xb6, 0x1a, 0xd0, 0xa5,
-  0xb6, 0x2b, 0xe8, 0x7d, 0x61, 0x89, 0x94, 0xa6, 0xd5, 0xb3, 0xfe, 0x27,
-  0x5c, 0x10, 0x9d, 0x77, 0xbf, 0xda, 0x06, 0x7c, 0x3a, 0x88, 0x93, 0x25,
-  0x45, 0xeb, 0xbd, 0x75, 0xce, 0x30, 0x50, 0x6e, 0xb1, 0x9c, 0x91, 0x56,
-  0xcb, 0xa7, 0x67, 0x66, 0x9e, 0x7f, 0xe1, 0xda, 0xb5, 0x69, 0x7a, 0x70,
-  0xce, 0x98, 0x30, 0x61, 0xb2, 0xe6, 0xa7, 0x93, 0xb9, 0xb3, 0x67, 0x71,
-  0xaf, 0x9f, 0x91, 0x7b, 0xbd, 0xd5, 0xcd, 0x76, 0x5a, 0x92, 0xfb, 0xc0,
-  0x41, 0x7d, 0x63, 0x6f, 0xf8, 0x02, 0x75, 0x96, 0x48, 0x55, 0x08, 0x4c,
-  0x68, 0xa3, 0x07, 0xe7, 0x21, 0x70, 0x97, 0xfd, 0x56, 0xbf, 0x3d, 0xd0,
-  0x88, 0xfe, 0xaf, 0xaf, 0xa4, 0xf7, 0x37, 0xfb, 0x2d, 0x90, 0xc1, 0x9d,
-  0x0f, 0x05, 0xca, 0x33, 0x5f, 0x33, 0x42, 0xdd, 0xf1, 0xb1, 0x14, 0x77,
-  0x19, 0x9c, 0xd1, 0x1c, 0xa8, 0x33, 0x21, 0x10, 0x0c, 0x80, 0xa0, 0x2f,
-  0x30, 0xb6, 0x4e, 0x6b, 0x77, 0x90, 0xad, 0x77, 0x52, 0x2e, 0xf4, 0x06,
-  0x65, 0x10, 0xf8, 0xa4, 0x49, 0xba, 0x7c, 0x58, 0x53, 0xc3, 0x6d, 0x7d,
-  0x4f, 0x77, 0x56, 0x75, 0x70, 0x4d, 0xe3, 0xa7, 0xa2, 0x7d, 0x23, 0xdb,
-  0xc0, 0xcd, 0xa4, 0x3a, 0x60, 0x6b, 0xd0, 0x13, 0x04, 0x2c, 0x3e, 0xd9,
-  0x9c, 0x83, 0x95, 0x8f, 0x60, 0x94, 0xe2, 0xd7, 0x61, 0x96, 0x62, 0x3c,
-  0x17, 0x4e, 0x4b, 0x1f, 0x8b, 0xa9, 0x0b, 0xa7, 0x85, 0xdb, 0xc7, 0x05,
-  0xf4, 0xb4, 0x20, 0xef, 0x8b, 0xed, 0xd9, 0xe5, 0xab, 0xab, 0x37, 0xe7,
-  0xe7, 0x92, 0xef, 0x66, 0xd7, 0xb2, 0xe4, 0xeb, 0xc9, 0x2d, 0x69, 0x69,
-  0x4e, 0x5e, 0x6c, 0x75, 0xe1, 0xde, 0xd4, 0x87, 0x2f, 0x66, 0x97, 0x09,
-  0x08, 0x0a, 0xa1, 0x1b, 0x9d, 0xd6, 0x60, 0xb0, 0x54, 0x41, 0x5f, 0x88,
-  0x8a, 0x70, 0xd9, 0x70, 0x1e, 0x27, 0xc2, 0xc4, 0x5d, 0x49, 0x7a, 0xdd,
-  0x8d, 0x4e, 0xb6, 0xf1, 0xca, 0x52, 0xa5, 0xb7, 0x9b, 0x76, 0x6f, 0xb5,
-  0xd6, 0x6b, 0xd5, 0xfd, 0x6c, 0x33, 0x6b, 0x40, 0x93, 0x6a, 0xbd, 0xb2,
-  0x8c, 0x9d, 0x5d, 0x38, 0x0d, 0x9f, 0x06, 0x81, 0x84, 0xbe, 0xd6, 0x16,
-  0x70, 0x09, 0x41, 0xe1, 0x39, 0x1e, 0x14, 0xe9, 0xae, 0x32, 0x48, 0x87,
-  0x43, 0xd8, 0x8b, 0x03, 0x05, 0x6c, 0x55, 0xfe, 0x1e, 0x0f, 0x18, 0xae,
-  0x8c, 0x7e, 0xaf, 0xa3, 0x80, 0x5c, 0x16, 0x3f, 0x35, 0x0c, 0xf9, 0x87,
-  0x22, 0x5d, 0xd6, 0x5e, 0xaa, 0x08, 0x2e, 0xff, 0x82, 0x60, 0xf2, 0x15,
-  0x05, 0xde, 0xe6, 0xfd, 0x95, 0x84, 0x26, 0x6b, 0xa9, 0x62, 0xcd, 0x64,
-  0x65, 0xd9, 0x80, 0xb3, 0x91, 0x0b, 0xae, 0xd5, 0xc0, 0xe4, 0x78, 0x6b,
-  0x54, 0xb6, 0x09, 0x36, 0x6b, 0x81, 0x00, 0x00, 0x12, 0xf2, 0x2b, 0xba,
-  0xcd, 0x05, 0x61, 0xae, 0x82, 0x1d, 0xbe, 0x54, 0xd9, 0xb9, 0x72, 0x7d,
-  0xb5, 0xb2, 0x3c, 0x7a, 0x6f, 0xf4, 0xe8, 0xf0, 0x8d, 0xc3, 0x37, 0x0f,
-  0xdf, 0x1a, 0xfd, 0x39, 0x19, 0x3d, 0x1c, 0xfd, 0x29, 0x39, 0x7c, 0x63,
-  0xf4, 0xc9, 0xe1, 0x9b, 0xa3, 0x87, 0x0b, 0x30, 0x74, 0x6a, 0xbe, 0xac,
-  0x8e, 0xb7, 0x0b, 0xad, 0x64, 0xbb, 0x9f, 0x6e, 0x2e, 0x55, 0x9e, 0xae,
-  0x10, 0x1d, 0x76, 0xda, 0xdd, 0x81, 0x80, 0x9f, 0xc0, 0xa1, 0xb3, 0x85,
-  0x7e, 0x47, 0x2f, 0xaf, 0x77, 0x5a, 0xd8, 0xdf, 0x85, 0xd3, 0x2d, 0x89,
-  0xbb, 0x99, 0x0b, 0xfa, 0x09, 0xc7, 0x70, 0x57, 0x4f, 0x88, 0xd9, 0x34,
-  0x6c, 0x62, 0xc4, 0xd3, 0x17, 0x01, 0xf6, 0x0a, 0x8a, 0x65, 0x35, 0x98,
-  0x93, 0xbf, 0xfc, 0xe6, 0xe7, 0xb0, 0xf8, 0xe1, 0x4b, 0x0f, 0xe6, 0x05,
-  0x21, 0xc2, 0x0f, 0xef, 0xef, 0x02, 0xa9, 0x51, 0x59, 0x2b, 0x31, 0xc3,
-  0xb1, 0x25, 0x40, 0xf7, 0x8d, 0x74, 0x1b, 0x4e, 0xb2, 0x14, 0x86, 0x0b,
-  0x4f, 0x92, 0xeb, 0xc0, 0xc3, 0xf4, 0x7c, 0x89, 0xbd, 0x06, 0xa4, 0x51,
-  0x53, 0xa2, 0xe7, 0x57, 0x2d, 0xf1, 0x0a, 0x5b, 0x39, 0xda, 0x53, 0x45,
-  0xee, 0x0c, 0x6c, 0xbf, 0x3d, 0xaf, 0xe7, 0xde, 0x52, 0x29, 0xa8, 0x69,
-  0xa3, 0xb1, 0x6a, 0x80, 0x3b, 0xbd, 0x76, 0x2a, 0xcc, 0x02, 0x62, 0xe3,
-  0x24, 0x2f, 0xc2, 0x03, 0x6b, 0x58, 0x62, 0x72, 0x14, 0x48, 0xba, 0xa2,
-  0x54, 0x18, 0xe9, 0xf8, 0x50, 0x95, 0x35, 0x4f, 0x0c, 0x37, 0x1b, 0x34,
-  0x5a, 0xbb, 0x44, 0xc2, 0xed, 0x56, 0x77, 0x2b, 0x55, 0x34, 0xbc, 0x74,
-  0x13, 0xbb, 0x40, 0x02, 0x86, 0xe9, 0x2f, 0xa4, 0x5c, 0x9c, 0x2c, 0x4e,
-  0x5b, 0x39, 0xe7, 0xc0, 0x31, 0xe6, 0xf9, 0x3a, 0xc5, 0x7e, 0xb4, 0x8e,
-  0x50, 0x53, 0xc6, 0x68, 0x0d, 0x35, 0x39, 0x93, 0xc0, 0x72, 0x34, 0x37,
-  0x52, 0xd6, 0xc0, 0x5d, 0x90, 0x00, 0x6b, 0x30, 0xc8, 0xda, 0x95, 0xe5,
-  0x4b, 0x37, 0x93, 0xd5, 0xd5, 0x95, 0x2b, 0x1a, 0x15, 0xeb, 0x83, 0xf0,
-  0x84, 0xab, 0x6f, 0xed, 0x39, 0x07, 0x96, 0xd8, 0xb8, 0x74, 0x93, 0xe3,
-  0xc4, 0x76, 0xdf, 0x51, 0x71, 0xdc, 0x85, 0xd6, 0xfb, 0x70, 0xfe, 0x11,
-  0x9e, 0x37, 0xe5, 0x8f, 0x31, 0x71, 0xd5, 0x30, 0x6c, 0x7c, 0xbf, 0x9d,
-  0xb6, 0x5e, 0x4d, 0x93, 0x74, 0x67, 0x17, 0x04, 0x5b, 0xe8, 0x2e, 0x41,
-  0x1e, 0x95, 0x48, 0xa5, 0xff, 0x84, 0x47, 0x91, 0xed, 0x0a, 0x3a, 0x93,
-  0xfa, 0x33, 0x59, 0xb9, 0x39, 0xe6, 0x00, 0xe0, 0x73, 0x1b, 0xf5, 0xd9,
-  0xf3, 0x73, 0xcd, 0xd9, 0xe7, 0xce, 0x35, 0xcf, 0x34, 0x67, 0x7d, 0x4c,
-  0x5d, 0xa4, 0x39, 0x27, 0x2d, 0x5c, 0x51, 0x49, 0x78, 0x49, 0xd9, 0xf6,
-  0xec, 0x4a, 0x12, 0xe4, 0xb7, 0x8b, 0x39, 0xe3, 0xb1, 0xb7, 0x10, 0xba,
-  0x17, 0x36, 0xfa, 0xe8, 0x0c, 0xd2, 0x85, 0xbd, 0x0c, 0xd8, 0x88, 0xcb,
-  0x20, 0x10, 0xb4, 0xd5, 0x19, 0xa4, 0x79, 0xb4, 0xb4, 0x3f, 0x5c, 0xbe,
-  0x04, 0xbf, 0x93, 0x97, 0xd4, 0x6f, 0x8f, 0xac, 0x31, 0x8a, 0x48, 0x75,
-  0x8b, 0xe6, 0x82, 0x03, 0x58, 0x09, 0xc8, 0x25, 0xd4, 0x99, 0x56, 0x4b,
-  0x5f, 0x05, 0xee, 0x53, 0xd7, 0xc7, 0x8a, 0x67, 0xfb, 0x00, 0x56, 0xfe,
-  0x7b, 0x60, 0xe5, 0x3f, 0x3e, 0x7c, 0x7d, 0xf4, 0x60, 0xf4, 0xe5, 0xe8,
-  0x21, 0xb0, 0xf4, 0x9f, 0x25, 0xf0, 0xc7, 0x03, 0xe2, 0xee, 0xaf, 0x8f,
-  0x1e, 0x8d, 0x3e, 0x1d, 0x7d, 0x36, 0x7a, 0x98, 0x88, 0x33, 0x5b, 0x74,
-  0xb7, 0x6c, 0xf5, 0x2d, 0xc8, 0x22, 0x7e, 0x08, 0xa2, 0xf4, 0xd3, 0xf5,
-  0x5e, 0x6f, 0xf8, 0x02, 0x3d, 0x79, 0x79, 0x0e, 0x68, 0x6c, 0xd8, 0x9d,
-  0x70, 0x9a, 0x61, 0x6c, 0x7b, 0xd0, 0x03, 0x7a, 0x0d, 0x9b, 0x83, 0xb4,
-  0xdb, 0xae, 0xfd, 0x6f, 0xab, 0x37, 0xae, 0xc3, 0x5d, 0xa8, 0x0f, 0x88,
-  0xc3, 0x05, 0xa5, 0xf6, 0x5a, 0x42, 0xc8, 0x2f, 0x24, 0x55, 0x01, 0xb0,
-  0x9a, 0x1c, 0xd4, 0xeb, 0x8b, 0x09, 0xdd, 0x54, 0x56, 0xd3, 0xfe, 0xab,
-  0x69, 0xff, 0x32, 0x52, 0xbb, 0x56, 0x4f, 0x60, 0x10, 0xbf, 0x83, 0xd3,
-  0xe7, 0xf5, 0xd1, 0x27, 0xa3, 0x3f, 0xc1, 0x30, 0x3e, 0x3a, 0x7c, 0x1d,
-  0xce, 0xa5, 0x3f, 0x89, 0xc1, 0x18, 0xa4, 0x05, 0xd6, 0xdb, 0x73, 0xf6,
-  0x88, 0x3f, 0x81, 0x7f, 0xbe, 0x3c, 0x7c, 0x7b, 0xf4, 0x89, 0x3e, 0xc1,
-  0x80, 0x85, 0xcd, 0x2d, 0xdb, 0x0b, 0x8e, 0x38, 0xb1, 0x38, 0xa9, 0x9d,
-  0x83, 0xdb, 0x39, 0x9a, 0xf7, 0x3a, 0x62, 0x81, 0xc2, 0x34, 0xb4, 0x1b,
-  0x72, 0x0b, 0x9a, 0x4f, 0xb8, 0x5f, 0x5f, 0x45, 0x7d, 0x72, 0x7a, 0xaf,
-  0x13, 0x38, 0xd8, 0xb9, 0xad, 0x89, 0xef, 0x0c, 0x6f, 0xc2, 0x89, 0x1a,
-  0xd0, 0x18, 0xf9, 0x35, 0x0c, 0xec, 0x33, 0x39, 0x8d, 0x38, 0x73, 0x1f,
-  0xc2, 0x2c, 0x5a, 0x14, 0x88, 0x42, 0x81, 0xdb, 0xc9, 0xf5, 0x74, 0xff,
-  0xba, 0x40, 0x0f, 0x20, 0xf9, 0x33, 0xb6, 0xfc, 0x6c, 0x82, 0x67, 0xfe,
-  0xe8, 0x03, 0x80, 0xff, 0xa1, 0x5c, 0x26, 0x82, 0x60, 0x6e, 0x07, 0xe1,
-  0x1d, 0x8b, 0xc3, 0x09, 0x12, 0x30, 0xc1, 0xfb, 0xa0, 0x43, 0xc5, 0xed,
-  0x39, 0xb1, 0xb9, 0x5e, 0x6d, 0x65, 0xb0, 0x0f, 0xe0, 0xac, 0x57, 0x94,
-  0x54, 0x27, 0x65, 0x78, 0xd7, 0xda, 0x62, 0x49, 0x7c, 0x56, 0xe5, 0x24,
-  0xf9, 0xe0, 0x23, 0x13, 0x25, 0xa6, 0xc8, 0x3b, 0xef, 0xb9, 0x50, 0x1a,
-  0x3a, 0xf3, 0x85, 0xfb, 0x33, 0x9f, 0xd3, 0xe0, 0x71, 0x0f, 0x68, 0x69,
-  0xb1, 0x1b, 0xee, 0x16, 0x0c, 0xcf, 0xbc, 0x83, 0x3d, 0x87, 0x27, 0x69,
-  0xbc, 0xd2, 0x2e, 0x8e, 0xae, 0x6d, 0xbe, 0x29, 0x7d, 0x8a, 0x5b, 0xf2,
-  0x2b, 0x99, 0x8d, 0x2d, 0xc0, 0xf8, 0x44, 0x31, 0xd8, 0x82, 0x53, 0x84,
-  0xf3, 0x3c, 0x18, 0x5d, 0x03, 0x0f, 0xea, 0x17, 0x7a, 0xc3, 0xe4, 0x56,
-  0xef, 0x95, 0xb4, 0xeb, 0xb0, 0xb9, 0xc8, 0xb9, 0x21, 0x3f, 0x73, 0x0e,
-  0x8e, 0xb9, 0xf9, 0x33, 0x67, 0x9f, 0x7b, 0xfe, 0xdc, 0xf9, 0x85, 0x4b,
-  0x2f, 0x5c, 0x6e, 0x5c, 0xb9, 0x7a, 0x0d, 0x1f, 0x6c, 0x6d, 0xaf, 0xbc,
-  0xd2, 0x69, 0xfc, 0xe0, 0xfe, 0xbd, 0xb3, 0xcf, 0x7f, 0x77, 0xee, 0xd5,
-  0xd9, 0x3d, 0x78, 0x96, 0xee, 0xcf, 0xaa, 0x93, 0xc5, 0x9a, 0xc0, 0x30,
-  0xc6, 0x02, 0xdb, 0xe5, 0xd1, 0xbf, 0xc0, 0x1a, 0xff, 0x64, 0xf4, 0x31,
-  0xac, 0xf7, 0x2f, 0x46, 0x9f, 0x13, 0x8b, 0x78, 0x78, 0xf8, 0x0e, 0xa7,
-  0x4e, 0xce, 0x89, 0xe2, 0x2e, 0x4d, 0x71, 0x03, 0x8c, 0x98, 0xbf, 0xed,
-  0x9b, 0x21, 0xd3, 0xc4, 0x54, 0xd8, 0x0e, 0x1a, 0x67, 0xce, 0x77, 0xf7,
-  0x06, 0xdb, 0x8d, 0x99, 0x8a, 0xf4, 0xdc, 0xb7, 0x1e, 0x07, 0xe7, 0xc4,
-  0xfd, 0x70, 0x79, 0xf4, 0xfe, 0xe1, 0x4f, 0x41, 0xa0, 0xff, 0x80, 0xb8,
-  0xfe, 0x9d, 0xab, 0x2f, 0xbd, 0x74, 0xe3, 0xa5, 0xbb, 0xd6, 0x3c, 0xb9,
-  0xfb, 0x7b, 0x6c, 0xec, 0x66, 0x8f, 0x8a, 0x1d, 0x4c, 0xe4, 0xe8, 0xd7,
-  0xb0, 0xad, 0x7f, 0x04, 0x9b, 0xfc, 0x75, 0x98, 0x99, 0x07, 0x87, 0x7f,
-  0x0f, 0x98, 0x3e, 0xd2, 0x0c, 0xfc, 0xce, 0xca, 0xf5, 0x6b, 0x37, 0x26,
-  0x8c, 0xec, 0xdc, 0x51, 0x91, 0x9d, 0xa3, 0x43, 0xe9, 0xd1, 0xe8, 0xf3,
-  0xc3, 0x9f, 0xc1, 0x51, 0x24, 0x99, 0x31, 0x2c, 0x25, 0xf8, 0x0d, 0x2c,
-  0x09, 0x88, 0x8b, 0x08, 0xdf, 0x5e, 0xbd, 0x1a, 0xa6, 0xae, 0xfe, 0xc3,
-  0xe6, 0x8b, 0xf3, 0x84, 0x21, 0x37, 0x9b, 0x44, 0x58, 0x61, 0x50, 0x59,
-  0x11, 0xc3, 0x88, 0x98, 0xe3, 0x7c, 0xe0, 0x10, 0x0a, 0x18, 0x78, 0xcc,
-  0xc8, 0xc3, 0xbb, 0xc8, 0x11, 0x34, 0x8c, 0x31, 0x42, 0x3b, 0x23, 0x71,
-  0x0d, 0xdc, 0x3c, 0x05, 0x6d, 0xf0, 0xf3, 0x8d, 0xd1, 0xb3, 0x9b, 0xee,
-  0x37, 0x84, 0xea, 0x12, 0x78, 0xc6, 0x6d, 0xf8, 0x23, 0x09, 0x08, 0xf7,
-  0x11, 0x9e, 0xc1, 0xbf, 0x75, 0x84, 0x7b, 0xd4, 0xa3, 0x24, 0x7b, 0x02,
-  0x9c, 0x19, 0x0d, 0xbf, 0x6f, 0x86, 0x25, 0x1b, 0x7e, 0x58, 0x22, 0x36,
-  0xc1, 0x63, 0x32, 0x24, 0x67, 0xcd, 0x9d, 0xa1, 0x31, 0x5e, 0x6a, 0xb7,
-  0x13, 0xfc, 0x2e, 0xe7, 0xb4, 0x94, 0x07, 0x93, 0xed, 0xef, 0x6f, 0x8e,
-  0x16, 0xfb, 0x71, 0xbe, 0xfc, 0xc0, 0xfd, 0x63, 0x2a, 0x25, 0x07, 0x86,
-  0x52, 0x8b, 0x3a, 0x8a, 0x5c, 0x01, 0x72, 0x79, 0x15, 0xef, 0x18, 0x46,
-  0x55, 0x12, 0x18, 0x03, 0xfe, 0x81, 0xdd, 0xf2, 0x45, 0xab, 0x0f, 0xcb,
-  0x80, 0xee, 0x25, 0x7a, 0x66, 0x8a, 0x43, 0x51, 0xc4, 0x0a, 0xb1, 0x2e,
-  0xf1, 0x5c, 0xb4, 0x98, 0x37, 0x8f, 0x68, 0xf0, 0x0e, 0x5b, 0xdb, 0x53,
-  0xd0, 0x53, 0x14, 0x08, 0xe8, 0xab, 0x82, 0x1d, 0xd7, 0xaa, 0xbd, 0xbd,
-  0x21, 0x2c, 0x23, 0x8c, 0x2e, 0xa2, 0x07, 0xd5, 0x7a, 0x40, 0x87, 0xe2,
-  0xb9, 0x0f, 0x06, 0xf7, 0x82, 0xe5, 0xc9, 0x67, 0x5d, 0xa1, 0x87, 0xfd,
-  0x5e, 0x77, 0x6b, 0x79, 0xf4, 0xee, 0xe1, 0xdb, 0x87, 0x3f, 0x86, 0xed,
-  0xf7, 0xf1, 0xe1, 0xdb, 0xc9, 0xd7, 0x13, 0xf8, 0x29, 0x7f, 0xa0, 0x9e,
-  0x8e, 0x5a, 0x4c, 0xc5, 0x44, 0x7e, 0xef, 0x0c, 0xb7, 0x3c, 0xda, 0x2a,
-  0xcb, 0x7f, 0xf9, 0xc7, 0x2f, 0xcc, 0x69, 0x6e, 0x26, 0x45, 0x4d, 0x81,
-  0x33, 0x46, 0x4f, 0xd8, 0x91, 0xde, 0x68, 0x51, 0xe1, 0xca, 0x11, 0xe9,
-  0x48, 0x9b, 0x3f, 0xf8, 0x36, 0x48, 0x48, 0x97, 0x0d, 0x73, 0x88, 0xe9,
-  0xa9, 0xac, 0xe5, 0x98, 0x73, 0x19, 0x29, 0xbd, 0x03, 0x41, 0x5c, 0x7d,
-  0x09, 0x11, 0x28, 0x2b, 0xac, 0xba, 0x42, 0x70, 0x89, 0xad, 0x70, 0xa9,
-  0xd3, 0xa1, 0x2e, 0xf4, 0x56, 0x30, 0x5d, 0xed, 0xf6, 0xb3, 0x1d, 0xea,
-  0xc8, 0xbf, 0x3c, 0x8d, 0xd9, 0x91, 0xf0, 0xb4, 0xcf, 0xe9, 0x8a, 0x8d,
-  0x0a, 0x8e, 0xe6, 0x37, 0xe1, 0xd8, 0xfb, 0x24, 0xdc, 0x15, 0xdb, 0x74,
-  0xf6, 0xd1, 0x71, 0x42, 0x5b, 0x06, 0xae, 0x6c, 0x83, 0x5e, 0xff, 0xb1,
-  0x6c, 0x99, 0xdf, 0xe3, 0x98, 0xe1, 0xd4, 0x84, 0x63, 0xff, 0x31, 0xec,
-  0x13, 0x67, 0x60, 0xc7, 0xdd, 0x27, 0x12, 0xdc, 0x57, 0xb8, 0x51, 0x56,
-  0x09, 0x03, 0xad, 0x0a, 0x38, 0xb9, 0xed, 0x22, 0x3a, 0xf2, 0x74, 0x0f,
-  0x27, 0xb7, 0x69, 0xf2, 0x3b, 0x7c, 0x62, 0xb7, 0xce, 0x6e, 0xd6, 0x7e,
-  0x2c, 0xfb, 0xe6, 0xb7, 0x9e, 0x1a, 0x07, 0x04, 0xc0, 0x5f, 0x8f, 0xde,
-  0x6b, 0x90, 0xaa, 0xe4, 0x23, 0xb8, 0x25, 0x7f, 0x7e, 0xf8, 0x0e, 0x10,
-  0xe6, 0x91, 0x50, 0x17, 0x9c, 0xf8, 0xce, 0xe2, 0xe3, 0x1e, 0x7f, 0x5b,
-  0xc5, 0x86, 0x2f, 0xe9, 0x13, 0x93, 0x4b, 0xe3, 0x4a, 0x94, 0xf8, 0xa6,
-  0xb9, 0x99, 0xb5, 0x4b, 0x6b, 0x41, 0x5c, 0x65, 0xd9, 0xe1, 0x5b, 0x92,
-  0xca, 0xde, 0xa2, 0xb6, 0xf4, 0xaf, 0x16, 0x51, 0x0c, 0x63, 0x88, 0x69,
-  0x20, 0x18, 0xb7, 0xc8, 0xbb, 0x21, 0xe4, 0xad, 0xd7, 0x58, 0x83, 0x72,
-  0x6b, 0xb6, 0xdd, 0x1a, 0xa6, 0xc3, 0x6c, 0x27, 0xf5, 0xd6, 0x6d, 0xf9,
-  0xb5, 0x5b, 0x76, 0xfd, 0x5a, 0x6b, 0xf8, 0x3d, 0xba, 0xa5, 0x3c, 0x40,
-  0x51, 0xe9, 0x43, 0x5a, 0xb6, 0x5f, 0x1c, 0xbe, 0x93, 0xb8, 0x2b, 0x35,
-  0x49, 0x9e, 0x0a, 0x2e, 0x4b, 0xa5, 0x71, 0x42, 0x3a, 0x4b, 0x8f, 0xe0,
-  0x2b, 0x30, 0x8e, 0x5b, 0x30, 0x0e, 0x5b, 0xf3, 0x11, 0xb8, 0x05, 0xe4,
-  0x1b, 0xa1, 0xf2, 0x16, 0xbe, 0x7f, 0xa1, 0xd0, 0x52, 0xb0, 0x43, 0xc4,
-  0xa3, 0x6d, 0x82, 0x82, 0x8d, 0x60, 0x91, 0x91, 0xf7, 0x8c, 0xc3, 0x56,
-  0xbc, 0xd2, 0xef, 0x41, 0xb8, 0xc3, 0xf9, 0x4e, 0xc7, 0x95, 0x1c, 0x65,
-  0x38, 0x42, 0xad, 0x68, 0xf8, 0x64, 0x78, 0xcb, 0x6b, 0x8e, 0x43, 0x97,
-  0x97, 0x6c, 0xf8, 0x4b, 0x34, 0x07, 0x3c, 0xd2, 0xdd, 0xa5, 0xca, 0xac,
-  0x46, 0x48, 0x5e, 0x0d, 0x2d, 0xcf, 0x0d, 0xb2, 0x9b, 0x49, 0xff, 0x0e,
-  0xf5, 0xf9, 0x0f, 0xd0, 0x30, 0xaa, 0x2e, 0xe7, 0xfa, 0xb7, 0x0d, 0xc4,
-  0x81, 0x41, 0x08, 0xf5, 0x84, 0xef, 0xca, 0xab, 0xad, 0xce, 0x1e, 0x34,
-  0x9c, 0xaf, 0xc8, 0xc8, 0xba, 0xb4, 0xbd, 0x7c, 0xfb, 0xd6, 0xe5, 0x67,
-  0xe7, 0x93, 0xda, 0xe8, 0x37, 0xa8, 0x44, 0x04, 0x76, 0x09, 0x17, 0xe4,
-  0xfa, 0x85, 0xd3, 0xa2, 0x7d, 0xf0, 0x63, 0xb8, 0xe3, 0xe3, 0x37, 0x73,
-  0xf0, 0xcd, 0x3f, 0x01, 0x47, 0x80, 0x8b, 0x34, 0x9e, 0x2f, 0xf0, 0xcf,
-  0x47, 0x74, 0xb8, 0x7d, 0x9c, 0xff, 0xf5, 0x19, 0xf1, 0xf5, 0x19, 0xf8,
-  0xfa, 0xf7, 0xd0, 0x1a, 0xf5, 0x19, 0xaf, 0x17, 0xf5, 0x78, 0x56, 0x7c,
-  0x73, 0x16, 0xbe, 0xf9, 0x25, 0xea, 0x7a, 0xf1, 0x02, 0x0f, 0x5f, 0x61,
-  0x9f, 0x1f, 0x1c, 0xbe, 0x05, 0x7f, 0x7d, 0x94, 0xff, 0xfd, 0x73, 0xe2,
-  0xfb, 0xe7, 0xe0, 0xfb, 0xf7, 0x61, 0x27, 0xc1, 0x28, 0xf3, 0xdb, 0x3f,
-  0x2f, 0xda, 0x3f, 0x8f, 0x23, 0x44, 0xec, 0xe0, 0x8b, 0x2f, 0x81, 0x3a,
-  0xef, 0x80, 0x20, 0x56, 0xf8, 0xed, 0x39, 0xf1, 0xed, 0x39, 0xf8, 0xf6,
-  0xd7, 0xf0, 0x2d, 0x30, 0x46, 0x60, 0x92, 0x85, 0x5f, 0x9d, 0x17, 0x5f,
-  0x9d, 0x87, 0xaf, 0xfe, 0xad, 0xec, 0x37, 0xb3, 0x33, 0xe2, 0xa3, 0xd9,
-  0x19, 0xf8, 0xea, 0x5d, 0x98, 0x07, 0xa0, 0x3d, 0xd0, 0xe4, 0x43, 0xa1,
-  0x0c, 0x06, 0xb6, 0x5c, 0xf4, 0xfd, 0xac, 0xfc, 0x7e, 0x96, 0x66, 0xff,
-  0xc1, 0xe8, 0x23, 0x82, 0x00, 0xe2, 0x49, 0xc1, 0x77, 0x72, 0x01, 0xcc,
-  0xaa, 0x15, 0xf0, 0xc5, 0xe1, 0x4f, 0x68, 0x4e, 0x3e, 0xb3, 0xe6, 0x11,
-  0x38, 0x03, 0x2d, 0x31, 0x67, 0x67, 0x44, 0xed, 0x27, 0xad, 0xdd, 0xdd,
-  0xce, 0x7d, 0xc5, 0xa7, 0x5e, 0x08, 0xc9, 0x5a, 0xea, 0x65, 0x4d, 0x5e,
-  0xcc, 0x7d, 0x15, 0x7f, 0x3e, 0x33, 0x0b, 0x98, 0x93, 0x4e, 0x48, 0xd4,
-  0xd9, 0xdb, 0xed, 0xf4, 0x5a, 0xed, 0xc7, 0x21, 0xec, 0xfc, 0x8a, 0x59,
-  0x7e, 0x80, 0xfe, 0xa7, 0xe1, 0xb8, 0x78, 0xdb, 0x7e, 0xf0, 0xe7, 0x80,
-  0x8d, 0x08, 0x5e, 0x9c, 0xb8, 0xd8, 0x63, 0xd3, 0x60, 0xe2, 0x82, 0x4f,
-  0xc1, 0x6a, 0xda, 0xdb, 0x45, 0xde, 0xec, 0x2d, 0xa3, 0x76, 0x6f, 0x63,
-  0x6f, 0x07, 0xd3, 0x52, 0x6c, 0xa5, 0xc3, 0xab, 0x9d, 0x14, 0xff, 0x7c,
-  0xe1, 0xfe, 0x4a, 0xbb, 0x56, 0xdd, 0xcc, 0x3a, 0x82, 0x35, 0x57, 0xeb,
-  0x4d, 0x6a, 0x8b, 0x8b, 0x2c, 0xb9, 0xbc, 0xdd, 0xeb, 0x0d, 0xd2, 0x04,
-  0x5f, 0x3a, 0x8b, 0x2d, 0xde, 0x33, 0xae, 0xd4, 0x40, 0xbf, 0xfb, 0x5d,
-  0x24, 0xc7, 0x35, 0x80, 0x54, 0x5b, 0x13, 0x6a, 0xa1, 0x41, 0xf3, 0xfb,
-  0x83, 0x5e, 0x17, 0x63, 0x9c, 0xc5, 0xe1, 0x24, 0x7f, 0x76, 0x7a, 0x5b,
-  0xcd, 0xe1, 0xbd, 0xe1, 0x9a, 0xd2, 0x3e, 0x61, 0xe7, 0x83, 0xd2, 0xbd,
-  0x73, 0x2b, 0xe4, 0xe4, 0x0d, 0x8e, 0x2f, 0x51, 0x8b, 0xd2, 0xc8, 0x6c,
-  0xee, 0xe1, 0x0d, 0x1f, 0xc6, 0xe7, 0xe1, 0x93, 0x6d, 0x26, 0x35, 0x38,
-  0xa2, 0x36, 0xb3, 0xfe, 0x4e, 0xad, 0x3a, 0x7a, 0x17, 0xcd, 0x55, 0x21,
-  0xfb, 0x2b, 0xb2, 0xf7, 0xd1, 0xc7, 0xc8, 0x0e, 0x13, 0xfc, 0x83, 0x4e,
-  0x1b, 0xbc, 0x14, 0xbf, 0x3d, 0x9d, 0x8c, 0xfe, 0x4c, 0xed, 0xd0, 0x5a,
-  0xf1, 0xf9, 0xe8, 0x8f, 0x42, 0x2a, 0xbd, 0x58, 0xad, 0xd7, 0x93, 0xd7,
-  0x4a, 0x8d, 0x15, 0x51, 0x7b, 0xb9, 0x8f, 0xb8, 0xc5, 0xc7, 0x7b, 0x50,
-  0x59, 0xbe, 0x06, 0xcd, 0x12, 0x6a, 0xe6, 0xc9, 0xb5, 0xfc, 0x88, 0xc7,
-  0x39, 0x92, 0x43, 0x56, 0xeb, 0x28, 0xe2, 0xd3, 0xc4, 0xfc, 0x4e, 0xc4,
-  0x06, 0xa1, 0x15, 0x01, 0x52, 0xf7, 0x69, 0xdb, 0x5e, 0xa5, 0x60, 0x09,
-  0x2f, 0x1c, 0xfb, 0x46, 0xcc, 0x5c, 0xe5, 0x8c, 0x3c, 0xc7, 0x99, 0x47,
-  0xfc, 0x02, 0xad, 0xf8, 0x86, 0xe9, 0x44, 0x60, 0xb1, 0xaa, 0xcd, 0xba,
-  0x04, 0x4d, 0x33, 0x87, 0x10, 0x57, 0x78, 0x3c, 0xb7, 0x45, 0x72, 0x98,
-  0x7d, 0x0c, 0x0c, 0xf4, 0x7d, 0xb4, 0x95, 0x3e, 0xa4, 0x13, 0xf3, 0x13,
-  0xbc, 0x2b, 0x9f, 0x38, 0x5f, 0xe4, 0x03, 0x3b, 0x19, 0xae, 0xc8, 0xb4,
-  0x30, 0xf7, 0x07, 0x2b, 0xf0, 0x42, 0xce, 0xae, 0x02, 0xaa, 0x89, 0x10,
-  0x8b, 0x09, 0x75, 0x12, 0x51, 0xed, 0xf4, 0xba, 0x3d, 0x8a, 0xda, 0xc9,
-  0x73, 0x9a, 0x7f, 0x7a, 0xf3, 0xdc, 0xe6, 0xf9, 0xcd, 0x96, 0xef, 0x59,
-  0xce, 0xe3, 0x15, 0xd3, 0x74, 0x2e, 0x7d, 0x2e, 0xea, 0x1b, 0x6f, 0x61,
-  0x10, 0x8c, 0x0a, 0xc6, 0xf4, 0x3f, 0xdd, 0xb4, 0xa1, 0x42, 0x2a, 0x66,
-  0x9b, 0x0c, 0x18, 0x85, 0x44, 0x34, 0x08, 0xcf, 0x85, 0x64, 0xb7, 0x9f,
-  0x36, 0xf6, 0xfb, 0xad, 0x5d, 0xf6, 0x1a, 0xfa, 0xa2, 0x47, 0x20, 0xf3,
-  0xf7, 0xd3, 0xd6, 0x2b, 0x0d, 0x7c, 0xa0, 0x5e, 0x57, 0xbe, 0xc2, 0x85,
-  0x4e, 0x1c, 0x89, 0xad, 0x74, 0x9a, 0x38, 0xf1, 0xd0, 0x36, 0x99, 0x9f,
-  0x84, 0x86, 0x11, 0x2e, 0xf5, 0x87, 0x6f, 0xa3, 0xa3, 0x00, 0x1a, 0x7a,
-  0x4f, 0x78, 0xe1, 0x5b, 0x03, 0x3d, 0xc9, 0x95, 0x5f, 0xa8, 0x3f, 0xb4,
-  0xdb, 0x39, 0x36, 0xeb, 0x82, 0x80, 0xb5, 0x60, 0x6c, 0x9d, 0x77, 0xd9,
-  0x0f, 0xb9, 0x40, 0xd9, 0xcf, 0x72, 0xad, 0xb1, 0xc2, 0x87, 0xa1, 0x01,
-  0xa2, 0x00, 0x74, 0xb5, 0xc5, 0x0f, 0x8d, 0x98, 0xab, 0x93, 0x0b, 0x1c,
-  0x2e, 0x04, 0x9f, 0x10, 0x53, 0x83, 0x43, 0xf4, 0x73, 0x98, 0xe6, 0x8f,
-  0x46, 0x0f, 0x6d, 0x94, 0x7c, 0x17, 0x36, 0x47, 0x74, 0x0e, 0x0e, 0x44,
-  0x1e, 0xf5, 0x4a, 0xce, 0x41, 0x0c, 0x07, 0x8d, 0xf5, 0x21, 0x4c, 0x67,
-  0x8e, 0x8e, 0xf4, 0xdb, 0xd0, 0xe8, 0x56, 0x8f, 0x0e, 0xba, 0xe1, 0x76,
-  0x36, 0xf0, 0xfc, 0xb2, 0x58, 0xfe, 0xb4, 0xb0, 0x63, 0x96, 0x1c, 0x40,
-  0x48, 0xde, 0xb7, 0x71, 0xda, 0xe8, 0xa4, 0xad, 0x7e, 0x31, 0x52, 0xd4,
-  0x0c, 0xb1, 0x22, 0xf7, 0xa1, 0xf7, 0xe1, 0xfa, 0x22, 0x0e, 0x80, 0xe2,
-  0xee, 0xca, 0xe8, 0x4a, 0xf4, 0x5a, 0x77, 0x0e, 0xd5, 0x5c, 0x1d, 0x09,
-  0xe0, 0xcc, 0xd4, 0x61, 0x9a, 0x3e, 0xf7, 0x34, 0xaf, 0x13, 0x46, 0x63,
-  0x9d, 0x44, 0xac, 0x01, 0xeb, 0x95, 0xb2, 0xfc, 0x45, 0xe3, 0xa5, 0x73,
-  0xff, 0x2f, 0xc0, 0x9c, 0x31, 0x3e, 0xce, 0x09, 0xb2, 0x4e, 0xf2, 0x15,
-  0x31, 0x0c, 0x6f, 0x32, 0x62, 0xba, 0xd4, 0x50, 0x6d, 0xba, 0x3d, 0x31,
-  0x25, 0x32, 0x2e, 0x39, 0x66, 0xbc, 0x0f, 0xa4, 0x8f, 0xd0, 0xe1, 0x56,
-  0xe7, 0xce, 0x9d, 0x5b, 0x74, 0xf2, 0x1c, 0x59, 0x4b, 0x7e, 0xf4, 0x3f,
-  0xc5, 0x9c, 0x25, 0xb0, 0x78, 0xe0, 0xea, 0x2c, 0x2e, 0xd0, 0x30, 0xa3,
-  0x1f, 0xc2, 0x5f, 0x3f, 0x3f, 0x7c, 0xb3, 0xec, 0x7d, 0xd0, 0xe7, 0xf9,
-  0xbe, 0x4d, 0x97, 0xb9, 0xc0, 0x17, 0xd8, 0x72, 0xb5, 0x77, 0x3c, 0xd9,
-  0x70, 0x4f, 0x58, 0x53, 0xb9, 0xd3, 0xea, 0xee, 0xb5, 0x3a, 0x0d, 0x85,
-  0xdd, 0x63, 0xd6, 0x57, 0xfe, 0x33, 0xd0, 0xf9, 0x27, 0xa8, 0x24, 0x41,
-  0xdf, 0xb3, 0xb7, 0x48, 0x36, 0x47, 0x5d, 0xb1, 0xf4, 0x22, 0x42, 0xe1,
-  0xfe, 0x43, 0x65, 0x00, 0x26, 0xa5, 0xcf, 0x43, 0x5f, 0x97, 0xf9, 0x18,
-  0x14, 0x91, 0x61, 0x1a, 0x9d, 0xb0, 0x3a, 0xf2, 0xc2, 0x2e, 0xde, 0xd2,
-  0x3f, 0x26, 0x76, 0xfc, 0x33, 0x79, 0xa3, 0x41, 0xe7, 0x3c, 0x0c, 0x20,
-  0xf8, 0x52, 0x68, 0xb2, 0x0e, 0x7f, 0x04, 0x74, 0xfa, 0xf4, 0xf0, 0x8d,
-  0x04, 0xde, 0x7c, 0x7e, 0xf8, 0x4e, 0x82, 0xb7, 0x74, 0x49, 0xce, 0x8f,
-  0x46, 0x8f, 0x02, 0x04, 0x85, 0x36, 0x2e, 0x41, 0x9b, 0x17, 0x4e, 0xef,
-  0x7e, 0xe5, 0x7a, 0x0f, 0xd4, 0x48, 0x3e, 0x1e, 0xe3, 0xe8, 0x1f, 0x60,
-  0xd4, 0x9f, 0xa2, 0xbc, 0x3e, 0x86, 0x71, 0x34, 0x00, 0xdf, 0xce, 0xbc,
-  0xc3, 0xec, 0x29, 0x47, 0x0e, 0x2f, 0x10, 0x24, 0xb8, 0x3d, 0x50, 0x3a,
-  0x67, 0xfb, 0xc6, 0x87, 0x4a, 0x09, 0x41, 0xb3, 0x9b, 0xfd, 0xde, 0x6e,
-  0xda, 0x1f, 0xde, 0x87, 0x9b, 0xce, 0xe0, 0x16, 0x7d, 0x73, 0x55, 0x38,
-  0x2e, 0x56, 0xa7, 0x13, 0x3c, 0x25, 0x9b, 0xd2, 0xa9, 0x7a, 0xac, 0x80,
-  0x04, 0xef, 0x5c, 0x1f, 0x63, 0xd3, 0xb8, 0x2c, 0x90, 0xed, 0x1b, 0x7b,
-  0x5a, 0xbf, 0x02, 0x1b, 0xd6, 0x18, 0x46, 0x2c, 0xa2, 0x65, 0x79, 0x67,
-  0xde, 0x37, 0xcd, 0x3a, 0x0a, 0x78, 0x0c, 0x5b, 0xab, 0xc0, 0x71, 0x79,
-  0xb4, 0xf6, 0x78, 0x9e, 0x28, 0xb7, 0x71, 0x7f, 0xa3, 0x23, 0x35, 0x97,
-  0xe8, 0xd7, 0x54, 0x62, 0x3d, 0x5c, 0xb5, 0xbf, 0xc9, 0x59, 0x11, 0x70,
-  0xf2, 0xfd, 0x4a, 0x7a, 0x04, 0x7e, 0x86, 0x9a, 0x78, 0x6f, 0x50, 0x87,
-  0x6f, 0x4f, 0x45, 0x44, 0xbe, 0x88, 0x61, 0x4e, 0xcc, 0xf5, 0x24, 0x4c,
-  0x73, 0x27, 0xe5, 0x81, 0x01, 0x64, 0x68, 0xef, 0x75, 0xd2, 0xc7, 0xc2,
-  0x66, 0xfe, 0x99, 0x94, 0xff, 0x7f, 0x46, 0xf9, 0x50, 0x0a, 0xa4, 0xef,
-  0x3c, 0x49, 0xcc, 0x46, 0xd3, 0x62, 0x3c, 0x7e, 0xb3, 0x2a, 0x3f, 0x7b,
-  0x72, 0x39, 0x8e, 0x37, 0xc9, 0x4f, 0xb4, 0xe1, 0x5c, 0xd1, 0xb3, 0x3c,
-  0xdb, 0x79, 0xdd, 0x5d, 0x57, 0xa8, 0x78, 0x8a, 0x05, 0x2c, 0x44, 0x3a,
-  0x16, 0x09, 0x60, 0xd1, 0x1f, 0x44, 0x11, 0x8b, 0xf5, 0x2f, 0x5e, 0x56,
-  0xd0, 0xa9, 0x5b, 0xa8, 0x4d, 0xe5, 0xdd, 0xe6, 0x43, 0x54, 0xb5, 0x96,
-  0xb4, 0xd1, 0xeb, 0x49, 0x78, 0x82, 0xb9, 0x01, 0xe6, 0x97, 0x4a, 0xfb,
-  0x70, 0xcf, 0xea, 0xa7, 0x8f, 0x47, 0xec, 0x40, 0x25, 0xa1, 0x30, 0xa9,
-  0x60, 0x98, 0x09, 0x1a, 0x1f, 0xd1, 0x0d, 0xfb, 0xd3, 0x04, 0xf8, 0xef,
-  0x23, 0x94, 0xe7, 0x48, 0x2b, 0xfd, 0x39, 0xfa, 0xda, 0xb8, 0x02, 0xae,
-  0xb9, 0x1d, 0x22, 0xd2, 0x72, 0x7c, 0x0d, 0x32, 0xaa, 0x45, 0x34, 0xbc,
-  0x14, 0x6b, 0xed, 0x45, 0xfd, 0xeb, 0x4b, 0xd1, 0xd9, 0xb3, 0x67, 0x61,
-  0xa1, 0x37, 0x4e, 0x37, 0x92, 0x7f, 0x7f, 0x70, 0x39, 0x2a, 0xff, 0x3e,
-  0x7e, 0x09, 0xc8, 0x4c, 0xc9, 0x38, 0x6c, 0x89, 0x7d, 0xd6, 0xcc, 0x18,
-  0x43, 0x7b, 0x12, 0xe5, 0x21, 0x7f, 0xd1, 0x1d, 0xc7, 0x5f, 0xae, 0x94,
-  0x2a, 0x97, 0xf5, 0x19, 0xdf, 0x8e, 0x14, 0xa2, 0xb2, 0x9c, 0x17, 0x48,
-  0x78, 0x22, 0x0e, 0x77, 0xc2, 0x85, 0x5a, 0xe3, 0xf7, 0x18, 0x5c, 0xe1,
-  0x3a, 0xbd, 0x41, 0x99, 0x1e, 0x9f, 0x70, 0x37, 0x52, 0xbd, 0xf9, 0x1e,
-  0x03, 0xe7, 0x7a, 0x4f, 0x5c, 0x31, 0x51, 0x27, 0x22, 0xee, 0x8f, 0x5f,
-  0x8e, 0x1e, 0x50, 0x98, 0xd8, 0xd8, 0x3e, 0xa6, 0x8f, 0x85, 0x89, 0x08,
-  0x88, 0x52, 0x40, 0x29, 0x23, 0xd3, 0x5c, 0xe2, 0x1f, 0x3c, 0x89, 0x12,
-  0x4d, 0x70, 0xc6, 0x9f, 0x6c, 0xb1, 0x86, 0x50, 0x16, 0x84, 0x2d, 0xef,
-  0x18, 0xf8, 0x31, 0x5f, 0x68, 0xe5, 0x65, 0x0d, 0xd6, 0xd7, 0x24, 0xe4,
-  0x0d, 0x6b, 0x4b, 0x8b, 0xdc, 0x3d, 0xf2, 0x03, 0x90, 0x8b, 0x12, 0xe9,
-  0x15, 0x87, 0x81, 0x29, 0x2b, 0x98, 0x50, 0x29, 0x59, 0x4a, 0x1a, 0xb3,
-  0x8b, 0xfa, 0x35, 0x05, 0xb2, 0xca, 0xb8, 0xd0, 0x01, 0xbc, 0xbb, 0x73,
-  0xd7, 0xbc, 0xeb, 0xa6, 0xfb, 0x9d, 0xfb, 0x97, 0xda, 0xed, 0xb4, 0xbd,
-  0x3a, 0xc8, 0xda, 0xf0, 0xb2, 0xbb, 0xd7, 0xe9, 0xb0, 0x4f, 0xb7, 0x7b,
-  0x7b, 0x9d, 0x36, 0xc6, 0x35, 0xaf, 0x92, 0xf7, 0x8b, 0x09, 0x30, 0x85,
-  0xa6, 0x14, 0x1e, 0xbd, 0xe8, 0x62, 0xa1, 0x98, 0x17, 0x34, 0x78, 0xed,
-  0xc0, 0xbc, 0x4d, 0xdb, 0x19, 0x3e, 0x36, 0x5f, 0xdb, 0x1d, 0xa9, 0xb8,
-  0x98, 0xdb, 0x54, 0x1d, 0x43, 0xe0, 0x38, 0x45, 0x18, 0x90, 0xf9, 0x5b,
-  0xb7, 0xc7, 0x47, 0x3a, 0xe2, 0xfa, 0xd2, 0x10, 0x8f, 0x91, 0x21, 0xb6,
-  0x9f, 0x59, 0x9c, 0x82, 0x87, 0x83, 0x21, 0x7a, 0x8b, 0xbd, 0x14, 0x78,
-  0x3f, 0xab, 0x1b, 0xac, 0xb7, 0x06, 0xa9, 0x6e, 0x71, 0x05, 0x1d, 0xf6,
-  0xe9, 0x35, 0xe6, 0xdd, 0x47, 0xe0, 0xd9, 0xe0, 0x45, 0x52, 0xab, 0x75,
-  0xee, 0x5f, 0x46, 0xae, 0xdc, 0x36, 0xe3, 0xb4, 0xba, 0xc6, 0xab, 0x2c,
-  0x26, 0xcc, 0xe1, 0x78, 0xed, 0xb7, 0x06, 0x57, 0xd1, 0xde, 0x2e, 0x5a,
-  0xf0, 0x4f, 0xa7, 0x36, 0xf7, 0xba, 0xb4, 0x16, 0xa8, 0xbe, 0xce, 0x77,
-  0xd3, 0xf5, 0x55, 0x1a, 0x55, 0xad, 0x2e, 0xf3, 0xdc, 0xa0, 0xff, 0x80,
-  0xdb, 0x71, 0x1d, 0x3a, 0x83, 0xc3, 0xa0, 0x2b, 0x53, 0x15, 0x61, 0x13,
-  0xb7, 0xf7, 0x3a, 0xcb, 0x2f, 0x45, 0x46, 0x00, 0xf9, 0xdc, 0x6f, 0x68,
-  0xb4, 0xe8, 0xd1, 0x11, 0xb0, 0x6c, 0x56, 0xd8, 0x97, 0xa4, 0xfb, 0xd7,
-  0xbf, 0xae, 0xfe, 0x6c, 0xf6, 0x81, 0x1b, 0xde, 0x47, 0x23, 0x40, 0x9a,
-  0x2c, 0x2d, 0x2d, 0x25, 0x7a, 0x14, 0xcd, 0x1b, 0x37, 0xaf, 0x5e, 0x4f,
-  0x7e, 0xf8, 0xc3, 0xa4, 0xa8, 0xdd, 0xe5, 0x1b, 0xd7, 0xaf, 0x5f, 0xbd,
-  0x7c, 0x6b, 0xe5, 0xfa, 0x37, 0xea, 0x16, 0xe6, 0x30, 0x2d, 0xbd, 0x4e,
-  0x8a, 0x29, 0x91, 0x6a, 0x55, 0xdd, 0x3a, 0x69, 0x75, 0x08, 0x50, 0xb2,
-  0xa1, 0xc9, 0xd9, 0xeb, 0xab, 0x1f, 0xb0, 0x90, 0x92, 0x46, 0x32, 0x78,
-  0x25, 0xdb, 0xdd, 0x45, 0x91, 0xca, 0x1a, 0x9e, 0xa0, 0x59, 0x70, 0x34,
-  0x75, 0x95, 0x57, 0x0a, 0xff, 0x4f, 0x62, 0xdb, 0xeb, 0x52, 0xa6, 0x05,
-  0x4e, 0x05, 0xeb, 0x2d, 0x9d, 0xcd, 0xf1, 0xd7, 0x22, 0xcd, 0x57, 0xf4,
-  0xb5, 0xca, 0x5d, 0xaa, 0x1a, 0xb8, 0x2d, 0x08, 0x7a, 0x0d, 0x57, 0xdf,
-  0x74, 0x52, 0x79, 0x29, 0xc5, 0xd5, 0x61, 0x08, 0x56, 0xa9, 0x5b, 0xe3,
-  0x10, 0xcb, 0x77, 0x7f, 0x70, 0xbb, 0xdf, 0x01, 0x78, 0x6b, 0xfb, 0x83,
-  0x85, 0xd3, 0xa7, 0x9f, 0x79, 0x6d, 0x3f, 0xeb, 0xb6, 0x7b, 0xfb, 0x40,
-  0xbc, 0x0d, 0xca, 0xef, 0xd4, 0xdc, 0xee, 0x0d, 0x86, 0xe8, 0x4f, 0x79,
-  0xb0, 0x70, 0x6e, 0xf6, 0xf4, 0x9a, 0x4e, 0xe2, 0x67, 0x28, 0x7c, 0xd9,
-  0x90, 0x70, 0xd8, 0x5b, 0x80, 0xa3, 0x85, 0x20, 0xd6, 0x25, 0x6e, 0x43,
-  0x56, 0x45, 0x23, 0x61, 0x9b, 0x2f, 0xdd, 0x37, 0x78, 0xd5, 0xac, 0x2f,
-  0x42, 0xb4, 0x84, 0xc3, 0xad, 0xdd, 0x49, 0x45, 0xeb, 0x1b, 0xbb, 0x26,
-  0x4d, 0x6f, 0x90, 0x32, 0xbc, 0xf1, 0x8b, 0xe2, 0x69, 0xce, 0x3c, 0xf0,
-  0xd6, 0xb4, 0x51, 0x72, 0x26, 0x85, 0xb7, 0xbd, 0x8a, 0xcf, 0x24, 0xca,
-  0x07, 0x09, 0x10, 0x6b, 0x63, 0x3b, 0xa9, 0x51, 0x43, 0xb5, 0x16, 0x9f,
-  0x42, 0x6e, 0xb7, 0x2f, 0x53, 0xfb, 0xd4, 0xaa, 0x64, 0x4e, 0xfe, 0x84,
-  0x7c, 0x10, 0xbf, 0xd4, 0x7a, 0xff, 0xc3, 0x37, 0x12, 0xb8, 0x24, 0x69,
-  0xaf, 0x1e, 0x79, 0x2e, 0x3c, 0x1a, 0x7d, 0x91, 0xc0, 0x2d, 0xea, 0x91,
-  0x54, 0x7f, 0xbf, 0x83, 0xaa, 0x6e, 0x3c, 0xb3, 0xfb, 0x7b, 0xe9, 0x34,
-  0xb0, 0x16, 0x2b, 0xdf, 0x9e, 0x98, 0x09, 0xea, 0x98, 0xaf, 0xf6, 0x0d,
-  0x58, 0xec, 0xc4, 0x20, 0xe8, 0x0d, 0x4e, 0x8b, 0xc0, 0x8d, 0x8d, 0x4e,
-  0x5e, 0x5f, 0x35, 0xef, 0xaa, 0xe9, 0xe5, 0x71, 0xc0, 0x18, 0x4c, 0x80,
-  0x9a, 0xd2, 0x70, 0x53, 0x03, 0x49, 0xa3, 0x55, 0xd7, 0x19, 0x0d, 0xf9,
-  0x3c, 0xe3, 0x16, 0xc1, 0xb7, 0x4d, 0x3c, 0x3d, 0xf9, 0xde, 0xa4, 0x8e,
-  0x45, 0xc2, 0x4c, 0xbb, 0x81, 0x19, 0x11, 0xb0, 0x53, 0xf4, 0xb5, 0xc2,
-  0x38, 0xb2, 0x97, 0x85, 0x34, 0x53, 0x5d, 0xb0, 0xbe, 0xe7, 0xab, 0xaf,
-  0x32, 0xfa, 0x1d, 0x7a, 0xba, 0x1e, 0xfe, 0x14, 0xad, 0x92, 0xc9, 0x72,
-  0x62, 0x7d, 0x57, 0xa9, 0xdb, 0xc6, 0x3e, 0xf1, 0xf4, 0xf6, 0xca, 0x4b,
-  0x70, 0x36, 0x08, 0xe4, 0xed, 0xf7, 0xe4, 0xf8, 0xb0, 0xe8, 0xa2, 0x22,
-  0x34, 0x7e, 0xe3, 0xa3, 0x62, 0x7d, 0xe7, 0xa2, 0xa2, 0x71, 0x11, 0x2a,
-  0xcc, 0xf2, 0xd8, 0x08, 0xdf, 0xb8, 0x97, 0x37, 0x3b, 0xad, 0xad, 0x23,
-  0xe0, 0x14, 0xf8, 0x3a, 0x4c, 0x24, 0x21, 0x40, 0x5e, 0xc3, 0x76, 0xe5,
-  0x71, 0x13, 0x42, 0xca, 0xcb, 0x74, 0x65, 0x3f, 0x02, 0x72, 0xa1, 0xcf,
-  0xa3, 0x74, 0x93, 0x41, 0x3e, 0x64, 0x42, 0x2e, 0x83, 0x61, 0x3b, 0xdd,
-  0x6c, 0xed, 0x75, 0x86, 0x71, 0x6c, 0xaa, 0xb7, 0xbb, 0xaf, 0x74, 0x7b,
-  0xfb, 0xdd, 0x44, 0x31, 0x12, 0x5c, 0x99, 0xb8, 0x6f, 0xcc, 0x32, 0xa5,
-  0x1e, 0x9e, 0x7a, 0xea, 0x29, 0x99, 0x57, 0xce, 0x64, 0x98, 0x13, 0xff,
-  0x0e, 0xf1, 0x00, 0x7f, 0x8f, 0x56, 0x88, 0x71, 0x24, 0xbb, 0xad, 0xfe,
-  0x00, 0x59, 0xa6, 0xea, 0x2d, 0xeb, 0x26, 0x72, 0x5b, 0xc9, 0x1d, 0xd7,
-  0x5f, 0xa8, 0xc8, 0x3d, 0xeb, 0xa1, 0x50, 0xbc, 0x43, 0xe5, 0x45, 0x2f,
-  0xb8, 0x37, 0x05, 0xdb, 0x47, 0x90, 0xc0, 0xd1, 0xc8, 0x01, 0x10, 0x71,
-  0x91, 0x9f, 0x34, 0x1d, 0x52, 0x5a, 0xf3, 0x05, 0x9c, 0x22, 0xcd, 0x40,
-  0xf4, 0x43, 0xcc, 0x64, 0x3b, 0x46, 0xce, 0x22, 0x81, 0x62, 0x1c, 0xa1,
-  0xa2, 0x50, 0xb0, 0x30, 0x54, 0xb7, 0x9a, 0xda, 0x02, 0x9c, 0xe4, 0xc2,
-  0x5b, 0xe9, 0x10, 0xed, 0xeb, 0x35, 0x17, 0x65, 0x8f, 0x49, 0x79, 0x9e,
-  0x01, 0x45, 0xbc, 0x6f, 0x71, 0xca, 0xc1, 0xd8, 0xc8, 0x0a, 0x56, 0x2e,
-  0x4f, 0xc5, 0xf3, 0x44, 0x77, 0x7a, 0x6e, 0xa6, 0xac, 0xdd, 0xa3, 0xf2,
-  0x8d, 0xc8, 0x1d, 0xe3, 0x0a, 0xd9, 0xf4, 0xa9, 0x6a, 0x83, 0xd2, 0x91,
-  0x92, 0xba, 0xc5, 0x8e, 0x90, 0x2d, 0x31, 0xa0, 0xb0, 0x66, 0x7d, 0xaa,
-  0x90, 0x7c, 0xea, 0x29, 0x31, 0xf1, 0x70, 0x15, 0xdc, 0xc5, 0x54, 0x5e,
-  0x08, 0x32, 0xe6, 0xed, 0x4b, 0x39, 0xc0, 0xd0, 0xd3, 0x57, 0xdc, 0x0f,
-  0xed, 0x79, 0x11, 0xb2, 0xa5, 0x00, 0xe2, 0xce, 0x6f, 0x60, 0x8b, 0x4b,
-  0xf7, 0xea, 0xcf, 0x46, 0x9f, 0x1f, 0xfe, 0xfc, 0xf0, 0x27, 0xe6, 0xe0,
-  0xc3, 0x87, 0x7f, 0x84, 0x3f, 0xbf, 0xa0, 0x7b, 0x76, 0x72, 0xe9, 0xa6,
-  0xb8, 0x72, 0xaf, 0xde, 0xba, 0xa4, 0xcc, 0xbc, 0x64, 0xe0, 0xc5, 0xc3,
-  0xf0, 0x53, 0x9d, 0xaf, 0xa5, 0xe9, 0xf1, 0x03, 0xdc, 0xda, 0x25, 0x87,
-  0xa1, 0x88, 0x08, 0xc8, 0xdf, 0x44, 0x02, 0xb2, 0xeb, 0x06, 0xff, 0x3f,
-  0x3b, 0xdf, 0x99, 0xfd, 0x9e, 0x49, 0x80, 0xf6, 0x45, 0xa7, 0xee, 0x6d,
-  0xb0, 0xae, 0xbe, 0xd9, 0x48, 0x9c, 0x38, 0xc1, 0xff, 0x6e, 0x2f, 0xed,
-  0xdf, 0x17, 0x37, 0x20, 0x60, 0x09, 0x6b, 0x77, 0x10, 0x2f, 0x4a, 0x3a,
-  0xb6, 0x54, 0x79, 0xe6, 0xb5, 0xcb, 0xab, 0xab, 0xcd, 0x74, 0xb0, 0xd1,
-  0xda, 0x4d, 0xdd, 0x4e, 0x0e, 0x2a, 0x77, 0xd7, 0x18, 0x46, 0x12, 0x0d,
-  0xbb, 0x1b, 0x6f, 0xcb, 0x89, 0xed, 0x2e, 0x8b, 0x8a, 0x2c, 0xf9, 0x78,
-  0x39, 0xc8, 0x54, 0xdd, 0x42, 0x24, 0x55, 0x87, 0x06, 0x02, 0xa0, 0xa8,
-  0x97, 0x32, 0x0e, 0x38, 0xfa, 0xc2, 0x05, 0x46, 0x7b, 0x50, 0xe2, 0x06,
-  0x57, 0x03, 0x6a, 0x13, 0x5a, 0x54, 0xb2, 0x4d, 0x93, 0xae, 0xfd, 0x4d,
-  0x79, 0xeb, 0x87, 0xee, 0xab, 0x14, 0xa0, 0x54, 0xf5, 0x67, 0x91, 0x20,
-  0x35, 0xd1, 0x67, 0x46, 0xfa, 0xdf, 0x60, 0xe3, 0xbf, 0xfc, 0xe3, 0x87,
-  0x55, 0x77, 0x42, 0xfd, 0xbf, 0x72, 0xae, 0xb0, 0x6c, 0xfe, 0xed, 0xfb,
-  0x67, 0x68, 0xfe, 0x8f, 0x3b, 0xf9, 0x4e, 0x0f, 0xc1, 0xc9, 0x1f, 0x6f,
-  0xe6, 0x27, 0x39, 0xed, 0xff, 0x71, 0xe6, 0x5c, 0x4e, 0xaa, 0x2b, 0x31,
-  0x30, 0xb9, 0x66, 0xe8, 0x0b, 0x32, 0x86, 0xf3, 0x5a, 0xee, 0x86, 0x01,
-  0x49, 0x24, 0x1f, 0xb6, 0x0c, 0x2a, 0x58, 0x98, 0x9a, 0x7a, 0x0a, 0xff,
-  0x2f, 0xb1, 0xee, 0x0c, 0x95, 0x60, 0x06, 0xb3, 0xcf, 0x46, 0x0f, 0x9a,
-  0xcd, 0x20, 0x27, 0x8c, 0x77, 0xa3, 0xd4, 0x21, 0xd1, 0x51, 0x78, 0x29,
-  0x3e, 0xc6, 0x1e, 0x89, 0xea, 0x42, 0xc8, 0x64, 0x38, 0x22, 0xef, 0xa0,
-  0x95, 0xf9, 0xb0, 0xbd, 0x0b, 0x81, 0x75, 0x4d, 0xf2, 0xe3, 0x93, 0x65,
-  0x42, 0x9a, 0x4f, 0x64, 0x04, 0xdd, 0x17, 0x09, 0x69, 0x64, 0x59, 0xae,
-  0xb6, 0xc3, 0xb7, 0xf9, 0x1a, 0x3b, 0x48, 0x52, 0x60, 0xec, 0x56, 0x1f,
-  0x76, 0x0f, 0x26, 0x99, 0xd1, 0x03, 0x0f, 0x94, 0x56, 0xfe, 0x6a, 0x1c,
-  0xe0, 0xec, 0xf2, 0x30, 0x90, 0x97, 0xb1, 0x7a, 0x48, 0x18, 0xc9, 0x59,
-  0x47, 0x1b, 0xad, 0x2e, 0x06, 0x55, 0x80, 0x1c, 0x3a, 0x88, 0x4e, 0xc4,
-  0x25, 0x95, 0x80, 0x4c, 0x1d, 0xe0, 0x35, 0xeb, 0xe4, 0x1f, 0xe7, 0xfc,
-  0x63, 0xf9, 0xd5, 0xe0, 0x14, 0xb4, 0xf7, 0xc5, 0xda, 0x35, 0xf4, 0x4e,
-  0x4f, 0x9e, 0x79, 0xcd, 0x82, 0xde, 0xec, 0xa4, 0xdd, 0xad, 0xe1, 0xf6,
-  0x81, 0xda, 0xdf, 0x83, 0xb5, 0x23, 0x77, 0x47, 0x9a, 0x49, 0x0c, 0xcf,
-  0x80, 0xce, 0xac, 0xac, 0x6e, 0xe3, 0xac, 0x29, 0x15, 0xfb, 0xa3, 0xd7,
-  0x54, 0x69, 0x64, 0x58, 0x72, 0x3e, 0x6f, 0xec, 0x34, 0xe4, 0x1d, 0x57,
-  0x33, 0x30, 0x26, 0x48, 0x3e, 0x3e, 0xbe, 0xb8, 0x93, 0x8b, 0x7a, 0xb8,
-  0xf2, 0x49, 0x25, 0x59, 0xd0, 0x8f, 0x48, 0xa0, 0x0f, 0x90, 0xa0, 0x68,
-  0x8b, 0xb8, 0x8b, 0xb8, 0x12, 0xd8, 0x26, 0xdf, 0x5d, 0xb9, 0xb6, 0x42,
-  0xda, 0x04, 0x32, 0xc0, 0xfe, 0x14, 0xc5, 0xa7, 0xc0, 0x4e, 0x69, 0xa2,
-  0x4e, 0x9a, 0xc4, 0xab, 0x3f, 0x53, 0x8c, 0xa8, 0xb0, 0xf9, 0xa8, 0x95,
-  0x4f, 0x00, 0x3f, 0x21, 0x2f, 0xbc, 0x4f, 0xc8, 0x47, 0x14, 0xdb, 0x85,
-  0x79, 0x50, 0x88, 0x01, 0x05, 0xb6, 0x5e, 0x08, 0xf7, 0xa2, 0x0d, 0x58,
-  0xf1, 0xb6, 0x97, 0xbf, 0xcd, 0xca, 0x30, 0xa4, 0xc1, 0xf0, 0x65, 0x8a,
-  0x5b, 0x4a, 0xdb, 0x93, 0x5a, 0x3a, 0x6b, 0xb7, 0x00, 0x28, 0xde, 0xdb,
-  0x94, 0xe2, 0x10, 0x2d, 0x04, 0xbd, 0x05, 0xb5, 0x8f, 0xf0, 0x14, 0x3f,
-  0x58, 0x9b, 0xc8, 0x9a, 0x3a, 0xf2, 0x9e, 0xa1, 0x61, 0x0b, 0x2e, 0xc3,
-  0x99, 0xf0, 0x38, 0x2b, 0xed, 0xe8, 0xe4, 0xb9, 0xcc, 0xc9, 0x62, 0x51,
-  0x45, 0xed, 0x86, 0xcd, 0xbd, 0xce, 0xa9, 0x64, 0xe5, 0xa6, 0x26, 0x59,
-  0xb6, 0x1b, 0x22, 0xd8, 0x31, 0x89, 0xa6, 0x76, 0xde, 0xe2, 0x54, 0x10,
-  0xb2, 0x90, 0x65, 0x44, 0xdb, 0x15, 0x94, 0xf0, 0xd6, 0x90, 0x68, 0x12,
-  0x64, 0x83, 0x61, 0xdd, 0xec, 0xa7, 0x94, 0x27, 0xac, 0x76, 0xfa, 0xce,
-  0xff, 0xd1, 0x6a, 0xfc, 0xe0, 0x52, 0xe3, 0xbf, 0xce, 0x34, 0xce, 0xdf,
-  0x3d, 0xbd, 0x35, 0x9d, 0x54, 0x1b, 0xd5, 0x7a, 0x0c, 0x71, 0x0e, 0x3e,
-  0x20, 0xff, 0x39, 0xc3, 0x51, 0x68, 0xd4, 0xc3, 0xc0, 0x48, 0xdb, 0xcc,
-  0x41, 0xc5, 0x26, 0x8c, 0xb6, 0x19, 0x6f, 0xe8, 0xcc, 0x4d, 0xe5, 0x2f,
-  0xbf, 0xf9, 0x1f, 0x89, 0xb6, 0x25, 0x54, 0x16, 0x4b, 0x02, 0x11, 0xd2,
-  0x17, 0xf9, 0x54, 0x20, 0x10, 0xaa, 0x92, 0x16, 0xf9, 0xf8, 0xa0, 0x3c,
-  0x3f, 0x38, 0x91, 0x15, 0xb6, 0x09, 0x27, 0x67, 0xda, 0xd6, 0x2b, 0x8b,
-  0x78, 0xed, 0x09, 0x2c, 0x2e, 0xc5, 0xc3, 0xff, 0xb6, 0xb4, 0xd8, 0xd2,
-  0xfa, 0x55, 0x72, 0x8d, 0xa8, 0x7f, 0xd4, 0x75, 0xd5, 0x8f, 0x7e, 0x7a,
-  0x70, 0xc4, 0x43, 0xc0, 0xd3, 0x99, 0x4a, 0x61, 0x22, 0x70, 0x14, 0x88,
-  0xdb, 0x86, 0xf0, 0x40, 0x30, 0xc6, 0x46, 0x53, 0x83, 0xa7, 0xd9, 0xb4,
-  0xdf, 0x4e, 0x5b, 0xaf, 0x60, 0x46, 0x55, 0xc9, 0x15, 0x7f, 0x04, 0x18,
-  0x3d, 0xea, 0x64, 0xf1, 0x2a, 0xc7, 0xcc, 0x25, 0xee, 0xbb, 0x3d, 0x0b,
-  0xe3, 0xa7, 0x1c, 0xfd, 0x8a, 0x88, 0xc8, 0xc5, 0x84, 0xa1, 0xaf, 0xa6,
-  0xa7, 0x2a, 0x5c, 0x21, 0xf5, 0x14, 0xe3, 0xf5, 0x78, 0xcd, 0xa2, 0x85,
-  0xd7, 0xb6, 0x4d, 0x56, 0x5a, 0x15, 0x48, 0x9e, 0xb4, 0xc5, 0xeb, 0xa9,
-  0xea, 0xa4, 0x4b, 0xa9, 0x06, 0xd4, 0x69, 0x1c, 0x94, 0xbb, 0x9e, 0x9c,
-  0xd7, 0x21, 0xb1, 0xac, 0x3d, 0x5c, 0x0c, 0x2a, 0x57, 0xc5, 0x90, 0x42,
-  0x84, 0x0a, 0x6a, 0x76, 0x3d, 0x45, 0x94, 0xd2, 0xee, 0x92, 0xf2, 0x4d,
-  0xe8, 0x76, 0xa5, 0x16, 0x53, 0xea, 0xe3, 0xa2, 0xb3, 0xe2, 0x60, 0x73,
-  0x2c, 0x35, 0x2f, 0xd3, 0xe9, 0x06, 0xd5, 0xad, 0xf1, 0x7b, 0x0a, 0x9a,
-  0x83, 0x40, 0x6c, 0x7b, 0x4b, 0xa9, 0xd0, 0x50, 0x30, 0xa3, 0x64, 0x14,
-  0x28, 0xd3, 0x1d, 0xfe, 0xd8, 0x37, 0x24, 0x61, 0xa2, 0x12, 0xe0, 0x84,
-  0x82, 0x09, 0xda, 0xf7, 0x95, 0xb8, 0xfa, 0x98, 0x90, 0xb6, 0x87, 0x16,
-  0xb5, 0x30, 0x05, 0x0d, 0x4b, 0xb8, 0x08, 0x4e, 0xf9, 0x96, 0xe7, 0xd7,
-  0xc6, 0xb5, 0x3a, 0x05, 0x9a, 0xe5, 0x98, 0xb6, 0x51, 0x9b, 0xe7, 0xeb,
-  0x80, 0x97, 0x97, 0x82, 0xc6, 0xfb, 0x98, 0xa9, 0x78, 0xed, 0xc5, 0xd6,
-  0x3d, 0x03, 0x05, 0x91, 0x68, 0x29, 0x48, 0xb0, 0x10, 0x10, 0x9f, 0xa4,
-  0xf6, 0xcc, 0x6b, 0x21, 0x88, 0x07, 0x75, 0x34, 0x25, 0xef, 0x48, 0x94,
-  0x12, 0xb2, 0x2c, 0xb6, 0xd7, 0xf2, 0x8d, 0xc8, 0x1e, 0xba, 0xcf, 0x3e,
-  0xbb, 0x38, 0xc5, 0xb5, 0x36, 0x42, 0xd7, 0xf1, 0x62, 0x6b, 0xb8, 0xdd,
-  0xdc, 0xc9, 0xba, 0xb5, 0x80, 0x97, 0xc1, 0xff, 0x22, 0xde, 0xee, 0xf6,
-  0xf6, 0x6b, 0xb3, 0xcd, 0xb3, 0xd3, 0x01, 0x0a, 0x34, 0x92, 0xd9, 0xfa,
-  0x34, 0xf9, 0x22, 0xcc, 0xa8, 0x9d, 0x6a, 0x8d, 0x58, 0x03, 0xc4, 0x25,
-  0x9a, 0x75, 0xf1, 0xe0, 0x44, 0xc8, 0x07, 0x3b, 0x83, 0xa4, 0x26, 0x07,
-  0x0f, 0xcf, 0xfa, 0xfe, 0x78, 0xd7, 0xea, 0x13, 0xf4, 0x22, 0x70, 0x29,
-  0x62, 0xf4, 0xfd, 0xc0, 0xb1, 0xd5, 0xb7, 0x30, 0xff, 0x4b, 0xcb, 0xb1,
-  0x99, 0xbb, 0x7a, 0x2f, 0xdd, 0xd8, 0xa3, 0x41, 0x68, 0x20, 0x49, 0x1e,
-  0xfe, 0x96, 0x1e, 0xcd, 0x76, 0xa0, 0x90, 0x28, 0x4d, 0x8b, 0x19, 0xa8,
-  0x53, 0xe9, 0x26, 0xcd, 0x0e, 0x5b, 0xed, 0xf6, 0x55, 0xdc, 0xb6, 0xa8,
-  0x65, 0x4f, 0xbb, 0x29, 0x6c, 0x87, 0x2b, 0x37, 0x5e, 0x94, 0x0c, 0xec,
-  0xdb, 0xc0, 0xe8, 0xc9, 0xb3, 0x4a, 0xad, 0xe1, 0x9a, 0x66, 0xb5, 0xc4,
-  0x19, 0x15, 0x0c, 0xc7, 0x9b, 0xa1, 0xba, 0xd1, 0xdb, 0xd9, 0x45, 0x5f,
-  0xe4, 0xaa, 0xb5, 0x4b, 0xe2, 0x03, 0x0f, 0xe2, 0xec, 0xe9, 0xd7, 0x8c,
-  0xb7, 0x45, 0x19, 0x67, 0x8b, 0xd0, 0xb9, 0x8f, 0x05, 0x60, 0x41, 0x72,
-  0xb9, 0xd4, 0xe9, 0x00, 0xb7, 0x6f, 0x79, 0x8a, 0x70, 0x25, 0xd8, 0xf9,
-  0x37, 0x3d, 0x01, 0xd6, 0x27, 0x15, 0x9a, 0xf2, 0x5d, 0xf2, 0x84, 0x0e,
-  0xe2, 0xfc, 0x8e, 0xa9, 0xf3, 0x7a, 0x54, 0xa1, 0x47, 0xab, 0x5d, 0x4d,
-  0xa2, 0x2b, 0x7c, 0x4a, 0xd7, 0x06, 0x1f, 0x35, 0x3c, 0xa4, 0xf3, 0x50,
-  0x2b, 0x98, 0x8e, 0xe2, 0x29, 0x99, 0xdc, 0xb4, 0x94, 0xa4, 0x50, 0x74,
-  0x7a, 0x26, 0x32, 0x45, 0xe5, 0x90, 0x08, 0x4d, 0x95, 0x2f, 0xbe, 0x59,
-  0x53, 0xc6, 0x3f, 0x81, 0x03, 0x01, 0xc9, 0x18, 0x9d, 0xb4, 0x1e, 0x15,
-  0xec, 0x0c, 0xa1, 0x6b, 0x99, 0x75, 0xff, 0xbf, 0xdf, 0xfd, 0xec, 0x17,
-  0x89, 0xf2, 0x12, 0xc3, 0xbc, 0x0c, 0x89, 0xfc, 0x90, 0x9f, 0x58, 0x72,
-  0x5e, 0x82, 0x3e, 0x47, 0xa7, 0x72, 0xe7, 0x85, 0x2d, 0x0d, 0x6b, 0x09,
-  0x08, 0xb6, 0x6b, 0x0f, 0x45, 0xb8, 0x83, 0xdd, 0x04, 0x39, 0xe0, 0x36,
-  0x65, 0xbb, 0x41, 0x86, 0x65, 0x5c, 0xba, 0xa2, 0x03, 0x15, 0x95, 0x23,
-  0xf7, 0xba, 0xb1, 0x55, 0x1a, 0xf0, 0x30, 0xc3, 0xc3, 0x7e, 0x71, 0x82,
-  0x0c, 0x5a, 0x88, 0xef, 0xbd, 0xdd, 0x9b, 0x69, 0x3f, 0xeb, 0xb5, 0xb3,
-  0x8d, 0x9b, 0x80, 0x7a, 0x8d, 0x11, 0xd0, 0xb8, 0x43, 0x49, 0xc7, 0x97,
-  0x52, 0xde, 0x4e, 0xc2, 0x59, 0x29, 0x38, 0xdd, 0x9a, 0x8e, 0xb2, 0xe6,
-  0x98, 0x96, 0xc7, 0x35, 0x8a, 0x0b, 0xe1, 0x65, 0x1a, 0x77, 0xb7, 0x2b,
-  0x30, 0x16, 0x17, 0x9c, 0x07, 0xaa, 0x58, 0xec, 0xd8, 0xbd, 0x9b, 0xa9,
-  0xc8, 0x23, 0x62, 0x98, 0x90, 0x79, 0xf4, 0x62, 0x22, 0xa9, 0x40, 0x0e,
-  0x64, 0x75, 0xa1, 0x26, 0x8d, 0xe0, 0x26, 0x84, 0x10, 0xe5, 0x82, 0x75,
-  0x31, 0xb0, 0xd2, 0x17, 0xb8, 0x6f, 0xdd, 0xb7, 0x6f, 0xac, 0x5e, 0xbd,
-  0xa2, 0xa7, 0x46, 0xf2, 0x33, 0x2d, 0x9f, 0xa9, 0x8a, 0x67, 0xc3, 0xd6,
-  0xfa, 0x0a, 0x93, 0xef, 0xac, 0x9d, 0x07, 0xef, 0xe1, 0x09, 0xf9, 0x25,
-  0xb7, 0xd9, 0x4d, 0x21, 0x6c, 0x07, 0x03, 0x3e, 0x52, 0xab, 0x36, 0x59,
-  0xa0, 0x38, 0x5c, 0xbe, 0x61, 0xd9, 0x5f, 0x05, 0xc1, 0x0b, 0x3b, 0xb1,
-  0x99, 0x2e, 0x3c, 0x10, 0x37, 0x73, 0xdc, 0x24, 0x30, 0x82, 0x9d, 0xde,
-  0xab, 0x69, 0xad, 0x2a, 0xaa, 0x69, 0x19, 0x4b, 0x80, 0xe1, 0x3d, 0x05,
-  0x5d, 0x4e, 0xa6, 0xab, 0xa9, 0x7c, 0xc5, 0x82, 0xa0, 0x14, 0x83, 0x05,
-  0x1b, 0xdd, 0x07, 0x24, 0x6e, 0x05, 0xf2, 0x9a, 0x75, 0x8b, 0x0a, 0xa1,
-  0xc5, 0x3f, 0x99, 0x3a, 0xfe, 0xb1, 0x42, 0x1e, 0xb1, 0xf2, 0x66, 0x8a,
-  0x7c, 0xdc, 0xb9, 0xcf, 0x11, 0xd2, 0x4a, 0x4e, 0x61, 0xa5, 0xed, 0xdc,
-  0x73, 0xa1, 0x54, 0x4e, 0x29, 0xf8, 0xf2, 0x65, 0x09, 0xe5, 0x65, 0x3a,
-  0x69, 0x28, 0xb3, 0x54, 0xc0, 0x6c, 0xf3, 0xd4, 0x53, 0x4f, 0x8d, 0x0d,
-  0x90, 0xf6, 0x86, 0x0b, 0x71, 0x2a, 0xec, 0x13, 0x8a, 0x0b, 0x93, 0x6c,
-  0x7a, 0x6a, 0x75, 0x4e, 0x1b, 0x0a, 0x09, 0xc7, 0x98, 0x01, 0x2d, 0xc0,
-  0x88, 0x18, 0xa1, 0x60, 0xed, 0xb7, 0xfa, 0x5d, 0x7e, 0x21, 0xca, 0x06,
-  0x49, 0xb7, 0x37, 0x34, 0xfe, 0xa5, 0xd3, 0x70, 0x55, 0xec, 0xe2, 0x13,
-  0x1c, 0x05, 0x2e, 0x24, 0xd1, 0x69, 0xb3, 0x6a, 0xcb, 0xbd, 0xfc, 0xda,
-  0x63, 0xfb, 0x1e, 0xb0, 0xe3, 0x8c, 0xfc, 0x36, 0x6e, 0x8e, 0xed, 0xb3,
-  0x21, 0x5d, 0x98, 0x01, 0xda, 0x2d, 0x0c, 0x7c, 0xc8, 0xfb, 0xde, 0xa9,
-  0x2b, 0xa7, 0x90, 0x94, 0x66, 0xdf, 0xdd, 0x6b, 0xa2, 0x8e, 0x56, 0x0e,
-  0x00, 0x5d, 0x6c, 0xcb, 0xfe, 0x14, 0xc6, 0x5c, 0xfc, 0xad, 0xa9, 0xdd,
-  0xa5, 0xd7, 0xb5, 0x46, 0xba, 0x99, 0x01, 0x3d, 0xfb, 0xb7, 0xd2, 0x7b,
-  0x78, 0x23, 0x20, 0x2a, 0x5c, 0x4c, 0xaa, 0xba, 0xe8, 0x5d, 0x52, 0xbb,
-  0x74, 0xb3, 0x5e, 0x05, 0xd6, 0xc5, 0x1f, 0xad, 0xde, 0xba, 0x54, 0xaf,
-  0x4a, 0x38, 0x0a, 0x75, 0xb6, 0x8d, 0x04, 0x95, 0x6b, 0x55, 0x51, 0x14,
-  0x0c, 0x8e, 0xd4, 0x53, 0x08, 0x56, 0x62, 0xad, 0xf1, 0xcd, 0xfb, 0x40,
-  0xb6, 0x17, 0x75, 0x5d, 0x0d, 0x57, 0x74, 0x2a, 0x26, 0xd1, 0xfc, 0x19,
-  0x27, 0x71, 0xa5, 0x46, 0x24, 0x44, 0x65, 0x23, 0xd2, 0x79, 0x89, 0x26,
-  0x7b, 0xdd, 0x0c, 0xd8, 0x93, 0x74, 0x39, 0xd8, 0xc2, 0xa3, 0x1f, 0x1d,
-  0xdd, 0xe8, 0x21, 0x7e, 0x59, 0x53, 0x20, 0xa6, 0x6d, 0xd7, 0xa0, 0xe9,
-  0xa4, 0x42, 0xd5, 0xea, 0xa6, 0xc5, 0x39, 0x07, 0x3f, 0x13, 0xa5, 0x07,
-  0xf2, 0x1c, 0x19, 0x4c, 0x17, 0x34, 0xd6, 0x5c, 0x67, 0x7c, 0x71, 0x6e,
-  0x4d, 0x39, 0xee, 0x0c, 0x57, 0x84, 0xdb, 0x98, 0x58, 0x98, 0x6a, 0x1f,
-  0xd2, 0xb0, 0xe9, 0x75, 0x55, 0x1c, 0x45, 0x88, 0xd0, 0x02, 0xeb, 0x6d,
-  0x5a, 0x96, 0xbb, 0x15, 0x85, 0xea, 0xe0, 0x0b, 0xd9, 0x6e, 0x6f, 0x90,
-  0x8a, 0xa2, 0x71, 0x68, 0x0f, 0x10, 0xe8, 0xab, 0xe7, 0x37, 0xfb, 0xbd,
-  0x7b, 0xf7, 0xad, 0x87, 0xbb, 0xe2, 0x49, 0xb5, 0x3a, 0x45, 0x8a, 0xb6,
-  0xa9, 0x5c, 0xae, 0xc3, 0xd0, 0xad, 0x8b, 0x4b, 0x9c, 0x3d, 0x49, 0xf4,
-  0xf6, 0x5a, 0xbf, 0xb7, 0x43, 0x55, 0xb2, 0x10, 0xdf, 0xe9, 0x64, 0x5d,
-  0xfc, 0x07, 0x79, 0x42, 0x37, 0xed, 0xc8, 0xdb, 0x9b, 0x18, 0x7d, 0xda,
-  0xdd, 0xe8, 0xdf, 0x17, 0x59, 0x3e, 0xe1, 0x56, 0x8a, 0xdb, 0xda, 0x4c,
-  0xc0, 0x55, 0xfd, 0xee, 0x0e, 0x02, 0xb8, 0x2b, 0xd7, 0xdd, 0x09, 0x13,
-  0x77, 0xa0, 0xc9, 0x2a, 0xf0, 0x5e, 0x90, 0xe8, 0x47, 0x28, 0x2d, 0x07,
-  0xb5, 0xa0, 0xfe, 0x38, 0x3e, 0xfd, 0x1d, 0x9e, 0xba, 0x8a, 0x3c, 0xae,
-  0x2b, 0xf9, 0x27, 0xb4, 0x9a, 0xe6, 0x83, 0xaa, 0x8f, 0x39, 0x5d, 0x53,
-  0xd2, 0xc5, 0xc6, 0x50, 0x1d, 0x8e, 0x36, 0xf6, 0x0b, 0x45, 0xf2, 0x0a,
-  0xfa, 0x81, 0x57, 0x42, 0x2f, 0xae, 0x5e, 0xbf, 0xfc, 0xf2, 0xad, 0xff,
-  0x72, 0xf3, 0xea, 0xcb, 0xd7, 0x6f, 0x5c, 0xbf, 0x5a, 0x51, 0x5c, 0xd4,
-  0x8b, 0x17, 0x19, 0xd0, 0x36, 0x98, 0xca, 0xbd, 0xdf, 0x1d, 0xcb, 0x95,
-  0x87, 0x8c, 0x12, 0xdc, 0x69, 0x27, 0xec, 0xb2, 0x33, 0x35, 0x79, 0x7f,
-  0x9d, 0xc9, 0xf8, 0xea, 0x94, 0xf6, 0xbf, 0xc9, 0xf1, 0xbb, 0x71, 0x50,
-  0x1a, 0xb4, 0x36, 0x53, 0xb2, 0x8a, 0x14, 0x5b, 0x40, 0xdc, 0xd1, 0xa8,
-  0x35, 0x4d, 0xd9, 0x23, 0x73, 0xce, 0x92, 0x35, 0xd5, 0xb0, 0x01, 0x33,
-  0x40, 0xdd, 0x1d, 0xb8, 0x6e, 0x53, 0x16, 0x28, 0x5b, 0x96, 0xb1, 0x5e,
-  0x81, 0x54, 0xb8, 0xb1, 0xe7, 0x28, 0xec, 0xed, 0x06, 0x8e, 0x68, 0x86,
-  0x77, 0xe2, 0xac, 0x9f, 0xb6, 0xc5, 0x59, 0x56, 0x0d, 0xb8, 0x87, 0x28,
-  0x89, 0x3d, 0x39, 0x2b, 0x2f, 0x87, 0x8e, 0xda, 0x13, 0x38, 0xbb, 0x3a,
-  0x3e, 0x06, 0xda, 0xad, 0x70, 0x52, 0xab, 0x50, 0x83, 0x52, 0xc9, 0xad,
-  0x5f, 0x82, 0x3b, 0x68, 0x2f, 0x0e, 0xa9, 0x4a, 0xf1, 0x87, 0x77, 0x44,
-  0x36, 0x6d, 0x29, 0x93, 0xaa, 0xb2, 0x78, 0x95, 0xbb, 0x0b, 0x52, 0xd2,
-  0x10, 0xc3, 0x14, 0x80, 0x65, 0x23, 0x39, 0x04, 0x79, 0xea, 0xd8, 0xbd,
-  0x5d, 0xb4, 0x7f, 0x8b, 0x4b, 0xcd, 0x60, 0xc8, 0x16, 0x22, 0xc6, 0x8f,
-  0x82, 0x20, 0x83, 0xa3, 0x18, 0x20, 0xbf, 0x40, 0x28, 0x0b, 0x49, 0xa5,
-  0xa2, 0xf9, 0xc2, 0x29, 0x77, 0x13, 0xb1, 0xc0, 0x26, 0x81, 0x07, 0x55,
-  0xa7, 0x2b, 0x5a, 0xf9, 0xd8, 0x88, 0x23, 0x8f, 0xbf, 0x25, 0x0b, 0xc6,
-  0xf0, 0x94, 0x6b, 0xf2, 0x67, 0x0d, 0x9f, 0xd7, 0x4b, 0x72, 0x6b, 0xcb,
-  0x19, 0x57, 0xf2, 0xde, 0x5e, 0x3f, 0xdb, 0xca, 0xba, 0xad, 0xce, 0xaa,
-  0xc3, 0xb8, 0x05, 0xdb, 0x56, 0xbd, 0xe2, 0x3a, 0x06, 0x41, 0x08, 0x9e,
-  0x55, 0xeb, 0xe2, 0xfd, 0x7a, 0xa8, 0xc1, 0x3a, 0x6f, 0xa1, 0xb9, 0xba,
-  0xdd, 0x46, 0x3e, 0x56, 0xad, 0xcc, 0x69, 0x60, 0x37, 0x53, 0xcf, 0x55,
-  0x3b, 0xfb, 0x34, 0xb0, 0x9a, 0xb2, 0x57, 0x20, 0xfc, 0xd3, 0x7d, 0xa0,
-  0xd7, 0xad, 0x7a, 0x87, 0x85, 0xfb, 0x0d, 0x3d, 0xf7, 0x3e, 0xd8, 0x0d,
-  0xb5, 0xde, 0x95, 0x4d, 0x7f, 0xf8, 0x43, 0x7d, 0x66, 0xa1, 0x90, 0x25,
-  0x4f, 0x20, 0x7d, 0xe4, 0x33, 0x16, 0x4a, 0xdf, 0x32, 0xc4, 0xd4, 0x46,
-  0xe6, 0xaf, 0xb3, 0x5d, 0xbc, 0xff, 0x5b, 0x1d, 0x65, 0xbb, 0xaa, 0x97,
-  0x45, 0xaf, 0xf9, 0x16, 0xcc, 0xdd, 0x3e, 0xf1, 0x38, 0xfb, 0x1b, 0xf9,
-  0x3c, 0xfe, 0xe1, 0x60, 0x6f, 0xbd, 0x4b, 0x71, 0x4d, 0xce, 0x6c, 0xd2,
-  0xe3, 0xf8, 0x67, 0xed, 0xee, 0xc0, 0xfb, 0x06, 0x9e, 0xf1, 0x0f, 0x0e,
-  0xa6, 0xdc, 0x93, 0x96, 0x01, 0x08, 0x9c, 0xb3, 0x63, 0x4a, 0x45, 0xd6,
-  0xa5, 0x5e, 0x54, 0x50, 0xb9, 0x0a, 0x07, 0x25, 0x63, 0x3e, 0x27, 0x73,
-  0x0c, 0xe6, 0x6d, 0xe1, 0xf0, 0x51, 0xa9, 0xf9, 0x41, 0x36, 0x00, 0x51,
-  0x4a, 0x2c, 0x29, 0x14, 0xa3, 0xaa, 0x76, 0x10, 0x9e, 0xe3, 0x35, 0x6f,
-  0xfd, 0x6e, 0x6e, 0x66, 0x9d, 0x61, 0xda, 0xaf, 0xd1, 0x54, 0x2d, 0xe3,
-  0x78, 0x04, 0x73, 0x41, 0xa9, 0x81, 0x06, 0x6c, 0xf8, 0x75, 0xb1, 0x53,
-  0x7d, 0x4c, 0xd1, 0x3a, 0xb9, 0x53, 0x3c, 0x7a, 0xfe, 0x62, 0xac, 0x73,
-  0x75, 0xd2, 0xa7, 0x7d, 0xe4, 0x10, 0xff, 0x42, 0x77, 0xa4, 0x6f, 0xd3,
-  0x39, 0x91, 0xb7, 0xee, 0x8a, 0x12, 0x69, 0x56, 0xdc, 0x13, 0x2d, 0x7f,
-  0x91, 0xda, 0x0c, 0xd5, 0x82, 0xe0, 0x49, 0xc0, 0xb8, 0x41, 0x5c, 0xf9,
-  0x1e, 0xfd, 0x2d, 0x8c, 0x93, 0x88, 0x73, 0x8c, 0xea, 0x5d, 0x84, 0xeb,
-  0xc7, 0x6e, 0x09, 0xc8, 0xae, 0xef, 0x6d, 0xe1, 0xc2, 0x32, 0x87, 0x82,
-  0x11, 0x6f, 0x57, 0x57, 0xae, 0xa0, 0xad, 0x53, 0x2e, 0x93, 0xa9, 0x49,
-  0xee, 0x89, 0xe0, 0x7e, 0x08, 0x68, 0xb2, 0x15, 0xc1, 0x53, 0xd9, 0x19,
-  0xaa, 0x16, 0x36, 0xd1, 0x8b, 0x53, 0x4d, 0xa3, 0x31, 0x33, 0x1e, 0x18,
-  0x0c, 0xe9, 0xc0, 0xf0, 0xd7, 0x85, 0xda, 0x4d, 0xe2, 0xb5, 0xe1, 0x4f,
-  0xf2, 0x1c, 0x17, 0x27, 0x48, 0xfc, 0x33, 0xd5, 0x00, 0x3e, 0x9c, 0xf1,
-  0x88, 0xf5, 0x02, 0x52, 0x2b, 0xd9, 0x84, 0xdb, 0x95, 0xd0, 0xa6, 0xb4,
-  0x86, 0x30, 0xb9, 0xeb, 0x7b, 0x43, 0x0a, 0xa7, 0x5a, 0x77, 0x49, 0x38,
-  0xa6, 0x4c, 0x38, 0x21, 0x69, 0xd0, 0x92, 0x57, 0x54, 0xe5, 0x75, 0x00,
-  0x64, 0x03, 0xbe, 0xe8, 0xc8, 0x7b, 0x14, 0x9b, 0x86, 0xca, 0x86, 0xea,
-  0xe2, 0x31, 0x2e, 0x87, 0x13, 0xbb, 0xdb, 0x60, 0x8b, 0x53, 0xce, 0x18,
-  0x9a, 0x40, 0xeb, 0x9d, 0x5a, 0x5d, 0x73, 0xc5, 0xc9, 0xf0, 0xa3, 0xe3,
-  0xf1, 0x98, 0x29, 0xc7, 0xed, 0xdf, 0x65, 0x69, 0x4b, 0x8a, 0xa9, 0xe1,
-  0x7a, 0x3a, 0x15, 0x6c, 0x64, 0x0e, 0xa3, 0x92, 0xd7, 0x92, 0xc2, 0x60,
-  0x80, 0xc8, 0x85, 0xd0, 0x09, 0xf3, 0x88, 0xdc, 0x15, 0x72, 0xef, 0x09,
-  0xb9, 0x77, 0x04, 0xf2, 0x96, 0x30, 0x17, 0x84, 0x29, 0xe3, 0xf8, 0xa1,
-  0x66, 0x50, 0x38, 0x61, 0x08, 0x65, 0x44, 0x45, 0x2f, 0x4d, 0x75, 0xb7,
-  0x40, 0x71, 0x01, 0x44, 0x68, 0x98, 0xf5, 0xb4, 0xad, 0x26, 0xa2, 0xe2,
-  0x5a, 0xd2, 0x2d, 0x3e, 0x10, 0x1d, 0x46, 0x0c, 0x4f, 0xa5, 0xe5, 0x76,
-  0x50, 0x2d, 0xf3, 0x89, 0x7f, 0x03, 0x62, 0xcb, 0x87, 0xe0, 0x19, 0x56,
-  0x69, 0xc3, 0xda, 0x6d, 0xd1, 0xcd, 0xa1, 0xd7, 0x4e, 0xbd, 0xf5, 0x24,
-  0xf0, 0x90, 0x2e, 0x34, 0xdc, 0x6e, 0xc7, 0x01, 0x9a, 0xb9, 0xe1, 0x4f,
-  0x15, 0x62, 0xcc, 0x92, 0xc5, 0x78, 0x63, 0xdc, 0x4d, 0xaf, 0xac, 0x87,
-  0xde, 0x31, 0xfc, 0xf1, 0xa2, 0xde, 0x77, 0xb9, 0x9e, 0x76, 0xd2, 0xff,
-  0x18, 0x03, 0x40, 0x16, 0xa7, 0x0a, 0xbd, 0xea, 0xd6, 0x31, 0x79, 0x96,
-  0x73, 0x20, 0xe0, 0x40, 0x43, 0x77, 0x97, 0x0a, 0x39, 0x0e, 0x1b, 0xf7,
-  0x97, 0x4a, 0x58, 0xdd, 0xe4, 0x6b, 0x9b, 0xc2, 0xba, 0x25, 0x73, 0xeb,
-  0x70, 0x18, 0x94, 0x96, 0xe5, 0x3d, 0xfd, 0x11, 0xa5, 0x10, 0x48, 0x65,
-  0x70, 0x2a, 0x9e, 0x15, 0x0a, 0xd5, 0x22, 0xb9, 0x56, 0xb7, 0x73, 0x44,
-  0x81, 0xd8, 0xae, 0x92, 0x4b, 0x89, 0xdf, 0xae, 0xbf, 0x8a, 0x53, 0xc8,
-  0x9c, 0x20, 0xf7, 0x32, 0x9a, 0xd5, 0xab, 0x32, 0xcf, 0xc0, 0x71, 0x76,
-  0x06, 0xed, 0x0b, 0x0e, 0x4f, 0x2b, 0xc0, 0xf8, 0x43, 0x6b, 0x5f, 0xb0,
-  0xc5, 0xe1, 0x6c, 0x51, 0x3d, 0x20, 0x4a, 0x27, 0xa0, 0xfc, 0xf6, 0xe0,
-  0x92, 0x92, 0xbd, 0x2a, 0x7a, 0xb3, 0xf6, 0x1a, 0x77, 0x96, 0xad, 0xda,
-  0xa8, 0x79, 0x6d, 0xed, 0x85, 0x0a, 0x7c, 0xa3, 0x1d, 0x6b, 0x83, 0x09,
-  0xde, 0x56, 0xb3, 0x1f, 0x10, 0xd0, 0xd9, 0xb9, 0xdd, 0x7b, 0xb1, 0x76,
-  0x22, 0x3d, 0xd7, 0xad, 0x1e, 0x5e, 0xf9, 0xaa, 0x67, 0x43, 0xed, 0xec,
-  0xad, 0xa4, 0x03, 0x40, 0xa6, 0x92, 0x38, 0xc1, 0x5b, 0xbb, 0x70, 0x12,
-  0xb7, 0x2f, 0x6f, 0x67, 0x9d, 0xb6, 0xcd, 0x6d, 0xe8, 0xb3, 0x23, 0x79,
-  0x30, 0xb3, 0xc0, 0x93, 0x09, 0x38, 0x21, 0x1f, 0xd8, 0x02, 0xb7, 0xb0,
-  0x54, 0xc8, 0x33, 0xed, 0x8a, 0x38, 0x29, 0x6b, 0x52, 0x60, 0x94, 0xd2,
-  0xab, 0xe6, 0x93, 0x7e, 0x14, 0x23, 0x49, 0x1c, 0xf6, 0x13, 0x7d, 0x37,
-  0xf2, 0x2c, 0xc9, 0xde, 0xbd, 0x20, 0x22, 0x11, 0xa7, 0x7a, 0x75, 0x84,
-  0x15, 0x3d, 0x8b, 0x53, 0x93, 0xbd, 0x38, 0xd9, 0xa2, 0x4a, 0x3a, 0x96,
-  0x8c, 0x32, 0x39, 0x29, 0x65, 0x32, 0xea, 0x53, 0xd5, 0x24, 0x47, 0x56,
-  0x09, 0x18, 0x28, 0xcb, 0x5e, 0x1c, 0x0b, 0xaf, 0x7c, 0xb9, 0x77, 0x3d,
-  0x27, 0x7c, 0xd2, 0x59, 0x82, 0x52, 0x2b, 0x23, 0x8d, 0x6f, 0x35, 0x95,
-  0xbd, 0xcc, 0x5d, 0x83, 0x93, 0xd5, 0x2c, 0x98, 0xd3, 0xd8, 0x74, 0x5d,
-  0xbc, 0x92, 0x44, 0xfb, 0x46, 0xe6, 0xda, 0x2f, 0x13, 0x07, 0x92, 0x47,
-  0x4f, 0x35, 0x28, 0x1d, 0x60, 0x7e, 0x31, 0xa9, 0x6e, 0xf5, 0xb3, 0x36,
-  0x99, 0x23, 0x19, 0xad, 0xc3, 0x14, 0x22, 0xe5, 0x18, 0x41, 0x7e, 0xac,
-  0xd4, 0xd9, 0xd5, 0xdd, 0x16, 0x53, 0x86, 0xda, 0xba, 0xca, 0x6c, 0x03,
-  0xa0, 0x14, 0x41, 0xc4, 0x6a, 0x2f, 0xa0, 0x88, 0xa8, 0x2e, 0x85, 0xa6,
-  0x38, 0x26, 0xe7, 0x1f, 0x25, 0xac, 0xb1, 0x82, 0x40, 0xba, 0x96, 0x80,
-  0x34, 0xb9, 0x88, 0xc5, 0x52, 0x4e, 0x09, 0x08, 0x93, 0xf9, 0x21, 0xb8,
-  0xda, 0x7d, 0xbb, 0x38, 0x89, 0xbc, 0xa5, 0x11, 0x27, 0xd6, 0xe7, 0x34,
-  0x90, 0x9d, 0x80, 0x5d, 0x11, 0x8e, 0xed, 0xde, 0x19, 0xfd, 0x57, 0xac,
-  0xbd, 0x57, 0x03, 0x30, 0x0e, 0x27, 0x9e, 0x06, 0x1d, 0x89, 0xa4, 0x08,
-  0x64, 0x29, 0x82, 0x5f, 0xe8, 0x81, 0xb0, 0x08, 0x2b, 0xa4, 0xac, 0x07,
-  0x44, 0xdd, 0xc8, 0xaf, 0xf8, 0x79, 0x9e, 0xdf, 0x82, 0xd0, 0xa9, 0x8b,
-  0xdb, 0xbd, 0xf8, 0x6a, 0xe7, 0xca, 0xf5, 0xd5, 0x9c, 0x6f, 0xf0, 0xb5,
-  0xfd, 0x81, 0x92, 0x20, 0x8a, 0xba, 0x32, 0x4a, 0x77, 0xfe, 0xb5, 0x62,
-  0x34, 0x45, 0x5f, 0xa3, 0xf2, 0x9a, 0x7f, 0x87, 0x25, 0x4e, 0x5e, 0x32,
-  0x1e, 0x71, 0xf1, 0x4f, 0xa1, 0x5d, 0x43, 0x3b, 0xbe, 0x19, 0x1a, 0x49,
-  0x01, 0xde, 0x9b, 0xf7, 0x85, 0xc0, 0xb3, 0x69, 0x9d, 0x96, 0x04, 0x4b,
-  0xc3, 0xe4, 0x74, 0x66, 0x57, 0xe7, 0x31, 0x9d, 0x95, 0xb1, 0xdb, 0xf3,
-  0xa5, 0x51, 0xaf, 0xfb, 0xd7, 0x04, 0xbe, 0x3a, 0x48, 0xfb, 0x6d, 0x7d,
-  0x20, 0x54, 0xda, 0x7a, 0xbf, 0xf9, 0x4a, 0x5c, 0x1d, 0x45, 0x8d, 0x8b,
-  0xce, 0x02, 0xec, 0xb5, 0x35, 0x9a, 0xf5, 0x81, 0xc3, 0x41, 0x31, 0xc9,
-  0x62, 0xae, 0x33, 0x0b, 0x6a, 0x8a, 0x1b, 0x3a, 0x9d, 0x8b, 0xfe, 0x1a,
-  0xbf, 0x13, 0xce, 0x2c, 0xdf, 0xbc, 0xf5, 0xe2, 0xb7, 0xf1, 0xac, 0xad,
-  0x5a, 0x62, 0xc7, 0x29, 0x9e, 0xdd, 0xc5, 0x89, 0xc8, 0x26, 0xe9, 0x63,
-  0xc6, 0xf2, 0xdc, 0xf2, 0xa0, 0x5d, 0xe8, 0x64, 0xcb, 0xd7, 0x7b, 0x42,
-  0xe5, 0xad, 0xbf, 0xbf, 0x70, 0x1a, 0x9e, 0x56, 0x17, 0x8b, 0x64, 0x37,
-  0xdd, 0x9d, 0x72, 0x84, 0x43, 0x52, 0x05, 0x5c, 0xee, 0xd9, 0x45, 0x49,
-  0xa9, 0xcf, 0xc7, 0x33, 0xe3, 0x22, 0x7b, 0xc8, 0xb9, 0x58, 0x74, 0x32,
-  0xfe, 0x09, 0x36, 0xb6, 0x6f, 0x15, 0x16, 0x97, 0x71, 0x1a, 0x5a, 0x2c,
-  0xc7, 0xe0, 0x17, 0x69, 0xc5, 0xf4, 0xa2, 0xe2, 0xef, 0x48, 0x3b, 0x4b,
-  0x15, 0xaa, 0x7e, 0x71, 0x37, 0x39, 0xde, 0x58, 0xda, 0x26, 0xa8, 0xa9,
-  0xf8, 0xfb, 0xa2, 0xb4, 0x52, 0xe0, 0x01, 0x48, 0xa6, 0xac, 0xaa, 0xfb,
-  0x2d, 0x9f, 0xc3, 0xb5, 0x82, 0x22, 0x33, 0x91, 0xec, 0xb9, 0x8e, 0xbc,
-  0x8f, 0xb9, 0x5d, 0x81, 0xfa, 0xcf, 0xbc, 0xa6, 0x48, 0x70, 0x50, 0xad,
-  0x87, 0x4a, 0x40, 0x97, 0xaa, 0x75, 0xe3, 0x25, 0xa2, 0xc5, 0x72, 0x74,
-  0x3d, 0x55, 0x63, 0xd9, 0x3d, 0x57, 0x5c, 0x98, 0xa2, 0x71, 0xd8, 0x89,
-  0x5c, 0xe0, 0x97, 0x0d, 0x2e, 0x0b, 0x18, 0x48, 0x2a, 0x75, 0x28, 0x91,
-  0x8a, 0xf5, 0x20, 0xf1, 0xf0, 0x28, 0x59, 0x77, 0x87, 0x67, 0xf6, 0x65,
-  0x54, 0x08, 0x15, 0xd5, 0x89, 0xa2, 0x62, 0xa5, 0xb5, 0x55, 0xc3, 0x5c,
-  0x6f, 0xb5, 0xb7, 0xa0, 0xb3, 0x9a, 0x6c, 0x57, 0x97, 0xc9, 0x6d, 0x25,
-  0xbe, 0x01, 0x1c, 0x4c, 0x4a, 0x73, 0x4b, 0xbb, 0x24, 0x74, 0x00, 0x95,
-  0x48, 0x65, 0xf2, 0x40, 0x11, 0xf2, 0x60, 0x01, 0xb2, 0xf0, 0xa3, 0x32,
-  0xf9, 0x87, 0x1d, 0xc0, 0x32, 0xd5, 0xad, 0x59, 0x55, 0xb6, 0x09, 0xc5,
-  0x5e, 0x49, 0x8b, 0xd2, 0x49, 0x95, 0x5c, 0x99, 0xfb, 0xbd, 0xdd, 0xd6,
-  0x56, 0x4b, 0xf8, 0x1a, 0x2f, 0x46, 0xe6, 0x59, 0x57, 0x81, 0x02, 0xa8,
-  0x95, 0x84, 0xe6, 0x6b, 0x89, 0xf4, 0x58, 0x2c, 0x88, 0xbe, 0xb2, 0x8c,
-  0x0f, 0xc2, 0x15, 0xcc, 0x02, 0x08, 0xda, 0x76, 0xa5, 0x09, 0xe1, 0x27,
-  0x6b, 0x02, 0x28, 0x0c, 0xaf, 0xd0, 0x4f, 0xad, 0x62, 0x5d, 0xfe, 0xcb,
-  0x6f, 0x7e, 0x19, 0xc5, 0x6f, 0x9c, 0xda, 0x4b, 0xb1, 0x6a, 0x72, 0xa1,
-  0xf2, 0x72, 0xa5, 0xd3, 0x1f, 0xab, 0x05, 0x2c, 0x59, 0x8e, 0x23, 0x74,
-  0x1f, 0xb8, 0xbb, 0x9f, 0xfc, 0x23, 0x42, 0xc9, 0xd1, 0x81, 0xc4, 0x83,
-  0xbd, 0xf5, 0x9d, 0x6c, 0x28, 0x6b, 0xb4, 0xf9, 0xb2, 0x68, 0x25, 0x6f,
-  0x53, 0x52, 0x2e, 0x65, 0x1a, 0xb6, 0xbf, 0x17, 0x44, 0xae, 0x6b, 0x68,
-  0xb1, 0x44, 0x0e, 0x8b, 0x6c, 0x1b, 0x2c, 0xa3, 0xbd, 0x28, 0x50, 0x71,
-  0x2f, 0x54, 0x2c, 0x1e, 0xa4, 0x7d, 0x59, 0xdb, 0xc3, 0x86, 0x21, 0xf9,
-  0x11, 0xb9, 0x42, 0xaa, 0x4a, 0xdc, 0x6c, 0x59, 0x54, 0xb4, 0xfe, 0x3c,
-  0xb2, 0xab, 0xdc, 0x6e, 0x2f, 0x9c, 0x6a, 0x34, 0x92, 0xd1, 0xef, 0x47,
-  0x9f, 0x61, 0xe6, 0x6f, 0x2a, 0x17, 0xfe, 0x89, 0x8c, 0xc1, 0xc4, 0x3f,
-  0x44, 0x82, 0x32, 0x61, 0xe7, 0x6a, 0x34, 0x18, 0xc8, 0xa7, 0x9e, 0xb2,
-  0xf1, 0x15, 0x1e, 0xa3, 0x02, 0xe3, 0xf5, 0x30, 0xca, 0xeb, 0x01, 0x9c,
-  0x99, 0x55, 0x0e, 0xe7, 0x0e, 0x33, 0x03, 0x45, 0xc1, 0xca, 0x23, 0xc9,
-  0x07, 0x2c, 0x5f, 0x38, 0xa0, 0xd5, 0x79, 0x76, 0xf1, 0x62, 0x32, 0x73,
-  0x50, 0xf1, 0x06, 0x7e, 0x84, 0xd9, 0xf4, 0x95, 0x9b, 0x95, 0x65, 0xa5,
-  0x75, 0x1d, 0x77, 0x56, 0x03, 0xb0, 0xe4, 0x68, 0xd4, 0x1b, 0x67, 0x38,
-  0xea, 0xb1, 0x21, 0x56, 0x99, 0xe9, 0xe5, 0xa3, 0xcc, 0xa9, 0x5b, 0x54,
-  0x98, 0x86, 0x7d, 0x6f, 0x90, 0x36, 0x8c, 0xfa, 0xc0, 0xc3, 0x99, 0x79,
-  0xa7, 0xc4, 0x78, 0x8f, 0xdc, 0xb9, 0xac, 0xa5, 0x7f, 0x0e, 0xc6, 0x3e,
-  0x35, 0x59, 0xdf, 0x83, 0x3a, 0x97, 0x12, 0x62, 0x80, 0x3b, 0x95, 0xb1,
-  0xf1, 0x2c, 0xdf, 0x1e, 0xa4, 0x89, 0x00, 0x9f, 0xac, 0xdc, 0x8c, 0x4c,
-  0x6a, 0x31, 0xa9, 0x5d, 0x4d, 0x4b, 0x8c, 0x8f, 0x39, 0xd4, 0xb0, 0x75,
-  0x2a, 0x07, 0xa1, 0x31, 0x94, 0x5b, 0xb5, 0xf6, 0x60, 0xed, 0x11, 0x42,
-  0x57, 0x97, 0xda, 0xed, 0x7e, 0x3a, 0x18, 0x44, 0xd7, 0x6c, 0x74, 0xd5,
-  0x86, 0xe6, 0x3e, 0xdb, 0x75, 0xf9, 0x90, 0x1a, 0x91, 0x5c, 0xa9, 0x09,
-  0x49, 0xcd, 0xdb, 0xbd, 0x0e, 0x1c, 0xc9, 0x4b, 0x95, 0xd9, 0xf3, 0x73,
-  0xcd, 0xd9, 0xe7, 0xce, 0x35, 0x67, 0x9b, 0xb3, 0x33, 0x33, 0xa1, 0x11,
-  0x86, 0xd9, 0xd4, 0xd1, 0x46, 0x2e, 0xfd, 0x99, 0xf8, 0xf0, 0xbf, 0x21,
-  0x1e, 0x8d, 0x3f, 0x76, 0x1f, 0x96, 0x24, 0x80, 0x7c, 0x11, 0xa4, 0x82,
-  0xec, 0xad, 0x90, 0x14, 0x27, 0x4d, 0x08, 0xe1, 0xa0, 0x65, 0x1d, 0x45,
-  0xc2, 0x93, 0xeb, 0xc5, 0xd6, 0xe0, 0x95, 0xf1, 0x69, 0xe1, 0x81, 0x53,
-  0xa7, 0x12, 0x3d, 0x0f, 0x52, 0x42, 0xf6, 0x17, 0x24, 0xc4, 0xdc, 0xd9,
-  0xb3, 0x4d, 0xf5, 0xcf, 0x89, 0xaf, 0x89, 0x76, 0x97, 0x4b, 0xa6, 0xcb,
-  0x57, 0xae, 0xaf, 0x26, 0x22, 0xb9, 0xc4, 0xf8, 0x64, 0xb0, 0x41, 0x49,
-  0x1a, 0xb4, 0xb1, 0x92, 0x4a, 0x80, 0x00, 0xd8, 0x51, 0x70, 0xf4, 0xe7,
-  0x9a, 0xf4, 0xbf, 0xf8, 0xb8, 0x1f, 0x37, 0xa3, 0x17, 0xda, 0xd0, 0x10,
-  0x93, 0x27, 0x55, 0x6e, 0x31, 0x87, 0xa7, 0x66, 0x47, 0x67, 0xef, 0x4c,
-  0x61, 0x7c, 0x44, 0xd6, 0xee, 0x8e, 0x80, 0xd8, 0x3a, 0x81, 0x3d, 0x32,
-  0x4b, 0x67, 0x2a, 0xe2, 0x1c, 0x6e, 0xae, 0x47, 0x5e, 0x20, 0x98, 0x1e,
-  0x79, 0xf5, 0x7a, 0x23, 0x13, 0x3d, 0x1e, 0x99, 0xa3, 0x47, 0xe6, 0x9a,
-  0x1e, 0xbb, 0x12, 0x08, 0xf5, 0x14, 0x5c, 0xc2, 0xdb, 0xc3, 0xe1, 0xee,
-  0xc2, 0xe9, 0xd3, 0xd4, 0xa2, 0x99, 0xde, 0x6b, 0x61, 0xa4, 0x7f, 0x73,
-  0xa3, 0xb7, 0xb3, 0x70, 0x6e, 0xe6, 0xdc, 0xcc, 0xe4, 0x16, 0x76, 0xa4,
-  0x82, 0x49, 0xc9, 0x4a, 0x26, 0xdc, 0xe7, 0xdc, 0x5d, 0x51, 0xab, 0xf0,
-  0x2e, 0x76, 0xe9, 0x29, 0xae, 0x42, 0x64, 0xdc, 0x49, 0x1d, 0xb8, 0x7a,
-  0x47, 0x52, 0x8b, 0xca, 0xf2, 0x65, 0xfa, 0x6f, 0xf4, 0x76, 0x15, 0xba,
-  0xf7, 0xe2, 0x98, 0x73, 0xae, 0x4f, 0x6b, 0x8b, 0x3c, 0x53, 0x2f, 0xbb,
-  0xda, 0xdb, 0xe6, 0x4f, 0xa7, 0xc4, 0x08, 0x34, 0xc3, 0xaa, 0x49, 0xbd,
-  0x7e, 0xab, 0x7f, 0xff, 0xd2, 0x4d, 0xcb, 0xb1, 0x94, 0x54, 0x35, 0xc2,
-  0xde, 0x21, 0x8a, 0x43, 0xa3, 0x36, 0x6a, 0x4e, 0x97, 0x87, 0x56, 0xf6,
-  0x6b, 0x66, 0x8f, 0x23, 0x95, 0x9e, 0xdf, 0xc1, 0xa5, 0x9b, 0xdc, 0x6b,
-  0xeb, 0xf8, 0x3d, 0x53, 0x42, 0x2e, 0xd7, 0x49, 0x93, 0x45, 0x3e, 0x92,
-  0x9e, 0x90, 0x9b, 0xb1, 0x11, 0x9e, 0x9b, 0xb7, 0x47, 0x5f, 0x1e, 0xed,
-  0x68, 0x08, 0xdf, 0xfa, 0xe7, 0xe9, 0xd4, 0x5c, 0x7b, 0x2b, 0x61, 0x3b,
-  0x46, 0x3a, 0xd8, 0x12, 0xc6, 0xcf, 0x83, 0x29, 0x37, 0x31, 0x80, 0x6d,
-  0x3c, 0x0a, 0xa4, 0x61, 0x55, 0x5a, 0xe1, 0xa0, 0x1f, 0xa5, 0xdf, 0xde,
-  0xd2, 0x24, 0xd7, 0x0b, 0xcd, 0x46, 0x7e, 0x5e, 0xe9, 0x01, 0x9f, 0xdf,
-  0xc2, 0xef, 0x1d, 0x8b, 0x03, 0xff, 0x5e, 0x58, 0x2b, 0x88, 0x9b, 0x5c,
-  0x5d, 0xbd, 0xd9, 0xb8, 0x74, 0xb3, 0x5a, 0x08, 0x8d, 0xdb, 0x22, 0x38,
-  0xa8, 0x1d, 0x75, 0xb2, 0x0e, 0xda, 0xd5, 0x32, 0x28, 0xb9, 0x96, 0x09,
-  0x0e, 0xcb, 0x58, 0x37, 0xb8, 0x2b, 0x7b, 0x52, 0xd2, 0x56, 0x61, 0x0d,
-  0x50, 0x5b, 0x3a, 0x08, 0x12, 0x93, 0xf5, 0x4a, 0x00, 0x8d, 0x58, 0x31,
-  0x38, 0x7c, 0xcb, 0x22, 0x22, 0x12, 0xf6, 0x8f, 0x6f, 0xa9, 0xb0, 0x10,
-  0x96, 0x06, 0x8f, 0x45, 0xdb, 0xcd, 0x01, 0x6d, 0xad, 0xe9, 0xcd, 0x56,
-  0x7f, 0x38, 0x4d, 0x85, 0x1e, 0xf0, 0xaf, 0xbb, 0xfc, 0x33, 0x27, 0x53,
-  0x56, 0x13, 0x4e, 0x44, 0xe4, 0x83, 0x09, 0xae, 0xfe, 0xa7, 0x78, 0xc4,
-  0x09, 0xe6, 0xa9, 0x69, 0x5f, 0xa1, 0x48, 0xed, 0x44, 0xc1, 0x54, 0xad,
-  0x1b, 0x80, 0x12, 0xea, 0x5f, 0x30, 0x3d, 0x7f, 0xbd, 0xf9, 0xfd, 0x5e,
-  0xd6, 0x85, 0xcd, 0x54, 0xad, 0x27, 0xcf, 0x26, 0x00, 0x08, 0xfe, 0xad,
-  0x7a, 0x2e, 0xa4, 0x9c, 0x97, 0xb7, 0xcb, 0xd9, 0x71, 0x16, 0x22, 0x85,
-  0xa1, 0xec, 0xd5, 0xc1, 0xfd, 0xc1, 0x4a, 0x77, 0xb3, 0xb7, 0xaa, 0x2c,
-  0xa7, 0x5c, 0x85, 0x6d, 0x08, 0x27, 0x1a, 0x19, 0xf3, 0xc0, 0xf7, 0xba,
-  0x64, 0x14, 0xb8, 0xb0, 0xde, 0x5f, 0x66, 0x0e, 0x17, 0x6e, 0xba, 0x75,
-  0x8b, 0xca, 0x47, 0x8d, 0x5c, 0x46, 0x9e, 0xa6, 0xbf, 0x15, 0x4c, 0x80,
-  0xdc, 0xed, 0xa2, 0xdc, 0x36, 0x1e, 0x71, 0x6c, 0x87, 0x1a, 0x27, 0x0d,
-  0xac, 0x11, 0xfa, 0x3a, 0x95, 0xb9, 0xc4, 0x3c, 0x5c, 0x5f, 0x8e, 0x1e,
-  0x9d, 0xaa, 0xcb, 0x40, 0x0d, 0x2b, 0xb7, 0x89, 0xd5, 0x1d, 0xce, 0xd3,
-  0x7f, 0x05, 0x79, 0x87, 0xbc, 0x69, 0xf6, 0xba, 0xed, 0x74, 0x33, 0xeb,
-  0xa6, 0x81, 0x9c, 0xf1, 0xd8, 0xee, 0x07, 0xd0, 0x4e, 0xb0, 0xce, 0xbc,
-  0x31, 0xab, 0x96, 0x55, 0x27, 0xb4, 0xcd, 0x86, 0xe0, 0xc6, 0xe9, 0xdb,
-  0x6f, 0xfd, 0xcd, 0xa9, 0xf0, 0x6c, 0x0e, 0x61, 0x6e, 0xfb, 0x4e, 0x7a,
-  0x0a, 0x3f, 0x8c, 0x5e, 0x42, 0xc3, 0xef, 0x65, 0xe9, 0x1f, 0x0f, 0x92,
-  0x9f, 0xac, 0x42, 0x4f, 0xb0, 0x5f, 0xdd, 0xab, 0xd9, 0x6c, 0x3a, 0x4f,
-  0xa7, 0x31, 0xc1, 0x9e, 0x02, 0x7a, 0xa0, 0x17, 0x87, 0xe0, 0xe0, 0x2f,
-  0xc2, 0x95, 0xe2, 0xdb, 0x59, 0xf7, 0x95, 0x9a, 0x7d, 0x2e, 0x50, 0x4a,
-  0x83, 0x98, 0x17, 0xb6, 0x2c, 0x22, 0x36, 0xe5, 0x1c, 0x1e, 0x7e, 0xd2,
-  0x65, 0xcb, 0x52, 0x58, 0xd2, 0xf0, 0xd7, 0x52, 0x50, 0x1c, 0xe3, 0x9f,
-  0xf8, 0x5a, 0x28, 0xdf, 0xc7, 0xfb, 0x5e, 0x6a, 0xec, 0xe5, 0x76, 0x09,
-  0x1a, 0x10, 0x93, 0xe2, 0xc1, 0x8e, 0x6b, 0x5e, 0x8c, 0x9a, 0x16, 0x35,
-  0x04, 0x0a, 0x3b, 0xe0, 0xa6, 0x45, 0x81, 0x67, 0xae, 0xc7, 0x91, 0xe3,
-  0x95, 0x1c, 0xfb, 0x42, 0x79, 0x47, 0x4d, 0x05, 0x8c, 0x92, 0x32, 0x70,
-  0x47, 0x0a, 0x47, 0x71, 0x57, 0x7b, 0x25, 0xa6, 0xdc, 0x95, 0x22, 0x8b,
-  0xf1, 0xa2, 0xb7, 0xfc, 0x91, 0x4b, 0xdb, 0x22, 0x4b, 0xd9, 0x21, 0xa3,
-  0xc6, 0x3c, 0x12, 0xd5, 0xe5, 0xd5, 0x68, 0xb7, 0xd5, 0x46, 0x37, 0xd7,
-  0x85, 0x04, 0x3d, 0x19, 0xb9, 0x2e, 0xfd, 0x82, 0xab, 0xfd, 0xcf, 0x31,
-  0x5f, 0x21, 0x07, 0x65, 0x4d, 0x57, 0xb3, 0xad, 0x6e, 0xab, 0xa3, 0x6e,
-  0x5b, 0x7d, 0x68, 0x7b, 0x90, 0xb4, 0x5f, 0xd8, 0x99, 0x4e, 0x2e, 0x2b,
-  0xc7, 0x5c, 0x4b, 0xf3, 0x7b, 0xe0, 0x7c, 0x6e, 0xe8, 0xa6, 0x1a, 0x1a,
-  0x72, 0xb9, 0x6d, 0x49, 0xe3, 0xad, 0x9a, 0x91, 0x92, 0xfa, 0x60, 0x2a,
-  0x22, 0x81, 0xe7, 0xd8, 0xa1, 0xec, 0xda, 0xf0, 0xae, 0x6d, 0x27, 0x10,
-  0x9f, 0x0f, 0xd7, 0x07, 0x51, 0x13, 0x01, 0xbb, 0xaf, 0x29, 0x82, 0xd4,
-  0x31, 0xad, 0x61, 0x95, 0xe3, 0x62, 0x7e, 0xab, 0xb1, 0xe2, 0x25, 0x06,
-  0x2e, 0x81, 0x81, 0xe2, 0xd1, 0x1c, 0x5b, 0xf6, 0x43, 0xe6, 0x5d, 0x8d,
-  0x49, 0xcd, 0x42, 0x0a, 0xe5, 0x4e, 0x3d, 0x0c, 0x31, 0xe3, 0xbc, 0xa5,
-  0x72, 0xed, 0x58, 0xe6, 0xf1, 0x2a, 0x1e, 0x7f, 0x95, 0xef, 0x7d, 0xaf,
-  0x5a, 0xa9, 0xdb, 0x37, 0x1c, 0xd3, 0xa4, 0x42, 0x27, 0xe4, 0xf7, 0xbe,
-  0x57, 0xa9, 0x46, 0x9b, 0x7c, 0xef, 0x7b, 0xb2, 0x0d, 0x00, 0x0a, 0xc4,
-  0xf0, 0xb9, 0x69, 0xb9, 0xf4, 0x09, 0x50, 0xca, 0x79, 0x09, 0x38, 0xd2,
-  0xcb, 0x92, 0x05, 0xbf, 0x2c, 0xaa, 0x1e, 0xf0, 0x8c, 0x2a, 0xa5, 0x41,
-  0x68, 0xf6, 0x77, 0xa4, 0xaf, 0x15, 0xbf, 0x7f, 0x59, 0x17, 0x2d, 0x38,
-  0x1e, 0x18, 0x91, 0xbb, 0xd5, 0x06, 0x92, 0x0e, 0x2f, 0x1b, 0x91, 0xe8,
-  0x5a, 0xaf, 0x4f, 0x8e, 0xbf, 0xf8, 0x77, 0x2d, 0xf7, 0x92, 0xe1, 0x55,
-  0x49, 0xe0, 0x17, 0x8d, 0x3c, 0x87, 0x5e, 0x35, 0x94, 0x46, 0x2a, 0x2b,
-  0xb0, 0x46, 0x6e, 0x0f, 0xaa, 0x83, 0x1b, 0x5d, 0xab, 0x42, 0x4d, 0x14,
-  0xee, 0x7a, 0x6f, 0xd8, 0x08, 0xdf, 0x24, 0xe0, 0xcd, 0x8a, 0x0e, 0xec,
-  0x92, 0x47, 0xc0, 0xa5, 0x7e, 0xbf, 0x75, 0x1f, 0xef, 0x28, 0xf8, 0x5f,
-  0x2e, 0x0d, 0xdd, 0xdc, 0x1b, 0x6c, 0xd7, 0x29, 0x7f, 0x90, 0xfd, 0x8c,
-  0x1f, 0x0f, 0xf3, 0xfa, 0x56, 0x5a, 0x3c, 0xca, 0x5d, 0xf8, 0xb6, 0x31,
-  0x13, 0x1b, 0x24, 0x42, 0xbe, 0x33, 0x73, 0xd7, 0xa9, 0xc1, 0x53, 0x12,
-  0xea, 0x6c, 0x2e, 0xd4, 0xd9, 0x23, 0x42, 0x9d, 0xcb, 0x85, 0x3a, 0x67,
-  0x43, 0xb5, 0x83, 0x3e, 0x8f, 0x44, 0x8d, 0xe3, 0x8e, 0xfb, 0xb8, 0x23,
-  0x34, 0x63, 0xc1, 0x41, 0xb8, 0xc5, 0x52, 0x8d, 0x18, 0x67, 0xbd, 0x90,
-  0x45, 0xa7, 0xa6, 0xdc, 0x9a, 0x21, 0xf4, 0x96, 0xfc, 0xab, 0xac, 0xf6,
-  0xd2, 0x7d, 0xcb, 0x51, 0x74, 0xa8, 0x26, 0xac, 0x1b, 0x9f, 0x8b, 0xc5,
-  0xe0, 0xef, 0x11, 0x5c, 0xc7, 0x3f, 0xb6, 0x48, 0x2c, 0xd3, 0x74, 0xa0,
-  0xaf, 0x5d, 0x47, 0x71, 0x7a, 0xf8, 0xcd, 0x42, 0xd9, 0x8c, 0x9a, 0x31,
-  0x71, 0xac, 0xa4, 0x4b, 0xd7, 0x9e, 0x22, 0x1c, 0xfd, 0x31, 0xbe, 0x33,
-  0x17, 0x5c, 0x67, 0xb7, 0x7b, 0xfd, 0xec, 0x07, 0x30, 0x69, 0x04, 0xc1,
-  0x75, 0xe7, 0x62, 0xd8, 0x17, 0xba, 0x7b, 0x47, 0x5c, 0xbf, 0x72, 0x41,
-  0x30, 0x69, 0x4c, 0xb7, 0x35, 0x3e, 0x62, 0xf8, 0x73, 0x3a, 0xc9, 0xb0,
-  0x44, 0x70, 0xd0, 0x57, 0xec, 0x98, 0xce, 0x5e, 0x08, 0x3e, 0xe8, 0xe9,
-  0x95, 0xe7, 0x32, 0xe5, 0x28, 0x0a, 0xb5, 0x18, 0x85, 0xc0, 0x9a, 0x51,
-  0x27, 0xa0, 0x1c, 0x3b, 0x81, 0xa7, 0xd5, 0xce, 0x28, 0x7f, 0x64, 0x83,
-  0x48, 0xb3, 0x98, 0xc8, 0xaa, 0xf0, 0x9d, 0x74, 0x73, 0xe8, 0x96, 0x85,
-  0x2f, 0x67, 0x57, 0xe8, 0x37, 0x30, 0x5b, 0x1b, 0xec, 0x83, 0xc6, 0x33,
-  0xaf, 0x11, 0x29, 0x0f, 0x2a, 0x89, 0x44, 0x57, 0xbe, 0xf0, 0x4d, 0x06,
-  0x5e, 0x0f, 0xb6, 0xa2, 0x3f, 0x00, 0x72, 0xf9, 0x25, 0x78, 0x12, 0xd4,
-  0x83, 0x17, 0xf8, 0x10, 0x1d, 0x87, 0x1a, 0x33, 0x47, 0xa1, 0xc6, 0x7e,
-  0x9f, 0x94, 0x8e, 0x3e, 0x35, 0xe4, 0x8b, 0x23, 0x50, 0xc3, 0x03, 0xb9,
-  0xfc, 0x5d, 0x78, 0x92, 0x96, 0x23, 0x47, 0xae, 0x63, 0x0e, 0x81, 0x0f,
-  0xab, 0xde, 0x23, 0x4e, 0x4b, 0xc8, 0xcc, 0x6a, 0x0a, 0x11, 0xa3, 0x0a,
-  0x97, 0xce, 0x47, 0x31, 0x2f, 0x23, 0x5f, 0xbd, 0x5d, 0xa4, 0xdf, 0xcd,
-  0xd7, 0x99, 0x82, 0x90, 0x4d, 0x88, 0xb8, 0xbc, 0x14, 0xc7, 0x43, 0xde,
-  0x9d, 0x51, 0x46, 0xd8, 0x4d, 0xf7, 0x1b, 0x62, 0x63, 0x6a, 0xb1, 0x43,
-  0x86, 0x1c, 0xfb, 0x9c, 0x6f, 0xc5, 0xd2, 0x71, 0xb4, 0x3a, 0x69, 0x1f,
-  0x76, 0xfd, 0xcd, 0x4e, 0x8a, 0x99, 0xed, 0x01, 0x20, 0x70, 0x5c, 0x44,
-  0x22, 0x59, 0xb9, 0x12, 0xab, 0xb8, 0xcc, 0xd8, 0x14, 0x69, 0x37, 0xf8,
-  0x81, 0xd0, 0x1c, 0xf4, 0x76, 0x52, 0x62, 0x41, 0xc8, 0x7a, 0xe4, 0xf6,
-  0x26, 0xd6, 0x2a, 0xbb, 0x0e, 0xf4, 0x4d, 0xdd, 0xed, 0x67, 0xc0, 0x82,
-  0xd1, 0x82, 0x06, 0x1d, 0xeb, 0xaa, 0xd0, 0x14, 0x1d, 0x37, 0x28, 0x81,
-  0x87, 0x8d, 0x03, 0x1e, 0xad, 0x35, 0x96, 0xff, 0x13, 0xd3, 0x9e, 0x51,
-  0xef, 0xd3, 0x0c, 0x4e, 0x4b, 0x5c, 0xf9, 0xa8, 0x7c, 0xaf, 0x49, 0x46,
-  0x2c, 0xd6, 0xa4, 0x78, 0xec, 0xa7, 0x91, 0x1c, 0xe3, 0x84, 0xcd, 0x15,
-  0x02, 0x02, 0xd3, 0xa5, 0x15, 0x07, 0xb1, 0x7c, 0x0d, 0xb4, 0x32, 0x24,
-  0x57, 0xe7, 0xd6, 0x12, 0x7a, 0x84, 0x69, 0xd5, 0x67, 0x50, 0x54, 0x14,
-  0xbf, 0x2e, 0x38, 0x04, 0x11, 0x27, 0x9c, 0xad, 0x78, 0x72, 0xa6, 0x6d,
-  0x17, 0xb6, 0x43, 0x2a, 0x80, 0x4d, 0x27, 0xb3, 0x96, 0x86, 0xa9, 0xec,
-  0xa8, 0x3d, 0x8d, 0x92, 0x15, 0x63, 0xe1, 0x49, 0xe9, 0xac, 0x1a, 0x6a,
-  0xc4, 0xab, 0xcd, 0x04, 0x27, 0x08, 0x91, 0x8f, 0x24, 0x64, 0x2c, 0x1b,
-  0x7f, 0x44, 0x11, 0x6f, 0xfa, 0x88, 0xa2, 0xdd, 0xf4, 0x11, 0x45, 0x3a,
-  0xf8, 0xec, 0x2e, 0x1b, 0x84, 0xa0, 0x63, 0x5b, 0xc9, 0x73, 0xf6, 0x04,
-  0xec, 0xb4, 0x76, 0x63, 0x47, 0xb7, 0xf8, 0x5a, 0xae, 0xd8, 0xcb, 0x92,
-  0x37, 0xe7, 0x05, 0xb6, 0x06, 0x0f, 0x9b, 0x35, 0x2b, 0x69, 0x80, 0x5c,
-  0xe8, 0xa5, 0xa1, 0xb9, 0xcc, 0x5a, 0xe7, 0x9a, 0x97, 0x97, 0x6a, 0xbd,
-  0x22, 0xe5, 0x5e, 0x6b, 0xea, 0x44, 0x78, 0x66, 0xab, 0xb9, 0x23, 0xb8,
-  0xe8, 0x3e, 0xd1, 0xa2, 0xb0, 0x84, 0x21, 0x5f, 0x2b, 0x40, 0x7a, 0x73,
-  0xba, 0xc8, 0x5f, 0x74, 0x9f, 0xb8, 0x80, 0xe4, 0xeb, 0x29, 0x5d, 0x0e,
-  0xe4, 0x80, 0x2f, 0x2e, 0x35, 0x11, 0xd1, 0xc8, 0x17, 0x77, 0xe9, 0xea,
-  0x08, 0x18, 0x73, 0x31, 0x5c, 0x38, 0xca, 0x2d, 0x53, 0xc6, 0x6e, 0xe3,
-  0x9d, 0x70, 0xa1, 0xec, 0x6d, 0x52, 0x75, 0x8d, 0xfb, 0x61, 0x81, 0xef,
-  0x0b, 0xf1, 0xc2, 0x5a, 0x54, 0x0b, 0xd6, 0x92, 0x2b, 0x13, 0xe9, 0xc1,
-  0x49, 0x51, 0x97, 0xb9, 0x34, 0x51, 0x75, 0x1b, 0xac, 0xc3, 0x22, 0xca,
-  0x7a, 0x2f, 0xc0, 0xf5, 0x03, 0xfb, 0x26, 0x01, 0x42, 0xff, 0xda, 0xcd,
-  0xda, 0xec, 0xef, 0x2e, 0xfe, 0x3d, 0x03, 0x7c, 0x65, 0x3a, 0x99, 0x9b,
-  0x4e, 0xe6, 0xa7, 0x93, 0x33, 0xd3, 0xc9, 0xd9, 0xe9, 0xe4, 0xb9, 0xe9,
-  0xe4, 0xf9, 0xe9, 0xe4, 0xdc, 0x74, 0x72, 0x1e, 0x13, 0x73, 0xc3, 0x3f,
-  0xf0, 0x7e, 0x16, 0x1a, 0xcc, 0x42, 0x8b, 0x59, 0x68, 0x32, 0x0b, 0x6d,
-  0x66, 0xa1, 0xd1, 0x2c, 0xb4, 0x9a, 0x85, 0x66, 0xb3, 0xd0, 0x6e, 0x0e,
-  0xda, 0xcd, 0x21, 0x1c, 0x68, 0x37, 0x07, 0xed, 0xe6, 0xa0, 0xdd, 0x1c,
-  0xb4, 0x9b, 0x83, 0x76, 0x73, 0xd0, 0x6e, 0x0e, 0xda, 0xcd, 0x41, 0xbb,
-  0x79, 0x68, 0x37, 0x0f, 0xed, 0xe6, 0xb1, 0x43, 0x68, 0x37, 0x0f, 0xed,
-  0xe6, 0xa1, 0xdd, 0x3c, 0xb4, 0x9b, 0x87, 0x76, 0xf3, 0xd0, 0x6e, 0xfe,
-  0xfc, 0x5d, 0x4a, 0xa2, 0x8c, 0x23, 0x94, 0x37, 0x22, 0xaa, 0x0a, 0x83,
-  0x03, 0xc4, 0x3b, 0x15, 0x7b, 0x2e, 0x2a, 0x5b, 0x07, 0x5e, 0x5c, 0x12,
-  0x62, 0x86, 0xff, 0xe2, 0x66, 0xd6, 0xe6, 0x4f, 0xb3, 0xc1, 0xf5, 0x9e,
-  0x28, 0x65, 0xcf, 0xa8, 0xa8, 0xb2, 0x8c, 0x6b, 0x46, 0x09, 0x73, 0x4f,
-  0x18, 0xdc, 0x02, 0x39, 0x0c, 0x4d, 0x1d, 0x35, 0xa2, 0xb1, 0xa5, 0xbe,
-  0xa2, 0x27, 0x70, 0x07, 0xbe, 0xb1, 0x37, 0x14, 0xc9, 0x50, 0x2a, 0xa3,
-  0x77, 0xb1, 0xd8, 0xc8, 0xe8, 0xd1, 0xe8, 0x63, 0x2a, 0x6a, 0x07, 0x3f,
-  0xc5, 0x0f, 0x27, 0x03, 0x0f, 0x99, 0x74, 0xae, 0xc8, 0x89, 0x94, 0x69,
-  0x78, 0xc4, 0x7f, 0x57, 0xac, 0x94, 0x76, 0xf2, 0x61, 0x5e, 0xc6, 0x04,
-  0xfd, 0x99, 0x51, 0xa4, 0x2b, 0x53, 0xb3, 0x7c, 0x47, 0xcc, 0x3c, 0xeb,
-  0xe9, 0x1c, 0x08, 0xab, 0xd9, 0x7a, 0x07, 0x03, 0x00, 0xcb, 0x44, 0xfc,
-  0x0a, 0x2b, 0x8d, 0x00, 0x93, 0x1b, 0xed, 0x1b, 0x6c, 0xa4, 0x13, 0x36,
-  0x84, 0x21, 0xd8, 0x91, 0xbe, 0x45, 0x49, 0x12, 0x19, 0x2a, 0x2a, 0xe5,
-  0x72, 0x8f, 0xe8, 0x3e, 0x68, 0xc8, 0xc7, 0x2c, 0xed, 0x72, 0xb4, 0xaa,
-  0x10, 0xf3, 0x3d, 0x70, 0x80, 0x89, 0xea, 0xea, 0x31, 0x60, 0xb2, 0x9c,
-  0xba, 0x5f, 0xa3, 0x68, 0x02, 0x99, 0x9d, 0xad, 0x3a, 0x3c, 0x0e, 0x1a,
-  0x95, 0x42, 0xbc, 0x55, 0xec, 0x42, 0x1e, 0xde, 0x72, 0x67, 0x58, 0x59,
-  0x3e, 0x78, 0x50, 0x74, 0x74, 0x82, 0xd8, 0x0d, 0x39, 0x27, 0x18, 0x9a,
-  0x57, 0xb6, 0x91, 0xf5, 0xbf, 0x6f, 0xb5, 0xd6, 0x2f, 0x51, 0x1e, 0xee,
-  0x5a, 0xdd, 0xcb, 0x7a, 0x7f, 0x8c, 0xa4, 0xd5, 0x07, 0x5e, 0x46, 0xc8,
-  0x50, 0x8f, 0x6c, 0x07, 0x6d, 0xe8, 0x97, 0x2f, 0x88, 0xdb, 0x46, 0x5e,
-  0xf1, 0x26, 0x9e, 0xc1, 0x7b, 0xd1, 0x6c, 0x73, 0x0f, 0x06, 0x08, 0x77,
-  0xee, 0x33, 0x96, 0xea, 0x05, 0x5f, 0xb5, 0x80, 0xcf, 0xf2, 0x4c, 0xe4,
-  0x1c, 0x63, 0x3a, 0x71, 0x6e, 0x42, 0x83, 0xcb, 0xe4, 0xbd, 0x36, 0xa0,
-  0xba, 0x08, 0x59, 0xab, 0x23, 0xf8, 0xdd, 0xb4, 0x3a, 0x28, 0xc4, 0x4f,
-  0x16, 0x00, 0x6b, 0x3d, 0x57, 0x9a, 0x12, 0x34, 0x98, 0x5a, 0xdf, 0x3b,
-  0x02, 0xa6, 0xb5, 0xb6, 0x2e, 0xe3, 0xd9, 0xbb, 0xd1, 0xea, 0xc8, 0xb4,
-  0xde, 0x18, 0x07, 0x4f, 0xa1, 0xaa, 0x0b, 0x09, 0x7d, 0x0b, 0x8d, 0xf7,
-  0xba, 0x43, 0x95, 0xf3, 0x5b, 0x17, 0xd0, 0x95, 0x54, 0x50, 0x79, 0xfa,
-  0x59, 0xa0, 0xad, 0xd5, 0xf1, 0x8b, 0xad, 0x5d, 0x99, 0x18, 0x12, 0xfe,
-  0x12, 0x2b, 0x0d, 0x33, 0xf1, 0xd4, 0x94, 0xc8, 0x84, 0x1d, 0xf4, 0x36,
-  0xed, 0x6f, 0x74, 0x85, 0x06, 0x07, 0x10, 0x9a, 0x34, 0x6b, 0x92, 0xbb,
-  0xb6, 0xa7, 0xc5, 0xc7, 0x26, 0xca, 0x97, 0x81, 0xe5, 0x34, 0x41, 0xe8,
-  0x1e, 0xed, 0x98, 0xae, 0x85, 0xf5, 0x91, 0x2c, 0xf9, 0x5d, 0x62, 0x72,
-  0x41, 0xfe, 0x79, 0x53, 0x65, 0xe1, 0x52, 0x4b, 0x9b, 0x7d, 0x10, 0x4e,
-  0xe8, 0xbf, 0x16, 0xa7, 0x2f, 0x86, 0x9d, 0x08, 0x12, 0xb4, 0x30, 0xdd,
-  0xb4, 0xb8, 0x62, 0xc1, 0xed, 0x0a, 0x6e, 0xee, 0x76, 0x97, 0x07, 0x4d,
-  0x13, 0x8f, 0xee, 0x10, 0xde, 0x4a, 0xbb, 0x64, 0x7d, 0x06, 0xa7, 0xba,
-  0xb7, 0x10, 0xf0, 0xe1, 0x98, 0x68, 0x12, 0x61, 0x05, 0x96, 0x41, 0xd4,
-  0x16, 0x12, 0x58, 0xb5, 0x6a, 0x79, 0x88, 0xf4, 0x65, 0x28, 0x83, 0xda,
-  0x7d, 0x1e, 0x88, 0xaa, 0x83, 0x2e, 0x7e, 0x47, 0x1a, 0x97, 0x3e, 0x59,
-  0xbd, 0xc1, 0xa9, 0x37, 0x13, 0x1f, 0x21, 0x9e, 0xf6, 0xb9, 0x43, 0x64,
-  0xa7, 0x7d, 0x55, 0xfc, 0x45, 0x4a, 0x16, 0xb2, 0x8f, 0x54, 0x43, 0x83,
-  0xcf, 0xff, 0x20, 0x9f, 0x2c, 0x81, 0xf4, 0x96, 0x95, 0xeb, 0xbd, 0x64,
-  0x43, 0x0d, 0x0f, 0x08, 0x7b, 0x7a, 0x68, 0x30, 0x1e, 0xe8, 0x81, 0xca,
-  0xcd, 0x2b, 0x41, 0x4a, 0xd9, 0x86, 0x33, 0x21, 0xff, 0x80, 0xc4, 0x51,
-  0xca, 0x8a, 0x08, 0xa2, 0x16, 0x9a, 0xc3, 0x45, 0x81, 0xa5, 0xe5, 0x6a,
-  0x80, 0x2b, 0x42, 0x06, 0x45, 0x16, 0x78, 0x59, 0x35, 0xaf, 0x28, 0xa9,
-  0x44, 0xfc, 0xb4, 0xf4, 0x92, 0x3c, 0x5f, 0xad, 0x2d, 0xd3, 0x36, 0x05,
-  0x24, 0x94, 0x2b, 0x82, 0x2f, 0x82, 0x5a, 0xe2, 0x70, 0x27, 0xd5, 0xb0,
-  0x6d, 0x19, 0xf5, 0x6e, 0x09, 0x1e, 0x65, 0x8d, 0x56, 0x27, 0xdb, 0x82,
-  0x1b, 0xc3, 0x06, 0x69, 0x5b, 0x16, 0x2b, 0xa8, 0x52, 0x06, 0x48, 0x9b,
-  0xd9, 0x16, 0xa5, 0x0f, 0x13, 0xfd, 0x9d, 0x16, 0xf2, 0xb4, 0x50, 0x31,
-  0x85, 0x8d, 0xf5, 0x70, 0xca, 0xc2, 0x07, 0x44, 0xd0, 0x95, 0xf6, 0xa0,
-  0x66, 0x84, 0x27, 0x4d, 0x55, 0x8d, 0xa7, 0x23, 0xdc, 0xd2, 0x39, 0x88,
-  0x55, 0xf0, 0x52, 0xf7, 0x48, 0x0c, 0x8e, 0xbd, 0xee, 0x26, 0x3b, 0xe8,
-  0x70, 0x7a, 0x97, 0xc9, 0x48, 0x64, 0x7d, 0x40, 0x1a, 0x21, 0xcc, 0x2e,
-  0x84, 0xb0, 0x1b, 0xf8, 0xaa, 0x41, 0xe4, 0xa3, 0x43, 0x3d, 0x4c, 0x7c,
-  0xad, 0xdc, 0xa6, 0xdf, 0xf1, 0x2b, 0x32, 0x92, 0x22, 0x57, 0xbd, 0x5d,
-  0x01, 0x94, 0xcc, 0x19, 0x23, 0x9b, 0xdb, 0x49, 0x26, 0xb8, 0x17, 0x41,
-  0xc5, 0x6d, 0xa9, 0x63, 0x8a, 0x49, 0xcf, 0xb2, 0x24, 0x10, 0xb1, 0xfc,
-  0x17, 0x7c, 0x8f, 0x92, 0x38, 0x06, 0xd2, 0xdd, 0x22, 0xd8, 0xbd, 0x0c,
-  0x0b, 0xb5, 0x1a, 0x4a, 0xad, 0x25, 0x34, 0x13, 0x19, 0xd1, 0x85, 0x4c,
-  0x4f, 0xd3, 0xfa, 0x42, 0xaf, 0x7d, 0x5f, 0xaa, 0x87, 0x16, 0x99, 0xcb,
-  0x0d, 0x39, 0x83, 0x49, 0xa7, 0xa9, 0x35, 0xe1, 0x25, 0xa0, 0x8e, 0xb8,
-  0x83, 0xe4, 0x87, 0xc8, 0x5b, 0xcd, 0x23, 0xe4, 0x98, 0x6b, 0x56, 0x09,
-  0xb9, 0x30, 0xd7, 0x63, 0x40, 0x9f, 0x05, 0xa8, 0x00, 0x46, 0x41, 0x20,
-  0xeb, 0x34, 0xf2, 0x6b, 0xb8, 0x95, 0xdc, 0xe8, 0xd2, 0x6d, 0xe4, 0xc6,
-  0xe6, 0x66, 0x05, 0x7b, 0x42, 0x5f, 0x2d, 0xd3, 0x95, 0x28, 0xcb, 0x47,
-  0xfe, 0x5b, 0xd0, 0x54, 0x94, 0xe7, 0xa1, 0xe6, 0x98, 0x9a, 0xbf, 0xa2,
-  0xea, 0xac, 0x4a, 0x16, 0x1d, 0xef, 0x8f, 0xdf, 0x82, 0x6e, 0xdc, 0xbe,
-  0x45, 0x10, 0x56, 0xae, 0x57, 0xf4, 0x28, 0x24, 0xd9, 0xa2, 0xfe, 0x1f,
-  0x25, 0x62, 0xad, 0xcb, 0x45, 0x37, 0x1b, 0x8b, 0x86, 0x40, 0xac, 0x9d,
-  0x0e, 0x80, 0x5f, 0x0a, 0x7f, 0x1f, 0xe0, 0x28, 0x6b, 0xcf, 0xbc, 0x16,
-  0xb9, 0xd9, 0x1d, 0x24, 0x52, 0xa3, 0x92, 0x3c, 0x9b, 0xcc, 0x1e, 0xac,
-  0x05, 0x0d, 0x21, 0xc1, 0x40, 0x56, 0x15, 0x95, 0xfc, 0xcc, 0x6b, 0x86,
-  0x3c, 0x07, 0x6e, 0x4c, 0x6b, 0xcc, 0x9f, 0x62, 0xcc, 0x80, 0x64, 0x4f,
-  0x69, 0x8e, 0x2e, 0xc8, 0x34, 0x1a, 0xad, 0x33, 0x97, 0xa5, 0x33, 0x8d,
-  0xea, 0x7c, 0x80, 0xee, 0x9e, 0xed, 0x56, 0xff, 0x3e, 0x6a, 0xcf, 0x7f,
-  0x1e, 0x70, 0xf5, 0x70, 0x61, 0x6e, 0xf4, 0x76, 0xef, 0x8f, 0x01, 0xf3,
-  0x5f, 0xff, 0xa1, 0x04, 0x4c, 0xa1, 0x39, 0x2d, 0x80, 0xaa, 0x22, 0x8c,
-  0xb1, 0xce, 0x62, 0x0e, 0xe3, 0xbf, 0xb0, 0x94, 0xcc, 0xe2, 0x3a, 0x83,
-  0x8b, 0x0a, 0xa9, 0x71, 0x68, 0xb1, 0x55, 0x0e, 0xc2, 0xb6, 0x81, 0xb1,
-  0x62, 0x8f, 0x6d, 0x47, 0x17, 0xc6, 0x4a, 0xd6, 0x61, 0x4f, 0x97, 0x63,
-  0x24, 0xd8, 0x52, 0xb0, 0xd5, 0x35, 0xc2, 0xba, 0x81, 0x0f, 0x8c, 0xb2,
-  0x8e, 0x35, 0x0a, 0xf2, 0x1a, 0x15, 0xc1, 0xcc, 0xda, 0xb9, 0xb7, 0xb2,
-  0x0a, 0xde, 0xca, 0x2a, 0x16, 0x7a, 0xad, 0x4e, 0x07, 0x6f, 0x14, 0x54,
-  0x18, 0x65, 0x88, 0x7f, 0xe1, 0x31, 0xfc, 0x5d, 0x10, 0x32, 0x85, 0x0b,
-  0xaa, 0xcd, 0x8d, 0x04, 0x86, 0xa1, 0x8d, 0x18, 0x0d, 0x7b, 0x0e, 0x6f,
-  0xc2, 0x60, 0xf4, 0x09, 0x37, 0x2e, 0x09, 0x02, 0xb0, 0x1d, 0xc8, 0x2c,
-  0x4c, 0x57, 0xcc, 0xd3, 0x85, 0x80, 0xa1, 0x29, 0x12, 0x77, 0x92, 0x03,
-  0xd1, 0x44, 0x9d, 0x04, 0x37, 0x3e, 0x2c, 0x10, 0x27, 0xfa, 0x84, 0x16,
-  0xe3, 0x69, 0x91, 0x9b, 0x90, 0x35, 0xae, 0x78, 0x9b, 0xf6, 0x38, 0x83,
-  0x07, 0x4e, 0xce, 0x06, 0x8d, 0x4c, 0x3e, 0x34, 0x58, 0x91, 0x34, 0x88,
-  0x8d, 0xd0, 0xfa, 0xcc, 0xea, 0x52, 0xde, 0x3c, 0x1d, 0x63, 0xda, 0x33,
-  0xaf, 0xc9, 0x25, 0x20, 0xb4, 0xd7, 0x24, 0xfc, 0xc3, 0xa9, 0xb4, 0xe6,
-  0x5a, 0xfe, 0x7a, 0x82, 0x1e, 0x9a, 0x54, 0xd0, 0x50, 0x28, 0x33, 0xc9,
-  0x8c, 0x88, 0xbf, 0xd4, 0xa6, 0x0a, 0x6c, 0x30, 0x7e, 0x3c, 0x91, 0xf4,
-  0xa5, 0xbf, 0xc6, 0xc6, 0x2a, 0xf1, 0x91, 0xda, 0x8d, 0x81, 0x24, 0x12,
-  0xd8, 0x9e, 0x06, 0x7f, 0xe0, 0x85, 0xb0, 0x08, 0xc4, 0xec, 0x8f, 0xd6,
-  0xa4, 0x4f, 0x77, 0xa5, 0x52, 0x3f, 0xb0, 0x6c, 0x7d, 0xa2, 0xab, 0x89,
-  0xce, 0x13, 0xb4, 0x05, 0x49, 0x10, 0x77, 0x33, 0x9b, 0xae, 0xd1, 0x6f,
-  0x47, 0x0f, 0x46, 0x7f, 0x1a, 0x7d, 0x39, 0x7a, 0xa0, 0xca, 0x0a, 0x8f,
-  0x3e, 0x29, 0x37, 0x7f, 0x21, 0x70, 0xc1, 0x69, 0x64, 0x51, 0x6c, 0xa2,
-  0xd0, 0x30, 0xad, 0xca, 0x4b, 0xfa, 0x73, 0xa1, 0x24, 0x60, 0x2c, 0x13,
-  0x0d, 0x73, 0xca, 0x4e, 0x65, 0x94, 0x60, 0x7e, 0x02, 0x13, 0x7b, 0xa6,
-  0x45, 0xab, 0x4a, 0xf0, 0xb8, 0x76, 0x27, 0xce, 0x28, 0x31, 0xc3, 0xd3,
-  0xe2, 0x80, 0xa6, 0x8d, 0x8a, 0x90, 0x4f, 0x95, 0x02, 0x1d, 0x05, 0x5c,
-  0x62, 0x5a, 0x29, 0xe7, 0xc0, 0xff, 0x8b, 0xd9, 0x06, 0x0e, 0xdf, 0x4c,
-  0x46, 0x9f, 0x01, 0xa4, 0x2f, 0xe1, 0xc7, 0x27, 0xa3, 0x4f, 0x61, 0x6a,
-  0x3e, 0x39, 0x7c, 0x3d, 0x19, 0x7d, 0x70, 0xf8, 0xd6, 0xe8, 0x63, 0xf8,
-  0xf3, 0xcd, 0xe4, 0xf0, 0x0d, 0x91, 0x9a, 0x00, 0xcb, 0x3c, 0x1f, 0xbe,
-  0x79, 0xf8, 0xb3, 0xc3, 0x37, 0x44, 0x45, 0x68, 0xcc, 0x4b, 0x30, 0xfa,
-  0x50, 0x60, 0x01, 0xff, 0x7c, 0x68, 0xa5, 0x27, 0xa0, 0x75, 0x63, 0x26,
-  0x51, 0x88, 0x46, 0x74, 0xbe, 0xa7, 0x0d, 0x7d, 0xc1, 0x60, 0x13, 0xea,
-  0xc7, 0xf3, 0x79, 0x24, 0xf0, 0x22, 0xfa, 0x6c, 0x83, 0x7f, 0xe9, 0xf8,
-  0xcb, 0x1c, 0xaf, 0x00, 0x0b, 0x59, 0xee, 0x15, 0x10, 0x12, 0xf0, 0xa4,
-  0xbd, 0x23, 0xb8, 0x49, 0xfd, 0x5d, 0xe1, 0x02, 0x5d, 0x16, 0xf2, 0x21,
-  0x85, 0x02, 0x84, 0xf6, 0x81, 0x17, 0x8a, 0x37, 0xb9, 0xf1, 0x89, 0x59,
-  0xf0, 0x87, 0xc7, 0x05, 0xdd, 0xf1, 0x06, 0xe7, 0x40, 0x5c, 0x16, 0xb7,
-  0xdf, 0xda, 0x8d, 0xee, 0x69, 0x90, 0x94, 0xeb, 0xf1, 0xe1, 0x45, 0x44,
-  0x3a, 0x13, 0x71, 0xb7, 0xa6, 0x0d, 0x72, 0xea, 0xae, 0xc2, 0xfd, 0x0f,
-  0x84, 0x4c, 0xe7, 0x5d, 0x7c, 0x78, 0x13, 0x3c, 0xa1, 0xeb, 0xc6, 0xd1,
-  0xd6, 0x5c, 0xd7, 0x78, 0x23, 0xfd, 0x69, 0xdd, 0x36, 0xa3, 0x05, 0x9a,
-  0x5a, 0x40, 0xec, 0x9c, 0xd3, 0x92, 0x0f, 0x5d, 0x2e, 0x73, 0xc3, 0x97,
-  0xab, 0x41, 0xe9, 0x49, 0x2d, 0x15, 0x35, 0x45, 0x0b, 0x3a, 0xb0, 0x82,
-  0x4a, 0xc8, 0xdb, 0xa8, 0x1c, 0x41, 0x37, 0x15, 0xa9, 0xb7, 0xa5, 0xc2,
-  0x7f, 0xa4, 0x0f, 0x93, 0x7a, 0x16, 0xa9, 0xa0, 0xa1, 0xd2, 0xf3, 0xcd,
-  0x66, 0xc5, 0x46, 0x17, 0x9f, 0x5e, 0xeb, 0xf5, 0x8d, 0xce, 0x57, 0x5b,
-  0x09, 0x8d, 0x11, 0x2c, 0x28, 0x3b, 0x2a, 0x83, 0xe3, 0x94, 0x31, 0xa3,
-  0xdf, 0x5e, 0x01, 0x5e, 0x9b, 0xd6, 0x3c, 0x90, 0x75, 0xab, 0x15, 0x46,
-  0x71, 0xf4, 0x07, 0xe4, 0x6a, 0x4d, 0xe1, 0xde, 0xce, 0xbd, 0xdc, 0x6e,
-  0xbc, 0x2a, 0xcb, 0xb2, 0x97, 0x6d, 0x8f, 0x51, 0x36, 0x58, 0xc7, 0x6e,
-  0xaf, 0x9f, 0x96, 0xfc, 0x02, 0x6d, 0x59, 0x65, 0x91, 0xe1, 0xba, 0xff,
-  0xbc, 0x6f, 0xc2, 0x15, 0xef, 0xc3, 0x07, 0x91, 0x74, 0x4b, 0xb0, 0xaf,
-  0xa2, 0xe5, 0xb5, 0x44, 0x6b, 0xa5, 0x38, 0xeb, 0x9a, 0xb5, 0xa4, 0xdc,
-  0xb5, 0x24, 0x17, 0xb8, 0x2b, 0x16, 0xe7, 0x30, 0xdd, 0x70, 0x21, 0xa9,
-  0x4b, 0x9d, 0x8e, 0x63, 0x23, 0x62, 0x83, 0xb1, 0x34, 0xc9, 0xd2, 0x78,
-  0x28, 0x2e, 0xf2, 0xdb, 0xad, 0x81, 0xca, 0x43, 0xad, 0x8c, 0x86, 0xb9,
-  0x15, 0x54, 0x9f, 0xf6, 0xb4, 0x2b, 0x89, 0x9b, 0x0c, 0x52, 0xe9, 0x54,
-  0x84, 0x3f, 0xe0, 0xb2, 0xa3, 0xb7, 0x16, 0xea, 0x0d, 0xd2, 0x11, 0xad,
-  0xc0, 0x65, 0x23, 0xf3, 0x94, 0x1f, 0x96, 0x3b, 0x41, 0x5f, 0x2a, 0xb8,
-  0x83, 0xbb, 0xe0, 0x0e, 0xb5, 0xbf, 0x6b, 0x6f, 0x29, 0x26, 0x27, 0x17,
-  0x4e, 0x5c, 0x48, 0xf2, 0x5e, 0xab, 0x5f, 0x94, 0x02, 0x09, 0x89, 0xd9,
-  0x1c, 0x19, 0x12, 0x14, 0x0d, 0xea, 0x05, 0xc0, 0xb9, 0xd0, 0x6b, 0x01,
-  0xd5, 0x52, 0xa7, 0x35, 0x52, 0x3d, 0xe1, 0x4b, 0x49, 0x11, 0xe4, 0x80,
-  0x38, 0x66, 0x3a, 0x40, 0x31, 0x4a, 0x09, 0x48, 0x56, 0x07, 0xec, 0xe4,
-  0x2c, 0xbb, 0xa2, 0x39, 0x74, 0xe5, 0xf9, 0x60, 0x3b, 0x5c, 0x9b, 0x1c,
-  0xbc, 0x74, 0x6a, 0x15, 0x02, 0xb6, 0x4f, 0xa9, 0x30, 0x5c, 0x8b, 0x28,
-  0x57, 0xf6, 0xd0, 0x81, 0x48, 0x28, 0x72, 0x6d, 0x9b, 0x11, 0x39, 0x84,
-  0x91, 0x37, 0x58, 0x9f, 0x8b, 0xf0, 0xac, 0x60, 0x00, 0xfb, 0x9a, 0x29,
-  0x99, 0xb6, 0x7b, 0xfb, 0x2f, 0xc0, 0xf5, 0xa2, 0xd7, 0xeb, 0xd6, 0xd6,
-  0x46, 0xef, 0x1f, 0xfe, 0x14, 0xc4, 0xe0, 0x0f, 0x40, 0xfa, 0x7a, 0xb0,
-  0x90, 0x8c, 0x7e, 0x07, 0x7f, 0x7f, 0x29, 0x24, 0xfb, 0x83, 0x64, 0xf4,
-  0x10, 0xa4, 0x2e, 0xca, 0x01, 0x75, 0xf8, 0xb3, 0xd1, 0x9f, 0x40, 0x14,
-  0x03, 0x41, 0x4c, 0xc8, 0x5d, 0x28, 0x9e, 0xbd, 0x41, 0x02, 0x1b, 0xbe,
-  0x82, 0xff, 0x26, 0x87, 0xaf, 0xa3, 0x68, 0x7d, 0x6a, 0x6d, 0x5a, 0x28,
-  0x9b, 0x95, 0x12, 0x9c, 0x6d, 0x2e, 0x5e, 0x18, 0x9a, 0xfb, 0x9a, 0x1d,
-  0x70, 0x1e, 0xa7, 0x86, 0x66, 0xf9, 0x99, 0xc1, 0xb1, 0x21, 0x94, 0x93,
-  0xba, 0x22, 0x86, 0x5e, 0xb4, 0xd3, 0x38, 0x60, 0xc3, 0xbe, 0xa6, 0xd9,
-  0x1c, 0x4f, 0xeb, 0x49, 0x99, 0x32, 0x9e, 0x81, 0x07, 0x46, 0x95, 0xab,
-  0x50, 0x0b, 0x94, 0x53, 0x83, 0x57, 0xca, 0xe4, 0x20, 0x8d, 0x7a, 0x2a,
-  0xd9, 0x2f, 0xb7, 0xf3, 0x59, 0xaa, 0x5f, 0xd7, 0xce, 0xc7, 0xbb, 0x71,
-  0x61, 0x51, 0x3c, 0x3c, 0x6a, 0xa5, 0xfb, 0x3b, 0xb5, 0xca, 0xe8, 0xd7,
-  0x70, 0x23, 0x11, 0xc1, 0x95, 0x74, 0x23, 0x01, 0xf2, 0x02, 0x95, 0x31,
-  0xe2, 0x12, 0x84, 0xdf, 0xc3, 0x9f, 0xa3, 0x60, 0xfc, 0x67, 0x14, 0x86,
-  0xe1, 0xc1, 0x9f, 0x80, 0xc4, 0x1f, 0x81, 0x10, 0xfc, 0x16, 0xfc, 0xf5,
-  0xd9, 0xe8, 0x61, 0x02, 0xef, 0xdf, 0xa0, 0xb6, 0x8f, 0x46, 0x9f, 0xe2,
-  0x5f, 0x28, 0x1b, 0x37, 0x61, 0x0e, 0xe9, 0xc9, 0xc7, 0x94, 0xbb, 0xeb,
-  0x8f, 0x00, 0x10, 0xa4, 0xe5, 0x8b, 0x15, 0x6d, 0xb6, 0x75, 0x34, 0xdd,
-  0x61, 0x55, 0xbd, 0xb3, 0xd2, 0x16, 0xcb, 0xa7, 0xb2, 0xbd, 0x62, 0xc1,
-  0x93, 0xee, 0x3c, 0x76, 0x27, 0xee, 0x89, 0x6e, 0x15, 0x3b, 0x3b, 0x5a,
-  0x69, 0xe7, 0x31, 0x32, 0xac, 0x7a, 0x02, 0x8c, 0xc0, 0x58, 0x8f, 0x8c,
-  0x6a, 0x21, 0xa3, 0xdd, 0x67, 0x40, 0xa7, 0xeb, 0x42, 0xc5, 0xcb, 0xb9,
-  0xea, 0xee, 0xa1, 0x0a, 0x5e, 0x2b, 0xcd, 0x4c, 0x88, 0xa9, 0x79, 0x03,
-  0xee, 0x34, 0x3f, 0xa6, 0x4d, 0x41, 0xf3, 0x7a, 0xf8, 0x36, 0xcd, 0x16,
-  0x4d, 0xe5, 0x4f, 0x29, 0x8a, 0x56, 0xb0, 0x26, 0xcb, 0x6c, 0xaf, 0xd0,
-  0xa2, 0x5c, 0xf7, 0xb5, 0x4a, 0xbc, 0xd2, 0x72, 0x25, 0x88, 0x85, 0xb5,
-  0x93, 0x11, 0x01, 0xe8, 0xf8, 0x63, 0xdc, 0xcf, 0xea, 0xaa, 0x4b, 0x09,
-  0xdd, 0xf0, 0x82, 0x05, 0x6b, 0xe8, 0x1d, 0x44, 0xa2, 0x62, 0xed, 0xd6,
-  0x40, 0x19, 0x15, 0x7f, 0xf1, 0x96, 0xa0, 0xb8, 0xb1, 0xfd, 0xf7, 0xd3,
-  0xf5, 0x5e, 0x6f, 0xa8, 0x0d, 0xfe, 0x07, 0x2c, 0x3e, 0xe2, 0x78, 0x06,
-  0x13, 0xdf, 0xdc, 0x45, 0x9c, 0x53, 0xec, 0xba, 0x90, 0x3b, 0x8e, 0xef,
-  0x5b, 0xe2, 0x18, 0xf1, 0x29, 0x23, 0x47, 0x50, 0x82, 0xc8, 0xd9, 0x24,
-  0x71, 0xdc, 0xad, 0x51, 0xca, 0xc4, 0xbe, 0x13, 0x41, 0x7a, 0xca, 0x9d,
-  0x75, 0x9f, 0x7d, 0xd0, 0x1c, 0xeb, 0x47, 0x87, 0x6f, 0x57, 0x9c, 0xb1,
-  0x86, 0x55, 0x8a, 0xe9, 0xbd, 0x8d, 0xce, 0x5e, 0x5b, 0xda, 0xbc, 0xa4,
-  0x8c, 0xd2, 0x98, 0xb5, 0x44, 0xa8, 0x41, 0xda, 0x96, 0x5a, 0xc9, 0xb8,
-  0x48, 0xae, 0x6a, 0xce, 0xd5, 0x5e, 0x06, 0xae, 0xdc, 0x16, 0x86, 0x24,
-  0xf8, 0x2f, 0x99, 0x7c, 0xbd, 0x2e, 0x44, 0xd0, 0x9f, 0x50, 0x71, 0x49,
-  0x77, 0x2c, 0x3c, 0xcc, 0x98, 0x74, 0x60, 0x8c, 0x9e, 0x4e, 0x97, 0xbb,
-  0x9e, 0x6e, 0xcc, 0x2e, 0x1e, 0x7e, 0x63, 0x63, 0x63, 0x6f, 0x37, 0xa3,
-  0xd8, 0x1f, 0x85, 0x37, 0x08, 0x57, 0xd4, 0xff, 0xa0, 0x66, 0x0e, 0x49,
-  0x14, 0x00, 0xc5, 0x45, 0x72, 0x29, 0x59, 0xc3, 0xf3, 0x5b, 0x1c, 0x7d,
-  0x6b, 0xfc, 0x08, 0x55, 0xa0, 0xea, 0xb2, 0xe5, 0xb3, 0x20, 0x5e, 0x24,
-  0xb5, 0xd8, 0xe1, 0x58, 0xaf, 0x84, 0xdd, 0x37, 0x49, 0x36, 0x59, 0xa0,
-  0xe3, 0x4a, 0xf9, 0xf3, 0x20, 0xb4, 0x05, 0xf1, 0x1f, 0x7d, 0xb4, 0x49,
-  0x0d, 0xdd, 0x02, 0x1b, 0xc2, 0xb4, 0xed, 0x5c, 0xe9, 0x7b, 0x9e, 0xb9,
-  0x56, 0x2a, 0x5e, 0x87, 0xdb, 0xd1, 0x73, 0x87, 0x65, 0x12, 0x5b, 0xa5,
-  0xad, 0x85, 0x75, 0xba, 0xb6, 0xca, 0x01, 0x04, 0x35, 0xd7, 0xa1, 0x87,
-  0x4b, 0x4a, 0xa1, 0x8d, 0x17, 0x78, 0x92, 0xdb, 0xe9, 0xfa, 0x2e, 0x75,
-  0xdc, 0x7e, 0x02, 0x95, 0x58, 0x72, 0x7f, 0x4b, 0xa6, 0x16, 0x99, 0xfe,
-  0x09, 0x3f, 0xd4, 0x72, 0xca, 0x1b, 0xfe, 0xdd, 0xc4, 0x76, 0x72, 0x53,
-  0xb6, 0xf7, 0x90, 0x6b, 0x53, 0x0c, 0x55, 0x89, 0x21, 0xe0, 0xfa, 0x97,
-  0x7f, 0xfc, 0x90, 0x30, 0xfd, 0xcb, 0x3f, 0x7e, 0x51, 0xf1, 0x2f, 0x18,
-  0xc6, 0x2e, 0x23, 0x6f, 0x4c, 0xcc, 0xc7, 0x9a, 0xd2, 0xd9, 0x8b, 0x9f,
-  0xb1, 0x54, 0xac, 0x7a, 0x87, 0xfb, 0x16, 0x45, 0x8b, 0x0d, 0x69, 0x4b,
-  0xcd, 0xd1, 0x7a, 0x31, 0x3e, 0x83, 0x2a, 0xb4, 0x5e, 0xc8, 0xa4, 0x9b,
-  0x00, 0xee, 0x3a, 0xd0, 0xe3, 0x12, 0x7b, 0xcc, 0xac, 0xda, 0x76, 0xeb,
-  0x25, 0xb3, 0xf1, 0x1d, 0x66, 0x73, 0xbd, 0x97, 0x6c, 0xf6, 0xd3, 0x94,
-  0xdc, 0x4e, 0x4d, 0x17, 0xe4, 0x85, 0xd1, 0x55, 0x1e, 0x31, 0xa7, 0x72,
-  0x0f, 0x15, 0x81, 0x9d, 0xaa, 0x10, 0x5b, 0x78, 0xad, 0x31, 0x25, 0x21,
-  0xf6, 0x95, 0xa3, 0x4f, 0x9c, 0xe7, 0x2a, 0xa8, 0x75, 0x4e, 0x88, 0x9d,
-  0xd6, 0x3d, 0x11, 0xdf, 0x11, 0x34, 0x40, 0xf5, 0xe1, 0x76, 0xbf, 0x91,
-  0xd6, 0x6a, 0xd0, 0x4a, 0xb9, 0x25, 0x21, 0x2b, 0x79, 0xb1, 0x35, 0xdc,
-  0x06, 0xe6, 0x72, 0x8f, 0x3d, 0x6f, 0x8a, 0xfc, 0xa4, 0x33, 0xf5, 0xe9,
-  0x44, 0x14, 0x32, 0x56, 0x28, 0x09, 0xdb, 0x90, 0xe8, 0xe6, 0xd9, 0x64,
-  0x56, 0x06, 0xf2, 0xcb, 0x77, 0xf6, 0x5d, 0x2c, 0x50, 0xe4, 0xde, 0x2a,
-  0x98, 0x5b, 0xc6, 0xb6, 0xa9, 0x07, 0xe9, 0x98, 0x37, 0x43, 0x82, 0x96,
-  0x1c, 0xa5, 0x78, 0x55, 0xe1, 0x26, 0x11, 0xf1, 0x88, 0x15, 0x3b, 0xaf,
-  0x24, 0x98, 0xce, 0xad, 0x6e, 0x63, 0x2f, 0x6e, 0x7b, 0x7c, 0x71, 0x2c,
-  0xc6, 0x0e, 0x43, 0x21, 0xb0, 0xab, 0x2f, 0x8b, 0xcf, 0xe8, 0x48, 0x05,
-  0x72, 0x3d, 0xdb, 0xea, 0x04, 0xca, 0xb5, 0x1b, 0x36, 0x90, 0xdc, 0xf6,
-  0x67, 0x8e, 0x87, 0xc2, 0x18, 0x3c, 0x45, 0x75, 0xca, 0x4a, 0x88, 0x88,
-  0x4c, 0x51, 0x04, 0xd4, 0xdc, 0x9e, 0xe4, 0x83, 0x26, 0x10, 0xb3, 0xd7,
-  0xe9, 0xc0, 0x2d, 0xb8, 0xf7, 0x9d, 0x2c, 0xdd, 0x07, 0xa1, 0x67, 0x3d,
-  0xdd, 0x6e, 0xbd, 0x9a, 0xf5, 0xfa, 0xc0, 0x42, 0x06, 0x3b, 0x20, 0xf6,
-  0x6c, 0xc3, 0x46, 0x20, 0xee, 0x02, 0x0f, 0x84, 0x3f, 0x4a, 0x45, 0x87,
-  0x27, 0xf9, 0xdc, 0x40, 0x75, 0xcf, 0x5d, 0x3a, 0xd1, 0x75, 0x7b, 0xc6,
-  0x0d, 0xbf, 0x77, 0x3c, 0x53, 0x08, 0xaf, 0xa3, 0x79, 0x76, 0x30, 0x47,
-  0x04, 0x19, 0x47, 0xa4, 0x32, 0xb5, 0x98, 0x3b, 0xba, 0x7c, 0x83, 0x55,
-  0x70, 0x58, 0x92, 0x2e, 0xf3, 0x2e, 0xd1, 0x4b, 0x90, 0xe1, 0xed, 0xa0,
-  0x1c, 0x66, 0x3e, 0x63, 0x08, 0x16, 0x05, 0x02, 0x02, 0xf3, 0x1f, 0xc4,
-  0x15, 0xdb, 0xdb, 0x0c, 0xc9, 0x0a, 0x75, 0x36, 0xe8, 0x53, 0x61, 0x89,
-  0xa0, 0xce, 0x34, 0x8f, 0x74, 0x74, 0xef, 0x66, 0x5d, 0xc7, 0x73, 0x4b,
-  0xbe, 0x68, 0xcc, 0xda, 0x23, 0xe4, 0xc6, 0xf0, 0xa3, 0x1e, 0x0f, 0xa2,
-  0x10, 0x53, 0x81, 0x95, 0xdc, 0xba, 0xab, 0x86, 0x5b, 0x87, 0xc2, 0x8d,
-  0xe2, 0x5b, 0x91, 0x8f, 0x82, 0x12, 0x51, 0x88, 0x0d, 0x6c, 0x4d, 0xcf,
-  0x93, 0x7d, 0x96, 0x9c, 0x10, 0x83, 0x0f, 0x1d, 0x3d, 0x72, 0x05, 0x81,
-  0x70, 0xa6, 0xd9, 0xbd, 0x62, 0xbb, 0xc6, 0xf6, 0x1d, 0xe2, 0xf2, 0x3c,
-  0x8e, 0x60, 0x3a, 0xc2, 0xa4, 0x1d, 0x06, 0x2d, 0x99, 0x33, 0x32, 0x66,
-  0x55, 0xd6, 0x1c, 0x1d, 0x8a, 0x38, 0x75, 0x65, 0xe5, 0x16, 0xad, 0xf0,
-  0x58, 0xe0, 0x0c, 0x5d, 0xe9, 0x3e, 0xac, 0x87, 0x4a, 0x4d, 0x62, 0x62,
-  0xf3, 0x0e, 0x72, 0x56, 0xd2, 0xdf, 0x58, 0xfa, 0xe3, 0x61, 0xe9, 0xa8,
-  0x36, 0x71, 0x7d, 0x37, 0x05, 0xa9, 0x90, 0xed, 0x4a, 0x56, 0x92, 0x18,
-  0x26, 0x6c, 0x71, 0x14, 0xa6, 0x81, 0x89, 0xd7, 0x51, 0x22, 0x7f, 0x35,
-  0x47, 0x73, 0x73, 0xc0, 0x7c, 0x1a, 0xb1, 0xb7, 0x53, 0x4b, 0xbc, 0x87,
-  0xf1, 0xb4, 0xcf, 0xff, 0x01, 0x94, 0xcf, 0x46, 0xa3, 0x5c, 0x8c, 0x77,
-  0xae, 0xf6, 0x19, 0xd1, 0x96, 0xca, 0xe7, 0xbf, 0x5e, 0xdd, 0x73, 0x3f,
-  0x20, 0xbd, 0xb2, 0x5f, 0xcc, 0xd6, 0x29, 0x85, 0x44, 0x7d, 0x54, 0x3a,
-  0x06, 0xf3, 0x25, 0x38, 0x10, 0x18, 0x65, 0x7d, 0xcd, 0xbc, 0x67, 0xd3,
-  0x5e, 0x62, 0xa4, 0xe2, 0x4d, 0xd8, 0x28, 0xd5, 0x9f, 0x12, 0xd9, 0xbc,
-  0xb5, 0x09, 0xad, 0xe9, 0x37, 0x35, 0x75, 0xf2, 0x98, 0x94, 0x13, 0x9a,
-  0xac, 0x44, 0x0f, 0xc7, 0x5f, 0xe4, 0xe1, 0x05, 0x7e, 0xac, 0x25, 0x9e,
-  0xbf, 0xbc, 0x8f, 0xbf, 0xc0, 0xf3, 0x16, 0xf7, 0xf1, 0x96, 0x77, 0xce,
-  0xd2, 0x3e, 0xc6, 0xe2, 0xce, 0x5b, 0xd8, 0x25, 0x97, 0x76, 0x64, 0x71,
-  0x8f, 0xbf, 0xbc, 0x4b, 0x2d, 0xf0, 0xdc, 0x25, 0xce, 0x6c, 0x17, 0x46,
-  0x28, 0xb9, 0x83, 0x8a, 0xd9, 0x5e, 0x77, 0x13, 0x44, 0xbd, 0x21, 0x88,
-  0x0e, 0x1b, 0xf2, 0x4f, 0x59, 0x10, 0xe9, 0xae, 0x65, 0xad, 0x50, 0xcd,
-  0x8c, 0x98, 0xc9, 0x3f, 0x56, 0xec, 0x5e, 0x24, 0x0c, 0xa8, 0x50, 0x44,
-  0x88, 0x7a, 0x67, 0x02, 0x5e, 0xbe, 0xd7, 0xad, 0x80, 0xb4, 0xe3, 0x74,
-  0x13, 0x96, 0xca, 0xfe, 0x66, 0x21, 0x08, 0xe8, 0xe6, 0x3d, 0x08, 0x54,
-  0xb3, 0x6c, 0xb0, 0xb7, 0xb1, 0x91, 0x0e, 0x06, 0x9b, 0x70, 0xea, 0xde,
-  0x9f, 0xbc, 0x3d, 0x80, 0x8c, 0x5b, 0x0b, 0x86, 0x1c, 0xac, 0xfa, 0x10,
-  0x08, 0x72, 0x83, 0x21, 0x97, 0xad, 0x0f, 0x8a, 0x64, 0x81, 0x4e, 0xa7,
-  0xb5, 0x3b, 0x50, 0x52, 0x8a, 0xd0, 0x4e, 0x1b, 0x53, 0xb5, 0x83, 0xb4,
-  0x68, 0x6b, 0x74, 0xe9, 0x3c, 0x58, 0xf1, 0x60, 0xaa, 0xf4, 0x75, 0x24,
-  0xa7, 0xd3, 0x49, 0x28, 0x38, 0x4f, 0x54, 0x0b, 0xc9, 0x14, 0xa8, 0xb8,
-  0x50, 0x23, 0xca, 0x47, 0xe9, 0xd6, 0x90, 0xab, 0x62, 0x2d, 0x19, 0xb2,
-  0xe9, 0xaa, 0x2b, 0xe3, 0xb3, 0xc0, 0x68, 0xa7, 0x3d, 0x8e, 0x06, 0x51,
-  0x0a, 0x70, 0x8f, 0x07, 0x2b, 0x14, 0x28, 0xf1, 0xaa, 0x1a, 0x4f, 0x31,
-  0xef, 0xa7, 0x41, 0x29, 0x17, 0x08, 0xdf, 0xf3, 0x61, 0xb1, 0xd4, 0x72,
-  0x0b, 0xda, 0x6e, 0x42, 0xae, 0x1f, 0x13, 0xb0, 0xdb, 0xe4, 0xad, 0x56,
-  0x67, 0xc3, 0x29, 0xf3, 0xae, 0xc0, 0xa7, 0x23, 0xb6, 0x65, 0x38, 0x52,
-  0xd4, 0xf0, 0x64, 0x36, 0x1d, 0x70, 0xcc, 0xdc, 0xc6, 0x4a, 0xd9, 0x52,
-  0x3a, 0xd7, 0xde, 0x29, 0xba, 0x35, 0xcf, 0x63, 0xd6, 0x11, 0x1b, 0x9a,
-  0xf3, 0x63, 0x74, 0x25, 0xb7, 0xf8, 0x37, 0xb2, 0xed, 0x9c, 0xfb, 0x5d,
-  0xb9, 0xc8, 0x1f, 0x71, 0x04, 0xea, 0xe3, 0x90, 0x0b, 0x9e, 0x14, 0xaa,
-  0xb6, 0x14, 0x8b, 0xac, 0xb7, 0xee, 0x71, 0xc2, 0x2b, 0x3e, 0x16, 0xc1,
-  0x81, 0x80, 0x1c, 0x7d, 0x26, 0x0b, 0x96, 0x51, 0x74, 0xb9, 0x03, 0x7f,
-  0xdc, 0x35, 0xb7, 0x36, 0x87, 0x32, 0xc2, 0xbd, 0x80, 0x65, 0x6f, 0xb1,
-  0x3e, 0xe3, 0x31, 0x66, 0xb3, 0x56, 0xb6, 0x16, 0x97, 0x88, 0x18, 0x07,
-  0xf3, 0xbd, 0xae, 0x31, 0x05, 0x91, 0x76, 0x2a, 0x59, 0xbf, 0x0f, 0xc4,
-  0x64, 0x59, 0x88, 0x12, 0x1b, 0xba, 0x22, 0xa5, 0xca, 0xce, 0x13, 0x02,
-  0xfa, 0x97, 0xd7, 0xff, 0x20, 0x33, 0x3b, 0x1d, 0x00, 0x28, 0x27, 0xa9,
-  0x8b, 0x0b, 0x90, 0xee, 0xde, 0x40, 0x19, 0x24, 0xdc, 0x41, 0x52, 0x93,
-  0x24, 0xaa, 0x5b, 0xc5, 0x8d, 0x23, 0x3d, 0x38, 0x9f, 0x68, 0xb4, 0x9d,
-  0xb2, 0xd9, 0x56, 0x7f, 0xe8, 0x10, 0x15, 0xe8, 0xed, 0xae, 0xad, 0xd4,
-  0x53, 0xe1, 0x7d, 0x21, 0xf9, 0x41, 0x6a, 0xc6, 0xee, 0x28, 0xb5, 0x45,
-  0xe5, 0xee, 0xa2, 0xa3, 0x34, 0xbb, 0x43, 0x3a, 0x07, 0x4f, 0x56, 0xf1,
-  0x6c, 0x93, 0xc2, 0xcd, 0x4d, 0x2f, 0x26, 0x11, 0x40, 0xcf, 0xe2, 0xa6,
-  0xc5, 0x83, 0x26, 0xa2, 0x28, 0x9a, 0xde, 0x99, 0xb9, 0xab, 0xf4, 0x62,
-  0x49, 0xe5, 0xca, 0x37, 0x6f, 0xcd, 0xce, 0x56, 0x16, 0xa3, 0x6d, 0x67,
-  0xed, 0xb6, 0x73, 0x73, 0x39, 0x6d, 0xe7, 0x58, 0xdb, 0xeb, 0xb7, 0x2e,
-  0xe7, 0xb4, 0x9c, 0x67, 0x2d, 0x6f, 0xdd, 0xb8, 0x7d, 0xf9, 0x9b, 0x2f,
-  0x7f, 0xe3, 0xfa, 0x95, 0x9c, 0xf6, 0x67, 0x58, 0xfb, 0x4b, 0xd7, 0x2f,
-  0x7d, 0xfb, 0xc6, 0x37, 0x2a, 0x2c, 0xbe, 0xb3, 0x72, 0xbb, 0xfb, 0x4a,
-  0xb7, 0xb7, 0xdf, 0x75, 0xd2, 0x4c, 0x0c, 0x38, 0x6d, 0xd0, 0xff, 0x8f,
-  0xd1, 0x67, 0x9a, 0x36, 0x23, 0x3e, 0x90, 0x94, 0xf2, 0xfa, 0xc4, 0x29,
-  0x96, 0x93, 0x13, 0xf8, 0x0f, 0xcd, 0xd6, 0x60, 0x3f, 0x1b, 0x6e, 0x6c,
-  0x27, 0x35, 0x0e, 0x8a, 0xd6, 0x1a, 0xe6, 0xaf, 0x92, 0x94, 0x5d, 0xd0,
-  0x19, 0x45, 0xfd, 0x59, 0x70, 0x9c, 0x7c, 0xd6, 0x41, 0x30, 0x7b, 0x65,
-  0xd1, 0x86, 0x00, 0xf4, 0x8e, 0x43, 0x98, 0x2d, 0x84, 0x80, 0xb3, 0x10,
-  0xff, 0x7e, 0xae, 0xf0, 0x7b, 0x33, 0x37, 0x71, 0x28, 0xf3, 0x85, 0x50,
-  0xe4, 0x8c, 0xc5, 0x41, 0x9c, 0x89, 0x82, 0x38, 0x70, 0x57, 0x3b, 0x85,
-  0xab, 0x44, 0x6c, 0xf1, 0x02, 0x9a, 0x6d, 0x8c, 0xf7, 0xb5, 0xb2, 0x02,
-  0x42, 0x54, 0xb1, 0x26, 0xed, 0xf1, 0x52, 0x91, 0xb3, 0x9c, 0x38, 0x5e,
-  0xfd, 0x5c, 0xd5, 0x89, 0x9c, 0x8e, 0xa0, 0xad, 0xb4, 0x03, 0xf0, 0x64,
-  0x26, 0x8b, 0xb2, 0x56, 0x7e, 0x86, 0x3c, 0x33, 0xf3, 0x0f, 0xe4, 0x5a,
-  0x5c, 0x56, 0x54, 0x13, 0x22, 0x43, 0xdb, 0x32, 0xf5, 0x3b, 0x43, 0xa3,
-  0x0f, 0x85, 0x3b, 0x79, 0x91, 0x99, 0x5f, 0x61, 0x6f, 0x14, 0xfb, 0xf4,
-  0x9d, 0x88, 0xfd, 0xf7, 0xec, 0xfd, 0x78, 0xe0, 0xe0, 0x5b, 0x76, 0x20,
-  0x01, 0xf7, 0x13, 0xac, 0x5f, 0xbc, 0xc1, 0x03, 0xa0, 0xce, 0xcf, 0x22,
-  0xee, 0x0d, 0xf0, 0x1a, 0xb7, 0xe3, 0x0b, 0xaf, 0x80, 0x3b, 0xa3, 0x5f,
-  0x8d, 0x7e, 0x31, 0xfa, 0xed, 0xe8, 0xdf, 0x46, 0x7f, 0xb8, 0x5b, 0xb1,
-  0xdc, 0xdb, 0xc2, 0xde, 0x00, 0x0a, 0xbb, 0x72, 0x2e, 0x01, 0x4c, 0x93,
-  0x1b, 0xf4, 0x06, 0x90, 0x35, 0x9d, 0x87, 0x1b, 0xa2, 0x20, 0xde, 0x77,
-  0xb2, 0x41, 0xb6, 0x9e, 0x75, 0xb2, 0x61, 0xc0, 0x2f, 0x40, 0x2c, 0xd6,
-  0x82, 0xac, 0xfb, 0x6b, 0x62, 0x8e, 0x1a, 0xd8, 0x38, 0x28, 0x3d, 0x77,
-  0x55, 0x57, 0x25, 0x80, 0x40, 0x5b, 0x59, 0x05, 0xcf, 0xcd, 0x74, 0x45,
-  0x99, 0xee, 0x0c, 0x3e, 0x20, 0x2f, 0x6b, 0xb8, 0xdc, 0x6a, 0x63, 0x9a,
-  0x70, 0x3f, 0x4f, 0xe4, 0x08, 0x4c, 0x93, 0xab, 0x3e, 0xcc, 0xcf, 0x4d,
-  0xe3, 0x1c, 0x85, 0x39, 0x5f, 0x31, 0xe9, 0xdb, 0xcf, 0x55, 0x22, 0xe8,
-  0x7d, 0x65, 0x7b, 0xf8, 0xb8, 0xe8, 0xdd, 0x56, 0x5d, 0x95, 0x00, 0x02,
-  0x6d, 0x4b, 0xd3, 0x5b, 0xc3, 0x2d, 0xa6, 0xb7, 0x38, 0x05, 0x50, 0x6e,
-  0x8b, 0xbe, 0x07, 0x1e, 0x6f, 0x66, 0x44, 0x83, 0x1e, 0x6b, 0x46, 0x72,
-  0xbe, 0xca, 0x9d, 0x91, 0x40, 0x6a, 0x9f, 0x63, 0xe7, 0x41, 0x90, 0x7c,
-  0x2f, 0x90, 0x08, 0x41, 0x54, 0x3c, 0x0a, 0x45, 0x47, 0x94, 0x49, 0xf5,
-  0xe4, 0x67, 0x28, 0x5a, 0x74, 0x13, 0x23, 0xb9, 0xd9, 0x2a, 0x31, 0x80,
-  0xfa, 0x4a, 0xf6, 0x2a, 0xcb, 0x05, 0x15, 0x4b, 0xfa, 0x84, 0x2d, 0x4d,
-  0x72, 0x47, 0x71, 0xb3, 0xa7, 0x6f, 0xb9, 0xec, 0x2b, 0x1f, 0x05, 0x32,
-  0x2c, 0x50, 0x71, 0xbf, 0xd0, 0xb8, 0x97, 0xad, 0xac, 0x09, 0xbc, 0x0a,
-  0x08, 0xd3, 0x4e, 0xc9, 0x2f, 0x2f, 0x4f, 0x80, 0xba, 0x2e, 0xa8, 0x3a,
-  0x53, 0x37, 0xb9, 0xef, 0xca, 0xa6, 0xa3, 0x90, 0xdf, 0x05, 0xf2, 0x51,
-  0xc8, 0x37, 0xc1, 0x84, 0x14, 0xb9, 0xbd, 0x8d, 0x9d, 0x97, 0x62, 0xf4,
-  0x7b, 0xf2, 0xcd, 0x43, 0x2f, 0xd1, 0xd7, 0x0f, 0xdf, 0x26, 0x87, 0xea,
-  0x84, 0xe2, 0x12, 0x95, 0x1b, 0x29, 0x79, 0xee, 0xe5, 0xa5, 0xa8, 0xc8,
-  0xcb, 0x46, 0x61, 0x52, 0xaa, 0x95, 0xf6, 0xae, 0x94, 0xc3, 0x3b, 0x99,
-  0x7c, 0x14, 0x6a, 0xa5, 0x3b, 0x09, 0x29, 0x62, 0xe4, 0xd7, 0x17, 0x53,
-  0x25, 0xdb, 0x86, 0x6f, 0xa6, 0x9d, 0xac, 0xfb, 0x8a, 0x3c, 0xf2, 0x73,
-  0xa4, 0x9f, 0x6e, 0x5b, 0xb9, 0xc8, 0x4b, 0x5f, 0x06, 0x4f, 0xf0, 0x70,
-  0xef, 0xba, 0x1c, 0xee, 0x45, 0xfe, 0x8b, 0xd4, 0xc1, 0x0b, 0x49, 0xf5,
-  0xfa, 0xe9, 0x4b, 0x55, 0xfe, 0x99, 0xa4, 0xfa, 0x2d, 0x7d, 0x1d, 0x0e,
-  0x5f, 0x61, 0x2c, 0xbf, 0xfe, 0x95, 0xeb, 0xdf, 0xb9, 0xf4, 0xed, 0x95,
-  0x2b, 0x2f, 0xaf, 0x5e, 0xbd, 0xbe, 0x7a, 0xe3, 0xa5, 0x97, 0xe1, 0xc7,
-  0xed, 0xab, 0x28, 0xe4, 0x9d, 0x3f, 0x7f, 0xce, 0x48, 0x2a, 0xc4, 0x57,
-  0x45, 0x65, 0x1a, 0xb9, 0xa4, 0xad, 0xc0, 0x80, 0x6d, 0x1c, 0xb7, 0xd5,
-  0xb9, 0xcd, 0xa1, 0x43, 0xaf, 0xe8, 0xc2, 0xc3, 0xe3, 0x03, 0xb6, 0x87,
-  0xcc, 0xb1, 0x43, 0x65, 0x6d, 0xdc, 0xd9, 0xfd, 0x4e, 0xab, 0x43, 0x73,
-  0x87, 0x5c, 0xbe, 0xb7, 0xa9, 0x88, 0x26, 0x21, 0x7e, 0xc7, 0x84, 0xab,
-  0x76, 0xf7, 0x76, 0xd6, 0x61, 0x3a, 0xc9, 0xa7, 0x3d, 0x1b, 0x5c, 0x6f,
-  0x5d, 0xaf, 0x05, 0x9a, 0xca, 0x54, 0xfb, 0x3e, 0x88, 0xe5, 0x20, 0x1d,
-  0x6c, 0x0b, 0xc0, 0xf6, 0xde, 0x4e, 0xd6, 0x86, 0x43, 0x35, 0x8c, 0x11,
-  0x7b, 0x5b, 0x88, 0x92, 0xd5, 0x96, 0xe3, 0x64, 0x03, 0x89, 0x21, 0x65,
-  0x25, 0xe6, 0x55, 0x14, 0x02, 0x20, 0x16, 0x82, 0x9c, 0xbf, 0xda, 0xd3,
-  0x07, 0xe2, 0x66, 0x80, 0x04, 0xcd, 0x61, 0xef, 0x5a, 0x76, 0x2f, 0x6d,
-  0xd7, 0x66, 0xeb, 0x07, 0xff, 0xfe, 0xe0, 0x72, 0x72, 0x3a, 0xd1, 0xcd,
-  0x2c, 0xac, 0x78, 0xbb, 0xaf, 0xad, 0x05, 0x4a, 0xef, 0x69, 0x94, 0x8e,
-  0x89, 0x41, 0x08, 0xf6, 0xd8, 0x23, 0x2c, 0x8f, 0x7a, 0x0c, 0x56, 0xa5,
-  0x71, 0xba, 0x51, 0x71, 0x4e, 0x19, 0xcb, 0x7c, 0x67, 0x84, 0x94, 0xc7,
-  0xbd, 0x3c, 0xad, 0x23, 0xd4, 0x14, 0x55, 0x34, 0xdb, 0xcc, 0x96, 0x49,
-  0x8f, 0x3b, 0x0f, 0xd6, 0x4c, 0x78, 0x7d, 0x99, 0x1b, 0x6d, 0x70, 0xc7,
-  0xcb, 0xab, 0xea, 0x31, 0xb0, 0x99, 0xa9, 0x1f, 0xf8, 0xa8, 0x1c, 0x67,
-  0x6c, 0x6b, 0x81, 0x4a, 0x87, 0xe3, 0xaf, 0x85, 0x29, 0x4b, 0xd6, 0xa2,
-  0xab, 0x66, 0xe9, 0xec, 0x44, 0xa6, 0x7d, 0x61, 0x7a, 0x22, 0xd6, 0x34,
-  0x92, 0x9f, 0x28, 0xd2, 0x4a, 0x3e, 0x12, 0xd5, 0x35, 0x88, 0x1e, 0xea,
-  0xc9, 0x57, 0x9c, 0xd2, 0x48, 0x9c, 0x4d, 0x96, 0x07, 0xf2, 0x57, 0x94,
-  0xcf, 0x47, 0xd2, 0xc5, 0x55, 0x07, 0x73, 0xd1, 0xa8, 0x74, 0x0a, 0x1f,
-  0x23, 0xb0, 0xca, 0xf4, 0x3d, 0x0d, 0x0d, 0x5f, 0xd1, 0xdd, 0x24, 0x6c,
-  0x70, 0x13, 0xfd, 0x88, 0xe4, 0x4d, 0x6e, 0x73, 0x4a, 0x86, 0xc4, 0x36,
-  0x94, 0x78, 0xc0, 0x56, 0xe6, 0x63, 0xcd, 0x09, 0x24, 0xa6, 0x6d, 0xc2,
-  0x49, 0x81, 0xc6, 0x01, 0x3a, 0x46, 0x56, 0xa0, 0x22, 0xb0, 0xd1, 0xb4,
-  0x40, 0x8e, 0xfc, 0x3d, 0x5e, 0x5e, 0x20, 0xa1, 0x86, 0x51, 0x98, 0x93,
-  0x2a, 0xb3, 0x12, 0xcd, 0x40, 0x63, 0x67, 0x24, 0x90, 0x2b, 0x47, 0x66,
-  0x91, 0xb6, 0x92, 0x12, 0xc8, 0x55, 0x91, 0x0d, 0x6e, 0xeb, 0xf4, 0xc2,
-  0x7e, 0x66, 0x02, 0x96, 0xf4, 0x43, 0xea, 0x04, 0x68, 0x5c, 0xe8, 0xe3,
-  0x99, 0xf6, 0x87, 0xf7, 0xf5, 0x55, 0xaf, 0xa9, 0x20, 0x5b, 0xf0, 0xaa,
-  0x32, 0x09, 0x88, 0x84, 0x59, 0x5f, 0x8c, 0xb9, 0x89, 0x56, 0xa2, 0xa9,
-  0xab, 0x06, 0x70, 0x2e, 0x8b, 0xdb, 0x99, 0xbb, 0x22, 0x9d, 0xa4, 0x07,
-  0x5f, 0x61, 0xf6, 0x24, 0x49, 0xe4, 0xc7, 0x91, 0x3e, 0x29, 0xd3, 0x4a,
-  0x55, 0x21, 0x8f, 0x07, 0x95, 0xac, 0x7e, 0xa8, 0x35, 0x5a, 0xf3, 0xae,
-  0x33, 0x95, 0x56, 0xf0, 0x60, 0x7f, 0xec, 0x49, 0x97, 0x94, 0xfe, 0x0c,
-  0x28, 0xe3, 0xa7, 0xb2, 0xf9, 0x90, 0x02, 0x0c, 0x31, 0xb6, 0x0f, 0x18,
-  0xa6, 0x66, 0x9b, 0xa3, 0x07, 0x63, 0xa4, 0x60, 0x0a, 0xc2, 0x37, 0x19,
-  0x85, 0xc2, 0x5c, 0xda, 0xcf, 0xbe, 0x44, 0x08, 0xfd, 0x19, 0xfa, 0x7e,
-  0x88, 0xb1, 0x67, 0x87, 0xaf, 0x4f, 0x27, 0xa3, 0xf7, 0x28, 0x55, 0xcb,
-  0x4f, 0xe0, 0xc9, 0x67, 0xc9, 0xe1, 0x5b, 0xa3, 0xcf, 0x47, 0x0f, 0x0f,
-  0xff, 0xfe, 0xf0, 0xed, 0x49, 0xe5, 0x63, 0x92, 0x78, 0xd3, 0xa0, 0x38,
-  0x61, 0x64, 0x4a, 0x9a, 0xa2, 0xbc, 0x3e, 0xe1, 0xcf, 0x4b, 0xa5, 0x66,
-  0x32, 0xcb, 0xcb, 0x56, 0x4d, 0x17, 0x66, 0x67, 0x12, 0xea, 0x5e, 0x93,
-  0x9f, 0xc9, 0xbe, 0x8a, 0xd2, 0x1a, 0x63, 0x4d, 0x42, 0x09, 0x77, 0x14,
-  0x0c, 0x91, 0x75, 0xe9, 0xab, 0x4c, 0xb3, 0x14, 0xd2, 0x55, 0x02, 0xf5,
-  0xff, 0x00, 0xb3, 0xfd, 0xe7, 0x92, 0xb4, 0xb7, 0xbf, 0x2d, 0x97, 0x4e,
-  0xc9, 0x5c, 0xad, 0x73, 0x32, 0x29, 0x15, 0x24, 0x4f, 0x92, 0x37, 0x64,
-  0xeb, 0x74, 0xb7, 0xee, 0xce, 0x01, 0xc2, 0xd3, 0x9b, 0x52, 0xf9, 0x93,
-  0xc4, 0x25, 0x3b, 0x02, 0x1d, 0xdf, 0x84, 0xa1, 0xcf, 0xcd, 0x95, 0x82,
-  0x8e, 0x2c, 0x28, 0x04, 0x9b, 0x9e, 0x07, 0x20, 0xc3, 0xf3, 0x52, 0x70,
-  0xd9, 0x3d, 0x22, 0x00, 0x9d, 0xbd, 0x0d, 0xf4, 0xa1, 0xdf, 0x96, 0xea,
-  0x49, 0x5e, 0x49, 0x42, 0xdd, 0xa8, 0x57, 0x81, 0x3e, 0xc4, 0xab, 0x23,
-  0xe6, 0x99, 0xb2, 0x55, 0x9a, 0x21, 0x53, 0x44, 0x28, 0xf7, 0x93, 0x7d,
-  0x1c, 0x14, 0xa6, 0x7e, 0x2a, 0xb1, 0x7f, 0xa2, 0xbb, 0x68, 0x90, 0xf6,
-  0xb3, 0x56, 0xa7, 0xd1, 0xe7, 0xd9, 0x8b, 0xe8, 0x51, 0xf2, 0x52, 0x52,
-  0x1b, 0xbd, 0x3f, 0xfa, 0xa2, 0xbe, 0x10, 0x2c, 0xde, 0xe4, 0xb1, 0x75,
-  0x71, 0xdf, 0xb5, 0x18, 0xbb, 0x0f, 0xdb, 0x63, 0xee, 0xa2, 0xc9, 0xcb,
-  0x7d, 0xe4, 0xec, 0x73, 0x33, 0xf0, 0x7f, 0x2e, 0x73, 0xa7, 0x87, 0x95,
-  0xb1, 0xea, 0x68, 0x8d, 0x47, 0x80, 0xe1, 0x76, 0xda, 0xdf, 0x01, 0x86,
-  0x0a, 0x7f, 0x72, 0x22, 0xdc, 0xd2, 0x8f, 0x27, 0x40, 0x88, 0x70, 0x1f,
-  0x1e, 0x31, 0x4c, 0x33, 0x41, 0x90, 0xd9, 0x10, 0x41, 0x66, 0x8b, 0x09,
-  0x52, 0x98, 0x4e, 0x8a, 0xdd, 0x1a, 0xa3, 0xf9, 0xa4, 0x22, 0x6d, 0x4a,
-  0x25, 0x94, 0x32, 0xdf, 0xf2, 0xd4, 0x17, 0x9e, 0x1e, 0x3b, 0x2f, 0xb1,
-  0x94, 0x9f, 0x45, 0xc8, 0xe3, 0xbf, 0x32, 0xd0, 0xc8, 0xf6, 0x19, 0x98,
-  0x98, 0x79, 0x50, 0x46, 0x6c, 0xb8, 0xf6, 0xc0, 0xb8, 0xc5, 0x4e, 0x3b,
-  0x2f, 0x70, 0x55, 0x4c, 0x2c, 0x83, 0x90, 0xef, 0x9d, 0x25, 0x86, 0xe7,
-  0x64, 0xf2, 0x97, 0xea, 0x74, 0x9d, 0xe2, 0x43, 0xfe, 0xf6, 0x73, 0xf9,
-  0xaf, 0xda, 0xf7, 0x17, 0x96, 0xe6, 0xdc, 0x7e, 0x33, 0x66, 0x36, 0x7f,
-  0xe9, 0xc0, 0x71, 0xc4, 0x74, 0xfe, 0xb2, 0xeb, 0xfc, 0x7c, 0xfe, 0xd2,
-  0x2e, 0x6f, 0x12, 0xfa, 0xb3, 0x31, 0xb2, 0x8c, 0xfe, 0x06, 0x16, 0xa5,
-  0xf4, 0x77, 0xae, 0xcc, 0xd3, 0x89, 0xd6, 0x74, 0x47, 0x53, 0xfb, 0xaf,
-  0xea, 0x8e, 0x7c, 0x62, 0x7a, 0xc9, 0xfd, 0xb5, 0xe7, 0x8a, 0xdf, 0x3d,
-  0x4b, 0xef, 0xbf, 0x6a, 0x63, 0x11, 0xca, 0xf2, 0xbf, 0xaa, 0x9d, 0x88,
-  0xc6, 0x4e, 0xf3, 0x2f, 0x29, 0x13, 0xc9, 0xf3, 0xef, 0xf4, 0x3d, 0x66,
-  0x5a, 0xfc, 0x55, 0x5b, 0xfe, 0xf3, 0xd6, 0x8b, 0x36, 0x52, 0x1c, 0x21,
-  0x2d, 0xbe, 0xc4, 0x3b, 0x0f, 0xd9, 0x85, 0x44, 0x18, 0x39, 0x76, 0xa3,
-  0x65, 0x00, 0x6c, 0x34, 0xec, 0x74, 0xf8, 0xce, 0xbb, 0x12, 0x23, 0xb7,
-  0xe6, 0x36, 0x6a, 0x2d, 0xb1, 0xa7, 0x8c, 0xdf, 0xcf, 0x64, 0xc7, 0xd1,
-  0x2f, 0x2d, 0xc4, 0x78, 0x16, 0x24, 0xd6, 0x23, 0xd2, 0x98, 0xc1, 0x39,
-  0x31, 0xca, 0xe6, 0x14, 0x1e, 0x10, 0xca, 0x24, 0x4e, 0x4a, 0x7a, 0x72,
-  0xbc, 0xd2, 0x01, 0x12, 0xa9, 0xb1, 0x0b, 0x07, 0xc8, 0xc4, 0x69, 0x8e,
-  0xd1, 0xdc, 0x04, 0x97, 0x8d, 0x11, 0x6a, 0x96, 0xe4, 0x85, 0xb7, 0x1e,
-  0xb8, 0x99, 0xd8, 0xec, 0xb2, 0x4f, 0xb1, 0x54, 0x6c, 0xbe, 0x8a, 0xb7,
-  0xc8, 0x57, 0xd9, 0xb7, 0x35, 0x06, 0x5d, 0x95, 0x19, 0x67, 0x22, 0x17,
-  0x65, 0x6d, 0x44, 0xa0, 0x3e, 0xea, 0xc7, 0x4a, 0xd9, 0xa6, 0x62, 0xf4,
-  0x35, 0xfb, 0x0a, 0xab, 0xb9, 0x42, 0xc9, 0xdb, 0xf0, 0x16, 0xae, 0x2d,
-  0x9a, 0x45, 0x47, 0x26, 0xbf, 0xb1, 0xe7, 0xc4, 0xcd, 0x65, 0xc2, 0x29,
-  0xaa, 0x54, 0x60, 0x51, 0xf0, 0x56, 0x6c, 0xc1, 0xb6, 0x07, 0x17, 0x34,
-  0xa3, 0x9a, 0x23, 0x78, 0x5c, 0x57, 0x17, 0x3e, 0x06, 0xe3, 0xc9, 0x69,
-  0x16, 0x01, 0x8a, 0xa9, 0x2f, 0x8d, 0x33, 0x10, 0x4f, 0xf8, 0xb5, 0xfa,
-  0x20, 0xb1, 0xd6, 0x46, 0x5d, 0x0b, 0x7f, 0x63, 0x75, 0x13, 0x14, 0x2d,
-  0xad, 0xae, 0x66, 0x65, 0x57, 0xe1, 0xd4, 0x6e, 0x6a, 0xca, 0x1d, 0x39,
-  0x82, 0x12, 0xbc, 0x0d, 0xc8, 0x5b, 0xce, 0x57, 0x12, 0x68, 0xa2, 0x3b,
-  0x89, 0xde, 0x08, 0x56, 0xb9, 0x6c, 0x6f, 0x52, 0x55, 0xa2, 0x54, 0x1a,
-  0xc8, 0xe1, 0xcb, 0xe7, 0x7c, 0x43, 0x3d, 0xcf, 0x43, 0x47, 0xed, 0x84,
-  0x8f, 0xca, 0xe6, 0x80, 0x63, 0x6e, 0x95, 0xd6, 0xf9, 0xd0, 0x43, 0x62,
-  0x32, 0xee, 0xd0, 0x6c, 0x36, 0x63, 0x7e, 0x02, 0xcc, 0x09, 0x51, 0xb8,
-  0x20, 0xca, 0x23, 0x14, 0x37, 0xe4, 0x34, 0xa6, 0x8d, 0xb3, 0xe9, 0x79,
-  0xd7, 0xb6, 0x9f, 0xa3, 0xae, 0x51, 0x04, 0x69, 0x43, 0x37, 0xa7, 0x78,
-  0xb7, 0x16, 0xe1, 0xad, 0x50, 0x31, 0x0c, 0x8c, 0x51, 0x5b, 0x94, 0x57,
-  0x83, 0xd8, 0xc4, 0x2d, 0x21, 0x95, 0x97, 0xba, 0xc1, 0x22, 0x2f, 0xa4,
-  0xc5, 0x7a, 0x43, 0x0f, 0x37, 0xd5, 0x46, 0xd6, 0x92, 0x25, 0xc4, 0x2b,
-  0x96, 0x9d, 0x8e, 0x83, 0x0c, 0xc4, 0x94, 0x6b, 0x08, 0xd3, 0x16, 0xc5,
-  0xf2, 0xe2, 0xc8, 0x8d, 0xe1, 0xcd, 0x5e, 0x14, 0xbf, 0x1e, 0x7d, 0x01,
-  0x13, 0x5c, 0x11, 0xfe, 0xdf, 0x04, 0x13, 0xae, 0x3b, 0x30, 0xf5, 0x7f,
-  0x24, 0xb5, 0xe2, 0xe1, 0x5b, 0x87, 0xff, 0x80, 0x53, 0x8f, 0xf9, 0xe5,
-  0xc4, 0x7a, 0x68, 0x26, 0x96, 0x8d, 0x46, 0xe7, 0xa7, 0x7b, 0x28, 0xb3,
-  0x4e, 0x3d, 0x12, 0x6a, 0xc9, 0x64, 0xf4, 0x21, 0x02, 0xd5, 0xe3, 0x38,
-  0xa8, 0xac, 0x49, 0x74, 0xea, 0x81, 0x69, 0xb7, 0xe5, 0x43, 0x93, 0x05,
-  0x16, 0x66, 0xd1, 0x66, 0x39, 0x81, 0x2c, 0x80, 0x0b, 0x86, 0x58, 0xd3,
-  0x3c, 0xa2, 0x0e, 0x8b, 0x3f, 0xca, 0x95, 0x3d, 0xad, 0x9d, 0x75, 0xc5,
-  0x55, 0x77, 0x41, 0x71, 0x13, 0xf5, 0x82, 0x5f, 0xfb, 0x16, 0x38, 0x1f,
-  0x98, 0xb6, 0x52, 0xcd, 0x86, 0x9d, 0xb0, 0x2d, 0xe4, 0xd9, 0x65, 0x68,
-  0x91, 0xa7, 0x36, 0x54, 0x8b, 0x8b, 0x7c, 0xfb, 0x7d, 0x59, 0xe5, 0x20,
-  0x27, 0x31, 0x61, 0x51, 0x5a, 0x42, 0xfb, 0xda, 0x62, 0x7b, 0x01, 0x79,
-  0xd7, 0x16, 0x80, 0xf7, 0xa4, 0x25, 0x26, 0x54, 0x03, 0x05, 0x1a, 0x44,
-  0x9c, 0xb5, 0x5c, 0xde, 0xb8, 0x38, 0x15, 0x49, 0x48, 0x98, 0x1b, 0x6a,
-  0x58, 0x10, 0x66, 0x78, 0x20, 0x49, 0x33, 0x7e, 0x88, 0xe1, 0x18, 0xe1,
-  0x85, 0xb9, 0xa1, 0x85, 0x35, 0xe5, 0x87, 0x55, 0x1c, 0x64, 0x58, 0x22,
-  0x05, 0xa1, 0xe1, 0xcc, 0x98, 0x19, 0xbd, 0x5c, 0x4e, 0x42, 0x6d, 0x8b,
-  0x1f, 0x2b, 0xfa, 0x70, 0x72, 0x99, 0x08, 0xd9, 0x52, 0x88, 0x67, 0x20,
-  0x1c, 0x3f, 0xfb, 0x20, 0x80, 0x9b, 0x88, 0x73, 0x5c, 0xc0, 0xc3, 0x54,
-  0xe7, 0xc0, 0x08, 0xe6, 0xf0, 0x0b, 0x78, 0x79, 0x06, 0x13, 0x0f, 0x3e,
-  0x06, 0x09, 0x3c, 0xea, 0x71, 0x57, 0x26, 0x24, 0x6e, 0xd5, 0xd0, 0x60,
-  0x2a, 0x58, 0x43, 0xb3, 0x28, 0x99, 0x61, 0x80, 0x10, 0x47, 0x49, 0x66,
-  0xa8, 0x4f, 0xb4, 0xf9, 0x60, 0x2e, 0x3c, 0xcf, 0xbd, 0x61, 0x8c, 0x58,
-  0xd1, 0xa0, 0x85, 0xf2, 0xc9, 0xc8, 0x86, 0xf7, 0x74, 0xc8, 0x4f, 0x36,
-  0x79, 0x02, 0x73, 0xe4, 0x49, 0xdb, 0xff, 0xf1, 0x92, 0xe4, 0x05, 0x7c,
-  0x54, 0xdc, 0x2c, 0x79, 0xd1, 0x7e, 0x4a, 0x27, 0xca, 0x2b, 0x4e, 0x46,
-  0xe7, 0xde, 0xd3, 0xac, 0xbc, 0x34, 0x5a, 0x50, 0x29, 0x9d, 0x90, 0x8e,
-  0x65, 0x2c, 0x5a, 0x35, 0xde, 0x41, 0x11, 0xd9, 0xd6, 0x4a, 0x5c, 0xa4,
-  0x62, 0xe0, 0xbc, 0xcc, 0x45, 0x8e, 0x02, 0xce, 0xce, 0x50, 0x97, 0x18,
-  0x34, 0xb9, 0x3b, 0x12, 0xef, 0x5e, 0x25, 0xac, 0xe3, 0x4d, 0xcb, 0xe5,
-  0xac, 0xcb, 0xcb, 0x5b, 0x87, 0xa7, 0x11, 0x1c, 0x38, 0x87, 0x6f, 0x8f,
-  0x3e, 0xb5, 0x4e, 0xa1, 0xca, 0xb4, 0xfe, 0x34, 0x3c, 0x6a, 0xf3, 0x3e,
-  0x90, 0xad, 0xce, 0xc9, 0x58, 0x67, 0xb2, 0xd6, 0xa9, 0xbc, 0x75, 0x63,
-  0x46, 0x46, 0x5d, 0xd4, 0xa1, 0x51, 0x22, 0x2c, 0x8a, 0x95, 0x63, 0x83,
-  0x31, 0xdc, 0xb9, 0x6b, 0xa4, 0x77, 0x37, 0x1e, 0x49, 0xaa, 0x77, 0x97,
-  0x85, 0x73, 0xb8, 0xc6, 0xc6, 0x90, 0x50, 0xdf, 0xd5, 0x5c, 0x5c, 0xee,
-  0xcc, 0xdc, 0x6d, 0x66, 0xed, 0xc5, 0xa0, 0x3b, 0x63, 0x18, 0xc0, 0x4c,
-  0x58, 0x68, 0xaf, 0x8c, 0xde, 0xa5, 0x93, 0xf4, 0x0b, 0x65, 0xff, 0x5f,
-  0x10, 0x17, 0xb4, 0x37, 0xb1, 0x26, 0xca, 0x23, 0x92, 0x04, 0xde, 0x82,
-  0x33, 0xf6, 0x4b, 0x4c, 0x3b, 0x65, 0xd7, 0x47, 0x91, 0x35, 0x53, 0xec,
-  0x7b, 0x9b, 0x9d, 0x67, 0xeb, 0x20, 0x98, 0x20, 0x65, 0xc0, 0xc5, 0x57,
-  0x8d, 0xaa, 0xb2, 0x42, 0xe4, 0x9e, 0x07, 0xd1, 0xe4, 0x50, 0x65, 0x12,
-  0x44, 0x39, 0x4e, 0x41, 0x3a, 0x43, 0xd4, 0x38, 0x59, 0xa2, 0xc6, 0x67,
-  0x9f, 0x81, 0xdc, 0x51, 0xd1, 0xfc, 0x51, 0x13, 0xcd, 0x22, 0xc5, 0x73,
-  0x49, 0x31, 0x3e, 0xe8, 0x24, 0x93, 0x62, 0x9e, 0x90, 0xa1, 0x94, 0x52,
-  0x96, 0x1f, 0xd6, 0x04, 0x33, 0xd2, 0x05, 0x1c, 0xb4, 0xf2, 0x52, 0xd2,
-  0xa9, 0xe6, 0xb1, 0x9c, 0x74, 0x91, 0x15, 0xe3, 0x27, 0xa5, 0x93, 0x23,
-  0x39, 0x19, 0xb5, 0xe4, 0xe3, 0xe6, 0x1b, 0x56, 0x58, 0x49, 0x28, 0x99,
-  0x78, 0x64, 0x1b, 0x1f, 0xfe, 0x08, 0x36, 0xfa, 0x9f, 0x40, 0x2a, 0xfa,
-  0x89, 0xd4, 0xc4, 0x3c, 0x8c, 0xef, 0xed, 0x47, 0xd0, 0xf0, 0x63, 0xc1,
-  0x1b, 0x0a, 0x36, 0x7b, 0x24, 0x1d, 0xff, 0xe3, 0x3c, 0xaa, 0x22, 0x07,
-  0x2b, 0xe3, 0x8c, 0xc5, 0x09, 0xf6, 0x62, 0x27, 0x4e, 0xec, 0xa4, 0x29,
-  0x4c, 0xb7, 0x27, 0xf2, 0xe5, 0x19, 0x2f, 0xbd, 0x05, 0xf7, 0xf0, 0x51,
-  0x23, 0x59, 0x70, 0x4f, 0xd4, 0x69, 0x46, 0x57, 0xa9, 0x84, 0x08, 0x1e,
-  0x03, 0xa6, 0x9d, 0x09, 0x1d, 0x5e, 0xc8, 0x0d, 0xd2, 0xe6, 0x9d, 0x2b,
-  0x35, 0x06, 0xe9, 0x30, 0x19, 0x28, 0x4b, 0x8d, 0x31, 0x6b, 0xbf, 0xe4,
-  0x2e, 0xd9, 0x0b, 0xc9, 0x4c, 0x93, 0xbd, 0xb2, 0x3c, 0xf6, 0xe9, 0x9d,
-  0x89, 0x33, 0x8d, 0x69, 0x3d, 0xf4, 0x64, 0x4d, 0x2b, 0x6d, 0x6d, 0x7d,
-  0xf1, 0x6f, 0x47, 0xc7, 0x5f, 0xf9, 0xd1, 0x81, 0x7a, 0x13, 0x2f, 0x84,
-  0x72, 0xb2, 0xe9, 0x08, 0xb5, 0x55, 0x05, 0xe6, 0x6a, 0x70, 0xab, 0xb7,
-  0x0a, 0x3d, 0xea, 0x4c, 0xb2, 0x2a, 0xf5, 0x10, 0xdc, 0x36, 0x54, 0x0a,
-  0xb7, 0x85, 0xd8, 0xb4, 0x52, 0x5a, 0x58, 0xa3, 0xfc, 0x95, 0xd1, 0xad,
-  0x1c, 0xac, 0x49, 0x43, 0xe3, 0x06, 0x8f, 0x0d, 0x8a, 0x6c, 0x33, 0x77,
-  0x03, 0xf9, 0x4b, 0xca, 0x5a, 0x64, 0x4e, 0xca, 0x1a, 0x63, 0xc3, 0x9d,
-  0x39, 0xae, 0xd1, 0xe5, 0xa4, 0x0d, 0x2e, 0x8f, 0xc9, 0xd8, 0x12, 0x36,
-  0xb4, 0x70, 0x4d, 0x3f, 0xf3, 0xdd, 0x2e, 0xa6, 0xce, 0xde, 0xa0, 0x30,
-  0x8b, 0x9c, 0x8e, 0xc6, 0x26, 0x6e, 0x29, 0xed, 0xd1, 0x65, 0x02, 0xb2,
-  0x09, 0xcb, 0x18, 0xfd, 0x87, 0xa6, 0x78, 0x98, 0x13, 0xe9, 0xf7, 0x4d,
-  0xc9, 0x9c, 0xa9, 0x32, 0x92, 0xd5, 0x2b, 0x5e, 0xcf, 0x15, 0xeb, 0xae,
-  0xd4, 0x2d, 0xc7, 0x22, 0xe7, 0x22, 0x87, 0x6b, 0x93, 0xfb, 0x14, 0xb1,
-  0x3b, 0x86, 0x5c, 0x92, 0x79, 0xac, 0x7e, 0x10, 0xd6, 0x6c, 0xbb, 0xfe,
-  0x63, 0x4b, 0x6a, 0xc9, 0x58, 0xaf, 0x2d, 0x8f, 0xaa, 0x25, 0x3e, 0xed,
-  0x56, 0x33, 0x67, 0x9e, 0xf8, 0x4f, 0xa7, 0x1d, 0xa3, 0x87, 0xf9, 0x61,
-  0x57, 0xcd, 0xfb, 0xcf, 0x51, 0xab, 0x66, 0x0c, 0x75, 0xb1, 0x27, 0x68,
-  0x4a, 0x39, 0xeb, 0xaf, 0x3d, 0x27, 0x9d, 0x3a, 0xab, 0xca, 0x26, 0xa5,
-  0xb3, 0xda, 0xeb, 0xac, 0x74, 0xa1, 0xdc, 0x69, 0x21, 0xc8, 0x13, 0xd1,
-  0x26, 0x7e, 0x25, 0x2a, 0xbf, 0x27, 0x26, 0x1f, 0x9d, 0x3b, 0x01, 0x8c,
-  0xa4, 0x63, 0x7b, 0x79, 0x14, 0xa4, 0xa4, 0xe3, 0xfe, 0x93, 0x93, 0x49,
-  0x49, 0x17, 0x5d, 0x6d, 0xc1, 0x54, 0x2c, 0xac, 0x22, 0xa5, 0x19, 0xa6,
-  0xde, 0xcc, 0x18, 0x1f, 0x01, 0x17, 0x34, 0xb8, 0xdc, 0xa1, 0x41, 0x44,
-  0x5e, 0xdd, 0x5e, 0x3f, 0x7c, 0x0b, 0xee, 0x77, 0x68, 0x43, 0xfd, 0x08,
-  0xab, 0xaa, 0xbd, 0x45, 0x21, 0x15, 0x0f, 0x46, 0x1f, 0x8e, 0x3e, 0x57,
-  0x2a, 0x71, 0xdc, 0xdb, 0xae, 0xb9, 0x42, 0xf2, 0x8b, 0xf1, 0x12, 0x5b,
-  0x14, 0x95, 0xff, 0x0c, 0xa7, 0xb6, 0x30, 0xe8, 0xff, 0x93, 0x57, 0xaf,
-  0xb7, 0x1a, 0x06, 0x59, 0x35, 0xf9, 0x0d, 0xa0, 0xe9, 0xc7, 0x38, 0x90,
-  0xe9, 0x84, 0x06, 0xf6, 0x08, 0xfe, 0xfd, 0x16, 0xdd, 0x65, 0x1f, 0xc0,
-  0xd3, 0x2f, 0x12, 0x78, 0xf0, 0x81, 0x34, 0x20, 0x7f, 0xae, 0x6d, 0x45,
-  0xb7, 0x57, 0x1c, 0x67, 0x47, 0x47, 0x90, 0x54, 0xb1, 0x5c, 0xb9, 0x69,
-  0x26, 0x80, 0xb9, 0xdd, 0xcc, 0xba, 0x97, 0x55, 0xd8, 0x17, 0xdb, 0x87,
-  0xf2, 0x52, 0xa4, 0x5e, 0xa9, 0x5c, 0x21, 0x1a, 0xea, 0x45, 0xfd, 0xa7,
-  0x16, 0x07, 0x16, 0x98, 0x34, 0xb0, 0x51, 0x9c, 0x7e, 0x02, 0x2b, 0x9f,
-  0xca, 0xdc, 0x83, 0x98, 0x73, 0xc2, 0xfc, 0x0c, 0x6a, 0x04, 0x22, 0x00,
-  0x2f, 0xec, 0x2e, 0x8f, 0xfe, 0xc5, 0x37, 0xab, 0xfa, 0xa4, 0xc5, 0x74,
-  0x12, 0x0f, 0x31, 0xd8, 0x26, 0x81, 0x39, 0xf9, 0x07, 0xf1, 0x32, 0x94,
-  0x5c, 0xa2, 0x79, 0xe1, 0xf4, 0xee, 0x72, 0x25, 0xaf, 0x4a, 0x0b, 0x69,
-  0x35, 0x74, 0xa1, 0x2e, 0x8e, 0xb7, 0x9b, 0x54, 0xca, 0x49, 0x8b, 0x8b,
-  0xbc, 0x9a, 0xdd, 0xe1, 0x90, 0x0a, 0x1c, 0xd8, 0xb8, 0xc3, 0xfe, 0xad,
-  0x8d, 0xba, 0xda, 0x31, 0x1f, 0xaa, 0x9c, 0xfa, 0x3c, 0x81, 0x86, 0xa1,
-  0x42, 0xce, 0xf8, 0x2c, 0x64, 0xec, 0x34, 0x88, 0x5e, 0x96, 0x09, 0x87,
-  0x49, 0xc7, 0x43, 0xdd, 0x90, 0x17, 0x92, 0xef, 0x3b, 0x05, 0x06, 0xb5,
-  0xda, 0xb0, 0xea, 0x44, 0xf2, 0x51, 0x74, 0x82, 0x87, 0x1b, 0x32, 0x66,
-  0xfe, 0x13, 0xa1, 0xc5, 0xec, 0x03, 0xc5, 0x6a, 0x54, 0x9e, 0x75, 0x2f,
-  0x43, 0xa2, 0x69, 0x5a, 0x14, 0x9a, 0xeb, 0xa5, 0x9b, 0xae, 0x2c, 0x9b,
-  0x58, 0x5b, 0x0f, 0xae, 0x89, 0xa5, 0x8d, 0x06, 0xaa, 0x0a, 0x80, 0x18,
-  0xe4, 0xeb, 0x55, 0x78, 0xf6, 0x9b, 0xc9, 0x2d, 0x3f, 0xb0, 0xe3, 0x85,
-  0x64, 0x7c, 0xa8, 0x70, 0xc9, 0x17, 0x3f, 0x2a, 0x26, 0x5a, 0x14, 0x45,
-  0xa0, 0xcb, 0xbd, 0x1d, 0x60, 0x1a, 0xed, 0x9a, 0x2e, 0xb5, 0xdd, 0x86,
-  0x5b, 0x69, 0x15, 0xcd, 0x83, 0x95, 0xe5, 0x1b, 0x5d, 0x3f, 0xcc, 0xf3,
-  0x38, 0x40, 0x37, 0x37, 0x09, 0xea, 0xe6, 0xe6, 0x44, 0xc1, 0xf6, 0x53,
-  0x98, 0xc0, 0xaa, 0x89, 0x6e, 0x15, 0x16, 0xdd, 0xca, 0xf2, 0x5f, 0xfe,
-  0xfe, 0xb3, 0x40, 0x94, 0xaa, 0x13, 0x23, 0xe0, 0xd1, 0x91, 0x12, 0x3f,
-  0x5b, 0x44, 0x1c, 0xfd, 0x1e, 0x76, 0x3a, 0x06, 0xd2, 0x01, 0xa3, 0x5c,
-  0x90, 0x01, 0x9c, 0x32, 0x58, 0x05, 0x4e, 0x25, 0x14, 0xa7, 0x42, 0xa5,
-  0xb3, 0xb7, 0xfa, 0x69, 0xda, 0x25, 0x5b, 0x5d, 0x1f, 0x64, 0x31, 0x0c,
-  0x55, 0x09, 0xb5, 0xba, 0x21, 0x9a, 0x00, 0x49, 0x2a, 0xf9, 0xd1, 0xcc,
-  0x21, 0x54, 0xb1, 0x68, 0xb8, 0x8d, 0xe9, 0x3f, 0xc3, 0xce, 0xfb, 0x23,
-  0x5a, 0x25, 0xf2, 0xf1, 0xb4, 0x2b, 0x98, 0xf7, 0x65, 0x90, 0x8f, 0xc0,
-  0x98, 0x63, 0x6a, 0xb7, 0x13, 0xa5, 0xca, 0xa9, 0xe9, 0xa5, 0xbd, 0x61,
-  0xaf, 0x52, 0x3a, 0xfc, 0x7a, 0x6d, 0xd1, 0x61, 0x30, 0x56, 0xd5, 0xed,
-  0xde, 0x7e, 0xdd, 0xbb, 0x39, 0x6c, 0x75, 0x7a, 0xeb, 0xad, 0x8e, 0xac,
-  0xb4, 0x2c, 0x12, 0x2e, 0x15, 0x32, 0x00, 0xf7, 0x1b, 0x3b, 0x9e, 0x95,
-  0xa2, 0x61, 0x64, 0xc4, 0x77, 0x65, 0xd1, 0x39, 0xbb, 0xd2, 0xf6, 0xa5,
-  0x21, 0x9c, 0xe5, 0xb0, 0x56, 0x52, 0x13, 0x75, 0x6a, 0x9f, 0x47, 0x17,
-  0x93, 0xaa, 0x6c, 0x4a, 0x31, 0x0c, 0x22, 0x7d, 0x8e, 0xd7, 0xa5, 0xcf,
-  0x22, 0x78, 0x5e, 0x22, 0x1d, 0xda, 0xb4, 0xd9, 0x01, 0xb1, 0x26, 0xa1,
-  0x94, 0x44, 0xc4, 0x90, 0x06, 0x3a, 0x31, 0x51, 0xb2, 0xd5, 0xda, 0x95,
-  0x79, 0x8b, 0xf4, 0xcc, 0x96, 0xd8, 0x18, 0x2f, 0xe1, 0x16, 0x00, 0xc1,
-  0x4c, 0x6d, 0x10, 0x2f, 0xd4, 0x7b, 0x99, 0x5a, 0x24, 0xd0, 0x24, 0x11,
-  0x5c, 0xd7, 0xdd, 0x19, 0x17, 0xec, 0xb5, 0x96, 0x13, 0xaa, 0xed, 0x1c,
-  0xe4, 0x18, 0x46, 0xe6, 0xd0, 0x90, 0x87, 0x63, 0x67, 0x83, 0x55, 0xf1,
-  0x81, 0x4e, 0x01, 0xc6, 0x22, 0xad, 0x2b, 0x5e, 0xf4, 0xb8, 0x08, 0x49,
-  0x72, 0xba, 0xc0, 0x64, 0x4d, 0xc6, 0x71, 0x86, 0xdc, 0x96, 0x84, 0x2f,
-  0x0d, 0x1e, 0xc1, 0x8f, 0xc8, 0x7f, 0x05, 0xc4, 0x14, 0x27, 0x2c, 0x89,
-  0xad, 0x3f, 0xfd, 0xe7, 0xda, 0x62, 0xb4, 0xa2, 0xbb, 0x3b, 0x95, 0xae,
-  0x52, 0x2e, 0x44, 0x64, 0x4f, 0xa2, 0xac, 0x82, 0x74, 0x8a, 0x99, 0xa7,
-  0x12, 0x62, 0x49, 0x2f, 0xc3, 0xa5, 0x0b, 0x5e, 0x53, 0xe3, 0x2a, 0x93,
-  0x77, 0x86, 0xd9, 0x4e, 0x0a, 0x3c, 0x60, 0x07, 0xc3, 0x41, 0xe0, 0x6e,
-  0x98, 0x36, 0xbb, 0xbd, 0x7d, 0x71, 0x0d, 0xe2, 0x37, 0x53, 0xc2, 0xdc,
-  0x75, 0xad, 0x91, 0x63, 0x93, 0x77, 0x68, 0xc1, 0x06, 0xb4, 0x75, 0x56,
-  0xac, 0x6e, 0x7a, 0x2c, 0x7b, 0xd7, 0xaf, 0x74, 0x97, 0x0b, 0xe6, 0x4f,
-  0xf5, 0x4e, 0xcc, 0xd0, 0x42, 0x62, 0xcf, 0x94, 0x4c, 0x7b, 0x3f, 0x2d,
-  0x8a, 0x92, 0x01, 0x29, 0x3a, 0x74, 0xc5, 0x74, 0x26, 0x53, 0x49, 0x61,
-  0x16, 0x9d, 0x14, 0x7d, 0xa4, 0x7e, 0x63, 0x5a, 0x22, 0xe6, 0x93, 0x6b,
-  0x4d, 0x91, 0x4b, 0x12, 0x69, 0x41, 0xb6, 0x5c, 0x7a, 0xe6, 0x35, 0xf1,
-  0xc7, 0xc1, 0xb4, 0xd2, 0xe0, 0x2f, 0x49, 0x96, 0xb4, 0xd2, 0xb6, 0xae,
-  0x70, 0x93, 0x27, 0x25, 0xf7, 0x5e, 0x5c, 0x50, 0xbd, 0xbb, 0x14, 0x16,
-  0xff, 0x9d, 0x20, 0x71, 0xdd, 0x8c, 0x86, 0x76, 0xf6, 0x82, 0x5d, 0xf9,
-  0xc7, 0xcd, 0xd6, 0x70, 0x7b, 0x5a, 0x84, 0xcb, 0xf1, 0x4b, 0xdb, 0x2b,
-  0x29, 0x89, 0x87, 0xbc, 0x15, 0x19, 0xfc, 0x86, 0xb5, 0x6a, 0x53, 0xa6,
-  0x04, 0x4b, 0xb5, 0x94, 0xed, 0x29, 0x5c, 0x8d, 0x33, 0x3e, 0xcd, 0x30,
-  0x59, 0xbc, 0xe1, 0x3f, 0x17, 0x08, 0x2c, 0x57, 0xdc, 0x27, 0xd9, 0xb3,
-  0xcf, 0x6a, 0x73, 0xbb, 0xee, 0x19, 0xda, 0x63, 0x43, 0xad, 0xae, 0xd5,
-  0xce, 0xb6, 0xd7, 0x6b, 0xf0, 0x9c, 0x12, 0xfb, 0x5c, 0xea, 0xf7, 0x49,
-  0x36, 0xa5, 0xff, 0x2a, 0x6f, 0xa6, 0xba, 0x97, 0xf4, 0xca, 0x73, 0xf2,
-  0xc7, 0xef, 0xed, 0x04, 0x7a, 0xd8, 0x60, 0x59, 0x33, 0x68, 0x16, 0xcb,
-  0x65, 0xfc, 0x13, 0xd4, 0x40, 0xbe, 0x9f, 0xb8, 0xed, 0x16, 0xe1, 0xd9,
-  0x05, 0x95, 0x35, 0x26, 0xf9, 0xbe, 0x18, 0x8c, 0x39, 0x3b, 0x55, 0x63,
-  0x51, 0xf8, 0xfa, 0xa0, 0x1e, 0x48, 0x92, 0xc3, 0x70, 0x39, 0x25, 0x9b,
-  0x2b, 0x15, 0xb9, 0x4c, 0xc7, 0xd8, 0xdb, 0x4c, 0x9c, 0x17, 0x28, 0x89,
-  0x57, 0x7b, 0xeb, 0xdf, 0x87, 0x8b, 0x58, 0x95, 0x77, 0xe8, 0x34, 0x53,
-  0x19, 0xc7, 0x79, 0x3f, 0x66, 0xc6, 0xec, 0xc6, 0x8b, 0xd1, 0x64, 0x4c,
-  0x1a, 0x2b, 0x20, 0x5d, 0x08, 0x27, 0x7a, 0x5c, 0x84, 0x11, 0x35, 0x2a,
-  0x87, 0x0f, 0x36, 0x5d, 0x0c, 0x25, 0x20, 0x84, 0xb3, 0x67, 0xf8, 0x2d,
-  0xb3, 0x38, 0x9c, 0xa5, 0x24, 0xea, 0x4a, 0x4a, 0x18, 0xb2, 0x29, 0x76,
-  0x49, 0x2b, 0x7b, 0xd1, 0x65, 0x12, 0xb7, 0x85, 0xdb, 0x29, 0x66, 0x03,
-  0x67, 0x2b, 0x1c, 0xe3, 0x77, 0x16, 0xd6, 0xd4, 0x6e, 0x58, 0x54, 0x45,
-  0x96, 0x76, 0x5b, 0xf7, 0xd1, 0x9c, 0xc5, 0x0e, 0xf8, 0x61, 0x6f, 0xf7,
-  0xdb, 0xb0, 0xc9, 0x3b, 0x0c, 0x9d, 0x99, 0xbb, 0xba, 0xbd, 0x5c, 0x95,
-  0x52, 0x9a, 0x70, 0xf3, 0xbb, 0xb7, 0xf0, 0x9d, 0x72, 0x2a, 0xdf, 0xeb,
-  0x74, 0xca, 0xec, 0x15, 0xbd, 0x4f, 0xfc, 0xdd, 0x80, 0xbb, 0x84, 0x76,
-  0x44, 0xe6, 0xb8, 0xae, 0xf0, 0x7e, 0x44, 0x3b, 0x4d, 0x26, 0xc1, 0x44,
-  0x1c, 0x24, 0xa3, 0x5e, 0xfc, 0x4c, 0x69, 0x77, 0xca, 0xf9, 0xca, 0xdb,
-  0x88, 0x36, 0x1b, 0xb8, 0xc3, 0xe8, 0x74, 0x57, 0x57, 0xe2, 0xe3, 0x88,
-  0xb1, 0x06, 0x72, 0xab, 0xc7, 0xd0, 0x32, 0x8a, 0x43, 0x0f, 0x05, 0x03,
-  0xb0, 0x08, 0x1f, 0xdd, 0xf2, 0xae, 0x61, 0x15, 0x72, 0x76, 0x71, 0x75,
-  0x26, 0xac, 0x81, 0xab, 0x23, 0x66, 0xaf, 0x94, 0xfd, 0xd4, 0x5a, 0x51,
-  0x8a, 0xb1, 0xa2, 0xca, 0x14, 0xc4, 0x70, 0x10, 0x93, 0xe9, 0x83, 0xa4,
-  0x0a, 0xe7, 0x8e, 0xfa, 0xf2, 0xa0, 0xda, 0x4c, 0xd4, 0xf1, 0x34, 0xdc,
-  0x4e, 0x93, 0xfd, 0x6d, 0xf8, 0x5c, 0xb4, 0x93, 0x71, 0x62, 0xf6, 0x06,
-  0x64, 0xa8, 0x1d, 0x98, 0xfc, 0x81, 0xf2, 0xe9, 0xcd, 0x5e, 0x86, 0xd2,
-  0x1d, 0x31, 0x37, 0xb9, 0x3e, 0x2d, 0x66, 0x55, 0x62, 0x25, 0xe5, 0xb0,
-  0x5c, 0x49, 0x6b, 0xba, 0xcd, 0x3b, 0x3b, 0x8d, 0xef, 0x6f, 0x1b, 0x17,
-  0xb5, 0xcd, 0xf5, 0x9e, 0x0b, 0xa6, 0x01, 0xa3, 0x85, 0x14, 0xf8, 0xd0,
-  0x66, 0x9d, 0x61, 0xc8, 0x86, 0x81, 0x18, 0x16, 0x92, 0x44, 0x29, 0xc2,
-  0x3f, 0xf6, 0x73, 0x9b, 0x3a, 0x9a, 0x2f, 0x7f, 0x02, 0x05, 0x3f, 0x33,
-  0x53, 0xd6, 0xc2, 0x63, 0x04, 0x63, 0xfd, 0xe4, 0x89, 0x2a, 0x15, 0x58,
-  0xb2, 0x40, 0x4e, 0xb7, 0x7d, 0x53, 0xbc, 0xd5, 0x16, 0x56, 0x89, 0x85,
-  0x51, 0x97, 0xd8, 0xa7, 0xe9, 0x10, 0x9a, 0x0f, 0x30, 0x75, 0x4d, 0xad,
-  0x8a, 0x47, 0x7c, 0x7f, 0x50, 0x25, 0x5f, 0x93, 0x68, 0xa3, 0x6c, 0x70,
-  0x8b, 0x9a, 0x5d, 0x15, 0x09, 0x8d, 0xaa, 0x75, 0x93, 0xa5, 0x1f, 0x58,
-  0x78, 0x5f, 0xbc, 0xac, 0xf1, 0x65, 0x94, 0xdb, 0xe7, 0x00, 0xe4, 0xe5,
-  0xf6, 0x5e, 0x27, 0x5d, 0x85, 0x5b, 0x42, 0xab, 0x9f, 0xf5, 0x06, 0x55,
-  0xb5, 0x27, 0xca, 0x7c, 0xcd, 0xcc, 0x5a, 0x63, 0x7d, 0x27, 0x55, 0xbc,
-  0x55, 0x56, 0x97, 0xd3, 0xf1, 0x94, 0x79, 0x8f, 0x54, 0xa6, 0x26, 0xe9,
-  0x0c, 0x8f, 0x54, 0xf8, 0x6f, 0x20, 0x9b, 0x93, 0x7f, 0x8c, 0xad, 0xf7,
-  0xfa, 0x8c, 0xc5, 0x30, 0x98, 0xd0, 0xa6, 0x70, 0x1c, 0xc3, 0x83, 0x4a,
-  0x60, 0xa3, 0x89, 0xf9, 0x5c, 0xdd, 0x4d, 0x37, 0xb2, 0xcd, 0x6c, 0xe3,
-  0xf6, 0x8a, 0xba, 0x08, 0x86, 0x84, 0x24, 0x5f, 0x0d, 0x1e, 0x9e, 0x7b,
-  0xeb, 0x37, 0x8b, 0x2a, 0x3f, 0x25, 0x0d, 0x4c, 0x30, 0xd5, 0xbe, 0x81,
-  0xe9, 0x54, 0xd4, 0xc0, 0xf4, 0xf8, 0x4c, 0x34, 0xb1, 0x92, 0x9c, 0xe9,
-  0x40, 0xd6, 0x31, 0x09, 0x4a, 0xbd, 0x63, 0x9b, 0xe0, 0x1c, 0x0a, 0xb1,
-  0x5c, 0x06, 0x4c, 0xca, 0x96, 0x9d, 0xd6, 0xdd, 0x03, 0xbc, 0x22, 0xe9,
-  0x9d, 0x57, 0xbe, 0xc9, 0x9d, 0x02, 0x5b, 0x28, 0x16, 0x9b, 0x46, 0x5d,
-  0x07, 0xaf, 0xc0, 0x44, 0xb7, 0x7b, 0xfb, 0xdd, 0x1a, 0xa5, 0xb6, 0x9b,
-  0x26, 0x8b, 0xc1, 0x00, 0xad, 0x6d, 0x22, 0x5f, 0x09, 0x9a, 0x1a, 0x56,
-  0x84, 0x0b, 0x82, 0xcc, 0x5b, 0x3b, 0x6d, 0x4e, 0x1d, 0x31, 0x43, 0x32,
-  0x18, 0x97, 0x5d, 0xd0, 0x63, 0x29, 0x33, 0x2e, 0x6c, 0x9f, 0x59, 0x7e,
-  0xe6, 0x35, 0xea, 0xe8, 0xe0, 0xc2, 0x69, 0xf8, 0x11, 0xd0, 0xd2, 0xa9,
-  0xeb, 0x71, 0xa3, 0x2d, 0x11, 0xd3, 0xa9, 0x4c, 0x76, 0x7b, 0x83, 0x4c,
-  0x5c, 0x18, 0xf0, 0x1e, 0x31, 0xcc, 0x5e, 0x4d, 0x17, 0x93, 0xf5, 0x5e,
-  0x1f, 0xc6, 0x02, 0x57, 0xfc, 0xdd, 0x7b, 0x40, 0x3d, 0x4c, 0x60, 0xfa,
-  0x74, 0xbb, 0xdd, 0x56, 0xcf, 0x1b, 0xfd, 0x56, 0x3b, 0xdb, 0x03, 0x8a,
-  0x9f, 0xc1, 0xc4, 0xc5, 0xeb, 0xad, 0x8d, 0x57, 0x50, 0xf1, 0x87, 0x37,
-  0xa3, 0xa7, 0x37, 0xcf, 0xe3, 0xff, 0x16, 0x23, 0x3a, 0x40, 0xd5, 0x77,
-  0x43, 0x38, 0x9f, 0x54, 0xbc, 0x54, 0xc8, 0xe7, 0x10, 0x20, 0xc8, 0x5c,
-  0xe4, 0xe2, 0xb4, 0x2b, 0x98, 0xed, 0x62, 0xe2, 0x68, 0x24, 0xbe, 0xbf,
-  0x37, 0x18, 0xc2, 0x32, 0x21, 0x5d, 0x22, 0x2d, 0x91, 0xc1, 0x6e, 0x6b,
-  0x23, 0x6d, 0xac, 0xa7, 0xc3, 0xfd, 0x34, 0xed, 0x2e, 0x56, 0xec, 0x8c,
-  0x1f, 0x5a, 0x03, 0x41, 0x57, 0xfa, 0x6e, 0x7a, 0x4f, 0x69, 0xfc, 0x57,
-  0xb3, 0xf5, 0x0e, 0x74, 0xea, 0x99, 0xae, 0x4a, 0xb6, 0x33, 0x86, 0x30,
-  0xd4, 0xba, 0x90, 0xb9, 0x0b, 0x55, 0x2e, 0xe2, 0x91, 0x9f, 0x82, 0x0d,
-  0x13, 0x4e, 0xbd, 0x0d, 0xec, 0xe4, 0x75, 0xd2, 0xd1, 0xfd, 0xac, 0xd9,
-  0x6c, 0xba, 0x7a, 0xa9, 0xc4, 0x56, 0x86, 0x91, 0x1e, 0x58, 0x2c, 0x97,
-  0x85, 0x04, 0xc1, 0x2f, 0x06, 0x52, 0xaf, 0xe5, 0xaa, 0xdf, 0x34, 0xb5,
-  0x61, 0x14, 0x7b, 0x7e, 0xe6, 0x1a, 0x82, 0x99, 0x98, 0xd9, 0x6f, 0xad,
-  0xc3, 0x4c, 0xef, 0x0d, 0xe1, 0xd9, 0x0f, 0x84, 0xad, 0x10, 0x35, 0x3c,
-  0xf6, 0xf4, 0xee, 0x6f, 0x67, 0xc3, 0xd2, 0xab, 0x43, 0x2c, 0x0e, 0x58,
-  0x71, 0x83, 0xed, 0x16, 0xa0, 0xb1, 0x90, 0xcc, 0x24, 0x73, 0xf0, 0xc1,
-  0x59, 0xf8, 0xa7, 0xbf, 0xb5, 0xde, 0xaa, 0xcd, 0x4c, 0xd3, 0xff, 0x9a,
-  0xb3, 0xf5, 0xc5, 0x64, 0x27, 0xeb, 0x36, 0xf6, 0xb3, 0xf6, 0x70, 0x9b,
-  0x7c, 0xd1, 0xbe, 0x66, 0x67, 0xcc, 0x79, 0xe6, 0x35, 0xda, 0x3c, 0xc2,
-  0x8f, 0x07, 0xff, 0x54, 0xae, 0x3c, 0x76, 0x22, 0x2d, 0xa9, 0x9b, 0x71,
-  0x87, 0x49, 0x13, 0x02, 0xe3, 0x54, 0x4b, 0x0c, 0xfb, 0x17, 0x19, 0xb7,
-  0x77, 0x5a, 0xfd, 0x2d, 0xac, 0x7c, 0x3b, 0xb3, 0xe8, 0x25, 0x9f, 0x89,
-  0x68, 0x96, 0x30, 0xf9, 0x8b, 0xb7, 0x7f, 0x41, 0xc2, 0xf1, 0xf4, 0x6e,
-  0x07, 0x5e, 0xd6, 0x19, 0x37, 0xf5, 0xdf, 0xaa, 0x3c, 0x2c, 0x49, 0xaa,
-  0xd4, 0x77, 0x68, 0x93, 0xa5, 0xca, 0x96, 0xf2, 0xa6, 0x91, 0x08, 0x07,
-  0x4e, 0x02, 0xc0, 0xca, 0xb2, 0x24, 0xcd, 0x81, 0x93, 0x5f, 0xc6, 0x4b,
-  0x7c, 0xa3, 0x52, 0x7d, 0x55, 0xab, 0x2c, 0xd5, 0x57, 0x4c, 0x0f, 0xca,
-  0xf5, 0x50, 0xfe, 0xa5, 0xbf, 0xdc, 0x91, 0xa6, 0xfd, 0xbd, 0xf8, 0x4b,
-  0xb1, 0x67, 0x3c, 0xa1, 0xc3, 0x32, 0xa3, 0x94, 0x30, 0xd2, 0x49, 0xd9,
-  0x86, 0x25, 0x46, 0x64, 0x01, 0xce, 0xea, 0xfb, 0xba, 0x6f, 0x8d, 0x63,
-  0x52, 0xe4, 0x41, 0x0e, 0x76, 0x57, 0xbb, 0x1b, 0xf7, 0x61, 0x03, 0x0d,
-  0xd3, 0x5b, 0x4a, 0x84, 0x1a, 0x17, 0xbf, 0xd4, 0x85, 0x30, 0x3e, 0x7a,
-  0x39, 0xf8, 0xa9, 0x85, 0x73, 0x74, 0xfa, 0x29, 0x39, 0xed, 0x98, 0x24,
-  0x8c, 0xe2, 0xc8, 0x24, 0x39, 0x3b, 0x81, 0xe5, 0x11, 0xa6, 0xda, 0x80,
-  0x3a, 0x21, 0x64, 0xe1, 0x5e, 0x47, 0xcb, 0xfb, 0xe8, 0xe4, 0x6c, 0xd9,
-  0xdf, 0x8f, 0x8f, 0x9b, 0x2b, 0xf9, 0x29, 0xf9, 0xe2, 0x56, 0x6f, 0x95,
-  0x44, 0x0f, 0x5e, 0xe6, 0xe1, 0xaf, 0x56, 0xe4, 0x73, 0xd5, 0x1e, 0xb2,
-  0x6c, 0x03, 0x1f, 0x18, 0xbf, 0x9e, 0xba, 0xda, 0x3f, 0xef, 0x72, 0xa5,
-  0xaf, 0x50, 0x9d, 0x8e, 0x6c, 0xac, 0x25, 0x37, 0x38, 0x5b, 0x43, 0x22,
-  0x79, 0x20, 0x4e, 0x61, 0xbb, 0x35, 0xb8, 0xb1, 0xdf, 0xd5, 0xdc, 0x57,
-  0xa1, 0xc3, 0x74, 0x1e, 0xd6, 0x5d, 0x5e, 0xbe, 0xf7, 0x6f, 0xf2, 0xea,
-  0x45, 0x72, 0xb0, 0x18, 0x4a, 0x13, 0xa3, 0x70, 0xed, 0x75, 0x3b, 0xf7,
-  0xe9, 0x9a, 0x5e, 0xc5, 0x83, 0x44, 0xe8, 0x8e, 0xab, 0xba, 0x46, 0x47,
-  0x53, 0x67, 0x76, 0x71, 0x95, 0x66, 0xf6, 0xb4, 0xad, 0xc9, 0x79, 0x58,
-  0x35, 0x82, 0xaa, 0x98, 0x03, 0x0b, 0x2a, 0x4e, 0xe7, 0x26, 0x9e, 0xda,
-  0x78, 0xf5, 0x74, 0x86, 0x6d, 0xdc, 0x8d, 0xad, 0x00, 0xff, 0xf1, 0xe0,
-  0x36, 0xdd, 0xfc, 0x0d, 0x76, 0x74, 0xc0, 0x09, 0x4b, 0xfa, 0x34, 0x2b,
-  0x63, 0x4a, 0xf8, 0xab, 0x79, 0x92, 0xbd, 0xba, 0x58, 0x3b, 0x41, 0x25,
-  0xc4, 0xc2, 0x2d, 0xe7, 0xa3, 0x6e, 0xba, 0x4f, 0x0f, 0xb5, 0xab, 0x20,
-  0x1e, 0x47, 0x0b, 0x49, 0x65, 0x66, 0x66, 0x61, 0x7e, 0x66, 0x61, 0x66,
-  0x46, 0x5a, 0x33, 0x82, 0x31, 0x01, 0xda, 0x47, 0x48, 0x90, 0xd3, 0x0c,
-  0x48, 0x79, 0xf3, 0x8b, 0xda, 0x77, 0x01, 0x67, 0x7e, 0x95, 0xed, 0x08,
-  0x37, 0xf8, 0x4b, 0x42, 0xeb, 0xff, 0xda, 0x54, 0x61, 0xf4, 0x81, 0x0e,
-  0x2c, 0xd0, 0x1e, 0xfc, 0xca, 0xaa, 0xeb, 0x34, 0xb4, 0x02, 0x27, 0x2a,
-  0x2b, 0xa2, 0xb3, 0x44, 0x8c, 0xf3, 0x66, 0x6f, 0x3f, 0xed, 0x57, 0xa4,
-  0x27, 0xb8, 0x98, 0x2f, 0xe0, 0x51, 0x85, 0x88, 0xd0, 0x50, 0x4a, 0xe0,
-  0xc1, 0xdb, 0xd9, 0x68, 0x5c, 0x85, 0xc5, 0xeb, 0xa3, 0x30, 0x25, 0xa3,
-  0x0d, 0x42, 0x25, 0x5b, 0x84, 0x64, 0x50, 0x4f, 0x82, 0x8f, 0x75, 0x0a,
-  0xa1, 0xe0, 0x5b, 0x1d, 0x74, 0x40, 0x3d, 0x2a, 0xa7, 0x30, 0x9f, 0x17,
-  0x6b, 0xcd, 0x8a, 0xc8, 0x97, 0xe4, 0xea, 0x49, 0xbc, 0x28, 0x04, 0x71,
-  0xd3, 0xa1, 0x26, 0xb2, 0x94, 0x61, 0x2d, 0xdc, 0x3f, 0x53, 0x87, 0x85,
-  0xfc, 0xed, 0xfb, 0xe9, 0x4e, 0xef, 0x55, 0x01, 0x87, 0xfb, 0x18, 0xd2,
-  0x39, 0x23, 0x53, 0x31, 0x54, 0x47, 0xff, 0x42, 0xc1, 0x3c, 0x9f, 0x2b,
-  0xe3, 0xe3, 0x9b, 0xe4, 0xe7, 0x42, 0x69, 0x76, 0x2f, 0x1a, 0xfd, 0x48,
-  0xb8, 0xfb, 0x50, 0xec, 0x55, 0x19, 0x12, 0x04, 0x95, 0x45, 0x5e, 0x18,
-  0xae, 0x87, 0xb7, 0x31, 0x8c, 0xf5, 0x6f, 0xf5, 0x2e, 0x43, 0x0b, 0xdf,
-  0xc5, 0x5e, 0xf4, 0xc2, 0xac, 0x09, 0xde, 0xfe, 0x8b, 0x87, 0xd4, 0x32,
-  0xc0, 0xc2, 0x41, 0xf6, 0xaf, 0x72, 0xce, 0x03, 0x70, 0x3c, 0x12, 0xb6,
-  0x75, 0x51, 0xd7, 0xa8, 0x87, 0xe9, 0x90, 0x01, 0x28, 0xe7, 0x62, 0x1a,
-  0x84, 0x70, 0x09, 0x5b, 0x85, 0x8a, 0x84, 0x49, 0x14, 0x42, 0x17, 0x64,
-  0x71, 0x2d, 0x06, 0x29, 0xe5, 0x54, 0xb0, 0x91, 0x59, 0x92, 0x41, 0x08,
-  0x76, 0xed, 0xaf, 0x88, 0x1b, 0xe9, 0x87, 0x55, 0xcf, 0x8d, 0x37, 0x0a,
-  0xee, 0x68, 0x4e, 0xa9, 0xe2, 0xe2, 0x43, 0xd3, 0x80, 0xff, 0xd2, 0xa9,
-  0x2c, 0xe1, 0xef, 0xef, 0xd8, 0xb7, 0x9d, 0x53, 0x79, 0x4b, 0x98, 0xd7,
-  0xa4, 0xa2, 0x5c, 0x40, 0xbd, 0xfe, 0x4e, 0x6b, 0x08, 0xc2, 0x96, 0xac,
-  0x43, 0x62, 0x00, 0x2a, 0xf6, 0x56, 0xb3, 0x9b, 0xc0, 0x05, 0x78, 0xb8,
-  0xb1, 0x5d, 0x3b, 0xbd, 0x70, 0x7a, 0x4b, 0xc6, 0x10, 0xd6, 0x75, 0x84,
-  0x65, 0x32, 0xa7, 0x68, 0xe9, 0x80, 0xc5, 0x7a, 0x83, 0x78, 0x2a, 0xa9,
-  0x6b, 0x4f, 0x1e, 0x86, 0xf4, 0x0b, 0xad, 0x4b, 0x16, 0x88, 0x50, 0x7a,
-  0xcf, 0x15, 0x76, 0x1c, 0xd9, 0x09, 0x3e, 0xf9, 0x21, 0xc0, 0xd7, 0xa9,
-  0x48, 0xc8, 0x5b, 0xaa, 0xd8, 0xd7, 0x9a, 0x3c, 0xec, 0x1a, 0xf2, 0x9b,
-  0x40, 0x92, 0x05, 0x17, 0x9a, 0x1a, 0xbc, 0xfb, 0xdc, 0x5b, 0x02, 0x4e,
-  0x82, 0xfe, 0x70, 0xbe, 0x4f, 0x7f, 0xbc, 0x57, 0xe5, 0x89, 0x67, 0x8f,
-  0x95, 0x0e, 0xb1, 0x15, 0x77, 0x47, 0x8e, 0x33, 0x52, 0xe0, 0x25, 0x27,
-  0x31, 0xca, 0x9a, 0xc1, 0x4c, 0x95, 0x32, 0x2e, 0x33, 0x56, 0x94, 0xbf,
-  0x68, 0x99, 0xdb, 0x21, 0x5d, 0x63, 0xaf, 0x6f, 0x9b, 0xbf, 0x17, 0x72,
-  0x76, 0x2f, 0x13, 0x29, 0x22, 0xaf, 0x36, 0x05, 0x50, 0xec, 0xb2, 0xb8,
-  0x34, 0xbd, 0xd4, 0x6a, 0x67, 0x3d, 0x7a, 0xac, 0x57, 0x08, 0xb5, 0xf4,
-  0xe9, 0xe6, 0xc1, 0xa9, 0x33, 0x51, 0x0d, 0x1d, 0x47, 0x1d, 0x59, 0xca,
-  0x0d, 0x29, 0xa9, 0x05, 0x10, 0xc1, 0x08, 0x1a, 0xe1, 0x0f, 0x5a, 0x61,
-  0x57, 0xbc, 0x32, 0x00, 0x3d, 0x17, 0x82, 0xbe, 0xa8, 0x12, 0x5e, 0x54,
-  0xe5, 0x51, 0x42, 0x7d, 0xc9, 0xb4, 0xb6, 0x47, 0xca, 0xc2, 0x6f, 0x7b,
-  0xed, 0xb4, 0x34, 0xbc, 0x17, 0x75, 0x63, 0x1f, 0x1c, 0x0e, 0x89, 0x61,
-  0x57, 0x8f, 0x12, 0xcc, 0x04, 0x05, 0x69, 0x3f, 0x08, 0xf6, 0x5d, 0xd3,
-  0xd8, 0x35, 0x14, 0x54, 0x83, 0x62, 0x1c, 0xa8, 0xf6, 0x38, 0x5c, 0x62,
-  0x23, 0xe2, 0x45, 0x23, 0x7b, 0xdd, 0x4a, 0xf8, 0x82, 0x54, 0x72, 0x5e,
-  0xb5, 0xd5, 0xdc, 0xbb, 0xa0, 0x28, 0x89, 0x36, 0x7f, 0xd5, 0xa9, 0x56,
-  0xfe, 0x8a, 0xb3, 0xbe, 0xd7, 0x13, 0x2e, 0xd0, 0xf2, 0xe5, 0xfd, 0xc2,
-  0x1a, 0xcb, 0x26, 0x3f, 0x89, 0x8d, 0x17, 0x12, 0x01, 0x55, 0x22, 0x97,
-  0x65, 0xda, 0x7b, 0x63, 0xf2, 0x8a, 0x75, 0xe5, 0x97, 0x5b, 0x16, 0x2d,
-  0x2d, 0x11, 0x3e, 0x8f, 0x4e, 0xc6, 0x02, 0x17, 0xc0, 0x45, 0x6d, 0x88,
-  0x62, 0x34, 0x66, 0x8f, 0x80, 0x86, 0x55, 0xaa, 0x7d, 0xac, 0xad, 0x43,
-  0x6e, 0x70, 0x13, 0xda, 0x36, 0x00, 0xeb, 0x08, 0x5b, 0xc6, 0x1e, 0xd8,
-  0x04, 0xb6, 0x8b, 0x0d, 0x90, 0x6d, 0x95, 0x5a, 0x74, 0xaf, 0xd4, 0xf3,
-  0x36, 0x4b, 0xe9, 0x05, 0xc0, 0xed, 0xd1, 0xf9, 0x92, 0xb1, 0xa5, 0x2c,
-  0x12, 0x32, 0x7a, 0x71, 0xd4, 0x58, 0x54, 0xc6, 0xf5, 0x0a, 0xbe, 0xfb,
-  0x1b, 0xb2, 0xab, 0x6d, 0x65, 0x72, 0x75, 0xe0, 0xab, 0x88, 0x28, 0x3c,
-  0x78, 0xe1, 0xbe, 0xce, 0x87, 0xe8, 0x66, 0xb5, 0xa6, 0xef, 0x30, 0xb5,
-  0xab, 0x00, 0xc0, 0xdd, 0x62, 0xe8, 0x89, 0xd6, 0xb8, 0xeb, 0x75, 0x2e,
-  0x6d, 0x73, 0xe2, 0x2d, 0x73, 0x4e, 0x38, 0x90, 0x52, 0x96, 0x7c, 0x2f,
-  0xbc, 0x71, 0xac, 0xcb, 0x50, 0xa7, 0x37, 0x88, 0x9f, 0xb1, 0xee, 0xdd,
-  0x22, 0x22, 0x85, 0x0e, 0x30, 0xde, 0x52, 0xce, 0x80, 0x4c, 0x77, 0x67,
-  0xab, 0x4d, 0xcc, 0x89, 0x1d, 0x7c, 0xad, 0xef, 0xc9, 0x39, 0x17, 0x42,
-  0x93, 0x49, 0x2f, 0xf8, 0xed, 0x62, 0xe8, 0x4b, 0x47, 0xb5, 0x1f, 0x05,
-  0xe1, 0xb4, 0x8b, 0xc0, 0x72, 0x14, 0xf1, 0x39, 0xd0, 0x9c, 0x96, 0x8b,
-  0x53, 0x91, 0x7b, 0x69, 0xdc, 0x2c, 0xef, 0x59, 0x25, 0xa6, 0x0b, 0xc6,
-  0x56, 0x0c, 0xcf, 0xb5, 0x23, 0x4c, 0x17, 0x8e, 0x90, 0xa7, 0xb8, 0xd0,
-  0x4a, 0x2b, 0x39, 0x78, 0x39, 0x74, 0x91, 0x22, 0x5a, 0xe8, 0xad, 0x2a,
-  0xf5, 0x50, 0xa5, 0x78, 0x91, 0xf3, 0x82, 0x76, 0xf5, 0x0d, 0x21, 0x26,
-  0xd6, 0x94, 0xcd, 0xea, 0x25, 0x9e, 0x25, 0x3c, 0x24, 0xce, 0x89, 0xa8,
-  0x1d, 0x25, 0xc7, 0x25, 0x55, 0xa7, 0x22, 0x47, 0x63, 0xb6, 0xb2, 0x4c,
-  0xbe, 0xfb, 0x9f, 0xc7, 0xa3, 0x85, 0x74, 0xe5, 0x8d, 0x2a, 0xcb, 0x27,
-  0x1d, 0xec, 0xc6, 0x2a, 0x10, 0x1f, 0x89, 0x10, 0x62, 0x15, 0xe1, 0x55,
-  0x0b, 0xb9, 0x01, 0xd7, 0xbc, 0xa2, 0x39, 0x3a, 0xd6, 0xa2, 0x92, 0x98,
-  0x1f, 0xb2, 0x92, 0xab, 0x35, 0x7e, 0x14, 0x85, 0xd5, 0x23, 0x69, 0xad,
-  0x0b, 0x45, 0xbe, 0x88, 0x22, 0x73, 0x6a, 0xb8, 0xa2, 0xf6, 0x9b, 0xee,
-  0x63, 0xcd, 0xd4, 0xd4, 0x11, 0x46, 0x48, 0x63, 0x60, 0x0b, 0x39, 0x05,
-  0xa8, 0x45, 0x38, 0x6e, 0x4d, 0x69, 0xb1, 0xd7, 0x42, 0x05, 0x8f, 0xc3,
-  0x7b, 0xd6, 0x2f, 0x55, 0x6c, 0x2b, 0x1a, 0x4a, 0x44, 0x52, 0x55, 0xb9,
-  0x05, 0xd9, 0xc4, 0x22, 0x61, 0xc5, 0x1e, 0xad, 0x4c, 0xd2, 0x81, 0x54,
-  0x1f, 0x53, 0x20, 0x9e, 0x0e, 0x3b, 0xcc, 0xaf, 0x44, 0x1c, 0xee, 0x2f,
-  0x8c, 0x2f, 0x99, 0x7a, 0xe9, 0xef, 0x58, 0x55, 0xdf, 0x6c, 0xc0, 0xef,
-  0xa0, 0x32, 0xa0, 0x6c, 0x29, 0x26, 0x09, 0x5e, 0x6c, 0xda, 0x61, 0xe2,
-  0xdc, 0xc4, 0x13, 0x12, 0xcf, 0xa2, 0x92, 0x1b, 0x4b, 0xdd, 0x83, 0x77,
-  0x78, 0xb5, 0x8e, 0xd4, 0xfd, 0x90, 0x0e, 0x27, 0xf8, 0x7e, 0x8e, 0x59,
-  0x81, 0x42, 0x32, 0x19, 0xcb, 0xbb, 0x1c, 0x81, 0x30, 0xe3, 0xc9, 0x5f,
-  0x41, 0xa9, 0xaa, 0x18, 0xd0, 0xec, 0xa2, 0xe3, 0x9f, 0x86, 0xb4, 0x53,
-  0x8d, 0x34, 0xdd, 0x6a, 0x91, 0xcf, 0xe9, 0xf2, 0xa8, 0x19, 0x6a, 0xc4,
-  0x21, 0xc5, 0x2a, 0x88, 0x99, 0x57, 0xcb, 0x50, 0xd6, 0x30, 0x64, 0x3e,
-  0x19, 0xfe, 0xe9, 0xaf, 0x44, 0xac, 0x7a, 0x41, 0xc9, 0xc8, 0x50, 0x69,
-  0xc9, 0xb2, 0xc5, 0x25, 0x79, 0x79, 0x49, 0x53, 0x38, 0xb2, 0x19, 0xaa,
-  0x1b, 0xe9, 0xd4, 0xc2, 0xa3, 0x85, 0xd1, 0xa0, 0x12, 0x1b, 0xc2, 0x89,
-  0x06, 0x83, 0x4d, 0xe8, 0xe1, 0x65, 0xf5, 0x8c, 0xd5, 0xa5, 0x99, 0x41,
-  0x83, 0x00, 0xfc, 0xbf, 0xef, 0xea, 0xe1, 0x96, 0x59, 0x03, 0x08, 0x0c,
-  0x56, 0x03, 0xff, 0xed, 0xd5, 0x1c, 0x1b, 0x0c, 0xd3, 0xdd, 0xa5, 0xca,
-  0x2c, 0x2b, 0x45, 0x23, 0x96, 0x29, 0xfe, 0xfb, 0xa0, 0xe2, 0x79, 0x1c,
-  0x04, 0x9c, 0x0e, 0x8c, 0x0e, 0x2b, 0x5c, 0x0e, 0x2b, 0x04, 0x43, 0xfa,
-  0x53, 0x18, 0xef, 0x0c, 0xcb, 0x75, 0x42, 0x06, 0x01, 0xb1, 0x22, 0x94,
-  0x65, 0x6a, 0x12, 0xe6, 0x54, 0xc0, 0x19, 0xb3, 0x08, 0x66, 0x61, 0xdc,
-  0x91, 0xd1, 0x3e, 0xeb, 0x85, 0x15, 0x2f, 0x9c, 0x58, 0xb6, 0xa0, 0x65,
-  0x61, 0xaf, 0x5c, 0x5b, 0x3f, 0x46, 0xbf, 0x2a, 0x0c, 0x2a, 0x58, 0xb9,
-  0xb2, 0x44, 0xed, 0xca, 0x1c, 0xc7, 0x15, 0xc9, 0x18, 0x73, 0xeb, 0x53,
-  0x4e, 0xe5, 0xaf, 0x1e, 0xb7, 0x5a, 0xa5, 0xe4, 0xd5, 0x13, 0x2c, 0x56,
-  0x59, 0xb2, 0x5c, 0x65, 0xd0, 0xc7, 0x25, 0xa7, 0x64, 0xa5, 0xd9, 0x58,
-  0xb6, 0x0e, 0xbb, 0xd8, 0xa1, 0xca, 0x0f, 0x7a, 0xd5, 0xa0, 0x5c, 0x85,
-  0xba, 0x57, 0x36, 0x56, 0xd5, 0xa4, 0x0c, 0x3b, 0x5e, 0x15, 0x70, 0x37,
-  0xa7, 0x12, 0x64, 0xa9, 0x9a, 0x59, 0xe8, 0x06, 0x48, 0x41, 0xd0, 0x3f,
-  0x41, 0x23, 0xd0, 0xe1, 0xcf, 0x28, 0x42, 0xfe, 0x93, 0x60, 0x0c, 0x9a,
-  0xf1, 0x11, 0xcc, 0xf1, 0x14, 0x74, 0xa3, 0x79, 0xf9, 0x22, 0x5c, 0xb6,
-  0x16, 0x1a, 0xdd, 0x83, 0x2a, 0x94, 0x3b, 0x66, 0xa9, 0x12, 0xd2, 0xcd,
-  0x69, 0x9e, 0x25, 0x35, 0x06, 0x21, 0x46, 0x43, 0x8e, 0x5e, 0xa1, 0x53,
-  0xdd, 0x38, 0x57, 0x2d, 0xe9, 0x05, 0x1b, 0x73, 0xb3, 0x72, 0x16, 0x6e,
-  0x54, 0x5b, 0xcd, 0xf8, 0x5f, 0x9f, 0x0a, 0x01, 0x26, 0x22, 0x6a, 0x9e,
-  0x62, 0xf7, 0x30, 0xaf, 0x80, 0x30, 0xa1, 0x99, 0xe0, 0xf1, 0x60, 0x39,
-  0xb1, 0x82, 0xda, 0x66, 0x27, 0x4a, 0x49, 0xca, 0x0d, 0x1c, 0xa3, 0xe3,
-  0xa9, 0xaf, 0x80, 0x90, 0x22, 0x92, 0x1f, 0x29, 0xf9, 0xdf, 0xd1, 0x47,
-  0x3a, 0xa1, 0x2c, 0x84, 0xcc, 0xdd, 0x7a, 0xf4, 0x69, 0x1e, 0x0d, 0x7d,
-  0x22, 0xe2, 0x4e, 0x8b, 0x59, 0x02, 0x42, 0x75, 0xf8, 0x62, 0x43, 0x2e,
-  0x2a, 0xc7, 0x37, 0x66, 0x3d, 0x3a, 0x72, 0xe4, 0x8c, 0xd7, 0x0e, 0xf5,
-  0xab, 0x58, 0xc6, 0xf5, 0xb8, 0x81, 0x3e, 0x70, 0xf2, 0x82, 0x97, 0xb8,
-  0x02, 0x4d, 0x6c, 0xdd, 0x9f, 0x41, 0xbf, 0xe0, 0x61, 0x74, 0xd1, 0x8e,
-  0x4d, 0x02, 0x13, 0xc1, 0x3d, 0x0e, 0x09, 0x7c, 0x3d, 0x5a, 0x90, 0x02,
-  0xce, 0xd5, 0x0e, 0x0f, 0x56, 0x7d, 0x7e, 0xc5, 0x95, 0xc6, 0xec, 0x56,
-  0xb7, 0x64, 0xca, 0x42, 0xaa, 0x0b, 0xde, 0xe8, 0xdd, 0xd1, 0x67, 0xc0,
-  0x13, 0x7f, 0x8e, 0x65, 0x66, 0x71, 0x67, 0x87, 0x4b, 0x50, 0x86, 0xfb,
-  0xdf, 0xdc, 0x44, 0x04, 0x4e, 0x1d, 0x1b, 0x83, 0xc3, 0xb7, 0xcb, 0xe2,
-  0x30, 0xc6, 0xd4, 0x79, 0x8f, 0xfc, 0xfd, 0x54, 0xf6, 0xe8, 0xa0, 0x44,
-  0x2d, 0x70, 0xbf, 0xfb, 0xc9, 0x57, 0x74, 0x70, 0xb8, 0xea, 0x75, 0xcd,
-  0xea, 0xb8, 0xca, 0x3b, 0xc6, 0xf1, 0xe2, 0xf7, 0x97, 0x99, 0xe3, 0xf3,
-  0x3d, 0xc7, 0xfc, 0x67, 0x78, 0xde, 0x8c, 0x38, 0x39, 0xdc, 0xec, 0x3b,
-  0x48, 0x3c, 0x4c, 0x78, 0xf3, 0x85, 0x0c, 0x19, 0x11, 0x69, 0x19, 0x28,
-  0x21, 0xcb, 0x57, 0x71, 0x8e, 0x44, 0x09, 0x5b, 0x70, 0x1a, 0xe7, 0xdc,
-  0x09, 0x4f, 0x90, 0xa6, 0xb3, 0x4f, 0xe8, 0x69, 0x1c, 0xa5, 0x62, 0xee,
-  0x49, 0x1c, 0xa7, 0xe1, 0xdc, 0x09, 0xd2, 0x70, 0x6e, 0x42, 0xe7, 0xf0,
-  0xa9, 0x46, 0x83, 0x70, 0x1d, 0xfd, 0x7a, 0xf4, 0xfb, 0xd1, 0xef, 0x80,
-  0xed, 0xff, 0x02, 0x18, 0xe9, 0xff, 0x1c, 0xfd, 0x12, 0xc4, 0xcc, 0xdf,
-  0x8e, 0xfe, 0x9f, 0xd1, 0xff, 0x89, 0x7d, 0xfc, 0xcf, 0xd1, 0xfb, 0xa3,
-  0x7f, 0x4a, 0x80, 0x7b, 0xbc, 0x0f, 0xcf, 0x7e, 0x39, 0xfa, 0x57, 0xf8,
-  0xf7, 0xfb, 0xa3, 0xff, 0x31, 0x7a, 0x1f, 0xab, 0xff, 0xbc, 0x0f, 0xff,
-  0xfc, 0x01, 0xfe, 0xfd, 0x6f, 0xf0, 0xf0, 0xd7, 0xa3, 0x7f, 0x23, 0x58,
-  0x8d, 0xc6, 0x72, 0xf8, 0xb0, 0x0f, 0x19, 0xc3, 0xc3, 0x07, 0xbd, 0xa3,
-  0xbe, 0x78, 0x02, 0x0e, 0xf9, 0xb0, 0xc5, 0x09, 0x26, 0x81, 0x48, 0x38,
-  0x7a, 0xcf, 0x56, 0x94, 0x61, 0xc2, 0x2e, 0x9c, 0x89, 0xcf, 0x94, 0xa0,
-  0x4e, 0x19, 0x89, 0xb3, 0xb6, 0x47, 0x9b, 0x12, 0x22, 0x81, 0x65, 0xc8,
-  0xb9, 0xa8, 0x4d, 0x4d, 0x94, 0xf8, 0xf3, 0x89, 0x16, 0x0a, 0x82, 0x86,
-  0xb5, 0x09, 0x51, 0x2c, 0x47, 0x84, 0x70, 0xe8, 0xf5, 0xb8, 0xe5, 0x87,
-  0xa3, 0x76, 0xff, 0xc4, 0x08, 0x0f, 0x2a, 0x3b, 0x8d, 0x03, 0xa9, 0x20,
-  0xfb, 0x8b, 0xe7, 0x59, 0x62, 0xd4, 0x7c, 0x0a, 0xfa, 0x6e, 0x3f, 0xdb,
-  0x21, 0x95, 0x8b, 0x9f, 0x47, 0x25, 0xa4, 0x0c, 0x29, 0xd6, 0xfc, 0xf8,
-  0xa6, 0x36, 0xbf, 0x53, 0xa6, 0xe9, 0x19, 0xbd, 0xaf, 0x4b, 0xc8, 0x44,
-  0x3b, 0xcd, 0xaf, 0xdd, 0x1c, 0x49, 0xe5, 0x72, 0x10, 0x33, 0x0e, 0xb4,
-  0xda, 0x6d, 0x15, 0xcd, 0xe1, 0xba, 0x18, 0xab, 0xe7, 0xda, 0xcb, 0xd8,
-  0x72, 0x8d, 0x45, 0xbb, 0xc4, 0x03, 0x2a, 0xc9, 0x84, 0x65, 0xf8, 0x64,
-  0x69, 0x07, 0x58, 0x63, 0x5e, 0x1e, 0x7e, 0x37, 0x22, 0xf7, 0xa2, 0xb2,
-  0x04, 0x10, 0x7b, 0x20, 0xad, 0xe7, 0xda, 0x71, 0xfc, 0x95, 0x7d, 0xb7,
-  0x65, 0xe9, 0xaf, 0x4c, 0x11, 0xba, 0x98, 0xeb, 0x64, 0x81, 0x6a, 0x09,
-  0xe3, 0x5f, 0xb5, 0x7a, 0x73, 0xd8, 0x5b, 0x59, 0xbd, 0xb1, 0x4a, 0x5e,
-  0x9a, 0xf0, 0x4b, 0x66, 0xff, 0xb8, 0x55, 0xad, 0xdf, 0x99, 0xb9, 0xab,
-  0x3d, 0x8b, 0xc5, 0x47, 0x95, 0xb9, 0xd9, 0xb3, 0x33, 0x8d, 0xd9, 0xb9,
-  0xc6, 0xfc, 0x6c, 0x85, 0x41, 0x04, 0xc6, 0x8f, 0x33, 0x8a, 0x18, 0x48,
-  0xaa, 0xbf, 0x26, 0x5e, 0xdc, 0x92, 0x4e, 0xd8, 0xe7, 0xc8, 0x03, 0x1b,
-  0xe1, 0xc8, 0x27, 0xb3, 0x73, 0xf8, 0x44, 0x79, 0x2e, 0xbb, 0xed, 0x67,
-  0xe7, 0xbd, 0xf6, 0xcf, 0x8b, 0xf6, 0xd4, 0x5c, 0x62, 0xb5, 0x9f, 0xa6,
-  0xaf, 0x2c, 0x88, 0x3c, 0x00, 0xb5, 0xe7, 0xeb, 0x68, 0xb3, 0xea, 0xd4,
-  0x48, 0x6d, 0x20, 0x5e, 0xef, 0x80, 0x68, 0xba, 0x3d, 0x50, 0x0d, 0x66,
-  0xe7, 0xfc, 0x16, 0xa5, 0xbd, 0xb7, 0x8f, 0xe2, 0x34, 0x8d, 0xa9, 0x29,
-  0x08, 0x72, 0x29, 0x9f, 0x6e, 0xbd, 0xb0, 0x4e, 0xd8, 0xad, 0xdb, 0x42,
-  0xa5, 0x1c, 0x8a, 0xe8, 0xef, 0x1d, 0x44, 0xcf, 0xca, 0xa6, 0x7b, 0xaa,
-  0x68, 0x8d, 0x7b, 0xee, 0xdf, 0x5e, 0x8b, 0x98, 0x27, 0xb8, 0xd7, 0xd0,
-  0x64, 0xa2, 0x97, 0x6f, 0x74, 0x6d, 0xf4, 0x80, 0x2b, 0x44, 0x20, 0xfc,
-  0xdd, 0xf8, 0x0b, 0x2b, 0x00, 0xf9, 0x2e, 0xc3, 0xaa, 0x55, 0xc4, 0x6b,
-  0xd8, 0xc7, 0xaf, 0x94, 0xd3, 0xb8, 0xe6, 0x31, 0x65, 0xfd, 0xc6, 0x31,
-  0x28, 0xfe, 0x51, 0x42, 0xf7, 0x16, 0x87, 0xc7, 0xc4, 0xdd, 0xc8, 0x7d,
-  0xdc, 0xc6, 0xf1, 0x28, 0x8f, 0xd0, 0x2e, 0x42, 0x3d, 0xdf, 0xbf, 0x3c,
-  0x34, 0x44, 0x99, 0x2b, 0x56, 0xbe, 0x89, 0x79, 0x99, 0x7b, 0x3d, 0x87,
-  0x1c, 0xce, 0x19, 0x37, 0x8e, 0xfb, 0x9c, 0xdb, 0x3d, 0xc9, 0x3c, 0xab,
-  0xec, 0xe3, 0xe2, 0x8a, 0x49, 0x91, 0xc6, 0xd3, 0x85, 0x38, 0x7b, 0x65,
-  0x2a, 0x64, 0x60, 0xce, 0x11, 0x97, 0xf8, 0x5f, 0xd1, 0x0a, 0x17, 0x16,
-  0x13, 0x4c, 0x17, 0x6c, 0xba, 0x8f, 0xfa, 0x37, 0xf8, 0x8c, 0xc0, 0x37,
-  0x98, 0x47, 0x31, 0xb0, 0x6c, 0xe7, 0xa1, 0x52, 0x2c, 0x81, 0xfd, 0xf2,
-  0xa9, 0xce, 0xd7, 0xfb, 0x96, 0xdc, 0x61, 0x32, 0xf1, 0x44, 0x3c, 0x54,
-  0xce, 0xdd, 0x9a, 0xef, 0x52, 0xf9, 0x45, 0x10, 0x83, 0x45, 0xea, 0x09,
-  0x90, 0x7b, 0xa7, 0x93, 0xc3, 0x9f, 0x88, 0x0d, 0xfa, 0x63, 0xaa, 0x7a,
-  0xf7, 0x10, 0x55, 0x0d, 0xa6, 0x07, 0x79, 0x55, 0x7e, 0x17, 0xa4, 0xa8,
-  0x5f, 0x06, 0x70, 0x3a, 0x7c, 0x67, 0x8c, 0x3d, 0xac, 0x19, 0xe5, 0x49,
-  0xec, 0xdb, 0xf0, 0x82, 0x38, 0x4a, 0x80, 0xc3, 0xc0, 0x86, 0x71, 0xb4,
-  0x18, 0x87, 0x81, 0x09, 0xc8, 0xfe, 0xcf, 0x19, 0xe6, 0x60, 0xab, 0xf8,
-  0x25, 0x35, 0xf2, 0x1c, 0xde, 0x8f, 0xe5, 0xdb, 0xaf, 0xc8, 0xfd, 0x38,
-  0xdc, 0xdf, 0xe7, 0xea, 0x63, 0xba, 0xfa, 0x07, 0x07, 0x3f, 0x89, 0xc8,
-  0x06, 0x54, 0x71, 0x9c, 0xe4, 0xc8, 0xc7, 0x0e, 0x6f, 0xc8, 0x4b, 0x46,
-  0xa0, 0x10, 0x5d, 0x71, 0xd2, 0x93, 0x88, 0x64, 0x26, 0xf2, 0xe9, 0xab,
-  0xf9, 0x11, 0x30, 0xfe, 0xf1, 0x6a, 0x41, 0xb5, 0x82, 0x62, 0xc6, 0xfc,
-  0x94, 0xe5, 0xcf, 0xba, 0xa3, 0x11, 0xb2, 0x92, 0x45, 0x8d, 0xc1, 0xb3,
-  0x02, 0x61, 0x9f, 0x2b, 0x98, 0x7c, 0x04, 0x60, 0xd9, 0x74, 0xe0, 0x41,
-  0xd8, 0x63, 0x22, 0xdc, 0xb4, 0xae, 0x30, 0x65, 0x79, 0x70, 0x2e, 0x10,
-  0xcd, 0xa0, 0x99, 0x2f, 0x3b, 0xd5, 0xf1, 0x11, 0xa8, 0x53, 0xd8, 0x72,
-  0xc1, 0xfd, 0xe8, 0x9c, 0xb8, 0xef, 0x1c, 0x61, 0x02, 0x6c, 0x54, 0xb4,
-  0x20, 0xa1, 0x3a, 0x1f, 0x37, 0xd1, 0x3c, 0x45, 0x99, 0xa9, 0x8f, 0x71,
-  0x57, 0x58, 0xbd, 0xb1, 0xdd, 0xc1, 0x13, 0xce, 0x7b, 0x21, 0x27, 0x99,
-  0x02, 0x50, 0x46, 0xd4, 0xcb, 0x1b, 0xcf, 0x62, 0xd4, 0x65, 0x4d, 0x77,
-  0x21, 0x33, 0x92, 0xc8, 0x9f, 0x76, 0x56, 0x92, 0x90, 0xee, 0x2c, 0x91,
-  0x6e, 0x3d, 0xa2, 0x3d, 0x69, 0xd3, 0x22, 0x49, 0x77, 0xf1, 0xdf, 0x8d,
-  0x76, 0xd6, 0x4f, 0x65, 0x2a, 0x4f, 0x68, 0x3a, 0x46, 0x26, 0x5e, 0xdf,
-  0xb3, 0x48, 0x68, 0xb0, 0xf5, 0x4a, 0x60, 0x2e, 0x44, 0x0a, 0x9b, 0xa6,
-  0x7e, 0x69, 0x8c, 0x72, 0x22, 0x71, 0x0d, 0xc8, 0x5e, 0xb6, 0x8f, 0x44,
-  0x14, 0xbe, 0x5c, 0x55, 0x21, 0xe8, 0xf2, 0xd5, 0x41, 0xd9, 0x74, 0xc1,
-  0xc6, 0x81, 0x46, 0x6f, 0x43, 0x77, 0x41, 0x88, 0x9c, 0x28, 0x9e, 0xf3,
-  0x8c, 0x97, 0x53, 0xe8, 0xcc, 0xee, 0x3d, 0xca, 0x2b, 0x14, 0x70, 0xab,
-  0x31, 0x7a, 0x1a, 0xae, 0xa2, 0x29, 0xe1, 0xec, 0x1e, 0x8e, 0xcc, 0x0d,
-  0x73, 0x8c, 0x69, 0xbd, 0x60, 0x5c, 0x06, 0x42, 0x38, 0x8c, 0xcb, 0x45,
-  0x40, 0xcc, 0x38, 0xd2, 0x77, 0x0e, 0xe3, 0x90, 0x50, 0x2c, 0xd4, 0x30,
-  0x6b, 0xe9, 0xf1, 0x78, 0x80, 0x90, 0x95, 0x31, 0x61, 0x6c, 0x38, 0xe3,
-  0xc4, 0x4a, 0x17, 0xfa, 0xca, 0xda, 0xfa, 0x56, 0x96, 0xf4, 0xfa, 0x1a,
-  0x05, 0xe1, 0xe8, 0x19, 0x29, 0xe1, 0x70, 0x3c, 0xb4, 0xf4, 0x55, 0x94,
-  0x0d, 0x76, 0x5a, 0x39, 0x36, 0xfe, 0x8d, 0x43, 0xfd, 0x8d, 0x43, 0xfd,
-  0xc7, 0xe6, 0x50, 0x54, 0xab, 0x4f, 0x2d, 0xad, 0x40, 0xd8, 0xc9, 0x84,
-  0x2e, 0x5a, 0x52, 0x26, 0x12, 0x50, 0xc4, 0x65, 0xa8, 0x94, 0xaa, 0x25,
-  0xb0, 0x47, 0x06, 0x46, 0xe1, 0x52, 0x5a, 0x5f, 0x83, 0x44, 0x09, 0xab,
-  0x5a, 0xd4, 0x45, 0xc9, 0xae, 0x9c, 0x54, 0xa5, 0x45, 0x72, 0x47, 0x2c,
-  0x0c, 0xae, 0x3e, 0xb9, 0x5b, 0xad, 0x9b, 0x98, 0x1e, 0x0d, 0x52, 0x6b,
-  0xb4, 0xcb, 0x01, 0xd4, 0xcd, 0x23, 0xe0, 0xa4, 0xa6, 0xbb, 0x1c, 0x30,
-  0xd9, 0x98, 0x83, 0xf2, 0xd8, 0xc9, 0x4b, 0xbd, 0xfd, 0x41, 0x0c, 0x1a,
-  0x15, 0x43, 0x6a, 0x7a, 0x7b, 0x5b, 0x86, 0x6d, 0x59, 0x23, 0x64, 0x92,
-  0xa5, 0x48, 0x7c, 0x8b, 0x11, 0x27, 0x35, 0xde, 0x49, 0x5d, 0xc4, 0x63,
-  0xe0, 0x6d, 0x7a, 0x39, 0x91, 0x19, 0x5c, 0x98, 0x8c, 0x89, 0xf7, 0xcd,
-  0x22, 0xba, 0xd0, 0x1e, 0xd4, 0x83, 0xd1, 0xda, 0xe7, 0x52, 0x00, 0xd4,
-  0x16, 0xb6, 0x3e, 0x3f, 0xb0, 0xca, 0x1a, 0xc9, 0x3b, 0xa6, 0x48, 0xec,
-  0x14, 0xa5, 0xf0, 0x1a, 0x87, 0x6a, 0x7d, 0x62, 0x4a, 0x64, 0x2d, 0x48,
-  0xb3, 0xbc, 0x17, 0x5b, 0x7c, 0x89, 0x25, 0x8b, 0x67, 0x24, 0xf4, 0x6d,
-  0x25, 0xc2, 0x16, 0xa0, 0xaa, 0xdc, 0xb0, 0x9a, 0x89, 0xec, 0x8a, 0x6a,
-  0xa2, 0x02, 0x2d, 0xe8, 0x56, 0x5c, 0x60, 0x4e, 0x17, 0x77, 0x0c, 0x2c,
-  0x3b, 0xca, 0x52, 0x7f, 0x53, 0x1c, 0xf1, 0xec, 0xdd, 0x98, 0x59, 0x10,
-  0x6a, 0x49, 0x30, 0x45, 0x71, 0xce, 0xe1, 0x49, 0x78, 0xba, 0x50, 0x21,
-  0x20, 0x23, 0x1b, 0xe4, 0x44, 0x89, 0x0c, 0xf8, 0x77, 0xf3, 0x63, 0x39,
-  0x27, 0xd3, 0x15, 0x15, 0x2e, 0xb9, 0x9b, 0x13, 0xea, 0x99, 0x43, 0x98,
-  0x63, 0x45, 0x7c, 0xe6, 0xc0, 0x1d, 0x2b, 0xf0, 0xd3, 0x8b, 0x71, 0x1e,
-  0x67, 0x47, 0xe8, 0xe6, 0x79, 0xbb, 0x41, 0x37, 0xf2, 0x76, 0x42, 0x6e,
-  0x7c, 0xa9, 0xf9, 0xce, 0xc2, 0xdc, 0x0b, 0xaf, 0x2f, 0x01, 0xed, 0x88,
-  0xab, 0x2e, 0x57, 0x11, 0x33, 0xb9, 0x15, 0x37, 0x46, 0x37, 0xe5, 0x57,
-  0xdb, 0x04, 0x63, 0x8b, 0x23, 0x30, 0x8f, 0xb4, 0xca, 0xc6, 0xd2, 0x10,
-  0xdb, 0x25, 0x26, 0xd5, 0x69, 0x5f, 0x36, 0x5c, 0x38, 0xac, 0x34, 0x0e,
-  0x44, 0xda, 0xe6, 0x49, 0x3d, 0x01, 0x15, 0xb5, 0x1f, 0xb9, 0xe7, 0x9a,
-  0x15, 0xc6, 0x08, 0xde, 0xd3, 0x69, 0x16, 0x4b, 0xc4, 0xef, 0x4d, 0xce,
-  0x32, 0x31, 0x66, 0x54, 0xdf, 0x3f, 0xfb, 0xf6, 0x81, 0x13, 0x8b, 0xed,
-  0xf3, 0x07, 0x40, 0xb7, 0x13, 0xf5, 0x38, 0x1a, 0xe9, 0xc7, 0xcf, 0x44,
-  0x75, 0x62, 0xe6, 0x1c, 0x87, 0x17, 0xe1, 0xc8, 0xed, 0xb6, 0xa9, 0x61,
-  0x6d, 0x80, 0xc0, 0x06, 0xf5, 0xe4, 0xe2, 0x45, 0x15, 0x92, 0x17, 0x8d,
-  0x80, 0x0b, 0x6f, 0x85, 0x8b, 0x4e, 0xc8, 0xcc, 0x45, 0xab, 0xc0, 0xef,
-  0x89, 0x45, 0xc4, 0xb9, 0x0b, 0xfc, 0xc9, 0x0c, 0x8a, 0x5b, 0x36, 0x17,
-  0x1e, 0xb7, 0x66, 0x9c, 0x17, 0xaf, 0xf3, 0x78, 0x23, 0xbe, 0xb4, 0x3d,
-  0xf8, 0xf1, 0x07, 0x7d, 0x1d, 0xa5, 0xeb, 0x13, 0x8c, 0xfb, 0x32, 0xb2,
-  0xc4, 0x24, 0x43, 0xbf, 0xfc, 0xad, 0xfc, 0x57, 0x12, 0x05, 0x16, 0xb6,
-  0xf2, 0x1d, 0x35, 0x10, 0x2c, 0x76, 0x1f, 0x3e, 0xe1, 0x58, 0x30, 0x0c,
-  0x44, 0xe7, 0x87, 0x93, 0xe2, 0x12, 0x0e, 0x27, 0x9d, 0x0e, 0xb0, 0xce,
-  0x69, 0x8f, 0xf5, 0x8d, 0x99, 0x11, 0x3a, 0xc7, 0x9d, 0x6d, 0x92, 0x48,
-  0x8d, 0x9b, 0x01, 0x5f, 0xba, 0xa0, 0xfe, 0x16, 0x0e, 0xac, 0x3f, 0x61,
-  0xbd, 0x53, 0xe1, 0xae, 0xe2, 0x3a, 0xa2, 0xda, 0x7a, 0xa1, 0xf4, 0xde,
-  0x50, 0xe9, 0x85, 0xf8, 0xf5, 0xdf, 0xe8, 0x86, 0x82, 0xcc, 0xcd, 0x4b,
-  0x2f, 0xbf, 0xde, 0xd9, 0xeb, 0x2b, 0x87, 0x6c, 0x35, 0x78, 0xb4, 0x4a,
-  0xf9, 0x91, 0x66, 0xb0, 0x15, 0xd4, 0x4a, 0xe7, 0xd4, 0x2d, 0x33, 0xb0,
-  0xdf, 0x91, 0xfd, 0xff, 0x61, 0xc8, 0x21, 0xd9, 0x1a, 0x14, 0x6e, 0x56,
-  0x4b, 0x99, 0x46, 0x7a, 0x83, 0xc0, 0x90, 0xf4, 0x4b, 0x4f, 0x99, 0x06,
-  0xd2, 0xc0, 0xa3, 0x3c, 0x7d, 0x1a, 0xef, 0x42, 0x29, 0x26, 0x02, 0x1d,
-  0xc8, 0x57, 0x07, 0xf6, 0x80, 0xa7, 0xb4, 0x5b, 0x79, 0x09, 0x97, 0xf2,
-  0x77, 0xe1, 0xed, 0x2f, 0x47, 0xbf, 0xd1, 0xef, 0xfe, 0x6f, 0xfc, 0xe8,
-  0xb7, 0xa3, 0x3f, 0xc0, 0x83, 0x7f, 0x86, 0x97, 0xbf, 0xa0, 0x76, 0xef,
-  0x6a, 0x17, 0xe0, 0x20, 0x21, 0x27, 0xa3, 0xbe, 0x9c, 0xb3, 0xd5, 0x97,
-  0xdb, 0x67, 0x14, 0x58, 0x9e, 0x43, 0x7e, 0xf4, 0x2e, 0xb9, 0x68, 0x7c,
-  0xc1, 0x8b, 0xcf, 0x3e, 0x14, 0xa5, 0x8f, 0xe1, 0xc5, 0x87, 0xe4, 0xb9,
-  0xfc, 0xb6, 0x55, 0x9f, 0x21, 0xff, 0x3c, 0x71, 0xed, 0x90, 0xb9, 0xde,
-  0xab, 0x7f, 0x79, 0x3f, 0xa6, 0x39, 0x74, 0x02, 0x57, 0xb9, 0xfe, 0xda,
-  0x09, 0xc2, 0x72, 0x97, 0x87, 0xd6, 0x9f, 0xe7, 0x68, 0x91, 0xbf, 0x62,
-  0x4d, 0xf2, 0x44, 0xb5, 0xc9, 0x39, 0x1a, 0xe5, 0x89, 0x69, 0x95, 0x8f,
-  0xaa, 0x59, 0xce, 0x26, 0xa5, 0x51, 0xf6, 0x18, 0xbd, 0x57, 0x1c, 0x80,
-  0x6f, 0x55, 0x75, 0xd4, 0x78, 0x65, 0x4d, 0xaa, 0xa3, 0xf7, 0x90, 0xc7,
-  0xd2, 0x65, 0x81, 0x4a, 0x29, 0x7f, 0x3e, 0x7a, 0x08, 0xc7, 0xfd, 0x9d,
-  0x2a, 0xec, 0xe9, 0x2f, 0xe1, 0x0f, 0xf4, 0x5c, 0x7a, 0x93, 0xfe, 0xfb,
-  0xfb, 0xc3, 0xd7, 0xe9, 0xbf, 0xff, 0x2a, 0x7f, 0xff, 0x4e, 0x3d, 0x1f,
-  0x7d, 0x20, 0xdb, 0xbd, 0x51, 0xbd, 0x3b, 0x6d, 0xe4, 0x6f, 0xf4, 0xb6,
-  0xd5, 0x87, 0x45, 0x15, 0x7f, 0x29, 0xc4, 0x72, 0x90, 0xf9, 0x0d, 0xec,
-  0xb1, 0x37, 0x0e, 0xdf, 0x39, 0xfc, 0xfb, 0xc3, 0xb7, 0x05, 0x16, 0xff,
-  0x06, 0x88, 0x7d, 0x48, 0xf0, 0xff, 0x2f, 0x40, 0x4e, 0xfc, 0xf5, 0x1b,
-  0xb8, 0xec, 0x08, 0x5c, 0x7e, 0x81, 0x11, 0x5b, 0xea, 0xd9, 0xe8, 0x53,
-  0xfa, 0xeb, 0xd7, 0x87, 0x3f, 0x97, 0x98, 0xe3, 0x5f, 0x9f, 0xcb, 0x76,
-  0x1f, 0x8e, 0x3e, 0x92, 0xd8, 0x7e, 0x22, 0xdf, 0xbe, 0x3f, 0xfa, 0x4c,
-  0x8e, 0xe0, 0xb7, 0x18, 0x19, 0x47, 0x7f, 0xbd, 0x87, 0x35, 0x83, 0xac,
-  0x51, 0x08, 0xa7, 0x60, 0x33, 0x0e, 0xf1, 0x1b, 0x47, 0x52, 0xae, 0x9e,
-  0xcb, 0xd8, 0x81, 0xdc, 0x39, 0xa1, 0x4e, 0x6a, 0x79, 0xb8, 0x3b, 0x0d,
-  0xee, 0x4e, 0x7b, 0x3b, 0x5d, 0x67, 0xb3, 0x51, 0x23, 0xda, 0x1c, 0x72,
-  0xc3, 0x9d, 0xb5, 0xf7, 0x5b, 0xd9, 0xa8, 0x65, 0x47, 0x79, 0xa4, 0xf6,
-  0xc6, 0x0c, 0x0a, 0xa5, 0xa1, 0x2b, 0x9d, 0x13, 0xa9, 0x27, 0x23, 0x1f,
-  0xa2, 0x21, 0xc8, 0xb6, 0x8b, 0xce, 0x44, 0x23, 0xf2, 0x8e, 0x39, 0xc2,
-  0xd9, 0x9c, 0x11, 0xce, 0x4e, 0x60, 0x84, 0xb3, 0x79, 0x23, 0xd4, 0x39,
-  0x7a, 0xe0, 0xaf, 0x2f, 0x46, 0x0f, 0x27, 0x3d, 0xb6, 0xb9, 0x9c, 0xb1,
-  0xcd, 0x4d, 0x60, 0x6c, 0x22, 0x6e, 0xed, 0xf7, 0xee, 0x3a, 0x67, 0x91,
-  0x7f, 0xa3, 0x07, 0x93, 0x1e, 0xd3, 0x7c, 0xce, 0x98, 0xe6, 0x27, 0x30,
-  0xa6, 0x79, 0x1a, 0xd3, 0x6f, 0x47, 0x0f, 0x61, 0x3b, 0x7f, 0x32, 0xfa,
-  0x68, 0xf4, 0x28, 0x5e, 0x02, 0x38, 0x10, 0xf9, 0x1e, 0xd5, 0x1e, 0x06,
-  0x23, 0xe3, 0x72, 0x66, 0x26, 0x2f, 0x42, 0xae, 0x30, 0xd0, 0xab, 0x54,
-  0x54, 0x9c, 0x0a, 0xee, 0xe2, 0x6a, 0x53, 0xfb, 0x5e, 0x17, 0x09, 0x64,
-  0x2b, 0xd6, 0xa3, 0xd7, 0x0f, 0xb4, 0xd0, 0xf8, 0x2b, 0x29, 0x10, 0xe2,
-  0x3f, 0xef, 0x2f, 0x24, 0xa3, 0x0f, 0x40, 0xd0, 0xfa, 0x1c, 0x24, 0x56,
-  0xd1, 0x52, 0x70, 0x5b, 0xda, 0xea, 0xb4, 0xd1, 0x0f, 0x7f, 0xa6, 0xa2,
-  0x14, 0x9c, 0x48, 0x31, 0x3f, 0x4a, 0x2a, 0x47, 0x29, 0x91, 0x4b, 0x93,
-  0xdc, 0xb0, 0x37, 0x9b, 0x26, 0x5e, 0x29, 0xf4, 0x48, 0xa4, 0x5a, 0x19,
-  0x03, 0x40, 0x20, 0x8b, 0x59, 0xb9, 0x20, 0xb5, 0x48, 0x78, 0xda, 0x91,
-  0xfb, 0x2c, 0x13, 0x99, 0x56, 0x40, 0x6d, 0xff, 0xae, 0x59, 0xf2, 0x90,
-  0x1c, 0x2f, 0x64, 0xfd, 0x89, 0x39, 0x22, 0x7d, 0xdb, 0x8a, 0x13, 0x91,
-  0x1d, 0x89, 0x72, 0x2d, 0xe0, 0x44, 0xbe, 0xeb, 0x6a, 0x20, 0xcd, 0xc9,
-  0xa4, 0x99, 0x6b, 0x7c, 0x2c, 0x14, 0x17, 0x2d, 0x92, 0x91, 0x4c, 0x74,
-  0x28, 0x26, 0xd1, 0xc8, 0xb8, 0x4c, 0x35, 0xd7, 0x1c, 0x33, 0x89, 0x50,
-  0xe3, 0x27, 0x85, 0x91, 0x06, 0x4d, 0x44, 0xff, 0x59, 0x99, 0x68, 0xc4,
-  0xb6, 0x75, 0x62, 0x0c, 0x74, 0x9c, 0xfe, 0x1e, 0x23, 0xf3, 0x74, 0x03,
-  0x77, 0x4b, 0x84, 0xec, 0x7a, 0xe6, 0xb3, 0x63, 0x45, 0xed, 0x96, 0x89,
-  0xd7, 0x2d, 0xd1, 0x63, 0xe9, 0x90, 0xdd, 0x82, 0x42, 0x76, 0xca, 0x3c,
-  0x77, 0xdc, 0x64, 0xba, 0x81, 0x00, 0xc4, 0xd2, 0xd1, 0x35, 0x25, 0x21,
-  0x46, 0x32, 0xe4, 0x3a, 0xa5, 0xe0, 0x72, 0x32, 0xe4, 0x3a, 0x2d, 0xad,
-  0x0c, 0xb9, 0x4e, 0x90, 0x4e, 0x6e, 0x52, 0x5b, 0xb7, 0xf8, 0xdc, 0x74,
-  0x21, 0x52, 0xc1, 0xa4, 0xb6, 0xba, 0xcb, 0xb2, 0x79, 0x6d, 0xa3, 0xda,
-  0x55, 0xad, 0x53, 0x06, 0xe6, 0x2c, 0xf1, 0x74, 0x22, 0xa9, 0x65, 0x5d,
-  0x70, 0xde, 0x42, 0x18, 0xb2, 0x9b, 0x43, 0x58, 0xba, 0x35, 0x63, 0x92,
-  0x95, 0x6d, 0x03, 0xde, 0x68, 0xb2, 0x08, 0xbc, 0x84, 0x54, 0xd2, 0x21,
-  0x8d, 0x2b, 0x8d, 0x55, 0x1f, 0x1a, 0x9d, 0xa5, 0x25, 0x0e, 0x34, 0xd0,
-  0x25, 0xb2, 0xba, 0xab, 0xf7, 0xb2, 0xc1, 0xb0, 0x8c, 0x97, 0x68, 0x73,
-  0xd0, 0xdb, 0x49, 0x6b, 0xb5, 0x81, 0xd2, 0xcc, 0x0d, 0x6c, 0xff, 0x37,
-  0xe8, 0x4c, 0x75, 0x4c, 0x55, 0xdd, 0xb1, 0x3e, 0x9c, 0xb2, 0x98, 0xab,
-  0x5a, 0x24, 0x59, 0xb7, 0xd5, 0x51, 0x25, 0xe4, 0x45, 0x5b, 0x8d, 0xb3,
-  0xc6, 0x44, 0x57, 0x18, 0x61, 0x8d, 0xc3, 0x51, 0x8c, 0x22, 0x4a, 0xe4,
-  0xa8, 0x51, 0x8b, 0xc2, 0x2f, 0xd9, 0x9d, 0x2e, 0x4c, 0x4b, 0xae, 0x3a,
-  0xf6, 0x8b, 0xd3, 0xad, 0xc1, 0xa1, 0xf6, 0xc5, 0xe1, 0x3b, 0x49, 0xe5,
-  0x99, 0xd7, 0x64, 0xff, 0x70, 0x9e, 0x1f, 0xbe, 0x05, 0x67, 0x0a, 0x0a,
-  0x85, 0x70, 0xd5, 0xff, 0x07, 0x52, 0x10, 0xbd, 0x09, 0xb2, 0x0e, 0x15,
-  0x74, 0x6e, 0xe2, 0x29, 0xc8, 0xd3, 0xa2, 0x3c, 0xa2, 0x64, 0xc6, 0xf8,
-  0xbd, 0xee, 0xe5, 0xa0, 0xc2, 0x4b, 0x9c, 0x95, 0x73, 0x43, 0xf6, 0xe7,
-  0xde, 0xc6, 0xdb, 0xf3, 0x70, 0xc4, 0x42, 0xa2, 0x47, 0x73, 0xb9, 0x6c,
-  0x12, 0xc3, 0x1c, 0xc0, 0xbe, 0x6c, 0x72, 0x73, 0x73, 0x55, 0xaf, 0x68,
-  0xde, 0x85, 0x5d, 0xd6, 0x90, 0x8c, 0xbf, 0xaa, 0xde, 0xfd, 0x92, 0x85,
-  0x8b, 0xeb, 0x7a, 0xd7, 0xb4, 0x0c, 0xc6, 0xd5, 0xba, 0x95, 0x3b, 0x57,
-  0x7d, 0x78, 0x7d, 0x6f, 0x67, 0x9d, 0x9c, 0x21, 0xb4, 0xdd, 0x78, 0x51,
-  0x16, 0x40, 0x30, 0xfd, 0x58, 0x9e, 0x01, 0x6b, 0xc6, 0xd4, 0x6c, 0xc3,
-  0x60, 0xf6, 0x66, 0x6d, 0x63, 0x36, 0x13, 0x22, 0x75, 0xb2, 0x6b, 0x8b,
-  0x47, 0xf0, 0x39, 0x09, 0xa5, 0xc9, 0x5e, 0xa5, 0xda, 0xe1, 0x6e, 0x9e,
-  0xec, 0x95, 0xfc, 0xa2, 0x27, 0xb2, 0xe0, 0x78, 0xc8, 0x43, 0x43, 0xbc,
-  0x09, 0xfa, 0x65, 0x44, 0x72, 0x6a, 0xcf, 0xd0, 0xc1, 0x89, 0xfe, 0x15,
-  0x78, 0x73, 0x31, 0x99, 0x95, 0x0b, 0x12, 0x6b, 0x1f, 0x44, 0x93, 0x6b,
-  0x4b, 0x1c, 0xac, 0xec, 0xda, 0xe2, 0x19, 0x71, 0x06, 0xfa, 0xcb, 0x76,
-  0xa0, 0x32, 0x39, 0xb6, 0x65, 0x43, 0xdf, 0x11, 0xc3, 0xf8, 0x56, 0xa9,
-  0x48, 0x81, 0xa5, 0xd8, 0xd8, 0x5d, 0xdf, 0x0b, 0x99, 0x81, 0x1b, 0x5f,
-  0x3a, 0x95, 0x02, 0x83, 0x39, 0xbc, 0x25, 0x7c, 0x99, 0xc4, 0x5b, 0xf7,
-  0xc6, 0xb2, 0x78, 0x8b, 0x27, 0xc1, 0x1c, 0xde, 0x72, 0x74, 0x5e, 0x12,
-  0x6f, 0x46, 0xe0, 0x84, 0xfb, 0x36, 0xf0, 0x2c, 0xde, 0xd2, 0x99, 0x49,
-  0x52, 0x23, 0x6c, 0xe0, 0x54, 0xcb, 0xe6, 0x66, 0xd6, 0x1e, 0x73, 0xcd,
-  0xec, 0x66, 0xed, 0xd0, 0x82, 0xc1, 0xc7, 0xe3, 0xae, 0x96, 0xdf, 0x01,
-  0xe3, 0x7a, 0xaf, 0x41, 0x96, 0xa6, 0x8f, 0x80, 0x97, 0x7d, 0x7e, 0xf8,
-  0x0e, 0x5d, 0xe6, 0x26, 0xb0, 0x74, 0x10, 0x1b, 0xb6, 0x18, 0xe0, 0x27,
-  0x5b, 0x09, 0xd1, 0xbc, 0xeb, 0x99, 0x9e, 0xaf, 0x6c, 0x9c, 0xb9, 0x02,
-  0xe8, 0xfe, 0x44, 0xd1, 0xd8, 0xa2, 0x53, 0x24, 0x12, 0xad, 0xe7, 0x4d,
-  0x90, 0xcc, 0xb6, 0x6e, 0x8a, 0xc6, 0xca, 0xac, 0x71, 0x47, 0xc8, 0xbc,
-  0x6e, 0xc3, 0x70, 0xdd, 0xb7, 0xf2, 0xe2, 0x3b, 0xf0, 0xd3, 0x40, 0x62,
-  0x73, 0x03, 0x10, 0xc7, 0xfa, 0xda, 0x01, 0xfb, 0xa2, 0x65, 0xb9, 0x36,
-  0x61, 0xcb, 0xf2, 0x6e, 0x4d, 0x8d, 0x59, 0x13, 0xe3, 0x9c, 0x0d, 0xe8,
-  0xca, 0xa1, 0xbd, 0x3c, 0x6b, 0x2d, 0x57, 0xc1, 0xae, 0xbd, 0xa4, 0x03,
-  0xde, 0x5a, 0x40, 0xdf, 0x5c, 0x0b, 0x6a, 0x69, 0x3b, 0x9d, 0x67, 0xbc,
-  0xfe, 0x03, 0x5a, 0x47, 0xe8, 0x0c, 0x7e, 0x80, 0xb1, 0xf0, 0x21, 0x3d,
-  0xfc, 0x03, 0xcf, 0xaa, 0x4d, 0x8e, 0x1c, 0x64, 0xb4, 0x04, 0x7a, 0x34,
-  0xa4, 0xb4, 0xd4, 0xa0, 0x65, 0xd7, 0x90, 0x37, 0x74, 0x83, 0x1a, 0x0c,
-  0xa8, 0x31, 0xc8, 0x7e, 0x90, 0x2e, 0x24, 0xb3, 0xcd, 0xb9, 0x74, 0x67,
-  0x31, 0xa1, 0x27, 0xfb, 0x69, 0xb6, 0xb5, 0x3d, 0x5c, 0x48, 0xd6, 0x7b,
-  0x9d, 0xf6, 0x22, 0xaa, 0x72, 0xb0, 0xbc, 0xe9, 0x56, 0x9f, 0x8a, 0xc4,
-  0x9b, 0xcb, 0x54, 0xe3, 0x74, 0x23, 0xf9, 0xf7, 0x07, 0x97, 0xf5, 0x6d,
-  0xca, 0x98, 0xfd, 0x0a, 0x75, 0x51, 0x63, 0x93, 0x26, 0xa0, 0x2e, 0x52,
-  0x44, 0x0a, 0x25, 0xbc, 0x0b, 0x91, 0xea, 0xf0, 0xad, 0x5c, 0x07, 0x80,
-  0x2e, 0x1d, 0xa3, 0x3c, 0x47, 0x38, 0x2e, 0x27, 0xcc, 0xc6, 0xc0, 0x16,
-  0x20, 0xba, 0xc3, 0x9d, 0xf5, 0x3d, 0x19, 0x0a, 0xd2, 0x3d, 0xb3, 0xb2,
-  0xce, 0x36, 0xbc, 0xea, 0xb4, 0xf1, 0x3d, 0x65, 0xe9, 0xc4, 0xeb, 0x8e,
-  0x67, 0x01, 0x10, 0x79, 0x2c, 0xea, 0x5a, 0x9a, 0x3e, 0xad, 0x20, 0x48,
-  0x0c, 0xeb, 0x03, 0x2a, 0xbd, 0x4e, 0xd4, 0x92, 0x9e, 0x8b, 0x25, 0x75,
-  0x7d, 0x63, 0x28, 0xb7, 0x70, 0xcc, 0x98, 0xa4, 0x4c, 0xd3, 0x73, 0xb0,
-  0xd3, 0xeb, 0x0d, 0xb7, 0x3b, 0xf7, 0x29, 0x9f, 0x18, 0x52, 0x16, 0x2e,
-  0x3c, 0xf2, 0x51, 0x71, 0x11, 0xf8, 0x71, 0x28, 0x6c, 0xe0, 0x56, 0x99,
-  0xf2, 0xee, 0x77, 0x30, 0x68, 0xb4, 0xf9, 0xa0, 0xbc, 0x5a, 0xbb, 0xf9,
-  0xdd, 0x17, 0xeb, 0xe3, 0xeb, 0xeb, 0xbc, 0x21, 0xf5, 0xba, 0x3a, 0x43,
-  0xd9, 0x63, 0x1b, 0x90, 0x51, 0xe1, 0x91, 0xc6, 0xe5, 0xb4, 0x52, 0x84,
-  0xc4, 0xb5, 0x78, 0xe3, 0xad, 0x16, 0xf4, 0x03, 0xf2, 0xec, 0x63, 0x27,
-  0xb3, 0x3c, 0xae, 0xa8, 0x6d, 0xaf, 0x09, 0x9a, 0x75, 0x37, 0x40, 0x74,
-  0x19, 0xa4, 0x6c, 0x8d, 0xac, 0xc8, 0x47, 0x93, 0x26, 0xa9, 0x82, 0xcb,
-  0xd7, 0x08, 0x8c, 0x9d, 0x7c, 0x78, 0x48, 0xad, 0xfb, 0x53, 0x6d, 0x1c,
-  0xac, 0xa1, 0x60, 0x00, 0xfb, 0x06, 0x77, 0xcf, 0x87, 0x47, 0x5c, 0x37,
-  0xfe, 0x58, 0xdb, 0xa9, 0x19, 0xeb, 0xa9, 0xc7, 0x37, 0x58, 0xae, 0x02,
-  0x96, 0xa3, 0xc5, 0x51, 0xfe, 0x91, 0x8d, 0xf6, 0xd1, 0xe1, 0x8f, 0x69,
-  0xb3, 0xfc, 0x91, 0xbc, 0x13, 0xe8, 0x69, 0x7d, 0x12, 0xcb, 0x4b, 0xb2,
-  0x6b, 0x26, 0x53, 0xfa, 0x47, 0x97, 0x50, 0x57, 0x8e, 0xc7, 0x50, 0x51,
-  0x74, 0x5d, 0x69, 0x17, 0xb2, 0x52, 0xae, 0xfb, 0xb5, 0xaf, 0x2f, 0x92,
-  0xd1, 0x0b, 0x38, 0xda, 0xab, 0xcf, 0x56, 0x1e, 0x8e, 0x3d, 0xcc, 0xdf,
-  0x32, 0x61, 0xf2, 0x53, 0xd8, 0xa1, 0x0f, 0x13, 0x21, 0xa4, 0x4d, 0x66,
-  0xcc, 0x42, 0x28, 0x04, 0x71, 0x9a, 0x44, 0x94, 0xb1, 0xc6, 0xce, 0x64,
-  0x70, 0x39, 0x70, 0x1b, 0xd8, 0xb1, 0x09, 0x80, 0x6c, 0x04, 0xdd, 0x3a,
-  0x3e, 0x15, 0x6a, 0x03, 0x61, 0x29, 0x41, 0x9e, 0xf2, 0x10, 0x15, 0x0a,
-  0xc8, 0x5a, 0x3e, 0xa0, 0x23, 0xf9, 0x6d, 0xed, 0x6e, 0xf8, 0xf0, 0x64,
-  0x18, 0xcc, 0x25, 0x7b, 0xc7, 0x91, 0x03, 0x45, 0xab, 0xd8, 0x73, 0x62,
-  0xaa, 0x20, 0x77, 0xec, 0x2d, 0x0d, 0x5a, 0xaa, 0xd2, 0x3c, 0xcf, 0x09,
-  0xbc, 0x59, 0x58, 0x59, 0x77, 0xe1, 0x1f, 0x79, 0xfc, 0x7e, 0x8e, 0xdc,
-  0xf4, 0x28, 0x1c, 0xc4, 0x19, 0xcc, 0x6c, 0x68, 0x30, 0xb3, 0x13, 0x18,
-  0x8c, 0x70, 0x92, 0xf8, 0x05, 0xba, 0xea, 0xc0, 0xcc, 0x7c, 0x68, 0x24,
-  0x05, 0x1c, 0xd2, 0x69, 0x62, 0x09, 0x0f, 0xc2, 0x2f, 0x2d, 0x2f, 0x0a,
-  0xbc, 0x3c, 0x85, 0x58, 0x86, 0x57, 0x11, 0x02, 0x65, 0x54, 0xb2, 0x91,
-  0x28, 0xb3, 0x52, 0xd8, 0x9a, 0xc4, 0xe5, 0xf3, 0x90, 0x29, 0x49, 0x16,
-  0x56, 0x69, 0x0c, 0x7b, 0x01, 0x4f, 0x37, 0x6e, 0x2b, 0xf9, 0xdc, 0x77,
-  0x6e, 0x3d, 0xda, 0x26, 0x94, 0x86, 0x9d, 0x12, 0x7b, 0x2f, 0x9e, 0x87,
-  0x16, 0xf7, 0x9f, 0x9f, 0x87, 0xde, 0x35, 0x5b, 0x44, 0x1c, 0x8a, 0x7d,
-  0x35, 0xaf, 0x37, 0x99, 0x6c, 0x81, 0xc8, 0x70, 0xaf, 0xf8, 0xe5, 0xea,
-  0x28, 0xe5, 0x36, 0xc7, 0x84, 0x77, 0x87, 0xe1, 0x73, 0x97, 0xd7, 0xa9,
-  0x1c, 0x3b, 0x1f, 0x50, 0xd5, 0x5f, 0x37, 0xd5, 0x09, 0xa4, 0x3f, 0xf2,
-  0xaf, 0x7d, 0xd1, 0x5c, 0x40, 0xf1, 0x48, 0x72, 0x26, 0xde, 0x07, 0xc2,
-  0xc9, 0x99, 0xf4, 0xaf, 0x4d, 0x35, 0xe4, 0xdb, 0x2f, 0x27, 0x48, 0xf8,
-  0xf9, 0xef, 0xf6, 0xe9, 0xbf, 0x57, 0xd2, 0xcd, 0xd6, 0x5e, 0x67, 0x58,
-  0xcb, 0x8d, 0x5c, 0xb7, 0xfb, 0x83, 0x76, 0xbd, 0x7e, 0xb6, 0x85, 0x9a,
-  0xbf, 0x40, 0x57, 0xb9, 0x79, 0xf8, 0xe2, 0x73, 0x29, 0x83, 0x84, 0xe3,
-  0x5a, 0x02, 0x81, 0x9f, 0x93, 0xdb, 0xcd, 0x3d, 0x00, 0x83, 0x97, 0xb2,
-  0xb7, 0x85, 0xeb, 0x81, 0xb2, 0x7f, 0x91, 0xde, 0x85, 0x42, 0xd6, 0x74,
-  0xcc, 0x9a, 0xb2, 0xc9, 0x10, 0x0d, 0xad, 0xf1, 0x36, 0x06, 0xe2, 0x61,
-  0x35, 0x14, 0xc1, 0x76, 0x0c, 0x42, 0xd3, 0x22, 0x8a, 0x13, 0x51, 0x47,
-  0x4e, 0xe6, 0x68, 0x2a, 0xf2, 0xe8, 0x9c, 0x07, 0x5a, 0xa9, 0x89, 0xcb,
-  0xce, 0x75, 0xe1, 0xa4, 0x8c, 0x47, 0xc5, 0x40, 0x19, 0x45, 0x36, 0x28,
-  0x1d, 0x65, 0x88, 0x44, 0xeb, 0xa3, 0xf5, 0x09, 0xd8, 0x0e, 0xa2, 0x0a,
-  0xa7, 0x56, 0x4f, 0x1a, 0xa1, 0x9a, 0xcc, 0x0a, 0x85, 0x06, 0x92, 0xfc,
-  0xc5, 0x28, 0xea, 0x7c, 0x7a, 0xb5, 0x3a, 0x4d, 0xdb, 0x63, 0x17, 0xec,
-  0x64, 0x8b, 0x58, 0x4d, 0xdb, 0x51, 0xf7, 0x47, 0x71, 0x0f, 0x8a, 0x82,
-  0xb9, 0x0b, 0xa3, 0x10, 0x4c, 0xd9, 0x89, 0x8d, 0x9a, 0x1b, 0x6d, 0xe9,
-  0xdf, 0x8a, 0x2a, 0xca, 0xe1, 0xd7, 0x96, 0x6e, 0xbb, 0x68, 0x29, 0x6c,
-  0x08, 0x5c, 0x42, 0x66, 0xc8, 0x69, 0x4d, 0x60, 0xb3, 0x60, 0xd6, 0x5b,
-  0x28, 0x93, 0x40, 0xeb, 0x66, 0xc8, 0x48, 0xd9, 0x6a, 0xa3, 0xf4, 0xe9,
-  0x66, 0x72, 0xbe, 0x89, 0x55, 0x28, 0xc3, 0x49, 0x9c, 0x95, 0xba, 0xb3,
-  0x16, 0x50, 0xc4, 0xc6, 0x33, 0x35, 0x33, 0x20, 0xc2, 0x28, 0x94, 0xb6,
-  0x17, 0x92, 0x0a, 0x00, 0x03, 0x09, 0x8d, 0xd8, 0xd4, 0x07, 0xd2, 0x19,
-  0x0a, 0xfe, 0x65, 0x27, 0x88, 0x96, 0xba, 0xa5, 0x47, 0xe8, 0x2f, 0x93,
-  0x44, 0x15, 0xc9, 0xa3, 0x07, 0x32, 0xe3, 0xf2, 0xb7, 0x48, 0x06, 0x69,
-  0xca, 0xe4, 0xbe, 0xdf, 0xca, 0x16, 0x92, 0x99, 0xe6, 0x59, 0xf9, 0x03,
-  0xba, 0x9c, 0x6b, 0xce, 0xe4, 0x26, 0xe6, 0xc5, 0x51, 0xd4, 0x43, 0x3a,
-  0xe6, 0x58, 0xfa, 0x5d, 0xd2, 0x86, 0xab, 0x2c, 0x62, 0x40, 0xb6, 0xbc,
-  0xe3, 0x02, 0xdb, 0xf2, 0xec, 0xa3, 0xd0, 0x3c, 0x3f, 0xf1, 0x28, 0x34,
-  0x88, 0xe4, 0x1c, 0xe5, 0x4a, 0xf8, 0xfc, 0x44, 0xba, 0x38, 0xbb, 0x63,
-  0xe4, 0xd0, 0x3d, 0x7c, 0xcb, 0x56, 0xc6, 0x7f, 0x8a, 0x4a, 0x50, 0x49,
-  0xf7, 0x78, 0x12, 0x4e, 0x42, 0x67, 0x9c, 0xdc, 0xb9, 0x86, 0x14, 0x3e,
-  0x31, 0xfc, 0x4c, 0xb9, 0xce, 0x18, 0xc4, 0x32, 0x05, 0x10, 0xb1, 0xfc,
-  0xb8, 0x08, 0x3d, 0x94, 0x12, 0x57, 0x2c, 0xeb, 0x38, 0x97, 0xd1, 0x20,
-  0xeb, 0x84, 0x88, 0xf8, 0xa2, 0x54, 0x0a, 0x5c, 0xa7, 0xdd, 0x74, 0x08,
-  0xa3, 0xf2, 0x09, 0x6f, 0x03, 0x8b, 0xea, 0x09, 0x59, 0x53, 0x1e, 0x8c,
-  0xa3, 0x64, 0xe4, 0xd9, 0xd5, 0x9f, 0x1f, 0x2d, 0xeb, 0x29, 0x7c, 0xff,
-  0x9f, 0x36, 0xe1, 0x29, 0xca, 0xb1, 0x40, 0xfe, 0x63, 0x65, 0x44, 0x8a,
-  0xd2, 0xbf, 0x28, 0x19, 0x12, 0xdb, 0x57, 0x01, 0x1b, 0xd2, 0x2e, 0xed,
-  0xae, 0xbc, 0xad, 0x08, 0x4d, 0x77, 0xbd, 0x0d, 0x75, 0x9c, 0x44, 0x47,
-  0x0e, 0x34, 0x75, 0xb4, 0xc4, 0xa1, 0x22, 0x8d, 0x5b, 0xfd, 0xb4, 0xe5,
-  0x03, 0x56, 0xdf, 0xfa, 0x1d, 0x7c, 0x6b, 0x57, 0xe5, 0xa9, 0xb8, 0xd6,
-  0xe9, 0xb5, 0x86, 0xb5, 0x12, 0x08, 0x7f, 0x6b, 0xd7, 0x80, 0xa9, 0xd3,
-  0x69, 0xa8, 0x81, 0x65, 0xe3, 0x03, 0xcb, 0xa2, 0xc0, 0xda, 0xe3, 0x03,
-  0x6b, 0xfb, 0xc0, 0x4a, 0x30, 0x17, 0xeb, 0x7e, 0x71, 0x73, 0xe5, 0x4a,
-  0xe9, 0xac, 0x17, 0x1e, 0xab, 0x08, 0x5c, 0x17, 0x22, 0xeb, 0xd9, 0x66,
-  0x68, 0xbe, 0xc9, 0x54, 0xbc, 0x19, 0xd7, 0x48, 0x8a, 0x63, 0x2a, 0x91,
-  0xdc, 0x62, 0x5c, 0xe3, 0xf7, 0x98, 0x29, 0x2c, 0x62, 0x2a, 0xca, 0x13,
-  0xcb, 0x63, 0x41, 0x88, 0x07, 0x4c, 0xe4, 0x27, 0x90, 0x07, 0x82, 0x4d,
-  0xf9, 0x13, 0x9b, 0x02, 0xc2, 0x61, 0x1c, 0x4f, 0x40, 0xf6, 0x07, 0x94,
-  0x71, 0x1e, 0x7f, 0xe2, 0x87, 0x31, 0x7b, 0x2d, 0xca, 0xf9, 0x50, 0x90,
-  0xc8, 0xc0, 0x3b, 0xb8, 0x8f, 0x9a, 0xc3, 0x20, 0x70, 0x82, 0x7d, 0x55,
-  0xa5, 0x6c, 0x95, 0x82, 0xf3, 0x9f, 0x84, 0x62, 0x05, 0xf6, 0xf2, 0x23,
-  0xe9, 0xd0, 0x12, 0x0b, 0xea, 0x1f, 0x33, 0xa0, 0xdf, 0x5d, 0xaa, 0x95,
-  0x64, 0xa7, 0x75, 0x4f, 0xb0, 0xa0, 0xa5, 0x0a, 0x48, 0x68, 0x80, 0x85,
-  0x24, 0x52, 0x21, 0x8e, 0xef, 0xa1, 0x17, 0xa1, 0x15, 0x9e, 0xe9, 0x5e,
-  0xb7, 0x2c, 0x3c, 0xd5, 0x61, 0x99, 0xc4, 0x0f, 0x4b, 0xf4, 0x1a, 0x18,
-  0x50, 0x38, 0x1a, 0x43, 0x6a, 0xfe, 0x2c, 0x20, 0xe5, 0x21, 0xae, 0xbe,
-  0x81, 0xbd, 0xa6, 0x00, 0x6b, 0xcc, 0xc7, 0xab, 0xfb, 0xa8, 0xd2, 0x0b,
-  0x10, 0xf7, 0xfc, 0x33, 0xf9, 0x11, 0xfd, 0x3d, 0xa5, 0x19, 0xf8, 0xd2,
-  0x2a, 0xb4, 0x55, 0xfb, 0xd6, 0x6e, 0x3d, 0x5c, 0xd5, 0x2b, 0xe8, 0x7c,
-  0xa0, 0x4f, 0x6e, 0x59, 0xb3, 0xbc, 0xd5, 0xbd, 0xef, 0xcc, 0xc2, 0xb7,
-  0x76, 0x0f, 0xf2, 0x4a, 0x82, 0x8f, 0x85, 0xfc, 0xaf, 0x45, 0x8c, 0x3d,
-  0xd9, 0x36, 0x6d, 0xa4, 0xb3, 0x23, 0x20, 0x9d, 0xe5, 0x20, 0x9d, 0x4d,
-  0x0e, 0xe9, 0xf7, 0x60, 0xa9, 0xfc, 0xe8, 0xf0, 0x47, 0xba, 0xac, 0x03,
-  0x52, 0xdd, 0x46, 0xbe, 0x7d, 0x04, 0xe4, 0xdb, 0x39, 0xc8, 0xb7, 0x83,
-  0xc8, 0x9f, 0x48, 0xa9, 0x2f, 0x2e, 0x85, 0x3c, 0xa6, 0x42, 0x5f, 0xf9,
-  0x5d, 0x9e, 0x74, 0x99, 0xaf, 0x58, 0x4a, 0x14, 0xa1, 0x57, 0x42, 0xe9,
-  0xea, 0xb8, 0x1a, 0x40, 0xa1, 0x4d, 0x89, 0x6a, 0x0c, 0xa2, 0x0a, 0x39,
-  0x7c, 0x19, 0xd6, 0x0d, 0x38, 0x6a, 0x31, 0x4b, 0x12, 0x2d, 0xe9, 0x96,
-  0x8f, 0x05, 0xcc, 0xc8, 0xe0, 0x2c, 0xcc, 0x35, 0x35, 0xdb, 0xcb, 0xb8,
-  0xf5, 0x2a, 0x30, 0x29, 0x0c, 0x02, 0x58, 0xc1, 0x05, 0x1b, 0x70, 0x64,
-  0x27, 0xc3, 0x07, 0x39, 0xb6, 0x91, 0x9b, 0x2a, 0x79, 0xa8, 0x9e, 0x42,
-  0xef, 0x54, 0x95, 0x04, 0x06, 0x84, 0x46, 0x55, 0x7f, 0x04, 0x29, 0xe3,
-  0x00, 0x0c, 0x0a, 0x8f, 0xb1, 0xea, 0x2c, 0x28, 0x07, 0x92, 0x98, 0xf8,
-  0x16, 0xb0, 0xb9, 0x2f, 0xd1, 0xa2, 0x99, 0xc0, 0xee, 0xc3, 0xd2, 0x98,
-  0x14, 0x42, 0x06, 0x6c, 0x1b, 0x24, 0x47, 0x78, 0x38, 0xfa, 0x50, 0xdb,
-  0x3a, 0x3f, 0xd4, 0xd5, 0x5b, 0xde, 0x80, 0x5f, 0x7f, 0x22, 0xfd, 0x8e,
-  0xcc, 0x90, 0xf6, 0x31, 0x37, 0x0c, 0xbb, 0xe5, 0x5c, 0x6c, 0xb9, 0x52,
-  0x4a, 0x96, 0x8a, 0x28, 0x9b, 0x59, 0x7f, 0x30, 0x14, 0x44, 0x2b, 0xf0,
-  0xa4, 0x95, 0xa3, 0x5b, 0x26, 0xe3, 0xee, 0x4c, 0xb2, 0x20, 0x5d, 0xfd,
-  0x3c, 0xea, 0x0a, 0x62, 0x95, 0x24, 0x6f, 0x84, 0xba, 0xea, 0xbe, 0x4b,
-  0xe6, 0x03, 0xf1, 0xfe, 0x25, 0x9d, 0x57, 0xd0, 0xed, 0xc9, 0xc6, 0xcc,
-  0x7d, 0x7b, 0x67, 0xe6, 0x6e, 0x13, 0x6e, 0xaf, 0x0b, 0xf2, 0x36, 0xa4,
-  0x60, 0xaf, 0xb7, 0x06, 0xa9, 0x58, 0x25, 0x32, 0x72, 0x00, 0x27, 0x46,
-  0x68, 0x23, 0x3f, 0x71, 0xe8, 0x39, 0xfa, 0xa4, 0xc2, 0xb1, 0xda, 0x23,
-  0xed, 0xd0, 0x95, 0x22, 0xcd, 0x91, 0xdd, 0x81, 0xa7, 0x35, 0x92, 0xbc,
-  0xcc, 0x51, 0x1c, 0xd9, 0xee, 0xec, 0xdd, 0x74, 0x5f, 0xfb, 0x4e, 0x9a,
-  0xd5, 0x64, 0x29, 0x6d, 0x3d, 0x64, 0xa6, 0x75, 0xbb, 0x60, 0x05, 0x3d,
-  0xf5, 0x12, 0xce, 0x68, 0xb8, 0x3d, 0xc9, 0x79, 0x6f, 0x2f, 0x78, 0xcb,
-  0x80, 0xb5, 0xec, 0x67, 0x5b, 0x5b, 0x69, 0xff, 0x3b, 0xc8, 0xbb, 0x5f,
-  0x6c, 0xdd, 0x5b, 0x48, 0xe6, 0xce, 0x36, 0x67, 0x22, 0xaf, 0x31, 0xf3,
-  0xcc, 0xdc, 0x3c, 0x7f, 0x9d, 0x0d, 0xbe, 0xb9, 0xb7, 0x93, 0xb5, 0xb3,
-  0xe1, 0x7d, 0x0f, 0x05, 0x41, 0x81, 0x17, 0x7b, 0xfd, 0xf4, 0x46, 0xff,
-  0xea, 0xdf, 0xed, 0xb5, 0x3a, 0x76, 0x31, 0xb7, 0xfc, 0x42, 0x7f, 0xac,
-  0xc2, 0x9f, 0x5d, 0xe8, 0x8f, 0x2c, 0x11, 0x62, 0xe6, 0x4d, 0x51, 0x3e,
-  0x55, 0x6a, 0x2f, 0x50, 0x3a, 0xce, 0x14, 0x8d, 0x0b, 0xad, 0xb6, 0x69,
-  0xb7, 0xc6, 0x9d, 0x5f, 0x3a, 0x8e, 0xbc, 0x5c, 0x71, 0x73, 0xe9, 0x07,
-  0x76, 0x15, 0x39, 0x39, 0x83, 0x37, 0x64, 0x20, 0xad, 0xb1, 0x47, 0x33,
-  0x84, 0xf1, 0x8a, 0xfe, 0xe2, 0x60, 0x0b, 0x33, 0x9f, 0x71, 0xd2, 0x09,
-  0xb8, 0xf6, 0x14, 0x8a, 0x1d, 0xcc, 0xb2, 0xe1, 0x9e, 0x0a, 0x2f, 0xac,
-  0x7a, 0x64, 0xc1, 0xb1, 0x12, 0x4a, 0xe1, 0x06, 0x5a, 0x39, 0x29, 0x13,
-  0xa9, 0xe6, 0x5a, 0xce, 0xe4, 0x37, 0x4e, 0x95, 0x25, 0xc6, 0x82, 0x35,
-  0x6f, 0x8f, 0xd5, 0xdf, 0x62, 0x6d, 0x23, 0xba, 0x4b, 0x85, 0x57, 0xb9,
-  0xda, 0x72, 0x9c, 0xfd, 0x8f, 0x57, 0x5f, 0xce, 0xdd, 0xf4, 0x71, 0x95,
-  0xb8, 0xc2, 0x68, 0x1c, 0xad, 0x78, 0x59, 0x4a, 0x05, 0x6a, 0xc9, 0x79,
-  0x43, 0x9a, 0x4e, 0xb4, 0xc5, 0x55, 0xad, 0x02, 0xf9, 0x20, 0x72, 0xc9,
-  0xb3, 0xb8, 0x8a, 0xc0, 0x24, 0xa6, 0x5f, 0x97, 0x78, 0x32, 0x15, 0x7b,
-  0x88, 0x1b, 0xc5, 0xf5, 0xec, 0x1c, 0xba, 0x36, 0xdc, 0xe9, 0x4f, 0x4b,
-  0x29, 0xdc, 0xfd, 0xa6, 0x25, 0xb9, 0x27, 0x57, 0xbb, 0x97, 0x5f, 0xde,
-  0x7f, 0x15, 0xab, 0x3b, 0x0e, 0xef, 0x48, 0x79, 0xf3, 0x7d, 0x38, 0x47,
-  0x2c, 0x52, 0xc6, 0x00, 0xfd, 0x27, 0x2f, 0x54, 0xc6, 0xe7, 0xe6, 0x16,
-  0x5c, 0x0c, 0x9c, 0x4a, 0x65, 0x62, 0xbe, 0x57, 0xdc, 0xc9, 0x92, 0x47,
-  0x55, 0xa9, 0x62, 0x5d, 0x82, 0xd8, 0x0d, 0xf9, 0x49, 0x43, 0xeb, 0x06,
-  0x43, 0x05, 0xbb, 0x1c, 0xb0, 0xda, 0x57, 0xc7, 0x79, 0x1e, 0x28, 0x55,
-  0xc6, 0x10, 0x15, 0xde, 0x6f, 0xb9, 0xce, 0x3a, 0x32, 0xf7, 0x74, 0x3a,
-  0x18, 0xb4, 0xb6, 0xd2, 0x71, 0x46, 0x21, 0x3f, 0xc9, 0x1d, 0x85, 0x0b,
-  0x56, 0x8d, 0xc2, 0x7d, 0x5e, 0x62, 0x14, 0xf3, 0x25, 0x46, 0xd1, 0xe7,
-  0xc7, 0xed, 0x38, 0x63, 0x11, 0x1f, 0x36, 0x64, 0xa7, 0xb9, 0x43, 0x0a,
-  0xf7, 0x61, 0x87, 0x59, 0xb9, 0x6f, 0x4b, 0x0c, 0x6f, 0x06, 0xf7, 0x90,
-  0xf7, 0x74, 0xac, 0x3a, 0x73, 0x62, 0xfd, 0x8a, 0x55, 0x7b, 0xcd, 0x3d,
-  0x6f, 0xb4, 0x1b, 0xaf, 0x44, 0x34, 0xe8, 0xc7, 0xb7, 0xa6, 0x78, 0x99,
-  0xce, 0xbd, 0x6a, 0x4b, 0x99, 0x6b, 0xcc, 0xa7, 0x4f, 0x03, 0x74, 0x02,
-  0x38, 0xa5, 0xd7, 0xec, 0xaa, 0x8c, 0x10, 0xcc, 0x8b, 0xea, 0x93, 0x51,
-  0x47, 0xda, 0xc5, 0x98, 0x86, 0x1c, 0xec, 0x80, 0xe7, 0x59, 0xbe, 0xb2,
-  0x3d, 0xa4, 0xba, 0x74, 0xf0, 0x5f, 0xd1, 0x49, 0xcd, 0xee, 0xd3, 0x6a,
-  0x0e, 0x83, 0x6c, 0xd1, 0x5e, 0x1e, 0x63, 0x31, 0xe0, 0x37, 0x0d, 0xd4,
-  0x0c, 0x44, 0xd7, 0x81, 0xe4, 0x8a, 0x2e, 0x6c, 0x7e, 0x63, 0xf4, 0x5e,
-  0x06, 0x2a, 0xeb, 0xe1, 0x48, 0x60, 0x7a, 0x31, 0xd6, 0xc7, 0x9e, 0x5d,
-  0x77, 0x7e, 0xed, 0xc1, 0xd2, 0x20, 0x99, 0xe4, 0x70, 0x4a, 0x46, 0x63,
-  0x22, 0x13, 0x96, 0x01, 0x8b, 0x88, 0xbd, 0xa4, 0x86, 0x0a, 0xcd, 0xe3,
-  0x59, 0xa6, 0x19, 0x29, 0x67, 0x67, 0x13, 0x15, 0x4d, 0xc9, 0xbe, 0x82,
-  0x2b, 0x97, 0x47, 0xf4, 0xb9, 0xb9, 0x60, 0xcb, 0xd9, 0xbb, 0x01, 0x97,
-  0x98, 0x35, 0x39, 0xfd, 0x48, 0x81, 0x84, 0x92, 0xeb, 0x2d, 0x60, 0x20,
-  0xb4, 0x1f, 0x4e, 0x79, 0x50, 0x49, 0x1a, 0xcb, 0x89, 0x01, 0x07, 0x12,
-  0xbf, 0x6e, 0x66, 0x9e, 0x4a, 0x5d, 0xc8, 0x74, 0x52, 0xad, 0x1f, 0xdc,
-  0x5d, 0xab, 0xdb, 0xb9, 0xb2, 0xd5, 0x30, 0x60, 0xf8, 0x12, 0xcf, 0x12,
-  0xa1, 0xb9, 0xd7, 0x8c, 0x00, 0x60, 0xaf, 0x1e, 0xb5, 0x43, 0x4e, 0x3c,
-  0x4e, 0xb7, 0x31, 0x7b, 0xd4, 0x40, 0xdd, 0x72, 0x91, 0xba, 0xd1, 0xf0,
-  0x5b, 0x2b, 0xfe, 0x36, 0x1b, 0xac, 0xca, 0xe1, 0x0b, 0xae, 0x44, 0xd4,
-  0xb6, 0xf6, 0xa3, 0x47, 0x9e, 0xc2, 0x98, 0x5b, 0x07, 0x8a, 0x88, 0xe4,
-  0x34, 0xfd, 0x4c, 0x24, 0xd0, 0x36, 0xa9, 0xad, 0x5c, 0x41, 0x07, 0x68,
-  0xb7, 0xaf, 0xfa, 0xb8, 0x11, 0xb8, 0x5a, 0xe1, 0x24, 0xae, 0x77, 0x8a,
-  0xeb, 0xe4, 0x07, 0xdf, 0xaa, 0x9b, 0x58, 0xc0, 0x0a, 0xaf, 0xa4, 0x6f,
-  0x06, 0xe7, 0x6e, 0xa4, 0x74, 0x99, 0xd3, 0xf5, 0x02, 0x86, 0x9e, 0x7c,
-  0x22, 0xeb, 0xf2, 0x0a, 0x95, 0x2d, 0x26, 0x7b, 0xa5, 0x4b, 0xcd, 0x67,
-  0x87, 0x6f, 0x78, 0x2a, 0x22, 0x7c, 0xfb, 0x39, 0xda, 0x26, 0x85, 0x16,
-  0x49, 0xa6, 0x87, 0x7d, 0x04, 0x2b, 0x07, 0xb3, 0x13, 0xbc, 0xa9, 0x72,
-  0x13, 0x1c, 0xfe, 0xfc, 0xf0, 0xcd, 0xa6, 0x2a, 0xad, 0x60, 0xeb, 0xb1,
-  0xde, 0x3f, 0xfc, 0x29, 0xc0, 0xf8, 0x60, 0xf4, 0xd9, 0xe8, 0xc1, 0x82,
-  0x58, 0x7c, 0xba, 0xe6, 0x2f, 0x6a, 0xb6, 0x7e, 0xc6, 0x4d, 0x9d, 0x0f,
-  0x1d, 0xcf, 0xfd, 0x78, 0xbd, 0x61, 0x27, 0x08, 0x35, 0x7e, 0x41, 0xe1,
-  0x24, 0xd2, 0x96, 0x5e, 0xf1, 0xb2, 0x29, 0xc5, 0x1c, 0xa2, 0xb0, 0xa8,
-  0x1a, 0x94, 0x0d, 0xe8, 0xbf, 0x35, 0xbb, 0x81, 0xbe, 0xe0, 0x39, 0xdf,
-  0x85, 0xab, 0x58, 0xea, 0xd4, 0xfc, 0x05, 0x8a, 0x84, 0x99, 0x13, 0xd0,
-  0x1a, 0x20, 0x36, 0x36, 0x92, 0xfa, 0x22, 0x23, 0xd5, 0x67, 0xcc, 0x95,
-  0x98, 0xaf, 0x8b, 0xc1, 0xb7, 0xb3, 0x81, 0xbd, 0x2e, 0xe3, 0x0e, 0x47,
-  0xec, 0xbe, 0x13, 0xbb, 0x59, 0xfb, 0xeb, 0x7c, 0x5a, 0x0a, 0x95, 0x93,
-  0x5d, 0xf4, 0x65, 0xdb, 0xe9, 0x99, 0x0c, 0x6f, 0x12, 0x1f, 0xf5, 0xc2,
-  0x7d, 0x22, 0xb7, 0x85, 0xb7, 0x13, 0x84, 0xd6, 0xf6, 0x0b, 0x62, 0xaf,
-  0x6f, 0x60, 0x98, 0x86, 0x12, 0xa6, 0x8f, 0xba, 0x3d, 0xdc, 0x0a, 0xd9,
-  0xe5, 0x36, 0xc7, 0x18, 0x34, 0x51, 0xfa, 0x09, 0x36, 0x3f, 0x4a, 0x4b,
-  0x71, 0x42, 0xeb, 0xa4, 0x18, 0xe8, 0x09, 0x33, 0xc5, 0x08, 0x0a, 0xe3,
-  0x32, 0xc7, 0x66, 0x65, 0x92, 0x9c, 0x69, 0x8c, 0x82, 0x8e, 0xce, 0x15,
-  0xaf, 0x03, 0xb8, 0x37, 0xd4, 0x31, 0x55, 0xb2, 0xa8, 0xe3, 0xb1, 0xf8,
-  0x60, 0xc4, 0xd5, 0x65, 0x1c, 0xe7, 0x14, 0x87, 0x4b, 0x91, 0x20, 0x21,
-  0x7e, 0x94, 0x28, 0xf7, 0x68, 0x8d, 0x7f, 0xd2, 0x49, 0xba, 0x93, 0xef,
-  0xef, 0x0d, 0x86, 0xd9, 0xe6, 0x7d, 0x12, 0xcc, 0xe1, 0xad, 0x9d, 0x38,
-  0x71, 0x3f, 0x6b, 0x0f, 0xb7, 0xb1, 0xe5, 0xcc, 0xd7, 0x58, 0x30, 0x7c,
-  0x6e, 0xe6, 0xbb, 0x48, 0xfc, 0x91, 0xc0, 0xde, 0x8b, 0x40, 0xf2, 0xe2,
-  0x8f, 0xf2, 0xb2, 0xc8, 0x05, 0x33, 0xc8, 0x49, 0xc0, 0xc7, 0xcb, 0x18,
-  0x17, 0xc9, 0x16, 0x57, 0x0a, 0x76, 0x51, 0x76, 0x38, 0x6f, 0x88, 0xa2,
-  0x50, 0x48, 0x78, 0x0a, 0x4b, 0xe6, 0x23, 0x88, 0xd6, 0x12, 0x91, 0xb9,
-  0x74, 0xe5, 0x39, 0xca, 0xe8, 0xa3, 0x1e, 0x1d, 0x3f, 0xde, 0xd7, 0x5c,
-  0x68, 0xf9, 0x16, 0xd4, 0x6b, 0x1b, 0x73, 0x9f, 0xeb, 0xde, 0xdc, 0xda,
-  0x22, 0x6c, 0x00, 0x30, 0x29, 0x82, 0xf1, 0xbc, 0x25, 0x39, 0x7d, 0x82,
-  0x7e, 0x19, 0xd2, 0xae, 0x17, 0x4b, 0x14, 0x3a, 0x15, 0xac, 0x29, 0x52,
-  0xae, 0xe4, 0x0b, 0x3f, 0xaa, 0x6d, 0xdc, 0x4f, 0xac, 0x04, 0xa8, 0x57,
-  0xdf, 0x93, 0xa9, 0xc3, 0x7c, 0x0f, 0xc0, 0xfc, 0x43, 0x20, 0xee, 0x87,
-  0x5a, 0xc4, 0x7a, 0x99, 0x37, 0x6a, 0x2b, 0xa4, 0x70, 0x8e, 0x32, 0x5e,
-  0xd1, 0xba, 0xc1, 0x5a, 0xf3, 0xcc, 0x56, 0xda, 0x67, 0x54, 0x02, 0xf5,
-  0x4c, 0x57, 0x78, 0xfd, 0x29, 0x82, 0x2d, 0x2d, 0x65, 0x70, 0xa5, 0x6f,
-  0x67, 0xc1, 0x0e, 0x84, 0x4a, 0x74, 0xc7, 0x40, 0x15, 0x8a, 0x67, 0xd9,
-  0xa7, 0x63, 0x87, 0x73, 0xbc, 0x43, 0xcb, 0xf5, 0xad, 0x3e, 0xf6, 0xba,
-  0x36, 0xbe, 0xa7, 0xa1, 0xde, 0xa8, 0xf0, 0xda, 0x51, 0x7b, 0xcb, 0xba,
-  0xc5, 0xbd, 0x19, 0x2b, 0x61, 0x19, 0x42, 0x12, 0x0c, 0xd4, 0x0d, 0x44,
-  0x28, 0xb8, 0x2d, 0x61, 0xd9, 0xe4, 0xb3, 0x54, 0x51, 0xbc, 0x3a, 0x5d,
-  0xe1, 0x68, 0xd8, 0x97, 0xfe, 0x50, 0xd8, 0xe2, 0x9c, 0xa4, 0xe2, 0x5d,
-  0xab, 0x91, 0x5f, 0xc2, 0x88, 0xe5, 0x72, 0x15, 0x12, 0xcd, 0x47, 0x79,
-  0x25, 0x12, 0x1d, 0xd0, 0xce, 0x0d, 0xe8, 0x48, 0xd1, 0xaa, 0x3a, 0xd3,
-  0x10, 0x00, 0xf5, 0x4a, 0x88, 0x3a, 0xfd, 0x59, 0x05, 0x00, 0xa3, 0x9d,
-  0xde, 0xd1, 0xa0, 0x78, 0x05, 0x51, 0x26, 0x83, 0x39, 0xc6, 0x51, 0x55,
-  0x81, 0xa1, 0xc4, 0x16, 0x77, 0xbe, 0x0c, 0xe8, 0x68, 0x23, 0xb0, 0x1d,
-  0x4a, 0x39, 0xad, 0x48, 0x25, 0x17, 0xfc, 0x4e, 0x9d, 0x08, 0x61, 0x9d,
-  0x39, 0xb9, 0x8e, 0x94, 0x40, 0x5b, 0x9a, 0x88, 0xe3, 0x5a, 0x72, 0x02,
-  0xe4, 0xe0, 0x28, 0x3f, 0x02, 0xf0, 0xbc, 0x91, 0x61, 0x67, 0x0c, 0x1d,
-  0x71, 0xa6, 0x15, 0x17, 0xed, 0xf5, 0x24, 0x34, 0x6b, 0x97, 0x99, 0x0b,
-  0x34, 0x2b, 0xd6, 0x6b, 0x40, 0x87, 0x4a, 0xf5, 0x06, 0xae, 0xd2, 0x52,
-  0xd8, 0x94, 0xd7, 0x69, 0x53, 0x46, 0xd2, 0x2f, 0xc4, 0x1b, 0x2a, 0x8c,
-  0xa9, 0x5d, 0xe0, 0xa7, 0x55, 0x29, 0x60, 0x79, 0x15, 0x2f, 0x04, 0x20,
-  0x4a, 0x5e, 0x56, 0xeb, 0x6e, 0x61, 0x49, 0x01, 0xc8, 0xbb, 0xc3, 0x4f,
-  0x71, 0x2b, 0x7d, 0x61, 0x9d, 0x60, 0x2d, 0xa8, 0x60, 0x07, 0x72, 0x49,
-  0x4c, 0xfb, 0x51, 0x78, 0xce, 0xcd, 0x9f, 0xd5, 0x12, 0x2e, 0xbc, 0x8b,
-  0x95, 0x88, 0x15, 0xf6, 0xb4, 0x40, 0x91, 0x28, 0xe1, 0xa4, 0xd0, 0xe0,
-  0x18, 0x2a, 0x6e, 0x99, 0x7b, 0xe4, 0x47, 0xed, 0xa7, 0xb1, 0x2b, 0xa4,
-  0x6e, 0x32, 0x76, 0xa1, 0x4b, 0xfe, 0x79, 0x89, 0x78, 0x00, 0x76, 0xf5,
-  0xcc, 0x37, 0xce, 0x1e, 0x27, 0x2a, 0xe0, 0x3d, 0x57, 0xfd, 0x76, 0x42,
-  0xc1, 0x00, 0x0a, 0x65, 0xba, 0x77, 0x89, 0x1f, 0xb1, 0x42, 0x96, 0x86,
-  0x33, 0x2b, 0xa6, 0x1d, 0xe5, 0xc7, 0x91, 0x64, 0x6f, 0xb3, 0xb6, 0x9a,
-  0x5f, 0xac, 0x59, 0x37, 0xdd, 0x1b, 0xeb, 0x80, 0xcc, 0x89, 0xf6, 0x37,
-  0x2f, 0x0a, 0xc6, 0x94, 0xff, 0xd1, 0xbc, 0x5d, 0xaa, 0x1a, 0x16, 0xb9,
-  0xcb, 0x7b, 0x83, 0x9f, 0x91, 0x55, 0x2c, 0xf4, 0x62, 0xce, 0xb6, 0x3a,
-  0xf1, 0x13, 0xfe, 0x08, 0x36, 0xa7, 0xa0, 0x84, 0x61, 0x61, 0x2c, 0xb3,
-  0xc5, 0x7d, 0x47, 0xe6, 0x8d, 0xb5, 0xfa, 0xbb, 0x68, 0xfd, 0x6c, 0x5a,
-  0x4d, 0x17, 0x92, 0xc6, 0xf9, 0xf3, 0xe7, 0xad, 0xb1, 0x53, 0xab, 0xab,
-  0xa8, 0xed, 0xc0, 0x51, 0xdb, 0x80, 0x01, 0x17, 0x6c, 0x2f, 0x6c, 0x19,
-  0xd7, 0x5b, 0xd7, 0xad, 0xd7, 0x8e, 0xa5, 0x2d, 0x64, 0x09, 0xe3, 0x88,
-  0xd4, 0xc7, 0x2c, 0x29, 0x7a, 0x84, 0x9a, 0xa2, 0x01, 0xde, 0xf2, 0xc4,
-  0x06, 0x95, 0xf8, 0xb7, 0x89, 0x27, 0xa1, 0xaa, 0x28, 0xf7, 0x0c, 0xfa,
-  0x0a, 0x2a, 0x8b, 0x1e, 0xb1, 0xfb, 0x13, 0xac, 0x2e, 0xaa, 0x65, 0xb3,
-  0x09, 0xd6, 0x16, 0xf5, 0xac, 0xda, 0x4f, 0x78, 0x45, 0xd1, 0xa8, 0x4b,
-  0x4e, 0xe9, 0x88, 0x1c, 0xaf, 0xac, 0x68, 0xce, 0xad, 0xe5, 0xab, 0x8a,
-  0xcd, 0xf1, 0x23, 0x18, 0x4c, 0x56, 0xcf, 0x4f, 0xf0, 0x68, 0xfd, 0x13,
-  0x99, 0x42, 0x7f, 0xa2, 0x72, 0xad, 0x45, 0x62, 0x17, 0x74, 0x56, 0x4f,
-  0x29, 0x66, 0xdb, 0x79, 0x3d, 0xbd, 0x52, 0x1c, 0xe3, 0x24, 0xf6, 0x54,
-  0x8a, 0x17, 0xc1, 0xac, 0x2f, 0x26, 0xd5, 0xbe, 0xd4, 0x43, 0x51, 0xc6,
-  0x4f, 0xbb, 0x4e, 0x87, 0xae, 0x77, 0x68, 0x7f, 0xc1, 0x8d, 0x08, 0xf8,
-  0xe9, 0xda, 0x33, 0xaf, 0x71, 0x96, 0xde, 0x1c, 0xf6, 0xae, 0x65, 0xf7,
-  0xd2, 0x76, 0x6d, 0xb6, 0x7e, 0xb0, 0x66, 0x2f, 0xeb, 0x42, 0xe6, 0x34,
-  0x16, 0x69, 0x9d, 0x32, 0xa6, 0x9e, 0x18, 0x59, 0x22, 0x30, 0x44, 0x04,
-  0x43, 0x31, 0x4a, 0x87, 0x54, 0x2d, 0xf9, 0xd1, 0x52, 0x01, 0x1e, 0x3c,
-  0x6e, 0x04, 0x49, 0x7c, 0x88, 0xdc, 0x54, 0x2c, 0xdd, 0xec, 0x85, 0x0d,
-  0x88, 0x24, 0xb3, 0x3f, 0x52, 0x5e, 0x2e, 0xe9, 0x6e, 0x1f, 0x5b, 0x4a,
-  0x42, 0x9d, 0xcb, 0x86, 0x18, 0xd4, 0x1c, 0xe8, 0xec, 0x63, 0xec, 0x65,
-  0xc5, 0x4b, 0x20, 0x16, 0xf6, 0xc6, 0xb1, 0x6b, 0xb7, 0xca, 0x6b, 0x4e,
-  0x60, 0x19, 0x15, 0x39, 0x2d, 0x84, 0x25, 0x16, 0x6f, 0x05, 0x39, 0x55,
-  0x3e, 0xa2, 0x14, 0x36, 0x3c, 0x22, 0xd7, 0xfb, 0xa5, 0x52, 0x5c, 0x0c,
-  0x15, 0x4d, 0xfd, 0x41, 0xbf, 0x16, 0x6f, 0xb7, 0x98, 0x5d, 0xff, 0x70,
-  0xf4, 0x67, 0x66, 0xc5, 0x3e, 0xfc, 0x71, 0xe9, 0xe9, 0xf1, 0xf5, 0x48,
-  0x6a, 0x6e, 0xf4, 0x1b, 0x8f, 0xb6, 0x8e, 0xf6, 0x9c, 0x25, 0x7a, 0x21,
-  0x2d, 0xba, 0xaf, 0xcf, 0x0a, 0xe9, 0xd1, 0xff, 0x10, 0x4a, 0x38, 0x1c,
-  0xae, 0xed, 0xe2, 0xf5, 0xa8, 0x94, 0x5b, 0xd6, 0x69, 0x97, 0xdb, 0xdb,
-  0xbb, 0x32, 0xed, 0xe4, 0x97, 0x32, 0xe0, 0x24, 0x56, 0x45, 0xa6, 0xfc,
-  0x7c, 0x97, 0xdc, 0x51, 0x32, 0x29, 0xe1, 0x23, 0x8c, 0x4b, 0xc4, 0x7e,
-  0xa7, 0x13, 0x8a, 0x6b, 0x21, 0xf3, 0x6a, 0x49, 0xee, 0xec, 0x6f, 0xa9,
-  0x98, 0x12, 0x55, 0x6f, 0x2b, 0xa7, 0x41, 0xd1, 0x0c, 0x32, 0x75, 0x2b,
-  0x23, 0xa9, 0xaf, 0xe0, 0x0d, 0x51, 0xf6, 0xbf, 0xc3, 0xed, 0xed, 0xf3,
-  0xc3, 0x9f, 0x61, 0x52, 0x53, 0x65, 0x37, 0x96, 0xb9, 0x0a, 0xbf, 0xc4,
-  0x02, 0x50, 0xa5, 0xe6, 0xb3, 0x03, 0xf7, 0x1f, 0xd6, 0xff, 0xa9, 0xb1,
-  0x10, 0xf8, 0x0d, 0x31, 0xad, 0xb1, 0x10, 0x08, 0x4d, 0x73, 0x24, 0x86,
-  0xcf, 0x27, 0xbb, 0xa7, 0x3f, 0x76, 0xa8, 0xae, 0xde, 0x87, 0xa3, 0xfe,
-  0xc2, 0x8a, 0x6c, 0x80, 0x01, 0x7b, 0x7f, 0x23, 0xdd, 0x86, 0xb3, 0x33,
-  0xed, 0x2f, 0x51, 0xe2, 0x20, 0xd2, 0x58, 0x7c, 0x14, 0xc9, 0x6b, 0x79,
-  0xf8, 0xce, 0xc4, 0x82, 0x1e, 0x7f, 0x3f, 0xfa, 0x00, 0xbb, 0x42, 0x7b,
-  0xfe, 0x11, 0x17, 0x28, 0x8a, 0x0f, 0x2e, 0x13, 0xcb, 0xba, 0x1d, 0xe0,
-  0x7b, 0x0d, 0xf2, 0xbb, 0xd4, 0x76, 0xc5, 0x39, 0x34, 0x6a, 0x25, 0x78,
-  0x0a, 0x36, 0xc8, 0xf0, 0x65, 0x4c, 0x5e, 0xbe, 0x04, 0x51, 0x59, 0xce,
-  0x5f, 0x88, 0x22, 0x5c, 0x50, 0xcc, 0x3b, 0xad, 0x05, 0xdc, 0x65, 0x6a,
-  0x25, 0x56, 0x03, 0x17, 0x93, 0x31, 0x27, 0x38, 0xeb, 0xe6, 0x4f, 0x70,
-  0xd6, 0x2d, 0x3f, 0xc1, 0x19, 0xb9, 0x62, 0xcd, 0xe4, 0xce, 0xb2, 0x9e,
-  0x85, 0x07, 0x13, 0x38, 0xcf, 0x31, 0x4f, 0xaa, 0x3e, 0x14, 0x2c, 0x29,
-  0x85, 0xa7, 0x43, 0x7d, 0xbc, 0x05, 0xf8, 0x4a, 0x26, 0x24, 0x0d, 0x28,
-  0xf0, 0x03, 0x59, 0x56, 0x5d, 0x1d, 0x47, 0x71, 0xf1, 0xba, 0x88, 0x6b,
-  0xfa, 0x44, 0x8b, 0xd4, 0x1e, 0x7f, 0x88, 0xb3, 0xb1, 0x21, 0xce, 0x4e,
-  0x62, 0x88, 0x22, 0x01, 0xeb, 0xaf, 0x60, 0x78, 0x1f, 0xcb, 0xbc, 0xaa,
-  0xc6, 0xe1, 0xc6, 0xcb, 0xaa, 0x3a, 0x89, 0xe1, 0xcc, 0xc5, 0x86, 0x33,
-  0x37, 0x89, 0xe1, 0xcc, 0x1d, 0xa7, 0xe8, 0xee, 0xf1, 0x07, 0x37, 0x1f,
-  0x1b, 0xdc, 0xfc, 0x24, 0x06, 0x27, 0x2a, 0xd4, 0x62, 0x5c, 0xb4, 0x1a,
-  0x9e, 0x0c, 0xd4, 0xc2, 0xb8, 0xd7, 0x47, 0xc0, 0x2d, 0xfe, 0xc1, 0xa4,
-  0x50, 0x0f, 0x71, 0x65, 0xef, 0x44, 0x28, 0x14, 0x5b, 0x0b, 0x3d, 0xf8,
-  0x4b, 0xc9, 0xae, 0xbe, 0x62, 0xb2, 0xbc, 0x1c, 0xfb, 0x2e, 0x85, 0xf4,
-  0x7e, 0x28, 0x76, 0x59, 0x49, 0x17, 0x81, 0x12, 0xd7, 0x2e, 0xa3, 0x1c,
-  0x61, 0xcc, 0x3e, 0x66, 0x02, 0x73, 0x7d, 0x2a, 0xe4, 0x7b, 0x4b, 0xd4,
-  0xf4, 0xc6, 0x67, 0x4f, 0xf6, 0x78, 0x64, 0x8f, 0x07, 0x81, 0x94, 0xbc,
-  0x2b, 0xd8, 0xda, 0xe3, 0xf2, 0xd4, 0xfe, 0xbd, 0xbb, 0x90, 0x8e, 0x72,
-  0x83, 0x75, 0x4d, 0x72, 0x8a, 0x7c, 0xf2, 0xb9, 0x7f, 0x30, 0x2a, 0x73,
-  0x1c, 0x1c, 0x88, 0x40, 0x2a, 0xf7, 0x44, 0x7c, 0x17, 0xfd, 0xd3, 0x60,
-  0xb6, 0x1f, 0x22, 0xcf, 0x0d, 0xac, 0xf5, 0xe0, 0xd9, 0xe8, 0x52, 0x34,
-  0x1e, 0x1c, 0x14, 0x26, 0xa0, 0xa5, 0xb2, 0x0f, 0x66, 0x80, 0xe6, 0x22,
-  0x4b, 0x27, 0xdd, 0x0c, 0x79, 0x4a, 0xe5, 0xd6, 0x22, 0x71, 0xbc, 0x7e,
-  0x3c, 0x1f, 0x2c, 0x90, 0x55, 0x36, 0x40, 0x58, 0x4a, 0x87, 0xfb, 0x58,
-  0x07, 0x25, 0xec, 0x15, 0x14, 0xf0, 0xcd, 0x82, 0x73, 0x5e, 0xf5, 0x20,
-  0x72, 0x54, 0x63, 0x80, 0x77, 0xe2, 0xc8, 0x60, 0xd0, 0xd8, 0x54, 0x36,
-  0x45, 0x2e, 0xaf, 0x04, 0x80, 0x02, 0xfd, 0xa6, 0xeb, 0xd6, 0x9d, 0x9b,
-  0xc0, 0xe1, 0xd9, 0x64, 0xf4, 0x5e, 0xd4, 0xd1, 0x99, 0x2b, 0x38, 0xcd,
-  0x7e, 0x88, 0xcd, 0x9a, 0xf4, 0xf7, 0x73, 0x26, 0xcc, 0x9b, 0x01, 0xa1,
-  0x6e, 0x57, 0x99, 0x61, 0x4e, 0x30, 0x6f, 0x46, 0xd0, 0xa2, 0xf7, 0x98,
-  0x12, 0x68, 0x94, 0xec, 0xfb, 0xa4, 0x33, 0x69, 0x90, 0xf5, 0x8d, 0x3b,
-  0x3a, 0x45, 0x7d, 0x70, 0x9b, 0x40, 0xeb, 0xab, 0xad, 0x8d, 0xed, 0xc7,
-  0x66, 0x76, 0xb3, 0xbd, 0x39, 0xac, 0x88, 0xbd, 0xd7, 0x74, 0x94, 0x45,
-  0xd8, 0x25, 0x37, 0xd3, 0x1e, 0xbe, 0xa2, 0x00, 0xd7, 0x41, 0x30, 0x4f,
-  0x88, 0x65, 0x87, 0x3d, 0x6e, 0xc2, 0x10, 0x1d, 0x97, 0x4e, 0xb8, 0xe5,
-  0xd4, 0xf4, 0x14, 0xfd, 0xe5, 0x54, 0xf4, 0xb4, 0x1a, 0xd4, 0xf3, 0x62,
-  0xd9, 0xa3, 0x59, 0x48, 0xe4, 0xfb, 0xc2, 0xb8, 0x5e, 0xbb, 0x4a, 0xa8,
-  0x30, 0xd8, 0x29, 0xd8, 0x25, 0x73, 0x92, 0xe4, 0xd7, 0xf6, 0xfb, 0xab,
-  0x09, 0x1b, 0x3a, 0x89, 0xfa, 0x7e, 0xa6, 0x9d, 0x5d, 0xd6, 0xcf, 0x58,
-  0x57, 0x13, 0x27, 0x42, 0x67, 0xd1, 0x6a, 0x67, 0xfb, 0xf6, 0x95, 0x09,
-  0x02, 0xe2, 0x61, 0x3f, 0x2b, 0xed, 0x83, 0xb5, 0xc5, 0x78, 0x38, 0x53,
-  0x6e, 0x18, 0xd3, 0xe2, 0x54, 0xb9, 0x30, 0xa6, 0x92, 0xf1, 0x4b, 0xb6,
-  0x59, 0x71, 0x9c, 0x00, 0x24, 0x6e, 0xb2, 0xba, 0xd6, 0x69, 0x01, 0x8b,
-  0x44, 0x0d, 0xac, 0x71, 0x99, 0xd0, 0x8b, 0x77, 0xf4, 0xbe, 0xcc, 0xc3,
-  0x6c, 0xdd, 0x15, 0x7e, 0x44, 0xba, 0xc1, 0x8f, 0x28, 0xb9, 0x0c, 0x5c,
-  0xed, 0xb4, 0xb3, 0x88, 0xbc, 0x34, 0x3f, 0x58, 0xa8, 0x4c, 0x27, 0x6e,
-  0x3a, 0x7b, 0x84, 0xcf, 0xdd, 0xde, 0x86, 0xd9, 0x4e, 0xda, 0x1f, 0x94,
-  0xf0, 0xc0, 0xaa, 0x8a, 0x96, 0xcc, 0x78, 0xc6, 0x3c, 0xde, 0x54, 0x8d,
-  0xcc, 0x52, 0x80, 0x74, 0xe3, 0x30, 0x2c, 0xd4, 0xca, 0x96, 0xc2, 0xc7,
-  0x68, 0x6f, 0xc3, 0x80, 0xe4, 0x56, 0x2f, 0x03, 0xab, 0x65, 0x71, 0x2d,
-  0x06, 0x23, 0xed, 0x6e, 0xdc, 0x87, 0xb3, 0x6a, 0x98, 0x96, 0x81, 0xa2,
-  0x1b, 0xdf, 0x22, 0x52, 0x55, 0x4d, 0x10, 0xbd, 0x4d, 0xe5, 0xba, 0x43,
-  0x75, 0x65, 0x7f, 0x44, 0xd8, 0x30, 0x3f, 0xcd, 0x61, 0xea, 0x16, 0x5d,
-  0x65, 0x9f, 0x7a, 0x8f, 0xdc, 0xaf, 0x07, 0xfa, 0x6b, 0x4e, 0xc9, 0xba,
-  0x45, 0x57, 0xaf, 0xc7, 0x3d, 0xdb, 0xc1, 0x90, 0xf5, 0xe7, 0x3c, 0x70,
-  0xbf, 0x6c, 0xe9, 0xde, 0x3c, 0x52, 0xd5, 0x7d, 0xea, 0x79, 0xfd, 0x6e,
-  0x00, 0x89, 0xf8, 0x8e, 0x40, 0x89, 0xa7, 0x25, 0x8d, 0x1a, 0xa4, 0x82,
-  0x5a, 0xa5, 0xa5, 0x6b, 0x45, 0xbe, 0x72, 0x36, 0x43, 0x41, 0xa6, 0x98,
-  0x8a, 0x42, 0x7e, 0x83, 0xbf, 0x6f, 0x81, 0xc4, 0x55, 0x63, 0x45, 0x42,
-  0xcd, 0xb2, 0x02, 0x88, 0x19, 0xe3, 0x4b, 0x96, 0xff, 0xc5, 0x32, 0x7a,
-  0x5f, 0x9c, 0x33, 0xed, 0x95, 0xaa, 0xde, 0xf9, 0x86, 0x3d, 0x66, 0x1f,
-  0xa1, 0xf3, 0x16, 0x99, 0xba, 0x55, 0x1c, 0x25, 0xe2, 0xa1, 0x7d, 0x8d,
-  0xb0, 0x7a, 0x55, 0xe5, 0xca, 0x37, 0x6f, 0xcd, 0xce, 0x56, 0x16, 0xec,
-  0x27, 0x73, 0x73, 0xf2, 0x89, 0x99, 0x30, 0xd1, 0xdf, 0xd7, 0xbf, 0x6e,
-  0x23, 0xc0, 0xc3, 0x8b, 0x15, 0xd7, 0xd2, 0x11, 0x90, 0x31, 0xab, 0xe2,
-  0xbf, 0x3f, 0xb8, 0x9c, 0x9c, 0x36, 0x81, 0x92, 0x16, 0xea, 0xbc, 0xdd,
-  0xd7, 0x34, 0x27, 0x95, 0x89, 0x16, 0x2c, 0x5c, 0x8e, 0xda, 0x75, 0x08,
-  0x68, 0xf9, 0x31, 0x95, 0x41, 0x56, 0xfe, 0x77, 0xbd, 0x9f, 0xb6, 0x5e,
-  0x51, 0xee, 0x31, 0x44, 0xd9, 0xeb, 0xb7, 0x2e, 0x87, 0xe9, 0x7a, 0xfc,
-  0xb1, 0x44, 0xfb, 0xbc, 0x75, 0xe3, 0xf6, 0xe5, 0x6f, 0xbe, 0xfc, 0x8d,
-  0xeb, 0x57, 0x26, 0xd5, 0xf3, 0x4c, 0xfd, 0xa0, 0x44, 0xb7, 0x97, 0xae,
-  0x5f, 0xfa, 0xf6, 0x8d, 0x6f, 0x4c, 0x70, 0xb4, 0xb9, 0x7d, 0xca, 0x2c,
-  0x4b, 0x8f, 0x85, 0xb6, 0x76, 0xb8, 0x73, 0xa5, 0x71, 0xba, 0x51, 0x09,
-  0x9d, 0x9e, 0xb7, 0x57, 0xc4, 0xce, 0x47, 0xe7, 0xce, 0xbd, 0xf1, 0x0e,
-  0x50, 0xc7, 0x4c, 0xf0, 0x29, 0x5e, 0xdb, 0xb5, 0xb4, 0x81, 0x6d, 0xf3,
-  0x0f, 0x50, 0x21, 0xef, 0x09, 0x96, 0xab, 0xa5, 0x3c, 0x27, 0x52, 0x8b,
-  0xbf, 0xae, 0x47, 0xc2, 0xde, 0x28, 0xba, 0xed, 0x33, 0x12, 0xe8, 0x5e,
-  0x27, 0x2f, 0x88, 0x37, 0x55, 0x40, 0xaf, 0x15, 0xdd, 0xab, 0xcc, 0xda,
-  0xee, 0x40, 0x84, 0x1f, 0xa8, 0x87, 0x37, 0x21, 0x1a, 0x0e, 0x42, 0x64,
-  0x38, 0xe9, 0x6b, 0x8f, 0x94, 0x87, 0x57, 0x1d, 0xa1, 0x4e, 0xf0, 0xc2,
-  0xad, 0x4e, 0x6f, 0xbd, 0xd5, 0x39, 0xb2, 0x8b, 0x9d, 0x05, 0xbb, 0x99,
-  0xb5, 0x59, 0x1e, 0x05, 0x0e, 0xd9, 0x2c, 0x20, 0xfe, 0xb4, 0xe9, 0xb8,
-  0xdf, 0xd9, 0xc0, 0x36, 0x5e, 0x5d, 0x0c, 0x7d, 0x63, 0x73, 0x69, 0xf7,
-  0xa3, 0xed, 0x57, 0xed, 0xbb, 0x93, 0x75, 0x46, 0x1c, 0x79, 0x94, 0x39,
-  0x55, 0x44, 0x06, 0xdc, 0xad, 0xd0, 0x3a, 0x8e, 0xf6, 0x58, 0xe1, 0xf4,
-  0xfc, 0xba, 0x4e, 0xc1, 0x9a, 0xb5, 0xae, 0xdc, 0xf4, 0x4d, 0xf2, 0x44,
-  0x1b, 0x0b, 0xae, 0x70, 0x5e, 0x13, 0x60, 0xb9, 0xc4, 0x62, 0x48, 0x01,
-  0x67, 0x91, 0x8b, 0xad, 0x9d, 0x9a, 0x31, 0x1b, 0x28, 0x97, 0x46, 0xf3,
-  0x95, 0x3d, 0x6d, 0x17, 0x96, 0xf4, 0xe9, 0xaa, 0x3e, 0x7a, 0xd5, 0x9c,
-  0xee, 0x58, 0xd4, 0x3e, 0x72, 0xee, 0x1b, 0x80, 0x72, 0xd1, 0xb8, 0x98,
-  0x38, 0x49, 0x7e, 0x14, 0x2a, 0x20, 0xa8, 0xcb, 0x4a, 0xbc, 0x28, 0xa7,
-  0xb3, 0xbe, 0x22, 0x50, 0x44, 0x82, 0x0e, 0xf2, 0xfd, 0xb1, 0xa1, 0xd8,
-  0x6e, 0x3f, 0x2c, 0x73, 0x5b, 0x98, 0xdc, 0x66, 0x0d, 0x87, 0xdf, 0x1f,
-  0x0d, 0xdd, 0x28, 0xb4, 0xd2, 0x68, 0xeb, 0xe5, 0x3e, 0x8e, 0x06, 0xc4,
-  0xaa, 0x94, 0x16, 0xd4, 0x83, 0x9c, 0xa0, 0xd7, 0xad, 0x68, 0x51, 0x72,
-  0x29, 0xaf, 0x45, 0x1c, 0xc0, 0xd8, 0x08, 0xac, 0xf4, 0x2d, 0x16, 0xf6,
-  0xb0, 0xbe, 0xfd, 0xce, 0xea, 0xce, 0xad, 0xd6, 0xac, 0x71, 0xfe, 0x6d,
-  0xce, 0x2a, 0x1f, 0x6f, 0x9d, 0x73, 0xa0, 0x3a, 0xcb, 0x86, 0x8f, 0x55,
-  0x7c, 0xf9, 0xb8, 0xce, 0x66, 0x81, 0x35, 0x14, 0x00, 0x37, 0xfe, 0xfa,
-  0x91, 0x3a, 0xb4, 0x27, 0xfe, 0x08, 0x11, 0xbd, 0xa2, 0x4a, 0xb6, 0xec,
-  0x12, 0x92, 0xda, 0xdc, 0x01, 0xc9, 0x11, 0xb0, 0x76, 0xdc, 0x2e, 0xf5,
-  0x02, 0x12, 0xdd, 0xba, 0xa0, 0xb9, 0xf8, 0x63, 0xf9, 0x8d, 0x47, 0xaf,
-  0x28, 0x16, 0xe2, 0x8b, 0xce, 0xc7, 0xe5, 0x96, 0x4d, 0x04, 0x84, 0x8b,
-  0x9b, 0xb3, 0x6c, 0xd6, 0x84, 0x22, 0xc5, 0x1b, 0x60, 0xf2, 0xc3, 0x44,
-  0xbb, 0x28, 0x22, 0x96, 0xe2, 0x01, 0xc3, 0xc4, 0x15, 0x0e, 0xe3, 0xca,
-  0xc7, 0xdb, 0x2b, 0xe2, 0x0e, 0x3c, 0x9e, 0x42, 0x83, 0x1b, 0x3f, 0xc7,
-  0x10, 0xbf, 0xc4, 0x6d, 0x3a, 0x26, 0x7d, 0x89, 0xb7, 0x27, 0x28, 0x7c,
-  0x05, 0xb0, 0x2e, 0x10, 0xbe, 0x04, 0x4a, 0xee, 0xc6, 0x21, 0x8a, 0xb9,
-  0xfb, 0x26, 0x93, 0x5a, 0x66, 0xde, 0xa6, 0x99, 0x01, 0x01, 0x9e, 0x72,
-  0xe5, 0x0d, 0x82, 0x29, 0x63, 0x68, 0x6d, 0x1f, 0x6a, 0xe7, 0x6b, 0x3b,
-  0x13, 0xd4, 0x46, 0x6f, 0xaf, 0x3b, 0x6c, 0xf7, 0xf6, 0xbb, 0xab, 0xe8,
-  0x0d, 0x93, 0xb3, 0x3f, 0xa8, 0x83, 0xcb, 0xaa, 0xb5, 0x97, 0x15, 0xcb,
-  0xa8, 0x93, 0x0a, 0x83, 0xe2, 0x08, 0x52, 0x03, 0xff, 0xdd, 0x20, 0x13,
-  0x9d, 0x9b, 0x76, 0x50, 0x67, 0x48, 0xe0, 0x98, 0xe1, 0xec, 0x6a, 0xe8,
-  0xf6, 0x3e, 0xc7, 0xe9, 0xdc, 0x6f, 0xf5, 0xbb, 0xb5, 0x35, 0x9c, 0x4d,
-  0x91, 0xe2, 0xff, 0x53, 0x51, 0xa8, 0x19, 0x4b, 0x29, 0xfe, 0x37, 0x9a,
-  0x2c, 0xe1, 0x75, 0xf3, 0x26, 0x3c, 0xb8, 0xbd, 0xa2, 0x53, 0x31, 0x5b,
-  0xd6, 0xf6, 0x44, 0x24, 0x10, 0xd1, 0x89, 0x25, 0xa8, 0x40, 0xad, 0x3b,
-  0xcc, 0x9c, 0x64, 0xcc, 0x88, 0x9d, 0xde, 0xb1, 0xc2, 0xb2, 0x31, 0xb8,
-  0xd5, 0xbb, 0xa5, 0x9f, 0x5a, 0xf3, 0xdc, 0xec, 0x0f, 0x35, 0xe1, 0xd8,
-  0x30, 0x9d, 0x9d, 0x6a, 0x40, 0x4a, 0xc2, 0x60, 0xf5, 0x40, 0xc5, 0xae,
-  0xab, 0xeb, 0x9d, 0x96, 0xce, 0x9f, 0xc8, 0x54, 0xf7, 0x12, 0x3e, 0xa7,
-  0x91, 0xfc, 0xe0, 0xe9, 0x33, 0x97, 0x2f, 0x5d, 0x3b, 0x3b, 0xa3, 0xf8,
-  0xb9, 0xb9, 0x97, 0x9f, 0xb2, 0x3f, 0xc5, 0x23, 0xd1, 0x7a, 0x32, 0x08,
-  0x00, 0xc3, 0x23, 0xc2, 0x1c, 0x0c, 0xee, 0x38, 0xec, 0x93, 0x85, 0xfe,
-  0xab, 0x4a, 0x2f, 0xaa, 0x49, 0xc4, 0x7c, 0x68, 0xa4, 0x70, 0x73, 0x17,
-  0x68, 0x7f, 0x31, 0xc0, 0x57, 0x42, 0x04, 0x1d, 0xf6, 0x86, 0xc8, 0xfd,
-  0xe8, 0x85, 0xd1, 0xc1, 0xf3, 0xa7, 0xc9, 0x05, 0xd4, 0xaa, 0x5b, 0x4f,
-  0x96, 0x64, 0x2e, 0x69, 0xa9, 0xe6, 0xe9, 0xed, 0xf5, 0xf1, 0xd9, 0x8b,
-  0xad, 0xe1, 0x76, 0x73, 0xb3, 0xd3, 0xc3, 0x40, 0x1a, 0xde, 0xfa, 0x74,
-  0x32, 0xff, 0x1c, 0xe5, 0xf3, 0xd4, 0x91, 0x9f, 0xff, 0x7f, 0x73, 0x47,
-  0xbb, 0x23, 0xc5, 0x71, 0xfc, 0x7f, 0x4f, 0x31, 0x8c, 0x89, 0x67, 0xc6,
-  0x5e, 0xf6, 0x16, 0x5b, 0x10, 0xe5, 0xce, 0x04, 0x61, 0x38, 0x64, 0x24,
-  0x30, 0x27, 0xee, 0x90, 0xe3, 0x00, 0xf1, 0xce, 0xed, 0xce, 0x71, 0x13,
-  0x76, 0x77, 0x36, 0x3b, 0x73, 0x1c, 0x84, 0xac, 0x94, 0x6f, 0x47, 0x8a,
-  0x14, 0x94, 0xbf, 0x51, 0x12, 0x47, 0x72, 0xfe, 0x46, 0x22, 0xb6, 0x15,
-  0x27, 0x8e, 0x82, 0x5f, 0x01, 0xbf, 0x82, 0x5f, 0x20, 0xaf, 0x90, 0xaa,
-  0xea, 0xaf, 0xea, 0x8f, 0xd9, 0xdd, 0xbb, 0x38, 0x1f, 0xfc, 0xe1, 0x76,
-  0xba, 0xbb, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xaa, 0xba, 0x9c,
-  0x1c, 0x36, 0x85, 0xd3, 0xc4, 0x6e, 0xf3, 0x35, 0xd1, 0x06, 0xda, 0x9e,
-  0xe7, 0x2d, 0x6b, 0x8d, 0x80, 0x53, 0xfb, 0x3c, 0x47, 0x68, 0x9a, 0x53,
-  0x3a, 0xae, 0xc9, 0xe1, 0x98, 0x74, 0x2e, 0x39, 0x52, 0xfc, 0xd9, 0x85,
-  0xa2, 0x1d, 0x74, 0x53, 0x4a, 0x5f, 0xeb, 0x44, 0x49, 0x4f, 0x3d, 0x2e,
-  0xa6, 0x4e, 0xda, 0x50, 0x9a, 0xd2, 0x68, 0xb2, 0xf9, 0x86, 0xf8, 0x25,
-  0x51, 0xd5, 0xbf, 0x25, 0x02, 0x74, 0xc6, 0x77, 0x23, 0xfe, 0xaf, 0x48,
-  0xb3, 0x65, 0x1a, 0x10, 0xd6, 0x75, 0xd1, 0xa8, 0xe2, 0xd8, 0x0a, 0x99,
-  0x86, 0x8f, 0xcb, 0x16, 0x7b, 0xac, 0x2b, 0xc5, 0x2c, 0x12, 0x7f, 0x75,
-  0x61, 0x11, 0xeb, 0x4a, 0xe1, 0xf6, 0xdf, 0xaf, 0x26, 0xc5, 0xb2, 0xe6,
-  0x58, 0xc7, 0x6d, 0xad, 0x06, 0x97, 0x20, 0x7e, 0x11, 0x75, 0x00, 0xea,
-  0x4e, 0xc7, 0x8c, 0x29, 0xf3, 0x6a, 0x22, 0x28, 0x56, 0xd3, 0x08, 0x23,
-  0x1d, 0xe0, 0x09, 0x54, 0xca, 0x75, 0xb6, 0x6f, 0x0a, 0x25, 0x81, 0x9a,
-  0x9c, 0xba, 0x89, 0x8c, 0x19, 0xa5, 0x38, 0x54, 0xdd, 0x55, 0x47, 0xaf,
-  0x8b, 0x0d, 0x03, 0xd5, 0x7c, 0xfc, 0x36, 0xa0, 0xbf, 0xa1, 0x07, 0x2b,
-  0x5e, 0x49, 0x84, 0xfe, 0xaa, 0xc1, 0x83, 0xa2, 0x21, 0xaf, 0x04, 0x37,
-  0x8b, 0xaf, 0x42, 0x25, 0xf3, 0xc7, 0x00, 0x9b, 0xfd, 0x30, 0x42, 0x6c,
-  0xa2, 0x5d, 0xea, 0x2e, 0xe9, 0x68, 0xc4, 0xbd, 0xf5, 0xd6, 0x5c, 0x16,
-  0xaa, 0x00, 0x56, 0xbf, 0x8a, 0x29, 0x28, 0x00, 0x2b, 0xfc, 0xdb, 0x8e,
-  0xe9, 0x34, 0x75, 0xf0, 0xe9, 0xd2, 0xe2, 0x28, 0x12, 0x55, 0x18, 0x9b,
-  0x3c, 0x2e, 0x72, 0x94, 0x01, 0x92, 0x93, 0x59, 0x03, 0x9c, 0xac, 0xab,
-  0x87, 0xa3, 0xd1, 0xbb, 0x50, 0x21, 0xcd, 0xf8, 0x1a, 0x03, 0x01, 0x78,
-  0xd0, 0xda, 0xe4, 0x06, 0x96, 0xa6, 0xf4, 0x8a, 0xa5, 0xbd, 0x26, 0xe2,
-  0x5e, 0xcc, 0x80, 0x0c, 0x29, 0xd3, 0x62, 0x18, 0x84, 0xc0, 0x31, 0xd4,
-  0xda, 0x62, 0x6e, 0x68, 0x8c, 0xea, 0xd2, 0xe9, 0x27, 0x38, 0x84, 0x39,
-  0x6c, 0x53, 0x84, 0x18, 0xfe, 0x01, 0xc0, 0x71, 0x15, 0x79, 0x62, 0x24,
-  0xdc, 0xdd, 0x5b, 0x58, 0x1a, 0xee, 0xcf, 0x17, 0x2b, 0x2d, 0x83, 0x16,
-  0xe5, 0x8b, 0x81, 0x18, 0x09, 0x13, 0x06, 0x22, 0x45, 0xce, 0x62, 0x20,
-  0x72, 0xcf, 0x11, 0x03, 0xa7, 0x71, 0xa1, 0xfc, 0x90, 0xf8, 0xe1, 0x9f,
-  0xb2, 0x17, 0x6b, 0xfc, 0xc7, 0x5d, 0xca, 0x9b, 0x27, 0x16, 0x22, 0xe2,
-  0x11, 0x64, 0xbd, 0x87, 0x3c, 0x54, 0x51, 0x99, 0x02, 0xeb, 0x4d, 0xa1,
-  0x62, 0x39, 0x85, 0x72, 0x2e, 0x9d, 0xa6, 0xe8, 0x04, 0x8b, 0x4f, 0x07,
-  0x9c, 0x8d, 0xf5, 0x40, 0x8c, 0x7e, 0xfa, 0x21, 0x5d, 0xa2, 0x3d, 0xb3,
-  0xb4, 0xbd, 0xe7, 0x11, 0xb9, 0x78, 0x81, 0x2e, 0xf1, 0xc5, 0x53, 0xd4,
-  0xf2, 0x1c, 0x2c, 0xbc, 0xd5, 0x16, 0x86, 0xf2, 0x2c, 0x12, 0x4e, 0x8c,
-  0xe2, 0x7e, 0xce, 0x41, 0x76, 0xe1, 0x22, 0x4c, 0x65, 0xf2, 0x95, 0x95,
-  0x57, 0x9e, 0xe1, 0x61, 0xce, 0x08, 0x4d, 0x75, 0x6d, 0xe7, 0xa6, 0x64,
-  0x90, 0x8c, 0xd2, 0x8c, 0x35, 0x69, 0xbc, 0x1b, 0x67, 0x94, 0xf8, 0x33,
-  0xc0, 0x06, 0x76, 0x5b, 0xb6, 0xfd, 0xea, 0xc6, 0x11, 0x35, 0xee, 0xd6,
-  0x94, 0xb0, 0xac, 0xd7, 0x89, 0xce, 0xc9, 0x53, 0x62, 0x6b, 0x8c, 0x37,
-  0x72, 0x1e, 0xc2, 0x8b, 0x33, 0x7f, 0x8e, 0x96, 0xb5, 0x13, 0xdb, 0x50,
-  0x70, 0xe2, 0xdb, 0xda, 0x09, 0x09, 0x77, 0xdc, 0xde, 0xa0, 0x55, 0x5b,
-  0x5f, 0xce, 0x89, 0x67, 0x54, 0xe5, 0xc3, 0xab, 0xe5, 0xc8, 0x96, 0x8c,
-  0xe2, 0xb3, 0x30, 0x4b, 0x2f, 0xe2, 0x6d, 0x5e, 0x8f, 0x2f, 0x8c, 0xfd,
-  0x72, 0xb4, 0x7c, 0x61, 0xe8, 0x4a, 0x6e, 0x4b, 0xf9, 0x2e, 0x46, 0xab,
-  0xed, 0x4f, 0xd5, 0x49, 0x9c, 0x76, 0x78, 0xd8, 0x54, 0x30, 0xd1, 0x23,
-  0xa0, 0xa8, 0x15, 0x5b, 0x70, 0x3c, 0x1d, 0x35, 0x35, 0x8e, 0xcd, 0x89,
-  0x0c, 0xdb, 0x98, 0x44, 0xc3, 0xed, 0x4d, 0x5e, 0xfc, 0x91, 0x74, 0xef,
-  0xbf, 0x4b, 0x17, 0x86, 0x8f, 0xe0, 0x9c, 0xf5, 0x67, 0xe1, 0x7b, 0x14,
-  0x07, 0x0f, 0x4e, 0x0a, 0x61, 0x07, 0x8e, 0x8f, 0x6c, 0x17, 0xfd, 0xf8,
-  0x36, 0x17, 0x23, 0x9c, 0xe0, 0x6c, 0x69, 0xbf, 0x80, 0x84, 0xb1, 0x3d,
-  0x54, 0x83, 0xf3, 0xb0, 0xf0, 0x49, 0x40, 0x88, 0x04, 0x4d, 0xf1, 0x79,
-  0x17, 0x78, 0x61, 0x5a, 0x4d, 0x81, 0xf1, 0x9b, 0xea, 0x7a, 0x75, 0x04,
-  0xc7, 0xa1, 0xbc, 0x2e, 0x52, 0x46, 0xc1, 0xb2, 0xbe, 0x5a, 0xce, 0xc6,
-  0x70, 0x16, 0x41, 0x3a, 0x32, 0x50, 0x98, 0x8b, 0x62, 0xaf, 0x9c, 0xc4,
-  0xac, 0xa3, 0x1b, 0x97, 0xbe, 0xf5, 0xde, 0xad, 0xad, 0xdd, 0x5b, 0xd7,
-  0xb6, 0x76, 0xa0, 0xee, 0xeb, 0x06, 0x06, 0x7e, 0x7c, 0xf7, 0xbd, 0x2b,
-  0x5b, 0xd7, 0x2f, 0xbd, 0x0b, 0x05, 0xaf, 0xf5, 0x7a, 0x94, 0x6b, 0x07,
-  0x15, 0x7f, 0xa0, 0xc8, 0xec, 0x31, 0x9d, 0xc0, 0x84, 0x12, 0x2b, 0xbe,
-  0x3e, 0x3a, 0x98, 0x99, 0x47, 0xc3, 0x81, 0x4e, 0x8a, 0x2d, 0x8b, 0x47,
-  0xc5, 0x00, 0x44, 0xf6, 0x6d, 0xa2, 0x82, 0xf3, 0x98, 0x0e, 0xda, 0x13,
-  0xa4, 0xb2, 0x82, 0x82, 0xe3, 0xaa, 0xfc, 0xa9, 0x1c, 0x67, 0x54, 0x71,
-  0x37, 0x9f, 0x4e, 0x51, 0xbf, 0x20, 0x36, 0x03, 0x61, 0x45, 0x73, 0xcb,
-  0x8f, 0x68, 0x66, 0xbc, 0xe6, 0x80, 0xb0, 0x70, 0xd2, 0xd1, 0x85, 0xfb,
-  0x63, 0x38, 0x6b, 0xff, 0xe4, 0xc5, 0xa7, 0x68, 0xa9, 0x42, 0x1f, 0x06,
-  0xe2, 0x82, 0x17, 0xcf, 0xba, 0xdd, 0x6e, 0xac, 0x1d, 0x33, 0xe4, 0x98,
-  0x00, 0xb5, 0x6f, 0xdd, 0xb8, 0xfe, 0x56, 0xd3, 0x4c, 0x6f, 0x15, 0xdf,
-  0x3b, 0x2c, 0xea, 0x26, 0xd5, 0xa7, 0x30, 0xa8, 0xd1, 0xad, 0x00, 0xb9,
-  0x34, 0xde, 0xbe, 0xb9, 0xb3, 0x0b, 0xb8, 0xc5, 0xeb, 0x66, 0x1d, 0x3a,
-  0x6f, 0x09, 0xc8, 0xda, 0x13, 0x2c, 0xc6, 0x69, 0x55, 0x14, 0x4a, 0xb9,
-  0xcd, 0x06, 0xc7, 0x83, 0xd5, 0x6a, 0xb9, 0x60, 0x2f, 0x10, 0xed, 0x79,
-  0x8d, 0x15, 0xf9, 0x19, 0x3d, 0x31, 0xc8, 0xe5, 0xfe, 0x17, 0x62, 0xcb,
-  0xf8, 0x54, 0x0f, 0xf9, 0x2f, 0x28, 0xff, 0x4f, 0xc5, 0x9b, 0x0c, 0xe2,
-  0xa8, 0x1a, 0x50, 0x88, 0x31, 0xe6, 0x9b, 0xa3, 0x69, 0x32, 0x85, 0x56,
-  0xd2, 0x7b, 0xf1, 0x4f, 0x78, 0x60, 0x93, 0x91, 0x0e, 0x73, 0x87, 0x46,
-  0xe2, 0xaf, 0xbe, 0x9d, 0xad, 0xf2, 0xf4, 0x13, 0x33, 0x0c, 0xb4, 0x33,
-  0xc1, 0xd1, 0x95, 0x43, 0x55, 0x06, 0x1c, 0x87, 0x36, 0x85, 0xb4, 0x6e,
-  0x86, 0x89, 0x23, 0x3a, 0x7e, 0x5b, 0xc4, 0xf9, 0x8a, 0x5e, 0x35, 0x4c,
-  0x17, 0x52, 0xbe, 0x57, 0xcd, 0x9a, 0xaf, 0x00, 0x12, 0x69, 0xb6, 0x8a,
-  0x13, 0x17, 0x9d, 0xbe, 0x17, 0xce, 0xca, 0xef, 0xe8, 0x82, 0x8f, 0xf2,
-  0x76, 0xf2, 0xa9, 0xf8, 0x54, 0x24, 0x54, 0xf9, 0x9c, 0x42, 0x57, 0x7e,
-  0x41, 0xf1, 0xa1, 0xf0, 0x81, 0xf1, 0xe0, 0x32, 0x0e, 0x3c, 0x0e, 0xff,
-  0x61, 0xdd, 0x46, 0x3c, 0x30, 0x81, 0x4b, 0xbd, 0x47, 0x4b, 0x5a, 0x97,
-  0x88, 0x66, 0x40, 0xb8, 0xe9, 0xac, 0xba, 0x3f, 0x2b, 0xea, 0xda, 0xa2,
-  0x1d, 0x5b, 0x58, 0xe4, 0x64, 0x21, 0xfd, 0xc5, 0x2e, 0x57, 0x63, 0x90,
-  0x79, 0x78, 0x7a, 0xf6, 0xed, 0x8e, 0xd3, 0x62, 0x36, 0x10, 0xc3, 0xa7,
-  0x13, 0xea, 0x0c, 0x04, 0xc6, 0x30, 0xc5, 0x96, 0xd0, 0x0d, 0x1c, 0xb6,
-  0xd7, 0x23, 0xdc, 0xc6, 0xe1, 0x00, 0x9a, 0x45, 0xaf, 0xc8, 0xb7, 0x2a,
-  0x56, 0xe0, 0xef, 0xbe, 0xb7, 0x74, 0x03, 0xc4, 0x03, 0xde, 0x93, 0x9d,
-  0x7b, 0xd7, 0xf4, 0x73, 0x36, 0xe2, 0x85, 0x2b, 0x71, 0xf9, 0x3a, 0x5c,
-  0x38, 0xdf, 0x1f, 0x58, 0x48, 0x3d, 0xf3, 0x96, 0xdf, 0x8b, 0x67, 0x1d,
-  0x34, 0xf2, 0x7c, 0xf2, 0xc5, 0xaf, 0xd1, 0x51, 0xff, 0xb9, 0x6f, 0x85,
-  0xb4, 0xe4, 0x10, 0x25, 0x20, 0x9a, 0x35, 0xc2, 0x73, 0x92, 0x9c, 0x58,
-  0x18, 0xb7, 0xba, 0xeb, 0x33, 0xbc, 0x3a, 0xed, 0xc5, 0x68, 0x96, 0x62,
-  0x88, 0x2c, 0x8b, 0x16, 0x61, 0xfb, 0xc2, 0xb1, 0x61, 0x2c, 0x5a, 0x7e,
-  0xab, 0xc2, 0x30, 0xcc, 0x7a, 0x72, 0x28, 0xfe, 0xf2, 0x9d, 0x5b, 0xdb,
-  0x53, 0x08, 0x0a, 0x4b, 0x6c, 0xcf, 0xf6, 0xba, 0x37, 0xf8, 0x5e, 0xc9,
-  0xbd, 0x63, 0x55, 0x8d, 0x57, 0x5f, 0xdd, 0x5c, 0x5b, 0x81, 0x81, 0x7f,
-  0x8f, 0x0a, 0x06, 0x46, 0x22, 0xe2, 0x7d, 0xf9, 0x47, 0x5f, 0x3c, 0xc5,
-  0xd7, 0xda, 0xa2, 0x14, 0xdf, 0xa9, 0x04, 0x56, 0xfe, 0x25, 0xbd, 0x10,
-  0xfa, 0x0c, 0x38, 0xd8, 0xc0, 0x9d, 0xaf, 0x9f, 0x7e, 0xc2, 0xba, 0x9e,
-  0x67, 0xc0, 0x3a, 0x58, 0xfb, 0x23, 0x0a, 0xe3, 0xf8, 0x61, 0x44, 0x4f,
-  0xbd, 0xe1, 0x79, 0xe0, 0x53, 0x68, 0xc6, 0xb7, 0xed, 0x75, 0x5c, 0x57,
-  0xbd, 0x39, 0x5d, 0xcb, 0x7f, 0x06, 0x0c, 0xd5, 0xd7, 0x0c, 0xe5, 0x3d,
-  0x35, 0xf3, 0x64, 0xcd, 0xdd, 0x81, 0xec, 0x2d, 0x07, 0x49, 0x49, 0x53,
-  0x9a, 0x06, 0x84, 0x78, 0xe4, 0x6e, 0xf2, 0x9a, 0xb9, 0x3a, 0x5c, 0x8d,
-  0xc8, 0x2c, 0x7b, 0x9f, 0x3d, 0x8d, 0x2e, 0xbb, 0x92, 0x41, 0xdc, 0xcb,
-  0x05, 0xce, 0x05, 0xa7, 0x8c, 0xe6, 0xf9, 0xa9, 0x52, 0xdf, 0x3e, 0xa7,
-  0xe0, 0xbf, 0xbf, 0x0b, 0xc3, 0xab, 0x78, 0xfa, 0x8e, 0xc2, 0x19, 0xd5,
-  0x13, 0x78, 0x86, 0xbe, 0xcf, 0x5f, 0x7c, 0x16, 0x67, 0x99, 0x73, 0x19,
-  0xe9, 0x30, 0x84, 0xc0, 0x82, 0x16, 0x42, 0x9b, 0xc5, 0x9e, 0xef, 0x76,
-  0x20, 0x69, 0x45, 0xdd, 0xcd, 0xb5, 0xe5, 0xf3, 0x6f, 0xef, 0x92, 0xd4,
-  0xae, 0x2b, 0x83, 0x58, 0xe6, 0x7d, 0x93, 0x31, 0xc7, 0xd1, 0xb1, 0x08,
-  0x4b, 0x8f, 0xce, 0xf0, 0x15, 0x95, 0x2f, 0x10, 0x77, 0x65, 0x35, 0x2c,
-  0x07, 0xdb, 0x70, 0x1e, 0x92, 0xf6, 0x7b, 0xa5, 0x8a, 0xb1, 0x43, 0xdc,
-  0x64, 0x88, 0xe5, 0xef, 0x94, 0xcd, 0x81, 0x9a, 0x7c, 0x7b, 0x3b, 0x50,
-  0x19, 0xb6, 0xc8, 0x94, 0x87, 0x73, 0xb1, 0x3d, 0xab, 0xc6, 0x25, 0xa8,
-  0x96, 0xb0, 0x0c, 0x60, 0xe8, 0x0f, 0x0b, 0x76, 0xfd, 0x2a, 0x5e, 0x7d,
-  0x20, 0xe3, 0x0f, 0x3d, 0x1b, 0x22, 0xcc, 0x40, 0xb3, 0x22, 0x1f, 0x3e,
-  0xa6, 0xfc, 0x66, 0xd1, 0x29, 0x90, 0x98, 0xef, 0x14, 0x7b, 0x3b, 0xa2,
-  0xe0, 0xe6, 0xf6, 0xd6, 0xdb, 0x7c, 0xcd, 0x10, 0xb8, 0x94, 0x52, 0xa0,
-  0x69, 0x6e, 0xe1, 0x79, 0xc7, 0x12, 0x8a, 0xae, 0xa1, 0x48, 0x16, 0x91,
-  0x53, 0x4c, 0xdc, 0xcc, 0xfc, 0x28, 0xe4, 0x60, 0x8a, 0xf6, 0x71, 0x9a,
-  0xfe, 0x1f, 0xe3, 0x3a, 0xa0, 0xb8, 0xa6, 0xe7, 0x89, 0x7a, 0xdd, 0xed,
-  0x6c, 0x6f, 0x35, 0x8b, 0x39, 0x50, 0x41, 0xfa, 0x0a, 0x7b, 0x2b, 0xa3,
-  0x1d, 0xe7, 0x79, 0x47, 0xb5, 0xb5, 0xf3, 0x22, 0x09, 0x1e, 0xda, 0xae,
-  0x44, 0x56, 0x29, 0xf9, 0xac, 0x16, 0x83, 0x05, 0x73, 0xeb, 0x6d, 0x97,
-  0x43, 0xa1, 0x07, 0xb3, 0x47, 0xb1, 0x44, 0x12, 0x98, 0x21, 0x57, 0x3b,
-  0xcc, 0xab, 0x1f, 0x5d, 0x2a, 0x15, 0xb9, 0x2a, 0xa7, 0x15, 0x7a, 0x9c,
-  0x5a, 0xeb, 0x75, 0x30, 0x2a, 0xf2, 0x99, 0x33, 0xcb, 0xec, 0xe1, 0x04,
-  0x22, 0xb7, 0x9a, 0x32, 0x4c, 0xc3, 0xb3, 0x85, 0xd0, 0xd0, 0xab, 0x1f,
-  0x1d, 0xcd, 0xd3, 0x44, 0xb2, 0x23, 0x50, 0xd1, 0x0c, 0xc5, 0x6a, 0xac,
-  0xa8, 0xe1, 0xbc, 0x10, 0xa9, 0xd5, 0xba, 0x08, 0xf4, 0x49, 0x74, 0x43,
-  0xd4, 0x2b, 0x28, 0xb8, 0xdd, 0x48, 0x14, 0xf2, 0xe1, 0x70, 0xb5, 0xfe,
-  0x79, 0xa3, 0x90, 0xc5, 0xf1, 0x89, 0xb6, 0x76, 0x4e, 0xd1, 0x09, 0x57,
-  0x64, 0xbd, 0x0b, 0xd8, 0xf0, 0x81, 0xd1, 0x6e, 0xe4, 0x93, 0xc3, 0x7c,
-  0x74, 0xab, 0xd8, 0x87, 0x91, 0x1c, 0xc8, 0x08, 0x30, 0x29, 0xf9, 0x71,
-  0x41, 0xc9, 0x5c, 0x32, 0xea, 0x59, 0xc7, 0xad, 0x9d, 0xed, 0x33, 0x97,
-  0xb6, 0x63, 0x76, 0xe6, 0x90, 0xd6, 0x08, 0x1e, 0x51, 0xb0, 0xcd, 0xc6,
-  0x69, 0xb7, 0x77, 0x2b, 0xd7, 0x75, 0x39, 0xbc, 0xb4, 0x8d, 0xeb, 0xc6,
-  0x40, 0xb6, 0x44, 0xa3, 0xe3, 0xc9, 0x2e, 0xce, 0x87, 0x3a, 0x8b, 0xa7,
-  0x3a, 0x4c, 0x2f, 0x48, 0x14, 0xa8, 0x3c, 0x10, 0x24, 0x1e, 0x26, 0x87,
-  0x67, 0x62, 0xdd, 0x1e, 0x5b, 0xa0, 0x39, 0x07, 0xd9, 0xf8, 0x5b, 0xd5,
-  0xba, 0x14, 0x59, 0x03, 0x2a, 0x68, 0xd2, 0xe5, 0xe9, 0xbb, 0x92, 0x8c,
-  0x58, 0xb5, 0xc6, 0xa9, 0x81, 0xe1, 0x79, 0xea, 0x49, 0x0b, 0xe8, 0x18,
-  0x3d, 0xc4, 0x31, 0xe4, 0xfc, 0xc5, 0xdf, 0xa2, 0x77, 0xca, 0xab, 0x25,
-  0x39, 0x91, 0xc1, 0x4a, 0xfe, 0x6b, 0x6c, 0x34, 0x14, 0x25, 0xfd, 0x16,
-  0x89, 0xd5, 0x2f, 0x7f, 0x07, 0xfb, 0xc3, 0x87, 0xbe, 0x6c, 0xa0, 0xdd,
-  0xc0, 0x7e, 0x27, 0xf5, 0xc5, 0xf3, 0x6e, 0x84, 0xa1, 0xe3, 0xf0, 0x95,
-  0x25, 0xa2, 0xc6, 0x3d, 0x03, 0xf7, 0x98, 0xcf, 0x04, 0x1a, 0xc9, 0xe9,
-  0x27, 0x0c, 0xd1, 0x79, 0x12, 0x51, 0x3e, 0x7f, 0xad, 0xa7, 0xa9, 0xf8,
-  0x3a, 0xea, 0x4e, 0x04, 0x2a, 0xfd, 0xfc, 0x8b, 0x9f, 0x90, 0x61, 0x0e,
-  0x24, 0xd4, 0xfb, 0x94, 0xa6, 0xf9, 0x57, 0xee, 0xfd, 0x86, 0xa7, 0xc3,
-  0x69, 0x76, 0xab, 0xf9, 0xa5, 0x90, 0xf5, 0xc9, 0x96, 0xe6, 0xa2, 0xa8,
-  0x14, 0x6e, 0xd0, 0xe2, 0x86, 0x4f, 0xe4, 0x35, 0xe5, 0x3b, 0x18, 0xa6,
-  0x8d, 0x52, 0x15, 0x8c, 0x32, 0xc3, 0xdb, 0xc8, 0x87, 0x78, 0x0c, 0x17,
-  0x98, 0xae, 0xd8, 0x0d, 0x1b, 0x8a, 0x90, 0x6b, 0x18, 0x3b, 0xf7, 0x30,
-  0x1f, 0xd9, 0x75, 0xb4, 0xc4, 0x0e, 0xe3, 0xa8, 0xb7, 0x55, 0x2f, 0x14,
-  0x48, 0xda, 0x7d, 0xf9, 0x1e, 0x62, 0x10, 0xb3, 0x52, 0x35, 0x6b, 0xe0,
-  0x67, 0xce, 0x6c, 0xae, 0xad, 0xb0, 0xa9, 0x52, 0x76, 0x9d, 0x4f, 0x74,
-  0x72, 0xa1, 0x50, 0x1c, 0x82, 0x38, 0x19, 0x28, 0xb3, 0xb1, 0xf0, 0x56,
-  0xfc, 0xac, 0xcf, 0xd6, 0xb4, 0x9a, 0x85, 0x37, 0xac, 0xa7, 0x77, 0x6d,
-  0x72, 0xf2, 0xcd, 0x2a, 0x2c, 0x43, 0xd8, 0xeb, 0x49, 0x51, 0x94, 0xd7,
-  0x8f, 0x27, 0x03, 0x33, 0x35, 0xb4, 0x08, 0x65, 0x00, 0xd4, 0x6a, 0x54,
-  0x90, 0x22, 0xe0, 0x70, 0x30, 0x10, 0x47, 0xb2, 0xfc, 0x28, 0x2f, 0x9b,
-  0xe0, 0x5e, 0xce, 0x2d, 0x22, 0xb2, 0x3e, 0x9b, 0x4c, 0xd3, 0x31, 0x50,
-  0x70, 0xaf, 0x1c, 0x95, 0xcd, 0xe3, 0x34, 0xf3, 0x2e, 0x60, 0x35, 0x05,
-  0x40, 0x1f, 0x60, 0x14, 0x30, 0x7b, 0x22, 0x83, 0xd3, 0x89, 0xce, 0xe9,
-  0x53, 0x9b, 0xa3, 0xd3, 0x9d, 0x94, 0x64, 0xae, 0x2e, 0x16, 0xc6, 0x7a,
-  0x15, 0xab, 0x9e, 0x78, 0xfb, 0x5d, 0xbc, 0xd5, 0x40, 0x06, 0x1e, 0x61,
-  0x00, 0xff, 0x33, 0x26, 0x38, 0x11, 0x8f, 0xdb, 0xd3, 0x17, 0x7e, 0xd4,
-  0x66, 0xa3, 0x14, 0xb3, 0x66, 0xef, 0xff, 0x8b, 0xa7, 0xe9, 0x24, 0x13,
-  0xd5, 0x32, 0x55, 0x6d, 0xe4, 0x5b, 0x3c, 0xe2, 0x2f, 0x7f, 0xfb, 0xb3,
-  0x16, 0xf9, 0xf7, 0x31, 0x69, 0x46, 0xf4, 0x2a, 0x31, 0x37, 0xfa, 0x2c,
-  0x19, 0x2e, 0x7f, 0xdc, 0x79, 0x92, 0x8f, 0x76, 0x56, 0x1b, 0x97, 0x69,
-  0x8b, 0x43, 0xe3, 0x2d, 0x6d, 0xf5, 0x64, 0xa1, 0xc5, 0x29, 0x68, 0x73,
-  0x5a, 0x32, 0xfa, 0x36, 0xe9, 0x0f, 0x8b, 0x5c, 0x08, 0xec, 0x67, 0x6d,
-  0x1b, 0xc1, 0xef, 0x8f, 0x27, 0xd3, 0x2d, 0xb3, 0x99, 0x39, 0x00, 0x61,
-  0x36, 0x85, 0x1e, 0x33, 0x62, 0x78, 0x23, 0x58, 0xc8, 0xad, 0xc1, 0x79,
-  0xfb, 0x5c, 0x9d, 0xea, 0x98, 0xe5, 0xe0, 0x19, 0xee, 0x8d, 0x50, 0xe5,
-  0xa9, 0xe0, 0xdb, 0xc0, 0x5c, 0xb6, 0x2c, 0x50, 0xad, 0x79, 0x31, 0x3c,
-  0xe7, 0xe2, 0xbe, 0x58, 0xed, 0x3c, 0xaf, 0xf7, 0x36, 0xd7, 0x3c, 0x91,
-  0x0e, 0x90, 0xf5, 0x16, 0x60, 0x09, 0x71, 0x7a, 0x5f, 0x54, 0xba, 0x15,
-  0x70, 0xa1, 0x16, 0xd8, 0xf2, 0xb6, 0xd9, 0xe1, 0x24, 0x35, 0xfe, 0x11,
-  0xde, 0x99, 0xc5, 0x5a, 0x52, 0xa1, 0x13, 0x0d, 0x47, 0xc6, 0xe7, 0xd9,
-  0x63, 0x2d, 0x40, 0x73, 0x84, 0xf1, 0x24, 0x25, 0xf7, 0xe4, 0x89, 0xbf,
-  0xfc, 0xcd, 0x1f, 0xfe, 0xf9, 0xd7, 0xa7, 0xed, 0x9a, 0x05, 0xe5, 0x77,
-  0x23, 0x39, 0xf3, 0xbe, 0x98, 0x1c, 0x72, 0xfb, 0x89, 0x50, 0xfd, 0x8c,
-  0xff, 0x0b, 0x07, 0x1b, 0x23, 0x37, 0x69, 0xb2, 0x7b, 0x1e, 0xf9, 0xab,
-  0xe9, 0xea, 0xd4, 0x97, 0x64, 0xb4, 0xb6, 0x7d, 0xbf, 0x9a, 0x18, 0x54,
-  0xfb, 0x81, 0xb3, 0xe5, 0x61, 0x48, 0x52, 0xda, 0x6f, 0xa2, 0xa5, 0x92,
-  0x3d, 0x3b, 0x7c, 0x94, 0xd7, 0x5b, 0x0f, 0x29, 0xcf, 0xd6, 0x44, 0x45,
-  0x4c, 0xaa, 0x34, 0xed, 0x96, 0xbb, 0x00, 0x0a, 0x37, 0x7d, 0x96, 0xc4,
-  0x22, 0x51, 0x5d, 0xe8, 0xb2, 0xff, 0x16, 0x75, 0x3f, 0x22, 0x79, 0x10,
-  0xb8, 0x63, 0x3d, 0x95, 0xe8, 0x1c, 0xf5, 0xe7, 0xa4, 0x87, 0x8b, 0xec,
-  0xf7, 0x52, 0x83, 0x5e, 0xd0, 0x8d, 0x56, 0xd6, 0x02, 0x3c, 0xbe, 0xd9,
-  0x4a, 0x81, 0xcb, 0xa8, 0x3b, 0x73, 0x12, 0x88, 0x5c, 0xf1, 0xdb, 0xb0,
-  0x0d, 0xde, 0x26, 0x73, 0xa4, 0xb5, 0xb5, 0x88, 0x62, 0x97, 0x4a, 0xae,
-  0x41, 0x82, 0xee, 0x78, 0x51, 0x02, 0x1a, 0x12, 0x0d, 0xcb, 0x5a, 0x53,
-  0x29, 0xf4, 0xb2, 0xd4, 0x57, 0x7d, 0xbc, 0x16, 0xa2, 0xc4, 0xe3, 0x36,
-  0x9d, 0x2c, 0xbb, 0xac, 0xc5, 0xc6, 0x3f, 0x7a, 0x4c, 0x04, 0xd0, 0x43,
-  0x50, 0x51, 0x84, 0xb7, 0x14, 0x71, 0x43, 0xef, 0x57, 0x73, 0xfa, 0x79,
-  0x76, 0x19, 0xdb, 0x2a, 0x93, 0xc8, 0xf5, 0x6a, 0x28, 0x41, 0xdf, 0x37,
-  0x12, 0x6e, 0x9f, 0xf9, 0x4f, 0xe1, 0x19, 0xa8, 0xc4, 0xa6, 0xd8, 0x06,
-  0x8c, 0x67, 0x3f, 0x9f, 0xa3, 0xbe, 0x79, 0x21, 0x1a, 0xe7, 0x8f, 0x6e,
-  0xb9, 0xdf, 0xed, 0x78, 0x6c, 0x16, 0x92, 0xe4, 0xd4, 0x13, 0x06, 0x48,
-  0x15, 0xd6, 0x2c, 0x9e, 0xf8, 0x24, 0xdb, 0xfb, 0xb8, 0x9c, 0xa4, 0x7b,
-  0x70, 0x34, 0xd3, 0x90, 0xaf, 0x50, 0xe9, 0x2b, 0xa2, 0x74, 0x5a, 0x1d,
-  0xa5, 0x67, 0xbb, 0xe7, 0x3a, 0x01, 0x84, 0xf4, 0x4b, 0xd2, 0xbd, 0x5e,
-  0xe6, 0x79, 0x27, 0xf4, 0xbf, 0x7c, 0xfa, 0x71, 0xa4, 0x41, 0xe2, 0xc9,
-  0xa2, 0x9c, 0x44, 0x18, 0x87, 0x0c, 0xb0, 0xe7, 0xe3, 0x3a, 0x4a, 0x73,
-  0x01, 0x86, 0x8c, 0x99, 0x0e, 0xe4, 0x79, 0xc6, 0xde, 0x76, 0x4e, 0x66,
-  0xe2, 0x52, 0xe3, 0x1a, 0x4c, 0xf3, 0x65, 0xa0, 0xd1, 0x1e, 0xfa, 0x13,
-  0x22, 0xb0, 0xa3, 0x72, 0x32, 0xac, 0x8e, 0xcc, 0xf0, 0xbd, 0x5a, 0x9e,
-  0x8d, 0x46, 0x76, 0xb3, 0xab, 0xed, 0x5a, 0x6c, 0x6b, 0x2c, 0x27, 0x65,
-  0xa3, 0x19, 0xa3, 0x23, 0x28, 0xa4, 0x54, 0xcf, 0xcc, 0x7b, 0xdf, 0xf9,
-  0x84, 0xb0, 0xe6, 0xca, 0x24, 0x57, 0xd6, 0xd7, 0xab, 0xfb, 0x3b, 0x22,
-  0x15, 0x03, 0xca, 0x3d, 0x73, 0xec, 0x12, 0x77, 0xa8, 0x83, 0xa2, 0x7c,
-  0x58, 0x0c, 0xaf, 0x01, 0x9c, 0x32, 0x1f, 0x41, 0xd5, 0xda, 0x54, 0x58,
-  0x6b, 0x0f, 0xed, 0x45, 0xc1, 0x21, 0x63, 0x65, 0xe0, 0xc0, 0xed, 0x1b,
-  0x4e, 0x28, 0xf9, 0x05, 0x8a, 0x2e, 0xc9, 0x94, 0xca, 0x57, 0x83, 0xa1,
-  0x6e, 0x15, 0x71, 0x2b, 0xc3, 0x60, 0xc9, 0xfb, 0x36, 0xb2, 0x77, 0x59,
-  0x31, 0x71, 0x72, 0xb0, 0xcb, 0x31, 0xca, 0x52, 0xe7, 0xa9, 0xd9, 0x53,
-  0x17, 0xec, 0x87, 0xb1, 0x03, 0xc4, 0x11, 0x10, 0x98, 0x7f, 0xa9, 0xcc,
-  0xa3, 0x54, 0x2b, 0x6f, 0xb6, 0x39, 0x3b, 0xdf, 0x88, 0xca, 0xd6, 0x09,
-  0xc5, 0xaa, 0xab, 0xed, 0x40, 0xf4, 0xff, 0x7b, 0xc0, 0xad, 0xf5, 0x7b,
-  0x78, 0x4d, 0x96, 0xcc, 0xa3, 0xf0, 0x81, 0x65, 0x85, 0xf6, 0x64, 0xf6,
-  0x48, 0xe6, 0x96, 0xfd, 0x50, 0x68, 0xf0, 0x42, 0xd2, 0xbc, 0xfc, 0x72,
-  0xc0, 0x0a, 0x7a, 0x61, 0x81, 0x15, 0x74, 0xa1, 0xeb, 0x9c, 0xc1, 0xc7,
-  0xdc, 0xd5, 0x58, 0x7b, 0x22, 0x13, 0xf6, 0x88, 0x74, 0x8d, 0xf8, 0x26,
-  0x1d, 0x6b, 0x24, 0xe6, 0xa0, 0xd1, 0x3a, 0xa5, 0x00, 0x4a, 0x3f, 0x6e,
-  0x00, 0x0c, 0xe5, 0x3f, 0x10, 0x4c, 0xb3, 0x13, 0x7a, 0x00, 0xda, 0x3e,
-  0x16, 0xd9, 0xd3, 0x11, 0x2d, 0xe6, 0x6f, 0x4b, 0x21, 0xb5, 0x27, 0xc2,
-  0xd2, 0xbe, 0xd8, 0x18, 0xcb, 0x3a, 0x9a, 0x54, 0xde, 0xd6, 0xaf, 0x75,
-  0x1f, 0xda, 0x86, 0x28, 0x28, 0x84, 0xbd, 0x26, 0x01, 0x7a, 0x0c, 0xf6,
-  0xcb, 0xa4, 0xf0, 0xc9, 0x66, 0x6a, 0x25, 0x83, 0xa3, 0xc5, 0x28, 0xd0,
-  0xb3, 0x36, 0x3e, 0x3a, 0xd3, 0x76, 0x19, 0x0b, 0x23, 0xac, 0xa7, 0xe4,
-  0x19, 0x4d, 0x5d, 0xa2, 0xe6, 0x6a, 0xd9, 0x4c, 0x51, 0xdd, 0xe0, 0xc3,
-  0x7a, 0xad, 0x2d, 0x27, 0xd5, 0x19, 0xec, 0x4f, 0x25, 0xca, 0x0a, 0x4c,
-  0xb3, 0x9c, 0x5d, 0x4f, 0x06, 0x1e, 0x6f, 0x36, 0xe6, 0x9e, 0x37, 0x2f,
-  0x92, 0x7f, 0xb7, 0x22, 0x97, 0x24, 0x91, 0x45, 0x87, 0x05, 0xa9, 0x40,
-  0x03, 0xeb, 0x1b, 0x77, 0xc3, 0x56, 0x4a, 0xe0, 0x71, 0x29, 0x8f, 0x7d,
-  0x6a, 0xc2, 0xb7, 0x58, 0xf2, 0xd1, 0x35, 0x5c, 0x3b, 0x4a, 0xf5, 0xa1,
-  0x59, 0xb7, 0x79, 0xd4, 0x28, 0xb7, 0xfa, 0x56, 0x8c, 0x34, 0xe7, 0xce,
-  0xd5, 0xa9, 0xca, 0x4e, 0xcf, 0xd2, 0x60, 0xff, 0x2c, 0xca, 0xc4, 0x58,
-  0xf8, 0x43, 0x06, 0x7b, 0xd8, 0xbd, 0x08, 0xe1, 0xc4, 0x0b, 0x14, 0x12,
-  0xeb, 0x84, 0xea, 0xe3, 0xdf, 0x6a, 0xad, 0xc8, 0xa9, 0xba, 0x34, 0xa2,
-  0x95, 0x94, 0x62, 0x11, 0xbb, 0xd6, 0x08, 0x2d, 0x35, 0x6d, 0x16, 0xb4,
-  0xec, 0x3b, 0x2e, 0x22, 0x93, 0xe2, 0x08, 0x11, 0x49, 0x70, 0x49, 0x78,
-  0x32, 0x19, 0xbe, 0x05, 0x60, 0x33, 0x23, 0x37, 0x6c, 0x3f, 0x6f, 0x17,
-  0x47, 0xf0, 0x31, 0x1d, 0x32, 0x69, 0xb3, 0xa0, 0x3b, 0xb3, 0x3c, 0x90,
-  0x67, 0x0c, 0xa0, 0x93, 0x33, 0xfd, 0x57, 0xc3, 0xf6, 0x2b, 0xe2, 0x8d,
-  0x8a, 0x5b, 0xe2, 0x9f, 0x14, 0x69, 0x5d, 0x03, 0x15, 0x40, 0xb1, 0x04,
-  0x79, 0x32, 0x46, 0x45, 0x08, 0x55, 0xcc, 0x69, 0x31, 0xdc, 0x10, 0x9e,
-  0xdc, 0xb9, 0xba, 0xde, 0xcb, 0xd8, 0xe6, 0xe1, 0x5f, 0x91, 0xf8, 0x97,
-  0x8c, 0x89, 0x08, 0x84, 0xc3, 0xeb, 0x20, 0x84, 0x6a, 0x16, 0xa0, 0x84,
-  0x87, 0x3a, 0x92, 0xe4, 0x3d, 0x5b, 0xc5, 0x85, 0xa5, 0xc8, 0x65, 0x61,
-  0x88, 0x7d, 0x98, 0x8b, 0xa0, 0xa1, 0xf2, 0xa2, 0xdd, 0x9f, 0xcf, 0x85,
-  0xd1, 0x33, 0x27, 0x15, 0x82, 0x94, 0x96, 0xbc, 0x45, 0xcd, 0xbd, 0xe9,
-  0x20, 0xb2, 0x1b, 0xa0, 0xde, 0xf4, 0x2a, 0x9d, 0x9c, 0xd6, 0x04, 0xa8,
-  0xcb, 0xf8, 0x7f, 0x30, 0x4d, 0x91, 0x85, 0xc2, 0x22, 0xd9, 0xe6, 0x69,
-  0xd0, 0x4b, 0x5a, 0x9a, 0x9d, 0x8e, 0xfa, 0x9e, 0x01, 0x47, 0xe0, 0xbd,
-  0x5c, 0xa6, 0x23, 0xa6, 0xe0, 0xb3, 0x11, 0x2c, 0xb0, 0x1a, 0x00, 0xda,
-  0xd6, 0x04, 0x96, 0x3e, 0x16, 0x74, 0xd8, 0xd8, 0xf4, 0x2d, 0x14, 0x8a,
-  0xa5, 0xc1, 0xac, 0x92, 0xf3, 0x20, 0x2f, 0xcf, 0x9c, 0xb7, 0xc0, 0xe5,
-  0x92, 0x82, 0xd6, 0x57, 0xac, 0xa0, 0xb5, 0xff, 0xe9, 0x3c, 0xad, 0x4c,
-  0x29, 0x87, 0x0a, 0x38, 0x04, 0x4e, 0x09, 0xee, 0x91, 0x24, 0x28, 0xb1,
-  0x5b, 0xc9, 0x01, 0xfb, 0x94, 0xb0, 0xc9, 0xa9, 0xb3, 0x11, 0x76, 0xa2,
-  0xe9, 0xac, 0x40, 0x87, 0x40, 0x25, 0x97, 0x1d, 0x1a, 0x51, 0x1b, 0x3e,
-  0xc4, 0x01, 0x2c, 0xcb, 0xa6, 0xd0, 0xd9, 0xc1, 0x86, 0xe5, 0x43, 0x41,
-  0x19, 0x55, 0xb7, 0x4b, 0x69, 0xe0, 0x50, 0x89, 0x46, 0x8d, 0x9a, 0x28,
-  0x78, 0xa6, 0xc0, 0x02, 0xc3, 0xa4, 0xa2, 0x9e, 0x18, 0xf7, 0x5e, 0x35,
-  0x03, 0xf5, 0xfb, 0xcd, 0x0a, 0xb6, 0x8a, 0x31, 0x0e, 0xfe, 0xec, 0xf4,
-  0x11, 0xec, 0x54, 0x98, 0x2e, 0xe5, 0xa5, 0xa2, 0x28, 0x0c, 0xe7, 0x4a,
-  0x2c, 0x15, 0x9b, 0x2e, 0xea, 0xed, 0xa0, 0xbc, 0x7f, 0x30, 0xc2, 0xe4,
-  0xcd, 0x49, 0xe6, 0x3c, 0xa9, 0x86, 0x77, 0xb7, 0x75, 0x93, 0x8f, 0xa7,
-  0x0b, 0x06, 0x84, 0x99, 0x9a, 0x45, 0x43, 0x5d, 0xdb, 0x09, 0x7c, 0x4a,
-  0x5e, 0x3a, 0x7f, 0xfe, 0x7c, 0x12, 0xaa, 0x81, 0x89, 0xa3, 0x77, 0xca,
-  0xef, 0x23, 0x4b, 0x24, 0xbd, 0xee, 0x37, 0x8a, 0xb1, 0x53, 0xcb, 0xb9,
-  0x68, 0xb9, 0x73, 0xfa, 0x09, 0x6d, 0x99, 0xaa, 0x7c, 0x7e, 0x2f, 0xe2,
-  0xfe, 0xf7, 0x63, 0x9f, 0xbf, 0x5a, 0x71, 0x95, 0x75, 0x9d, 0x1e, 0x10,
-  0xba, 0x2c, 0x51, 0xa7, 0x72, 0xfc, 0x54, 0xd6, 0x3b, 0x70, 0xc0, 0x92,
-  0x94, 0x1c, 0x5b, 0x6c, 0x68, 0xc6, 0xd8, 0xeb, 0x7d, 0x7d, 0x6f, 0x7f,
-  0x5f, 0x2e, 0x75, 0xbb, 0x12, 0x0e, 0xf3, 0x1d, 0x4a, 0x8f, 0x4d, 0x22,
-  0xa1, 0x1a, 0x0d, 0x13, 0x4d, 0x68, 0x3d, 0x31, 0xc2, 0xcd, 0xf4, 0xf2,
-  0x41, 0x39, 0x1a, 0xa6, 0x7a, 0x84, 0x36, 0xa7, 0xf0, 0x2a, 0x46, 0xa8,
-  0x87, 0x27, 0xdc, 0x3c, 0xb5, 0x25, 0x0b, 0x52, 0x05, 0x26, 0x0b, 0x69,
-  0x5a, 0xb2, 0x2e, 0xef, 0xc1, 0xae, 0xef, 0x18, 0x1b, 0xec, 0xc5, 0xe3,
-  0x1d, 0xf3, 0x7c, 0xd3, 0xe8, 0x2a, 0xef, 0x9e, 0x39, 0x07, 0x02, 0x63,
-  0x28, 0x65, 0xef, 0x44, 0xf3, 0xeb, 0x69, 0x89, 0xb4, 0xc2, 0x66, 0xaa,
-  0x8c, 0x62, 0x5a, 0x33, 0xf7, 0x4c, 0x92, 0x4c, 0xfc, 0x51, 0x75, 0x92,
-  0x07, 0x84, 0xe7, 0xff, 0x03, 0xf2, 0x88, 0xd3, 0xc5, 0xa8, 0x17, 0x6d,
-  0x78, 0xe5, 0x6f, 0x11, 0xf7, 0x84, 0xc6, 0xe6, 0xdc, 0xf1, 0x59, 0x0a,
-  0x26, 0xba, 0x2a, 0xe3, 0x8d, 0xbc, 0xb5, 0xdf, 0x92, 0x8b, 0xb8, 0x74,
-  0xec, 0xa6, 0x42, 0x91, 0x9c, 0x4d, 0x7a, 0x77, 0x77, 0x62, 0x96, 0xdd,
-  0x2e, 0xc5, 0x72, 0x22, 0x06, 0x39, 0x80, 0x83, 0xfa, 0x3b, 0x4e, 0xb3,
-  0xcc, 0x4a, 0x94, 0x67, 0x57, 0xe1, 0x71, 0x17, 0x64, 0x4b, 0x82, 0x26,
-  0xd4, 0x19, 0x73, 0xed, 0x26, 0xe7, 0xa2, 0x2b, 0xd2, 0x40, 0xf4, 0x9a,
-  0x72, 0x03, 0x85, 0x4d, 0x8d, 0x28, 0x25, 0x11, 0x44, 0x60, 0x51, 0xb5,
-  0x2f, 0x90, 0xd5, 0x32, 0x4c, 0xba, 0x7f, 0x0b, 0x90, 0x72, 0xa6, 0xe9,
-  0xb0, 0xae, 0xcd, 0xee, 0xca, 0x86, 0x81, 0x25, 0x47, 0x07, 0xe8, 0xdf,
-  0x9e, 0xaa, 0x16, 0x6f, 0x70, 0x8c, 0x40, 0xbb, 0xf4, 0x8d, 0xef, 0xb6,
-  0x63, 0x0c, 0x02, 0x5e, 0xe2, 0x22, 0xbe, 0xcc, 0x4d, 0xdc, 0x90, 0x84,
-  0xab, 0xd9, 0xb3, 0xa2, 0x9e, 0xc2, 0x1f, 0x85, 0xbe, 0x25, 0xd8, 0x2f,
-  0x40, 0x15, 0x4b, 0xe3, 0x75, 0x35, 0x77, 0xd0, 0x9a, 0x5f, 0x3e, 0x8d,
-  0x8b, 0xe6, 0xa0, 0x1a, 0x6e, 0x44, 0xd2, 0xc9, 0x96, 0x95, 0xec, 0x55,
-  0x43, 0xcc, 0x4a, 0x2b, 0x31, 0xe8, 0xf0, 0x0c, 0xaa, 0x75, 0x79, 0x7f,
-  0x92, 0x8f, 0x36, 0xa2, 0x4b, 0xe8, 0x36, 0xb7, 0x43, 0x3f, 0x94, 0xfb,
-  0x6d, 0x4a, 0xce, 0xb7, 0x99, 0x01, 0x34, 0xe7, 0x38, 0x92, 0xd6, 0xa3,
-  0x50, 0xec, 0x56, 0x0f, 0xec, 0xab, 0xb3, 0xe6, 0x00, 0x9f, 0xbe, 0x6c,
-  0x71, 0xbb, 0xf6, 0x7d, 0x8b, 0x8d, 0x67, 0x7b, 0x74, 0xfa, 0x89, 0xa2,
-  0xc8, 0x7c, 0x83, 0x6c, 0x72, 0xb2, 0x07, 0xcb, 0x47, 0x9b, 0xfb, 0xf2,
-  0x38, 0x54, 0x03, 0x45, 0x6a, 0x4f, 0x53, 0x4c, 0xb7, 0xc6, 0xaf, 0xa9,
-  0x97, 0x37, 0xe0, 0x70, 0x86, 0xcf, 0x19, 0x0b, 0xfb, 0x5d, 0xf7, 0xf6,
-  0xad, 0xeb, 0x72, 0x1b, 0xb8, 0xb9, 0xf7, 0x5d, 0x38, 0x60, 0xc0, 0xef,
-  0x14, 0x9b, 0x79, 0xad, 0xf2, 0xf6, 0x8d, 0x23, 0xce, 0x63, 0x56, 0x3d,
-  0xef, 0x1e, 0xcc, 0x8a, 0x7d, 0x0c, 0xd8, 0x9d, 0x8d, 0xf8, 0x57, 0x35,
-  0x7f, 0x6c, 0x71, 0x99, 0x62, 0x0d, 0x19, 0x27, 0xcd, 0x92, 0xb3, 0xb9,
-  0x05, 0x9a, 0x6c, 0x68, 0x29, 0x9f, 0x11, 0x31, 0xe4, 0x56, 0x8f, 0x38,
-  0x26, 0xb8, 0xe4, 0x67, 0xb2, 0x99, 0x66, 0x1c, 0x84, 0xdd, 0xb9, 0x70,
-  0xba, 0xf2, 0x3b, 0x67, 0x04, 0x03, 0x6d, 0xb3, 0x7a, 0xc0, 0x08, 0x06,
-  0x23, 0xe5, 0xf0, 0xcc, 0x82, 0x53, 0x87, 0x65, 0xff, 0x50, 0xd2, 0xd7,
-  0xc1, 0x00, 0x6c, 0xea, 0x97, 0x05, 0x06, 0xf4, 0xd9, 0x1d, 0x66, 0xe8,
-  0x84, 0xa2, 0xbc, 0x13, 0x61, 0x0d, 0x1b, 0x87, 0x57, 0xf7, 0xe0, 0xd2,
-  0x27, 0xff, 0x1a, 0xd7, 0x9d, 0x15, 0x9a, 0xa0, 0x2f, 0xab, 0x11, 0x02,
-  0x73, 0x1d, 0x01, 0x1f, 0xe6, 0xd2, 0xbe, 0x39, 0xd3, 0x58, 0xab, 0x23,
-  0x24, 0x50, 0x32, 0xef, 0xea, 0xda, 0x90, 0xe1, 0x03, 0xe3, 0x2d, 0x4b,
-  0xa9, 0xb6, 0x9e, 0x46, 0x8e, 0xbb, 0xad, 0xe5, 0x42, 0xcb, 0xc4, 0xa3,
-  0xf4, 0xa0, 0x95, 0xbe, 0x22, 0x40, 0xa2, 0x7f, 0xbc, 0xf8, 0x04, 0x1d,
-  0x69, 0x39, 0x42, 0x27, 0x62, 0x0f, 0xd3, 0x47, 0x66, 0xc3, 0xb2, 0x64,
-  0xb3, 0x36, 0xde, 0xb3, 0xaf, 0xaf, 0x44, 0x64, 0xab, 0x57, 0x36, 0xf9,
-  0x05, 0x57, 0xe6, 0xee, 0x94, 0x1c, 0xd3, 0xa3, 0x96, 0xf3, 0x0c, 0xf3,
-  0xae, 0x75, 0xe6, 0xcf, 0x72, 0xab, 0x75, 0xe8, 0xc2, 0x6f, 0x9c, 0x4e,
-  0x2c, 0xa6, 0x1c, 0xff, 0x58, 0x7d, 0x80, 0xf0, 0x5c, 0x0e, 0xb9, 0x5d,
-  0xf6, 0x04, 0x33, 0x72, 0x4e, 0x2c, 0x58, 0xed, 0xb9, 0x13, 0x39, 0xce,
-  0x4b, 0x37, 0x86, 0x13, 0x50, 0xda, 0x27, 0x0f, 0x1c, 0xb3, 0xf9, 0x18,
-  0x3e, 0x2f, 0x0b, 0x8f, 0x4b, 0xc6, 0x57, 0xde, 0xde, 0xb1, 0xed, 0xe5,
-  0x63, 0x09, 0x6d, 0x61, 0x2b, 0xa8, 0x73, 0x66, 0x04, 0x95, 0x12, 0x2b,
-  0xd8, 0xc9, 0xf4, 0x88, 0xb9, 0x28, 0x14, 0x20, 0x37, 0xfe, 0x82, 0x7b,
-  0x2a, 0xff, 0xc9, 0xc9, 0x3c, 0x81, 0xe8, 0x98, 0x94, 0xbd, 0x26, 0x47,
-  0xc5, 0x29, 0x2e, 0x62, 0x5b, 0xbd, 0x65, 0x0f, 0xaa, 0xba, 0x99, 0x08,
-  0xe7, 0x3d, 0x8d, 0x8a, 0x08, 0x4d, 0x94, 0xea, 0x09, 0x43, 0x56, 0xd5,
-  0xf5, 0xa3, 0x43, 0xf6, 0x0f, 0x47, 0xa3, 0xdb, 0xb4, 0x49, 0xf4, 0x0f,
-  0x9a, 0x66, 0xba, 0xb1, 0xbe, 0x8e, 0x51, 0xbe, 0xa2, 0xf6, 0xbc, 0x8b,
-  0xde, 0x21, 0xa3, 0xbe, 0x41, 0x46, 0x8d, 0x52, 0x89, 0x7d, 0xd9, 0x3a,
-  0x50, 0xc1, 0x09, 0xcb, 0xe3, 0xf5, 0xbc, 0x25, 0xe2, 0x42, 0x75, 0xdd,
-  0x34, 0x41, 0xe4, 0x6e, 0xc3, 0x0a, 0x5c, 0xda, 0xcb, 0xc2, 0x76, 0xb6,
-  0xda, 0x2e, 0x5e, 0x2d, 0xbd, 0xa1, 0xe8, 0xe6, 0x30, 0x53, 0x79, 0x7c,
-  0x46, 0x2a, 0x86, 0x65, 0xf3, 0x66, 0x33, 0x59, 0xca, 0x47, 0x58, 0xef,
-  0xcc, 0x5e, 0x33, 0xb1, 0x79, 0xa9, 0x14, 0x59, 0x4c, 0x02, 0x1e, 0x67,
-  0xa5, 0xb0, 0xf8, 0xa9, 0xcc, 0x75, 0x25, 0x7f, 0xf3, 0x5b, 0xb4, 0xa7,
-  0x2f, 0xe6, 0x2c, 0x2b, 0x46, 0x96, 0x26, 0x07, 0xe5, 0x70, 0x58, 0x84,
-  0xba, 0x61, 0x75, 0xa5, 0x6e, 0x5d, 0x9b, 0xda, 0x96, 0xfb, 0x93, 0x7b,
-  0x0e, 0x10, 0xcd, 0xf7, 0x61, 0x7c, 0x75, 0x9a, 0x71, 0xcf, 0x07, 0x83,
-  0x87, 0x72, 0x3d, 0xf5, 0xd0, 0x36, 0x3f, 0x6d, 0x33, 0x9f, 0x1d, 0x71,
-  0xc7, 0x86, 0x47, 0x77, 0x55, 0xed, 0x40, 0x33, 0xcf, 0x2b, 0xc9, 0x16,
-  0x0e, 0x9b, 0x56, 0x29, 0x1a, 0xa4, 0xd1, 0x9d, 0x54, 0xe7, 0x9e, 0x0f,
-  0x46, 0x4f, 0x88, 0xb7, 0x4c, 0x17, 0x74, 0xca, 0x38, 0x49, 0xcf, 0xb2,
-  0x7f, 0xf7, 0x77, 0xe5, 0xe6, 0x0d, 0xc9, 0x93, 0xd7, 0x29, 0xc4, 0xca,
-  0xbd, 0x06, 0xfc, 0x37, 0x84, 0x16, 0x3d, 0x11, 0xaf, 0x1a, 0x65, 0xce,
-  0x12, 0x12, 0x12, 0xc0, 0xc7, 0x87, 0xc6, 0x13, 0x42, 0x62, 0x39, 0xed,
-  0xe6, 0xc6, 0x8b, 0xd2, 0xba, 0xd4, 0x51, 0x79, 0xd0, 0x6f, 0x4f, 0xca,
-  0xef, 0x1d, 0x52, 0x1c, 0x2e, 0xdd, 0x6b, 0xe3, 0x1f, 0xa0, 0x2a, 0x3c,
-  0x82, 0xae, 0x81, 0xca, 0xd7, 0xf0, 0xdd, 0x87, 0x0e, 0x9d, 0x86, 0xd4,
-  0x03, 0xac, 0xe8, 0x65, 0x85, 0x5e, 0xc9, 0xa0, 0xd7, 0x3f, 0x28, 0x8a,
-  0xe9, 0xcd, 0x59, 0x79, 0x1f, 0x7d, 0xd3, 0xd4, 0x71, 0x05, 0xaf, 0xcd,
-  0xa6, 0x39, 0x00, 0x26, 0x43, 0x02, 0xc6, 0x91, 0x9b, 0x4c, 0xea, 0x16,
-  0x54, 0x12, 0xb9, 0xd6, 0x17, 0x69, 0x91, 0x74, 0x52, 0xa6, 0x5b, 0x9d,
-  0x5c, 0x8c, 0x14, 0x8e, 0xe2, 0xf5, 0x4d, 0xf5, 0x6b, 0x8e, 0xce, 0xa8,
-  0xb2, 0xdb, 0xf9, 0xd9, 0xbe, 0x63, 0xf8, 0x41, 0x33, 0xf9, 0xe4, 0x4d,
-  0xd5, 0xf0, 0x82, 0x86, 0x01, 0x8a, 0x21, 0x3d, 0xf9, 0x41, 0xc1, 0x32,
-  0xb7, 0x8a, 0xfb, 0x5b, 0x8f, 0xa6, 0x69, 0xff, 0xee, 0x5d, 0x0e, 0xeb,
-  0xee, 0xdd, 0xe1, 0xab, 0xa7, 0xfb, 0xb0, 0x52, 0x62, 0x1e, 0x8e, 0xad,
-  0xd0, 0x46, 0x20, 0x35, 0xc5, 0x05, 0xf3, 0x61, 0xd0, 0x61, 0x13, 0xfd,
-  0xb8, 0xc5, 0x8a, 0x83, 0x3f, 0xee, 0x70, 0x02, 0xde, 0x23, 0x67, 0x75,
-  0x0e, 0x6e, 0x56, 0xdc, 0xa7, 0x8c, 0x50, 0x1c, 0x8d, 0xef, 0xc0, 0x76,
-  0x5d, 0x0f, 0xf2, 0x69, 0x21, 0x3f, 0x58, 0x63, 0xc8, 0xe6, 0xe9, 0xc5,
-  0x0d, 0x1b, 0xd1, 0x14, 0x31, 0xcd, 0xb2, 0x8b, 0xa7, 0xfb, 0x3c, 0x05,
-  0x05, 0x2a, 0x9d, 0x01, 0x3c, 0xe9, 0xb7, 0x7f, 0xe8, 0x25, 0x3c, 0x40,
-  0x20, 0xd7, 0x8d, 0xf8, 0xc6, 0xb2, 0x72, 0x59, 0xb3, 0xc0, 0x67, 0x4e,
-  0x80, 0x2a, 0x27, 0x83, 0xd1, 0xe1, 0xb0, 0xa8, 0x1d, 0x34, 0xb9, 0x5f,
-  0xae, 0x85, 0x4b, 0xd0, 0xf8, 0xcc, 0x53, 0xdf, 0x58, 0x70, 0x02, 0xb3,
-  0xab, 0x37, 0x52, 0x3c, 0xd8, 0x82, 0x16, 0xa5, 0x9e, 0x6e, 0x90, 0xe7,
-  0x68, 0xbb, 0x33, 0x9d, 0x06, 0x51, 0x8f, 0xd4, 0xbe, 0x2a, 0xa2, 0xda,
-  0x48, 0x7f, 0xe4, 0x09, 0xfa, 0x91, 0x12, 0x29, 0x32, 0x3b, 0xef, 0x9f,
-  0xdc, 0x9b, 0x54, 0x57, 0xa2, 0x15, 0x9c, 0xbd, 0xe9, 0x8f, 0x3b, 0x67,
-  0xef, 0x01, 0x77, 0x52, 0xb4, 0xc9, 0x35, 0x38, 0x63, 0xa9, 0x6f, 0x24,
-  0x62, 0xa3, 0x0d, 0x85, 0x57, 0xc4, 0x71, 0x15, 0x2a, 0x69, 0xfe, 0x28,
-  0x55, 0xdf, 0x3a, 0x56, 0x17, 0xcc, 0x9f, 0x62, 0x6d, 0x55, 0xe2, 0x90,
-  0x46, 0x79, 0x4d, 0x3f, 0xa2, 0x6d, 0x16, 0x82, 0x50, 0x77, 0x2c, 0xaa,
-  0xd4, 0x15, 0x2c, 0x79, 0xdb, 0xe2, 0x41, 0xf3, 0x11, 0x9e, 0x42, 0xd9,
-  0xbb, 0x55, 0x68, 0xcc, 0x7e, 0x81, 0x49, 0x58, 0x6d, 0x0a, 0x56, 0x9a,
-  0x80, 0xaf, 0x8c, 0xfc, 0xc7, 0x24, 0xbe, 0x24, 0xfd, 0xc9, 0x08, 0xcf,
-  0x55, 0x15, 0x6b, 0x25, 0x8b, 0x8b, 0x57, 0x2b, 0x40, 0x4c, 0x7c, 0xd2,
-  0xe2, 0x68, 0xfd, 0x4e, 0xf7, 0x95, 0x57, 0x2f, 0x82, 0x04, 0x98, 0xa7,
-  0xd9, 0x0f, 0xee, 0xdc, 0xbd, 0x77, 0xf7, 0xee, 0xbd, 0xf5, 0xfb, 0x20,
-  0x82, 0x60, 0xc5, 0xbf, 0x1c, 0xfb, 0xf7, 0xa5, 0x2a, 0x15, 0x3b, 0xed,
-  0x6f, 0xa9, 0x4a, 0xdb, 0x2c, 0x89, 0xb6, 0x3c, 0xc9, 0xbd, 0x4c, 0xbd,
-  0xa8, 0x26, 0x58, 0x35, 0xb8, 0xa8, 0xff, 0xd4, 0x29, 0xde, 0x37, 0x94,
-  0x45, 0x4a, 0xfa, 0xe5, 0xe8, 0x60, 0x28, 0xe1, 0x88, 0xb3, 0x0f, 0x3b,
-  0xe5, 0xae, 0xf9, 0x44, 0xdf, 0xf6, 0xc4, 0x99, 0x65, 0x97, 0x85, 0x85,
-  0x09, 0xdf, 0x46, 0x56, 0x78, 0x95, 0xb7, 0x0b, 0x45, 0xdb, 0xb1, 0xb3,
-  0x8f, 0x3c, 0xbc, 0xc8, 0xc3, 0xac, 0xd9, 0x74, 0x28, 0x93, 0xd3, 0x85,
-  0xe8, 0x75, 0x31, 0xf6, 0x87, 0xf9, 0x4c, 0x01, 0x5f, 0x94, 0x6a, 0x43,
-  0x58, 0x6b, 0x24, 0x68, 0x95, 0x2a, 0x88, 0x47, 0x7b, 0xb9, 0xd8, 0x0b,
-  0xd1, 0x1a, 0xa8, 0x61, 0x0d, 0x81, 0xdb, 0x0d, 0x41, 0x29, 0x2b, 0xde,
-  0xd4, 0x98, 0x70, 0x5b, 0xac, 0x6c, 0x29, 0x8d, 0xea, 0xd5, 0x34, 0x1f,
-  0x94, 0xb4, 0xb9, 0x4a, 0x56, 0x6d, 0xa1, 0x4d, 0x6b, 0x4c, 0x9d, 0x0d,
-  0xce, 0xdc, 0x27, 0xc5, 0x78, 0x9f, 0x14, 0xeb, 0x18, 0x3b, 0xe5, 0xc6,
-  0x3c, 0xdf, 0xe4, 0xdb, 0x63, 0x39, 0x78, 0xf0, 0x16, 0x79, 0x06, 0xce,
-  0x1c, 0x24, 0x97, 0x53, 0x63, 0x35, 0x7a, 0x50, 0x74, 0xaa, 0x21, 0x85,
-  0xd2, 0x4f, 0xf4, 0xcc, 0x84, 0x22, 0xe7, 0x62, 0xc2, 0x0b, 0xd4, 0x0c,
-  0x8e, 0x1f, 0x43, 0x5e, 0x8d, 0x98, 0x5f, 0x76, 0xb2, 0xeb, 0x0e, 0x55,
-  0x6c, 0x54, 0x65, 0xd1, 0x09, 0x4c, 0xbb, 0xb0, 0xf7, 0x60, 0x84, 0x3f,
-  0x71, 0x91, 0xd8, 0x8a, 0xfd, 0xfa, 0x78, 0xa5, 0x54, 0xc8, 0xf4, 0xa9,
-  0xb2, 0x26, 0x3e, 0x58, 0xaf, 0x9a, 0x67, 0x16, 0x16, 0x1e, 0xdd, 0xe9,
-  0xae, 0x34, 0xb6, 0xea, 0x54, 0xfb, 0xfb, 0x30, 0x7f, 0xca, 0xfa, 0xbd,
-  0xd6, 0xce, 0x03, 0x67, 0xed, 0x64, 0x3b, 0x9e, 0x3e, 0xd8, 0x46, 0x1a,
-  0x03, 0x72, 0x05, 0x9e, 0x39, 0x21, 0xf1, 0x03, 0x13, 0x29, 0x63, 0x37,
-  0x45, 0xf2, 0x01, 0x69, 0xc9, 0xa7, 0x97, 0x6d, 0xe9, 0x11, 0x15, 0x7c,
-  0x12, 0x0b, 0x2d, 0x75, 0xf8, 0xff, 0x41, 0x33, 0x1e, 0x7d, 0x73, 0xed,
-  0x5f, 0x96, 0xe7, 0xf2, 0x58, 0x49, 0xdf, 0x02, 0x00
-};
-static const unsigned int index_html_gz_len = sizeof(index_html_gz);
-
-  #endif
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Build the embedded web UI tables (web_assets_gz.h) from index.html.
+
+  python3 tools/build_web_assets.py [index.html] [web_assets_gz.h]
+
+The inline <style> and <script> blocks are moved into app.css / app.js. Their
+URLs carry a content hash (/assets/app.<hash>.js), so they can be cached
+forever. The remaining shell references them and is revalidated by ETag.
+Every asset is gzipped deterministically, so an unchanged UI regenerates the
+same header.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def gz(data):
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:8]
+
+
+def extract(html, tag):
+    match = re.search(rf"<{tag}>(.*?)</{tag}>", html, re.S)
+    if not match:
+        sys.exit(f"no inline <{tag}> block found")
+    return match
+
+
+def c_array(name, data):
+    lines = []
+    for i in range(0, len(data), 12):
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in data[i:i + 12]) + ",")
+    return f"static const uint8_t {name}[] PROGMEM = {{\n" + "\n".join(lines) + "\n};\n"
+
+
+def main():
+    source = sys.argv[1] if len(sys.argv) > 1 else os.path.join(ROOT, "index.html")
+    target = sys.argv[2] if len(sys.argv) > 2 else os.path.join(ROOT, "web_assets_gz.h")
+
+    with open(source, encoding="utf-8") as f:
+        html = f.read()
+
+    style = extract(html, "style")
+    css = style.group(1).strip().encode()
+    css_path = f"/assets/app.{content_hash(css)}.css"
+
+    script = extract(html, "script")
+    js = script.group(1).strip().encode()
+    js_path = f"/assets/app.{content_hash(js)}.js"
+
+    shell = (html[:style.start()] + f'<link rel="stylesheet" href="{css_path}">' +
+             html[style.end():script.start()] + f'<script src="{js_path}"></script>' +
+             html[script.end():]).encode()
+
+    assets = [
+        ("index", "/", "text/html; charset=utf-8", shell, False),
+        ("app_css", css_path, "text/css", css, True),
+        ("app_js", js_path, "application/javascript", js, True),
+    ]
+
+    out = [
+        "// Generated by tools/build_web_assets.py from index.html. Do not edit.\n",
+        "#ifndef WEB_ASSETS_GZ_H\n#define WEB_ASSETS_GZ_H\n\n#include <stdint.h>\n#include <stddef.h>\n\n",
+        "struct WebAsset {\n  const char* path;\n  const char* contentType;\n  const uint8_t* data;\n"
+        "  size_t length;\n  const char* etag;\n  bool immutable;\n};\n\n",
+    ]
+
+    table = []
+    for name, path, content_type, data, immutable in assets:
+        compressed = gz(data)
+        out.append(c_array(f"web_asset_{name}_gz", compressed) + "\n")
+        table.append(f'  {{"{path}", "{content_type}", web_asset_{name}_gz, sizeof(web_asset_{name}_gz), '
+                     f'"\\"{content_hash(data)}\\"", {"true" if immutable else "false"}}},')
+        print(f"{path}: {len(data)} -> {len(compressed)} bytes")
+
+    out.append("static const WebAsset WEB_ASSETS[] = {\n" + "\n".join(table) + "\n};\n\n")
+    out.append("static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);\n\n#endif\n")
+
+    with open(target, "w") as f:
+        f.write("".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+"""Pack and unpack configuration bundles served by /backup and accepted by /restore.
+
+  config_bundle.py pack out.cfgz settings.json devices.json [devices.jnl]
+  config_bundle.py unpack in.cfgz [directory]
+  config_bundle.py list in.cfgz
+
+Format (see ConfigBundle.h / Lzss.h): 8-byte header, then an LZSS stream of
+[nameLength:u8][name][size:u32le][data] entries, a zero byte and the CRC32 of
+everything before it.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+VERSION = 1
+WINDOW_BITS = 11
+LENGTH_BITS = 5
+WINDOW_SIZE = 1 << WINDOW_BITS
+MIN_MATCH = 3
+MAX_MATCH = MIN_MATCH + (1 << LENGTH_BITS) - 1
+HEADER = b"CFGZ" + bytes([VERSION, WINDOW_BITS, LENGTH_BITS, 0])
+ALLOWED = ("/settings.json", "/devices.json", "/devices.jnl")
+
+
+def compress(data):
+    out = bytearray()
+    chains = {}
+    pos = 0
+    while pos < len(data):
+        flag_index = len(out)
+        out.append(0)
+        for item in range(8):
+            if pos >= len(data):
+                break
+            best_length, best_distance = 0, 0
+            limit = min(MAX_MATCH, len(data) - pos)
+            if limit >= MIN_MATCH:
+                for candidate in reversed(chains.get(data[pos:pos + MIN_MATCH], [])[-32:]):
+                    distance = pos - candidate
+                    if distance > WINDOW_SIZE:
+                        break
+                    length = 0
+                    while length < limit and data[candidate + length] == data[pos + length]:
+                        length += 1
+                    if length > best_length:
+                        best_length, best_distance = length, distance
+                        if length == limit:
+                            break
+            if best_length >= MIN_MATCH:
+                token = ((best_distance - 1) << LENGTH_BITS) | (best_length - MIN_MATCH)
+                out += struct.pack(">H", token)
+            else:
+                best_length = 1
+                out[flag_index] |= 1 << item
+                out.append(data[pos])
+            for i in range(pos, pos + best_length):
+                if i + MIN_MATCH <= len(data):
+                    chains.setdefault(data[i:i + MIN_MATCH], []).append(i)
+            pos += best_length
+    return bytes(out)
+
+
+def decompress(stream):
+    out = bytearray()
+    pos = 0
+    while pos < len(stream):
+        flags = stream[pos]
+        pos += 1
+        for _ in range(8):
+            if pos >= len(stream):
+                break
+            if flags & 1:
+                out.append(stream[pos])
+                pos += 1
+            else:
+                if pos + 1 >= len(stream):
+                    raise ValueError("truncated match")
+                token = (stream[pos] << 8) | stream[pos + 1]
+                pos += 2
+                distance = (token >> LENGTH_BITS) + 1
+                if distance > len(out):
+                    raise ValueError("match before start of stream")
+                for _ in range((token & ((1 << LENGTH_BITS) - 1)) + MIN_MATCH):
+                    out.append(out[-distance])
+            flags >>= 1
+    return bytes(out)
+
+
+def pack(entries):
+    container = bytearray()
+    for name, data in entries:
+        encoded = name.encode()
+        container += bytes([len(encoded)]) + encoded + struct.pack("<I", len(data)) + data
+    container.append(0)
+    container += struct.pack("<I", zlib.crc32(container))
+    return HEADER + compress(bytes(container))
+
+
+def unpack(bundle):
+    if bundle[:7] != HEADER[:7]:
+        raise ValueError("not a config bundle (or unsupported version)")
+    container = decompress(bundle[len(HEADER):])
+
+    entries = []
+    pos = 0
+    while True:
+        name_length = container[pos]
+        if name_length == 0:
+            break
+        name = container[pos + 1:pos + 1 + name_length].decode()
+        pos += 1 + name_length
+        (size,) = struct.unpack_from("<I", container, pos)
+        pos += 4
+        entries.append((name, container[pos:pos + size]))
+        pos += size
+
+    (expected,) = struct.unpack_from("<I", container, pos + 1)
+    if zlib.crc32(container[:pos + 1]) != expected:
+        raise ValueError("checksum mismatch")
+    if pos + 5 != len(container):
+        raise ValueError("trailing data after checksum")
+    return entries
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    pack_cmd = commands.add_parser("pack", help="build a bundle from config files")
+    pack_cmd.add_argument("bundle")
+    pack_cmd.add_argument("files", nargs="+")
+
+    unpack_cmd = commands.add_parser("unpack", help="extract a bundle")
+    unpack_cmd.add_argument("bundle")
+    unpack_cmd.add_argument("directory", nargs="?", default=".")
+
+    list_cmd = commands.add_parser("list", help="show bundle contents")
+    list_cmd.add_argument("bundle")
+
+    args = parser.parse_args()
+
+    if args.command == "pack":
+        entries = []
+        for path in args.files:
+            name = "/" + os.path.basename(path)
+            if name not in ALLOWED:
+                sys.exit(f"{path}: device only restores {', '.join(ALLOWED)}")
+            with open(path, "rb") as f:
+                entries.append((name, f.read()))
+        bundle = pack(entries)
+        with open(args.bundle, "wb") as f:
+            f.write(bundle)
+        raw = sum(len(data) for _, data in entries)
+        print(f"{args.bundle}: {len(entries)} files, {raw} -> {len(bundle)} bytes")
+        return
+
+    with open(args.bundle, "rb") as f:
+        entries = unpack(f.read())
+
+    for name, data in entries:
+        if args.command == "list":
+            print(f"{len(data):8d}  {name}")
+            continue
+        path = os.path.join(args.directory, name.lstrip("/"))
+        with open(path, "wb") as f:
+            f.write(data)
+        print(f"{path}: {len(data)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,3095 @@
+// Generated by tools/build_web_assets.py from index.html. Do not edit.
+#ifndef WEB_ASSETS_GZ_H
+#define WEB_ASSETS_GZ_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+struct WebAsset {
+  const char* path;
+  const char* contentType;
+  const uint8_t* data;
+  size_t length;
+  const char* etag;
+  bool immutable;
+};
+
+static const uint8_t web_asset_index_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x1c,
+  0x6b, 0x6f, 0xdb, 0xd6, 0xf5, 0xf3, 0xf2, 0x2b, 0xee, 0x54, 0xa0, 0xb6,
+  0xd1, 0x50, 0xb2, 0xec, 0xd8, 0x71, 0x6c, 0x59, 0x83, 0xed, 0x38, 0x80,
+  0x87, 0x36, 0x31, 0x22, 0x07, 0xc5, 0x50, 0x0c, 0x29, 0x45, 0x5e, 0x49,
+  0x8c, 0x29, 0x92, 0x20, 0x29, 0x3f, 0x5a, 0x14, 0x70, 0x93, 0x76, 0x1d,
+  0xe0, 0xa2, 0x01, 0x8a, 0x6c, 0x2d, 0xb6, 0x2e, 0x6b, 0xb7, 0x1f, 0x30,
+  0xd7, 0x8e, 0x57, 0x37, 0x0f, 0x07, 0xd8, 0x2f, 0xa0, 0xfe, 0x42, 0x7f,
+  0xc9, 0xce, 0xb9, 0x97, 0x97, 0x6f, 0xea, 0x91, 0x46, 0x8a, 0x0b, 0xa4,
+  0x91, 0xc8, 0x7b, 0xce, 0x3d, 0xef, 0xd7, 0xbd, 0x4a, 0xe5, 0xb7, 0xd7,
+  0x6f, 0xad, 0x6d, 0xfd, 0x61, 0x73, 0x9d, 0xb4, 0xdc, 0xb6, 0x5e, 0xbd,
+  0x54, 0x11, 0x7f, 0x51, 0x59, 0xad, 0x5e, 0x22, 0xa4, 0xd2, 0xa6, 0xae,
+  0x4c, 0x94, 0x96, 0x6c, 0x3b, 0xd4, 0x5d, 0x2e, 0xdc, 0xd9, 0xba, 0x21,
+  0x2d, 0x14, 0xc2, 0x17, 0x86, 0xdc, 0xa6, 0xcb, 0x85, 0x1d, 0x8d, 0xee,
+  0x5a, 0xa6, 0xed, 0x16, 0x88, 0x62, 0x1a, 0x2e, 0x35, 0x60, 0xe1, 0xae,
+  0xa6, 0xba, 0xad, 0x65, 0x95, 0xee, 0x68, 0x0a, 0x95, 0xd8, 0x97, 0xcb,
+  0x44, 0x33, 0x34, 0x57, 0x93, 0x75, 0xc9, 0x51, 0x64, 0x9d, 0x2e, 0x97,
+  0x8b, 0xd3, 0x1c, 0x91, 0xab, 0xb9, 0x3a, 0xad, 0xd6, 0xda, 0xb2, 0xed,
+  0x92, 0xeb, 0x0c, 0xa0, 0x52, 0xe2, 0xcf, 0xf0, 0xad, 0xae, 0x19, 0xdb,
+  0xc4, 0xa6, 0xfa, 0x72, 0xc1, 0x71, 0xf7, 0x75, 0xea, 0xb4, 0x28, 0x85,
+  0x7d, 0x5a, 0x36, 0x6d, 0x2c, 0x17, 0x4a, 0xb2, 0x03, 0x54, 0x39, 0x25,
+  0xd9, 0xb2, 0x8a, 0xf3, 0xf3, 0x73, 0xe5, 0xe9, 0xf2, 0xec, 0x7c, 0x51,
+  0x71, 0x1c, 0xc0, 0x7b, 0xa9, 0x52, 0xe2, 0x2c, 0x54, 0xea, 0xa6, 0xba,
+  0xcf, 0x30, 0xb5, 0xca, 0xd5, 0xf5, 0xda, 0xe6, 0xec, 0x0c, 0x79, 0x5f,
+  0xbb, 0xa1, 0x91, 0xb7, 0xc9, 0x16, 0xd5, 0x69, 0xd3, 0x96, 0xdb, 0xe4,
+  0x3d, 0xd9, 0x90, 0x9b, 0xd4, 0x06, 0x88, 0x32, 0x00, 0xc2, 0x4a, 0x55,
+  0xdb, 0x21, 0x8a, 0x0e, 0xc8, 0x97, 0x0b, 0xae, 0x5c, 0x77, 0x18, 0x99,
+  0xa9, 0xc7, 0x44, 0x56, 0x5c, 0x6d, 0x87, 0x16, 0x88, 0x69, 0x28, 0xba,
+  0xa6, 0x6c, 0x2f, 0x17, 0x4c, 0x8b, 0x1a, 0x5b, 0x72, 0x7d, 0x72, 0x62,
+  0x57, 0x6b, 0x68, 0x12, 0x2c, 0x99, 0x98, 0x2a, 0x54, 0x71, 0xb3, 0x4a,
+  0x09, 0x40, 0x33, 0x91, 0x64, 0x41, 0xbb, 0x3e, 0x5d, 0x02, 0x83, 0xa0,
+  0x73, 0x38, 0x2c, 0xbe, 0xe8, 0x41, 0x3e, 0xae, 0x66, 0x34, 0x1d, 0x81,
+  0xac, 0xe6, 0x7f, 0x1f, 0x0e, 0x19, 0xaa, 0xd5, 0x36, 0x75, 0x81, 0x64,
+  0x8d, 0x7f, 0x0d, 0x70, 0xf8, 0x1f, 0x84, 0xe8, 0x34, 0x15, 0x95, 0x25,
+  0xbb, 0x1d, 0x67, 0x55, 0xd6, 0x75, 0xd3, 0x34, 0x0a, 0x02, 0x3d, 0x7f,
+  0x2a, 0xd5, 0xc5, 0x63, 0xa6, 0xd2, 0xe5, 0x82, 0xaa, 0x39, 0x96, 0x2e,
+  0xef, 0x2f, 0x12, 0xc3, 0x34, 0x68, 0xa1, 0x1a, 0xa2, 0x8b, 0x13, 0xa7,
+  0x98, 0xba, 0x2e, 0x5b, 0x8e, 0x56, 0xd7, 0xa9, 0x84, 0x14, 0xc9, 0x9a,
+  0x41, 0xed, 0x0c, 0xe5, 0xe8, 0x72, 0x9d, 0xea, 0x60, 0x74, 0x6e, 0x4b,
+  0x72, 0xcd, 0x66, 0x53, 0xa7, 0xfe, 0x9a, 0xcc, 0x65, 0xb2, 0xa1, 0x4a,
+  0x68, 0x63, 0xc1, 0x9a, 0x0a, 0x7b, 0x4e, 0x1a, 0xa6, 0xbd, 0x5c, 0x68,
+  0x5f, 0xbf, 0x59, 0x2b, 0x54, 0xbd, 0x47, 0xde, 0x79, 0xf7, 0xd3, 0xee,
+  0xfd, 0xee, 0x03, 0xef, 0x25, 0xf1, 0xce, 0xbc, 0x9f, 0x48, 0xf7, 0x53,
+  0xef, 0xb4, 0x7b, 0xdf, 0x3b, 0x5b, 0x04, 0xd6, 0xd9, 0x72, 0x9f, 0x5a,
+  0x80, 0x96, 0x7d, 0xdb, 0x7c, 0xab, 0xc0, 0xe4, 0xd0, 0x56, 0x0d, 0x87,
+  0xe3, 0x27, 0xae, 0x6c, 0x37, 0xd1, 0x87, 0xee, 0xd6, 0x75, 0x19, 0xf7,
+  0xab, 0x94, 0x64, 0x9f, 0xf6, 0x50, 0x17, 0xec, 0xab, 0x63, 0xc9, 0x46,
+  0xa0, 0x10, 0xc6, 0x80, 0xa4, 0x29, 0x28, 0xae, 0x40, 0x31, 0xfc, 0xe9,
+  0x7b, 0x80, 0x7b, 0xc3, 0xb0, 0x3a, 0xee, 0x24, 0xe8, 0xe4, 0x97, 0xef,
+  0xbe, 0xaa, 0x94, 0x10, 0x32, 0x85, 0xb3, 0xa2, 0xe1, 0x1a, 0xe2, 0xee,
+  0x5b, 0x20, 0x6a, 0x97, 0xee, 0xb9, 0x3e, 0x65, 0xc8, 0x1b, 0x01, 0xb9,
+  0x2b, 0xb4, 0x65, 0xea, 0x2a, 0x05, 0x76, 0xe1, 0x09, 0xb9, 0x09, 0x1e,
+  0x1d, 0xe8, 0xab, 0xa5, 0xa9, 0x2a, 0x35, 0x40, 0x34, 0x42, 0x25, 0x81,
+  0x7e, 0x85, 0x89, 0x17, 0x22, 0x96, 0x23, 0xf9, 0xde, 0x2f, 0x3c, 0x03,
+  0xd7, 0xb7, 0x66, 0x03, 0xdd, 0x53, 0x78, 0x6a, 0x1a, 0x12, 0xba, 0x65,
+  0xa8, 0x36, 0xc6, 0x6b, 0x80, 0xb0, 0x6d, 0xaa, 0x54, 0x62, 0xbe, 0xcf,
+  0x1d, 0x87, 0xbc, 0x07, 0x0f, 0x62, 0x6c, 0x71, 0xe5, 0x08, 0x94, 0xa0,
+  0x63, 0xa5, 0x45, 0x64, 0x8b, 0x03, 0x3a, 0xba, 0x16, 0x62, 0x4e, 0x71,
+  0xae, 0xb4, 0xa8, 0xb2, 0x5d, 0x37, 0xf7, 0x38, 0xf7, 0x9a, 0x23, 0xc9,
+  0x16, 0x93, 0x68, 0x4b, 0x36, 0x9a, 0x54, 0x88, 0x74, 0x65, 0x13, 0x77,
+  0x44, 0x79, 0x66, 0xab, 0x43, 0x6c, 0x11, 0x17, 0xb5, 0x6f, 0x02, 0x10,
+  0x40, 0x66, 0xa3, 0x66, 0x8b, 0xfb, 0x00, 0x6d, 0x0d, 0x8d, 0xea, 0xaa,
+  0x13, 0x08, 0x2a, 0x78, 0x42, 0x02, 0xe9, 0x92, 0x0c, 0xeb, 0x04, 0xfb,
+  0x6b, 0x4b, 0x4d, 0xdb, 0xec, 0x58, 0x91, 0x05, 0x49, 0xfb, 0x04, 0x5c,
+  0x8e, 0xa3, 0xa9, 0x85, 0xea, 0xca, 0x26, 0xa9, 0xd5, 0x36, 0xae, 0x07,
+  0xa4, 0xc4, 0x00, 0xb2, 0xf5, 0x2f, 0x60, 0xe3, 0x26, 0x00, 0x11, 0x52,
+  0x5a, 0xd9, 0x8c, 0xd2, 0x14, 0x71, 0xc6, 0x57, 0xa5, 0xd1, 0x82, 0xd5,
+  0xbb, 0xa6, 0xcd, 0xe9, 0xdc, 0xf4, 0xbf, 0x0c, 0x49, 0x6b, 0x80, 0x23,
+  0x4e, 0xef, 0xbb, 0x54, 0xde, 0xa1, 0x84, 0xb6, 0x2d, 0x77, 0x1f, 0xb7,
+  0x23, 0x18, 0xb2, 0x88, 0x41, 0x5d, 0x58, 0xba, 0xfd, 0x9a, 0xb9, 0xd0,
+  0x2c, 0x2e, 0x67, 0x88, 0x61, 0x9a, 0x42, 0x36, 0x36, 0x87, 0x64, 0x00,
+  0xc0, 0xe3, 0xa4, 0x97, 0xaf, 0xcd, 0x14, 0xcb, 0xf3, 0x0b, 0xc5, 0x2b,
+  0xc5, 0x72, 0x9a, 0xd2, 0x24, 0xd1, 0xd1, 0xc0, 0xda, 0xd7, 0xa2, 0x48,
+  0xb6, 0x49, 0x09, 0x0f, 0xf0, 0x99, 0x25, 0x99, 0xe1, 0x77, 0xa9, 0x07,
+  0x3f, 0x71, 0x17, 0x92, 0x3b, 0xae, 0x29, 0xd9, 0x14, 0x9c, 0xde, 0x00,
+  0xd7, 0x06, 0x6a, 0xf0, 0x2d, 0x85, 0x17, 0x0d, 0x59, 0x77, 0x68, 0x2f,
+  0x59, 0xc6, 0x01, 0xab, 0x2b, 0xf0, 0x9d, 0xdc, 0x16, 0xdf, 0x53, 0x62,
+  0xcd, 0x93, 0x48, 0xbd, 0xe3, 0xba, 0xa6, 0x11, 0x06, 0x45, 0x07, 0x2c,
+  0x01, 0x83, 0x86, 0x48, 0x71, 0x93, 0x74, 0x07, 0x82, 0xd1, 0x54, 0x90,
+  0x65, 0xa0, 0xc0, 0x68, 0x6a, 0x06, 0xa4, 0x04, 0x6b, 0x91, 0x94, 0xe7,
+  0xac, 0xbd, 0x25, 0x88, 0xec, 0x3f, 0x40, 0x64, 0xff, 0xbc, 0x7b, 0xe0,
+  0x1d, 0x79, 0x2f, 0xbc, 0x33, 0x88, 0xf0, 0x5f, 0x12, 0xf8, 0x70, 0xc4,
+  0x82, 0xfd, 0x81, 0x77, 0xee, 0xfd, 0xec, 0x3d, 0xf5, 0xce, 0x08, 0x4f,
+  0xe1, 0x7c, 0xbb, 0x6a, 0x6c, 0x6f, 0x2e, 0x16, 0xfe, 0x85, 0x0b, 0xc5,
+  0xa6, 0x75, 0xd3, 0x74, 0x57, 0xd9, 0x93, 0xbb, 0x33, 0x20, 0xe3, 0x30,
+  0xfa, 0x99, 0x86, 0x2a, 0xdb, 0xfb, 0x91, 0x28, 0xee, 0x98, 0x20, 0x2f,
+  0xb7, 0xe8, 0x50, 0x43, 0x9d, 0xfc, 0x7d, 0xed, 0xd6, 0xcd, 0xa2, 0xe3,
+  0xda, 0x40, 0xb8, 0xd6, 0xd8, 0x9f, 0xfc, 0x98, 0x30, 0xe2, 0x17, 0xc9,
+  0x04, 0x47, 0x38, 0x41, 0x3e, 0x99, 0x9a, 0x5a, 0x02, 0x4e, 0xa0, 0x48,
+  0xaa, 0x51, 0x7b, 0x87, 0xda, 0x6b, 0x28, 0xed, 0xc9, 0x29, 0x02, 0x4c,
+  0xfc, 0x13, 0x92, 0xd1, 0x81, 0x77, 0xea, 0xfd, 0x04, 0x6c, 0x9c, 0x74,
+  0x0f, 0x20, 0x4d, 0xfd, 0xc4, 0x99, 0x09, 0x89, 0xe6, 0x54, 0xb7, 0x66,
+  0xe2, 0x1c, 0x9f, 0xc2, 0x9f, 0x17, 0xdd, 0x43, 0xef, 0x34, 0x48, 0x68,
+  0x10, 0xc2, 0x66, 0xaa, 0x71, 0x83, 0x63, 0x81, 0x99, 0x27, 0xee, 0x44,
+  0x1e, 0x4f, 0x64, 0xea, 0x8e, 0xce, 0x0d, 0x14, 0xd4, 0xa0, 0x4a, 0xbe,
+  0x0b, 0x86, 0x20, 0xfe, 0x03, 0xc8, 0x85, 0x8e, 0x5b, 0x10, 0x20, 0xa5,
+  0x8e, 0x9e, 0x91, 0xe7, 0xa1, 0x3e, 0x34, 0x24, 0x99, 0x65, 0x0b, 0x27,
+  0xea, 0x19, 0x29, 0x85, 0x33, 0x69, 0xc0, 0x62, 0x8c, 0xd7, 0xc0, 0xd8,
+  0x53, 0x5f, 0x8d, 0xa8, 0xb9, 0x63, 0xd0, 0x62, 0x4c, 0x02, 0xb9, 0x58,
+  0x64, 0x55, 0xbd, 0x49, 0x77, 0x6f, 0x72, 0xf2, 0x00, 0x53, 0x5a, 0x63,
+  0xd5, 0x77, 0x08, 0x96, 0x00, 0xde, 0x8f, 0x80, 0xff, 0xd8, 0x37, 0x13,
+  0x2e, 0xb0, 0xe4, 0x06, 0xd9, 0x1e, 0x8b, 0xec, 0x64, 0x0a, 0x10, 0x2a,
+  0xe2, 0x86, 0x99, 0x90, 0x62, 0x6b, 0x86, 0x3b, 0xd7, 0x8e, 0xac, 0x81,
+  0x1f, 0x40, 0xea, 0x17, 0x92, 0x14, 0x89, 0x33, 0xdb, 0x6b, 0xe3, 0x55,
+  0x4a, 0xbe, 0x56, 0x7d, 0x25, 0xa5, 0xd1, 0xe7, 0x28, 0x8a, 0xab, 0x28,
+  0x95, 0xfe, 0xa3, 0x35, 0x6a, 0x56, 0x09, 0xc0, 0x2b, 0xfb, 0xa8, 0x4e,
+  0x33, 0xb3, 0x3f, 0x90, 0x15, 0x54, 0xe1, 0x75, 0xd3, 0x8d, 0xd0, 0x99,
+  0x91, 0xe7, 0xc3, 0x0a, 0x2d, 0x3f, 0x26, 0x05, 0x74, 0x51, 0x03, 0xb9,
+  0x53, 0x43, 0x98, 0x81, 0xb3, 0x78, 0xac, 0x9c, 0xc5, 0xdc, 0x10, 0x47,
+  0x8c, 0x4f, 0x44, 0x80, 0xed, 0x93, 0x45, 0xa2, 0x31, 0x0f, 0xb8, 0x93,
+  0x30, 0x51, 0xaf, 0x9a, 0x2e, 0xd9, 0x32, 0xb7, 0xa9, 0x91, 0x08, 0x73,
+  0x39, 0x79, 0xc3, 0x07, 0x4b, 0x24, 0x8e, 0x99, 0xd9, 0x2b, 0x73, 0xf3,
+  0x57, 0x17, 0xae, 0x2d, 0xae, 0xac, 0xae, 0x49, 0xd7, 0xd7, 0x6f, 0xe0,
+  0x83, 0x66, 0x6b, 0x63, 0x5b, 0x97, 0x3e, 0xda, 0xdf, 0x9b, 0xbb, 0xfa,
+  0xfe, 0xcc, 0x4e, 0xb9, 0x03, 0xcf, 0xe8, 0x6e, 0x59, 0x64, 0x96, 0x98,
+  0x02, 0xb3, 0x29, 0xe6, 0xd4, 0x56, 0xbd, 0x7f, 0x83, 0x8d, 0x9f, 0x7a,
+  0x4f, 0xc0, 0xde, 0x9f, 0x7b, 0xcf, 0x58, 0x88, 0x38, 0xeb, 0x3e, 0x8c,
+  0x4a, 0xa7, 0x47, 0x46, 0x49, 0x9a, 0x66, 0x43, 0xa7, 0x7b, 0x4b, 0xec,
+  0xff, 0x92, 0xaa, 0xd9, 0xdc, 0x04, 0x16, 0xa1, 0x49, 0xd4, 0x3b, 0x6d,
+  0x63, 0x89, 0xc8, 0xba, 0xd6, 0x34, 0x24, 0xcd, 0xa5, 0x6d, 0x87, 0x2f,
+  0x95, 0x98, 0x47, 0x2f, 0x15, 0x22, 0x1e, 0x34, 0x8c, 0xce, 0xad, 0x8e,
+  0xd3, 0x92, 0xa6, 0x0b, 0x7e, 0x53, 0x1a, 0x7b, 0x9c, 0xa9, 0x93, 0x24,
+  0x60, 0xd5, 0x7b, 0xdc, 0xfd, 0x33, 0xd4, 0xf7, 0x3f, 0xb2, 0xa8, 0xff,
+  0xc1, 0xfa, 0xed, 0xdb, 0xb7, 0x6e, 0xff, 0x31, 0xa6, 0xa7, 0xa4, 0x7f,
+  0x0f, 0x4d, 0x5d, 0xf9, 0x55, 0xa9, 0x03, 0x45, 0x7a, 0xdf, 0x82, 0x5b,
+  0x7f, 0x06, 0x4e, 0x7e, 0x00, 0x9a, 0x39, 0xea, 0xfe, 0x09, 0x28, 0x3d,
+  0x0f, 0x02, 0xf8, 0x07, 0x1b, 0x37, 0x6f, 0xdc, 0x7a, 0xcd, 0xc4, 0xce,
+  0xbc, 0x2a, 0xb1, 0x33, 0x2c, 0x29, 0x9d, 0x7b, 0xcf, 0xba, 0x5f, 0x42,
+  0x2a, 0xf2, 0x83, 0x31, 0x98, 0x12, 0x7c, 0x87, 0x90, 0x04, 0xc2, 0x45,
+  0x82, 0xef, 0xd4, 0xd6, 0xb3, 0xa5, 0x1b, 0x7c, 0x88, 0xc7, 0xc5, 0x59,
+  0x46, 0x61, 0xc7, 0xa1, 0x76, 0x9f, 0x50, 0x48, 0xfc, 0x44, 0x0f, 0xbe,
+  0xe3, 0x9a, 0xed, 0x30, 0xd7, 0x67, 0x52, 0xc4, 0x82, 0xe3, 0x6c, 0x46,
+  0x12, 0xc2, 0x8d, 0x98, 0xb3, 0xa7, 0x5a, 0xcd, 0x5c, 0xbf, 0x4f, 0x14,
+  0x1a, 0x62, 0xff, 0x69, 0xee, 0x01, 0x40, 0x08, 0x92, 0xb6, 0xc7, 0xa7,
+  0x21, 0x8b, 0x64, 0x76, 0x7a, 0x9a, 0xd1, 0x75, 0x29, 0xab, 0x44, 0x32,
+  0xe8, 0xae, 0xc4, 0x28, 0xc0, 0x98, 0x71, 0x07, 0x3e, 0x90, 0x8c, 0xe2,
+  0x3e, 0x27, 0x66, 0x44, 0x61, 0x13, 0xc5, 0x3d, 0xc4, 0x66, 0x9b, 0x74,
+  0x38, 0xba, 0x90, 0x9b, 0x68, 0xfb, 0x99, 0x5d, 0xd9, 0x44, 0x93, 0x25,
+  0x52, 0x93, 0x99, 0x26, 0xb3, 0xea, 0xac, 0x99, 0x2b, 0x8c, 0xc7, 0x15,
+  0x55, 0x25, 0x08, 0xd7, 0x23, 0x5b, 0xfa, 0x89, 0x29, 0x30, 0x24, 0xa6,
+  0xe8, 0x30, 0xb5, 0xc4, 0x1f, 0xf7, 0xae, 0x1f, 0x98, 0x4a, 0x92, 0xf5,
+  0x43, 0x1f, 0xc6, 0xb0, 0x6a, 0x11, 0xa9, 0x28, 0x59, 0x40, 0x56, 0x6b,
+  0xd8, 0x63, 0x84, 0x93, 0x93, 0x0c, 0x1e, 0xf0, 0x03, 0x6e, 0x1b, 0x35,
+  0xda, 0x20, 0x59, 0x66, 0x8c, 0x62, 0x72, 0x73, 0x26, 0x4f, 0x8a, 0x7c,
+  0x0c, 0x16, 0xd9, 0x12, 0xf3, 0x62, 0x2c, 0x78, 0x8b, 0x2c, 0x8d, 0xd1,
+  0x33, 0x95, 0x6c, 0xc5, 0x4b, 0xe1, 0x26, 0x89, 0xb9, 0x01, 0xc7, 0x5e,
+  0xe3, 0xe1, 0x78, 0x72, 0xc2, 0xec, 0xb8, 0x60, 0x46, 0x8e, 0xe4, 0xa7,
+  0xe8, 0x89, 0xa9, 0x8c, 0x91, 0x8a, 0xc0, 0xd8, 0x06, 0x47, 0x90, 0x78,
+  0xd5, 0x92, 0xe1, 0x0b, 0x62, 0x95, 0xdf, 0xc1, 0x47, 0x5a, 0x68, 0xd7,
+  0x36, 0x8d, 0x66, 0xd5, 0xfb, 0xba, 0x7b, 0xd8, 0xfd, 0x1c, 0xdc, 0xef,
+  0x49, 0xf7, 0x90, 0xbc, 0x4d, 0xe0, 0xab, 0xff, 0x05, 0x12, 0x31, 0x5f,
+  0x71, 0x29, 0xaf, 0xe4, 0x4f, 0xe5, 0x70, 0xb1, 0x97, 0x6c, 0xdb, 0xe6,
+  0x6e, 0xa1, 0xfa, 0xcb, 0x5f, 0x9f, 0x87, 0xd9, 0x3c, 0x54, 0x8a, 0x50,
+  0x41, 0x82, 0xc7, 0x54, 0xb1, 0xa3, 0x52, 0x70, 0x71, 0xdd, 0xc9, 0x2d,
+  0xae, 0x12, 0x25, 0x9d, 0x4d, 0xe1, 0xa5, 0xf3, 0x2e, 0x54, 0x48, 0x6b,
+  0x61, 0x70, 0xc8, 0x1b, 0x5b, 0xc5, 0xcc, 0xb1, 0x47, 0x33, 0x32, 0xb0,
+  0x07, 0x42, 0xb9, 0x7a, 0x1b, 0x09, 0x18, 0xb4, 0x58, 0x4d, 0x16, 0xc1,
+  0x03, 0xb8, 0xc2, 0x8a, 0xae, 0xb3, 0x2d, 0x02, 0x57, 0x08, 0xb7, 0xb2,
+  0x6c, 0xad, 0xcd, 0x36, 0x4a, 0x37, 0x4f, 0x43, 0x6e, 0x04, 0x75, 0xb1,
+  0x42, 0xf5, 0x1e, 0x5b, 0x45, 0xb8, 0x82, 0xd4, 0x7c, 0x1f, 0xd2, 0xde,
+  0x69, 0xf6, 0x56, 0x11, 0xa7, 0x8b, 0xa7, 0x8e, 0x11, 0xb9, 0x0c, 0xb4,
+  0x6c, 0x8e, 0x69, 0x8f, 0xc5, 0x65, 0x7e, 0x40, 0x9e, 0x21, 0x6b, 0x42,
+  0xda, 0x1f, 0x83, 0x9f, 0x24, 0x18, 0xfb, 0xb5, 0x7e, 0xe2, 0xa3, 0x7b,
+  0x83, 0x8e, 0x52, 0x63, 0x14, 0x04, 0xa3, 0x80, 0xd1, 0xb9, 0x0b, 0xdf,
+  0x28, 0x35, 0x7b, 0x18, 0x9d, 0xd3, 0xf4, 0xde, 0xf0, 0xc2, 0xba, 0x8e,
+  0xa5, 0xa9, 0x63, 0xf1, 0x9b, 0x7f, 0xa4, 0xc6, 0x38, 0x50, 0x00, 0x7e,
+  0xeb, 0x3d, 0x92, 0xd8, 0xa8, 0xe4, 0x04, 0xba, 0xe4, 0x67, 0xdd, 0x87,
+  0x20, 0x98, 0x73, 0x3e, 0x2e, 0x18, 0xb9, 0x67, 0x45, 0xf9, 0x1e, 0xde,
+  0xad, 0xf2, 0xd8, 0xf7, 0xe5, 0x93, 0x57, 0x97, 0xe6, 0x0f, 0x51, 0xf2,
+  0x9d, 0x66, 0x53, 0x53, 0x07, 0x9e, 0x82, 0x24, 0x87, 0x65, 0xdd, 0x07,
+  0xbe, 0x94, 0x53, 0x46, 0x1d, 0x9b, 0xbf, 0xc6, 0x84, 0x12, 0x06, 0x86,
+  0xbc, 0x09, 0x44, 0x24, 0x5a, 0xf4, 0xea, 0x10, 0x7a, 0xd9, 0x6b, 0xde,
+  0x82, 0xc1, 0x6c, 0x56, 0x95, 0x5d, 0xea, 0x6a, 0x6d, 0x9a, 0xb2, 0xdb,
+  0xc1, 0x6d, 0x77, 0x50, 0xfb, 0x8d, 0xd9, 0xf0, 0x23, 0xd6, 0xa5, 0x1c,
+  0x61, 0xa9, 0x74, 0xcc, 0xcc, 0xf6, 0x79, 0xf7, 0x21, 0x49, 0x5a, 0x2a,
+  0x21, 0xbf, 0xc9, 0x34, 0x4b, 0x31, 0x71, 0x42, 0x39, 0x2b, 0x1d, 0xdb,
+  0x86, 0xf0, 0x70, 0x1d, 0xf8, 0xd8, 0x02, 0x3e, 0xe2, 0x93, 0x8f, 0x8c,
+  0x2e, 0xa0, 0xf7, 0x99, 0x54, 0x2f, 0xc3, 0x4f, 0x37, 0x14, 0x41, 0x15,
+  0x9c, 0x10, 0xe2, 0xab, 0x39, 0x41, 0x1f, 0x47, 0x88, 0x89, 0x31, 0xba,
+  0x33, 0xb2, 0x2d, 0x62, 0x65, 0x7a, 0x87, 0xba, 0x6e, 0x2a, 0xdb, 0x41,
+  0xe3, 0xc8, 0x73, 0x4d, 0xa2, 0x3b, 0x4b, 0x35, 0x5c, 0x88, 0xb5, 0x10,
+  0xe0, 0x67, 0xe7, 0x70, 0xbd, 0x96, 0x23, 0xeb, 0x7e, 0x93, 0x0d, 0x9f,
+  0xf8, 0x72, 0xa0, 0x83, 0x5a, 0xcb, 0x85, 0x72, 0x40, 0x90, 0xdf, 0x1a,
+  0xb2, 0x36, 0xd1, 0xef, 0x0a, 0x58, 0x52, 0xad, 0x38, 0xd0, 0x9a, 0x28,
+  0x6e, 0x00, 0xfe, 0x11, 0x9e, 0x93, 0x8a, 0xe6, 0x3c, 0xf8, 0x1e, 0x47,
+  0x92, 0xc0, 0xc1, 0x08, 0x32, 0x2d, 0x94, 0x3c, 0xd9, 0x91, 0xf5, 0x0e,
+  0x2c, 0x9c, 0x05, 0x10, 0x86, 0x97, 0xaa, 0xd5, 0x3b, 0x5b, 0x6b, 0xef,
+  0xcc, 0x92, 0x49, 0xef, 0x3b, 0x1c, 0x22, 0x42, 0xb8, 0x84, 0x06, 0x79,
+  0xaa, 0x52, 0xe2, 0xeb, 0x33, 0x81, 0xa1, 0xc7, 0x47, 0x98, 0x19, 0x80,
+  0xf9, 0x1b, 0x44, 0x04, 0x68, 0xa4, 0x31, 0xbf, 0xc0, 0x9f, 0x13, 0x96,
+  0xdc, 0x9e, 0xf4, 0x86, 0xbe, 0xc2, 0xa1, 0xaf, 0x00, 0xf4, 0x0f, 0xb0,
+  0x1a, 0xe7, 0x19, 0x07, 0xfd, 0x76, 0x9c, 0xe3, 0x30, 0x73, 0x00, 0xf3,
+  0x17, 0x9c, 0xf5, 0x62, 0x03, 0x0f, 0x50, 0xb8, 0xe7, 0x8f, 0xdd, 0x07,
+  0xf0, 0xe9, 0xa4, 0x37, 0xfc, 0x3c, 0x87, 0x9f, 0x07, 0xf8, 0xc7, 0xe0,
+  0x49, 0xc0, 0x65, 0xef, 0xf5, 0x57, 0xf9, 0xfa, 0xab, 0xc8, 0x21, 0x52,
+  0x07, 0x10, 0x2f, 0x40, 0x3a, 0x0f, 0xa1, 0x10, 0xeb, 0x0b, 0xbb, 0xc0,
+  0x61, 0x17, 0x00, 0xf6, 0x5b, 0x80, 0x85, 0xc0, 0x08, 0x41, 0xb2, 0x2f,
+  0xd4, 0x35, 0x0e, 0x75, 0x0d, 0xa0, 0xfe, 0x33, 0x28, 0x4c, 0x79, 0x9a,
+  0x03, 0x95, 0xa7, 0x01, 0xea, 0x6b, 0xd0, 0x03, 0xc8, 0x1e, 0x64, 0x72,
+  0xcc, 0x87, 0xc1, 0x10, 0x96, 0xfb, 0xc1, 0x97, 0x7d, 0xf8, 0x32, 0xd3,
+  0xfe, 0x91, 0x77, 0xc2, 0x30, 0x40, 0x79, 0xd2, 0x07, 0xce, 0x37, 0x80,
+  0xb2, 0xb0, 0x80, 0xe7, 0xdd, 0x2f, 0x98, 0x4e, 0x9e, 0xc6, 0xf4, 0x08,
+  0x91, 0x81, 0x99, 0x58, 0xc2, 0x33, 0x72, 0xcf, 0x4f, 0x64, 0xcb, 0xd2,
+  0xf7, 0x45, 0x9c, 0x5a, 0xcd, 0xaa, 0xb5, 0xc4, 0xcb, 0x49, 0xbf, 0x31,
+  0x4f, 0x8f, 0xf8, 0x7b, 0x07, 0xb3, 0x8c, 0xe3, 0xa4, 0x11, 0x95, 0x3a,
+  0x1d, 0x4b, 0x37, 0x65, 0x75, 0x1c, 0xc5, 0xce, 0x37, 0x91, 0x93, 0x1f,
+  0x90, 0x7f, 0x09, 0xd2, 0xc5, 0x61, 0xfc, 0xc1, 0xcb, 0x8c, 0x33, 0x22,
+  0x78, 0x31, 0xf2, 0xb2, 0x27, 0x2e, 0x83, 0xd7, 0x5e, 0xf8, 0xf4, 0xb1,
+  0xa6, 0x8e, 0x85, 0xb1, 0x39, 0x65, 0x46, 0xaa, 0xa9, 0x74, 0xda, 0x10,
+  0x17, 0x8b, 0x4d, 0xea, 0xae, 0xeb, 0x14, 0x3f, 0xae, 0xee, 0x6f, 0xa8,
+  0x93, 0x13, 0x0d, 0x4d, 0xe7, 0xa1, 0x79, 0x62, 0xaa, 0xc8, 0xd6, 0xa2,
+  0x91, 0x91, 0xb5, 0x96, 0x69, 0x3a, 0x94, 0xe0, 0xcb, 0x84, 0xb1, 0xe5,
+  0xef, 0x8c, 0x96, 0x9a, 0xb1, 0xef, 0xae, 0x81, 0xe2, 0xb8, 0x01, 0x98,
+  0x26, 0x3f, 0xe4, 0x63, 0x21, 0xa7, 0x78, 0xcf, 0x31, 0x8d, 0xcb, 0x44,
+  0x4c, 0x87, 0xfc, 0xaf, 0xba, 0xd9, 0x2c, 0xba, 0x7b, 0xee, 0x87, 0x62,
+  0xfa, 0x84, 0x9b, 0x3b, 0x03, 0xef, 0x5e, 0x97, 0x95, 0xed, 0x8e, 0x95,
+  0xda, 0x7f, 0x57, 0x33, 0x80, 0x84, 0x22, 0x24, 0x3b, 0x19, 0xb5, 0x51,
+  0xc4, 0x9b, 0x2a, 0x64, 0x99, 0x4c, 0x94, 0xf8, 0xfa, 0x89, 0x42, 0x75,
+  0x95, 0x7d, 0x18, 0x78, 0x9f, 0xe8, 0x69, 0xe7, 0xeb, 0x3f, 0xd8, 0xbc,
+  0xcd, 0x56, 0x64, 0xfa, 0x77, 0x2e, 0x45, 0x8d, 0x0e, 0x8e, 0x13, 0x40,
+  0x98, 0x29, 0xa2, 0xb4, 0x06, 0x99, 0x84, 0x7c, 0xd8, 0xd0, 0xec, 0xf6,
+  0xe4, 0x44, 0x46, 0x7b, 0x00, 0xe1, 0x36, 0x78, 0x00, 0x61, 0xf7, 0x18,
+  0x42, 0x19, 0x24, 0x41, 0x82, 0xb9, 0xc5, 0x7b, 0x82, 0xb1, 0x98, 0xe0,
+  0x07, 0x96, 0xea, 0xb0, 0x23, 0x3f, 0xbc, 0x4c, 0xbc, 0x97, 0x6c, 0x35,
+  0x1e, 0x95, 0x3c, 0xf3, 0xfe, 0xcb, 0x4b, 0xe2, 0xdf, 0x4d, 0x4c, 0x4d,
+  0x91, 0x8f, 0x07, 0x14, 0x00, 0x90, 0x79, 0x97, 0x5b, 0x41, 0xbe, 0x18,
+  0x3e, 0x41, 0x39, 0xc0, 0x42, 0xa2, 0xfa, 0x57, 0xe3, 0x06, 0x54, 0xcd,
+  0xa0, 0x82, 0xf8, 0x1a, 0x0f, 0x09, 0xb3, 0x4e, 0xbd, 0x47, 0xc7, 0x38,
+  0x92, 0x76, 0x97, 0x71, 0xdf, 0x93, 0xed, 0x1b, 0xb0, 0x8c, 0xb0, 0x65,
+  0xa9, 0x6e, 0x22, 0x5a, 0x58, 0xa1, 0x67, 0xf8, 0x2c, 0x0b, 0xef, 0xcd,
+  0xb9, 0x58, 0x16, 0xb9, 0xed, 0xc3, 0xc3, 0x12, 0xf3, 0x43, 0xe8, 0x75,
+  0x4a, 0xf1, 0x53, 0x42, 0x81, 0x8b, 0x5f, 0x85, 0x8a, 0xcf, 0x21, 0x74,
+  0xda, 0x70, 0x83, 0xe2, 0x50, 0x04, 0xbe, 0x68, 0xc8, 0xce, 0x1f, 0x5b,
+  0x88, 0x68, 0x1d, 0x6e, 0xc2, 0xa9, 0xa8, 0x05, 0x87, 0xe9, 0x0c, 0x5b,
+  0x10, 0x92, 0xb3, 0x62, 0xf1, 0x78, 0x7a, 0x74, 0x0c, 0xae, 0xe3, 0x48,
+  0x5b, 0x8f, 0xf1, 0x84, 0xfa, 0x8c, 0xd5, 0x29, 0xa7, 0x38, 0xa1, 0x18,
+  0x79, 0x36, 0x8a, 0x32, 0x36, 0x9a, 0x5c, 0x14, 0x99, 0x7d, 0xed, 0x3b,
+  0x1b, 0xf0, 0xc2, 0xd7, 0xae, 0x40, 0x1a, 0x08, 0x21, 0x65, 0x20, 0xc1,
+  0x9b, 0x06, 0x14, 0xed, 0x52, 0x43, 0x6e, 0x6b, 0x3a, 0xec, 0xdd, 0x36,
+  0x0d, 0x13, 0xf8, 0x51, 0x68, 0xf8, 0x1e, 0x83, 0x35, 0x1e, 0x38, 0x19,
+  0x2a, 0xd4, 0xf7, 0xba, 0x69, 0x2f, 0x92, 0xb7, 0x1a, 0x0b, 0x8d, 0x6b,
+  0x0d, 0x39, 0xb2, 0xc4, 0xb4, 0x41, 0xcd, 0x80, 0xd8, 0xda, 0x23, 0x8e,
+  0xa9, 0x6b, 0x2a, 0x79, 0x4b, 0xa5, 0x74, 0x86, 0xce, 0x27, 0x97, 0x48,
+  0xb6, 0xac, 0x6a, 0x1d, 0x67, 0x91, 0xc4, 0x28, 0xb0, 0x64, 0x55, 0x05,
+  0xaf, 0x4d, 0x12, 0xa6, 0x43, 0x97, 0x0e, 0x16, 0xa4, 0x35, 0x5b, 0xe8,
+  0x02, 0xc5, 0x08, 0xb2, 0xdd, 0x16, 0x58, 0x9d, 0xc4, 0xe8, 0x5c, 0x24,
+  0x96, 0x4d, 0xa5, 0x5d, 0x5b, 0xb6, 0x22, 0xaf, 0x61, 0x2f, 0xf6, 0x08,
+  0x3a, 0x2d, 0x9b, 0xca, 0xdb, 0x12, 0x3e, 0x10, 0xaf, 0x0b, 0x6f, 0xd0,
+  0xd0, 0x59, 0x44, 0x8a, 0x58, 0x3a, 0x53, 0x1c, 0x7f, 0x18, 0xbf, 0xa8,
+  0x30, 0x8a, 0xb9, 0xee, 0x39, 0x44, 0xd8, 0x43, 0xbc, 0x9e, 0x81, 0xc7,
+  0xeb, 0x23, 0x36, 0xfc, 0x18, 0xa3, 0xa3, 0xb4, 0xfc, 0xbe, 0x53, 0xdb,
+  0xf8, 0xba, 0xc4, 0x4d, 0x81, 0x7b, 0x1d, 0xc7, 0x85, 0x5c, 0x21, 0xfa,
+  0xd6, 0x45, 0xc2, 0x4c, 0x4a, 0xaa, 0xc3, 0x76, 0x94, 0x1a, 0xe9, 0x93,
+  0xdd, 0x54, 0x8f, 0x5e, 0x89, 0xd5, 0xfd, 0xe1, 0xa9, 0x6a, 0xfc, 0x59,
+  0xcf, 0x33, 0x70, 0x7e, 0x73, 0x44, 0x82, 0x02, 0x0c, 0xb6, 0x6a, 0x46,
+  0x93, 0x46, 0xde, 0x05, 0xb3, 0x24, 0x72, 0x68, 0xc3, 0x4e, 0x59, 0x50,
+  0x83, 0x24, 0xfa, 0x0c, 0xd4, 0x7c, 0xe2, 0x9d, 0xc5, 0x49, 0x4a, 0x5f,
+  0x1c, 0x4c, 0x34, 0x2c, 0x99, 0x8c, 0xf8, 0xa9, 0x5e, 0x54, 0x97, 0x48,
+  0xa1, 0x23, 0xd5, 0x5d, 0x50, 0x67, 0x8f, 0xc9, 0xf4, 0xbb, 0xb0, 0x68,
+  0xcb, 0x64, 0x89, 0xce, 0x6d, 0x69, 0x4e, 0xea, 0x36, 0x9c, 0xcd, 0xbd,
+  0x39, 0xff, 0x3a, 0x9c, 0xcf, 0x40, 0x56, 0x15, 0x16, 0xa7, 0x49, 0xd1,
+  0xa9, 0x6c, 0xf7, 0x27, 0x8a, 0x2d, 0x43, 0xaa, 0xd8, 0xa5, 0xad, 0xc7,
+  0xd0, 0x34, 0xf2, 0x04, 0xd0, 0x7f, 0xbb, 0x41, 0x26, 0x54, 0x81, 0xad,
+  0x27, 0x92, 0x6a, 0xcf, 0xc9, 0x14, 0xd0, 0x1c, 0x19, 0x42, 0x06, 0xf2,
+  0xd9, 0x0b, 0x62, 0x1d, 0x3f, 0xaa, 0x27, 0x26, 0xd4, 0x27, 0x0d, 0xdd,
+  0xdc, 0x95, 0xc0, 0x5e, 0xf1, 0x0e, 0x63, 0xc6, 0xc0, 0x28, 0x61, 0x09,
+  0x99, 0xff, 0x65, 0x04, 0x67, 0x45, 0x51, 0x96, 0x22, 0x51, 0x97, 0xed,
+  0xd6, 0x7b, 0xfc, 0x15, 0xa1, 0x9b, 0x1d, 0x1d, 0x27, 0xa5, 0x21, 0xd6,
+  0x18, 0x26, 0x57, 0x49, 0x9b, 0x3a, 0x8e, 0xdc, 0xa4, 0x79, 0x57, 0x26,
+  0xf0, 0xf6, 0x80, 0xc4, 0xee, 0xe3, 0x2c, 0x12, 0x85, 0xe2, 0x35, 0x81,
+  0x25, 0x22, 0x92, 0xcb, 0xc2, 0xc2, 0x42, 0x84, 0xb8, 0x99, 0x94, 0xcf,
+  0x79, 0x7f, 0xe7, 0x3a, 0x23, 0x60, 0x3c, 0xf7, 0x41, 0x97, 0x6c, 0x6c,
+  0x81, 0xd5, 0x33, 0x7c, 0xfa, 0xaa, 0x7b, 0x7f, 0xd0, 0x2e, 0x3c, 0x1d,
+  0xf3, 0xd3, 0x27, 0xe9, 0x91, 0xdf, 0x21, 0xf4, 0x39, 0x41, 0x0f, 0x7e,
+  0xa2, 0xc0, 0x4e, 0xce, 0x47, 0x3c, 0x1f, 0x6e, 0xcb, 0x46, 0x47, 0xd6,
+  0x25, 0x41, 0xdd, 0x98, 0xa7, 0xc4, 0xdf, 0x83, 0x9c, 0xbf, 0xc0, 0xd1,
+  0x14, 0xde, 0xf8, 0x7b, 0xc0, 0x6a, 0x73, 0x9c, 0xd0, 0xfb, 0x77, 0xb7,
+  0xb0, 0xb8, 0x3f, 0x16, 0xc7, 0xee, 0x6c, 0xd4, 0x76, 0x96, 0x9e, 0x20,
+  0x8f, 0x61, 0xfc, 0x9b, 0x2d, 0xa3, 0x11, 0x0f, 0x81, 0x2b, 0x16, 0xce,
+  0x46, 0x9e, 0xb0, 0x70, 0xfc, 0xa5, 0xdf, 0xd1, 0xe0, 0x95, 0x48, 0xfc,
+  0x15, 0xc7, 0x0b, 0x3e, 0x3f, 0xec, 0x7e, 0x06, 0x72, 0x82, 0x86, 0x8f,
+  0xc0, 0x9b, 0x67, 0xdd, 0x87, 0x04, 0x67, 0x23, 0xbe, 0x38, 0x4f, 0xbc,
+  0xf3, 0x0c, 0x81, 0xc2, 0x9a, 0xa4, 0x40, 0x8b, 0x95, 0x92, 0xf5, 0xc6,
+  0xa7, 0x4d, 0x38, 0x07, 0x1e, 0xcf, 0x91, 0xf4, 0xbf, 0x80, 0xeb, 0x9f,
+  0xb1, 0x5e, 0x1f, 0xe2, 0x48, 0x3a, 0x03, 0xbf, 0x7f, 0x38, 0x15, 0x56,
+  0x5a, 0xf1, 0x7b, 0x65, 0xd9, 0x77, 0x3f, 0x7b, 0x5f, 0x5f, 0x63, 0x22,
+  0xb8, 0xe3, 0x88, 0x49, 0x7f, 0xbc, 0xe3, 0xc3, 0x51, 0x10, 0x97, 0xd9,
+  0xa6, 0x6d, 0x5a, 0xd4, 0x76, 0xf7, 0xa1, 0xd3, 0x71, 0xb6, 0x18, 0xcc,
+  0x3a, 0xbf, 0x2e, 0x3a, 0x71, 0x99, 0x60, 0x96, 0x2c, 0xfa, 0x57, 0xd9,
+  0x87, 0xfa, 0x19, 0x48, 0x2a, 0xaf, 0x0f, 0xe1, 0x34, 0xc9, 0x10, 0x18,
+  0xf1, 0x9b, 0xb8, 0x5a, 0xdf, 0xc0, 0xc9, 0xe1, 0x10, 0x47, 0x87, 0x4c,
+  0x96, 0x83, 0x5f, 0xa1, 0xbe, 0x1f, 0xda, 0x51, 0xc6, 0x3d, 0xed, 0x98,
+  0x15, 0x24, 0x2e, 0x9a, 0xc6, 0x7c, 0xbc, 0x57, 0x29, 0xa7, 0xec, 0x03,
+  0x02, 0x3e, 0x2f, 0xc6, 0xdb, 0x64, 0x03, 0xd8, 0xc3, 0x7a, 0x1c, 0xa6,
+  0x87, 0x45, 0x40, 0xe6, 0xfb, 0xc6, 0xbf, 0x87, 0xf9, 0x14, 0xcf, 0x3f,
+  0x52, 0x4c, 0x75, 0x0f, 0x2f, 0xe5, 0x94, 0x7c, 0x39, 0xc7, 0xa1, 0x5c,
+  0xd7, 0xaf, 0xe3, 0x40, 0x74, 0x54, 0xf7, 0x5e, 0x40, 0x0c, 0x6a, 0x47,
+  0xa7, 0x63, 0x09, 0x33, 0xdf, 0xb3, 0x23, 0x97, 0x97, 0x58, 0x1f, 0xfa,
+  0x05, 0xe9, 0xc3, 0x8b, 0x14, 0x6c, 0x02, 0x59, 0x0c, 0x17, 0x6f, 0x6a,
+  0x3e, 0xd8, 0xc5, 0x8d, 0x38, 0x29, 0x25, 0x5f, 0xe8, 0xeb, 0x0a, 0x42,
+  0x9e, 0x83, 0x87, 0x9d, 0x83, 0xa4, 0x5d, 0xe1, 0xe0, 0x29, 0xef, 0x67,
+  0x22, 0x39, 0x1b, 0xab, 0x54, 0xa7, 0x2e, 0xbb, 0xf6, 0x23, 0x84, 0x15,
+  0xd9, 0x9f, 0xbf, 0x2c, 0xe0, 0x55, 0x7a, 0x3e, 0x36, 0xf5, 0x7b, 0x9b,
+  0x63, 0x1c, 0xb5, 0x0e, 0x78, 0x33, 0x22, 0x50, 0xc2, 0x05, 0x8e, 0x06,
+  0x80, 0x01, 0xcc, 0x1a, 0xfa, 0x2c, 0x9b, 0x8e, 0xa7, 0xec, 0xc0, 0x21,
+  0x21, 0x3f, 0xc8, 0xc2, 0x1f, 0xf7, 0xe0, 0x91, 0x2f, 0x5e, 0x7e, 0xff,
+  0x99, 0x40, 0xfc, 0x3d, 0xc7, 0x7a, 0x8e, 0x4d, 0xa5, 0x9f, 0xe1, 0x0d,
+  0xa7, 0x64, 0x81, 0x1b, 0x76, 0x87, 0x48, 0xb4, 0xcf, 0x9f, 0xc4, 0x8e,
+  0x32, 0x73, 0x26, 0xbc, 0xd8, 0x11, 0xf3, 0x51, 0x9c, 0xa3, 0x7d, 0x44,
+  0x17, 0xc9, 0x74, 0xf1, 0x1a, 0x6d, 0x87, 0x4d, 0xd1, 0xdc, 0xdc, 0x1c,
+  0x18, 0xba, 0x54, 0x92, 0xc8, 0xff, 0x8e, 0xd6, 0x72, 0xeb, 0xdf, 0xf1,
+  0x57, 0x40, 0xa1, 0x4a, 0x86, 0x09, 0x4b, 0x11, 0xb0, 0xa2, 0x16, 0x09,
+  0x68, 0x17, 0xb1, 0x1e, 0x4a, 0x1b, 0xdd, 0xaf, 0xb9, 0xa5, 0x38, 0xd0,
+  0x28, 0x37, 0xb2, 0x67, 0xbe, 0x3b, 0xb2, 0x1f, 0x06, 0x55, 0x7b, 0xfd,
+  0x7c, 0x73, 0x24, 0xd7, 0x1c, 0xf9, 0xc5, 0xf5, 0x80, 0xbe, 0x31, 0x5c,
+  0x40, 0xd4, 0x4d, 0x67, 0x90, 0x1d, 0x2f, 0xf8, 0xe5, 0xdd, 0xc0, 0xf9,
+  0xc6, 0x10, 0xb9, 0x1e, 0xf1, 0x16, 0x93, 0x9d, 0x28, 0xb2, 0xfe, 0xf1,
+  0x85, 0x77, 0xc4, 0x7e, 0x9c, 0x37, 0xf4, 0xcd, 0xde, 0xb1, 0x04, 0x11,
+  0x8e, 0xd1, 0x2f, 0x50, 0x06, 0xa9, 0x69, 0x56, 0xa2, 0x00, 0x17, 0xb1,
+  0xa2, 0xc9, 0xd4, 0xf8, 0xc5, 0x2e, 0x6b, 0x18, 0xc9, 0x5c, 0xb0, 0x83,
+  0x5f, 0xc7, 0x7c, 0x12, 0x35, 0xb4, 0xc1, 0x6b, 0x8d, 0xc8, 0x5e, 0xaf,
+  0xa3, 0xde, 0x88, 0xb9, 0xb4, 0xa3, 0xd8, 0x9a, 0xe5, 0x12, 0xc7, 0x56,
+  0x12, 0xff, 0x5e, 0x8b, 0x32, 0x3d, 0xdf, 0x68, 0x94, 0xeb, 0xc5, 0x7b,
+  0x7c, 0x4a, 0xcb, 0x96, 0x21, 0x0a, 0xfe, 0xef, 0xb5, 0x54, 0x4a, 0xfc,
+  0x1f, 0xa2, 0xf9, 0x3f, 0x6f, 0xad, 0x26, 0x1b, 0xa0, 0x46, 0x00, 0x00,
+};
+
+static const uint8_t web_asset_app_css_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x59,
+  0xdb, 0x6e, 0xdb, 0x36, 0x18, 0xbe, 0xcf, 0x53, 0x68, 0x0d, 0x0a, 0xac,
+  0x68, 0x64, 0xc8, 0x07, 0xf9, 0x14, 0x60, 0x58, 0x5b, 0x20, 0xb7, 0xbb,
+  0xdd, 0x2d, 0x2d, 0x52, 0x36, 0x17, 0x59, 0xd2, 0x28, 0x3a, 0x76, 0x3a,
+  0xf4, 0xdd, 0xf7, 0x93, 0xa2, 0x28, 0x92, 0x22, 0x65, 0xb7, 0x69, 0xa3,
+  0xa6, 0x70, 0x68, 0xfe, 0xe7, 0xd3, 0x47, 0x6a, 0x57, 0xe1, 0xd7, 0xe8,
+  0xbf, 0xbb, 0x48, 0xfe, 0xe4, 0x55, 0xc9, 0xe3, 0x1c, 0x1d, 0x69, 0xf1,
+  0xba, 0x8d, 0x3e, 0x31, 0x8a, 0x8a, 0x87, 0xa8, 0x41, 0x65, 0x13, 0x37,
+  0x84, 0xd1, 0xfc, 0x51, 0xed, 0x3a, 0xa2, 0x4b, 0x7c, 0xa6, 0x98, 0x1f,
+  0xb6, 0xd1, 0x3a, 0x49, 0xea, 0x4b, 0xbf, 0xce, 0xf6, 0xb4, 0xdc, 0x46,
+  0x49, 0x84, 0x4e, 0xbc, 0xea, 0x56, 0x6b, 0x84, 0x31, 0x2d, 0xf7, 0xdb,
+  0x68, 0x66, 0x6c, 0xdd, 0xa1, 0xec, 0x79, 0xcf, 0xaa, 0x53, 0x89, 0xe3,
+  0xac, 0x2a, 0x2a, 0xb6, 0x8d, 0xee, 0xf3, 0x54, 0x3c, 0xed, 0x86, 0x6f,
+  0xf2, 0xff, 0x09, 0x47, 0xbb, 0x46, 0xeb, 0x86, 0x69, 0x53, 0x17, 0x08,
+  0xf4, 0xca, 0x0b, 0xe2, 0x88, 0x8c, 0x77, 0x15, 0xe7, 0xd5, 0xd1, 0x11,
+  0x51, 0x31, 0x4c, 0x98, 0xfe, 0x6a, 0x5a, 0x5f, 0xa2, 0xa6, 0x2a, 0x28,
+  0x8e, 0xee, 0x31, 0xc6, 0xae, 0x18, 0x2d, 0x45, 0x6b, 0x3b, 0x05, 0x56,
+  0x16, 0xbf, 0xec, 0xc4, 0x1a, 0xa1, 0x68, 0x5d, 0xd1, 0x92, 0x13, 0x36,
+  0x66, 0xc9, 0x54, 0x3c, 0xb6, 0x1e, 0x7e, 0x05, 0x06, 0x5a, 0x96, 0x55,
+  0x49, 0x9c, 0xaf, 0x18, 0xc2, 0xf4, 0xd4, 0x6c, 0xa3, 0x14, 0xe8, 0xc5,
+  0x6f, 0x12, 0x25, 0x8e, 0xf5, 0x8c, 0xee, 0x0f, 0x5c, 0x6e, 0x70, 0xcd,
+  0x9a, 0xa0, 0x8c, 0xd3, 0x17, 0xa2, 0xad, 0xf3, 0x28, 0xbb, 0xf8, 0xf2,
+  0xe9, 0x29, 0xd5, 0x1c, 0xd5, 0xea, 0xf9, 0x40, 0x39, 0x71, 0x99, 0x01,
+  0x09, 0x18, 0x5e, 0xf2, 0x61, 0x44, 0x2c, 0xad, 0xb5, 0x08, 0x8b, 0x4d,
+  0x28, 0x0f, 0x6c, 0x1b, 0x13, 0x6d, 0x65, 0x6a, 0xee, 0xb9, 0xc4, 0xcd,
+  0x01, 0xe1, 0xea, 0x2c, 0x36, 0xcc, 0xd4, 0x06, 0xb6, 0xdf, 0xa1, 0xdf,
+  0x93, 0x07, 0xf9, 0x4c, 0xa6, 0x1f, 0x42, 0xca, 0xba, 0x1e, 0xd0, 0x3a,
+  0xef, 0x8a, 0x2a, 0x7b, 0xb6, 0xa8, 0x4a, 0xc2, 0xcf, 0x15, 0x7b, 0x8e,
+  0x0b, 0xda, 0xf0, 0x07, 0x60, 0x42, 0x0a, 0xb2, 0x67, 0xe8, 0x18, 0x9f,
+  0x20, 0xf9, 0xfb, 0x34, 0x14, 0xdf, 0xc6, 0x0d, 0x7f, 0x2d, 0x88, 0x6d,
+  0xb7, 0x36, 0x2f, 0xf1, 0x32, 0x05, 0x47, 0x1c, 0x3d, 0x61, 0x10, 0xd9,
+  0xb2, 0x11, 0x4f, 0x20, 0xa1, 0xa7, 0x61, 0x5f, 0xa5, 0x83, 0x6f, 0x0a,
+  0x92, 0x43, 0x1a, 0x2c, 0xfa, 0x3c, 0xb3, 0x63, 0x5b, 0xbd, 0x10, 0x96,
+  0x17, 0xc2, 0x8b, 0x07, 0x8a, 0x31, 0x29, 0x2d, 0x3d, 0x85, 0x91, 0x37,
+  0x2b, 0xd9, 0x17, 0x49, 0x5a, 0x5f, 0x7e, 0xb9, 0xe6, 0x8e, 0x27, 0x45,
+  0x40, 0xab, 0xb2, 0x79, 0x50, 0x3a, 0xab, 0x3f, 0xb5, 0xda, 0x4a, 0x0d,
+  0x5e, 0xd5, 0xb6, 0x0e, 0xde, 0xf6, 0xb1, 0x47, 0xd6, 0xae, 0x56, 0xd2,
+  0xee, 0x04, 0x16, 0x94, 0xc3, 0x8e, 0xb0, 0x04, 0xf5, 0xa6, 0x33, 0x5f,
+  0x0f, 0xbb, 0xa1, 0x8c, 0xfa, 0x3e, 0x30, 0x52, 0xe2, 0x8b, 0xab, 0xdd,
+  0x46, 0x36, 0xe8, 0x86, 0x7e, 0x85, 0xe4, 0xeb, 0x55, 0x31, 0xd5, 0xde,
+  0x1e, 0x44, 0x98, 0xfd, 0x41, 0x5c, 0xa4, 0x28, 0x59, 0x6c, 0x86, 0x34,
+  0x13, 0x0c, 0xa9, 0xce, 0x49, 0x20, 0xf2, 0x8b, 0xc5, 0x7c, 0xbe, 0x0c,
+  0x12, 0x8d, 0xc9, 0xc3, 0xf3, 0x59, 0x3e, 0xcb, 0x3d, 0xa4, 0x0d, 0x81,
+  0xea, 0xc4, 0x88, 0xbd, 0xfa, 0xe9, 0x66, 0xd3, 0xcd, 0xf2, 0x69, 0x3e,
+  0x46, 0x37, 0x26, 0x35, 0xd9, 0xad, 0x30, 0x46, 0x1e, 0x6a, 0x4e, 0x1a,
+  0xee, 0x27, 0x79, 0x7a, 0xda, 0xc0, 0x20, 0x0b, 0x90, 0x8c, 0xc9, 0x7a,
+  0x4a, 0x57, 0x5f, 0xbc, 0x84, 0x19, 0x2a, 0x33, 0x52, 0xf8, 0x89, 0x36,
+  0x44, 0x3c, 0x41, 0xa2, 0x31, 0x79, 0xab, 0x54, 0x3c, 0x26, 0x69, 0x5e,
+  0xb1, 0xe3, 0xf8, 0x88, 0x14, 0x9f, 0x63, 0x4c, 0x19, 0x91, 0x85, 0xb2,
+  0x15, 0xb9, 0x79, 0x3a, 0x96, 0x76, 0x05, 0x0c, 0xcb, 0x58, 0xd6, 0x8f,
+  0x7f, 0x62, 0x87, 0xdb, 0xc1, 0xec, 0x86, 0x9a, 0x57, 0xd5, 0x2c, 0xf4,
+  0x8e, 0x05, 0xbf, 0xfa, 0xcd, 0xda, 0xdf, 0xd2, 0x83, 0x5a, 0xa9, 0x05,
+  0xda, 0x19, 0x41, 0x91, 0xb5, 0x74, 0x26, 0xed, 0xf0, 0xdc, 0x55, 0x85,
+  0x05, 0x0a, 0x68, 0x59, 0x9f, 0x60, 0x0a, 0x34, 0x90, 0xe4, 0x19, 0x1f,
+  0xf6, 0x82, 0xb5, 0x6b, 0xe8, 0x95, 0xf9, 0xee, 0xa9, 0x70, 0xb3, 0x94,
+  0x17, 0x8e, 0x77, 0xb2, 0x03, 0xc9, 0x9e, 0xc5, 0xdc, 0xbb, 0xc1, 0x43,
+  0xa8, 0xa0, 0xfb, 0x52, 0xb6, 0x6e, 0xe0, 0x9f, 0x11, 0xb3, 0x5b, 0x48,
+  0xf7, 0xac, 0x1d, 0xde, 0x0d, 0x47, 0xfc, 0x74, 0xbd, 0x5f, 0x86, 0x4d,
+  0xfd, 0x5e, 0x63, 0x9a, 0x53, 0x96, 0x91, 0xa6, 0x19, 0x03, 0x21, 0x38,
+  0xcf, 0x13, 0xbc, 0x76, 0xba, 0xe7, 0xfd, 0x3c, 0x5b, 0x2d, 0xe7, 0x36,
+  0x54, 0x23, 0x8c, 0x55, 0x6c, 0x8c, 0x53, 0x3e, 0xc3, 0x04, 0x13, 0x97,
+  0x13, 0xda, 0x2c, 0x16, 0x8b, 0x99, 0xc5, 0x89, 0x96, 0x79, 0x35, 0xaa,
+  0xd2, 0x86, 0xe0, 0x7c, 0x35, 0x50, 0x69, 0xba, 0x4a, 0xd6, 0x56, 0x4b,
+  0x9b, 0xb4, 0xc3, 0x74, 0x0c, 0x14, 0x7d, 0xbb, 0xb3, 0x27, 0xd8, 0x81,
+  0x20, 0x6c, 0x54, 0x78, 0x3f, 0x4d, 0x43, 0xc3, 0x85, 0xac, 0xf3, 0x94,
+  0xac, 0x47, 0x27, 0xd9, 0x3f, 0xa7, 0x86, 0xd3, 0xfc, 0xb5, 0x83, 0x3d,
+  0xdb, 0xa8, 0xa9, 0x51, 0x46, 0xe2, 0x1d, 0x88, 0x24, 0xa4, 0xbc, 0x21,
+  0x57, 0xbc, 0x03, 0xe7, 0x9b, 0x4f, 0xf1, 0xd1, 0x96, 0xbf, 0x26, 0xa4,
+  0x0b, 0xa4, 0x43, 0x7c, 0x44, 0x90, 0x66, 0x96, 0xd7, 0x7f, 0x28, 0x9d,
+  0x4d, 0x27, 0x09, 0x3a, 0x58, 0xf1, 0x8a, 0x13, 0x49, 0x5a, 0x39, 0x59,
+  0x1e, 0x02, 0x67, 0x9c, 0xf2, 0x82, 0xfc, 0xa4, 0x2a, 0x1b, 0xd7, 0xca,
+  0x29, 0x3e, 0xef, 0x38, 0x37, 0x1b, 0x2a, 0xf4, 0x94, 0x65, 0xb0, 0xfe,
+  0xe6, 0xa1, 0x74, 0x99, 0xc3, 0xd8, 0xc5, 0x6e, 0xea, 0x4e, 0x37, 0xab,
+  0x25, 0x9e, 0x8d, 0x41, 0x2a, 0x37, 0x31, 0x7f, 0x4a, 0xbb, 0xd1, 0x32,
+  0xa0, 0x72, 0xcf, 0xd7, 0x0c, 0xe7, 0x0c, 0x0e, 0x9b, 0xb4, 0xed, 0xf4,
+  0xf2, 0xb3, 0x1c, 0x6f, 0xc9, 0x64, 0xde, 0x44, 0x04, 0x35, 0xba, 0xac,
+  0x8f, 0x90, 0x49, 0xea, 0x00, 0x6a, 0x8e, 0x2e, 0x4e, 0x2e, 0x3c, 0x96,
+  0xfa, 0xd9, 0x9a, 0x39, 0x9a, 0x60, 0xc2, 0x11, 0x2d, 0x1a, 0x4f, 0xfd,
+  0xa5, 0x37, 0x8d, 0x3b, 0x15, 0x85, 0xb6, 0x63, 0x86, 0x4f, 0x95, 0x9d,
+  0xb8, 0x9f, 0x33, 0xa1, 0x0d, 0xb0, 0x67, 0x0c, 0x50, 0xd3, 0xa5, 0x3f,
+  0xca, 0x7a, 0x79, 0xd3, 0xf8, 0x34, 0x84, 0xba, 0x88, 0xfb, 0x16, 0x64,
+  0xed, 0xcc, 0x99, 0xf0, 0xc8, 0x9e, 0x0d, 0x64, 0x36, 0x00, 0x8b, 0xde,
+  0x26, 0x53, 0xdb, 0x63, 0x88, 0x0d, 0xa6, 0x71, 0x27, 0x16, 0xd5, 0xa0,
+  0xeb, 0x7e, 0x6f, 0xf4, 0x85, 0xae, 0x87, 0x4c, 0xe5, 0x29, 0xfc, 0xf1,
+  0xe6, 0xee, 0x9d, 0x27, 0xf9, 0x3a, 0xcf, 0x7f, 0xfc, 0x2c, 0x34, 0x84,
+  0xc3, 0x42, 0xb9, 0x9c, 0x92, 0x02, 0x07, 0xc6, 0xb8, 0xaf, 0x95, 0x84,
+  0xd5, 0xf3, 0x25, 0x77, 0x50, 0xbd, 0x50, 0xca, 0x2b, 0xdc, 0x72, 0x62,
+  0x0c, 0x7c, 0x19, 0xef, 0x10, 0xde, 0xf7, 0x8e, 0x53, 0x1d, 0x68, 0xcf,
+  0x8c, 0x49, 0x14, 0x00, 0x5f, 0xa3, 0x27, 0x1c, 0x09, 0x5d, 0x68, 0x16,
+  0xd3, 0x81, 0xf5, 0x3a, 0x1d, 0xf6, 0x8c, 0x6a, 0x4e, 0xe2, 0x73, 0x0c,
+  0x01, 0x86, 0x6f, 0x38, 0x89, 0xdb, 0xcc, 0x07, 0x93, 0xa6, 0x39, 0x13,
+  0xbf, 0xb7, 0x25, 0xaa, 0x0f, 0x10, 0x4d, 0x93, 0x70, 0xa0, 0xe1, 0xb9,
+  0x06, 0x96, 0x94, 0x2d, 0x8c, 0xfc, 0x7b, 0x82, 0xba, 0xc4, 0xad, 0x29,
+  0xca, 0x92, 0xce, 0xc7, 0xb3, 0xde, 0xc7, 0x79, 0x8e, 0xd2, 0x24, 0x89,
+  0x7e, 0xa3, 0xc7, 0xba, 0x62, 0x1c, 0x95, 0xbc, 0xe5, 0xe2, 0x83, 0x3e,
+  0x79, 0xbe, 0x26, 0x4b, 0x67, 0xa7, 0x90, 0xd6, 0xa2, 0xa6, 0xeb, 0x82,
+  0x92, 0xe4, 0x56, 0x41, 0x64, 0x39, 0x26, 0xe8, 0x08, 0x68, 0x0f, 0xe9,
+  0xf8, 0x2b, 0x2a, 0x30, 0xf5, 0xf1, 0x2e, 0x18, 0x60, 0xd3, 0xe9, 0x2a,
+  0xe7, 0x64, 0x4e, 0x89, 0x23, 0x9f, 0xa8, 0x7c, 0x7b, 0x34, 0x79, 0xaa,
+  0xff, 0x16, 0xfc, 0x13, 0xac, 0xf9, 0x40, 0x0f, 0x6a, 0x35, 0xe8, 0x4f,
+  0x2a, 0x80, 0x5e, 0x0a, 0x5a, 0x76, 0x76, 0xb9, 0xad, 0x15, 0x7a, 0xf1,
+  0x15, 0x31, 0xd7, 0x74, 0x54, 0x55, 0xd4, 0xdd, 0xc6, 0x48, 0xc1, 0x62,
+  0x2f, 0x00, 0xa7, 0x6b, 0x53, 0x79, 0x90, 0xc5, 0x23, 0x63, 0x3a, 0xd8,
+  0x15, 0xbb, 0x2a, 0xbe, 0x72, 0x17, 0x64, 0x62, 0xbc, 0x40, 0x83, 0xf9,
+  0x85, 0xb7, 0x58, 0xdf, 0x0b, 0x4a, 0x6e, 0x49, 0x8c, 0xa1, 0xe1, 0x7f,
+  0x80, 0x9c, 0x97, 0x37, 0x02, 0x55, 0xbf, 0x5f, 0x9d, 0xa8, 0xfa, 0x0e,
+  0xc2, 0x8e, 0xf7, 0x92, 0xeb, 0x5c, 0x9c, 0x2b, 0xab, 0xeb, 0x0c, 0xc2,
+  0x58, 0xcf, 0xbc, 0x9e, 0x1a, 0xcf, 0x94, 0x49, 0x73, 0xa6, 0x3c, 0x3b,
+  0x28, 0x16, 0x75, 0xd5, 0x01, 0x37, 0x46, 0xa0, 0xe1, 0xd2, 0x17, 0xc5,
+  0x45, 0x33, 0x6e, 0x8b, 0x27, 0x36, 0xee, 0x5d, 0x15, 0x84, 0x5b, 0xea,
+  0xec, 0x38, 0xa8, 0x79, 0x30, 0x5f, 0x58, 0x2d, 0xa0, 0x15, 0x23, 0x4f,
+  0xe4, 0x4a, 0x58, 0x05, 0x31, 0xa4, 0xfc, 0x55, 0x9b, 0xa6, 0x38, 0x25,
+  0x36, 0x9b, 0xc4, 0xe0, 0x01, 0x99, 0xa4, 0xad, 0xed, 0x55, 0x45, 0x3b,
+  0xc8, 0xb1, 0x53, 0x77, 0x47, 0xe7, 0x3d, 0x02, 0xc9, 0x96, 0xa4, 0x18,
+  0xb7, 0xa9, 0xa9, 0xfe, 0x60, 0x86, 0x10, 0x91, 0xbc, 0x96, 0xaf, 0x3d,
+  0x5d, 0x33, 0xcb, 0x32, 0xc5, 0xd1, 0x00, 0xb9, 0x93, 0x45, 0xf3, 0x78,
+  0xe7, 0x83, 0xf6, 0xb6, 0x07, 0xa4, 0xf6, 0xdb, 0x1d, 0x81, 0xb0, 0x93,
+  0x6b, 0x46, 0x74, 0x79, 0xfe, 0xee, 0x9d, 0xed, 0x8d, 0x99, 0x06, 0x7a,
+  0xca, 0x5b, 0xfd, 0x82, 0x2e, 0x39, 0xdb, 0x96, 0x7e, 0x61, 0x60, 0x8d,
+  0x71, 0xb3, 0x79, 0x8b, 0x39, 0x69, 0xf2, 0x5e, 0x5b, 0x23, 0xe3, 0xb8,
+  0x95, 0x37, 0x1c, 0x04, 0x47, 0x1f, 0x9d, 0xd8, 0x8c, 0xbe, 0xa1, 0x18,
+  0xa3, 0xb7, 0xbd, 0xa3, 0x0f, 0x0f, 0xea, 0x1c, 0x21, 0x20, 0xc0, 0xdf,
+  0xbf, 0x0b, 0x8b, 0x3f, 0x68, 0x46, 0xaa, 0xd7, 0xb6, 0x47, 0x32, 0x80,
+  0x2c, 0x45, 0x51, 0x19, 0x35, 0x64, 0x7a, 0x38, 0xa7, 0x17, 0xa2, 0x61,
+  0x45, 0xef, 0x1f, 0xf3, 0xba, 0xab, 0x73, 0xa2, 0xb2, 0xd4, 0x38, 0xce,
+  0x0c, 0xb4, 0x88, 0x61, 0xcf, 0x07, 0x83, 0xdb, 0xc0, 0x62, 0xf5, 0x6a,
+  0x23, 0x52, 0xff, 0x26, 0x2b, 0x63, 0xb7, 0x31, 0xec, 0xfb, 0xc5, 0xf0,
+  0x4b, 0xab, 0x60, 0x62, 0x8d, 0x5c, 0xdb, 0x04, 0xdb, 0x41, 0x14, 0x7d,
+  0x85, 0x11, 0x88, 0xc5, 0xe9, 0x76, 0x03, 0x3f, 0xfd, 0xb2, 0x5b, 0x8e,
+  0x6e, 0x5a, 0xa8, 0xef, 0xc1, 0x94, 0xd4, 0x3e, 0xc8, 0xf5, 0x40, 0x64,
+  0xae, 0xfb, 0xbd, 0x24, 0xac, 0x91, 0xc0, 0x91, 0xdd, 0xb6, 0x7e, 0x30,
+  0xda, 0xc1, 0x1a, 0x5c, 0x2d, 0xf9, 0xf8, 0xdd, 0x2f, 0x32, 0x94, 0xf7,
+  0xf3, 0x23, 0xc8, 0xcb, 0xbe, 0x5a, 0xf2, 0x72, 0x32, 0xef, 0xc2, 0x25,
+  0xa7, 0x89, 0xe8, 0x75, 0xaf, 0xea, 0x18, 0x76, 0x67, 0x2d, 0x38, 0x53,
+  0x74, 0x30, 0x86, 0x24, 0x7c, 0x00, 0x15, 0x98, 0xb4, 0xd2, 0x98, 0x18,
+  0x36, 0x5b, 0xf5, 0x11, 0x93, 0x26, 0x63, 0xb4, 0x16, 0xee, 0x94, 0xec,
+  0xbc, 0xf0, 0xd9, 0x3c, 0x16, 0xb7, 0x49, 0xd0, 0xf3, 0x12, 0x17, 0x2f,
+  0xc6, 0x98, 0x19, 0x4c, 0xb4, 0xc0, 0x34, 0xb3, 0x70, 0x85, 0x91, 0x2d,
+  0xc9, 0x64, 0x43, 0x8e, 0x92, 0xbf, 0xbe, 0x21, 0x35, 0x5b, 0x8b, 0x78,
+  0x43, 0xac, 0x2c, 0xed, 0x10, 0x96, 0x7e, 0x65, 0x3c, 0x4d, 0x44, 0x89,
+  0xdc, 0x19, 0x79, 0xab, 0x46, 0x7e, 0x8f, 0x12, 0xba, 0x75, 0xd5, 0x62,
+  0xa7, 0x49, 0x76, 0x50, 0x14, 0xf2, 0x5d, 0x20, 0xfd, 0x2a, 0x93, 0x5d,
+  0xbf, 0x3a, 0xbd, 0x28, 0xe8, 0x34, 0x29, 0xaa, 0x7d, 0x0c, 0x22, 0xf5,
+  0x7b, 0x05, 0x5d, 0x17, 0x16, 0xa4, 0xec, 0x77, 0x7d, 0x1c, 0x92, 0x98,
+  0x40, 0x74, 0xee, 0x52, 0x1d, 0x40, 0x9f, 0x42, 0xe8, 0x64, 0xa1, 0x68,
+  0x5d, 0x5b, 0xeb, 0xbe, 0x81, 0x9a, 0x6f, 0x2c, 0x13, 0xf5, 0xd6, 0xf2,
+  0x3e, 0x49, 0x56, 0x9f, 0x9f, 0x9e, 0x1e, 0xe4, 0xc2, 0xba, 0x7f, 0x85,
+  0x09, 0xc1, 0x9a, 0x3f, 0x44, 0xb3, 0x34, 0x15, 0xb5, 0xbe, 0x50, 0xb5,
+  0x8e, 0x4a, 0x7a, 0x44, 0xaa, 0xfb, 0xc0, 0xa0, 0xfe, 0xeb, 0xc4, 0x3f,
+  0x4b, 0x61, 0x91, 0xba, 0x0a, 0x81, 0x80, 0xc6, 0x15, 0xcc, 0x43, 0xe8,
+  0x2e, 0x67, 0xc4, 0x70, 0xa3, 0x15, 0xfd, 0xf3, 0x99, 0xbc, 0xe6, 0x0c,
+  0x01, 0x06, 0x77, 0x08, 0x5b, 0x95, 0x93, 0xf7, 0x3d, 0xa8, 0x7b, 0xbb,
+  0x96, 0xed, 0x59, 0x46, 0x44, 0x74, 0x84, 0x6b, 0xe2, 0x63, 0x61, 0x30,
+  0x68, 0xfd, 0x0b, 0x8d, 0xad, 0x40, 0x75, 0x43, 0x77, 0x05, 0x31, 0x41,
+  0xaf, 0x17, 0x83, 0x00, 0xc9, 0x44, 0xde, 0xe5, 0x43, 0x4e, 0xf1, 0x83,
+  0x3e, 0xa7, 0x3b, 0x59, 0xed, 0xcd, 0x69, 0x41, 0xda, 0xee, 0x8f, 0x69,
+  0x26, 0x8a, 0xa9, 0x13, 0x60, 0xe4, 0xe0, 0x00, 0x08, 0x58, 0x7d, 0x72,
+  0x32, 0x83, 0xcc, 0x17, 0x6c, 0xba, 0x8b, 0x5f, 0xa7, 0x59, 0xca, 0xbe,
+  0x00, 0x07, 0xf4, 0x63, 0x85, 0x49, 0xac, 0x66, 0x9b, 0x39, 0xe3, 0x3c,
+  0x13, 0xae, 0x3b, 0xe1, 0x7b, 0x28, 0xc7, 0xa6, 0xe5, 0xc8, 0xac, 0xfc,
+  0xf6, 0x3f, 0x8d, 0xb7, 0x2b, 0xf8, 0xd7, 0x21, 0x00, 0x00,
+};
+
+static const uint8_t web_asset_app_js_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xec, 0xbd,
+  0x6b, 0x73, 0x5c, 0xc7, 0x75, 0x28, 0xfa, 0x59, 0xf8, 0x15, 0x9b, 0x63,
+  0xc5, 0x33, 0x13, 0xcd, 0x0c, 0x01, 0xd0, 0x72, 0x64, 0x80, 0x8f, 0xa2,
+  0xf8, 0xb0, 0x71, 0x2d, 0x3e, 0x8a, 0x00, 0xed, 0x93, 0x43, 0xf3, 0x0a,
+  0x03, 0xcc, 0x06, 0xb1, 0xad, 0xc1, 0x0c, 0x32, 0x7b, 0x40, 0x90, 0x66,
+  0xa6, 0x4a, 0x8f, 0x38, 0x76, 0x4a, 0x8e, 0x95, 0xf8, 0x38, 0x8f, 0x9b,
+  0x63, 0xcb, 0xb1, 0x73, 0x4e, 0xe5, 0xc3, 0xad, 0x53, 0xa1, 0x68, 0xc9,
+  0xa2, 0x5e, 0x54, 0x55, 0x7e, 0xc1, 0xe0, 0x2f, 0xf8, 0x0f, 0xdc, 0xbf,
+  0x70, 0xd7, 0x5a, 0xfd, 0x5a, 0xfd, 0xda, 0x7b, 0x0f, 0x00, 0x52, 0x72,
+  0x92, 0x9c, 0x63, 0x11, 0xb3, 0x77, 0xef, 0xd5, 0xab, 0x57, 0x77, 0xaf,
+  0x5e, 0xbd, 0x9e, 0xfd, 0x74, 0x9c, 0x6c, 0xee, 0x8d, 0x46, 0xe9, 0x60,
+  0x7c, 0x33, 0x4f, 0x47, 0x2b, 0x83, 0x5e, 0x7a, 0x2f, 0x39, 0x93, 0xb4,
+  0x17, 0x96, 0xe7, 0x12, 0xf8, 0xbf, 0x3e, 0xbc, 0xce, 0xbb, 0x77, 0xd3,
+  0xde, 0xd5, 0x74, 0xbc, 0x3f, 0x1c, 0xbd, 0x96, 0xc3, 0xbb, 0x5b, 0xb7,
+  0xcd, 0xbb, 0x41, 0xba, 0xdf, 0xbf, 0x7f, 0xbe, 0xd7, 0x4b, 0x7b, 0xab,
+  0x79, 0xd6, 0x83, 0x97, 0x83, 0xbd, 0x7e, 0x9f, 0x7d, 0xba, 0x3d, 0xdc,
+  0xeb, 0xf7, 0xce, 0xef, 0x8d, 0x87, 0xab, 0x69, 0x3f, 0xdd, 0x1c, 0x5f,
+  0x4d, 0xf7, 0x25, 0x20, 0x68, 0xba, 0xd5, 0xed, 0xe7, 0xa9, 0x69, 0x2b,
+  0xb1, 0x58, 0x4d, 0xc7, 0xe3, 0x6c, 0x70, 0x07, 0x3b, 0x7a, 0x30, 0x31,
+  0x6f, 0xd3, 0x5e, 0x86, 0x8f, 0xcd, 0xd7, 0x76, 0x47, 0x63, 0x00, 0x7f,
+  0x67, 0xd4, 0xdd, 0xc1, 0x31, 0x28, 0x1c, 0xe7, 0x08, 0x83, 0xe1, 0xe6,
+  0x6b, 0xf0, 0x8f, 0x6a, 0x8f, 0x8f, 0x46, 0xe9, 0xe6, 0x70, 0x30, 0x00,
+  0x6c, 0xce, 0x8f, 0xc7, 0xe9, 0xce, 0xee, 0x18, 0xdb, 0xcf, 0x2f, 0xcf,
+  0xc1, 0xc3, 0x7c, 0x9c, 0xec, 0x74, 0xef, 0xdd, 0x08, 0xbc, 0x5f, 0xd0,
+  0x0d, 0x36, 0xba, 0x79, 0xaa, 0x5b, 0x5c, 0x4c, 0xfb, 0xdd, 0xfb, 0xf4,
+  0x7a, 0x7e, 0x5e, 0x00, 0xcf, 0xf2, 0x2b, 0xdd, 0xc1, 0x5e, 0xb7, 0xdf,
+  0xbf, 0x7f, 0xa1, 0x3f, 0xcc, 0xd3, 0x9e, 0x19, 0xa7, 0xd5, 0xf5, 0x5a,
+  0xb6, 0x93, 0x0e, 0xf7, 0x6c, 0xbc, 0xf6, 0xbb, 0xf9, 0xa5, 0xbb, 0xe9,
+  0xe8, 0x82, 0x68, 0xc1, 0x3f, 0x9d, 0xdb, 0xda, 0x1b, 0x6c, 0x8e, 0xb3,
+  0xe1, 0x20, 0xc9, 0x06, 0xd9, 0xf8, 0xbb, 0xe9, 0xc6, 0x2a, 0x8d, 0xaa,
+  0xd1, 0x4c, 0x1e, 0x10, 0x05, 0xb2, 0xad, 0xa4, 0xe1, 0x76, 0xdc, 0x84,
+  0xce, 0xc6, 0x7b, 0xa3, 0x01, 0x7c, 0xad, 0x9a, 0xb8, 0xbd, 0xab, 0xcf,
+  0xf1, 0xff, 0x36, 0xfb, 0x69, 0x77, 0x24, 0x9f, 0xfb, 0x0d, 0x97, 0x75,
+  0xbb, 0xe8, 0x08, 0xf0, 0xe5, 0xc4, 0xf4, 0x25, 0xe9, 0xfe, 0xd5, 0xaf,
+  0xaa, 0x3f, 0x3b, 0xa3, 0xb4, 0xdb, 0xbb, 0xbf, 0x3a, 0xee, 0x8e, 0xd3,
+  0xe4, 0xcc, 0x99, 0x33, 0x89, 0x1e, 0x45, 0xe7, 0xda, 0xf5, 0x4b, 0x57,
+  0x93, 0x3f, 0xff, 0xf3, 0xa4, 0xac, 0xdd, 0x85, 0x6b, 0x57, 0xaf, 0x5e,
+  0xba, 0xb0, 0xb6, 0x72, 0xf5, 0x9b, 0x4d, 0x0b, 0x73, 0x98, 0x96, 0x61,
+  0x3f, 0xed, 0xf4, 0x87, 0x77, 0x1a, 0x75, 0xdd, 0x3a, 0xe9, 0xf6, 0x09,
+  0x50, 0xb2, 0xa9, 0xc9, 0x39, 0x1c, 0xa9, 0x1f, 0xb0, 0x90, 0x92, 0x76,
+  0x92, 0xbf, 0x96, 0xed, 0xee, 0xc2, 0x9f, 0x75, 0x6b, 0x78, 0x82, 0x66,
+  0xc1, 0xd1, 0x60, 0xaf, 0xba, 0xa5, 0xc4, 0x76, 0x38, 0x18, 0xee, 0xa6,
+  0x03, 0x8b, 0x0a, 0xd6, 0xdb, 0x4d, 0x9c, 0x8c, 0xf8, 0xeb, 0x74, 0x34,
+  0x02, 0xb4, 0xa2, 0xaf, 0x77, 0xd2, 0x3c, 0xef, 0xde, 0x31, 0xdf, 0xbb,
+  0x2d, 0x08, 0x7a, 0x03, 0x57, 0x5f, 0x2b, 0xa9, 0xdd, 0x48, 0x71, 0x75,
+  0x18, 0x82, 0xd5, 0x9a, 0xd6, 0x38, 0xc4, 0xf2, 0xdd, 0xcf, 0x6f, 0x8e,
+  0xfa, 0x00, 0x6f, 0x7d, 0x3f, 0x5f, 0x3a, 0x79, 0xf2, 0xf9, 0x07, 0xfb,
+  0xd9, 0xa0, 0x37, 0xdc, 0x07, 0xe2, 0x6d, 0x76, 0x71, 0x81, 0x75, 0xb6,
+  0x87, 0xf9, 0x78, 0x72, 0x72, 0x3f, 0x5f, 0x5f, 0x9e, 0xf3, 0x88, 0x7b,
+  0xc1, 0x50, 0x6f, 0x3c, 0x5c, 0xaa, 0xb7, 0x04, 0xb0, 0xa6, 0x44, 0x6b,
+  0x3c, 0xba, 0xcf, 0x66, 0xc5, 0xec, 0xbb, 0x74, 0xdf, 0xa0, 0xd4, 0x50,
+  0x5f, 0x38, 0xe3, 0xd8, 0xc8, 0x06, 0xdd, 0xd1, 0xfd, 0xb5, 0xfb, 0xbb,
+  0x38, 0xd4, 0x7a, 0x77, 0x34, 0xea, 0xde, 0xdf, 0xd8, 0xdb, 0xda, 0x4a,
+  0x47, 0xf5, 0xe5, 0x38, 0xc5, 0xb7, 0xbb, 0x83, 0x5e, 0x3f, 0x15, 0x80,
+  0xaf, 0xc1, 0xa3, 0x42, 0xfa, 0xf1, 0xc6, 0x57, 0xc4, 0xd3, 0x82, 0xd9,
+  0xe2, 0xad, 0x69, 0x3b, 0x15, 0x4c, 0x1d, 0x6f, 0x7b, 0x09, 0x9f, 0x49,
+  0x94, 0x27, 0x09, 0x90, 0x74, 0x73, 0x3b, 0x69, 0x50, 0x43, 0xb5, 0x62,
+  0x9f, 0x43, 0x9e, 0xb8, 0xff, 0x32, 0xec, 0xd3, 0xe1, 0x70, 0xd0, 0xa8,
+  0x4f, 0x7f, 0x3d, 0x7d, 0x32, 0xfd, 0x60, 0xfa, 0xfe, 0xf4, 0xf1, 0xf4,
+  0x33, 0xf8, 0xf7, 0x33, 0xf8, 0xf7, 0x83, 0xe4, 0xe0, 0x8d, 0xe4, 0xe0,
+  0xad, 0x83, 0x37, 0x0e, 0xde, 0x3c, 0x78, 0x1d, 0xde, 0x7e, 0x84, 0x7f,
+  0x4d, 0x1f, 0xc1, 0x5f, 0x9f, 0x26, 0xd3, 0xcf, 0xa7, 0x4f, 0xe0, 0xc7,
+  0x07, 0x07, 0xaf, 0x1f, 0xbc, 0x03, 0x8d, 0x9f, 0xc0, 0x1c, 0x8c, 0x47,
+  0x7b, 0x69, 0x0b, 0x18, 0x10, 0x23, 0xaa, 0x9a, 0x34, 0xea, 0x98, 0xef,
+  0x89, 0x4d, 0xd8, 0x12, 0xc4, 0x46, 0xe8, 0x0d, 0xce, 0xa0, 0xc0, 0x8d,
+  0x8d, 0x6e, 0x73, 0x3b, 0xed, 0xed, 0xf5, 0x0d, 0x87, 0x6b, 0xe8, 0x45,
+  0x04, 0xcb, 0xe8, 0xe4, 0xc9, 0x64, 0xfa, 0xee, 0xf4, 0x3d, 0xec, 0x19,
+  0x10, 0xfa, 0x44, 0x20, 0x7c, 0xf0, 0x4e, 0x02, 0x8f, 0x3e, 0x98, 0x7e,
+  0x98, 0x6c, 0xc1, 0x1a, 0x05, 0xe4, 0xe1, 0xe5, 0xfb, 0x88, 0xe2, 0xf4,
+  0x77, 0xd3, 0x87, 0x07, 0x6f, 0x26, 0x80, 0xef, 0x93, 0xe9, 0x27, 0x07,
+  0x3f, 0x99, 0x7e, 0x3c, 0x7d, 0x92, 0xc0, 0xf8, 0x3e, 0x9c, 0x7e, 0x2a,
+  0x47, 0xfa, 0xe8, 0xe0, 0xc7, 0x38, 0x5e, 0x18, 0xdf, 0x3b, 0x09, 0x34,
+  0xff, 0x00, 0x21, 0x26, 0x0d, 0x09, 0x0c, 0x3e, 0xfa, 0x1c, 0x80, 0xbf,
+  0x31, 0x7d, 0x48, 0x6d, 0x3f, 0x6a, 0xb6, 0xa8, 0x7b, 0x24, 0xc0, 0x5f,
+  0x13, 0xc8, 0x4f, 0x0f, 0xde, 0x4a, 0xe0, 0xd5, 0x43, 0x80, 0xfb, 0x10,
+  0x1e, 0x7f, 0x82, 0x00, 0xe1, 0xaf, 0x0f, 0x90, 0x4c, 0x8f, 0x0f, 0x7e,
+  0x48, 0x4d, 0xe1, 0x09, 0xd2, 0x4a, 0xfc, 0x00, 0x58, 0x9f, 0x10, 0xad,
+  0x91, 0xd2, 0xbf, 0x45, 0x64, 0xb0, 0xc5, 0x27, 0x34, 0x1a, 0xfc, 0x09,
+  0xef, 0xb1, 0xa7, 0x4f, 0x11, 0x60, 0x87, 0x38, 0x32, 0xd0, 0x60, 0x3c,
+  0x1a, 0xf6, 0x6f, 0x20, 0x97, 0xd7, 0xa7, 0x8a, 0xe6, 0xc5, 0x3b, 0xe9,
+  0xe8, 0x4e, 0x4a, 0xef, 0x6e, 0xee, 0xf6, 0x80, 0x5d, 0x35, 0xe0, 0x3f,
+  0x5d, 0xce, 0x92, 0xf1, 0x77, 0x87, 0x88, 0x72, 0xe2, 0x8c, 0xe4, 0xe5,
+  0x0e, 0xe3, 0xb2, 0xa0, 0x53, 0xf3, 0x91, 0xf8, 0x05, 0xec, 0x50, 0x1d,
+  0xb3, 0x93, 0x24, 0x85, 0x0f, 0xd9, 0x77, 0x0d, 0xaf, 0x61, 0xb3, 0xb3,
+  0x35, 0x1c, 0x5d, 0xea, 0x6e, 0x6e, 0x37, 0xf6, 0x08, 0x93, 0xe4, 0xcc,
+  0x59, 0xd6, 0xde, 0x6c, 0xfe, 0x91, 0x3c, 0xae, 0xac, 0x9e, 0x3b, 0x5b,
+  0xc0, 0x02, 0x1a, 0x23, 0xfc, 0x66, 0xd4, 0xc1, 0x33, 0x1c, 0x70, 0x15,
+  0x60, 0xe0, 0x17, 0x5b, 0x1a, 0xe6, 0x14, 0x81, 0xaf, 0x9a, 0xc9, 0xb5,
+  0x8d, 0xef, 0xc3, 0xf2, 0xe8, 0x74, 0xf3, 0x3c, 0xbb, 0x33, 0x10, 0x0f,
+  0x5b, 0xf2, 0x3b, 0xf6, 0xd1, 0x44, 0x2f, 0x1f, 0xc3, 0x5d, 0x93, 0x07,
+  0x49, 0xa7, 0xd3, 0xc1, 0x41, 0xb4, 0x04, 0x46, 0xf9, 0x92, 0x43, 0x0b,
+  0x38, 0xf7, 0x27, 0x8c, 0xd0, 0x81, 0xbd, 0x7b, 0x41, 0xb4, 0xb7, 0x48,
+  0x6e, 0x33, 0x20, 0x3d, 0x01, 0x63, 0xe0, 0x2a, 0x4d, 0x87, 0x1c, 0xf9,
+  0x7e, 0x46, 0x5b, 0xd3, 0x6a, 0x60, 0x26, 0x06, 0x8e, 0xf8, 0xa4, 0x2e,
+  0x50, 0x7b, 0x55, 0x0c, 0xa9, 0xbe, 0xe4, 0x91, 0x53, 0xb1, 0xc5, 0xda,
+  0xf4, 0x57, 0xb0, 0x78, 0x1f, 0xc3, 0x5a, 0xfe, 0x04, 0x16, 0xd1, 0xd9,
+  0xc4, 0xfa, 0xae, 0xe6, 0x10, 0x50, 0x3c, 0xbd, 0xb9, 0x02, 0x03, 0x4d,
+  0x1b, 0xe1, 0x05, 0xe4, 0x7c, 0xb1, 0x01, 0x7b, 0xf6, 0xb5, 0x65, 0x17,
+  0xb9, 0x31, 0x9c, 0xbe, 0xa3, 0x43, 0x20, 0x67, 0x7d, 0xe7, 0x22, 0xa7,
+  0xb1, 0x5b, 0xa3, 0x56, 0x02, 0x9d, 0x2a, 0xd8, 0xf4, 0xd2, 0xbb, 0xd9,
+  0x66, 0xfa, 0xea, 0x56, 0xbf, 0x7b, 0xe7, 0x10, 0x38, 0x05, 0xbe, 0x0e,
+  0x93, 0xed, 0x22, 0x35, 0xbc, 0x8c, 0xed, 0xaa, 0xe3, 0x96, 0xa7, 0xd0,
+  0xf3, 0xe8, 0xd5, 0xbb, 0xdd, 0xfe, 0x5e, 0x7a, 0x08, 0xe4, 0x42, 0x9f,
+  0x47, 0xe9, 0xb6, 0x4a, 0x8d, 0x51, 0x76, 0xd9, 0xab, 0x84, 0x61, 0x2f,
+  0xdd, 0xea, 0xee, 0xf5, 0xc7, 0x71, 0x6c, 0xea, 0x37, 0x07, 0xaf, 0x0d,
+  0x86, 0xfb, 0xc8, 0x6b, 0xc4, 0x41, 0x86, 0x6b, 0x15, 0xf9, 0xb6, 0x59,
+  0xb8, 0xd4, 0xc3, 0x73, 0xcf, 0x3d, 0x27, 0xb7, 0x98, 0xd9, 0x6c, 0xe2,
+  0xbf, 0xa1, 0x33, 0xc8, 0x3f, 0x23, 0x6a, 0x74, 0x70, 0x25, 0xbb, 0xdd,
+  0x51, 0x8e, 0xa7, 0xbb, 0xea, 0x2d, 0x1b, 0x24, 0x72, 0xa3, 0xc9, 0x3d,
+  0x38, 0x5a, 0xaa, 0xc9, 0x33, 0xc3, 0x43, 0x41, 0x9c, 0x10, 0x82, 0xcf,
+  0xdc, 0xb8, 0x79, 0x75, 0x6d, 0xe5, 0xca, 0xa5, 0x57, 0x2f, 0xdf, 0x38,
+  0x0f, 0xff, 0x5d, 0xfb, 0xd3, 0xeb, 0x97, 0x56, 0x91, 0x7b, 0x3a, 0x5b,
+  0xaa, 0x15, 0x99, 0x9c, 0x96, 0xbb, 0xbc, 0x5b, 0xe1, 0x15, 0x76, 0x5b,
+  0x89, 0xe4, 0x5b, 0x20, 0xf8, 0xa7, 0x6b, 0xe9, 0x3d, 0x10, 0xc7, 0x37,
+  0x87, 0xbd, 0x74, 0x24, 0xa5, 0x0e, 0xf6, 0x04, 0x4f, 0x31, 0x3a, 0x3e,
+  0xfe, 0x19, 0x4e, 0x88, 0x0f, 0xe1, 0x84, 0x79, 0x72, 0xf0, 0x3a, 0x9e,
+  0x5a, 0x78, 0xea, 0x3e, 0x84, 0xf9, 0x56, 0x47, 0x00, 0x9d, 0x25, 0xef,
+  0xc3, 0x83, 0x87, 0x49, 0x03, 0x8e, 0x83, 0x4f, 0x3b, 0x89, 0x58, 0x73,
+  0x20, 0x5a, 0x03, 0x3d, 0x46, 0x9d, 0xed, 0x66, 0x32, 0x7d, 0x44, 0x27,
+  0x1a, 0x1c, 0x6c, 0x70, 0xbe, 0x7d, 0x00, 0x3f, 0x01, 0xc8, 0xfb, 0xad,
+  0xe4, 0xe0, 0x47, 0xf8, 0x14, 0x4e, 0x9e, 0xe4, 0xff, 0x5a, 0xbd, 0x76,
+  0xb5, 0x4d, 0xa7, 0xe0, 0x93, 0xe9, 0x7b, 0x07, 0x7f, 0xa5, 0x0e, 0xc9,
+  0x8e, 0xe1, 0x67, 0x3d, 0x42, 0xea, 0xc6, 0xde, 0x00, 0x87, 0x79, 0x19,
+  0x91, 0x6f, 0x08, 0x69, 0x47, 0x4d, 0x90, 0x18, 0xd6, 0xdd, 0x0c, 0x06,
+  0x21, 0x86, 0x72, 0x11, 0x68, 0xfd, 0x1d, 0xf8, 0xa9, 0xda, 0x99, 0x8b,
+  0xcf, 0xee, 0x50, 0x5e, 0x5f, 0xcc, 0x77, 0x7b, 0x2f, 0xc1, 0x13, 0xb8,
+  0x1b, 0x00, 0x43, 0x47, 0x10, 0x9d, 0x3b, 0xe9, 0xf8, 0x66, 0x36, 0x18,
+  0xbf, 0xd4, 0x80, 0xb6, 0x2f, 0xbc, 0xd0, 0xe4, 0x4d, 0xb3, 0x85, 0xaf,
+  0xeb, 0xb6, 0x0f, 0x54, 0xb7, 0xf0, 0x44, 0x7d, 0xb7, 0x32, 0x18, 0x2f,
+  0x7c, 0x1d, 0xbf, 0x13, 0x72, 0x46, 0x73, 0x99, 0xfa, 0x7b, 0xe1, 0x4c,
+  0xb2, 0xb8, 0xac, 0x98, 0xf9, 0xdd, 0xe5, 0x64, 0x62, 0xf5, 0x7e, 0x6a,
+  0xb1, 0x10, 0x24, 0xa2, 0x72, 0x6a, 0x31, 0x04, 0xf3, 0x6b, 0x51, 0x98,
+  0x5b, 0x25, 0x30, 0x2f, 0xf7, 0x87, 0xdd, 0x99, 0x81, 0xe6, 0xe3, 0x91,
+  0x01, 0x3a, 0x67, 0x1f, 0x94, 0xfd, 0x74, 0x70, 0x67, 0xbc, 0x0d, 0xaf,
+  0xf7, 0x5e, 0x6a, 0x38, 0x82, 0x15, 0xde, 0x35, 0xef, 0xa1, 0x60, 0xeb,
+  0xae, 0xba, 0x8e, 0x98, 0xd6, 0x06, 0xce, 0x17, 0xd1, 0xfb, 0x3c, 0x8a,
+  0xb1, 0x72, 0xc6, 0x5a, 0x09, 0xe1, 0x26, 0xe0, 0x72, 0x16, 0x2f, 0xd1,
+  0x14, 0x2f, 0xdc, 0x7b, 0x08, 0x75, 0x25, 0x77, 0xd7, 0x32, 0x97, 0xe2,
+  0xb7, 0xe1, 0x6a, 0x43, 0xeb, 0xdc, 0xe0, 0x27, 0x29, 0x85, 0xd2, 0xc6,
+  0x99, 0xe4, 0xc4, 0x89, 0x86, 0x6c, 0xf2, 0xd5, 0x64, 0xfe, 0xde, 0x4b,
+  0xf3, 0x56, 0x9b, 0xb1, 0x10, 0xb3, 0x03, 0x9b, 0xf4, 0x16, 0xff, 0xea,
+  0x4f, 0xb6, 0x9a, 0x70, 0x49, 0x5a, 0x90, 0x52, 0x08, 0x1e, 0xa7, 0x27,
+  0xc4, 0x49, 0x29, 0x71, 0x63, 0x37, 0x12, 0x01, 0x17, 0x19, 0x02, 0xde,
+  0xda, 0xa9, 0x83, 0x96, 0x40, 0x65, 0x62, 0xbe, 0x16, 0xdd, 0x82, 0x70,
+  0x11, 0xdc, 0xcc, 0x4d, 0x6f, 0x0e, 0x36, 0x32, 0xba, 0x79, 0xdb, 0x33,
+  0x40, 0x4c, 0x67, 0x00, 0x84, 0x87, 0x37, 0x30, 0x81, 0xde, 0xab, 0x3c,
+  0x95, 0xc3, 0xa7, 0xaf, 0x71, 0x18, 0xf3, 0x0b, 0x6e, 0x1b, 0x94, 0x8f,
+  0xec, 0x26, 0x8b, 0x5e, 0x93, 0x4d, 0xb7, 0xc9, 0xd7, 0xfc, 0x9e, 0xdc,
+  0x26, 0x2f, 0xb9, 0x4d, 0xba, 0x6e, 0x13, 0x4b, 0x4a, 0x17, 0x1d, 0xed,
+  0x39, 0x4d, 0x16, 0xe7, 0xbd, 0xdb, 0x28, 0xb5, 0x0c, 0x5c, 0xe5, 0x36,
+  0x87, 0xc0, 0x41, 0x02, 0x6b, 0x20, 0x1b, 0xa7, 0x3b, 0x5c, 0x4f, 0x03,
+  0xb2, 0x61, 0xd2, 0x20, 0x65, 0x0d, 0x71, 0x0a, 0xf8, 0xe7, 0xb4, 0xf8,
+  0x16, 0xfe, 0x04, 0x7e, 0xe0, 0xc8, 0x4c, 0x66, 0x9a, 0x6c, 0x6e, 0xdd,
+  0x0c, 0x4a, 0x94, 0xa4, 0xf3, 0xb1, 0xa7, 0xa8, 0x64, 0x06, 0x7d, 0x69,
+  0xf4, 0x01, 0x40, 0x69, 0xc1, 0x6c, 0x42, 0x2f, 0xd7, 0xb3, 0xc1, 0x92,
+  0x3b, 0x7b, 0xad, 0x64, 0x87, 0x14, 0x1b, 0x57, 0x60, 0x73, 0x2d, 0xb9,
+  0xf3, 0xa6, 0x16, 0x18, 0x1f, 0x01, 0x2e, 0xbc, 0xa6, 0x80, 0x0e, 0x7b,
+  0x32, 0xdf, 0x1c, 0x65, 0xbb, 0xc4, 0x76, 0xbd, 0x15, 0x43, 0x1f, 0x20,
+  0xb1, 0x3a, 0xbb, 0x7b, 0xf9, 0xb6, 0x14, 0x6c, 0x99, 0xec, 0x2a, 0x04,
+  0x6f, 0x9b, 0x28, 0xc1, 0x13, 0xab, 0x80, 0x36, 0xc0, 0x61, 0xc3, 0xa3,
+  0xdf, 0x44, 0x06, 0x06, 0x8c, 0x2d, 0xfc, 0x76, 0xbb, 0xf0, 0xad, 0x40,
+  0x42, 0x93, 0x6e, 0xf3, 0x6e, 0x0b, 0x3f, 0x88, 0x92, 0x42, 0x34, 0xef,
+  0xf4, 0xf2, 0x52, 0x12, 0x88, 0x96, 0x3e, 0x0d, 0x82, 0xc3, 0x3b, 0xfc,
+  0xcc, 0x93, 0x62, 0x60, 0x2f, 0x36, 0xba, 0x51, 0xe4, 0x2d, 0xc3, 0x13,
+  0xc6, 0x0d, 0x72, 0x48, 0x60, 0xa9, 0x8c, 0xbc, 0x15, 0x02, 0x2b, 0x6b,
+  0xc9, 0xdd, 0xca, 0xf0, 0xed, 0xb8, 0x85, 0xfd, 0x4c, 0xf8, 0x50, 0xf9,
+  0x0e, 0xc3, 0x2d, 0x77, 0xeb, 0x81, 0x2d, 0xcb, 0x2f, 0xa9, 0x2d, 0x01,
+  0x02, 0x49, 0x68, 0x19, 0x2c, 0xa9, 0xd5, 0x81, 0x0d, 0x2c, 0x09, 0x66,
+  0x49, 0x49, 0x34, 0xf5, 0x64, 0x72, 0x0b, 0xd7, 0xd2, 0xed, 0xdb, 0xb8,
+  0x34, 0x70, 0x3c, 0xcb, 0x73, 0xde, 0x46, 0x2f, 0xb9, 0xfa, 0x34, 0xd2,
+  0xbb, 0xe9, 0x60, 0xcc, 0xef, 0x99, 0xf4, 0x80, 0x2e, 0x54, 0x20, 0xb1,
+  0xc1, 0x3e, 0x1a, 0x6c, 0xa6, 0xc3, 0xad, 0x84, 0x8e, 0x9f, 0x97, 0x2d,
+  0xb9, 0xc2, 0xbf, 0x25, 0x79, 0xdc, 0x3b, 0x20, 0x9b, 0x18, 0xf0, 0x81,
+  0xdb, 0xa0, 0xb8, 0x80, 0x95, 0xdd, 0xd0, 0xf8, 0x82, 0x8a, 0x49, 0xa4,
+  0x01, 0xcd, 0xc5, 0xcb, 0xa4, 0x16, 0x12, 0x27, 0x6d, 0x5c, 0x67, 0x31,
+  0x29, 0xd2, 0xde, 0xd9, 0xc3, 0xb5, 0x86, 0x8a, 0x82, 0x5a, 0x07, 0x45,
+  0xde, 0xc8, 0x10, 0xad, 0x6b, 0xc1, 0x8d, 0x74, 0x33, 0xcd, 0xee, 0xa6,
+  0x3d, 0x14, 0x80, 0x65, 0xbb, 0x39, 0xf7, 0x5e, 0x1c, 0xd7, 0xae, 0xce,
+  0xa2, 0x61, 0x2d, 0xd5, 0xb2, 0xba, 0x63, 0x0e, 0x6a, 0xb3, 0xa5, 0xb2,
+  0x09, 0x84, 0x23, 0x40, 0x5f, 0x5f, 0x46, 0xe2, 0xb7, 0x63, 0xfb, 0x42,
+  0x03, 0xff, 0x57, 0x3e, 0xa5, 0x0e, 0xc6, 0x86, 0xf4, 0x8c, 0xfc, 0xe6,
+  0xb2, 0x2d, 0xba, 0xd3, 0x6b, 0x77, 0xce, 0xba, 0xa4, 0x0d, 0xa4, 0x75,
+  0x41, 0x5e, 0xcc, 0x5c, 0x8b, 0x83, 0x38, 0xf5, 0xd5, 0x6f, 0xa6, 0x1b,
+  0x11, 0xdb, 0x4b, 0xb6, 0x7c, 0x25, 0xcb, 0xc7, 0x0d, 0xeb, 0x53, 0x85,
+  0xe4, 0x73, 0xcf, 0x49, 0x96, 0x95, 0x9f, 0xdf, 0xc5, 0x63, 0x04, 0x41,
+  0x0e, 0x37, 0xf7, 0x76, 0x70, 0xd2, 0x81, 0x42, 0x97, 0xfa, 0x29, 0xfe,
+  0xf9, 0xf2, 0xfd, 0x95, 0x5e, 0xa3, 0x9e, 0xe5, 0xed, 0xee, 0x6e, 0xbd,
+  0xd9, 0xd9, 0xdc, 0x4e, 0x61, 0xe8, 0x3d, 0x7f, 0xc5, 0x2b, 0x20, 0xee,
+  0xfc, 0x06, 0x6e, 0x92, 0xa4, 0x05, 0xfb, 0x00, 0x2e, 0x15, 0x9f, 0x1c,
+  0xfc, 0xf4, 0xe0, 0x47, 0x46, 0xbf, 0x87, 0x0f, 0x7f, 0x47, 0xaa, 0xa6,
+  0x87, 0xa8, 0xec, 0x3b, 0x7f, 0x9d, 0x14, 0x59, 0xc9, 0xea, 0xda, 0xf9,
+  0x64, 0xfa, 0x3e, 0x34, 0x7e, 0x27, 0x91, 0x2a, 0xb6, 0x27, 0xd3, 0x8f,
+  0x50, 0x2d, 0xf5, 0x01, 0xdc, 0x2d, 0x1e, 0x77, 0xbc, 0x6b, 0x27, 0xf2,
+  0xa9, 0x8a, 0xc3, 0x50, 0x44, 0x04, 0xe4, 0xaf, 0x23, 0x01, 0x99, 0xed,
+  0x85, 0xff, 0xdf, 0x78, 0x78, 0xe7, 0x4e, 0x3f, 0x3d, 0x7f, 0x1d, 0xc7,
+  0xe7, 0xb2, 0x5f, 0xa6, 0x0e, 0xb7, 0xad, 0x3e, 0xbe, 0xe8, 0x36, 0xd0,
+  0x66, 0x1e, 0x89, 0x13, 0x27, 0xf8, 0x9f, 0xed, 0xa5, 0xa3, 0xfb, 0xc2,
+  0x1c, 0x04, 0x7b, 0x7c, 0xfd, 0x16, 0xe2, 0xd5, 0xce, 0x01, 0xce, 0x99,
+  0xda, 0xf3, 0x0f, 0x2e, 0xac, 0xae, 0x76, 0xe0, 0xc8, 0xee, 0xee, 0xa6,
+  0x6e, 0x27, 0x93, 0xda, 0xed, 0x75, 0x86, 0x91, 0x44, 0xc3, 0xee, 0x26,
+  0x7c, 0x0e, 0xf7, 0xd2, 0x71, 0x37, 0xeb, 0xe7, 0xe2, 0x2a, 0x65, 0x7f,
+  0xe0, 0x20, 0x53, 0x57, 0x8b, 0xac, 0x2d, 0xbf, 0xa9, 0x07, 0x0f, 0xa8,
+  0x2e, 0x30, 0xa0, 0xfd, 0x99, 0xc0, 0xd1, 0x17, 0xf5, 0x10, 0xfb, 0x94,
+  0xb8, 0x7d, 0xf5, 0xab, 0x02, 0x6a, 0x68, 0x51, 0xc9, 0x36, 0x9d, 0x7c,
+  0x7c, 0x1f, 0x96, 0x56, 0x2f, 0xcb, 0x77, 0x85, 0xdc, 0x54, 0xdf, 0xe8,
+  0xc3, 0xee, 0xac, 0xfb, 0xb3, 0x48, 0x90, 0x3a, 0x78, 0x77, 0xc0, 0x1d,
+  0x2b, 0xc8, 0x5f, 0xff, 0xfd, 0xdf, 0x3f, 0xaa, 0xbb, 0x13, 0xea, 0xff,
+  0x55, 0x60, 0xcf, 0x63, 0xf3, 0x6f, 0x1b, 0xe3, 0x42, 0xf3, 0x7f, 0xd4,
+  0xc9, 0x77, 0x7a, 0x08, 0x4e, 0xfe, 0x6c, 0x33, 0x7f, 0x9c, 0xd3, 0xfe,
+  0x1f, 0x67, 0xce, 0xe5, 0xa4, 0xba, 0x8a, 0x29, 0xa6, 0x3e, 0x1b, 0xfb,
+  0xfa, 0x32, 0xc3, 0x79, 0xbf, 0x9b, 0x5d, 0xce, 0x94, 0xc1, 0x36, 0xa4,
+  0xf0, 0x2a, 0x86, 0x3d, 0x4a, 0x37, 0x86, 0xc3, 0x31, 0x00, 0x9f, 0x7b,
+  0x0e, 0xff, 0x2f, 0xb1, 0x4c, 0x23, 0x86, 0x7d, 0x7e, 0x38, 0x7d, 0x38,
+  0xfd, 0xed, 0xc1, 0xeb, 0x07, 0x6f, 0xc1, 0x5f, 0xa8, 0x9a, 0xef, 0x04,
+  0x39, 0x61, 0xbc, 0x1b, 0x65, 0x1b, 0x8e, 0x8e, 0x62, 0x4d, 0x36, 0x38,
+  0xfc, 0x48, 0x54, 0x17, 0x42, 0xf5, 0x87, 0x23, 0xf2, 0x0e, 0xda, 0x7c,
+  0x6f, 0x73, 0x13, 0x8e, 0x51, 0x4f, 0x13, 0x6d, 0x59, 0x83, 0x7e, 0x39,
+  0x7d, 0x68, 0xec, 0x3e, 0x30, 0xd8, 0xc7, 0xa8, 0x6b, 0x22, 0xbb, 0x08,
+  0x52, 0x00, 0xe8, 0xf0, 0x29, 0xd9, 0x57, 0x0e, 0x7e, 0x48, 0x3f, 0xc8,
+  0x62, 0x74, 0xf0, 0x76, 0xbd, 0x58, 0x5e, 0xb7, 0x7b, 0x78, 0x97, 0x6c,
+  0x2e, 0xef, 0x21, 0x21, 0x3d, 0x50, 0xc2, 0x96, 0xf3, 0x19, 0xc3, 0x01,
+  0xce, 0x2e, 0x0f, 0x83, 0xba, 0x52, 0xb1, 0x04, 0xd8, 0x47, 0xc1, 0x3a,
+  0xda, 0xec, 0x0e, 0x5e, 0x1d, 0xa5, 0xf9, 0x5e, 0x7f, 0x9c, 0x47, 0x27,
+  0xe2, 0xfc, 0x5d, 0x58, 0xf4, 0xdd, 0x8d, 0xbe, 0x3a, 0xd1, 0xc5, 0x4c,
+  0xe8, 0x93, 0x7f, 0x96, 0xf3, 0x0f, 0xfb, 0x6b, 0xe7, 0x62, 0x3a, 0x9a,
+  0xce, 0xbe, 0x58, 0xbf, 0x0c, 0xb7, 0xdf, 0x5e, 0xf2, 0xfc, 0x03, 0x0b,
+  0x7a, 0x47, 0xe8, 0x60, 0x26, 0x6a, 0x7f, 0x2b, 0x13, 0xe8, 0x21, 0xba,
+  0xdb, 0xec, 0x77, 0xf3, 0xfc, 0xaa, 0xd0, 0x52, 0xd4, 0xc4, 0x53, 0x90,
+  0xcc, 0xb7, 0x86, 0xb5, 0x59, 0xd6, 0x54, 0x2e, 0x57, 0xa3, 0x5e, 0x53,
+  0x95, 0x91, 0xd9, 0xcf, 0xb6, 0xb2, 0xd8, 0xd8, 0x69, 0xc8, 0x3b, 0xae,
+  0x01, 0x74, 0x46, 0x90, 0x7c, 0x7c, 0x7c, 0x71, 0x27, 0xe7, 0xf4, 0x70,
+  0xe5, 0x93, 0x5a, 0xb2, 0xa4, 0x1f, 0x91, 0xdc, 0x1e, 0x20, 0x41, 0xd9,
+  0x16, 0x71, 0x17, 0x71, 0x2d, 0xb0, 0x4d, 0xbe, 0xbb, 0x72, 0x79, 0x85,
+  0x8c, 0xa6, 0xd3, 0xcf, 0x81, 0x6b, 0xfc, 0x18, 0xc5, 0xa7, 0xc0, 0x4e,
+  0xe9, 0x24, 0xd3, 0x9f, 0x0b, 0xf1, 0xea, 0x73, 0x54, 0xf2, 0x4b, 0x43,
+  0xa4, 0x5a, 0xf9, 0x04, 0xf0, 0x83, 0xe9, 0x7b, 0xc0, 0x68, 0x40, 0xe0,
+  0x22, 0xab, 0x24, 0x41, 0x0b, 0xf0, 0xa0, 0x10, 0x03, 0x0a, 0x5e, 0x95,
+  0x7d, 0xdc, 0xcb, 0x36, 0x60, 0xcd, 0xdb, 0x5e, 0xfe, 0x36, 0xab, 0xc2,
+  0x90, 0xf2, 0xf1, 0xab, 0x40, 0xf7, 0xd1, 0x38, 0xed, 0x1d, 0xd7, 0xd2,
+  0x59, 0x5f, 0x03, 0xa0, 0x68, 0x1e, 0x50, 0x5e, 0x14, 0x70, 0x3f, 0x1d,
+  0x0f, 0x97, 0xd4, 0x3e, 0xc2, 0x53, 0x7c, 0xb2, 0x7e, 0x2c, 0x6b, 0xea,
+  0xd0, 0x7b, 0x86, 0x86, 0x2d, 0xb8, 0x0c, 0x67, 0xc2, 0xb3, 0xac, 0xb4,
+  0xc3, 0x93, 0xe7, 0x02, 0x27, 0x8b, 0x45, 0x15, 0xb5, 0x1b, 0xb6, 0xf6,
+  0xfa, 0x27, 0x92, 0x95, 0xeb, 0x9a, 0x64, 0xd9, 0x6e, 0x88, 0x60, 0x47,
+  0x24, 0x9a, 0xda, 0x79, 0xcb, 0x73, 0x41, 0xc8, 0x4a, 0xf9, 0x8d, 0x6d,
+  0x57, 0x50, 0xc2, 0x5b, 0x47, 0xa2, 0x49, 0x90, 0x6d, 0x86, 0x75, 0x67,
+  0x94, 0x82, 0xd0, 0xb1, 0x99, 0x36, 0x4e, 0xde, 0xfa, 0xbf, 0xbb, 0xed,
+  0x1f, 0x9c, 0x6f, 0xff, 0xf7, 0xf9, 0xf6, 0x37, 0x6e, 0x9f, 0xbc, 0xd3,
+  0x4a, 0xea, 0xed, 0x7a, 0x33, 0x86, 0x38, 0x07, 0x1f, 0x90, 0xff, 0x9c,
+  0xe1, 0x28, 0x34, 0x9a, 0x61, 0x60, 0xe4, 0x7a, 0xc3, 0x41, 0xc5, 0x26,
+  0x8c, 0xb6, 0x19, 0x6f, 0xe8, 0xcc, 0x4d, 0xed, 0xf7, 0xbf, 0xf8, 0x1f,
+  0x89, 0x76, 0xac, 0xaa, 0x2d, 0x57, 0x04, 0x22, 0xa4, 0xaf, 0xcd, 0x61,
+  0x9f, 0x94, 0x6d, 0xb5, 0x3b, 0xa3, 0x34, 0x1d, 0x44, 0x3e, 0x9e, 0x54,
+  0xe7, 0x07, 0x4f, 0x65, 0x85, 0x6d, 0xc1, 0xc9, 0x99, 0xf6, 0xf4, 0xca,
+  0x22, 0x5e, 0xfb, 0x14, 0x16, 0x97, 0xe2, 0xe1, 0xff, 0xb5, 0xb4, 0xd8,
+  0xd2, 0xfa, 0x87, 0xe4, 0x32, 0x51, 0xff, 0xb0, 0xeb, 0x6a, 0x14, 0xfd,
+  0x74, 0x72, 0xc8, 0x43, 0xc0, 0x33, 0xcd, 0x4b, 0x61, 0x22, 0x70, 0x14,
+  0x88, 0xdb, 0x06, 0x36, 0xe2, 0x9e, 0x97, 0xba, 0x19, 0x7a, 0x6a, 0x58,
+  0x6f, 0x5b, 0xd6, 0x2b, 0x98, 0x51, 0xf9, 0x7b, 0xe2, 0x8f, 0xa0, 0x3f,
+  0xec, 0xf6, 0xc8, 0xbd, 0x41, 0x0b, 0xd6, 0x33, 0x09, 0xd5, 0x12, 0xf5,
+  0x5d, 0xd4, 0x17, 0x06, 0x10, 0x27, 0x8b, 0x54, 0x15, 0x6e, 0xce, 0xcf,
+  0xdf, 0xf5, 0xd2, 0xf3, 0xd7, 0xde, 0x42, 0xa8, 0x2b, 0xa9, 0xef, 0x09,
+  0x23, 0x7c, 0x7d, 0xb2, 0x7e, 0xc4, 0xb3, 0x59, 0x0e, 0x6c, 0x77, 0x68,
+  0xcd, 0xc4, 0x73, 0x8e, 0xde, 0x68, 0x35, 0x1d, 0xdd, 0x4d, 0x47, 0x49,
+  0xb7, 0x9f, 0xdd, 0x4d, 0x4f, 0xd4, 0xb8, 0xa2, 0xed, 0x39, 0x76, 0x86,
+  0xe1, 0xf5, 0x91, 0xf0, 0xec, 0xd9, 0x7e, 0x89, 0x5a, 0xc5, 0x99, 0xa2,
+  0xee, 0xb0, 0x7c, 0x9f, 0xd4, 0xa5, 0xdf, 0xed, 0x45, 0xf9, 0x45, 0x3d,
+  0xa0, 0x26, 0xe4, 0xa0, 0x5c, 0x2a, 0x3b, 0xaf, 0x43, 0xe2, 0x66, 0x6f,
+  0xbc, 0x1c, 0xf4, 0x4d, 0x10, 0x43, 0x0a, 0x11, 0x2a, 0xe8, 0x18, 0xe1,
+  0x29, 0xd8, 0x94, 0x73, 0x04, 0x29, 0x15, 0x85, 0x6b, 0x84, 0xd4, 0xce,
+  0x4a, 0x3d, 0x63, 0x74, 0xb5, 0x39, 0xd8, 0x1c, 0xc9, 0x4b, 0x82, 0xb9,
+  0x44, 0x04, 0xd5, 0xc8, 0xf1, 0xfb, 0x97, 0xf0, 0x3f, 0x03, 0xa9, 0xf5,
+  0x47, 0xe6, 0xf6, 0xf5, 0x3e, 0xad, 0x45, 0x90, 0x55, 0x0f, 0x7e, 0xe8,
+  0xfb, 0x01, 0xa2, 0x83, 0x1b, 0x2c, 0x4f, 0xc1, 0xdc, 0xed, 0x7b, 0xd8,
+  0x24, 0x6a, 0x36, 0x20, 0xa4, 0xed, 0xa1, 0x45, 0x1d, 0x04, 0x83, 0x3a,
+  0x76, 0xda, 0x68, 0xbe, 0x7b, 0xf1, 0x83, 0x8a, 0x4e, 0x83, 0x1a, 0xa9,
+  0x40, 0xb3, 0x02, 0xff, 0x65, 0xdc, 0x79, 0xbe, 0x6e, 0xfb, 0xec, 0x99,
+  0xa0, 0x87, 0xb6, 0xb5, 0x03, 0x02, 0x56, 0x00, 0x0f, 0xd0, 0x0b, 0x2f,
+  0x70, 0x8b, 0x69, 0x4f, 0x5a, 0x22, 0xaf, 0x74, 0xc7, 0xdb, 0x9d, 0x9d,
+  0x6c, 0xd0, 0x08, 0x38, 0x79, 0xff, 0xb1, 0x78, 0xbb, 0x3b, 0xdc, 0x6f,
+  0x2c, 0x74, 0x5e, 0x6c, 0x05, 0x70, 0x6b, 0x27, 0x68, 0x81, 0x42, 0x67,
+  0xdc, 0xf9, 0xe6, 0x31, 0x7a, 0x5d, 0xbb, 0x43, 0x30, 0x26, 0x01, 0x60,
+  0xea, 0xea, 0x5b, 0xe5, 0xc6, 0x60, 0x76, 0xae, 0xed, 0x28, 0x2e, 0x41,
+  0xb5, 0xc4, 0x50, 0x9b, 0x64, 0x64, 0xd2, 0x1c, 0xa1, 0xdb, 0xeb, 0x5d,
+  0xc2, 0x95, 0x8b, 0x0a, 0xf4, 0x74, 0x90, 0xc2, 0x8a, 0xb8, 0x78, 0xed,
+  0x8a, 0xdc, 0xc3, 0xaf, 0x00, 0x0f, 0x87, 0x2b, 0x04, 0x9a, 0xf3, 0xc5,
+  0x34, 0x36, 0x34, 0xad, 0x89, 0x39, 0x28, 0x18, 0x8e, 0xd7, 0x76, 0x7d,
+  0x73, 0xb8, 0xb3, 0xdb, 0x4f, 0x1d, 0xdb, 0x68, 0x00, 0x61, 0x8b, 0xa3,
+  0xbb, 0x38, 0x7b, 0xaa, 0x33, 0xe3, 0x55, 0x5e, 0xc5, 0xa9, 0x3c, 0x74,
+  0x20, 0x8c, 0xd2, 0x3f, 0xdb, 0x03, 0xa1, 0xe4, 0x7c, 0xbf, 0x8f, 0x3e,
+  0x35, 0x9e, 0x8e, 0x5b, 0xc9, 0x6c, 0xfe, 0x25, 0x4e, 0x80, 0xf5, 0x49,
+  0x85, 0xce, 0xc8, 0x2e, 0x79, 0x42, 0xa7, 0x50, 0x71, 0xc7, 0xdc, 0x57,
+  0x32, 0xa0, 0xab, 0xa3, 0x65, 0xd5, 0x8c, 0xf8, 0x83, 0x4a, 0x17, 0x6e,
+  0x1f, 0x35, 0x3c, 0x7f, 0x8b, 0x50, 0x2b, 0x99, 0x8e, 0xf2, 0x29, 0x39,
+  0xbe, 0x69, 0xa9, 0x48, 0xa1, 0xe8, 0xf4, 0x1c, 0xcb, 0x14, 0x55, 0x43,
+  0x22, 0x34, 0x55, 0xbe, 0x08, 0x60, 0x4d, 0x99, 0xed, 0x09, 0x8b, 0x7f,
+  0xcd, 0x45, 0x27, 0x6d, 0x38, 0xe8, 0x67, 0x83, 0x34, 0xba, 0xe1, 0x4e,
+  0x48, 0x5a, 0x07, 0xe3, 0x25, 0x4e, 0x14, 0xd2, 0x9a, 0x4d, 0xb7, 0x35,
+  0xad, 0x82, 0x67, 0xd9, 0xe8, 0x89, 0x50, 0x96, 0xeb, 0x70, 0xbc, 0xdd,
+  0x1c, 0xe0, 0x32, 0xc2, 0xf3, 0xce, 0x84, 0xa3, 0x44, 0x91, 0xdf, 0x48,
+  0xb7, 0x86, 0xa3, 0x74, 0x6f, 0x10, 0x5b, 0x79, 0x81, 0xe8, 0x18, 0x3c,
+  0xc3, 0x96, 0x8f, 0x91, 0x59, 0x0a, 0x69, 0x7b, 0xb8, 0x7b, 0x3d, 0x1d,
+  0x65, 0xc3, 0x5e, 0xb6, 0x79, 0x1d, 0x50, 0x6f, 0xb0, 0x93, 0xcc, 0x84,
+  0x72, 0x48, 0x77, 0xfc, 0x4a, 0x91, 0x1a, 0x22, 0xd0, 0x22, 0x38, 0x85,
+  0x9a, 0x8e, 0xd2, 0x49, 0x50, 0x8b, 0xcf, 0x1a, 0xc5, 0xa5, 0xf0, 0xd2,
+  0x8b, 0x87, 0x0a, 0x95, 0xd8, 0x76, 0x4b, 0x78, 0xbc, 0x70, 0x60, 0xc8,
+  0xf2, 0x99, 0x7b, 0x37, 0x53, 0x51, 0x44, 0xc4, 0x30, 0x21, 0x8b, 0xe8,
+  0xc5, 0x24, 0x2d, 0x81, 0x1c, 0x88, 0xa0, 0x42, 0xab, 0x19, 0xc1, 0x4d,
+  0xba, 0x43, 0xc8, 0xa5, 0x7e, 0x2e, 0xb0, 0xd2, 0x97, 0x78, 0x5c, 0xd0,
+  0x2b, 0xd7, 0x56, 0x2f, 0x5d, 0xd4, 0x53, 0x23, 0x79, 0x94, 0x16, 0x3b,
+  0x70, 0xf7, 0xaf, 0x75, 0x37, 0x1a, 0xe3, 0xee, 0xc6, 0x4a, 0x8f, 0x09,
+  0x0a, 0x61, 0x9b, 0x14, 0x6c, 0xfc, 0x46, 0xbd, 0x03, 0x6d, 0xdb, 0x9b,
+  0xe2, 0x00, 0xac, 0x1b, 0xe7, 0x7a, 0x78, 0x6a, 0x73, 0x49, 0x78, 0x20,
+  0x6e, 0xc9, 0xb8, 0x03, 0x00, 0xbd, 0x9d, 0xe1, 0xdd, 0xb4, 0x51, 0xef,
+  0x42, 0xbf, 0x77, 0x53, 0xa3, 0x95, 0x37, 0xcc, 0xa2, 0xa4, 0xcb, 0xe3,
+  0xe9, 0x6a, 0xae, 0xf8, 0x92, 0x2f, 0xc8, 0xc0, 0x60, 0xc1, 0x2e, 0xf6,
+  0x01, 0x09, 0x49, 0x56, 0x5e, 0x0d, 0xd6, 0xba, 0xa3, 0x3b, 0x34, 0xa7,
+  0x91, 0x4f, 0xe6, 0x8e, 0x7e, 0x0e, 0x50, 0xa8, 0x9e, 0xbc, 0x25, 0x5e,
+  0x24, 0x2f, 0x18, 0xdb, 0x29, 0x0d, 0x91, 0x56, 0x82, 0x05, 0x39, 0x21,
+  0xb4, 0x89, 0x5e, 0x2e, 0x23, 0xdf, 0xcf, 0x57, 0xf7, 0x36, 0xd0, 0xe3,
+  0x6b, 0x23, 0x6d, 0x5c, 0xb8, 0x76, 0x75, 0xed, 0xc6, 0xb5, 0x57, 0x5e,
+  0x5d, 0xbb, 0x76, 0x7d, 0xe5, 0xc2, 0x6a, 0xd0, 0x46, 0xf2, 0xdc, 0x73,
+  0xcf, 0xed, 0xe7, 0x37, 0x07, 0x79, 0x85, 0x6f, 0xe6, 0xc2, 0x67, 0xaf,
+  0x92, 0xa4, 0xf7, 0xbb, 0xa3, 0x01, 0x17, 0xa4, 0xb3, 0x3c, 0x19, 0x0c,
+  0xc7, 0x26, 0xf8, 0xac, 0x05, 0x57, 0x8c, 0x01, 0x3e, 0xc9, 0xd3, 0x41,
+  0x0f, 0x27, 0x53, 0xf8, 0xbb, 0x75, 0xea, 0xb6, 0x90, 0xc7, 0xc5, 0x65,
+  0xdb, 0x16, 0x6f, 0x79, 0x06, 0x93, 0x15, 0x7f, 0x56, 0x1f, 0x06, 0x19,
+  0xdf, 0x08, 0xd0, 0xd6, 0xb2, 0x71, 0xbf, 0xd0, 0x07, 0x82, 0xf4, 0x40,
+  0xd8, 0xb2, 0x3d, 0xc6, 0xa6, 0x75, 0xcb, 0xbd, 0xb0, 0xbb, 0x7b, 0x39,
+  0x4b, 0xfb, 0xe4, 0x4c, 0x16, 0x05, 0xd0, 0xdd, 0x6d, 0x6f, 0x51, 0x23,
+  0xfb, 0x53, 0x18, 0x73, 0xf9, 0xb7, 0xd0, 0x88, 0x7d, 0x4c, 0x5f, 0x6b,
+  0xa4, 0x3b, 0x19, 0xd0, 0x73, 0xb4, 0x26, 0x1c, 0x70, 0x89, 0x0a, 0xe7,
+  0x92, 0x3a, 0x1a, 0x21, 0x13, 0x72, 0xeb, 0x68, 0x9c, 0xbf, 0xde, 0xac,
+  0x03, 0x6f, 0xe0, 0x8f, 0x56, 0xd7, 0xce, 0x37, 0x55, 0x14, 0x99, 0x42,
+  0x9d, 0x2d, 0x65, 0x41, 0xe5, 0x46, 0x7d, 0x3b, 0xeb, 0xf5, 0x48, 0x4a,
+  0x38, 0x81, 0x60, 0x25, 0xd6, 0x1a, 0xdf, 0xa2, 0x0f, 0x64, 0xfb, 0x39,
+  0x31, 0x85, 0x7a, 0xfa, 0x60, 0x8f, 0x98, 0x68, 0x57, 0x39, 0x7f, 0x26,
+  0x82, 0x54, 0xa9, 0xd5, 0x08, 0x51, 0xd9, 0x88, 0x74, 0x40, 0xd2, 0x89,
+  0x7a, 0x90, 0x01, 0x8b, 0x90, 0x26, 0xf8, 0x3b, 0x78, 0xb6, 0x62, 0x7c,
+  0x01, 0x3d, 0xbc, 0x4a, 0xee, 0xe2, 0x12, 0x44, 0xcb, 0x76, 0x95, 0x69,
+  0x25, 0x35, 0x54, 0xaf, 0xc1, 0x85, 0x94, 0x0e, 0x12, 0xf8, 0x99, 0x28,
+  0xfd, 0x81, 0x67, 0xd8, 0x37, 0x5d, 0xd0, 0x58, 0x0b, 0x23, 0x75, 0xc5,
+  0xc1, 0x30, 0xe7, 0x98, 0xf7, 0x2f, 0x4a, 0x7f, 0xdf, 0x39, 0xcd, 0x30,
+  0x80, 0xf2, 0x34, 0x6c, 0x7a, 0x5d, 0x17, 0xbc, 0x1e, 0x11, 0x5a, 0x62,
+  0xbd, 0x89, 0xa7, 0xbb, 0x40, 0x4e, 0x68, 0x04, 0x6f, 0xea, 0xb2, 0xdd,
+  0x5e, 0x9e, 0x22, 0xa3, 0xc8, 0x36, 0x51, 0x3f, 0x2e, 0xd0, 0x57, 0xcf,
+  0xaf, 0x8f, 0x86, 0xf7, 0xee, 0x5b, 0x0f, 0x77, 0xc5, 0x93, 0x7a, 0x7d,
+  0x4e, 0x79, 0x46, 0x4b, 0x86, 0x83, 0xdb, 0xab, 0x41, 0x8e, 0x5d, 0xf9,
+  0x78, 0x04, 0xcc, 0x24, 0xdb, 0xba, 0xdf, 0x60, 0xe8, 0x36, 0x9b, 0xb6,
+  0x7b, 0x9d, 0xc1, 0xf6, 0xf2, 0x68, 0xb8, 0xb3, 0x0a, 0x7b, 0xb4, 0x81,
+  0xf8, 0xb6, 0x92, 0x0d, 0xf1, 0xcf, 0x26, 0x5c, 0xa4, 0x07, 0x69, 0x5f,
+  0x9e, 0x1a, 0xd2, 0x79, 0x71, 0xb0, 0x39, 0xba, 0xaf, 0x3d, 0x4a, 0x71,
+  0x5b, 0x9b, 0x09, 0xb8, 0xa4, 0xdf, 0xdd, 0x42, 0x00, 0xb7, 0xe5, 0xba,
+  0x7b, 0xca, 0xc4, 0xcd, 0x35, 0x59, 0x05, 0xde, 0x4b, 0x12, 0xfd, 0x08,
+  0xa5, 0xe5, 0xa0, 0x96, 0xd4, 0x1f, 0xcf, 0x98, 0xfe, 0x73, 0xd2, 0x87,
+  0xc4, 0x90, 0x11, 0xce, 0x0b, 0xf6, 0x0b, 0x85, 0xd8, 0x1a, 0xc6, 0x73,
+  0xd6, 0x42, 0x2f, 0x2e, 0x5d, 0xbd, 0x40, 0xbe, 0xea, 0xaf, 0x5e, 0xbd,
+  0x76, 0xf5, 0x52, 0x4d, 0xb1, 0x45, 0x2f, 0x3a, 0x3c, 0xa7, 0x75, 0x3d,
+  0x57, 0x78, 0xcb, 0x39, 0x92, 0xaf, 0x0a, 0x69, 0xdd, 0xb9, 0x57, 0x4a,
+  0xd8, 0x27, 0x65, 0xee, 0xf8, 0x1d, 0x52, 0x8e, 0xc7, 0x19, 0xa5, 0xb2,
+  0x83, 0x49, 0x81, 0x63, 0x89, 0x83, 0x52, 0xde, 0xdd, 0x4a, 0x49, 0xed,
+  0x5f, 0xae, 0xe2, 0x77, 0x47, 0xa3, 0x16, 0xe9, 0xca, 0x60, 0x77, 0xaf,
+  0x48, 0x59, 0xb9, 0xae, 0x1a, 0xb6, 0x61, 0x06, 0xa8, 0xbb, 0x89, 0xeb,
+  0x17, 0x64, 0x81, 0xb2, 0x05, 0x04, 0xeb, 0x15, 0x88, 0x5a, 0x9b, 0x7b,
+  0x8e, 0x46, 0xda, 0x6e, 0xe0, 0xc8, 0x3b, 0x78, 0x33, 0xcc, 0x46, 0x69,
+  0x4f, 0x1c, 0x4e, 0xf5, 0x80, 0xff, 0x83, 0x92, 0x71, 0x93, 0x17, 0xe5,
+  0x75, 0xca, 0xd1, 0x7f, 0x01, 0xab, 0x56, 0xe7, 0x41, 0xae, 0xfd, 0xe6,
+  0x8e, 0x6b, 0x15, 0xce, 0x19, 0xe7, 0xf0, 0x3e, 0x89, 0x1c, 0x37, 0xe0,
+  0xd6, 0x36, 0x8c, 0x43, 0xaa, 0x67, 0x38, 0xc8, 0x5b, 0x18, 0x4b, 0x71,
+  0xa6, 0x26, 0x05, 0xbd, 0xb6, 0x44, 0xa3, 0x76, 0x7b, 0x49, 0x8a, 0x0e,
+  0x62, 0x98, 0xd2, 0x63, 0x5d, 0x34, 0x92, 0x43, 0x90, 0xc7, 0x88, 0xdd,
+  0xdb, 0x39, 0xfb, 0xb7, 0xb8, 0x06, 0xe4, 0x63, 0xb6, 0x10, 0xd1, 0xe9,
+  0x19, 0x24, 0x13, 0x1c, 0x45, 0x8e, 0xfc, 0x02, 0xa1, 0x2c, 0x25, 0xb5,
+  0x9a, 0xe6, 0x0b, 0x27, 0xdc, 0x4d, 0xc4, 0xd2, 0x18, 0xc8, 0x18, 0x97,
+  0xe1, 0x68, 0xa7, 0x74, 0xe5, 0x63, 0x23, 0x8e, 0x3c, 0xfe, 0x96, 0x3c,
+  0x15, 0x03, 0x74, 0x2e, 0xcb, 0x9f, 0x0d, 0x7c, 0xde, 0xac, 0xc8, 0x7e,
+  0x2d, 0x6f, 0x53, 0xc9, 0x4c, 0x87, 0xa3, 0xec, 0x4e, 0x36, 0xe8, 0xf6,
+  0x57, 0x1d, 0x4e, 0x2c, 0xf8, 0xb0, 0xea, 0x15, 0xd7, 0x31, 0x48, 0x36,
+  0xf0, 0xac, 0xde, 0x14, 0xef, 0x37, 0x42, 0x0d, 0x36, 0x78, 0x0b, 0xcd,
+  0xa6, 0xed, 0x36, 0xf2, 0xb1, 0x6a, 0x65, 0xd8, 0xbb, 0xdd, 0x4c, 0x3d,
+  0x57, 0xed, 0x6c, 0xf6, 0x6e, 0x35, 0x65, 0xaf, 0x40, 0xa2, 0x26, 0x21,
+  0x7b, 0x38, 0xa8, 0x7b, 0xdc, 0xdf, 0xfd, 0x86, 0x9e, 0x7b, 0x1f, 0xec,
+  0x86, 0x5a, 0xef, 0xca, 0xa6, 0x68, 0x4c, 0x91, 0xed, 0x50, 0x6a, 0x92,
+  0x47, 0x8a, 0x3e, 0x43, 0x18, 0x0b, 0xa5, 0x6f, 0x19, 0x62, 0x6a, 0x23,
+  0xf3, 0xd7, 0xd9, 0x2e, 0xde, 0x98, 0xad, 0x8e, 0xb2, 0x5d, 0xd5, 0xcb,
+  0xb2, 0xd7, 0xfc, 0x0e, 0xcc, 0xdd, 0x3e, 0xf1, 0x38, 0xfb, 0x1b, 0xf9,
+  0x3c, 0xfe, 0x21, 0x5c, 0x0f, 0x06, 0x14, 0xb1, 0xe0, 0xcc, 0x26, 0x3d,
+  0x8e, 0x7f, 0xd6, 0x1b, 0xe4, 0xde, 0x37, 0xf0, 0x8c, 0x7f, 0x30, 0x99,
+  0x59, 0x72, 0xb1, 0x6e, 0xb6, 0x9b, 0xe8, 0xe9, 0xdf, 0xbf, 0x04, 0x67,
+  0x1f, 0xe3, 0x27, 0x4f, 0xe7, 0x64, 0x2b, 0xda, 0x95, 0xe1, 0xd3, 0x4f,
+  0x6f, 0xf1, 0x2c, 0xbf, 0x8a, 0x71, 0x8c, 0xb8, 0x4a, 0x50, 0xd4, 0xa9,
+  0xdb, 0x59, 0x34, 0x1c, 0x4f, 0x6f, 0xeb, 0x77, 0x67, 0x2b, 0xeb, 0x8f,
+  0xd3, 0x51, 0x83, 0xa8, 0x7f, 0x16, 0xc7, 0x23, 0xf8, 0x05, 0x0a, 0x02,
+  0x34, 0x60, 0xc3, 0x82, 0xcb, 0x1d, 0xc1, 0x63, 0x1a, 0xc4, 0xe3, 0x3b,
+  0x98, 0xa3, 0x47, 0xea, 0x60, 0x38, 0x48, 0xeb, 0xc7, 0x7d, 0x80, 0x47,
+  0xce, 0xe5, 0x4f, 0x75, 0x47, 0xda, 0x03, 0xbf, 0x20, 0x75, 0x8e, 0xbb,
+  0xa2, 0x7a, 0x29, 0xea, 0xec, 0xdd, 0x43, 0xaa, 0x78, 0x91, 0xda, 0x3c,
+  0xd2, 0x82, 0xe0, 0x49, 0xa9, 0xb8, 0xe6, 0x5d, 0x19, 0x1c, 0x7d, 0x04,
+  0x8c, 0x63, 0x03, 0xef, 0xf4, 0xf8, 0x96, 0x71, 0x70, 0x09, 0x3f, 0x98,
+  0x9b, 0xb3, 0xcd, 0x45, 0x13, 0xd3, 0x29, 0x71, 0x62, 0x7f, 0x76, 0xd4,
+  0x9a, 0x16, 0xaf, 0xcd, 0xc6, 0x97, 0x07, 0xa4, 0x60, 0xcd, 0xf1, 0xcf,
+  0x54, 0x03, 0xf8, 0x70, 0x9e, 0x9f, 0xd8, 0xb3, 0x09, 0x4e, 0xc7, 0x24,
+  0x32, 0x59, 0x87, 0xfa, 0x75, 0xd9, 0x08, 0x00, 0xd9, 0x80, 0xcf, 0x39,
+  0x42, 0x11, 0x45, 0x3c, 0xe1, 0x15, 0xbb, 0xbe, 0x7c, 0x84, 0x2b, 0xd1,
+  0xb1, 0x5d, 0x00, 0xb0, 0xc5, 0x09, 0x67, 0x0c, 0x1d, 0x58, 0x9a, 0x3b,
+  0x8d, 0xa6, 0x9e, 0xe0, 0xe3, 0xd9, 0xe1, 0x47, 0xdb, 0xb5, 0x73, 0x8e,
+  0xf3, 0xb7, 0xcb, 0x24, 0xce, 0x28, 0x36, 0x81, 0x6b, 0xe3, 0x44, 0xb0,
+  0x91, 0x61, 0xef, 0x15, 0x65, 0xf7, 0x52, 0x97, 0xf0, 0xc8, 0xad, 0xc9,
+  0x71, 0xf6, 0x8f, 0x08, 0xd4, 0x85, 0xc2, 0x74, 0xa1, 0x20, 0x4d, 0xb6,
+  0x65, 0x23, 0x45, 0xcf, 0x19, 0x33, 0xb9, 0x9a, 0x41, 0x61, 0xb2, 0x16,
+  0x57, 0xf0, 0x9a, 0x5e, 0x9a, 0x4a, 0x00, 0xa7, 0x80, 0xd6, 0x3c, 0x85,
+  0x59, 0x87, 0xbf, 0x95, 0xc4, 0xea, 0x1a, 0x4b, 0xad, 0x3d, 0x1d, 0x1d,
+  0x46, 0x0c, 0x4f, 0xa5, 0x5f, 0x75, 0x50, 0xad, 0xf2, 0x89, 0x7f, 0x4d,
+  0x60, 0xcb, 0x87, 0xe0, 0x19, 0x4e, 0x66, 0xc3, 0xda, 0xed, 0x92, 0x78,
+  0x3d, 0xec, 0xa5, 0xde, 0x7a, 0x12, 0x78, 0x48, 0x87, 0x83, 0x3a, 0xb3,
+  0x66, 0x70, 0x80, 0x66, 0x6e, 0xf8, 0x53, 0x85, 0x18, 0x33, 0x90, 0x30,
+  0x3e, 0x17, 0x77, 0xd6, 0xaa, 0xea, 0xa7, 0x75, 0x04, 0xaf, 0xac, 0xa8,
+  0x0f, 0x56, 0xa1, 0xbf, 0x95, 0xf4, 0x42, 0xc5, 0x30, 0x80, 0xe5, 0xb9,
+  0x52, 0xdf, 0xaa, 0x0d, 0x60, 0x57, 0x35, 0x87, 0xb9, 0xe3, 0x40, 0x43,
+  0x02, 0x7e, 0x8d, 0xdc, 0x47, 0x8d, 0x77, 0x6b, 0x2d, 0xac, 0x64, 0xf1,
+  0x75, 0x2c, 0x61, 0x8d, 0x8a, 0x11, 0xcd, 0x1d, 0x06, 0x55, 0x45, 0x69,
+  0xa2, 0x70, 0x74, 0x4f, 0xcb, 0xd8, 0x36, 0x91, 0x6b, 0x83, 0xdf, 0x29,
+  0xbf, 0x88, 0x63, 0xc5, 0x1c, 0x09, 0xf7, 0x32, 0x9a, 0xa6, 0x4b, 0x32,
+  0x4b, 0xd6, 0x51, 0x96, 0x3a, 0x2d, 0x74, 0x0e, 0x4f, 0xab, 0x7d, 0xf8,
+  0x43, 0x6b, 0xa1, 0xb3, 0xd9, 0x76, 0xf6, 0x9c, 0x1e, 0x10, 0x25, 0xc3,
+  0x52, 0x6e, 0x4b, 0x20, 0x9a, 0x67, 0x77, 0x45, 0x6f, 0xd6, 0xe6, 0xe1,
+  0x3e, 0x90, 0x75, 0x1b, 0x35, 0xaf, 0xad, 0xbd, 0xf2, 0x80, 0x11, 0xf4,
+  0x62, 0x6d, 0xb6, 0x60, 0x35, 0xaf, 0x66, 0x3f, 0x20, 0xa0, 0x0b, 0x8b,
+  0xbb, 0xf7, 0x62, 0xed, 0x76, 0xba, 0x23, 0xb8, 0x5c, 0xae, 0x0d, 0xf1,
+  0xa2, 0x53, 0x7f, 0x31, 0xd4, 0xce, 0xde, 0x1b, 0xda, 0xaf, 0x7f, 0x2e,
+  0x89, 0x13, 0xbc, 0xbb, 0x0b, 0x47, 0x6b, 0xef, 0xc2, 0x76, 0xd6, 0xef,
+  0xd9, 0xec, 0x83, 0x3e, 0x3b, 0x94, 0x63, 0x2a, 0x8b, 0x27, 0x38, 0x06,
+  0xdf, 0xd2, 0x89, 0x2d, 0x93, 0x0a, 0x85, 0xbb, 0x3c, 0xa4, 0x2e, 0x8a,
+  0xa3, 0xaf, 0x91, 0x0a, 0xd0, 0xad, 0xc4, 0xbe, 0xf8, 0xf8, 0xc1, 0x69,
+  0x24, 0x42, 0xd8, 0x4f, 0xf4, 0xf5, 0xc1, 0xb3, 0x38, 0x7a, 0xa2, 0x73,
+  0x44, 0x02, 0x4d, 0xf5, 0xea, 0x08, 0xab, 0x37, 0x96, 0xe7, 0x8e, 0xf7,
+  0x6e, 0x61, 0xcb, 0x1e, 0xe9, 0x4c, 0x42, 0xc7, 0xf1, 0x89, 0x1d, 0xc7,
+  0xa3, 0x34, 0x54, 0x4d, 0x0a, 0x84, 0x8f, 0x80, 0x9d, 0xad, 0xea, 0xdd,
+  0xaa, 0xf4, 0x56, 0x54, 0x78, 0x1d, 0x72, 0xa2, 0xe2, 0x9c, 0x25, 0x28,
+  0x75, 0x11, 0xd2, 0x86, 0xd4, 0x20, 0x0d, 0xd9, 0xc6, 0xf0, 0x9e, 0xbb,
+  0x06, 0x8f, 0xf7, 0xf2, 0x6d, 0x8e, 0x57, 0xd3, 0x75, 0xf9, 0x4a, 0x12,
+  0xed, 0xdb, 0x99, 0x6b, 0x86, 0x4b, 0x1c, 0x48, 0x1e, 0x3d, 0xd5, 0xa0,
+  0x74, 0xdc, 0xf0, 0xb9, 0xa4, 0x7e, 0x67, 0x94, 0xf5, 0xc8, 0xaa, 0xc6,
+  0x68, 0x1d, 0xa6, 0x10, 0xa9, 0x84, 0x08, 0xf2, 0x33, 0xa5, 0xce, 0xae,
+  0xee, 0xb6, 0x9c, 0x32, 0xd4, 0xd6, 0x55, 0xe1, 0x1a, 0x00, 0x95, 0x08,
+  0x22, 0x56, 0x7b, 0x09, 0x45, 0x28, 0xf8, 0x86, 0x2c, 0x4a, 0x4c, 0x70,
+  0x3f, 0x4c, 0xb4, 0x5a, 0x0d, 0x81, 0x0c, 0x2c, 0x89, 0xe7, 0xf8, 0x02,
+  0xd1, 0x8a, 0xee, 0xf5, 0xfa, 0x4e, 0x8f, 0x30, 0xeb, 0xe2, 0xe2, 0xee,
+  0x1a, 0xa9, 0x51, 0xcb, 0x62, 0x05, 0x81, 0xaa, 0x64, 0x02, 0xc4, 0x89,
+  0xf5, 0x39, 0x0d, 0x64, 0x27, 0x60, 0x17, 0x85, 0x5f, 0xaf, 0x77, 0x46,
+  0xff, 0x01, 0xeb, 0xac, 0xd5, 0x00, 0x8c, 0xef, 0x82, 0xa7, 0x37, 0x46,
+  0x22, 0x29, 0x02, 0x59, 0xea, 0xcf, 0x97, 0x87, 0xc3, 0x7e, 0x0a, 0x2b,
+  0xa4, 0xaa, 0x21, 0xbf, 0x69, 0x04, 0x52, 0xfc, 0xbc, 0xc8, 0xfc, 0x2e,
+  0x34, 0xc9, 0xe2, 0xba, 0x2e, 0xbe, 0xda, 0xb9, 0x78, 0x75, 0xb5, 0xe0,
+  0x1b, 0x7c, 0x6d, 0x7f, 0xa0, 0x24, 0x88, 0xb2, 0xae, 0x8c, 0xaa, 0x99,
+  0x7f, 0xad, 0x18, 0x4d, 0xd9, 0xd7, 0xa8, 0xb2, 0xe5, 0xdf, 0x75, 0xf7,
+  0xc6, 0xc3, 0x1b, 0xc6, 0x73, 0x2a, 0xfe, 0x29, 0xb4, 0x6b, 0x6b, 0x07,
+  0x29, 0x43, 0x23, 0x29, 0x91, 0x7b, 0xf3, 0xbe, 0x14, 0x78, 0xd6, 0xd2,
+  0xd9, 0x26, 0x5e, 0x19, 0xde, 0xc9, 0x0b, 0x3a, 0x4b, 0x07, 0x18, 0x95,
+  0xda, 0xee, 0x03, 0x97, 0xa3, 0x84, 0xc1, 0xaa, 0xb3, 0x2a, 0x92, 0x3c,
+  0x5f, 0x1a, 0x4d, 0xe5, 0x28, 0xa0, 0x37, 0x90, 0xaf, 0xb8, 0xd4, 0xd1,
+  0xae, 0x46, 0x4b, 0x29, 0x93, 0x92, 0xc1, 0xdb, 0x42, 0xc7, 0x09, 0xd4,
+  0x78, 0xb6, 0x75, 0x2a, 0x0d, 0xcd, 0xdd, 0xf0, 0x3b, 0xe1, 0x38, 0xf1,
+  0xad, 0xb5, 0x2b, 0xaf, 0xe0, 0x81, 0x58, 0xb7, 0x64, 0x83, 0x13, 0x3c,
+  0xb3, 0x86, 0x13, 0x0d, 0x4b, 0x22, 0xc2, 0xbc, 0xe5, 0xa9, 0xe3, 0x41,
+  0x3b, 0xdd, 0xcf, 0xce, 0x5e, 0x1d, 0x0a, 0xd5, 0xad, 0xfe, 0xfe, 0xf4,
+  0x49, 0x78, 0x5a, 0x5f, 0x2e, 0x13, 0xb0, 0x74, 0x77, 0xca, 0xf1, 0x09,
+  0x87, 0x1f, 0x4c, 0xc9, 0xa6, 0x6f, 0x33, 0x4a, 0x0d, 0x3c, 0x9b, 0x85,
+  0x11, 0xf7, 0x70, 0x81, 0xf4, 0xdf, 0xcf, 0xf8, 0x27, 0xd8, 0xd8, 0x16,
+  0xfd, 0x2d, 0x56, 0xe0, 0x34, 0xb4, 0xf8, 0x82, 0xc1, 0x2f, 0xd2, 0x8a,
+  0x69, 0x16, 0xc5, 0xdf, 0x91, 0x76, 0x96, 0x32, 0x51, 0xfd, 0xe2, 0x6e,
+  0x51, 0xbc, 0xb1, 0xd4, 0xb1, 0x53, 0x53, 0xf1, 0xf7, 0x39, 0xa9, 0x6d,
+  0xc7, 0x53, 0x8a, 0xac, 0x2c, 0x75, 0xf7, 0x5b, 0x3e, 0x87, 0xeb, 0xcc,
+  0x08, 0x7a, 0x1a, 0x6e, 0x42, 0x09, 0x0d, 0xfe, 0x4c, 0x4d, 0x0d, 0x5b,
+  0xa4, 0x85, 0xab, 0x25, 0xe8, 0x25, 0x99, 0x6d, 0xbe, 0x76, 0xa6, 0x16,
+  0x14, 0xca, 0xc7, 0xdb, 0x59, 0x0e, 0xd4, 0x7f, 0xfe, 0x81, 0x22, 0xc1,
+  0xa4, 0xde, 0xac, 0x9d, 0xb5, 0x3c, 0xb4, 0x42, 0xc0, 0x77, 0xba, 0xd9,
+  0xa0, 0x4d, 0xa7, 0xd2, 0x59, 0xc7, 0xa9, 0xf6, 0x34, 0xf1, 0x7b, 0x8a,
+  0xec, 0x38, 0x53, 0x1b, 0x21, 0x77, 0xae, 0x25, 0x61, 0xe6, 0xef, 0xc2,
+  0x14, 0x8d, 0xc3, 0x5e, 0xbe, 0x02, 0xbf, 0x2c, 0xbf, 0x20, 0x60, 0x20,
+  0xa9, 0xd4, 0xc9, 0x41, 0x8a, 0xcd, 0x49, 0xe2, 0xe1, 0x11, 0xc0, 0x9a,
+  0x3c, 0xa3, 0x3c, 0x8c, 0xa1, 0x2d, 0xec, 0xfc, 0xe1, 0xe0, 0xce, 0x59,
+  0x46, 0x85, 0xd3, 0x27, 0xe5, 0xb3, 0xb9, 0x0a, 0xa8, 0x9c, 0xce, 0x77,
+  0xbb, 0x03, 0xd5, 0x99, 0x1a, 0xe6, 0x46, 0xb7, 0x77, 0x07, 0x3a, 0x6b,
+  0xc8, 0x76, 0x4d, 0x80, 0x08, 0xad, 0xce, 0x4a, 0x7c, 0x03, 0x38, 0x20,
+  0x0c, 0x94, 0x99, 0x1c, 0x9d, 0x8e, 0xb8, 0xa8, 0x7b, 0xd4, 0x12, 0x0d,
+  0x6a, 0x67, 0x25, 0x58, 0x77, 0xf4, 0x27, 0x61, 0xf8, 0xce, 0x34, 0x06,
+  0x1e, 0x05, 0x68, 0xd4, 0x25, 0x1e, 0x97, 0xab, 0xe5, 0xe3, 0x01, 0xde,
+  0xd8, 0x1b, 0x8f, 0xd1, 0x43, 0x53, 0xaf, 0x2a, 0xdb, 0x14, 0x60, 0xaf,
+  0xa4, 0x65, 0xe9, 0x94, 0x48, 0x7e, 0xa9, 0xa3, 0xe1, 0x6e, 0xf7, 0x4e,
+  0x57, 0x38, 0x8e, 0x2e, 0x47, 0xe6, 0x59, 0x61, 0x83, 0x50, 0x6b, 0x09,
+  0xcd, 0xd7, 0x19, 0xd2, 0x1e, 0xb1, 0x00, 0xe6, 0xda, 0x59, 0x7c, 0x70,
+  0xfa, 0xa4, 0xc0, 0xa4, 0x14, 0x41, 0xdb, 0x3e, 0x72, 0x4c, 0xf8, 0x09,
+  0xa0, 0x1a, 0xc3, 0x8b, 0xf4, 0x53, 0x2b, 0x36, 0xcf, 0xfe, 0xfe, 0x17,
+  0x7f, 0x17, 0xc5, 0x8f, 0xaf, 0x15, 0xeb, 0xfa, 0x07, 0x9f, 0xfd, 0xfd,
+  0xa7, 0xa1, 0xe9, 0xf4, 0x66, 0xce, 0x7f, 0x10, 0x98, 0x48, 0x79, 0xfd,
+  0xaa, 0x25, 0x24, 0x1e, 0x03, 0xca, 0x42, 0x3e, 0x5e, 0xd2, 0x0b, 0x58,
+  0xb2, 0x1c, 0x47, 0x32, 0x9e, 0xb8, 0xbb, 0x9f, 0x4c, 0xf7, 0x0e, 0x6c,
+  0x7c, 0x86, 0x9c, 0x25, 0xdf, 0xdb, 0xd8, 0xc9, 0xc6, 0x67, 0x6a, 0x82,
+  0x8a, 0x9e, 0xc0, 0x58, 0x2b, 0xda, 0x94, 0x08, 0xa3, 0x4d, 0xc3, 0xf6,
+  0xf7, 0x42, 0xbf, 0xbb, 0x01, 0x6c, 0x14, 0x5a, 0x9c, 0x21, 0xe7, 0x38,
+  0xb6, 0x0d, 0xce, 0xae, 0xae, 0xae, 0x5c, 0x84, 0x83, 0x0a, 0x1b, 0x04,
+  0x3e, 0xe4, 0xcc, 0x07, 0x45, 0xf2, 0x1a, 0xed, 0x28, 0x07, 0x86, 0xe4,
+  0x47, 0xe4, 0x76, 0x97, 0x90, 0x18, 0x83, 0x17, 0x15, 0xbd, 0x2c, 0x6a,
+  0x5a, 0x6b, 0x1d, 0xd9, 0x55, 0x6e, 0xb7, 0xa7, 0x4f, 0xb4, 0xdb, 0xc9,
+  0xf4, 0xd7, 0xd3, 0x8f, 0x0f, 0x5e, 0x3f, 0x78, 0x9b, 0xf2, 0x9c, 0x7f,
+  0xa0, 0xf2, 0x94, 0x7f, 0xa0, 0x92, 0x43, 0xbd, 0x8c, 0x78, 0x27, 0xed,
+  0x36, 0x03, 0xf9, 0xdc, 0x73, 0x36, 0xbe, 0xc2, 0x3b, 0x51, 0x60, 0xbc,
+  0x11, 0x46, 0x79, 0x23, 0x80, 0x33, 0xb3, 0x6b, 0xe1, 0xdc, 0x61, 0x56,
+  0x96, 0x28, 0x58, 0x79, 0x24, 0xf9, 0x80, 0xe5, 0x0b, 0x07, 0xb4, 0x3a,
+  0xcf, 0xce, 0x9d, 0x4b, 0xe6, 0x11, 0xf6, 0xd1, 0x67, 0xd3, 0xd7, 0x40,
+  0xd6, 0xce, 0x2a, 0xd5, 0xe8, 0xac, 0xb3, 0x1a, 0x80, 0x25, 0x47, 0xa3,
+  0xde, 0x38, 0xc3, 0x51, 0x8f, 0x0d, 0xb1, 0xaa, 0x4c, 0x2f, 0x1f, 0xa5,
+  0xba, 0x59, 0xb6, 0xef, 0x8c, 0x86, 0x7b, 0xbb, 0xb5, 0x12, 0x54, 0x55,
+  0x6b, 0x81, 0xee, 0x5e, 0x9e, 0xb6, 0xcd, 0x1d, 0xdf, 0xc3, 0x99, 0x39,
+  0x4e, 0xc4, 0x78, 0x8f, 0xdc, 0xb9, 0xac, 0xa5, 0x7f, 0x0e, 0xc6, 0x3e,
+  0x05, 0x76, 0x08, 0x93, 0x79, 0x27, 0x55, 0x62, 0x80, 0xa3, 0x18, 0xa9,
+  0x20, 0x06, 0xb8, 0x53, 0x19, 0x1b, 0xcf, 0xd9, 0x9b, 0x79, 0x9a, 0x08,
+  0xf0, 0xc9, 0xca, 0xf5, 0xc8, 0xa4, 0x96, 0x93, 0xda, 0x55, 0x87, 0xc4,
+  0xf8, 0x98, 0x43, 0x0d, 0x5b, 0xf1, 0x31, 0x09, 0x8d, 0xa1, 0xda, 0xaa,
+  0xb5, 0x07, 0x6b, 0x8f, 0x10, 0xba, 0x3a, 0xdf, 0xeb, 0x8d, 0xd2, 0x3c,
+  0x8f, 0xae, 0xd9, 0xe8, 0xaa, 0x0d, 0xcd, 0x7d, 0xb6, 0xeb, 0xf2, 0x21,
+  0x35, 0x22, 0xb9, 0x52, 0x13, 0x92, 0x9a, 0xb7, 0x87, 0x7d, 0x38, 0x92,
+  0xcf, 0xd4, 0x16, 0xbe, 0xb1, 0xd8, 0x59, 0xf8, 0xfa, 0x4b, 0x9d, 0x85,
+  0xce, 0xc2, 0xfc, 0x7c, 0x68, 0x84, 0x61, 0x36, 0x75, 0xb8, 0x91, 0x4b,
+  0x57, 0x1b, 0x3e, 0xfc, 0x6f, 0x8a, 0x47, 0xb3, 0x8f, 0xdd, 0x87, 0x25,
+  0x09, 0x20, 0x5f, 0x04, 0xa9, 0x20, 0x7b, 0x2b, 0x25, 0xc5, 0xd3, 0x26,
+  0x84, 0xf0, 0x1d, 0xb2, 0x8e, 0x22, 0xe1, 0x64, 0x74, 0xa5, 0x9b, 0xbf,
+  0x36, 0x3b, 0x2d, 0x3c, 0x70, 0xea, 0x54, 0xa2, 0xe7, 0x41, 0x4a, 0xc8,
+  0xfe, 0x82, 0x84, 0x58, 0x7c, 0xf1, 0xc5, 0x8e, 0xfa, 0xdf, 0x53, 0x5f,
+  0x13, 0xbd, 0x01, 0x97, 0x4c, 0xcf, 0x5e, 0xbc, 0xba, 0x9a, 0x88, 0x00,
+  0xf8, 0xd9, 0xc9, 0x60, 0x83, 0x92, 0x34, 0x80, 0x87, 0x41, 0x02, 0x60,
+  0x47, 0xc1, 0xd1, 0xbf, 0xd4, 0xa1, 0xff, 0x17, 0x1f, 0xf7, 0xb3, 0x66,
+  0xf4, 0x42, 0x65, 0x19, 0x62, 0xf2, 0xa4, 0x6f, 0x2d, 0xe7, 0xf0, 0xd4,
+  0xec, 0xf0, 0xec, 0x9d, 0x69, 0x75, 0x0f, 0xc9, 0xda, 0xdd, 0x11, 0x10,
+  0x5b, 0x27, 0xb0, 0x87, 0x66, 0xe9, 0x4c, 0x8f, 0x5b, 0xc0, 0xcd, 0xf5,
+  0xc8, 0x4b, 0x04, 0xd3, 0x43, 0xaf, 0x5e, 0x6f, 0x64, 0xa2, 0xc7, 0x43,
+  0x73, 0xf4, 0xc8, 0x5c, 0xd3, 0x63, 0x57, 0x02, 0xa1, 0x9e, 0x82, 0x4b,
+  0x78, 0x7b, 0x3c, 0xde, 0x5d, 0x3a, 0x79, 0x92, 0x5a, 0x74, 0xd2, 0x7b,
+  0x5d, 0x0c, 0xc5, 0xee, 0x6c, 0x0e, 0x77, 0x96, 0x5e, 0x9a, 0x7f, 0x69,
+  0xfe, 0xf8, 0x16, 0x36, 0x51, 0x49, 0xde, 0xf1, 0x42, 0x50, 0xe5, 0xed,
+  0x49, 0x8c, 0x51, 0xfc, 0x60, 0x2a, 0x04, 0xee, 0x0e, 0xed, 0xae, 0xa8,
+  0x55, 0x78, 0x17, 0xbb, 0xf4, 0x94, 0x02, 0x66, 0x6e, 0x91, 0x0e, 0x5c,
+  0xbd, 0x23, 0xa9, 0x45, 0xed, 0xec, 0x05, 0xfa, 0x37, 0x7a, 0xbb, 0x0a,
+  0xdd, 0x7b, 0x71, 0xcc, 0x05, 0xd7, 0xa7, 0xf5, 0x65, 0x9e, 0x25, 0x95,
+  0x5d, 0xed, 0x6d, 0x1b, 0xa5, 0x53, 0xeb, 0x0e, 0x9a, 0xad, 0xa5, 0x3b,
+  0xbb, 0xc3, 0x51, 0x77, 0x74, 0xff, 0xfc, 0x75, 0xcb, 0x41, 0x92, 0x54,
+  0x35, 0xc2, 0x28, 0xb1, 0x01, 0xe2, 0x26, 0x85, 0x97, 0xd6, 0x17, 0x77,
+  0xef, 0x25, 0xf9, 0xb0, 0x9f, 0xa1, 0x4f, 0x4c, 0xaf, 0xee, 0x18, 0xcd,
+  0x48, 0xa5, 0xe7, 0x77, 0x70, 0xfe, 0x3a, 0xf7, 0x95, 0x3a, 0x7a, 0xcf,
+  0x94, 0x0c, 0xc9, 0x75, 0x36, 0x64, 0x59, 0x7f, 0x49, 0x4f, 0xc8, 0x6d,
+  0xcd, 0x08, 0xcf, 0xcd, 0x2d, 0xa2, 0x2f, 0x8f, 0xb6, 0xa3, 0xbe, 0x6f,
+  0xa2, 0xf3, 0x74, 0x6a, 0xae, 0x51, 0x94, 0xb0, 0x9d, 0x21, 0x15, 0x67,
+  0x05, 0x0b, 0xe5, 0x64, 0xce, 0x8d, 0xdc, 0xb6, 0x2d, 0x3c, 0x81, 0x14,
+  0x98, 0x4a, 0xd7, 0x1b, 0x0a, 0x33, 0x2d, 0xcf, 0xd0, 0x9b, 0xf3, 0xd9,
+  0x2a, 0xb5, 0xf4, 0x38, 0x4a, 0x7e, 0xfe, 0xbd, 0x30, 0x10, 0x10, 0x6f,
+  0xb8, 0xb4, 0x7a, 0xbd, 0x7d, 0xfe, 0x7a, 0xbd, 0x14, 0x1a, 0x57, 0xff,
+  0x73, 0x50, 0x3b, 0xea, 0x9c, 0xcc, 0x7b, 0xf5, 0x2a, 0x28, 0xb9, 0xc6,
+  0x00, 0x0e, 0xcb, 0x18, 0x14, 0xb8, 0xcf, 0x74, 0x52, 0xd1, 0x3c, 0x60,
+  0x0d, 0x50, 0x1b, 0x17, 0x08, 0x12, 0x93, 0xdc, 0x2a, 0x00, 0x8d, 0x18,
+  0x0e, 0x38, 0x7c, 0xcb, 0x08, 0x21, 0x2a, 0xec, 0xcc, 0x6e, 0x1c, 0xb0,
+  0x10, 0x96, 0x36, 0x86, 0x65, 0x5b, 0xa5, 0x8f, 0xe6, 0xcd, 0xf4, 0x7a,
+  0x77, 0x34, 0x16, 0x09, 0xe3, 0xf1, 0xaf, 0xdb, 0xfc, 0x33, 0x27, 0x37,
+  0x4f, 0x07, 0xce, 0x37, 0xe4, 0x6a, 0x09, 0xae, 0xe5, 0xe7, 0x78, 0x68,
+  0x43, 0x77, 0x3c, 0x4e, 0x7b, 0x17, 0x29, 0xce, 0x36, 0x51, 0x30, 0x55,
+  0xeb, 0x36, 0xa0, 0x84, 0xda, 0x14, 0x4c, 0x74, 0xde, 0xec, 0x7c, 0x7f,
+  0x98, 0x0d, 0x60, 0x6b, 0xd4, 0x9b, 0xc9, 0x0b, 0x09, 0x00, 0x82, 0xff,
+  0xaa, 0x9e, 0x4b, 0x29, 0xe7, 0x65, 0x0a, 0x72, 0xf6, 0x8f, 0x85, 0x48,
+  0x69, 0x20, 0x72, 0x3d, 0xbf, 0x9f, 0xaf, 0x0c, 0xb6, 0x86, 0xab, 0xca,
+  0x58, 0xc9, 0x15, 0xd2, 0x86, 0x70, 0xa2, 0x91, 0x51, 0xf6, 0x7f, 0x6f,
+  0x40, 0x2a, 0xfe, 0xd3, 0x1b, 0xa3, 0xb3, 0xcc, 0xc7, 0xc1, 0x4d, 0x5c,
+  0x6d, 0x51, 0xf9, 0xb0, 0x31, 0xaf, 0xc8, 0xa1, 0xf4, 0xb7, 0x82, 0x43,
+  0x91, 0xcb, 0x5a, 0x94, 0x77, 0xc6, 0x63, 0x55, 0xed, 0x20, 0xd5, 0xa4,
+  0x9d, 0x4c, 0x1f, 0x51, 0x5e, 0x49, 0x91, 0x81, 0xf2, 0xb3, 0xe9, 0x93,
+  0x13, 0x4d, 0x19, 0x11, 0x60, 0xa5, 0x92, 0xb0, 0xba, 0xc3, 0x79, 0xfa,
+  0xef, 0x20, 0xbd, 0x90, 0x03, 0xcb, 0xde, 0xa0, 0x97, 0x6e, 0x65, 0x83,
+  0x34, 0x90, 0x7d, 0x1b, 0xdb, 0xfd, 0x00, 0xda, 0x09, 0x46, 0x58, 0x34,
+  0x66, 0xd5, 0xb2, 0xee, 0xc4, 0x50, 0xd9, 0x10, 0xdc, 0x28, 0x6b, 0xfb,
+  0xad, 0xbf, 0x39, 0x15, 0x9e, 0x9d, 0x31, 0xcc, 0xed, 0x48, 0x66, 0x0e,
+  0x08, 0xe7, 0x1d, 0x4e, 0x42, 0x55, 0x5f, 0x3b, 0x9d, 0x8e, 0xf3, 0xb4,
+  0x85, 0xb9, 0xc6, 0x14, 0xfc, 0x89, 0x06, 0x26, 0x18, 0xf0, 0x15, 0x90,
+  0xf0, 0x5f, 0xc9, 0x06, 0xaf, 0x35, 0x6c, 0x36, 0x4d, 0x11, 0xe5, 0x31,
+  0x57, 0x64, 0x59, 0x5c, 0x76, 0xce, 0xe1, 0xe5, 0x7e, 0xfe, 0x59, 0x6e,
+  0x8c, 0xab, 0x6a, 0x87, 0xeb, 0x2a, 0x28, 0x8e, 0x2d, 0xce, 0x29, 0xdd,
+  0x33, 0xc3, 0xf7, 0x52, 0x81, 0x2e, 0xd7, 0x7b, 0xd0, 0x9e, 0x97, 0x94,
+  0x0f, 0x76, 0x56, 0x6b, 0x5f, 0xd4, 0xd2, 0xa7, 0x21, 0x6c, 0x61, 0x1e,
+  0x5d, 0x6e, 0xe9, 0x13, 0x78, 0x16, 0x7a, 0xe9, 0x38, 0xae, 0xb9, 0xb1,
+  0x2f, 0x94, 0x47, 0xd1, 0x5c, 0xc0, 0x46, 0x28, 0xe3, 0x41, 0xe4, 0x11,
+  0x1b, 0xf7, 0x37, 0x57, 0x52, 0xc3, 0x6d, 0x29, 0x41, 0x18, 0x57, 0x72,
+  0xcb, 0x29, 0xb7, 0xb2, 0x69, 0xb0, 0x92, 0x59, 0x30, 0x6a, 0x5b, 0x23,
+  0xc9, 0x59, 0xde, 0x54, 0x76, 0xbb, 0x3d, 0x4c, 0xa9, 0xb2, 0x94, 0xa0,
+  0xf7, 0x1f, 0x57, 0x6d, 0x9f, 0x76, 0x95, 0xf1, 0x05, 0xd6, 0x24, 0x64,
+  0x81, 0xac, 0xe9, 0x6a, 0x76, 0x67, 0xd0, 0xed, 0xab, 0xcb, 0xcf, 0x08,
+  0xda, 0x4e, 0x92, 0xde, 0xcb, 0x3b, 0xad, 0xe4, 0x82, 0xf2, 0x4e, 0xb5,
+  0x14, 0xb1, 0x13, 0xe7, 0x73, 0x43, 0x37, 0xd5, 0xd0, 0x90, 0xcb, 0x6d,
+  0x4b, 0x0a, 0x68, 0xd5, 0x8c, 0x74, 0xc6, 0xe6, 0x32, 0xe9, 0x08, 0xc4,
+  0x05, 0x66, 0x21, 0xeb, 0xca, 0xe0, 0x99, 0x5a, 0x02, 0xa1, 0xd9, 0x20,
+  0xcd, 0x8b, 0xf4, 0xf0, 0xd8, 0x7d, 0x43, 0x11, 0xa4, 0x89, 0x99, 0xd0,
+  0xea, 0x1c, 0x17, 0xf3, 0x5b, 0x8d, 0x15, 0xef, 0x14, 0x70, 0x27, 0xf3,
+  0x25, 0x7d, 0x0b, 0x5b, 0xf6, 0x43, 0xa6, 0xa0, 0x8c, 0x09, 0xb1, 0x42,
+  0x28, 0xe4, 0x8e, 0x30, 0x0c, 0x31, 0xe3, 0xf0, 0xa4, 0xf2, 0x98, 0x58,
+  0xd6, 0xea, 0x3a, 0x9e, 0x5f, 0xb5, 0xef, 0x7d, 0xaf, 0x5e, 0x6b, 0xda,
+  0x17, 0x0e, 0xd3, 0xa4, 0x46, 0x47, 0xdc, 0xf7, 0xbe, 0x57, 0xab, 0x47,
+  0x9b, 0x7c, 0xef, 0x7b, 0xb2, 0x0d, 0x00, 0x0a, 0x84, 0x86, 0xb9, 0x69,
+  0x8c, 0x34, 0x0b, 0xaf, 0xe4, 0xf0, 0x03, 0x1c, 0xe9, 0x55, 0xc9, 0x82,
+  0x5f, 0x15, 0x09, 0xe0, 0x8d, 0xf7, 0xcf, 0x0c, 0x20, 0x34, 0xfb, 0x3b,
+  0xd4, 0xd7, 0x8a, 0xdf, 0xbf, 0xaa, 0xf3, 0xb7, 0x1f, 0x0d, 0x8c, 0x48,
+  0x27, 0x69, 0x03, 0x49, 0xc7, 0x17, 0x8c, 0x4c, 0x73, 0x79, 0x38, 0x22,
+  0x67, 0x59, 0xfc, 0xbb, 0x51, 0x28, 0xf3, 0x7b, 0x09, 0xe3, 0x1d, 0xb9,
+  0x3f, 0x7e, 0xe0, 0xca, 0x0f, 0xdb, 0x42, 0x66, 0xec, 0xc5, 0xc4, 0x7f,
+  0xd5, 0xc1, 0xb5, 0x81, 0x55, 0xac, 0x23, 0x0a, 0x77, 0x63, 0x38, 0x6e,
+  0x87, 0xaf, 0x02, 0xf0, 0x66, 0x45, 0x47, 0x2a, 0xc9, 0x23, 0x80, 0x2a,
+  0x03, 0xe1, 0x25, 0x83, 0x0a, 0xd4, 0xb1, 0x6e, 0xaf, 0xef, 0xe5, 0xdb,
+  0x4d, 0x4a, 0xdf, 0x62, 0x3f, 0xe3, 0xc7, 0xc3, 0x29, 0x7d, 0xb7, 0x29,
+  0x1f, 0x25, 0xd6, 0x6a, 0x6a, 0xcf, 0xc7, 0x06, 0x89, 0x90, 0x6f, 0xcd,
+  0xdf, 0x76, 0xca, 0x91, 0x54, 0x84, 0xba, 0x50, 0x08, 0x75, 0xe1, 0x90,
+  0x50, 0x17, 0x0b, 0xa1, 0x2e, 0xda, 0x50, 0xed, 0x58, 0xc2, 0x43, 0x51,
+  0xe3, 0xa8, 0xe3, 0x3e, 0xea, 0x08, 0xcd, 0x58, 0x70, 0x10, 0xaa, 0xe5,
+  0xcd, 0x1c, 0xee, 0x0a, 0x96, 0x44, 0x67, 0xbd, 0x90, 0xf5, 0x77, 0xe6,
+  0xdc, 0xf2, 0x09, 0xf4, 0x96, 0x5c, 0x98, 0xac, 0xf6, 0x32, 0x2a, 0xc0,
+  0xd1, 0x3b, 0xa8, 0x26, 0xac, 0x1b, 0x9f, 0x8b, 0xc5, 0xe0, 0xef, 0x11,
+  0x5c, 0xc7, 0xa7, 0xb4, 0x4c, 0x2c, 0xd3, 0x74, 0xa0, 0xaf, 0x5d, 0xe7,
+  0x6a, 0x7a, 0xf8, 0xad, 0x52, 0xd9, 0x8c, 0x9a, 0x31, 0x71, 0xac, 0xa2,
+  0x87, 0xd5, 0x9e, 0x22, 0x1c, 0xfd, 0x31, 0xbb, 0x6f, 0x15, 0xdc, 0x47,
+  0xb7, 0x87, 0xa3, 0xec, 0x07, 0x30, 0x69, 0x04, 0xc1, 0xf5, 0xae, 0x62,
+  0xd8, 0x97, 0xba, 0x48, 0x47, 0x3c, 0xb1, 0x0a, 0x41, 0x30, 0x69, 0x4c,
+  0xb7, 0x35, 0x2e, 0x5b, 0xf8, 0xb3, 0x95, 0x64, 0x70, 0x23, 0xb9, 0x17,
+  0x74, 0xdd, 0x3a, 0xa2, 0xef, 0x15, 0x82, 0x0f, 0x3a, 0x5e, 0x15, 0x79,
+  0x30, 0x39, 0x7a, 0x3b, 0x2d, 0x46, 0x21, 0xb0, 0x4e, 0xd4, 0x27, 0xa7,
+  0x40, 0x6d, 0xef, 0x29, 0x99, 0x33, 0x4a, 0xd4, 0xd7, 0x26, 0xd2, 0x2c,
+  0x27, 0x22, 0x54, 0xa3, 0xdd, 0x4f, 0xb7, 0xe0, 0xe0, 0x59, 0x78, 0xd1,
+  0x96, 0xea, 0xaa, 0xa8, 0xf9, 0x47, 0x6d, 0x4c, 0x96, 0x05, 0xfb, 0xa0,
+  0xfd, 0xfc, 0x03, 0x22, 0xe5, 0xa4, 0x96, 0x48, 0x74, 0xe5, 0x0b, 0x5f,
+  0x83, 0xef, 0xf5, 0x60, 0xeb, 0xdd, 0x03, 0x20, 0xcf, 0xde, 0x80, 0x27,
+  0x41, 0xb5, 0x74, 0x89, 0x4b, 0xcf, 0x51, 0xa8, 0x31, 0x7f, 0x18, 0x6a,
+  0xec, 0x8f, 0x48, 0x07, 0xe8, 0x53, 0x43, 0xbe, 0x38, 0x04, 0x35, 0x3c,
+  0x90, 0x67, 0xbf, 0x0b, 0x4f, 0xd2, 0x6a, 0xe4, 0x28, 0xf4, 0x93, 0x21,
+  0xf0, 0x61, 0x4d, 0x78, 0xc4, 0x87, 0x08, 0x99, 0x59, 0x43, 0x21, 0x62,
+  0x34, 0xd3, 0xd2, 0x17, 0x28, 0xe6, 0xf4, 0xe3, 0x6b, 0x9b, 0xcb, 0xd4,
+  0xad, 0xc5, 0x2a, 0x4c, 0x10, 0xb2, 0x09, 0x11, 0x97, 0x97, 0xe2, 0x78,
+  0xc8, 0xd9, 0x32, 0xca, 0x08, 0x07, 0xe9, 0x7e, 0x5b, 0x6c, 0x4c, 0x2d,
+  0x76, 0xc8, 0xb8, 0x5b, 0x9f, 0xf3, 0xad, 0x58, 0x4a, 0x8a, 0x6e, 0x3f,
+  0x1d, 0xc1, 0xae, 0xbf, 0xde, 0x4f, 0x31, 0x19, 0x36, 0x00, 0x04, 0x8e,
+  0x8b, 0x48, 0x24, 0x2b, 0x17, 0xeb, 0xcd, 0x52, 0x36, 0x45, 0xea, 0x09,
+  0x7e, 0x20, 0x74, 0xf2, 0xe1, 0x4e, 0x4a, 0x2c, 0x08, 0x59, 0x8f, 0xdc,
+  0xde, 0xa2, 0x88, 0xbd, 0xe8, 0x3a, 0xd0, 0x37, 0x75, 0xb7, 0x9f, 0x01,
+  0x0b, 0x46, 0x83, 0x16, 0x74, 0x0c, 0x2f, 0x28, 0x55, 0x9d, 0x88, 0x28,
+  0xcb, 0x2b, 0xe0, 0x61, 0xe3, 0x20, 0x8a, 0x52, 0x1a, 0xee, 0x84, 0x19,
+  0xaf, 0xa8, 0xf7, 0x16, 0x83, 0xd3, 0x15, 0x57, 0x3e, 0x74, 0xcb, 0x34,
+  0x8f, 0xe5, 0x9a, 0x14, 0x8f, 0xfd, 0x2c, 0x7e, 0x33, 0x9c, 0xb0, 0x85,
+  0x42, 0x40, 0x60, 0xba, 0xb4, 0xe2, 0x20, 0x96, 0x06, 0x80, 0x56, 0x86,
+  0xe4, 0xea, 0xdc, 0x78, 0x41, 0x8f, 0x30, 0x13, 0xf3, 0x3c, 0x8a, 0x8a,
+  0xe2, 0xd7, 0x69, 0x87, 0x20, 0xb2, 0xd0, 0xb1, 0xa5, 0x39, 0x72, 0xa6,
+  0x6d, 0x17, 0xb6, 0x43, 0x2a, 0x80, 0xb5, 0x92, 0x05, 0x4b, 0x39, 0x5f,
+  0x75, 0xd4, 0x9e, 0x46, 0xc9, 0x8a, 0x4b, 0xf0, 0xa4, 0x74, 0x56, 0x38,
+  0x33, 0xe2, 0x64, 0x66, 0x1c, 0xfa, 0x85, 0xc8, 0x47, 0x12, 0x32, 0x96,
+  0xd2, 0x3d, 0xa4, 0x88, 0xd7, 0x3a, 0xa4, 0x68, 0xd7, 0x3a, 0xa4, 0x48,
+  0x07, 0x9f, 0xdd, 0x66, 0x83, 0x10, 0x74, 0xec, 0x29, 0x79, 0xce, 0x9e,
+  0x80, 0x9d, 0xee, 0x6e, 0xec, 0xe8, 0x56, 0xf5, 0x79, 0x69, 0xc5, 0x5e,
+  0x90, 0xbc, 0xb9, 0x28, 0x18, 0x34, 0x78, 0xd8, 0xac, 0x5b, 0x91, 0xf3,
+  0x72, 0xa1, 0x57, 0x86, 0xe6, 0x32, 0xeb, 0x75, 0xb5, 0xca, 0xe5, 0xa5,
+  0x5a, 0xaf, 0x48, 0xb9, 0xd7, 0x3a, 0x3a, 0x07, 0x9a, 0xd9, 0x6a, 0xee,
+  0x08, 0xce, 0xb9, 0x4f, 0xb4, 0x28, 0x2c, 0x61, 0xc8, 0xd7, 0x0a, 0x90,
+  0xde, 0x9c, 0x2e, 0xf2, 0xe7, 0xdc, 0x27, 0x2e, 0x20, 0xf9, 0x7a, 0x4e,
+  0x57, 0x46, 0x98, 0xf0, 0xc5, 0xa5, 0x26, 0x22, 0x1a, 0x2d, 0xe2, 0x2e,
+  0x5d, 0x1d, 0x35, 0x62, 0x2e, 0x86, 0x4b, 0x87, 0xb9, 0x65, 0xca, 0x00,
+  0x66, 0xbc, 0x13, 0x2e, 0x55, 0xbd, 0x4d, 0xaa, 0xae, 0x71, 0x3f, 0x2c,
+  0xf1, 0x7d, 0x21, 0x5e, 0x58, 0x8b, 0x6a, 0xc9, 0x5a, 0x72, 0xd5, 0xe2,
+  0x9c, 0x0d, 0x29, 0x54, 0x74, 0x04, 0xaa, 0x6e, 0x83, 0x25, 0x29, 0x44,
+  0xf9, 0xdd, 0x25, 0xb8, 0x7e, 0x60, 0xdf, 0x24, 0x40, 0xe8, 0x5f, 0xbb,
+  0x59, 0x8f, 0xfd, 0x3d, 0xc0, 0xbf, 0xe7, 0x81, 0xaf, 0xb4, 0x92, 0xc5,
+  0x56, 0x72, 0xaa, 0x95, 0x7c, 0xad, 0x95, 0xbc, 0xd8, 0x4a, 0xbe, 0xde,
+  0x4a, 0xfe, 0xa4, 0x95, 0xbc, 0xd4, 0x4a, 0xbe, 0x81, 0x49, 0x8f, 0xe1,
+  0x7f, 0xf0, 0x7e, 0x01, 0x1a, 0x2c, 0x40, 0x8b, 0x05, 0x68, 0xb2, 0x00,
+  0x6d, 0x16, 0xa0, 0xd1, 0x02, 0xb4, 0x5a, 0x80, 0x66, 0x0b, 0xd0, 0x6e,
+  0x11, 0xda, 0x2d, 0x22, 0x1c, 0x68, 0xb7, 0x08, 0xed, 0x16, 0xa1, 0xdd,
+  0x22, 0xb4, 0x5b, 0x84, 0x76, 0x8b, 0xd0, 0x6e, 0x11, 0xda, 0x2d, 0x42,
+  0xbb, 0x53, 0xd0, 0xee, 0x14, 0xb4, 0x3b, 0x85, 0x1d, 0x42, 0xbb, 0x53,
+  0xd0, 0xee, 0x14, 0xb4, 0x3b, 0x05, 0xed, 0x4e, 0x41, 0xbb, 0x53, 0xd0,
+  0xee, 0xd4, 0x37, 0x6e, 0x53, 0x82, 0x5a, 0x1c, 0xa1, 0xbc, 0x11, 0x51,
+  0x81, 0x0c, 0x55, 0xae, 0x9b, 0x3d, 0x5f, 0x15, 0xa5, 0x84, 0xfd, 0x17,
+  0xe7, 0x85, 0x98, 0xe1, 0xbf, 0xb8, 0x9e, 0xf5, 0xf8, 0xd3, 0x2c, 0xbf,
+  0x3a, 0x1c, 0x53, 0x6e, 0x5f, 0x46, 0x45, 0x95, 0xc1, 0x59, 0x33, 0x4a,
+  0x98, 0x7b, 0xc2, 0x60, 0x0d, 0xe4, 0x30, 0xb4, 0x55, 0xc8, 0x2a, 0xd8,
+  0x5c, 0x7d, 0x25, 0x2a, 0x69, 0x67, 0xf9, 0xb5, 0xbd, 0xb1, 0xc8, 0x08,
+  0x52, 0x9b, 0xfe, 0x0c, 0xeb, 0x13, 0x4c, 0x9f, 0x4c, 0xdf, 0xa7, 0xfa,
+  0x5e, 0xf0, 0x53, 0xfc, 0x70, 0x12, 0xbb, 0x90, 0x4d, 0xe6, 0xa2, 0x9c,
+  0x48, 0x99, 0xdd, 0x45, 0xfc, 0xbb, 0x62, 0x25, 0x3f, 0x93, 0x0f, 0x8b,
+  0xd2, 0x06, 0xe8, 0xcf, 0x8c, 0x22, 0x5d, 0x59, 0x7e, 0xe5, 0x3b, 0x62,
+  0xe6, 0xd9, 0x50, 0x27, 0x02, 0x58, 0xcd, 0x36, 0xfa, 0x18, 0x34, 0x57,
+  0x25, 0x4a, 0x56, 0x98, 0x59, 0x04, 0x98, 0xc2, 0x08, 0xd9, 0x60, 0x23,
+  0x9d, 0xb5, 0x20, 0x0c, 0xc1, 0x8e, 0x8e, 0x2d, 0x4b, 0xa7, 0xc7, 0x50,
+  0x51, 0x19, 0x6f, 0x87, 0x44, 0xf7, 0xbc, 0x2d, 0x1f, 0xb3, 0xac, 0xb7,
+  0xd1, 0x02, 0x2b, 0xcc, 0x15, 0xc0, 0x01, 0x26, 0x2b, 0x54, 0x47, 0x80,
+  0x89, 0x45, 0x17, 0x28, 0xd7, 0x52, 0x98, 0x58, 0xb7, 0xa4, 0x4b, 0x15,
+  0x05, 0x50, 0xd4, 0xa5, 0x5c, 0xd4, 0x56, 0x96, 0x0a, 0x1e, 0x03, 0x1c,
+  0xa5, 0x2d, 0xbb, 0xdc, 0x16, 0xc4, 0xfe, 0xf2, 0x3a, 0x16, 0xb2, 0x8a,
+  0xf1, 0x5a, 0x77, 0xe3, 0x3c, 0x65, 0x30, 0x6e, 0x34, 0x4d, 0x32, 0xf0,
+  0x2a, 0xd9, 0x80, 0x27, 0x5e, 0x62, 0xbf, 0x10, 0x4c, 0xb6, 0xbc, 0x37,
+  0xf5, 0xcb, 0x97, 0xc5, 0x55, 0xa0, 0xa8, 0x18, 0x0b, 0xcf, 0x6e, 0xbc,
+  0x6c, 0xf6, 0xa0, 0x07, 0x03, 0x24, 0x2f, 0xf7, 0x19, 0x4b, 0x46, 0x82,
+  0xaf, 0xba, 0xc0, 0x04, 0x79, 0x96, 0x66, 0x8e, 0x31, 0x1d, 0x07, 0xd7,
+  0xa1, 0xc1, 0x05, 0xf2, 0xf4, 0xca, 0x29, 0x21, 0x7c, 0xd6, 0xed, 0x0b,
+  0x66, 0xd4, 0x52, 0x5c, 0x5c, 0xfc, 0x64, 0x11, 0x9d, 0xd6, 0x73, 0xa5,
+  0xc6, 0x40, 0x73, 0xa4, 0xf5, 0x3d, 0x93, 0xfe, 0xf8, 0x89, 0xad, 0xd2,
+  0x8b, 0xb3, 0xb8, 0x4f, 0xeb, 0xb3, 0x2b, 0xdd, 0x5d, 0x99, 0x9d, 0x0f,
+  0xfe, 0x12, 0x2b, 0x01, 0x33, 0xbd, 0x34, 0x94, 0x34, 0x82, 0x33, 0x3e,
+  0xdc, 0xb2, 0xbf, 0xd1, 0x89, 0xe5, 0x1d, 0x40, 0x68, 0x2d, 0x6c, 0x48,
+  0xc6, 0xd5, 0x6b, 0x89, 0x8f, 0x4d, 0xd0, 0x29, 0x03, 0xcb, 0x47, 0x84,
+  0xd0, 0xbd, 0x91, 0x33, 0x35, 0x06, 0xeb, 0x23, 0x39, 0xe3, 0x77, 0x89,
+  0x19, 0xde, 0xf8, 0xe7, 0x1d, 0xca, 0x50, 0xc6, 0x96, 0x1e, 0xfb, 0x80,
+  0x39, 0x88, 0x38, 0xd4, 0xb1, 0x72, 0xef, 0x58, 0xe0, 0xe0, 0x54, 0xf3,
+  0x68, 0x8d, 0x0f, 0x0f, 0x03, 0x4b, 0x73, 0x73, 0x0f, 0xa0, 0x7a, 0x53,
+  0x0c, 0x55, 0x42, 0x96, 0x6f, 0xe4, 0xa9, 0xc2, 0x57, 0x98, 0xcf, 0x9a,
+  0xb0, 0x17, 0x99, 0x0a, 0x5c, 0x14, 0xae, 0x71, 0xb6, 0x08, 0xac, 0xd7,
+  0x42, 0xdd, 0x5b, 0x4d, 0x9c, 0xfe, 0xb8, 0xbe, 0x2f, 0xa8, 0xe6, 0x35,
+  0x75, 0x1e, 0x88, 0x9f, 0x96, 0x46, 0x88, 0xe7, 0x94, 0xb4, 0xa5, 0x89,
+  0x8e, 0x80, 0x84, 0x1c, 0x3d, 0xf8, 0x22, 0xa8, 0x9f, 0x0b, 0x77, 0x52,
+  0x0f, 0x5b, 0xf5, 0x50, 0xe3, 0x91, 0x20, 0x27, 0x6a, 0x77, 0xfb, 0xd9,
+  0x1d, 0x90, 0xd5, 0x36, 0xe9, 0x9e, 0xbb, 0x5c, 0x43, 0x65, 0x1e, 0x40,
+  0xda, 0xca, 0xee, 0x50, 0xf6, 0x22, 0xd1, 0xdf, 0x49, 0x21, 0xc9, 0x88,
+  0xcb, 0x7d, 0xd8, 0x4c, 0x0a, 0x4c, 0x12, 0x3e, 0x20, 0x82, 0xae, 0xf4,
+  0xf2, 0x86, 0x39, 0xb6, 0x34, 0x55, 0x35, 0x9e, 0x8e, 0x58, 0xc1, 0xaa,
+  0xdc, 0x3b, 0xa2, 0x57, 0x70, 0xec, 0x4d, 0x37, 0x34, 0xbb, 0xcf, 0xe9,
+  0x5d, 0x25, 0x7f, 0x8a, 0xf5, 0x01, 0xdd, 0xc5, 0x31, 0x17, 0x0a, 0xc2,
+  0x6e, 0xe3, 0xab, 0x36, 0x91, 0x8f, 0x78, 0x72, 0x98, 0xf8, 0x5a, 0xad,
+  0x48, 0xbf, 0xe3, 0x97, 0x13, 0x24, 0x45, 0xa1, 0x62, 0xb1, 0x06, 0x28,
+  0xa9, 0xbc, 0x50, 0xba, 0xb9, 0x1d, 0x12, 0xcf, 0xed, 0xb7, 0x35, 0xb7,
+  0xa5, 0x0e, 0xae, 0xa4, 0x1b, 0xee, 0x19, 0x81, 0x88, 0x65, 0x39, 0xf6,
+  0x6d, 0xf9, 0x71, 0x0c, 0xa4, 0xa1, 0x3b, 0xd8, 0xbd, 0x8c, 0x8f, 0xb3,
+  0x1a, 0x4a, 0x7d, 0x11, 0x34, 0x13, 0x59, 0x8b, 0x85, 0x34, 0x45, 0xd3,
+  0xfa, 0xf2, 0xb0, 0x77, 0x5f, 0x5e, 0xcc, 0x97, 0x99, 0xb3, 0x03, 0xf9,
+  0xd1, 0x48, 0x7f, 0x93, 0x75, 0x61, 0x9f, 0x55, 0x1c, 0x70, 0x92, 0xfc,
+  0x79, 0x02, 0xec, 0xde, 0x3c, 0x02, 0xb6, 0x31, 0x59, 0xb7, 0x8a, 0x14,
+  0xb9, 0x7b, 0x9f, 0xd7, 0xad, 0x23, 0xa0, 0x2f, 0x00, 0x54, 0x00, 0xa3,
+  0x20, 0x90, 0x5d, 0x10, 0x60, 0xa2, 0x3c, 0x78, 0x6d, 0x40, 0x72, 0xe0,
+  0xb5, 0xad, 0xad, 0x1a, 0xf6, 0x84, 0x6e, 0x2e, 0xa6, 0xab, 0x1d, 0x2a,
+  0x33, 0x41, 0xae, 0x2f, 0xd0, 0x54, 0x14, 0x9d, 0xa0, 0xe6, 0x98, 0x0f,
+  0xbb, 0xa6, 0x8a, 0xfd, 0x49, 0x46, 0x15, 0xef, 0x8f, 0xcb, 0x9f, 0xd7,
+  0x6e, 0xae, 0x11, 0x84, 0x95, 0xab, 0x35, 0x3d, 0x0a, 0x49, 0xb6, 0xa8,
+  0xe5, 0xbd, 0x42, 0xd0, 0x69, 0xb5, 0x30, 0x4f, 0xa3, 0x4b, 0x16, 0x88,
+  0xf5, 0x52, 0x14, 0x17, 0x84, 0xa7, 0x05, 0x70, 0x94, 0xf5, 0xe7, 0x1f,
+  0x44, 0x64, 0xea, 0x49, 0x22, 0xef, 0xb2, 0xc9, 0x0b, 0xc9, 0xc2, 0x64,
+  0x3d, 0xa8, 0x82, 0x0e, 0x46, 0xf4, 0xa9, 0xf0, 0xcc, 0xe7, 0x1f, 0x18,
+  0xf2, 0x4c, 0xdc, 0xe0, 0xbe, 0x98, 0x25, 0x7b, 0xc6, 0xc8, 0x4c, 0x4f,
+  0x5d, 0x89, 0xbe, 0x98, 0x34, 0x1a, 0xad, 0xad, 0x94, 0x75, 0xce, 0x8c,
+  0xd2, 0x32, 0x47, 0x4f, 0xb9, 0x5e, 0x77, 0x74, 0x1f, 0xf5, 0x96, 0x3f,
+  0x0d, 0x18, 0xd9, 0x5d, 0x98, 0x9b, 0xc3, 0xdd, 0xfb, 0x33, 0xc0, 0xfc,
+  0xd7, 0xbf, 0xaa, 0x00, 0x53, 0xe8, 0xac, 0x4a, 0xa0, 0xaa, 0x50, 0xcb,
+  0xe7, 0x1f, 0x14, 0x32, 0xfe, 0xd3, 0x67, 0x92, 0x05, 0x5c, 0x67, 0x20,
+  0x67, 0xd2, 0x05, 0x9a, 0x16, 0x5b, 0x6d, 0x12, 0xd6, 0xca, 0xce, 0x14,
+  0x84, 0x69, 0xbb, 0x18, 0x30, 0x56, 0xb2, 0x01, 0x7b, 0xba, 0x1a, 0x23,
+  0xc1, 0x96, 0x82, 0xad, 0xae, 0x13, 0xd6, 0x6d, 0x7c, 0x60, 0xd4, 0x24,
+  0xac, 0x51, 0x90, 0xd7, 0xa8, 0x50, 0x4e, 0xd6, 0xce, 0x15, 0xaa, 0x6b,
+  0x28, 0x54, 0xd7, 0x2c, 0xf4, 0xba, 0xfd, 0x3e, 0x8a, 0x8b, 0x54, 0x8d,
+  0x60, 0x8c, 0x7f, 0xe1, 0x31, 0xfc, 0xdd, 0x6c, 0xbc, 0x2d, 0xbc, 0xf7,
+  0x6c, 0x6e, 0x24, 0x30, 0x0c, 0x6d, 0xc4, 0x68, 0xfc, 0x67, 0x78, 0x13,
+  0x06, 0xdd, 0xf0, 0xb9, 0x5a, 0x5f, 0x10, 0x80, 0xed, 0x40, 0xa6, 0xdb,
+  0xbf, 0x68, 0x9e, 0x2e, 0x05, 0x54, 0xfc, 0x11, 0x07, 0xfc, 0x02, 0x88,
+  0xc6, 0xfd, 0x3e, 0xb8, 0xf1, 0x61, 0x81, 0x38, 0x6e, 0xf8, 0xb4, 0x18,
+  0x4f, 0x8a, 0x4c, 0x6a, 0xac, 0x71, 0xcd, 0xdb, 0xb4, 0x47, 0x19, 0x3c,
+  0x70, 0x72, 0x36, 0x68, 0x64, 0xf2, 0xa1, 0xc1, 0x8a, 0x14, 0x27, 0x6c,
+  0x84, 0xd6, 0x67, 0x56, 0x97, 0xf2, 0x5a, 0xe1, 0x98, 0x31, 0x9e, 0x7f,
+  0x20, 0x97, 0x80, 0xd0, 0x1b, 0x92, 0xd8, 0x09, 0xa7, 0xd2, 0xba, 0x6b,
+  0x73, 0x19, 0x0a, 0x7a, 0x68, 0x52, 0x41, 0x43, 0xa1, 0x46, 0x22, 0x03,
+  0x0e, 0xfe, 0x52, 0x9b, 0x2a, 0xb0, 0xc1, 0xf8, 0xf1, 0x44, 0xd2, 0x97,
+  0xfe, 0x9a, 0x2a, 0x8b, 0xcb, 0x34, 0x2d, 0x6a, 0x37, 0x06, 0xa2, 0xe9,
+  0xb1, 0x3d, 0x0d, 0x7e, 0xe2, 0xf9, 0xf2, 0x0b, 0xc4, 0xec, 0x8f, 0xd6,
+  0xa5, 0x3b, 0x6c, 0xad, 0xd6, 0x9c, 0x58, 0x56, 0x16, 0xd1, 0xd5, 0xb1,
+  0xce, 0x13, 0xb4, 0x05, 0x49, 0x10, 0x77, 0x33, 0x9b, 0x2e, 0xac, 0x64,
+  0x3e, 0xfd, 0x70, 0xfa, 0xd9, 0xf4, 0xa1, 0xaa, 0x01, 0x39, 0xfd, 0xa0,
+  0xda, 0xfc, 0x85, 0xc0, 0x05, 0xa7, 0x91, 0x85, 0xf3, 0x88, 0xaa, 0x90,
+  0xb4, 0x2a, 0xcf, 0xeb, 0xcf, 0xc5, 0x0d, 0x90, 0xb1, 0x4c, 0x34, 0x89,
+  0x28, 0x0b, 0x81, 0x51, 0x3f, 0xf8, 0x99, 0x1c, 0xec, 0x99, 0x16, 0xad,
+  0x6a, 0xc1, 0xe3, 0xda, 0x9d, 0x38, 0xa3, 0x3e, 0x0a, 0x4f, 0x8b, 0x03,
+  0x9a, 0x36, 0x2a, 0x42, 0x3e, 0x51, 0x09, 0x74, 0x14, 0x70, 0x85, 0x69,
+  0xa5, 0xe0, 0xeb, 0xff, 0x83, 0x61, 0xd7, 0x07, 0x6f, 0x26, 0xd3, 0x8f,
+  0x01, 0xd2, 0x67, 0xf0, 0xe3, 0x83, 0xe9, 0x47, 0x58, 0x1f, 0xf6, 0xe0,
+  0xf5, 0x84, 0x8a, 0xc3, 0xbf, 0x8f, 0xe5, 0xe1, 0xb1, 0x76, 0x2c, 0xc5,
+  0x68, 0x63, 0x4d, 0xce, 0x83, 0x37, 0x0f, 0x7e, 0x22, 0xea, 0xc5, 0x8b,
+  0x00, 0xed, 0xe9, 0x23, 0x81, 0x05, 0xfc, 0xef, 0x91, 0x15, 0xa7, 0x4d,
+  0xeb, 0xc6, 0x4c, 0xa2, 0x10, 0x8d, 0xe8, 0x7c, 0x4f, 0xdb, 0xfa, 0x82,
+  0xc1, 0x26, 0xd4, 0x0f, 0x6c, 0xf2, 0x48, 0xe0, 0x85, 0x36, 0xd9, 0xa6,
+  0xd6, 0xca, 0x81, 0x68, 0x05, 0xf6, 0x58, 0x0b, 0x59, 0x6e, 0x8f, 0x0d,
+  0x09, 0x78, 0x52, 0xd3, 0x1c, 0xdc, 0xa4, 0xfe, 0xae, 0x70, 0x81, 0x9e,
+  0x15, 0xf2, 0x21, 0x79, 0x51, 0x87, 0xf6, 0x81, 0x17, 0x93, 0x74, 0x7c,
+  0xe3, 0x13, 0xb3, 0xe0, 0x0f, 0x8f, 0x0b, 0xba, 0xb3, 0x0d, 0xce, 0x81,
+  0x78, 0x56, 0xdc, 0x7e, 0x1b, 0xd7, 0x06, 0x27, 0x41, 0x52, 0x6e, 0xc6,
+  0x87, 0x17, 0x11, 0xe9, 0x4c, 0xe8, 0xd1, 0xba, 0x36, 0x85, 0xa8, 0xbb,
+  0x0a, 0xb7, 0xfc, 0x0a, 0x99, 0xce, 0xbb, 0xf8, 0xf0, 0x26, 0x78, 0x42,
+  0x37, 0x8d, 0x8b, 0xa3, 0xb9, 0xae, 0xf1, 0x46, 0xfa, 0xd3, 0xa6, 0x6d,
+  0xc0, 0x08, 0x34, 0xb5, 0x80, 0xd8, 0x29, 0x6f, 0x25, 0x1f, 0xba, 0x50,
+  0xe5, 0x86, 0x2f, 0x57, 0x83, 0x52, 0x82, 0x49, 0xa5, 0x5f, 0x4d, 0x27,
+  0x01, 0x75, 0x61, 0xb9, 0x29, 0x9e, 0xe1, 0xc2, 0x76, 0x79, 0x38, 0x32,
+  0xca, 0x38, 0x56, 0xc9, 0x5a, 0x99, 0x0e, 0x82, 0x72, 0x9f, 0x32, 0xd3,
+  0xcc, 0x19, 0xe3, 0xe3, 0xcd, 0x15, 0xe0, 0x93, 0x69, 0xc3, 0x03, 0xd9,
+  0xb4, 0x5a, 0x61, 0x18, 0xc4, 0x28, 0x27, 0x07, 0x55, 0x8a, 0x59, 0x75,
+  0xee, 0xd4, 0x76, 0xe3, 0x55, 0x59, 0xff, 0xb6, 0x6a, 0x7b, 0x0c, 0x2e,
+  0xc0, 0xc2, 0x4f, 0x70, 0xf1, 0xaf, 0xf8, 0x05, 0x5a, 0x00, 0xaa, 0x22,
+  0xc3, 0xd5, 0xae, 0x45, 0xdf, 0x84, 0x4b, 0x0b, 0x87, 0x0f, 0x11, 0x69,
+  0xcc, 0xb5, 0xaf, 0x91, 0xd5, 0x35, 0x3c, 0xeb, 0x95, 0xb8, 0xe2, 0xba,
+  0xb5, 0x1c, 0xf4, 0x3a, 0xb0, 0x75, 0x34, 0xae, 0x48, 0x5b, 0xc0, 0x30,
+  0xc3, 0x85, 0x5a, 0xce, 0xf7, 0xfb, 0x8e, 0x66, 0x9d, 0x0d, 0xc6, 0x52,
+  0x12, 0x4a, 0x93, 0x8b, 0xb8, 0x84, 0x6f, 0x77, 0x73, 0x95, 0xf1, 0x56,
+  0x99, 0x5a, 0x0a, 0xcb, 0xfe, 0x7d, 0xc5, 0xd3, 0x8c, 0x24, 0x6e, 0xda,
+  0x39, 0xa5, 0x0f, 0x11, 0x5e, 0x54, 0x67, 0x1d, 0x95, 0xa4, 0x50, 0x4d,
+  0x90, 0x7e, 0x67, 0x05, 0x2e, 0x0a, 0x99, 0xa7, 0xb8, 0xb0, 0x8c, 0xb0,
+  0x23, 0xa9, 0xbb, 0x0c, 0xee, 0x82, 0x5b, 0xd4, 0xfe, 0xf6, 0xb2, 0x9d,
+  0x35, 0xdd, 0xc8, 0xb8, 0xa5, 0x13, 0x17, 0x92, 0x9a, 0xd7, 0x9b, 0xe7,
+  0xa4, 0x30, 0x41, 0x22, 0x32, 0x47, 0x86, 0x84, 0x3c, 0x83, 0x7a, 0x09,
+  0x70, 0x2e, 0xb0, 0x5a, 0x40, 0xb5, 0xc4, 0x68, 0x8d, 0x54, 0x4f, 0xf8,
+  0x99, 0xa4, 0x0c, 0x72, 0x40, 0x94, 0x32, 0x1d, 0xa0, 0x08, 0xa4, 0x84,
+  0x1b, 0xab, 0x03, 0x76, 0xea, 0x55, 0x5d, 0xd1, 0x1c, 0xba, 0xb2, 0x17,
+  0xdb, 0x6e, 0xaa, 0x26, 0xdb, 0x27, 0x9d, 0x38, 0xa5, 0x80, 0xed, 0x13,
+  0x26, 0x0c, 0xd7, 0x22, 0xca, 0xc5, 0x3d, 0x74, 0xbb, 0x10, 0x4a, 0x58,
+  0x5b, 0x99, 0x4f, 0x6e, 0x34, 0xe4, 0x43, 0x33, 0xe2, 0xe2, 0x37, 0xcb,
+  0x35, 0xce, 0xbe, 0x66, 0x0a, 0x22, 0x56, 0xdd, 0x7c, 0x9d, 0x57, 0x37,
+  0x5f, 0x4a, 0xa6, 0xbf, 0x82, 0xbf, 0x3f, 0x13, 0x52, 0xf9, 0x24, 0x99,
+  0x3e, 0x06, 0x89, 0x49, 0x14, 0x3c, 0xff, 0xc9, 0xf4, 0x43, 0x10, 0xa3,
+  0x40, 0x88, 0x12, 0x32, 0x13, 0x8a, 0x56, 0x6f, 0x90, 0xb0, 0x85, 0xaf,
+  0xe0, 0xdf, 0xe4, 0xe0, 0x75, 0x14, 0x8b, 0x4f, 0xac, 0x5b, 0x15, 0xce,
+  0x13, 0xbe, 0xb9, 0x78, 0xa9, 0xd2, 0x40, 0xbd, 0x6f, 0x7b, 0x68, 0x96,
+  0x77, 0x4e, 0xa7, 0x23, 0x96, 0x7b, 0x4b, 0x27, 0xd3, 0xd7, 0x8b, 0xb6,
+  0x85, 0x03, 0x36, 0xec, 0xab, 0xc5, 0xe6, 0xb8, 0xa5, 0x27, 0x65, 0xce,
+  0xf8, 0x53, 0x4d, 0x8c, 0x1a, 0x56, 0xa1, 0x16, 0x28, 0x57, 0x04, 0xaf,
+  0x2e, 0xa0, 0x37, 0xc0, 0x66, 0xb7, 0x2f, 0xad, 0x2d, 0x2a, 0xad, 0x28,
+  0x37, 0xc0, 0x58, 0x6a, 0x5b, 0xd7, 0x00, 0xc3, 0xbb, 0x71, 0x61, 0x51,
+  0x50, 0x2f, 0x6a, 0x94, 0x47, 0x3b, 0x8d, 0xda, 0xf4, 0x1f, 0xe1, 0x36,
+  0x21, 0x62, 0xca, 0x54, 0x45, 0x79, 0xaa, 0x1e, 0xff, 0x01, 0x0a, 0xae,
+  0x07, 0x3f, 0x45, 0xa1, 0xf6, 0x73, 0x14, 0x64, 0xe1, 0xc1, 0x87, 0x40,
+  0xe2, 0xdf, 0x82, 0x00, 0xfb, 0x16, 0xfc, 0xf5, 0xf1, 0xf4, 0xb1, 0x53,
+  0x69, 0x1e, 0xa4, 0x5e, 0x90, 0x6b, 0x3b, 0x30, 0x87, 0xf4, 0xe4, 0x7d,
+  0x4a, 0x40, 0xf4, 0x3b, 0x00, 0x08, 0x92, 0xee, 0xb9, 0x9a, 0xb6, 0x98,
+  0x39, 0x5a, 0xea, 0xb0, 0x9a, 0xdd, 0x59, 0x69, 0xc6, 0xe2, 0x7a, 0xc8,
+  0x6a, 0xa1, 0xe8, 0x46, 0xa0, 0xfa, 0x58, 0x1b, 0xca, 0x73, 0x4b, 0xaa,
+  0x98, 0x75, 0x48, 0x20, 0x5f, 0x97, 0x35, 0xbc, 0x66, 0x99, 0xd1, 0x89,
+  0xe1, 0xbe, 0x01, 0x32, 0xfe, 0x0f, 0x69, 0xa1, 0x11, 0xad, 0x0e, 0xde,
+  0x26, 0x0a, 0x10, 0x79, 0x7e, 0x4c, 0x01, 0x79, 0x62, 0xbb, 0x5b, 0x56,
+  0x48, 0x55, 0xed, 0x93, 0x32, 0x55, 0x37, 0x6a, 0xf1, 0x72, 0x9f, 0x8a,
+  0x55, 0xd8, 0x58, 0x58, 0xbb, 0x03, 0x11, 0x80, 0x8e, 0xdf, 0xc7, 0x3d,
+  0xa2, 0xae, 0x7e, 0x94, 0xe9, 0x09, 0x2f, 0x1c, 0x30, 0x2f, 0xef, 0x20,
+  0x12, 0x35, 0x6b, 0x07, 0x04, 0xaa, 0x1a, 0xf8, 0x0b, 0x42, 0x5b, 0xa3,
+  0xab, 0x04, 0x48, 0x8c, 0xd2, 0x8d, 0xe1, 0x70, 0xac, 0x63, 0x22, 0x26,
+  0xcc, 0x53, 0xfb, 0x68, 0x06, 0x04, 0xdf, 0xfc, 0x43, 0xdc, 0x48, 0xcc,
+  0x4e, 0xc8, 0x31, 0xc0, 0xb7, 0x72, 0x3b, 0x16, 0x4b, 0x0a, 0xd5, 0x0f,
+  0x9e, 0xca, 0x05, 0x0b, 0x2f, 0x8e, 0xbb, 0x35, 0x4a, 0x59, 0x96, 0xf0,
+  0x58, 0x90, 0x9e, 0x73, 0x67, 0xdd, 0xdf, 0x92, 0x34, 0xc7, 0xfa, 0xd1,
+  0xc1, 0xdb, 0x35, 0x67, 0xac, 0x61, 0x15, 0x5b, 0x7a, 0x6f, 0xb3, 0xbf,
+  0xd7, 0x93, 0x36, 0x20, 0x79, 0xee, 0xb7, 0x17, 0x2c, 0xb1, 0x24, 0x4f,
+  0x7b, 0x52, 0x4b, 0x17, 0x17, 0x73, 0x55, 0x51, 0xa5, 0xc6, 0xab, 0xc0,
+  0xe9, 0x7a, 0xc2, 0xb0, 0x02, 0xff, 0x92, 0x21, 0xd0, 0xeb, 0x42, 0x84,
+  0x1f, 0x09, 0x95, 0x8f, 0x74, 0x0c, 0xc1, 0x03, 0x82, 0x9d, 0xb8, 0xc6,
+  0x08, 0xe8, 0x74, 0xb9, 0xeb, 0xe9, 0x8a, 0xec, 0x0a, 0xb6, 0xd7, 0x36,
+  0x37, 0xf7, 0x76, 0x33, 0x8a, 0x42, 0x50, 0x78, 0x83, 0xc0, 0x42, 0xfd,
+  0xe7, 0x0d, 0x73, 0xf0, 0xa0, 0x50, 0x25, 0x2e, 0x56, 0x67, 0x92, 0x75,
+  0x3c, 0x13, 0xc5, 0x71, 0xb2, 0xce, 0x8f, 0x25, 0x05, 0xaa, 0x29, 0x5b,
+  0xbe, 0x00, 0x47, 0x76, 0xd2, 0x88, 0x1d, 0x38, 0xcd, 0x5a, 0xd8, 0x91,
+  0x8c, 0xce, 0xfb, 0x25, 0x3a, 0x02, 0x94, 0x7b, 0x02, 0x42, 0x5b, 0x12,
+  0xff, 0xe8, 0xe3, 0x42, 0x6a, 0xac, 0x96, 0xd8, 0x10, 0x5a, 0xb6, 0x9b,
+  0x97, 0xef, 0x03, 0xe3, 0x5a, 0x6d, 0x78, 0x31, 0x58, 0x47, 0xef, 0x1b,
+  0x3e, 0xe7, 0x6d, 0x15, 0xaf, 0x16, 0x80, 0xe9, 0x1a, 0x27, 0x07, 0x10,
+  0xd4, 0xe4, 0x86, 0x1e, 0x9e, 0x51, 0x0a, 0x5e, 0xbc, 0xd0, 0x92, 0x2c,
+  0x4c, 0xd7, 0x59, 0xa9, 0xf3, 0xf5, 0x33, 0x2b, 0xc4, 0x52, 0x73, 0x5b,
+  0x72, 0xaa, 0xc8, 0xd3, 0x4d, 0xf8, 0xa1, 0xd6, 0x4f, 0xde, 0x78, 0x6f,
+  0x27, 0xb6, 0xbb, 0x8d, 0xf2, 0x08, 0x0c, 0x79, 0x6a, 0xc4, 0x50, 0x95,
+  0x18, 0x02, 0xae, 0xbf, 0xff, 0xfb, 0x47, 0x84, 0xe9, 0xef, 0xff, 0xfe,
+  0xd3, 0x9a, 0x2f, 0xb4, 0x1b, 0x3b, 0x85, 0xbc, 0x85, 0x30, 0x6f, 0x4f,
+  0x4a, 0x46, 0x2d, 0x7e, 0xc6, 0x72, 0x34, 0xea, 0x1d, 0xee, 0x5b, 0xd8,
+  0x2c, 0x36, 0xa4, 0x2d, 0x17, 0x87, 0xeb, 0xc5, 0x78, 0x2f, 0xa9, 0x20,
+  0x5f, 0x21, 0xe7, 0x6d, 0x01, 0xb8, 0xab, 0x40, 0x8f, 0xf3, 0xec, 0x31,
+  0xb3, 0xf2, 0xda, 0xad, 0xcf, 0x98, 0x8d, 0xef, 0x30, 0x9b, 0xab, 0xc3,
+  0x64, 0x6b, 0x94, 0xa6, 0xe4, 0x00, 0x67, 0xba, 0x20, 0x7f, 0x07, 0xf4,
+  0xab, 0xa0, 0xc5, 0x74, 0xa2, 0xf0, 0x50, 0x11, 0xd8, 0xa9, 0xaa, 0x86,
+  0xa5, 0x57, 0x05, 0x93, 0xd0, 0x7d, 0x5f, 0xf9, 0x45, 0xc4, 0x79, 0xae,
+  0x82, 0xda, 0xe4, 0x84, 0xd8, 0xe9, 0xde, 0x13, 0x9e, 0xe6, 0x41, 0x83,
+  0xcc, 0x08, 0x6e, 0xcc, 0x9b, 0x69, 0xa3, 0x01, 0xad, 0x94, 0x17, 0x07,
+  0xb2, 0x92, 0x2b, 0xdd, 0xf1, 0x36, 0x30, 0x97, 0x7b, 0xec, 0x79, 0x47,
+  0x24, 0x2e, 0x9c, 0x6f, 0xb6, 0x12, 0x51, 0x7c, 0x53, 0xa1, 0x24, 0x6c,
+  0x25, 0xa2, 0x9b, 0x17, 0x92, 0x05, 0x19, 0x52, 0x2c, 0xdf, 0xd9, 0xf7,
+  0x9b, 0x40, 0xa5, 0x65, 0xab, 0xc8, 0x63, 0x15, 0x5b, 0x9f, 0x1e, 0xa4,
+  0x63, 0xee, 0x93, 0x2e, 0xbd, 0xa1, 0x51, 0x8a, 0x57, 0x35, 0x6e, 0x22,
+  0x10, 0x8f, 0x58, 0xc5, 0xdd, 0x5a, 0x82, 0x79, 0x9e, 0x9a, 0x36, 0xf6,
+  0xe2, 0x06, 0xc5, 0x17, 0xc7, 0x72, 0xec, 0x30, 0x14, 0x42, 0xb0, 0xfa,
+  0xb2, 0xfc, 0x8c, 0x8e, 0x54, 0xcd, 0xd5, 0xb3, 0xad, 0x4e, 0xa0, 0x42,
+  0x3b, 0x5a, 0x1b, 0xc9, 0x6d, 0x7f, 0xe6, 0x58, 0xec, 0x67, 0xe0, 0x29,
+  0xaa, 0x53, 0x56, 0x00, 0x40, 0xa4, 0x90, 0x21, 0xa0, 0x46, 0x3c, 0x94,
+  0x0f, 0x3a, 0x40, 0xcc, 0x61, 0xbf, 0x0f, 0x37, 0xcb, 0xe1, 0x77, 0xb2,
+  0x74, 0x1f, 0x84, 0x9e, 0x8d, 0x74, 0xbb, 0x7b, 0x37, 0x1b, 0x8e, 0x80,
+  0x85, 0xe4, 0x3b, 0x20, 0xf6, 0x6c, 0xc3, 0x46, 0x20, 0xee, 0x02, 0x0f,
+  0x84, 0x7f, 0x46, 0x4d, 0x07, 0x4a, 0xf8, 0xdc, 0x40, 0x75, 0xcf, 0x3d,
+  0xd4, 0xd0, 0x89, 0x74, 0xde, 0x0d, 0x04, 0x76, 0x3c, 0x35, 0x08, 0xaf,
+  0xc3, 0x79, 0x3a, 0x30, 0xc3, 0xbc, 0x8c, 0x68, 0x50, 0x49, 0x1f, 0xcc,
+  0xbd, 0x57, 0xbe, 0xc1, 0x1a, 0x16, 0x96, 0xc7, 0x8e, 0x5e, 0xf8, 0x7a,
+  0x09, 0x32, 0xbc, 0x1d, 0x94, 0xc3, 0xcc, 0x67, 0x06, 0xc1, 0xa2, 0x44,
+  0x40, 0x60, 0xee, 0x56, 0xb8, 0x62, 0x87, 0x5b, 0x21, 0x59, 0xa1, 0xc9,
+  0x06, 0x7d, 0x22, 0x2c, 0x11, 0x34, 0x99, 0x36, 0x8f, 0x8e, 0xee, 0xdd,
+  0x6c, 0x10, 0x76, 0x48, 0x6a, 0x2f, 0xd8, 0x23, 0xe4, 0xc6, 0xe1, 0xc3,
+  0x1e, 0x0f, 0xa2, 0x8c, 0x4a, 0x89, 0xd5, 0xd8, 0xba, 0xff, 0x85, 0x5b,
+  0x87, 0x02, 0x1f, 0xe2, 0x5b, 0xd1, 0xab, 0x56, 0x2e, 0x36, 0xb0, 0x35,
+  0x3d, 0x5f, 0xee, 0xb3, 0xe4, 0x29, 0x31, 0xf8, 0xd0, 0xd1, 0x23, 0x57,
+  0x10, 0x08, 0x67, 0x9a, 0xdd, 0x2b, 0xb6, 0x6b, 0x6c, 0xc1, 0x21, 0x2e,
+  0xcf, 0x3d, 0x9a, 0x5b, 0x11, 0x26, 0xed, 0x30, 0x68, 0xc9, 0x9c, 0x91,
+  0x31, 0xab, 0x52, 0xbc, 0xe8, 0x60, 0xc3, 0xa9, 0x2b, 0xeb, 0x2e, 0x68,
+  0x25, 0x82, 0x55, 0x42, 0x5d, 0xe9, 0x13, 0xac, 0x87, 0x4a, 0xf5, 0x60,
+  0xa2, 0x84, 0x26, 0x05, 0x2b, 0xe9, 0xbf, 0x58, 0xfa, 0xb3, 0x61, 0xe9,
+  0xa8, 0x0f, 0x76, 0x7d, 0x19, 0x05, 0xa9, 0x90, 0xed, 0x4a, 0x56, 0x92,
+  0x18, 0x26, 0x6c, 0x71, 0x14, 0x16, 0xdc, 0x11, 0xaf, 0x82, 0x42, 0xfe,
+  0x5b, 0x4e, 0x09, 0x91, 0x09, 0xf3, 0xf1, 0xc3, 0xde, 0x4e, 0x9c, 0xe1,
+  0x3d, 0xcc, 0xa6, 0xd1, 0xfd, 0x0f, 0xa0, 0xd0, 0x35, 0x5a, 0xda, 0x72,
+  0xbc, 0x0b, 0x35, 0xba, 0x88, 0xb6, 0x54, 0xe8, 0xfe, 0xe1, 0xea, 0x73,
+  0x47, 0x01, 0xe9, 0x95, 0xfd, 0x62, 0xb6, 0x3f, 0x29, 0x24, 0xea, 0xa3,
+  0xd2, 0x31, 0x20, 0x9f, 0x81, 0x03, 0x81, 0x51, 0xd6, 0xd7, 0x76, 0x7b,
+  0x36, 0xde, 0x33, 0x8c, 0x54, 0xbc, 0x09, 0x1b, 0xa5, 0xfa, 0x53, 0x22,
+  0x5b, 0xb4, 0x36, 0xa1, 0x35, 0xfd, 0xa6, 0xa6, 0x4e, 0x46, 0x85, 0x6a,
+  0x42, 0x93, 0x15, 0x72, 0x7e, 0xf4, 0x45, 0x1e, 0x5e, 0xe0, 0x47, 0x5a,
+  0xe2, 0xc5, 0xcb, 0xfb, 0xe8, 0x0b, 0xbc, 0x68, 0x71, 0x1f, 0x6d, 0x79,
+  0x17, 0x2c, 0xed, 0x23, 0x2c, 0xee, 0xa2, 0x85, 0x5d, 0x71, 0x69, 0x47,
+  0x16, 0xf7, 0xec, 0xcb, 0xbb, 0xd2, 0x02, 0x2f, 0x5c, 0xe2, 0xcc, 0x1e,
+  0x60, 0x84, 0x92, 0x5b, 0xa8, 0x98, 0x1d, 0x0e, 0xb6, 0x40, 0xd4, 0x1b,
+  0x83, 0xe8, 0xb0, 0x29, 0xff, 0x94, 0x95, 0x52, 0x6e, 0x5b, 0x16, 0x00,
+  0xd5, 0xcc, 0x88, 0x99, 0xfc, 0x63, 0xc5, 0xee, 0x45, 0xe8, 0x72, 0x0d,
+  0x7b, 0x57, 0xd0, 0x72, 0x2c, 0x8b, 0x47, 0xfa, 0xe6, 0xa5, 0xef, 0x0d,
+  0x6a, 0x20, 0xed, 0x38, 0xdd, 0x84, 0xa5, 0xb2, 0xd2, 0x52, 0x55, 0x17,
+  0xad, 0x7d, 0x57, 0x0f, 0x5d, 0x5c, 0x5d, 0x3b, 0xba, 0x16, 0x54, 0x0e,
+  0xaf, 0xd7, 0x9f, 0xa5, 0x82, 0x92, 0x27, 0xab, 0x0a, 0x94, 0xf5, 0xd0,
+  0x64, 0x2d, 0xa2, 0x7c, 0x6f, 0x73, 0x33, 0xcd, 0xf3, 0x2d, 0x38, 0x34,
+  0xef, 0x1f, 0xbf, 0x3a, 0x9f, 0xec, 0x3d, 0x4b, 0x66, 0x34, 0xac, 0xaa,
+  0x08, 0xc8, 0x61, 0xf9, 0x98, 0x8b, 0xc6, 0x93, 0xb2, 0xa3, 0xbc, 0xdf,
+  0xef, 0xee, 0xe6, 0x4a, 0xc8, 0x10, 0xca, 0x65, 0x63, 0xbd, 0x75, 0x90,
+  0x16, 0x6d, 0x8d, 0x2a, 0x9c, 0x87, 0x4e, 0x4d, 0xe6, 0x2a, 0xdf, 0x26,
+  0x0a, 0x3a, 0x3d, 0x0e, 0xfd, 0xe4, 0x53, 0x55, 0x22, 0x32, 0xfd, 0x27,
+  0xae, 0xb3, 0x88, 0xee, 0x50, 0x5a, 0xfa, 0x0b, 0x35, 0xa4, 0x15, 0x03,
+  0xc8, 0x5c, 0x6d, 0x63, 0x7c, 0x16, 0x18, 0xed, 0xb4, 0x03, 0x4d, 0x1e,
+  0xa5, 0x00, 0x77, 0x02, 0xb0, 0x22, 0x5b, 0x12, 0xaf, 0xa4, 0xe8, 0x1c,
+  0x73, 0xe6, 0xc9, 0x2b, 0x79, 0x05, 0xf8, 0xce, 0x00, 0xcb, 0x95, 0x96,
+  0x5b, 0xd0, 0xf4, 0x12, 0xf2, 0x86, 0x38, 0x06, 0xb3, 0x4b, 0xd1, 0x6a,
+  0x75, 0x36, 0x9c, 0xb2, 0x78, 0x0a, 0x7c, 0xfa, 0x62, 0x5b, 0x86, 0xa3,
+  0xda, 0x0c, 0x4b, 0x65, 0xd3, 0x01, 0xa7, 0xc4, 0x4d, 0x2c, 0x53, 0x2b,
+  0x85, 0x6b, 0xed, 0xb0, 0xa1, 0x5b, 0xf3, 0x84, 0x48, 0x7d, 0xb1, 0xa1,
+  0x39, 0x3b, 0x45, 0xcf, 0x68, 0x8b, 0xfd, 0x22, 0xd7, 0x2d, 0xb8, 0x9e,
+  0x55, 0x0b, 0x64, 0x11, 0x27, 0x98, 0x3e, 0xcd, 0xb8, 0xdc, 0x88, 0xbe,
+  0x6a, 0xc2, 0xe3, 0x3a, 0x14, 0x4e, 0x60, 0x5d, 0xc3, 0x84, 0x93, 0x77,
+  0x2c, 0x20, 0x01, 0x01, 0x39, 0xea, 0x48, 0x16, 0xfb, 0xa1, 0xe8, 0x72,
+  0x0b, 0xfe, 0xb8, 0x6d, 0x2e, 0x5d, 0x0e, 0x65, 0x84, 0xc5, 0x9d, 0xa5,
+  0x81, 0xb0, 0x3e, 0xe3, 0x21, 0x53, 0x0b, 0x56, 0xda, 0x07, 0x97, 0x88,
+  0x18, 0xd6, 0xf1, 0xbd, 0x81, 0xb1, 0xe4, 0x90, 0x72, 0x29, 0xd9, 0xb8,
+  0x0f, 0xc4, 0x64, 0xe9, 0x4c, 0x12, 0x1b, 0xba, 0x22, 0xa5, 0x4a, 0xf3,
+  0x11, 0x02, 0xfa, 0xfb, 0xd7, 0x7f, 0x23, 0x53, 0xc4, 0x4c, 0x00, 0x94,
+  0x93, 0x1d, 0xc2, 0x05, 0x48, 0x57, 0x67, 0xa0, 0x0c, 0x12, 0x6e, 0x92,
+  0x34, 0x24, 0x89, 0x9a, 0x56, 0x65, 0xd1, 0x48, 0x0f, 0xce, 0x27, 0x1a,
+  0x6d, 0xa7, 0x66, 0xad, 0xd5, 0x1f, 0xfa, 0x08, 0x05, 0x7a, 0xbb, 0x6d,
+  0xeb, 0xe4, 0x54, 0xb4, 0x5a, 0xe8, 0xf8, 0x97, 0x8a, 0xad, 0x5b, 0x4a,
+  0xeb, 0x50, 0xbb, 0xbd, 0xec, 0xe8, 0xbc, 0x6e, 0x91, 0xca, 0xc0, 0x13,
+  0x35, 0x3c, 0xd3, 0xa2, 0xf0, 0xfc, 0xd2, 0x8b, 0x49, 0x04, 0x04, 0xb3,
+  0x18, 0x4f, 0xf1, 0xa0, 0x83, 0x28, 0x8a, 0xa6, 0xb7, 0xe6, 0x6f, 0x2b,
+  0xb5, 0x56, 0x52, 0xbb, 0xf8, 0xad, 0xb5, 0x85, 0x85, 0xda, 0x72, 0xb4,
+  0xed, 0x82, 0xdd, 0x76, 0x71, 0xb1, 0xa0, 0xed, 0x22, 0x6b, 0x7b, 0x75,
+  0xed, 0x42, 0x41, 0xcb, 0x53, 0xac, 0xe5, 0xda, 0xb5, 0x9b, 0x17, 0xbe,
+  0xf5, 0xea, 0x37, 0xaf, 0x5e, 0x2c, 0x68, 0xff, 0x35, 0xd6, 0xfe, 0xfc,
+  0xd5, 0xf3, 0xaf, 0x5c, 0xfb, 0x66, 0x8d, 0x05, 0xd3, 0xd6, 0x6e, 0x0e,
+  0x5e, 0x1b, 0x0c, 0xf7, 0x07, 0x4e, 0xbc, 0x7a, 0xce, 0x69, 0x83, 0x2e,
+  0x71, 0x8c, 0x3e, 0x2d, 0xda, 0x8c, 0xf8, 0x40, 0x52, 0xca, 0xeb, 0x13,
+  0xa7, 0x58, 0x4e, 0x4e, 0xe0, 0x1f, 0x9a, 0xad, 0x7c, 0x3f, 0x1b, 0x6f,
+  0x6e, 0x27, 0x0d, 0x0e, 0x8a, 0xd6, 0x1a, 0x26, 0xc2, 0x91, 0x94, 0x5d,
+  0x32, 0x4e, 0x0e, 0xde, 0x2c, 0x38, 0x7e, 0x2f, 0x1b, 0x20, 0x57, 0xbd,
+  0xb6, 0x6c, 0x43, 0x00, 0x7a, 0xc7, 0x21, 0x2c, 0x94, 0x42, 0xc0, 0x59,
+  0x88, 0x7f, 0xbf, 0x58, 0xfa, 0xbd, 0x99, 0x9b, 0x38, 0x94, 0x53, 0xa5,
+  0x50, 0xe4, 0x8c, 0xc5, 0x41, 0x7c, 0x2d, 0x0a, 0x62, 0xe2, 0xae, 0x76,
+  0x8a, 0xbe, 0x88, 0x98, 0xd2, 0x05, 0x34, 0xdb, 0x96, 0xee, 0x2b, 0x55,
+  0x05, 0x84, 0xa8, 0x5e, 0x4c, 0x9a, 0xd3, 0xa5, 0x1e, 0xe6, 0x6c, 0xe2,
+  0x38, 0xa9, 0x73, 0x4d, 0x25, 0x72, 0x3a, 0x82, 0xb6, 0xd2, 0x0b, 0xc0,
+  0x93, 0x91, 0xf9, 0x55, 0x8d, 0xf4, 0x0c, 0x79, 0x66, 0xa5, 0xcf, 0xe5,
+  0x5a, 0x3c, 0xab, 0xa8, 0x26, 0x44, 0x86, 0x9e, 0x65, 0xa9, 0x77, 0x86,
+  0x46, 0x1f, 0x0a, 0xef, 0xe8, 0x32, 0x2b, 0xbd, 0xc2, 0xde, 0xe8, 0xe5,
+  0xe9, 0x3b, 0x11, 0xe9, 0xec, 0x99, 0xeb, 0xf1, 0xc0, 0xc1, 0xb7, 0xec,
+  0x40, 0x02, 0xee, 0x27, 0x58, 0xbf, 0x78, 0x83, 0x07, 0x40, 0x93, 0x9f,
+  0x45, 0xdc, 0x98, 0xff, 0x80, 0x9b, 0xe1, 0x85, 0x51, 0xff, 0xd6, 0xf4,
+  0x1f, 0xa6, 0x7f, 0x33, 0xfd, 0xe5, 0xf4, 0xdf, 0xa6, 0xbf, 0xb9, 0x5d,
+  0xb3, 0x3c, 0xbe, 0xc2, 0xc6, 0x7c, 0x85, 0x5d, 0x35, 0x8b, 0x3e, 0x53,
+  0xc4, 0x06, 0x8d, 0xf9, 0xb2, 0x56, 0xeb, 0x78, 0x53, 0x14, 0xba, 0xfa,
+  0x4e, 0x96, 0x67, 0x1b, 0x59, 0x3f, 0x1b, 0x07, 0xcc, 0xfa, 0x62, 0xb1,
+  0x96, 0xe4, 0xdf, 0x5e, 0x17, 0x73, 0xd4, 0xc6, 0xc6, 0x41, 0xe9, 0x79,
+  0xa0, 0xba, 0xaa, 0x00, 0x04, 0xda, 0xca, 0xea, 0x56, 0x6e, 0xca, 0x1c,
+  0x4a, 0x99, 0x65, 0xf0, 0x01, 0x79, 0x59, 0xc3, 0xe5, 0x46, 0x17, 0xd3,
+  0x84, 0xbb, 0x3e, 0x22, 0x47, 0x60, 0x8a, 0x58, 0xf5, 0x61, 0x71, 0x92,
+  0x0b, 0xe7, 0x28, 0x2c, 0xf8, 0xca, 0x2a, 0xa0, 0xed, 0x6e, 0x5f, 0x41,
+  0xef, 0x8b, 0xdb, 0xe3, 0x67, 0x45, 0xef, 0x9e, 0xea, 0xaa, 0x02, 0x10,
+  0x68, 0x5b, 0x99, 0xde, 0x1a, 0x6e, 0x39, 0xbd, 0xc5, 0x29, 0x80, 0x72,
+  0x5b, 0xf4, 0x3d, 0xf0, 0x78, 0x56, 0x52, 0x5c, 0x81, 0x9e, 0x69, 0x46,
+  0x0a, 0xbe, 0x2a, 0x9c, 0x91, 0x40, 0x8e, 0x90, 0x23, 0x87, 0xf5, 0x4b,
+  0xbe, 0x17, 0x88, 0xeb, 0x17, 0x95, 0x4c, 0x02, 0x4e, 0xde, 0x95, 0x72,
+  0xc6, 0xf8, 0xa9, 0x4e, 0x96, 0xdd, 0x0c, 0x2b, 0x6e, 0xda, 0x3b, 0x8c,
+  0x07, 0xbe, 0x98, 0xdd, 0x65, 0x49, 0x65, 0x62, 0xd9, 0x63, 0xb0, 0xa5,
+  0xc9, 0x12, 0x27, 0x6e, 0xf6, 0xf4, 0x2d, 0x97, 0x7d, 0xe5, 0xa3, 0x40,
+  0xc2, 0x00, 0x2a, 0xda, 0x15, 0x1a, 0xf7, 0x59, 0x2b, 0x09, 0x00, 0xaf,
+  0x07, 0x60, 0x55, 0x4b, 0xa7, 0x2f, 0x2f, 0x1c, 0x03, 0x75, 0x5d, 0x50,
+  0x4d, 0xa6, 0x2d, 0x72, 0xdf, 0x55, 0xcd, 0xae, 0x20, 0xbf, 0x0b, 0xa4,
+  0x57, 0x90, 0x6f, 0x82, 0xf9, 0x15, 0x0a, 0x7b, 0x9b, 0x39, 0xcd, 0xc2,
+  0xf4, 0xd7, 0xe4, 0x5a, 0x87, 0x4e, 0x9e, 0xaf, 0x1f, 0xbc, 0x4d, 0x3e,
+  0xc6, 0x09, 0x85, 0xd9, 0x29, 0x2f, 0x50, 0x72, 0xbc, 0x2b, 0xca, 0xb8,
+  0x50, 0x94, 0x5c, 0xc1, 0xe4, 0x66, 0xaa, 0xec, 0x1c, 0x29, 0x87, 0xf7,
+  0x74, 0xd2, 0x2b, 0xa8, 0x95, 0xee, 0xe4, 0x57, 0x88, 0x91, 0x5f, 0x5f,
+  0x4c, 0x95, 0x6c, 0x1b, 0xbe, 0x99, 0xf6, 0xb3, 0xc1, 0x6b, 0xf2, 0xc8,
+  0x2f, 0x90, 0x7e, 0x06, 0x3d, 0xe5, 0x35, 0x2e, 0x5d, 0x11, 0x3c, 0xc1,
+  0xc3, 0xbd, 0xeb, 0x72, 0xb8, 0xe7, 0xf8, 0x2f, 0xd2, 0xe6, 0x2e, 0x25,
+  0xf5, 0xab, 0x27, 0xcf, 0xd7, 0xf9, 0x67, 0x92, 0xea, 0x6b, 0xfa, 0x3a,
+  0x1c, 0xbe, 0xc2, 0x58, 0xae, 0xee, 0x2b, 0x57, 0xbf, 0x73, 0xfe, 0x95,
+  0x95, 0x8b, 0xaf, 0xae, 0x5e, 0xba, 0xba, 0x7a, 0xed, 0xc6, 0xab, 0xf0,
+  0xe3, 0xe6, 0x25, 0x14, 0xf2, 0xbe, 0xf1, 0x8d, 0x97, 0x8c, 0xa4, 0x42,
+  0x7c, 0x55, 0xd4, 0xa8, 0x90, 0x4b, 0xda, 0xf2, 0x95, 0xdf, 0xc6, 0x71,
+  0x5b, 0x9d, 0xdb, 0x1c, 0x3a, 0xf4, 0x8a, 0x2e, 0x3c, 0xdc, 0x65, 0x7e,
+  0x7b, 0xec, 0x15, 0x72, 0x1f, 0xa7, 0x3b, 0xbb, 0xdf, 0xe9, 0xf6, 0x69,
+  0xee, 0x90, 0xcb, 0x0f, 0xb7, 0x14, 0xd1, 0x24, 0xc4, 0xef, 0x98, 0xe8,
+  0xcb, 0xc1, 0xde, 0xce, 0x06, 0x4c, 0x27, 0xb9, 0x79, 0x67, 0xf9, 0xd5,
+  0xee, 0xd5, 0x46, 0xa0, 0xa9, 0xcc, 0xd9, 0xed, 0x83, 0x38, 0x1b, 0xa4,
+  0x83, 0xad, 0xc0, 0xdf, 0xde, 0xdb, 0xc9, 0x7a, 0x70, 0xa8, 0x86, 0x31,
+  0x62, 0x6f, 0x4b, 0x51, 0xb2, 0xda, 0x72, 0x9c, 0x6c, 0x20, 0x31, 0xa4,
+  0xac, 0x0c, 0x9f, 0x8a, 0x42, 0x00, 0xc4, 0x42, 0x90, 0xf3, 0x57, 0x7b,
+  0xfa, 0x40, 0xdc, 0x0c, 0x90, 0xa0, 0x33, 0x1e, 0x5e, 0xce, 0xee, 0xa5,
+  0xbd, 0xc6, 0x42, 0x73, 0xf2, 0xef, 0x0f, 0x2f, 0x24, 0x27, 0x13, 0xdd,
+  0xcc, 0xc2, 0x8a, 0xb7, 0xfb, 0xa3, 0xf5, 0x40, 0x49, 0x2d, 0x8d, 0xd2,
+  0x11, 0x31, 0x08, 0xc1, 0x9e, 0x79, 0x84, 0xd5, 0x51, 0x8f, 0xc1, 0xaa,
+  0xb5, 0x4f, 0xb6, 0x6b, 0xce, 0x29, 0x63, 0x59, 0xdf, 0x8c, 0x90, 0xf2,
+  0xac, 0x97, 0xa7, 0x75, 0x84, 0x9a, 0x62, 0x69, 0x66, 0x9b, 0xd9, 0x32,
+  0xe9, 0x51, 0xe7, 0xc1, 0x9a, 0x09, 0xaf, 0x2f, 0x73, 0xa3, 0x0d, 0xee,
+  0x78, 0x79, 0x55, 0x3d, 0x02, 0x36, 0xf3, 0xcd, 0x89, 0x8f, 0xca, 0x51,
+  0xc6, 0xb6, 0x1e, 0xa8, 0x60, 0x36, 0xfb, 0x5a, 0x98, 0xb3, 0x64, 0x2d,
+  0xba, 0x6a, 0x56, 0x4e, 0xb6, 0x63, 0xda, 0x97, 0x66, 0xdb, 0x61, 0x4d,
+  0x23, 0xe9, 0x76, 0x22, 0xad, 0xe4, 0x23, 0x91, 0xa6, 0x9f, 0xe8, 0xa1,
+  0x9e, 0x7c, 0xc1, 0x19, 0x7a, 0xc4, 0xd9, 0x64, 0x39, 0x10, 0x7f, 0x41,
+  0xe9, 0x69, 0x24, 0x5d, 0x5c, 0x75, 0x30, 0x17, 0x8d, 0x2a, 0x67, 0xa4,
+  0x31, 0x02, 0xab, 0xcc, 0x46, 0xd3, 0xd6, 0xf0, 0x15, 0xdd, 0x4d, 0xfe,
+  0x01, 0x37, 0x6f, 0x8d, 0xc8, 0x45, 0xe4, 0x36, 0xa7, 0xdc, 0x3e, 0x6c,
+  0x43, 0x89, 0x07, 0x6c, 0x65, 0x3e, 0xd3, 0x14, 0x37, 0x62, 0xda, 0x8e,
+  0x39, 0xc7, 0xcd, 0x2c, 0x40, 0x67, 0x48, 0x72, 0x53, 0x06, 0x36, 0x9a,
+  0xe5, 0xc6, 0x91, 0xbf, 0x67, 0x4b, 0x73, 0x23, 0xd4, 0x30, 0x0a, 0x73,
+  0x52, 0x65, 0xd6, 0xa2, 0x09, 0x55, 0xec, 0x00, 0x7b, 0xb9, 0x72, 0x64,
+  0x3a, 0x5a, 0x2b, 0xc6, 0x5e, 0xae, 0x8a, 0x2c, 0xbf, 0xa9, 0xf3, 0x94,
+  0xfa, 0x81, 0xf6, 0x2c, 0x87, 0x85, 0xd4, 0x09, 0xd0, 0xb8, 0xd0, 0x45,
+  0x33, 0x1d, 0x8d, 0xef, 0xeb, 0xab, 0x5e, 0x47, 0x41, 0xb6, 0xe0, 0xd5,
+  0x65, 0x4e, 0x0b, 0x09, 0xb3, 0xb9, 0x1c, 0xf3, 0xf2, 0xac, 0x45, 0x33,
+  0x31, 0xe5, 0x70, 0x2e, 0x8b, 0xdb, 0x99, 0xbb, 0x22, 0x9d, 0x18, 0xfe,
+  0x2f, 0x30, 0x19, 0x90, 0x24, 0xf2, 0xb3, 0xc8, 0x06, 0x94, 0x69, 0xa5,
+  0xaa, 0x90, 0xc7, 0x83, 0x4a, 0x56, 0x3f, 0xfa, 0x18, 0xad, 0x79, 0x57,
+  0x99, 0x4a, 0x2b, 0x78, 0xb0, 0x3f, 0xf3, 0x1c, 0x42, 0x4a, 0x7f, 0x06,
+  0x94, 0xf1, 0x33, 0xb3, 0x3c, 0xa2, 0xf8, 0x40, 0x0c, 0xcd, 0x03, 0x86,
+  0xa9, 0xd9, 0xe6, 0xf4, 0xe1, 0x0c, 0x19, 0x85, 0x82, 0xf0, 0x4d, 0x82,
+  0x9c, 0x30, 0x97, 0xf6, 0x93, 0x09, 0x11, 0x42, 0x9f, 0x43, 0xdf, 0x8f,
+  0x31, 0x74, 0xec, 0xe0, 0xf5, 0x56, 0x32, 0xfd, 0x39, 0x65, 0x1e, 0xf9,
+  0x11, 0x3c, 0xf9, 0x38, 0x39, 0x78, 0x6b, 0xfa, 0xc9, 0xf4, 0xf1, 0xc1,
+  0x5f, 0x1e, 0xbc, 0x7d, 0x5c, 0xe9, 0x85, 0x24, 0xde, 0x34, 0x28, 0x4e,
+  0x18, 0x99, 0x61, 0xa5, 0x2c, 0x4d, 0x4d, 0xf8, 0xf3, 0x4a, 0x99, 0x86,
+  0xcc, 0xf2, 0xb2, 0x55, 0xd3, 0xa5, 0xc9, 0x86, 0x84, 0xba, 0xd7, 0xa4,
+  0x1b, 0xb2, 0xaf, 0xa2, 0xb4, 0xc6, 0x58, 0x93, 0x50, 0xfe, 0x18, 0x05,
+  0x43, 0x24, 0x11, 0xfa, 0x22, 0xb3, 0x06, 0x85, 0x74, 0x95, 0x40, 0xfd,
+  0xdf, 0xc0, 0x6c, 0x7f, 0x5e, 0x91, 0xf6, 0xf6, 0xb7, 0xd5, 0xb2, 0x03,
+  0x99, 0xab, 0x75, 0x41, 0x62, 0xa0, 0x92, 0x5c, 0x40, 0xf2, 0x86, 0x6c,
+  0x9d, 0xee, 0xd6, 0xdd, 0x39, 0x40, 0x78, 0x7a, 0x53, 0x29, 0x1d, 0x90,
+  0xb8, 0x64, 0x47, 0xa0, 0xe3, 0x9b, 0x30, 0xf4, 0xc5, 0xc5, 0x4a, 0xd0,
+  0x91, 0x05, 0x85, 0x60, 0xd3, 0xf3, 0x00, 0x64, 0x78, 0x5e, 0x09, 0x2e,
+  0xbb, 0x47, 0x04, 0xa0, 0xb3, 0xb7, 0x81, 0x3e, 0xf4, 0xdb, 0x4a, 0x3d,
+  0xc9, 0x2b, 0x49, 0xa8, 0x1b, 0xf5, 0x2a, 0xd0, 0x87, 0x78, 0x75, 0xc8,
+  0xb4, 0x49, 0xb6, 0x4a, 0x33, 0x64, 0x8a, 0x08, 0xa5, 0x32, 0xb2, 0x8f,
+  0x83, 0xd2, 0x4c, 0x46, 0x95, 0x2b, 0xb4, 0x07, 0x76, 0x51, 0x9e, 0x8e,
+  0xb2, 0x6e, 0xbf, 0x3d, 0xe2, 0xc9, 0x78, 0xe8, 0x51, 0x72, 0x23, 0x69,
+  0x4c, 0xdf, 0x9d, 0x7e, 0xda, 0x5c, 0x8a, 0xd6, 0x6a, 0xb7, 0xd8, 0xba,
+  0xb8, 0xef, 0x5a, 0x8c, 0xdd, 0x87, 0xed, 0x31, 0x77, 0xd1, 0xe4, 0xd5,
+  0x11, 0x72, 0xf6, 0xc5, 0x79, 0xf8, 0x3f, 0x97, 0xb9, 0xd3, 0xc3, 0xda,
+  0x4c, 0x05, 0x79, 0x66, 0x23, 0xc0, 0x78, 0x3b, 0x1d, 0xed, 0x00, 0x43,
+  0x85, 0x3f, 0x39, 0x11, 0xd6, 0xf4, 0xe3, 0x63, 0x20, 0x44, 0xb8, 0x0f,
+  0x8f, 0x18, 0xa6, 0x99, 0x20, 0xc8, 0x42, 0x88, 0x20, 0x0b, 0xe5, 0x04,
+  0x29, 0xcd, 0x8e, 0xc4, 0x6e, 0x8d, 0xd1, 0xf4, 0x48, 0x91, 0x36, 0x95,
+  0xf2, 0x23, 0x99, 0x6f, 0x79, 0x36, 0x08, 0x4f, 0x8f, 0x5d, 0x94, 0x27,
+  0xc9, 0x4f, 0xac, 0xe3, 0xf1, 0x5f, 0x19, 0x27, 0x64, 0xfb, 0x0c, 0x1c,
+  0x9b, 0x79, 0x50, 0x06, 0x5c, 0xb8, 0xf6, 0xc0, 0xb8, 0xc5, 0x4e, 0x3b,
+  0x2f, 0x70, 0x55, 0x4c, 0x2c, 0xa9, 0x8e, 0xef, 0x9d, 0x25, 0x86, 0xe7,
+  0x64, 0x1d, 0x97, 0xea, 0x74, 0x9d, 0xf5, 0x42, 0xfe, 0xf6, 0xf3, 0x8e,
+  0xaf, 0xda, 0xf7, 0x17, 0x96, 0xbb, 0xda, 0x7e, 0x53, 0x3d, 0xf3, 0xb8,
+  0xfc, 0xae, 0x38, 0xf5, 0xb8, 0x34, 0xaa, 0x9b, 0xdc, 0xe3, 0x0c, 0x41,
+  0x96, 0x7c, 0xdc, 0xc0, 0xa2, 0xec, 0xe3, 0xce, 0x7d, 0xb7, 0x95, 0x68,
+  0x35, 0x75, 0x34, 0x0b, 0xf9, 0xaa, 0xee, 0xc8, 0xa7, 0x84, 0x97, 0x87,
+  0x5c, 0xbb, 0x9d, 0xf8, 0xdd, 0xb3, 0x4c, 0xe4, 0xab, 0x36, 0x16, 0xa1,
+  0x84, 0xe4, 0xab, 0xdc, 0x03, 0xa8, 0x62, 0x16, 0xf1, 0x55, 0x5b, 0xb2,
+  0xf2, 0x66, 0x42, 0xab, 0xff, 0xcb, 0xa1, 0x5a, 0x83, 0x8a, 0xea, 0xf8,
+  0x6d, 0x5c, 0xf9, 0xad, 0x42, 0x62, 0x14, 0xfd, 0xd2, 0xc2, 0x98, 0xa7,
+  0xb3, 0x61, 0x3d, 0x52, 0x45, 0x6d, 0x03, 0xe7, 0x88, 0xb9, 0xcf, 0x65,
+  0xfe, 0x28, 0xc7, 0x50, 0x6a, 0xe2, 0x81, 0x66, 0x88, 0x0e, 0x4a, 0x8a,
+  0x22, 0x12, 0x27, 0x6e, 0x42, 0x2a, 0xbb, 0x66, 0x48, 0x2c, 0x23, 0x95,
+  0xaf, 0xd6, 0x2b, 0xf3, 0x4f, 0xf5, 0xed, 0x4b, 0x41, 0xf7, 0x54, 0xb6,
+  0xa0, 0xc9, 0x2d, 0x55, 0x2b, 0x8e, 0xa9, 0x8f, 0xe6, 0x91, 0x32, 0x57,
+  0xa9, 0xb0, 0x6a, 0xbd, 0xea, 0xc3, 0xaa, 0x8d, 0x50, 0x0e, 0x2b, 0xbc,
+  0x79, 0x69, 0x2b, 0x56, 0x19, 0x9b, 0xe4, 0xb7, 0xb4, 0x82, 0x50, 0xa7,
+  0x4c, 0x38, 0xc2, 0x54, 0x8a, 0x05, 0x09, 0xde, 0x84, 0x2c, 0xd8, 0xf6,
+  0xe0, 0x82, 0xa6, 0x33, 0xc3, 0x76, 0x67, 0x75, 0x6f, 0xe0, 0x63, 0x30,
+  0xde, 0x7b, 0x66, 0x11, 0xa0, 0x68, 0x72, 0x63, 0x96, 0x81, 0x78, 0x02,
+  0x8f, 0xd5, 0x07, 0x89, 0x32, 0x36, 0xea, 0xfa, 0xc0, 0x9f, 0xa9, 0x9b,
+  0xa0, 0x38, 0x61, 0x75, 0xb5, 0x20, 0xbb, 0x0a, 0x67, 0xb8, 0x52, 0x53,
+  0xee, 0x9c, 0x1d, 0x94, 0xe7, 0x2a, 0x27, 0x0f, 0x29, 0xff, 0x62, 0xa8,
+  0x89, 0xee, 0xe4, 0xbb, 0x22, 0x58, 0xd5, 0x92, 0x5e, 0xc9, 0xeb, 0xb1,
+  0xba, 0xc6, 0xa2, 0xa2, 0xb3, 0x7a, 0xea, 0x2b, 0xbc, 0xdb, 0x3f, 0x76,
+  0x54, 0x0d, 0xf8, 0xa8, 0x6a, 0x2a, 0x2c, 0xe6, 0x4a, 0x67, 0x71, 0xd7,
+  0x21, 0x12, 0x93, 0x71, 0x87, 0x4e, 0xa7, 0x13, 0xb3, 0x0d, 0x33, 0xc7,
+  0x33, 0xe1, 0x76, 0x26, 0x99, 0x3b, 0x6e, 0xc8, 0x16, 0x66, 0xcf, 0xb2,
+  0xe9, 0x79, 0xdb, 0xb6, 0x99, 0xa2, 0x7e, 0x49, 0xc4, 0xd5, 0x42, 0x37,
+  0x27, 0x78, 0xb7, 0x16, 0xe1, 0xad, 0xe8, 0x1e, 0x0c, 0x86, 0x50, 0x5b,
+  0x94, 0x27, 0xb4, 0xdf, 0xc2, 0x2d, 0x21, 0x15, 0x56, 0xba, 0xc1, 0x32,
+  0x2f, 0xe5, 0xc2, 0x7a, 0x43, 0xaf, 0x26, 0xd5, 0x46, 0x16, 0x22, 0x24,
+  0xc4, 0x6b, 0x96, 0x6d, 0x86, 0x83, 0x0c, 0x84, 0x01, 0x6b, 0x08, 0x2d,
+  0x8b, 0x62, 0x45, 0xa1, 0xbf, 0xc6, 0xd8, 0x62, 0x2f, 0x8a, 0x7f, 0x9c,
+  0x7e, 0x0a, 0x13, 0x5c, 0x13, 0x3e, 0xbf, 0x04, 0x13, 0x44, 0x5c, 0x98,
+  0xfa, 0xdf, 0x91, 0x2a, 0xe9, 0xe0, 0xad, 0x83, 0xbf, 0xc2, 0xa9, 0xc7,
+  0x34, 0x5b, 0x62, 0x3d, 0x74, 0x12, 0x4b, 0x2f, 0xaf, 0xd3, 0x74, 0x3d,
+  0x96, 0x89, 0x82, 0x9e, 0x08, 0x55, 0x54, 0x32, 0x7d, 0x84, 0x40, 0xf5,
+  0x38, 0x26, 0xb5, 0x75, 0x89, 0x4e, 0x33, 0x30, 0xed, 0xb6, 0x58, 0x61,
+  0x92, 0x61, 0xc2, 0x2c, 0xda, 0x2c, 0x27, 0x90, 0x0c, 0x6d, 0xc9, 0x10,
+  0xab, 0xc5, 0x83, 0xa0, 0xb0, 0x72, 0x98, 0x5c, 0xd9, 0x2d, 0xed, 0xa0,
+  0x29, 0xae, 0x37, 0x4b, 0x8a, 0x9b, 0xa8, 0x17, 0x5c, 0xd4, 0x5f, 0xe2,
+  0x7c, 0xa0, 0x65, 0x65, 0xdc, 0x0c, 0x3b, 0xde, 0x5a, 0xc8, 0x33, 0x01,
+  0x78, 0x99, 0x67, 0x78, 0x53, 0x8b, 0x8b, 0xfc, 0xb9, 0xfd, 0x93, 0x7e,
+  0x52, 0x90, 0x9f, 0xad, 0x2c, 0x3b, 0x9b, 0x2d, 0xaa, 0xda, 0x9e, 0x1f,
+  0x9e, 0xa8, 0x0a, 0xf0, 0xbe, 0x6c, 0xf9, 0xd9, 0xd4, 0x40, 0x81, 0x06,
+  0x11, 0x07, 0x1d, 0x97, 0x37, 0xca, 0x41, 0x1c, 0x22, 0x7e, 0x2b, 0x9c,
+  0x92, 0x4d, 0xf6, 0x43, 0xd2, 0x41, 0x85, 0x7c, 0x6c, 0x86, 0xe7, 0x61,
+  0xda, 0xe4, 0xd2, 0x04, 0x6d, 0x30, 0xf8, 0xdf, 0x28, 0xd2, 0x19, 0x8e,
+  0x1a, 0x26, 0xdf, 0x43, 0x0a, 0xff, 0xd2, 0x66, 0xd0, 0x99, 0x02, 0xbf,
+  0x8e, 0x2f, 0x87, 0x1b, 0x9b, 0x91, 0x78, 0xee, 0xb6, 0xd9, 0xf3, 0xb6,
+  0x01, 0xb8, 0x63, 0xf1, 0x4b, 0x0a, 0x38, 0xf7, 0xe9, 0xec, 0x01, 0xc1,
+  0xec, 0x67, 0x01, 0x07, 0xbb, 0x60, 0xca, 0xb6, 0x67, 0x20, 0x08, 0x47,
+  0x9d, 0x9d, 0xaa, 0x44, 0x23, 0xad, 0x1a, 0x1a, 0xcc, 0x05, 0xeb, 0xa0,
+  0x95, 0xa5, 0x81, 0x0b, 0x10, 0xe2, 0x30, 0x69, 0xe0, 0xf4, 0xc1, 0x72,
+  0x2a, 0x98, 0x45, 0xcc, 0xb3, 0x2c, 0xcf, 0x10, 0xa6, 0x17, 0x34, 0x0e,
+  0x7d, 0x39, 0xf2, 0x88, 0x7d, 0x25, 0xe4, 0xa2, 0x98, 0x7c, 0x09, 0xb3,
+  0x8b, 0x49, 0xb3, 0xeb, 0xd1, 0xd2, 0x8b, 0x05, 0xdc, 0x03, 0xdc, 0xfc,
+  0x62, 0xd1, 0x7e, 0x2a, 0xa7, 0x18, 0x2b, 0x4f, 0xe3, 0xe5, 0x5e, 0x97,
+  0xac, 0x8c, 0x1e, 0x5a, 0x5e, 0xa8, 0x9c, 0xca, 0x8b, 0xe5, 0x7a, 0x59,
+  0x35, 0x8e, 0x19, 0x11, 0x11, 0xd3, 0x4a, 0xf9, 0xa2, 0xc2, 0x8f, 0xbc,
+  0x9c, 0x2f, 0x8e, 0xfa, 0xc4, 0xce, 0xed, 0x95, 0x18, 0x34, 0xb9, 0x27,
+  0x08, 0xef, 0x5e, 0xa5, 0xfa, 0xe2, 0x4d, 0xab, 0x65, 0xfb, 0x2a, 0xca,
+  0xf8, 0x85, 0x47, 0x17, 0x9c, 0x4e, 0x07, 0x6f, 0x4f, 0x3f, 0xb2, 0x8e,
+  0xac, 0x9a, 0xa9, 0xe8, 0x1c, 0x1e, 0xb5, 0x79, 0x1f, 0xc8, 0xf3, 0xe5,
+  0xe4, 0xfa, 0x32, 0xf9, 0xbe, 0x54, 0xc6, 0xaf, 0x19, 0x83, 0x52, 0xce,
+  0xe9, 0xa8, 0x14, 0x11, 0x91, 0xc2, 0x0a, 0x3b, 0xc1, 0x18, 0x6e, 0xdd,
+  0x36, 0x42, 0xb4, 0x1b, 0x0a, 0x22, 0x35, 0x6b, 0x67, 0x85, 0x5f, 0xae,
+  0xc6, 0xc6, 0x90, 0x50, 0x5f, 0x99, 0x5c, 0x5c, 0x6e, 0xcd, 0xdf, 0xee,
+  0x64, 0xbd, 0xe5, 0xa0, 0x27, 0x59, 0x18, 0xc0, 0x7c, 0x58, 0x76, 0xae,
+  0x4d, 0x7f, 0x46, 0x27, 0xe9, 0xa7, 0xca, 0xf4, 0xba, 0x24, 0xee, 0x49,
+  0x6f, 0x62, 0x75, 0x85, 0x27, 0x24, 0x36, 0xbc, 0x05, 0x67, 0xec, 0x67,
+  0x98, 0xb0, 0xc7, 0xae, 0xb4, 0x20, 0xab, 0x2f, 0xd8, 0xd7, 0x27, 0x3b,
+  0x43, 0xd1, 0x24, 0x98, 0x5a, 0x22, 0xe7, 0x52, 0xa4, 0x46, 0x55, 0x29,
+  0x80, 0x0b, 0xcf, 0x83, 0x68, 0x5a, 0x9d, 0x2a, 0xa9, 0x75, 0x1c, 0x7f,
+  0x0c, 0x9d, 0x5b, 0x67, 0x96, 0xfc, 0x3a, 0xb3, 0xb3, 0xcf, 0x40, 0xd6,
+  0x9d, 0x68, 0xe6, 0x9d, 0x63, 0xcd, 0xbf, 0xc3, 0xb3, 0xf0, 0x30, 0x3e,
+  0xe8, 0xa4, 0xe1, 0x61, 0x4e, 0x68, 0xa1, 0x64, 0x3c, 0x96, 0x0b, 0xcc,
+  0x31, 0xe6, 0xf2, 0x0a, 0xf8, 0xc6, 0x14, 0x25, 0xf3, 0x52, 0xcd, 0x63,
+  0xd9, 0xbc, 0x22, 0x2b, 0xc6, 0x4f, 0xe7, 0x25, 0x47, 0xf2, 0x74, 0xb4,
+  0x83, 0xcf, 0x9a, 0x6f, 0x58, 0x1e, 0xfd, 0xa1, 0x34, 0xcc, 0x91, 0x6d,
+  0x7c, 0xf0, 0x17, 0xb0, 0xd1, 0x3f, 0x04, 0xa9, 0xe8, 0x47, 0x52, 0x21,
+  0xf2, 0x38, 0xbe, 0xb7, 0x9f, 0x40, 0xc3, 0xf7, 0x05, 0x6f, 0x28, 0xd9,
+  0xec, 0x91, 0xe4, 0xe0, 0xcf, 0xf2, 0xa8, 0x8a, 0x1c, 0xac, 0x8c, 0x33,
+  0x96, 0xa7, 0x26, 0x8b, 0x9d, 0x38, 0xb1, 0x93, 0xa6, 0x34, 0x51, 0x99,
+  0xc8, 0x34, 0x66, 0x1c, 0xa4, 0x96, 0xdc, 0xc3, 0x47, 0x8d, 0x64, 0xc9,
+  0x3d, 0x51, 0x5b, 0x8c, 0xae, 0x52, 0x17, 0x10, 0x3c, 0x06, 0x4c, 0x3b,
+  0x13, 0xb5, 0xb9, 0x54, 0x18, 0x1f, 0xcb, 0x3b, 0x57, 0xda, 0x04, 0x52,
+  0x25, 0x32, 0x50, 0x96, 0x36, 0x61, 0xc1, 0x7e, 0xc9, 0xbd, 0x61, 0x97,
+  0x92, 0xf9, 0x0e, 0x7b, 0x65, 0x39, 0x4b, 0xd3, 0x3b, 0x13, 0xe2, 0x17,
+  0x53, 0x3e, 0xe8, 0xc9, 0x6a, 0x29, 0xa5, 0x69, 0x73, 0xf9, 0xbf, 0x8e,
+  0x8e, 0x3f, 0xf0, 0xa3, 0x03, 0xed, 0x32, 0x5e, 0xf4, 0xda, 0xf1, 0x26,
+  0x72, 0xd3, 0xc6, 0x0d, 0x98, 0x2b, 0xd4, 0x84, 0x40, 0x8f, 0x3a, 0x07,
+  0xa7, 0xca, 0xfa, 0x02, 0xb7, 0x0d, 0x95, 0xfc, 0x6a, 0x29, 0x36, 0xad,
+  0x94, 0x50, 0xd3, 0xe8, 0x60, 0x65, 0x60, 0x21, 0x07, 0x6b, 0x32, 0x80,
+  0xb8, 0x71, 0x3b, 0x79, 0x99, 0x89, 0xe4, 0x76, 0x20, 0x75, 0x44, 0x55,
+  0xc3, 0xc8, 0xd3, 0x32, 0x8a, 0xd8, 0x70, 0xe7, 0x8f, 0x6a, 0xfb, 0x78,
+  0xda, 0x76, 0x8f, 0x67, 0x64, 0xf3, 0x08, 0xdb, 0x3b, 0xb8, 0xc2, 0x9d,
+  0xb9, 0xcd, 0x96, 0x53, 0x67, 0x2f, 0x2f, 0xcd, 0xbf, 0xa5, 0x03, 0x61,
+  0x89, 0x5b, 0x4a, 0xa3, 0x6a, 0x95, 0x58, 0x58, 0xc2, 0x32, 0x46, 0xff,
+  0xb1, 0x29, 0x65, 0xe4, 0x04, 0x59, 0x7d, 0x4b, 0x32, 0x67, 0xaa, 0xd3,
+  0x62, 0xf5, 0x8a, 0xd7, 0x73, 0xc5, 0xba, 0x6b, 0x4d, 0xcb, 0xa7, 0xc3,
+  0xb9, 0xc8, 0xe1, 0xda, 0xe4, 0xee, 0x1c, 0xec, 0x8e, 0x21, 0x97, 0x64,
+  0x11, 0xab, 0xcf, 0xc3, 0x0a, 0x66, 0xd7, 0x75, 0xe7, 0x8c, 0x5a, 0x32,
+  0xd6, 0x6b, 0xcb, 0x99, 0xe5, 0x0c, 0x9f, 0x76, 0xab, 0x99, 0x33, 0x4f,
+  0xfc, 0xa7, 0xd3, 0x8e, 0xd1, 0xc3, 0xfc, 0xb0, 0xeb, 0x6f, 0xe5, 0xe3,
+  0xff, 0x90, 0x39, 0xbc, 0xa4, 0x70, 0xf4, 0x87, 0x9e, 0xc3, 0x4b, 0x1d,
+  0x30, 0x55, 0x93, 0x78, 0x59, 0xed, 0x75, 0x16, 0xaf, 0x50, 0xae, 0xa9,
+  0x10, 0xe4, 0x63, 0x51, 0x01, 0x7e, 0x21, 0x7a, 0xba, 0x2f, 0x4d, 0xfe,
+  0x2e, 0x77, 0x02, 0x18, 0x49, 0x67, 0xf6, 0x90, 0x28, 0x49, 0xe1, 0xc5,
+  0xfd, 0xcd, 0x8e, 0x27, 0x85, 0x57, 0x74, 0xb5, 0x05, 0x53, 0x57, 0xb0,
+  0xa2, 0x76, 0x56, 0xae, 0x93, 0xcd, 0xe3, 0x28, 0xce, 0x67, 0x47, 0xea,
+  0xc7, 0xf3, 0x41, 0xab, 0xd0, 0x90, 0xc2, 0xa8, 0x75, 0xd8, 0xfb, 0xd7,
+  0xb3, 0xc1, 0x05, 0x15, 0x45, 0xc2, 0x96, 0xa9, 0x14, 0xf4, 0xd5, 0x2b,
+  0x95, 0x7a, 0x40, 0x43, 0x3d, 0xa7, 0xff, 0xd4, 0x47, 0xdc, 0x12, 0x3b,
+  0xe1, 0x36, 0xcb, 0xa3, 0xd9, 0x81, 0x3a, 0x2a, 0x95, 0x19, 0x86, 0xb0,
+  0x9b, 0x9f, 0xc1, 0x5b, 0x6e, 0x04, 0xe0, 0xe9, 0xdd, 0xb3, 0xd3, 0x7f,
+  0xf1, 0x2d, 0x76, 0x26, 0x12, 0x7d, 0xfa, 0x11, 0x16, 0x12, 0x25, 0xbb,
+  0x16, 0xdc, 0x7d, 0x3f, 0x99, 0x3e, 0x4e, 0xe0, 0xea, 0xfb, 0x57, 0xe2,
+  0x65, 0x28, 0x56, 0xbd, 0x73, 0xfa, 0xe4, 0xee, 0xd9, 0x5a, 0x51, 0xcd,
+  0x06, 0xba, 0xa9, 0xeb, 0xb2, 0x3d, 0x1c, 0x6f, 0x37, 0x47, 0x8d, 0x93,
+  0x24, 0x13, 0x59, 0x19, 0xbb, 0x97, 0x20, 0x15, 0x38, 0xb0, 0x59, 0x87,
+  0xfd, 0x4b, 0x1b, 0x75, 0x44, 0x1e, 0x47, 0xf4, 0x48, 0x65, 0xd8, 0xe6,
+  0xf1, 0xf8, 0x86, 0x0a, 0x05, 0xe3, 0xb3, 0x90, 0xb1, 0xb3, 0xaa, 0x79,
+  0x41, 0xeb, 0x0e, 0x0f, 0x8b, 0x47, 0xce, 0x20, 0xab, 0x20, 0x57, 0x5a,
+  0x8a, 0x33, 0xe8, 0xf6, 0x60, 0xd5, 0x89, 0x5c, 0x86, 0xe8, 0x53, 0x0b,
+  0xb7, 0x3e, 0x4c, 0x24, 0x26, 0x22, 0x15, 0xd9, 0x07, 0x6a, 0x27, 0xaa,
+  0xac, 0xcb, 0x5e, 0xc2, 0x35, 0xd3, 0xb4, 0x2c, 0xd2, 0xcf, 0x4b, 0x3e,
+  0x5b, 0x3b, 0x5b, 0x50, 0x59, 0xde, 0x84, 0xe6, 0x45, 0xe3, 0xde, 0x04,
+  0x40, 0x8c, 0x19, 0xf4, 0xea, 0x9f, 0xfa, 0xcd, 0xe4, 0x2e, 0xce, 0xed,
+  0xf0, 0x03, 0x19, 0x6e, 0x26, 0x3c, 0x7c, 0xc5, 0x8f, 0x9a, 0x09, 0x3e,
+  0xc3, 0x63, 0xfd, 0xc2, 0x70, 0x07, 0xf8, 0x40, 0xaf, 0xa1, 0x0b, 0xd1,
+  0xf6, 0xe0, 0xa6, 0x55, 0x47, 0x93, 0x57, 0xed, 0xec, 0xb5, 0x81, 0x1f,
+  0x35, 0x76, 0x14, 0xa0, 0x5b, 0x5b, 0x04, 0x75, 0x6b, 0xeb, 0x58, 0xc1,
+  0x8e, 0x52, 0x98, 0xc0, 0xba, 0x09, 0x96, 0x13, 0x56, 0xca, 0xda, 0xd9,
+  0xdf, 0xff, 0xe5, 0xc7, 0x81, 0xa0, 0x37, 0xc7, 0xe5, 0xd8, 0xa3, 0x23,
+  0xa5, 0x81, 0xb5, 0x88, 0x38, 0xfd, 0x35, 0xec, 0x74, 0x8c, 0xcb, 0x79,
+  0xeb, 0xe0, 0x8d, 0x25, 0x19, 0x0f, 0x26, 0x7d, 0xdf, 0x81, 0x69, 0xa3,
+  0xb4, 0x11, 0x2a, 0x2c, 0x7b, 0x67, 0x94, 0xa6, 0x03, 0xb2, 0x3f, 0x8d,
+  0x40, 0x54, 0x41, 0xcf, 0xf7, 0x50, 0xab, 0x6b, 0xa2, 0x09, 0x90, 0xa4,
+  0x56, 0x1c, 0x1c, 0x19, 0x42, 0x15, 0x4b, 0xea, 0xda, 0x98, 0xfe, 0x33,
+  0xec, 0xbc, 0xdf, 0xa1, 0xa6, 0xbd, 0x18, 0x4f, 0xbb, 0xbe, 0xef, 0x48,
+  0xc6, 0x0c, 0x08, 0x8c, 0x39, 0xa6, 0x76, 0x3b, 0x51, 0xc8, 0x97, 0x9a,
+  0x9e, 0xdf, 0x1b, 0x0f, 0x6b, 0x95, 0xa3, 0x39, 0xd7, 0x97, 0x1d, 0x06,
+  0x63, 0xd5, 0xa4, 0x1d, 0xee, 0x37, 0x3d, 0x69, 0xf8, 0x4e, 0x7f, 0xb8,
+  0xd1, 0xed, 0xcb, 0x5a, 0xa6, 0x22, 0x7f, 0x4b, 0x29, 0x03, 0x70, 0xbf,
+  0xb1, 0xc3, 0xe3, 0xc8, 0xb9, 0x5e, 0x06, 0x90, 0xd6, 0x96, 0x9d, 0xb3,
+  0x2b, 0xed, 0x9d, 0x1f, 0x83, 0x5c, 0x0b, 0x6b, 0x25, 0x35, 0x41, 0x6c,
+  0xf6, 0x79, 0x74, 0x2e, 0xa9, 0xcb, 0xa6, 0xe4, 0x12, 0x2d, 0xb2, 0x71,
+  0x78, 0x5d, 0xfa, 0x2c, 0x82, 0xa7, 0x39, 0xd1, 0x91, 0x12, 0x5b, 0x7d,
+  0x38, 0xf5, 0x13, 0xca, 0x70, 0x42, 0x0c, 0x29, 0xd7, 0x79, 0x4e, 0x92,
+  0x3b, 0xdd, 0x5d, 0x99, 0x06, 0x45, 0xcf, 0x6c, 0x85, 0x8d, 0x71, 0x03,
+  0xb7, 0x00, 0xc8, 0x2d, 0x6a, 0x83, 0x78, 0x91, 0xa3, 0x67, 0xa9, 0x45,
+  0x02, 0x4d, 0x12, 0xc1, 0x75, 0xdd, 0x9d, 0x71, 0xda, 0x5e, 0x6b, 0x05,
+  0x91, 0x9f, 0xce, 0x41, 0x8e, 0x51, 0x29, 0x0e, 0x0d, 0x79, 0x74, 0x67,
+  0x96, 0xaf, 0x8a, 0x0f, 0x74, 0x46, 0x21, 0x16, 0xb8, 0x59, 0xf3, 0x82,
+  0x51, 0x45, 0x84, 0x83, 0xd3, 0x05, 0xe6, 0x7e, 0x31, 0x9e, 0x23, 0xe4,
+  0x11, 0x23, 0x9c, 0x49, 0xde, 0xa0, 0xba, 0xde, 0xef, 0x08, 0xa3, 0x92,
+  0x13, 0xe5, 0xc0, 0xd6, 0x9f, 0xfe, 0x73, 0x7d, 0x39, 0x5a, 0xef, 0xd8,
+  0x9d, 0x4a, 0x57, 0xd1, 0x14, 0x22, 0x32, 0x17, 0xb8, 0xc6, 0xd9, 0x4e,
+  0x0a, 0x1b, 0x7b, 0x07, 0xbd, 0xce, 0xe1, 0x46, 0x94, 0x76, 0x06, 0xc3,
+  0x7d, 0x21, 0xfa, 0xf3, 0x2b, 0x14, 0xa1, 0xe3, 0xfa, 0x80, 0x48, 0x84,
+  0xe5, 0x65, 0x4f, 0xec, 0x6d, 0x6d, 0x46, 0x14, 0x4b, 0x96, 0x1e, 0x43,
+  0xef, 0xaf, 0xc2, 0x35, 0x47, 0xbf, 0xd2, 0x5d, 0x2e, 0x99, 0x3f, 0xd5,
+  0x3b, 0x41, 0xf6, 0xa5, 0xc4, 0x26, 0xbf, 0xcc, 0x6c, 0xdd, 0x12, 0x75,
+  0x87, 0x60, 0x7c, 0x7d, 0xba, 0x56, 0x39, 0x33, 0xa4, 0x44, 0x2b, 0x6b,
+  0xf0, 0x6a, 0xd0, 0xf2, 0x22, 0xde, 0x92, 0x88, 0x3d, 0x65, 0x1a, 0x70,
+  0x37, 0xb5, 0x25, 0xa5, 0xa1, 0x76, 0x49, 0x23, 0xfe, 0x3d, 0x46, 0xaa,
+  0xb8, 0xe9, 0xca, 0xec, 0xd0, 0xe4, 0x5d, 0xf9, 0xc7, 0xf5, 0xee, 0x78,
+  0xbb, 0x25, 0x62, 0x61, 0xf8, 0x0d, 0xe3, 0xb5, 0x94, 0x84, 0x35, 0xde,
+  0x8a, 0x4c, 0x4a, 0xe3, 0x46, 0xbd, 0x23, 0xf3, 0xfd, 0xa4, 0x5a, 0xe6,
+  0xf5, 0x54, 0x7a, 0xea, 0x3d, 0xf0, 0xe2, 0xfd, 0xf3, 0xa3, 0x11, 0x89,
+  0x24, 0x46, 0xd4, 0x25, 0x77, 0x6c, 0x9a, 0x33, 0x32, 0xb6, 0xc2, 0x3f,
+  0xa7, 0xa9, 0x3f, 0xae, 0x33, 0x4e, 0xb2, 0x17, 0x5e, 0x70, 0xaa, 0x68,
+  0x43, 0x13, 0x68, 0x8f, 0x0d, 0xb5, 0xa6, 0x50, 0xbb, 0x5b, 0x5e, 0x6d,
+  0xc0, 0x73, 0x4a, 0xe7, 0x41, 0xdd, 0x81, 0x08, 0x49, 0xff, 0x2a, 0x47,
+  0x9a, 0xa6, 0x97, 0xea, 0xc6, 0x73, 0xf3, 0xc6, 0xef, 0xed, 0xb4, 0x59,
+  0xd8, 0xe0, 0xac, 0xe6, 0xa3, 0x6e, 0x04, 0x07, 0x99, 0xc6, 0xd5, 0x40,
+  0xbe, 0x9f, 0xb8, 0xed, 0x96, 0xe1, 0xd9, 0x69, 0x95, 0x2b, 0x22, 0xf9,
+  0xbe, 0x18, 0x8c, 0x39, 0xe2, 0x54, 0x63, 0x51, 0x01, 0x76, 0xd2, 0xf4,
+  0x53, 0x63, 0x24, 0x16, 0xf1, 0xb8, 0x2f, 0xed, 0x84, 0x61, 0x79, 0x42,
+  0x02, 0x52, 0x7a, 0x5b, 0x99, 0x9e, 0x6d, 0xb8, 0x95, 0x38, 0x2f, 0x50,
+  0x94, 0xae, 0x0f, 0x37, 0xbe, 0x0f, 0x97, 0xa3, 0x3a, 0x47, 0xc5, 0x69,
+  0xa6, 0x32, 0x10, 0xf3, 0x7e, 0xcc, 0x24, 0xdb, 0x8d, 0x97, 0xa3, 0xc9,
+  0x59, 0x34, 0x56, 0x40, 0xd4, 0x10, 0x4e, 0xf4, 0xb8, 0x0c, 0x23, 0x6a,
+  0x54, 0x0d, 0x1f, 0x6c, 0xba, 0x1c, 0x4a, 0x48, 0x06, 0x87, 0xc7, 0xf8,
+  0xdb, 0x66, 0xd9, 0x38, 0x8b, 0xec, 0xb6, 0xba, 0x21, 0x86, 0xd7, 0x0c,
+  0xae, 0x26, 0xbd, 0x3c, 0x24, 0xa4, 0x66, 0x78, 0x45, 0xc4, 0xa6, 0x6b,
+  0x62, 0xca, 0x96, 0xde, 0x92, 0x10, 0x70, 0x4c, 0xb4, 0xdb, 0xcc, 0xc5,
+  0x4e, 0x7f, 0xc9, 0x52, 0x8e, 0xf5, 0xe4, 0x76, 0xed, 0x8e, 0xe1, 0x4a,
+  0x71, 0xeb, 0x01, 0x20, 0x32, 0xde, 0x5e, 0x12, 0xbb, 0x84, 0x62, 0x7c,
+  0xeb, 0x27, 0xeb, 0xcd, 0x96, 0xca, 0x26, 0x29, 0xf4, 0x99, 0x93, 0xdb,
+  0xca, 0xcf, 0x68, 0x0b, 0xce, 0x60, 0x7b, 0xbb, 0xdf, 0x24, 0x16, 0x10,
+  0xdc, 0xf4, 0xc1, 0x9b, 0x0d, 0x2e, 0xea, 0xdd, 0xee, 0x7d, 0xb4, 0x13,
+  0x31, 0x29, 0x63, 0x3c, 0xdc, 0x7d, 0x05, 0x78, 0x5b, 0x9f, 0x91, 0x74,
+  0x5e, 0x84, 0x34, 0x08, 0x0e, 0x4c, 0x83, 0x90, 0x22, 0x8d, 0x9b, 0xb3,
+  0xba, 0x8b, 0xef, 0x94, 0xd3, 0xf4, 0x5e, 0xbf, 0x5f, 0x85, 0x13, 0x68,
+  0x2e, 0xe0, 0xef, 0x75, 0xe4, 0x01, 0x34, 0x43, 0x99, 0xe3, 0x13, 0xc2,
+  0xfb, 0x11, 0xed, 0xf4, 0x54, 0x0b, 0xde, 0xe9, 0x20, 0x19, 0xf5, 0x52,
+  0x67, 0x8a, 0xb5, 0x13, 0xce, 0x57, 0x1e, 0x9b, 0xb1, 0xb9, 0xdf, 0x2d,
+  0x46, 0xa7, 0xdb, 0xba, 0x38, 0x18, 0x47, 0x8c, 0x35, 0x90, 0x8c, 0x2c,
+  0x86, 0x96, 0x51, 0xee, 0x79, 0x28, 0x18, 0x80, 0x65, 0xf8, 0xe8, 0x96,
+  0xb7, 0x0d, 0x23, 0x94, 0xb3, 0x8b, 0x3b, 0x2c, 0x61, 0x0d, 0x5c, 0xe5,
+  0x2b, 0x7b, 0x25, 0xb5, 0xb0, 0xf6, 0x86, 0x67, 0x60, 0x26, 0x26, 0x7f,
+  0x99, 0x7c, 0x7a, 0x1d, 0x56, 0xea, 0x98, 0x94, 0x37, 0x7a, 0x2d, 0x59,
+  0x6c, 0xb3, 0xc2, 0xac, 0x17, 0x30, 0x7f, 0x49, 0x17, 0xba, 0xfe, 0x3b,
+  0x3b, 0x9b, 0xf3, 0x13, 0x1b, 0x17, 0xc5, 0x56, 0xe4, 0x16, 0x8c, 0xa4,
+  0x21, 0xa2, 0x49, 0x0f, 0x7c, 0x68, 0x33, 0xf1, 0x30, 0x64, 0xc3, 0xb0,
+  0x38, 0x33, 0x8f, 0x51, 0x84, 0x7f, 0x1c, 0xc8, 0x74, 0x24, 0x0b, 0x63,
+  0x0c, 0x7a, 0xd7, 0xbb, 0x23, 0x11, 0x66, 0x26, 0xed, 0x83, 0xf2, 0x73,
+  0xda, 0xbd, 0xb3, 0xee, 0x77, 0xcb, 0xd7, 0x63, 0xa6, 0x6f, 0xb5, 0xe9,
+  0xd1, 0x96, 0x0b, 0xc6, 0x80, 0x5c, 0x8e, 0x19, 0x36, 0x1a, 0x75, 0x14,
+  0x56, 0xd0, 0xb3, 0x1a, 0xb9, 0x7e, 0xb4, 0x51, 0x96, 0xaf, 0x51, 0xb3,
+  0x4b, 0x22, 0xef, 0x4a, 0x9d, 0x95, 0xed, 0x86, 0x93, 0x65, 0x24, 0x5e,
+  0x36, 0xb8, 0x76, 0xba, 0xb0, 0xcf, 0x1c, 0xe4, 0xf0, 0xde, 0x5e, 0x3f,
+  0x5d, 0x85, 0xdb, 0x47, 0x77, 0x94, 0x0d, 0xf3, 0xba, 0x5a, 0xe6, 0x55,
+  0xbe, 0x66, 0x26, 0xa0, 0x99, 0xbe, 0xd3, 0x4e, 0xe4, 0x6c, 0x51, 0xd8,
+  0x5e, 0x25, 0x3f, 0x27, 0xcf, 0x10, 0x93, 0x1b, 0x83, 0x3b, 0xd7, 0xff,
+  0x35, 0xc8, 0xfc, 0xe4, 0x4b, 0x62, 0xeb, 0xd3, 0x3e, 0x66, 0x6e, 0xf7,
+  0xa5, 0xbe, 0xe3, 0x8e, 0xd5, 0x81, 0x85, 0x1f, 0xac, 0xee, 0xa6, 0x9b,
+  0xd9, 0x56, 0xb6, 0x79, 0x73, 0x45, 0x5d, 0x30, 0x63, 0x9c, 0x7f, 0xe2,
+  0xdd, 0x0f, 0xf8, 0xc1, 0x33, 0xdc, 0xcd, 0xcd, 0x9c, 0x9f, 0x90, 0xb6,
+  0x17, 0x98, 0x59, 0xdf, 0xf6, 0x72, 0x22, 0x6a, 0x7b, 0x79, 0x76, 0x86,
+  0x10, 0xbf, 0xa2, 0x4c, 0x15, 0x97, 0xf5, 0x5d, 0x1c, 0xa9, 0x18, 0x74,
+  0xbd, 0x95, 0xc0, 0x88, 0x97, 0xf0, 0x3f, 0xda, 0x83, 0xdd, 0xa2, 0x8d,
+  0xbf, 0x0b, 0xad, 0xdf, 0x2c, 0x30, 0xf8, 0x0f, 0x8f, 0x58, 0xd2, 0xfb,
+  0x28, 0xcd, 0x65, 0x29, 0x8a, 0xe0, 0xdd, 0x66, 0x66, 0x53, 0x9e, 0x43,
+  0x21, 0x16, 0x8e, 0xce, 0xe6, 0x46, 0x76, 0x8a, 0x2f, 0x38, 0xc5, 0x05,
+  0x37, 0x50, 0xf7, 0xe7, 0x8b, 0xb0, 0x82, 0x7b, 0xc3, 0xfd, 0x41, 0x83,
+  0x52, 0x8b, 0xb5, 0xc8, 0x02, 0x91, 0xa3, 0x8f, 0x93, 0xc8, 0x17, 0x81,
+  0xa6, 0x8b, 0x15, 0xe1, 0x87, 0x20, 0xf3, 0x86, 0xb6, 0xcc, 0x09, 0x29,
+  0xc8, 0x2b, 0x03, 0x63, 0x99, 0x46, 0x23, 0x96, 0xb2, 0xe0, 0xf4, 0xf6,
+  0xd7, 0xce, 0x3e, 0xff, 0x80, 0x3a, 0x9a, 0x9c, 0x3e, 0x09, 0x3f, 0x02,
+  0x6a, 0x4d, 0xa5, 0x4f, 0x68, 0xf7, 0x24, 0x62, 0x3a, 0x95, 0xc4, 0xee,
+  0x30, 0xcf, 0xc4, 0x9d, 0x0e, 0xaf, 0x7a, 0xe3, 0xec, 0x6e, 0xba, 0x9c,
+  0x6c, 0x0c, 0x47, 0x30, 0x96, 0xa5, 0x64, 0x61, 0xf7, 0x1e, 0x0c, 0x1d,
+  0x13, 0x48, 0x7e, 0xa5, 0xd7, 0xeb, 0xa9, 0xe7, 0xed, 0x51, 0xb7, 0x97,
+  0xed, 0x01, 0xb9, 0xbe, 0x86, 0x89, 0x63, 0x37, 0xba, 0x9b, 0xaf, 0xa1,
+  0xa6, 0x74, 0xd0, 0x5b, 0x4a, 0xbe, 0xb2, 0xf5, 0x0d, 0xfc, 0x7f, 0xcb,
+  0x11, 0xa5, 0xa9, 0xea, 0xbb, 0x2d, 0x3c, 0x50, 0x6a, 0x5e, 0x2a, 0xda,
+  0x97, 0x10, 0x20, 0x88, 0xa0, 0xe4, 0xe7, 0xb4, 0x2b, 0x0e, 0x9b, 0xe5,
+  0xc4, 0x51, 0xe1, 0x7c, 0x7f, 0x2f, 0x1f, 0xc3, 0x1c, 0x93, 0xf2, 0x95,
+  0xe6, 0x37, 0xdf, 0xed, 0x6e, 0xa6, 0xed, 0x8d, 0x74, 0xbc, 0x9f, 0xa6,
+  0x83, 0xe5, 0x9a, 0x9d, 0x71, 0x41, 0xab, 0x6c, 0x48, 0x07, 0x32, 0x48,
+  0xef, 0x29, 0x13, 0xc9, 0x6a, 0xb6, 0xd1, 0x87, 0x4e, 0x3d, 0x53, 0x58,
+  0xc5, 0x76, 0xc6, 0xb0, 0x86, 0x6a, 0x2a, 0x32, 0x9f, 0xa1, 0x8e, 0x4a,
+  0x3c, 0xf2, 0x53, 0x60, 0x61, 0xc2, 0x9f, 0xb7, 0x81, 0x4f, 0xbe, 0x4e,
+  0x4a, 0xcd, 0x9f, 0x74, 0x3a, 0x1d, 0x57, 0x91, 0x97, 0xd8, 0xda, 0x43,
+  0x52, 0x9c, 0x8b, 0xe5, 0xb2, 0x94, 0x20, 0xf8, 0xe5, 0x40, 0xea, 0xab,
+  0x42, 0x7d, 0xa5, 0xa6, 0x36, 0x8c, 0x62, 0xcf, 0xcf, 0x1c, 0x42, 0x30,
+  0x13, 0x33, 0xfb, 0xdd, 0x0d, 0x98, 0xe9, 0xbd, 0x31, 0x3c, 0xfb, 0x81,
+  0xb0, 0x3d, 0xa2, 0x4a, 0xcc, 0x9e, 0xde, 0xfd, 0xed, 0x6c, 0x5c, 0x79,
+  0x75, 0x88, 0xc5, 0x01, 0x2b, 0x2e, 0xdf, 0xee, 0x02, 0x1a, 0x4b, 0xc9,
+  0x7c, 0xb2, 0x08, 0x1f, 0xbc, 0x08, 0xff, 0x1b, 0xdd, 0xd9, 0xe8, 0x36,
+  0xe6, 0x5b, 0xf4, 0xff, 0x3a, 0x0b, 0xcd, 0xe5, 0x64, 0x27, 0x1b, 0xb4,
+  0xf7, 0xb3, 0x1e, 0x5e, 0x1a, 0x16, 0xe6, 0xe7, 0xff, 0xc8, 0xce, 0x58,
+  0xf2, 0xfc, 0x03, 0xda, 0x3c, 0xc2, 0x99, 0x07, 0xff, 0x54, 0xfe, 0x3c,
+  0x76, 0x22, 0x23, 0xa9, 0xcc, 0x72, 0x87, 0x49, 0x13, 0x02, 0xe3, 0x54,
+  0x4b, 0x0c, 0xfb, 0x17, 0x19, 0x8f, 0x77, 0xba, 0xa3, 0x3b, 0x58, 0x38,
+  0x74, 0x7e, 0xd9, 0x4b, 0xfe, 0x11, 0x51, 0xc5, 0x61, 0xf2, 0x0d, 0x6f,
+  0xff, 0x82, 0x84, 0xe7, 0x29, 0x2a, 0x27, 0x5e, 0xd6, 0x0f, 0x37, 0xf5,
+  0xda, 0xaa, 0x94, 0x02, 0x48, 0x02, 0xd6, 0x6a, 0x0e, 0x93, 0x25, 0xa8,
+  0xfe, 0xfc, 0x03, 0xcd, 0x0f, 0x26, 0xc0, 0xe9, 0xd1, 0x19, 0xc4, 0x49,
+  0xc0, 0x56, 0x3b, 0x2b, 0x49, 0x33, 0x71, 0xf2, 0x7b, 0x78, 0x89, 0x47,
+  0x54, 0xaa, 0xa5, 0x7a, 0x9d, 0xa5, 0x5a, 0x8a, 0x29, 0x8e, 0xb9, 0xe2,
+  0xce, 0xd7, 0xcb, 0x54, 0x3b, 0xab, 0x83, 0x92, 0x97, 0xd8, 0x33, 0x9e,
+  0x34, 0x65, 0xd9, 0x9d, 0x2a, 0x58, 0x35, 0xa5, 0xd0, 0xc6, 0x12, 0xd3,
+  0xb1, 0x60, 0x63, 0xf5, 0x7d, 0xd3, 0x37, 0x5f, 0x32, 0x29, 0x7a, 0x52,
+  0x80, 0xdd, 0xa5, 0xc1, 0xe6, 0x7d, 0xd8, 0x40, 0xe3, 0x74, 0x4d, 0xc9,
+  0x86, 0xb3, 0xe2, 0x97, 0xba, 0x10, 0x66, 0x47, 0xaf, 0x00, 0x3f, 0xb5,
+  0x70, 0x0e, 0x4f, 0x3f, 0x25, 0x80, 0x1e, 0x91, 0x84, 0x51, 0x1c, 0x99,
+  0x88, 0x6a, 0x27, 0x10, 0x3c, 0xc4, 0x54, 0x1b, 0x50, 0x4f, 0x09, 0x59,
+  0xb8, 0x83, 0xd2, 0xf2, 0x3e, 0x3c, 0x39, 0xbb, 0xf6, 0xf7, 0xb3, 0xe3,
+  0xe6, 0x8a, 0x6d, 0x5e, 0x04, 0x28, 0x4b, 0xb3, 0xff, 0x07, 0x2b, 0xaf,
+  0xb9, 0x2a, 0x1a, 0x99, 0x36, 0x9f, 0x0f, 0x8c, 0x5f, 0xcf, 0x5d, 0x05,
+  0xad, 0x77, 0x73, 0x08, 0x84, 0x1e, 0x6c, 0x77, 0xf3, 0x6b, 0xfb, 0x03,
+  0xcd, 0x4b, 0x15, 0x70, 0xa6, 0x6d, 0xb1, 0xb4, 0x08, 0xf2, 0xbd, 0xaf,
+  0x43, 0x50, 0x2f, 0x74, 0x60, 0xb5, 0xab, 0x34, 0xb4, 0xc9, 0xb8, 0x2e,
+  0xe9, 0xb2, 0xaa, 0x3d, 0xae, 0x24, 0x4d, 0xea, 0x78, 0x5c, 0xd0, 0x9f,
+  0x93, 0x3a, 0x91, 0x77, 0x0b, 0x4f, 0x51, 0x90, 0xf6, 0x5c, 0x8f, 0x52,
+  0xe3, 0x03, 0x6c, 0x05, 0xbf, 0xcf, 0x06, 0xb7, 0xe3, 0xe6, 0x36, 0xb0,
+  0x5d, 0xf6, 0x9f, 0xb2, 0xd8, 0x4c, 0x74, 0x9d, 0x49, 0x5c, 0x86, 0xf3,
+  0x98, 0xf8, 0xa3, 0xe5, 0x29, 0x34, 0x48, 0xf7, 0xe9, 0xa1, 0x76, 0xc6,
+  0x43, 0x5e, 0xbf, 0x94, 0xd4, 0xe6, 0xe7, 0x97, 0x4e, 0xcd, 0x2f, 0xcd,
+  0xcf, 0xd7, 0x54, 0x7d, 0xef, 0x80, 0xd7, 0xbd, 0x76, 0xe8, 0x11, 0xb4,
+  0x31, 0xd8, 0x29, 0x7f, 0x79, 0x51, 0xd8, 0x2b, 0xe0, 0x2e, 0xaf, 0x92,
+  0xe2, 0xe0, 0xee, 0xb9, 0x21, 0xac, 0x1e, 0x0f, 0xe6, 0x4a, 0xfd, 0xfb,
+  0xb5, 0xeb, 0xbe, 0xf6, 0x91, 0x0f, 0xd6, 0x22, 0x77, 0x42, 0x13, 0x6a,
+  0x2b, 0xa2, 0xb3, 0x44, 0x8c, 0xf3, 0xfa, 0x70, 0x3f, 0x1d, 0xd5, 0xa4,
+  0xaf, 0xb5, 0x20, 0x3e, 0x30, 0x80, 0x52, 0x44, 0x54, 0x59, 0xf3, 0x32,
+  0x3c, 0x78, 0x3b, 0x1b, 0x8d, 0x4b, 0xb0, 0x12, 0x7d, 0x14, 0xe6, 0xa4,
+  0x3f, 0x7f, 0xa8, 0x1e, 0x85, 0x38, 0x76, 0x9b, 0x49, 0xf0, 0xb1, 0xce,
+  0x95, 0x13, 0x7c, 0xab, 0xdd, 0xfa, 0xa9, 0x47, 0xe5, 0xc1, 0x15, 0x08,
+  0x75, 0x1f, 0xb3, 0x13, 0xd3, 0xd7, 0xae, 0x78, 0x7e, 0xfe, 0xe2, 0x1a,
+  0x41, 0x4d, 0x64, 0x9d, 0xb6, 0x46, 0xb8, 0x7f, 0xa6, 0x6b, 0x0b, 0x79,
+  0xb4, 0x8f, 0xd2, 0x9d, 0xe1, 0x5d, 0x01, 0x87, 0x3b, 0x04, 0x12, 0x13,
+  0x97, 0x39, 0x07, 0xea, 0xd3, 0x7f, 0xa1, 0x70, 0x99, 0x4f, 0x94, 0x29,
+  0xf4, 0x4d, 0xf2, 0xba, 0xa1, 0x1c, 0xa2, 0xe7, 0x8c, 0x56, 0x25, 0xdc,
+  0x7d, 0x28, 0xba, 0xa9, 0x0a, 0x09, 0x82, 0x2a, 0x26, 0x2f, 0xd0, 0xd5,
+  0xc3, 0xdb, 0x18, 0x06, 0x47, 0x6b, 0xc3, 0x0b, 0xd0, 0xc2, 0x77, 0x62,
+  0x17, 0xbd, 0x30, 0xd3, 0x88, 0xb7, 0xff, 0xe2, 0x41, 0xab, 0x0c, 0xb0,
+  0xa8, 0xc3, 0xf1, 0x07, 0x39, 0xe7, 0x01, 0x38, 0x1e, 0x09, 0x7b, 0xba,
+  0x62, 0x65, 0xd4, 0x1d, 0x74, 0xcc, 0x00, 0x54, 0xf3, 0x07, 0x0d, 0x42,
+  0x38, 0x8f, 0xad, 0x42, 0x15, 0x90, 0x24, 0x0a, 0xa1, 0xdb, 0xa7, 0xb8,
+  0x73, 0x82, 0x08, 0x70, 0x22, 0xd8, 0xc8, 0x2c, 0xc9, 0x20, 0x04, 0xbb,
+  0xb0, 0x51, 0xc4, 0xe7, 0xf3, 0x51, 0xdd, 0xf3, 0xb9, 0x8d, 0x82, 0x3b,
+  0x9c, 0x07, 0xa9, 0xb8, 0x55, 0xd0, 0x34, 0xe0, 0x7f, 0x74, 0x9e, 0x3e,
+  0xf8, 0xfb, 0x3b, 0xf6, 0x55, 0xe2, 0x44, 0xd1, 0x12, 0xe6, 0x05, 0x77,
+  0x28, 0xe9, 0xcd, 0x70, 0xb4, 0xd3, 0x1d, 0x83, 0x24, 0x23, 0x8b, 0x2c,
+  0x18, 0x80, 0x8a, 0xbd, 0x35, 0xec, 0x26, 0x70, 0xbb, 0x44, 0x15, 0xe2,
+  0xc9, 0xa5, 0x93, 0x77, 0x64, 0x94, 0x5e, 0x53, 0xc7, 0x30, 0x26, 0x8b,
+  0x8a, 0x96, 0x0e, 0x58, 0x2c, 0xa6, 0x86, 0xa7, 0x92, 0xba, 0x53, 0x14,
+  0x61, 0x48, 0xbf, 0xd0, 0xcc, 0x64, 0x81, 0x08, 0xe5, 0x2e, 0x5c, 0x61,
+  0xc7, 0x91, 0x9d, 0xbd, 0x90, 0x1f, 0x02, 0x7c, 0x9d, 0x8a, 0x6c, 0xa3,
+  0x95, 0x2a, 0x19, 0xad, 0xcb, 0xc3, 0xae, 0x2d, 0xbf, 0x09, 0xa4, 0x31,
+  0x70, 0xa1, 0xa9, 0xc1, 0xbb, 0xcf, 0xbd, 0x25, 0xe0, 0x64, 0x1f, 0x0f,
+  0x27, 0x33, 0xf4, 0xc7, 0x7b, 0x49, 0x9e, 0x78, 0xf6, 0x58, 0xe9, 0x10,
+  0x5b, 0x71, 0x77, 0xe4, 0x2c, 0x23, 0x05, 0x5e, 0xf2, 0x34, 0x46, 0xd9,
+  0x30, 0x98, 0xa9, 0x3a, 0xad, 0x55, 0xc6, 0x8a, 0xc2, 0x14, 0x2d, 0x73,
+  0x3b, 0x68, 0x6a, 0xe6, 0xf5, 0x6d, 0xf3, 0xf7, 0x52, 0xce, 0xee, 0x65,
+  0x6a, 0x44, 0xe4, 0xd5, 0xa6, 0x00, 0x8a, 0x5d, 0x10, 0x37, 0x92, 0x1b,
+  0xdd, 0x5e, 0x36, 0xa4, 0xc7, 0x7a, 0x85, 0x50, 0x4b, 0x9f, 0x6e, 0x1e,
+  0x9c, 0x26, 0x13, 0xd5, 0xd0, 0x8d, 0xd5, 0x91, 0xa5, 0xdc, 0xa0, 0x8d,
+  0x46, 0x00, 0x11, 0xbf, 0x9e, 0x3c, 0x15, 0x4d, 0xa9, 0x00, 0xd0, 0xf3,
+  0x94, 0x18, 0x89, 0x12, 0xc8, 0x65, 0x25, 0xec, 0x24, 0xd4, 0x1b, 0xa6,
+  0xb5, 0x3d, 0x52, 0x16, 0xe0, 0x3a, 0xec, 0xa5, 0x95, 0xe1, 0x5d, 0xd1,
+  0x8d, 0x7d, 0x70, 0x38, 0x24, 0x86, 0x5d, 0x33, 0x4a, 0x30, 0x13, 0x76,
+  0xa3, 0xed, 0xf9, 0xec, 0xbb, 0x0e, 0xb7, 0x83, 0x0b, 0xa8, 0x06, 0xc5,
+  0x38, 0x50, 0xed, 0xff, 0x78, 0x86, 0x8d, 0x88, 0x57, 0xc4, 0x1b, 0x0e,
+  0x6a, 0x61, 0x17, 0x89, 0x8a, 0xf3, 0xaa, 0xcd, 0xe7, 0xde, 0x6d, 0x43,
+  0x49, 0xb4, 0xc5, 0xab, 0x4e, 0xb5, 0xf2, 0x57, 0x9c, 0xf5, 0xbd, 0x9e,
+  0x70, 0x81, 0x96, 0x2f, 0xef, 0x97, 0x16, 0x90, 0x35, 0x19, 0x40, 0x6c,
+  0xbc, 0x90, 0x08, 0xa8, 0x6f, 0xb8, 0x20, 0x73, 0x7a, 0x1b, 0x43, 0x59,
+  0xac, 0x2b, 0xbf, 0x96, 0xac, 0x68, 0x69, 0x89, 0xf0, 0x45, 0x74, 0x32,
+  0x76, 0xbb, 0x00, 0x2e, 0x6a, 0x43, 0x94, 0xa3, 0xb1, 0x70, 0x08, 0x34,
+  0xac, 0x3a, 0xd4, 0x33, 0x6d, 0x1d, 0x72, 0xca, 0x3b, 0xa6, 0x6d, 0x03,
+  0xb0, 0x0e, 0xb1, 0x65, 0xec, 0x81, 0x1d, 0xc3, 0x76, 0xb1, 0x01, 0xb2,
+  0xad, 0xd2, 0x88, 0xee, 0x95, 0x66, 0xd1, 0x66, 0xa9, 0xbc, 0x00, 0xb8,
+  0xcd, 0xbc, 0x58, 0x32, 0xb6, 0x34, 0x31, 0x42, 0x46, 0x2f, 0x0f, 0xf1,
+  0x8a, 0xca, 0xb8, 0x5e, 0x35, 0x6b, 0x7f, 0x43, 0x0e, 0xb4, 0x21, 0x4a,
+  0xae, 0x0e, 0x7c, 0x15, 0x11, 0x85, 0xf3, 0x97, 0xef, 0xeb, 0xc4, 0x7f,
+  0x6e, 0xd6, 0x5f, 0xfa, 0x0e, 0x73, 0x98, 0x0a, 0x00, 0xdc, 0x3f, 0x86,
+  0x9e, 0x68, 0x75, 0xb6, 0x5e, 0xe7, 0xd2, 0xf0, 0x25, 0xde, 0x32, 0xcf,
+  0x87, 0x89, 0x94, 0xb2, 0xe4, 0x7b, 0xe1, 0x96, 0x63, 0x5d, 0x86, 0xfa,
+  0xc3, 0x3c, 0x7e, 0xc6, 0xba, 0x77, 0x8b, 0x88, 0x14, 0x9a, 0x63, 0x44,
+  0xa3, 0x9c, 0x01, 0x99, 0xd7, 0xcd, 0xd6, 0x81, 0x98, 0x13, 0x3b, 0xf8,
+  0x5a, 0xdf, 0x93, 0x0b, 0x2e, 0x84, 0x26, 0x65, 0x5c, 0xf0, 0xdb, 0xe5,
+  0xd0, 0x97, 0x8e, 0xde, 0x3c, 0x0a, 0xc2, 0x69, 0x17, 0x81, 0xe5, 0x68,
+  0xb9, 0x0b, 0xa0, 0x39, 0x2d, 0x97, 0xe7, 0x22, 0xf7, 0xd2, 0xb8, 0x31,
+  0xdf, 0x53, 0xf9, 0xb7, 0x4a, 0xc6, 0x56, 0x0e, 0xcf, 0x55, 0xd2, 0xb7,
+  0x4a, 0x47, 0x28, 0x6e, 0x54, 0x6e, 0x5d, 0x6b, 0x91, 0x26, 0x82, 0xb6,
+  0xe9, 0x35, 0x21, 0xf7, 0x35, 0x94, 0x85, 0xe7, 0x86, 0xc9, 0xbc, 0x1c,
+  0x96, 0xcf, 0x44, 0x50, 0x90, 0x2e, 0x90, 0x5e, 0x77, 0xea, 0x07, 0xb4,
+  0x17, 0x6a, 0x67, 0x29, 0x34, 0xe0, 0x93, 0x78, 0x30, 0x92, 0xae, 0x13,
+  0x50, 0x67, 0x65, 0xd5, 0x83, 0xdd, 0x58, 0xe5, 0xac, 0x23, 0x01, 0x48,
+  0xac, 0x7e, 0xb5, 0x6a, 0x21, 0x77, 0xd4, 0xba, 0x57, 0xe2, 0x43, 0x87,
+  0x72, 0xd4, 0x12, 0xf3, 0x43, 0xd6, 0x9d, 0xb4, 0xc6, 0x8f, 0xb2, 0xad,
+  0x7a, 0x24, 0x6d, 0x5b, 0xa1, 0xc0, 0x1a, 0x51, 0x12, 0x4b, 0x0d, 0x57,
+  0x54, 0xaa, 0xd2, 0x7d, 0xac, 0x9b, 0x0a, 0x20, 0xc2, 0x64, 0x67, 0xcc,
+  0x51, 0xcb, 0x01, 0x13, 0xba, 0x5a, 0x55, 0xb3, 0x56, 0xc0, 0x15, 0x9b,
+  0x27, 0x54, 0x9e, 0x35, 0xbc, 0x09, 0xfd, 0xc2, 0xaa, 0xb6, 0xe6, 0xa0,
+  0x42, 0xa0, 0x56, 0x9d, 0xdb, 0x5b, 0x4d, 0xa8, 0x13, 0xd6, 0x17, 0xd1,
+  0xda, 0x21, 0x1d, 0xa7, 0x85, 0x19, 0x58, 0xde, 0x83, 0xe7, 0x8f, 0x90,
+  0x46, 0x65, 0x75, 0x53, 0xc3, 0xfd, 0x85, 0xf1, 0x25, 0xc3, 0x28, 0xfd,
+  0x1d, 0xab, 0x41, 0x9a, 0xe5, 0xfc, 0x52, 0x29, 0xe3, 0xd5, 0xce, 0xc4,
+  0x44, 0xbb, 0x73, 0x1d, 0x3b, 0xb2, 0x9a, 0x1b, 0x44, 0x42, 0xf2, 0x56,
+  0x54, 0x14, 0x63, 0xd9, 0x6e, 0xf0, 0x52, 0xae, 0xd6, 0x91, 0xba, 0xf0,
+  0xd1, 0x69, 0x03, 0xdf, 0x2f, 0x32, 0x9b, 0x49, 0x48, 0xc8, 0x62, 0x19,
+  0x83, 0x23, 0x10, 0xe6, 0x3d, 0x81, 0x2a, 0x28, 0x26, 0x95, 0x03, 0x5a,
+  0x30, 0x47, 0x8d, 0xa1, 0x9d, 0x6a, 0xa4, 0xe9, 0xd6, 0x88, 0x7c, 0x4e,
+  0xb7, 0xc1, 0x65, 0x2b, 0x67, 0xbe, 0xef, 0xbe, 0x61, 0x95, 0xef, 0x2b,
+  0xaa, 0xbc, 0x26, 0x2b, 0xae, 0x31, 0x0f, 0x06, 0xff, 0x38, 0x57, 0x32,
+  0x53, 0xb3, 0xa4, 0xc0, 0x5d, 0xa8, 0x10, 0x5e, 0xd5, 0x52, 0x78, 0xbc,
+  0x18, 0x9e, 0x29, 0x73, 0xd7, 0x09, 0x55, 0xb9, 0x73, 0x2a, 0x77, 0xd1,
+  0xc2, 0x68, 0x6f, 0x0e, 0xf7, 0x06, 0x63, 0xe1, 0x72, 0x82, 0xb1, 0x2c,
+  0xf4, 0xf0, 0x82, 0x7a, 0xc6, 0xaa, 0x68, 0xcc, 0xa3, 0x86, 0x1f, 0xfe,
+  0xbf, 0xef, 0x18, 0xe1, 0x16, 0x85, 0x02, 0x08, 0x0c, 0x56, 0x1b, 0xff,
+  0xeb, 0x55, 0x48, 0xca, 0xc7, 0xe9, 0xee, 0x99, 0xda, 0x02, 0x2b, 0x9c,
+  0x21, 0x96, 0x29, 0xfe, 0x77, 0x52, 0xf3, 0xec, 0xf3, 0x01, 0x13, 0xbd,
+  0x51, 0x4a, 0x85, 0x8b, 0xf7, 0x84, 0x60, 0x48, 0xef, 0x03, 0xe3, 0xcb,
+  0x60, 0x39, 0x1a, 0xc8, 0x18, 0x23, 0x56, 0x32, 0xaf, 0x4a, 0x05, 0xb5,
+  0x82, 0x7a, 0x1d, 0x33, 0x96, 0xec, 0x2b, 0x0d, 0x6b, 0x32, 0xea, 0x64,
+  0xbd, 0xb0, 0xe2, 0x65, 0xde, 0xaa, 0x96, 0xdf, 0x2b, 0xed, 0x95, 0xab,
+  0xdf, 0x67, 0xe8, 0x57, 0x45, 0x59, 0x05, 0xeb, 0xec, 0x55, 0xa8, 0xb4,
+  0x57, 0xe0, 0xe6, 0x21, 0x19, 0x63, 0x61, 0x35, 0xbd, 0xb9, 0xe2, 0xd5,
+  0xe3, 0xd6, 0xd6, 0x93, 0xbc, 0xfa, 0x18, 0x4b, 0xeb, 0x55, 0x2c, 0xae,
+  0x17, 0xf4, 0x08, 0x29, 0x28, 0xb0, 0x67, 0x36, 0x96, 0xad, 0x94, 0x2e,
+  0x77, 0x3f, 0xf2, 0x63, 0x6a, 0x35, 0x28, 0x57, 0x43, 0xee, 0x15, 0xb9,
+  0x54, 0x15, 0xf4, 0xc2, 0x6e, 0x4a, 0x25, 0xdc, 0xcd, 0xa9, 0x5b, 0x57,
+  0xa9, 0xc2, 0x0f, 0x3a, 0xcd, 0x51, 0x8c, 0xf5, 0x8f, 0xd0, 0xaa, 0x73,
+  0xf0, 0x13, 0x4a, 0x0e, 0xfe, 0x41, 0x30, 0xc4, 0xcd, 0x78, 0xd4, 0x15,
+  0xf8, 0xd5, 0xb9, 0xc1, 0xc2, 0x7c, 0x11, 0x9e, 0xb5, 0x16, 0x1a, 0x5d,
+  0x6c, 0x6a, 0x94, 0x6e, 0xe5, 0x4c, 0x2d, 0xa4, 0x6c, 0xd3, 0x3c, 0x4b,
+  0xaa, 0x00, 0x42, 0x8c, 0x86, 0xdc, 0xa2, 0x42, 0xa7, 0xba, 0x71, 0x45,
+  0x3a, 0xa3, 0x17, 0x6c, 0xcc, 0x29, 0xc9, 0x59, 0xb8, 0x51, 0xf5, 0x33,
+  0xe3, 0x7f, 0x23, 0x2a, 0x5b, 0x96, 0x88, 0xa0, 0x7c, 0x0a, 0x0d, 0xc4,
+  0x94, 0xea, 0xc2, 0x26, 0x66, 0x62, 0xd3, 0x83, 0xc5, 0x8f, 0x4a, 0x2a,
+  0x31, 0x3d, 0x55, 0x4a, 0x52, 0x3a, 0xdd, 0x18, 0x1d, 0x4f, 0x7c, 0x01,
+  0x84, 0x14, 0x89, 0x02, 0x90, 0x92, 0x7f, 0x8b, 0xae, 0xd2, 0x09, 0x25,
+  0xee, 0x63, 0x5e, 0xd7, 0xd3, 0x8f, 0x8a, 0x68, 0xe8, 0x13, 0x11, 0x77,
+  0x5a, 0x4c, 0xb5, 0x1f, 0xaa, 0x1a, 0x16, 0x1b, 0x72, 0x59, 0xf1, 0xb0,
+  0x19, 0xab, 0x67, 0x91, 0xdb, 0x63, 0xbc, 0xd2, 0xa1, 0x5f, 0x73, 0x2f,
+  0xae, 0x98, 0x0d, 0xf4, 0x81, 0x93, 0x17, 0xbc, 0xc4, 0x95, 0xa8, 0x56,
+  0x9b, 0xfe, 0x0c, 0xfa, 0xe5, 0xd9, 0xa2, 0x8b, 0x76, 0x66, 0x12, 0x98,
+  0x00, 0xf1, 0x59, 0x48, 0xe0, 0x2b, 0xc6, 0x82, 0x14, 0x70, 0xae, 0x76,
+  0x78, 0xb0, 0xea, 0xf3, 0x2b, 0xae, 0x05, 0x66, 0xb7, 0xba, 0x33, 0xa6,
+  0x88, 0x9d, 0xba, 0xe0, 0x4d, 0x7f, 0x36, 0xfd, 0x18, 0x78, 0xe2, 0x4f,
+  0xb1, 0x28, 0x26, 0xee, 0xec, 0x70, 0xc1, 0xbc, 0x70, 0xff, 0x5b, 0x5b,
+  0x88, 0xc0, 0x89, 0x23, 0x63, 0x70, 0xf0, 0x76, 0x55, 0x1c, 0x66, 0x98,
+  0x3a, 0xef, 0x91, 0xbf, 0x9f, 0xaa, 0x1e, 0x1d, 0xff, 0x04, 0x6b, 0x1a,
+  0xf3, 0xe9, 0xfe, 0xe8, 0x0b, 0x3a, 0x38, 0x5c, 0x7d, 0xb9, 0x66, 0x75,
+  0x5c, 0x87, 0x1d, 0xe3, 0x78, 0xf1, 0xfb, 0xcb, 0xfc, 0xd1, 0xf9, 0x9e,
+  0x63, 0xcf, 0x33, 0x3c, 0x6f, 0x5e, 0x9c, 0x1c, 0x14, 0x62, 0xa2, 0xaf,
+  0xc1, 0xa2, 0x2a, 0xec, 0x9b, 0xf0, 0xe7, 0xa7, 0x32, 0x72, 0x44, 0x64,
+  0x7d, 0xa0, 0x7c, 0x2f, 0x5f, 0xc4, 0x39, 0x12, 0x25, 0x6c, 0xc9, 0x69,
+  0x5c, 0x70, 0x27, 0x7c, 0x8a, 0x34, 0x5d, 0xf8, 0x92, 0x9e, 0xc6, 0x51,
+  0x2a, 0x16, 0x9e, 0xc4, 0x71, 0x1a, 0x2e, 0x3e, 0x45, 0x1a, 0x2e, 0x1e,
+  0xd3, 0x39, 0x7c, 0xa2, 0xdd, 0x26, 0x5c, 0xa7, 0xff, 0x38, 0xfd, 0xf5,
+  0xf4, 0x57, 0xc0, 0xf6, 0xff, 0x06, 0x18, 0xe9, 0xff, 0x9c, 0xfe, 0x1d,
+  0x88, 0x99, 0xbf, 0x9c, 0xfe, 0xbf, 0xd3, 0xff, 0x07, 0xfb, 0xf8, 0x9f,
+  0xd3, 0x77, 0xa7, 0xff, 0x94, 0x00, 0xf7, 0x78, 0x17, 0x9e, 0xfd, 0xdd,
+  0xf4, 0x5f, 0xe1, 0xbf, 0xef, 0x4e, 0xff, 0xc7, 0xf4, 0x5d, 0xac, 0x5b,
+  0xf3, 0x2e, 0xfc, 0xef, 0x37, 0xf0, 0xdf, 0x7f, 0x83, 0x87, 0xff, 0x38,
+  0xfd, 0x37, 0x82, 0xd5, 0x6e, 0x9f, 0x0d, 0x1f, 0xf6, 0x21, 0xeb, 0x76,
+  0xf8, 0xa0, 0x77, 0xd4, 0x17, 0x5f, 0x82, 0x43, 0x3e, 0x6c, 0x42, 0x82,
+  0x49, 0x20, 0x12, 0x4e, 0x7f, 0x6e, 0x2b, 0xca, 0xb0, 0xde, 0x0f, 0xce,
+  0xc4, 0xc7, 0x4a, 0x50, 0xa7, 0x24, 0xbe, 0x59, 0xcf, 0xa3, 0x4d, 0x05,
+  0x91, 0xc0, 0xb2, 0xcc, 0x9c, 0xd3, 0xb6, 0x23, 0xca, 0x95, 0xf9, 0xa5,
+  0x16, 0x0a, 0x82, 0x96, 0xb2, 0x63, 0xa2, 0x58, 0x81, 0x08, 0xe1, 0xd0,
+  0xeb, 0x59, 0xcb, 0x0f, 0x87, 0xed, 0xfe, 0x4b, 0x23, 0x3c, 0xa8, 0xe4,
+  0x37, 0x0e, 0xa4, 0x92, 0xe4, 0x32, 0x9e, 0xab, 0x88, 0x51, 0xf3, 0x29,
+  0xe8, 0xbb, 0xa3, 0x6c, 0x87, 0x54, 0x2e, 0x7e, 0x9a, 0x96, 0x90, 0x32,
+  0xa4, 0x5c, 0xf3, 0xe3, 0xdb, 0xce, 0xfc, 0x4e, 0x99, 0xa6, 0x67, 0xfa,
+  0xae, 0xae, 0xba, 0x12, 0xed, 0xb4, 0xb8, 0xd2, 0x6c, 0x24, 0x53, 0xcc,
+  0x24, 0x66, 0x1c, 0xe8, 0xf6, 0x7a, 0x2a, 0xf6, 0xc1, 0xf5, 0x19, 0x56,
+  0xcf, 0xb5, 0xdb, 0xb0, 0xe5, 0xeb, 0x8a, 0x76, 0x89, 0x87, 0x54, 0xf2,
+  0x08, 0x0b, 0xc8, 0xa9, 0x42, 0xf4, 0xcf, 0x3f, 0xf0, 0x52, 0xd7, 0xbb,
+  0x81, 0xb9, 0xe7, 0x94, 0x25, 0x80, 0xd8, 0x03, 0x69, 0x3d, 0xd7, 0x8f,
+  0xe2, 0x80, 0xec, 0xfb, 0x21, 0x4b, 0x07, 0x64, 0x0a, 0xd4, 0xc5, 0xe4,
+  0x2d, 0x4b, 0x54, 0x3c, 0x15, 0xff, 0x6a, 0x34, 0x3b, 0xe3, 0xe1, 0xca,
+  0xea, 0xb5, 0x55, 0x72, 0xbb, 0x84, 0x5f, 0x32, 0x9d, 0xc9, 0x5a, 0xbd,
+  0x79, 0x6b, 0xfe, 0xb6, 0x76, 0x15, 0x16, 0x1f, 0xd5, 0x16, 0x17, 0x5e,
+  0x9c, 0x6f, 0x2f, 0x2c, 0xb6, 0x4f, 0x2d, 0xd4, 0x18, 0x44, 0x60, 0xfc,
+  0x38, 0xa3, 0x88, 0x81, 0xa4, 0xfa, 0x03, 0xf1, 0x62, 0x4d, 0x7a, 0x55,
+  0xbf, 0x44, 0x2e, 0xd5, 0x08, 0x47, 0x3e, 0x59, 0x58, 0xc4, 0x27, 0xca,
+  0x15, 0xd9, 0x6d, 0xbf, 0x70, 0xca, 0x6b, 0xff, 0x27, 0xa2, 0x3d, 0x35,
+  0x97, 0x58, 0xed, 0xa7, 0xe9, 0x6b, 0x4b, 0x22, 0xc2, 0xbf, 0xf1, 0x27,
+  0x4d, 0xb4, 0x59, 0xf5, 0x1b, 0xa4, 0x36, 0x10, 0xaf, 0x77, 0x40, 0x34,
+  0xdd, 0xce, 0x55, 0x83, 0x85, 0x45, 0xbf, 0x45, 0x65, 0x77, 0xec, 0xc3,
+  0x78, 0x41, 0x63, 0x5e, 0x0b, 0x82, 0x5c, 0xc9, 0x49, 0x5b, 0x2f, 0xac,
+  0xa7, 0xec, 0xa7, 0x6d, 0xa1, 0x52, 0x0d, 0x45, 0x74, 0xe0, 0x0e, 0xa2,
+  0x67, 0x25, 0xa0, 0x3d, 0x51, 0xb6, 0xc6, 0x3d, 0x7f, 0x6e, 0xaf, 0x45,
+  0xcc, 0xb5, 0xdb, 0x6b, 0x68, 0x92, 0xb7, 0xcb, 0x37, 0xba, 0x92, 0x73,
+  0xa8, 0xa8, 0x99, 0x1f, 0x05, 0x6f, 0x1c, 0x80, 0x15, 0x80, 0x62, 0x1f,
+  0x60, 0xd5, 0x2a, 0xe2, 0x06, 0xec, 0xe3, 0x57, 0xc9, 0x0b, 0x5c, 0xf3,
+  0x98, 0xaa, 0x8e, 0xe0, 0x18, 0x1b, 0xff, 0x24, 0xa1, 0x7b, 0x8b, 0xc3,
+  0x63, 0xe2, 0x7e, 0xe1, 0x3e, 0x6e, 0xb3, 0xb8, 0x88, 0x47, 0x68, 0x17,
+  0xa1, 0x9e, 0xef, 0x30, 0x1e, 0x1a, 0xa2, 0xcc, 0xd4, 0x2a, 0xdf, 0xc4,
+  0xdc, 0xc6, 0xbd, 0x9e, 0x43, 0x1e, 0xe4, 0x8c, 0x1b, 0xc7, 0x9d, 0xc8,
+  0xed, 0x9e, 0x64, 0x2a, 0x63, 0xf6, 0x71, 0x79, 0x91, 0xa1, 0x48, 0xe3,
+  0x56, 0x29, 0xce, 0x5e, 0x65, 0x07, 0x19, 0x36, 0x73, 0xc8, 0x25, 0xfe,
+  0x07, 0xb4, 0xc2, 0x85, 0xc5, 0x04, 0x93, 0xf5, 0x9a, 0xee, 0xa3, 0xfe,
+  0x0d, 0x3e, 0x23, 0xf0, 0x0d, 0xe6, 0x51, 0x0c, 0x2c, 0xdb, 0x79, 0xa8,
+  0x7a, 0x49, 0x60, 0xbf, 0x7c, 0xa4, 0xab, 0x93, 0xbc, 0x25, 0x77, 0x98,
+  0xcc, 0x3f, 0x11, 0x0f, 0x2c, 0x73, 0xb7, 0xe6, 0xcf, 0xa8, 0xbc, 0x21,
+  0x88, 0xc1, 0x22, 0x03, 0x05, 0xc8, 0xbd, 0xad, 0xe4, 0xe0, 0x47, 0x62,
+  0x83, 0xfe, 0x90, 0x0a, 0xc5, 0x3d, 0x46, 0x55, 0x83, 0xe9, 0x41, 0x5e,
+  0x95, 0x7f, 0x06, 0x52, 0xd4, 0xdf, 0x05, 0x70, 0x3a, 0x78, 0x67, 0x86,
+  0x3d, 0xac, 0x19, 0xe5, 0xd3, 0xd8, 0xb7, 0xe1, 0x05, 0x71, 0x98, 0x88,
+  0x85, 0xdc, 0x86, 0x71, 0xb8, 0xa0, 0x85, 0xdc, 0x84, 0x2f, 0xff, 0xe7,
+  0x8c, 0x5b, 0xb0, 0x55, 0xfc, 0x92, 0x1a, 0x45, 0x1e, 0xec, 0x47, 0x72,
+  0xd6, 0x57, 0xe4, 0x7e, 0x16, 0xfe, 0xec, 0x8b, 0xcd, 0x19, 0x7d, 0xf7,
+  0x83, 0x83, 0x3f, 0x8e, 0x50, 0x05, 0x54, 0x71, 0x3c, 0xcd, 0x91, 0xcf,
+  0x1c, 0xaf, 0x50, 0x14, 0xba, 0xaf, 0x10, 0x5d, 0x71, 0x92, 0x79, 0x88,
+  0xd4, 0x1f, 0xf2, 0xe9, 0xdd, 0xe2, 0x90, 0x16, 0xff, 0x78, 0xb5, 0xa0,
+  0x5a, 0x51, 0x2e, 0x33, 0x7e, 0xca, 0x32, 0x63, 0xdd, 0xd2, 0x08, 0x59,
+  0xa9, 0xa5, 0x66, 0xe0, 0x59, 0x81, 0x38, 0xce, 0x15, 0x4c, 0xd5, 0x01,
+  0xb0, 0x6c, 0x3a, 0xf0, 0x90, 0xe5, 0x19, 0x11, 0xee, 0x58, 0x57, 0x98,
+  0xaa, 0x3c, 0xb8, 0x10, 0x88, 0x66, 0xd0, 0xcc, 0x39, 0x9d, 0x4a, 0xdf,
+  0x08, 0xd4, 0x29, 0x2c, 0xb8, 0xe4, 0x7e, 0xf4, 0x92, 0xb8, 0xef, 0x1c,
+  0x62, 0x02, 0x6c, 0x54, 0xb4, 0x20, 0xa1, 0x3a, 0xe7, 0x89, 0x78, 0xab,
+  0x78, 0xbb, 0x51, 0xd8, 0x98, 0xfa, 0x18, 0x77, 0x85, 0xd5, 0x1b, 0xdb,
+  0x1d, 0x3c, 0x9f, 0xbc, 0x17, 0x43, 0x92, 0x29, 0x00, 0x55, 0x44, 0xbd,
+  0xa2, 0xf1, 0x2c, 0x47, 0x5d, 0xd6, 0x74, 0x17, 0x32, 0x7f, 0x87, 0xfc,
+  0x69, 0xe7, 0xf0, 0x08, 0xe9, 0xce, 0x12, 0xe9, 0xd6, 0x23, 0xda, 0x93,
+  0x36, 0x2d, 0x92, 0xd3, 0x17, 0xff, 0xdb, 0xee, 0x65, 0xa3, 0x54, 0xe6,
+  0x26, 0x85, 0xa6, 0x33, 0x24, 0xfa, 0xf5, 0x3d, 0x8b, 0x84, 0x06, 0x5b,
+  0xaf, 0x04, 0xe6, 0x42, 0xa4, 0xb0, 0xe9, 0xe8, 0x97, 0xc6, 0x28, 0x27,
+  0xd2, 0xbc, 0x80, 0xec, 0x65, 0xfb, 0x48, 0x44, 0xe1, 0xcb, 0x55, 0x15,
+  0x82, 0x2e, 0x5f, 0x4d, 0xaa, 0x66, 0x23, 0x36, 0x0e, 0x34, 0x7a, 0x1b,
+  0xba, 0x0b, 0x42, 0x64, 0x10, 0xf1, 0x9c, 0x67, 0xbc, 0x0c, 0x3c, 0x5f,
+  0xdb, 0xbd, 0x47, 0x59, 0x78, 0x02, 0x6e, 0x35, 0x46, 0x4f, 0xc3, 0x55,
+  0x34, 0x15, 0xbc, 0xd7, 0xc3, 0xa1, 0xb6, 0x61, 0x8e, 0xd1, 0xd2, 0x0b,
+  0xc6, 0x65, 0x20, 0x84, 0xc3, 0xac, 0x5c, 0x04, 0xc4, 0x8c, 0x43, 0x7d,
+  0xe7, 0x30, 0x0e, 0x09, 0xc5, 0x42, 0x0d, 0x73, 0x6b, 0x1e, 0x8d, 0x07,
+  0x08, 0x59, 0x19, 0x33, 0xe0, 0x86, 0xf3, 0x33, 0xac, 0x0c, 0xa0, 0xaf,
+  0xac, 0xa7, 0x6f, 0x65, 0xc9, 0x70, 0xa4, 0x51, 0x10, 0x8e, 0x9e, 0xb5,
+  0x70, 0xb2, 0x85, 0xa3, 0xa1, 0xa5, 0xaf, 0xa2, 0x6c, 0xb0, 0x2d, 0xe5,
+  0xd8, 0xf8, 0x5f, 0x1c, 0xea, 0xbf, 0x38, 0xd4, 0x7f, 0x6c, 0x0e, 0x45,
+  0xe5, 0xed, 0xd4, 0xd2, 0x0a, 0xc4, 0x91, 0x1c, 0xd3, 0x45, 0x4b, 0xca,
+  0x44, 0x02, 0x8a, 0xb8, 0x0c, 0x55, 0x52, 0xb5, 0x04, 0xf6, 0x48, 0x6e,
+  0x14, 0x2e, 0x95, 0xf5, 0x35, 0x48, 0x94, 0xb0, 0xaa, 0x45, 0x5d, 0x94,
+  0xec, 0xba, 0x45, 0x75, 0x5a, 0x24, 0xb7, 0xc4, 0xc2, 0xe0, 0xea, 0x93,
+  0xdb, 0xf5, 0xa6, 0x09, 0xd2, 0xd1, 0x20, 0xb5, 0x46, 0xbb, 0x1a, 0x40,
+  0xdd, 0x3c, 0x02, 0x4e, 0x6a, 0xba, 0xab, 0x01, 0x93, 0x8d, 0x39, 0x28,
+  0x8f, 0x9d, 0xdc, 0x18, 0xee, 0xe7, 0x31, 0x68, 0x54, 0x8a, 0xa8, 0xe3,
+  0xed, 0x6d, 0x19, 0x87, 0x65, 0x8d, 0x90, 0x49, 0x96, 0x22, 0xa5, 0xed,
+  0xd6, 0x68, 0xb8, 0xd3, 0xe0, 0x9d, 0x34, 0x45, 0x3c, 0x06, 0xde, 0xa6,
+  0xcf, 0x26, 0x32, 0xbf, 0x0a, 0x93, 0x31, 0xf1, 0xbe, 0x59, 0x46, 0x17,
+  0xda, 0x83, 0x7a, 0x30, 0x5a, 0xfb, 0x5c, 0x09, 0x80, 0xda, 0xc2, 0xd6,
+  0xe7, 0x93, 0x66, 0xd3, 0x0f, 0x0c, 0x16, 0x69, 0x90, 0xa2, 0x14, 0x5e,
+  0xe7, 0x50, 0xad, 0x4f, 0x4c, 0x81, 0xaa, 0x25, 0x69, 0x96, 0xf7, 0x82,
+  0x85, 0xcf, 0xeb, 0x34, 0x3f, 0x34, 0x7c, 0x45, 0x42, 0xdf, 0x56, 0x22,
+  0x6c, 0x01, 0xaa, 0x88, 0x0e, 0x2b, 0x33, 0xc8, 0xae, 0xa8, 0x26, 0xcc,
+  0xcf, 0x82, 0x6e, 0x05, 0xfa, 0x15, 0x74, 0x71, 0xcb, 0xc0, 0xb2, 0xc3,
+  0x26, 0xf5, 0x37, 0xe5, 0x21, 0xcc, 0xde, 0x8d, 0x99, 0x45, 0x95, 0x56,
+  0x04, 0x53, 0x16, 0xb8, 0x1c, 0x9e, 0x84, 0xaf, 0x94, 0x2a, 0x04, 0x64,
+  0x64, 0x83, 0x9c, 0x28, 0x91, 0xd2, 0xff, 0x76, 0x71, 0x70, 0xe6, 0xf1,
+  0x74, 0x45, 0x75, 0x51, 0x6e, 0x17, 0xc4, 0x6e, 0x16, 0x10, 0xe6, 0x48,
+  0x21, 0x9c, 0x05, 0x70, 0x67, 0x8a, 0xe4, 0xf4, 0x82, 0x96, 0x67, 0xd9,
+  0x11, 0xba, 0x79, 0xd1, 0x6e, 0xd0, 0x8d, 0xbc, 0x9d, 0x50, 0x18, 0x30,
+  0x6a, 0xbe, 0xb3, 0x30, 0xf7, 0xe2, 0xe5, 0x2b, 0x40, 0x3b, 0xe4, 0xaa,
+  0x2b, 0x54, 0xc4, 0x1c, 0xdf, 0x8a, 0x9b, 0xa1, 0x9b, 0xea, 0xab, 0xed,
+  0x18, 0x83, 0x85, 0x23, 0x30, 0x0f, 0xb5, 0xca, 0x66, 0xd2, 0x10, 0xdb,
+  0x05, 0x1e, 0xd5, 0x69, 0x5f, 0x35, 0xfe, 0x37, 0xac, 0x34, 0x0e, 0x84,
+  0xce, 0x16, 0x49, 0x3d, 0x01, 0x15, 0xb5, 0x1f, 0xb9, 0xe7, 0x9a, 0x15,
+  0x66, 0x08, 0xde, 0xd3, 0x49, 0x09, 0x2b, 0xc4, 0xef, 0x1d, 0x9f, 0x65,
+  0x62, 0xc6, 0xa8, 0xbe, 0x7f, 0xf6, 0xed, 0x03, 0x4f, 0x2d, 0xb6, 0xcf,
+  0x1f, 0x00, 0xdd, 0x4e, 0xd4, 0xe3, 0x68, 0xa4, 0x1f, 0x3f, 0x13, 0xd5,
+  0x89, 0x59, 0x70, 0x1c, 0x62, 0xad, 0xfa, 0x41, 0x8f, 0x1a, 0x36, 0x72,
+  0x04, 0x96, 0x37, 0x93, 0x73, 0xe7, 0x54, 0x48, 0x5e, 0x34, 0x02, 0x2e,
+  0xbc, 0x15, 0xce, 0x39, 0x21, 0x33, 0xe7, 0xac, 0x9a, 0xb8, 0x4f, 0x2d,
+  0x22, 0xce, 0x5d, 0xe0, 0x5f, 0xce, 0xa0, 0xb8, 0xb3, 0xe6, 0xc2, 0xe3,
+  0x96, 0xa4, 0xf3, 0xe2, 0x75, 0x9e, 0x6d, 0xc4, 0x97, 0xb6, 0x07, 0x3f,
+  0xfb, 0xa0, 0xaf, 0xc3, 0x74, 0xfd, 0x14, 0xe3, 0xbe, 0x8c, 0x2c, 0x71,
+  0x9c, 0xa1, 0x5f, 0xfe, 0x56, 0xfe, 0x03, 0x89, 0x02, 0x0b, 0x5b, 0xf9,
+  0x0e, 0x1b, 0x08, 0x16, 0xbb, 0x0f, 0x3f, 0xe5, 0x58, 0x30, 0x0c, 0x44,
+  0xe7, 0x87, 0x93, 0xe2, 0x12, 0x0e, 0x27, 0x6d, 0x05, 0x58, 0x67, 0xcb,
+  0x63, 0x7d, 0x33, 0xe6, 0x4f, 0x2e, 0x70, 0x67, 0x3b, 0x4e, 0xa4, 0x66,
+  0xcd, 0x17, 0x2f, 0x5d, 0x50, 0x7f, 0x09, 0x07, 0xd6, 0x87, 0x58, 0x4e,
+  0x55, 0xb8, 0xab, 0xb8, 0x8e, 0xa8, 0xb6, 0x5e, 0x28, 0xbd, 0x37, 0x56,
+  0x7a, 0x21, 0x7e, 0xfd, 0x37, 0xba, 0xa1, 0x20, 0x73, 0xf3, 0x92, 0xb1,
+  0x6f, 0xf4, 0xf7, 0x46, 0xca, 0x21, 0x5b, 0x0d, 0x1e, 0xad, 0x52, 0x7e,
+  0xa4, 0x19, 0x6c, 0x05, 0xb5, 0xd2, 0x39, 0x75, 0xab, 0x0c, 0xec, 0x57,
+  0x64, 0xff, 0x7f, 0x1c, 0x72, 0x48, 0xb6, 0x06, 0x85, 0x9b, 0xd5, 0x52,
+  0xa6, 0x91, 0xde, 0x20, 0x30, 0x24, 0xfd, 0xd2, 0x53, 0xa6, 0x81, 0x34,
+  0xf0, 0xa4, 0x48, 0x9f, 0xc6, 0xbb, 0x50, 0x8a, 0x89, 0x40, 0x07, 0xf2,
+  0xd5, 0xc4, 0x1e, 0xf0, 0x9c, 0x76, 0x2b, 0xaf, 0xe0, 0x52, 0xfe, 0x33,
+  0x78, 0xfb, 0x77, 0xd3, 0x5f, 0xe8, 0x77, 0xff, 0x1b, 0x3f, 0xfa, 0xe5,
+  0xf4, 0x37, 0xf0, 0xe0, 0x9f, 0xe1, 0xe5, 0xdf, 0x50, 0xbb, 0x9f, 0x69,
+  0x17, 0xe0, 0x20, 0x21, 0x8f, 0x47, 0x7d, 0xb9, 0x68, 0xab, 0x2f, 0xb7,
+  0xbf, 0xa6, 0xc0, 0xf2, 0x8c, 0xeb, 0xd3, 0x9f, 0x91, 0x8b, 0xc6, 0xa7,
+  0xbc, 0xb6, 0xed, 0x63, 0xf8, 0xe3, 0x4d, 0x9a, 0xbb, 0x47, 0xe4, 0xb9,
+  0xfc, 0xb6, 0x55, 0xcd, 0xa0, 0xf8, 0x3c, 0x71, 0xed, 0x90, 0x85, 0xde,
+  0xab, 0xbf, 0x7f, 0x37, 0xa6, 0x39, 0x74, 0x02, 0x57, 0xb9, 0xfe, 0xda,
+  0x09, 0xc2, 0x72, 0x97, 0x87, 0xd6, 0x9f, 0x17, 0x68, 0x91, 0xbf, 0x60,
+  0x4d, 0xf2, 0xb1, 0x6a, 0x93, 0x0b, 0x34, 0xca, 0xc7, 0xa6, 0x55, 0x3e,
+  0xac, 0x66, 0x39, 0x3b, 0x2e, 0x8d, 0xb2, 0xc7, 0xe8, 0xbd, 0x54, 0xfa,
+  0x7c, 0xab, 0xaa, 0xa3, 0xc6, 0x2b, 0x02, 0x52, 0x9f, 0xfe, 0x1c, 0x79,
+  0x2c, 0x5d, 0x16, 0xa8, 0x52, 0xf3, 0x27, 0xd3, 0xc7, 0x70, 0xdc, 0xdf,
+  0xaa, 0xc3, 0x9e, 0xfe, 0x0c, 0xfe, 0x40, 0xcf, 0xa5, 0x37, 0xe9, 0xdf,
+  0x5f, 0x1f, 0xbc, 0x4e, 0xff, 0xfe, 0xab, 0xfc, 0xfd, 0x2b, 0xf5, 0x7c,
+  0xfa, 0x9e, 0x6c, 0xf7, 0x46, 0xfd, 0x76, 0xcb, 0xc8, 0xdf, 0xe8, 0x6d,
+  0xab, 0x0f, 0x8b, 0x3a, 0xfe, 0x52, 0x88, 0x15, 0x20, 0xf3, 0x0b, 0xd8,
+  0x63, 0x6f, 0x1c, 0xbc, 0x73, 0xf0, 0x97, 0x07, 0x6f, 0x0b, 0x2c, 0xfe,
+  0x0d, 0x10, 0x7b, 0x44, 0xf0, 0xff, 0x17, 0x20, 0x27, 0xfe, 0xfa, 0x05,
+  0x5c, 0x76, 0x04, 0x2e, 0x7f, 0x83, 0x11, 0x5b, 0xea, 0xd9, 0xf4, 0x23,
+  0xfa, 0xeb, 0x1f, 0x0f, 0x7e, 0x2a, 0x31, 0xc7, 0xbf, 0x3e, 0x91, 0xed,
+  0x1e, 0x4d, 0x7f, 0x2b, 0xb1, 0xfd, 0x40, 0xbe, 0x7d, 0x77, 0xfa, 0xb1,
+  0x1c, 0xc1, 0x2f, 0x31, 0x32, 0x8e, 0xfe, 0xfa, 0x39, 0x96, 0x0e, 0xb2,
+  0x46, 0x21, 0x9c, 0x82, 0xcd, 0x38, 0xc4, 0x6f, 0x1c, 0x49, 0xb5, 0xea,
+  0x27, 0x33, 0x07, 0x72, 0x17, 0x84, 0x3a, 0xa9, 0xe5, 0xe1, 0xee, 0x34,
+  0xb8, 0x3b, 0xed, 0xed, 0x0c, 0x9c, 0xcd, 0x46, 0x8d, 0x68, 0x73, 0xc8,
+  0x0d, 0xf7, 0xa2, 0xbd, 0xdf, 0xaa, 0x46, 0x2d, 0x3b, 0xca, 0x23, 0xb5,
+  0x37, 0xe6, 0x51, 0x28, 0x0d, 0x5d, 0xe9, 0x9c, 0x48, 0x3d, 0x19, 0xf9,
+  0x10, 0x0d, 0x41, 0xb6, 0x5d, 0x74, 0x8e, 0x35, 0x22, 0xef, 0x88, 0x23,
+  0x5c, 0x28, 0x18, 0xe1, 0xc2, 0x31, 0x8c, 0x70, 0xa1, 0x68, 0x84, 0x3a,
+  0x47, 0x0f, 0xfc, 0xf5, 0xe9, 0xf4, 0xf1, 0x71, 0x8f, 0x6d, 0xb1, 0x60,
+  0x6c, 0x8b, 0xc7, 0x30, 0x36, 0x11, 0xb7, 0xf6, 0x6b, 0x77, 0x9d, 0xb3,
+  0xc8, 0xbf, 0xe9, 0xc3, 0xe3, 0x1e, 0xd3, 0xa9, 0x82, 0x31, 0x9d, 0x3a,
+  0x86, 0x31, 0x9d, 0xa2, 0x31, 0xfd, 0x72, 0xfa, 0x18, 0xb6, 0xf3, 0x07,
+  0xd3, 0xdf, 0x4e, 0x9f, 0xc4, 0x2b, 0x0c, 0x07, 0x22, 0xdf, 0xa3, 0xda,
+  0xc3, 0x60, 0x64, 0x5c, 0xc1, 0xcc, 0x14, 0x45, 0xc8, 0x95, 0x06, 0x7a,
+  0x55, 0x8a, 0x8a, 0x53, 0xc1, 0x5d, 0x5c, 0x6d, 0x6a, 0xdf, 0xeb, 0x22,
+  0x81, 0x6c, 0xe5, 0x7a, 0xf4, 0xe6, 0x44, 0x0b, 0x8d, 0xff, 0x20, 0x05,
+  0x42, 0xfc, 0xdf, 0xbb, 0x4b, 0xc9, 0xf4, 0x3d, 0x10, 0xb4, 0x3e, 0x01,
+  0x89, 0x55, 0xb4, 0x14, 0xdc, 0x96, 0xb6, 0x3a, 0x6d, 0xf4, 0x83, 0x9f,
+  0xa8, 0x28, 0x05, 0x27, 0x52, 0xcc, 0x8f, 0x92, 0x2a, 0x50, 0x4a, 0x14,
+  0xd2, 0xa4, 0x30, 0xec, 0xcd, 0xa6, 0x89, 0x57, 0x69, 0x3d, 0x12, 0xa9,
+  0x56, 0xc5, 0x00, 0x10, 0xc8, 0x62, 0x56, 0x2d, 0x48, 0x2d, 0x12, 0x9e,
+  0x76, 0xe8, 0x3e, 0xab, 0x44, 0xa6, 0x95, 0x50, 0xdb, 0xbf, 0x6b, 0x56,
+  0x3c, 0x24, 0x67, 0x0b, 0x59, 0xff, 0xd2, 0x1c, 0x91, 0xbe, 0x6d, 0xc5,
+  0x89, 0xc8, 0x8e, 0x44, 0xb9, 0x96, 0x70, 0x22, 0xdf, 0x75, 0x35, 0x90,
+  0xe6, 0xe4, 0xb8, 0x99, 0x6b, 0x7c, 0x2c, 0x14, 0x17, 0x2d, 0x92, 0x91,
+  0x1c, 0xeb, 0x50, 0x4c, 0xa2, 0x91, 0x59, 0x99, 0x6a, 0xa1, 0x39, 0xe6,
+  0x38, 0x42, 0x8d, 0xbf, 0x2c, 0x8c, 0x34, 0x68, 0x22, 0xfa, 0xcf, 0xca,
+  0x44, 0x23, 0xb6, 0xad, 0xa7, 0xc6, 0x40, 0x67, 0xe9, 0xef, 0x19, 0x32,
+  0x4f, 0x37, 0x70, 0xb7, 0x42, 0xc8, 0xae, 0x67, 0x3e, 0x3b, 0x52, 0xd4,
+  0x6e, 0x95, 0x78, 0xdd, 0x0a, 0x3d, 0x56, 0x0e, 0xd9, 0x2d, 0x29, 0xfb,
+  0xa6, 0xcc, 0x73, 0x47, 0xcd, 0x8e, 0x1b, 0x08, 0x40, 0xac, 0x1c, 0x5d,
+  0x53, 0x11, 0x62, 0x24, 0xe5, 0xad, 0x53, 0x38, 0xad, 0x20, 0xe5, 0xad,
+  0xd3, 0xd2, 0x4a, 0x79, 0xeb, 0x04, 0xe9, 0x14, 0x66, 0xa9, 0x75, 0x4b,
+  0xb5, 0xb5, 0x4a, 0x91, 0x0a, 0x65, 0xa9, 0x8d, 0xea, 0x4a, 0xb5, 0x86,
+  0x18, 0x58, 0xad, 0xec, 0xd5, 0x89, 0x8b, 0x96, 0xf5, 0xbb, 0x79, 0x0b,
+  0x61, 0x96, 0xee, 0x8c, 0x61, 0x21, 0x36, 0x8c, 0x81, 0x55, 0xb6, 0x0d,
+  0xf8, 0x96, 0xc9, 0x7a, 0xf0, 0x12, 0x52, 0x45, 0xf7, 0x32, 0xae, 0x02,
+  0x56, 0x7d, 0x68, 0x74, 0xce, 0x9c, 0xe1, 0x40, 0x03, 0x5d, 0x22, 0xe3,
+  0xba, 0x74, 0x2f, 0xcb, 0xc7, 0x55, 0x7c, 0x3e, 0x3b, 0xf9, 0x70, 0x27,
+  0x6d, 0x34, 0x72, 0xa5, 0x67, 0xcb, 0x6d, 0x6f, 0x36, 0xe8, 0x4c, 0x75,
+  0x4c, 0xd5, 0xd7, 0xb1, 0x36, 0x9a, 0xb2, 0x7f, 0xab, 0x52, 0x21, 0xd9,
+  0xa0, 0xdb, 0x57, 0xa5, 0xde, 0x45, 0x5b, 0x8d, 0xb3, 0xc6, 0x44, 0x17,
+  0x00, 0x61, 0x8d, 0xc3, 0x31, 0x89, 0x22, 0xe6, 0xe3, 0xb0, 0x31, 0x88,
+  0xc2, 0xcb, 0xd8, 0x9d, 0x2e, 0xcc, 0x1a, 0xae, 0x3a, 0xf6, 0x0b, 0xb3,
+  0xad, 0xc3, 0x11, 0xf5, 0xe9, 0xc1, 0x3b, 0x49, 0xed, 0xf9, 0x07, 0xb2,
+  0x7f, 0x38, 0x9d, 0x0f, 0xde, 0x82, 0x13, 0x02, 0x45, 0x3c, 0xb8, 0xb8,
+  0xff, 0x15, 0xa9, 0x7b, 0xde, 0x04, 0xc9, 0x85, 0xaa, 0x34, 0x77, 0xf0,
+  0x4c, 0xe3, 0x49, 0x4e, 0x9e, 0x50, 0x6a, 0x62, 0xfc, 0x5e, 0xf7, 0x32,
+  0xa9, 0xf1, 0x72, 0x62, 0xd5, 0x9c, 0x8a, 0xfd, 0xb9, 0xb7, 0xf1, 0xf6,
+  0xfc, 0x15, 0xb1, 0x88, 0xe6, 0xe1, 0x1c, 0x28, 0x3b, 0xc4, 0xfe, 0x72,
+  0xd8, 0x65, 0x1d, 0x6e, 0x3c, 0xae, 0xeb, 0x15, 0xcd, 0xbb, 0xb0, 0x4b,
+  0xfa, 0x91, 0x29, 0xd7, 0x54, 0xae, 0xe7, 0x0d, 0x5d, 0x47, 0xba, 0x8e,
+  0x65, 0xfe, 0xad, 0x37, 0xad, 0x4c, 0xb8, 0xea, 0xc3, 0xab, 0x7b, 0x3b,
+  0x1b, 0xe4, 0xda, 0xa0, 0xad, 0xc0, 0xcb, 0xb2, 0x3e, 0x81, 0xe9, 0xc7,
+  0xb2, 0xf3, 0xaf, 0x1b, 0xc3, 0xb1, 0x0d, 0x83, 0x59, 0x8f, 0xb5, 0xc5,
+  0xd8, 0x4c, 0x88, 0xd4, 0xb0, 0xae, 0x2f, 0x1f, 0xc2, 0x83, 0x24, 0x94,
+  0xf4, 0x7a, 0x95, 0x0a, 0x82, 0xbb, 0x59, 0xaf, 0x57, 0x8a, 0x6b, 0x92,
+  0xc8, 0x2a, 0xe2, 0x21, 0x7f, 0x0b, 0xf1, 0x26, 0xe8, 0x65, 0x11, 0xc9,
+  0x90, 0x3d, 0x4f, 0xc7, 0x20, 0x7a, 0x4b, 0xe0, 0x3d, 0xc4, 0xe4, 0x49,
+  0x2e, 0x49, 0x93, 0x3d, 0x89, 0xa6, 0xca, 0x96, 0x38, 0x58, 0xb9, 0xb2,
+  0xc5, 0x33, 0xe2, 0x0c, 0xf4, 0x97, 0xed, 0x0e, 0x65, 0x32, 0x66, 0xcb,
+  0x86, 0xbe, 0x5b, 0x85, 0xf1, 0x94, 0x52, 0x7e, 0xff, 0x67, 0x62, 0x63,
+  0x77, 0x3d, 0x29, 0x64, 0x3e, 0x6d, 0x7c, 0xe9, 0x54, 0xe5, 0x0b, 0x66,
+  0xe4, 0x96, 0xf0, 0x65, 0x4a, 0x6e, 0xdd, 0x1b, 0xcb, 0xc9, 0x2d, 0x9e,
+  0x04, 0x33, 0x72, 0xcb, 0xd1, 0x79, 0x29, 0xb9, 0x19, 0x81, 0x13, 0xee,
+  0xa9, 0xc0, 0x73, 0x72, 0x4b, 0xd7, 0x24, 0x49, 0x8d, 0xb0, 0xb9, 0x52,
+  0x2d, 0x9b, 0xeb, 0x59, 0x6f, 0xc6, 0x35, 0xb3, 0x9b, 0xf5, 0x42, 0x0b,
+  0x06, 0x1f, 0xcf, 0xba, 0x5a, 0x7e, 0x05, 0x8c, 0xeb, 0xe7, 0x6d, 0xb2,
+  0x1b, 0xfd, 0x16, 0x78, 0xd9, 0x27, 0x07, 0xef, 0xd0, 0xd5, 0xec, 0x18,
+  0x96, 0x0e, 0x62, 0xc3, 0x16, 0x03, 0xfc, 0x64, 0x2b, 0x21, 0x9a, 0x45,
+  0x3d, 0xd3, 0xf3, 0x95, 0xcd, 0x32, 0x57, 0x00, 0xdd, 0x9f, 0x28, 0x1a,
+  0x5b, 0x74, 0x8a, 0x44, 0xda, 0xf4, 0xa2, 0x09, 0x92, 0xb9, 0xd3, 0x4d,
+  0xc1, 0x54, 0x99, 0x03, 0xee, 0x10, 0x79, 0xd4, 0x6d, 0x18, 0xae, 0x33,
+  0x56, 0x51, 0xb4, 0x06, 0x7e, 0x1a, 0x48, 0x53, 0x6e, 0x00, 0xe2, 0x58,
+  0x1f, 0x4c, 0xd8, 0x17, 0x5d, 0xcb, 0x51, 0x09, 0x5b, 0x56, 0x77, 0x52,
+  0x6a, 0x2f, 0x98, 0x88, 0xe5, 0x2c, 0xa7, 0x0b, 0x84, 0xf6, 0xd9, 0x6c,
+  0x74, 0x5d, 0x75, 0xb9, 0xf6, 0x79, 0x0e, 0xf8, 0x5e, 0x01, 0x7d, 0x0b,
+  0xed, 0xa1, 0x95, 0xad, 0x6e, 0x9e, 0x29, 0xfa, 0x37, 0x68, 0xeb, 0xa0,
+  0x33, 0xf8, 0x21, 0x46, 0xb6, 0x87, 0xb4, 0xea, 0x0f, 0x3d, 0x1b, 0x35,
+  0xb9, 0x65, 0x90, 0x09, 0x12, 0xe8, 0xd1, 0x96, 0xd2, 0x52, 0x9b, 0x96,
+  0x5d, 0x5b, 0xde, 0xb7, 0x0d, 0x6a, 0x30, 0xa0, 0x76, 0x9e, 0xfd, 0x20,
+  0x5d, 0x4a, 0x16, 0x3a, 0x8b, 0xe9, 0xce, 0x72, 0x42, 0x4f, 0xf6, 0xd3,
+  0xec, 0xce, 0xf6, 0x78, 0x29, 0xd9, 0x18, 0xf6, 0x7b, 0xcb, 0xa8, 0x98,
+  0xc1, 0x52, 0xa2, 0x77, 0x46, 0x54, 0x20, 0xdd, 0x5c, 0x8d, 0xda, 0x27,
+  0xdb, 0xc9, 0xbf, 0x3f, 0xbc, 0xa0, 0xef, 0x46, 0xc6, 0x88, 0x57, 0xaa,
+  0x59, 0x9a, 0x99, 0x34, 0x01, 0xe5, 0x8f, 0x22, 0x52, 0x28, 0x7d, 0x5d,
+  0x88, 0x54, 0x07, 0x6f, 0x15, 0x9a, 0xf3, 0x07, 0x74, 0x8c, 0xf2, 0x8c,
+  0xdf, 0xb8, 0x9c, 0x30, 0xb7, 0x02, 0x5b, 0x80, 0xe8, 0xdc, 0xf6, 0xa2,
+  0xef, 0x97, 0x50, 0x92, 0xbc, 0x99, 0x95, 0x34, 0xb6, 0xe1, 0x81, 0x50,
+  0xaf, 0x3d, 0x49, 0x59, 0x72, 0xf0, 0xa6, 0xe3, 0x27, 0x00, 0x44, 0x9e,
+  0x89, 0xba, 0x96, 0xde, 0x4e, 0x5f, 0xf7, 0x13, 0xc3, 0xfa, 0x80, 0x4a,
+  0xaf, 0x13, 0xb5, 0xa4, 0x1f, 0x62, 0x45, 0xcd, 0xdd, 0x0c, 0xaa, 0x2a,
+  0x1c, 0x33, 0xa6, 0x1c, 0xd3, 0xf4, 0xcc, 0x77, 0x86, 0xc3, 0xf1, 0x76,
+  0xff, 0x3e, 0x65, 0x07, 0x43, 0xca, 0xc2, 0xf5, 0x45, 0x3e, 0x2a, 0x2f,
+  0x80, 0x3e, 0x0b, 0x85, 0x0d, 0xdc, 0x3a, 0x53, 0xc5, 0xfd, 0x0a, 0x06,
+  0x8d, 0x16, 0x1c, 0x94, 0x57, 0x1b, 0xd7, 0xbf, 0x7b, 0xa5, 0x39, 0xbb,
+  0xf6, 0xcd, 0x1b, 0xd2, 0x70, 0xa0, 0xf3, 0x8d, 0x3d, 0xb3, 0x01, 0x19,
+  0x85, 0x1c, 0xe9, 0x4f, 0x4e, 0x2a, 0xb5, 0x46, 0x5c, 0x27, 0x37, 0xdb,
+  0x6a, 0x41, 0xaf, 0x1e, 0xcf, 0xda, 0xf5, 0x74, 0x96, 0xc7, 0x45, 0xb5,
+  0xed, 0x35, 0x41, 0xb3, 0xc1, 0x26, 0x88, 0x2e, 0x79, 0xca, 0xd6, 0xc8,
+  0x8a, 0x7c, 0x74, 0xdc, 0x24, 0x55, 0x70, 0xf9, 0x1a, 0x81, 0xb1, 0x93,
+  0x47, 0x0e, 0x29, 0x69, 0x7f, 0xac, 0x4d, 0x7d, 0x0d, 0x14, 0x0c, 0x60,
+  0xdf, 0xe0, 0xee, 0x79, 0x74, 0xc8, 0x75, 0xe3, 0x8f, 0xb5, 0x97, 0x9a,
+  0xb1, 0x9e, 0x78, 0x76, 0x83, 0xe5, 0x0a, 0x5d, 0x39, 0x5a, 0x1c, 0xe5,
+  0xef, 0xd8, 0x68, 0x9f, 0x1c, 0xfc, 0x90, 0x36, 0xcb, 0xef, 0xc8, 0xd7,
+  0x80, 0x9e, 0x36, 0x8f, 0x63, 0x79, 0x49, 0x76, 0xcd, 0x64, 0x4a, 0xff,
+  0xe8, 0x12, 0xca, 0xc7, 0xd9, 0x18, 0x2a, 0x8a, 0xae, 0x2b, 0xbd, 0x52,
+  0x56, 0xca, 0x35, 0xb9, 0xf6, 0xf5, 0x45, 0x32, 0x7a, 0x01, 0x47, 0xfb,
+  0xe8, 0xd9, 0xaa, 0xc0, 0x99, 0x87, 0xf9, 0x4b, 0x26, 0x4c, 0x7e, 0x04,
+  0x3b, 0xf4, 0x71, 0x22, 0x84, 0xb4, 0xe3, 0x19, 0xb3, 0x10, 0x0a, 0x41,
+  0x9c, 0x26, 0x11, 0x65, 0xa6, 0xb1, 0x33, 0x19, 0x5c, 0x0e, 0xdc, 0x06,
+  0x76, 0x64, 0x02, 0x20, 0x1b, 0x41, 0x27, 0x8d, 0x8f, 0x84, 0xda, 0x40,
+  0xd8, 0x3d, 0x90, 0xa7, 0x3c, 0x46, 0x85, 0x02, 0xb2, 0x96, 0xf7, 0xe8,
+  0x48, 0x7e, 0x5b, 0x3b, 0x0f, 0x3e, 0x7e, 0x3a, 0x0c, 0xe6, 0xbc, 0xbd,
+  0xe3, 0xc8, 0x1d, 0xa2, 0x5b, 0xee, 0x07, 0x31, 0x57, 0x92, 0x09, 0x76,
+  0x4d, 0x83, 0x96, 0xaa, 0x34, 0xcf, 0x0f, 0x02, 0x6f, 0x16, 0x56, 0x0e,
+  0x5d, 0xf8, 0x9f, 0x3c, 0x7e, 0x3f, 0x41, 0x6e, 0x7a, 0x18, 0x0e, 0xe2,
+  0x0c, 0x66, 0x21, 0x34, 0x98, 0x85, 0x63, 0x18, 0x8c, 0x70, 0x79, 0xf8,
+  0x1b, 0x74, 0xbc, 0x81, 0x99, 0x79, 0x64, 0x24, 0x05, 0x1c, 0xd2, 0x49,
+  0x62, 0x09, 0x0f, 0xc3, 0x2f, 0x2d, 0x9f, 0x08, 0xbc, 0x3c, 0x85, 0x58,
+  0x86, 0x57, 0xdf, 0x01, 0x65, 0x54, 0xb2, 0x78, 0x28, 0x23, 0x51, 0xd8,
+  0x36, 0xc4, 0xe5, 0xf3, 0x90, 0x61, 0x48, 0x96, 0x49, 0x69, 0x8f, 0x87,
+  0x01, 0xbf, 0x35, 0x6e, 0xf9, 0xf8, 0xc4, 0x77, 0x55, 0x3d, 0xdc, 0x26,
+  0x94, 0x66, 0x9a, 0x0a, 0x7b, 0x2f, 0x9e, 0x55, 0x16, 0xf7, 0x9f, 0x9f,
+  0x55, 0xde, 0x35, 0x42, 0x44, 0xdc, 0x83, 0x7d, 0x35, 0xaf, 0x37, 0x99,
+  0x6c, 0x81, 0xc8, 0xe0, 0xad, 0xf8, 0xe5, 0xea, 0x30, 0xd5, 0x30, 0x67,
+  0x84, 0x77, 0x8b, 0xe1, 0x73, 0x9b, 0x97, 0x91, 0x9c, 0x39, 0xbb, 0x4f,
+  0xdd, 0x5f, 0x37, 0xf5, 0x63, 0x48, 0x66, 0xe4, 0x5f, 0xfb, 0xa2, 0x99,
+  0x7d, 0xe2, 0x71, 0xe1, 0x4c, 0xbc, 0x0f, 0x04, 0x87, 0x33, 0xe9, 0x5f,
+  0x1b, 0x5e, 0xc8, 0x53, 0x5f, 0x4e, 0x90, 0xf0, 0xda, 0xdf, 0x1d, 0xd1,
+  0xbf, 0x17, 0xd3, 0xad, 0xee, 0x5e, 0x7f, 0xdc, 0x28, 0x8c, 0x43, 0xb7,
+  0xfb, 0x83, 0x76, 0xc3, 0x51, 0x76, 0x07, 0x35, 0x7f, 0x81, 0xae, 0x0a,
+  0xb3, 0xea, 0xc5, 0xe7, 0x52, 0x86, 0xfc, 0xc6, 0xb5, 0x04, 0x02, 0x3f,
+  0x27, 0x53, 0x9b, 0x7b, 0x00, 0x06, 0x2f, 0x65, 0x6f, 0x0b, 0x47, 0x02,
+  0x65, 0xcd, 0x22, 0xbd, 0x0b, 0x05, 0xa0, 0xe9, 0x08, 0x34, 0x65, 0x61,
+  0x21, 0x1a, 0x5a, 0xe3, 0x6d, 0xe7, 0xe2, 0x61, 0x3d, 0x14, 0x8f, 0x76,
+  0x04, 0x42, 0xd3, 0x22, 0x8a, 0x13, 0x51, 0xc7, 0x41, 0x16, 0x68, 0x2a,
+  0x8a, 0xe8, 0x5c, 0x04, 0x5a, 0xa9, 0x89, 0xab, 0xce, 0x75, 0xe9, 0xa4,
+  0xcc, 0x46, 0x45, 0x65, 0x3f, 0x42, 0xd3, 0x46, 0xf1, 0x32, 0x12, 0x05,
+  0x34, 0xbd, 0x22, 0x98, 0xa6, 0xed, 0x91, 0x2b, 0x61, 0xb2, 0xe5, 0xa7,
+  0x08, 0x7e, 0xd8, 0x95, 0x5d, 0xde, 0x83, 0x22, 0x56, 0xe1, 0x94, 0x96,
+  0x82, 0xa9, 0x3a, 0x25, 0x51, 0xb3, 0x9f, 0x2d, 0xb7, 0x5b, 0xd1, 0x3d,
+  0x05, 0x9c, 0xd6, 0xd2, 0x4a, 0x07, 0x8c, 0x80, 0xdd, 0x1e, 0x4a, 0x77,
+  0x6e, 0xde, 0xe3, 0xeb, 0x58, 0xb3, 0x31, 0x9c, 0xf2, 0x58, 0xa9, 0x13,
+  0x1b, 0x01, 0x45, 0x67, 0x3c, 0xaf, 0x31, 0x03, 0x22, 0x8c, 0x2e, 0x69,
+  0x6f, 0x29, 0xa9, 0x01, 0x30, 0x90, 0x80, 0x88, 0x0d, 0xbc, 0x27, 0x5d,
+  0x87, 0xe0, 0x3f, 0x76, 0x3a, 0x65, 0xa9, 0xbb, 0x79, 0x82, 0xde, 0x25,
+  0x49, 0x54, 0x51, 0x3b, 0x7d, 0x28, 0xf3, 0x13, 0x7f, 0x9b, 0xce, 0xf8,
+  0x8e, 0x4c, 0x85, 0xfb, 0xed, 0x6c, 0x29, 0x99, 0xef, 0xbc, 0x28, 0x7f,
+  0x40, 0x97, 0x8b, 0x9d, 0xf9, 0xc2, 0x34, 0xb6, 0x38, 0x8a, 0x66, 0x48,
+  0x87, 0x1b, 0x4b, 0x56, 0x4b, 0xda, 0x66, 0x95, 0x73, 0x0b, 0xc8, 0x56,
+  0xc4, 0x8e, 0xb1, 0x2d, 0xcf, 0xd5, 0x09, 0xcd, 0x8b, 0xd3, 0x74, 0x42,
+  0x83, 0x48, 0x86, 0x4e, 0xae, 0xe4, 0x2e, 0x4e, 0x3b, 0x8b, 0xb3, 0x3b,
+  0x43, 0xc6, 0xd9, 0x83, 0xb7, 0x6c, 0x65, 0xf7, 0x47, 0xa8, 0x64, 0x94,
+  0x74, 0x8f, 0xa7, 0xac, 0x24, 0x74, 0x66, 0xc9, 0x34, 0x6b, 0x48, 0xe1,
+  0x13, 0xc3, 0xcf, 0x2b, 0xeb, 0x8c, 0x41, 0x2c, 0x53, 0x00, 0x11, 0xcb,
+  0x26, 0x8b, 0xd0, 0x43, 0x09, 0x64, 0xc5, 0xb2, 0x8e, 0xf3, 0x02, 0x0d,
+  0xb2, 0x49, 0x88, 0x88, 0x2f, 0x2a, 0x25, 0x8c, 0x75, 0xda, 0xb5, 0x42,
+  0x18, 0x55, 0x4f, 0x0f, 0x1b, 0x58, 0x54, 0x5f, 0x92, 0x35, 0xe5, 0xc1,
+  0x38, 0x4c, 0xfe, 0x9a, 0x5d, 0xfd, 0xf9, 0xe1, 0x72, 0x84, 0xc2, 0xf7,
+  0xff, 0x69, 0xd3, 0x83, 0xa2, 0x9c, 0x08, 0xe4, 0x3f, 0x52, 0xfe, 0xa0,
+  0x28, 0xfd, 0xcb, 0x52, 0x07, 0xb1, 0x7d, 0x15, 0xb0, 0xd1, 0xec, 0xd2,
+  0xee, 0x2a, 0xda, 0x8a, 0xd0, 0x74, 0xd7, 0xdb, 0x50, 0x47, 0x49, 0x0b,
+  0xe4, 0x40, 0x53, 0x47, 0x4b, 0x1c, 0x2a, 0xd2, 0xb8, 0x3b, 0x4a, 0xbb,
+  0x3e, 0x60, 0xf5, 0xad, 0xdf, 0xc1, 0xb7, 0x77, 0x55, 0x56, 0x87, 0xcb,
+  0xfd, 0x61, 0x77, 0xdc, 0xa8, 0x80, 0xf0, 0xb7, 0x77, 0x0d, 0x98, 0x26,
+  0x9d, 0x86, 0x1a, 0x58, 0x36, 0x3b, 0xb0, 0x2c, 0x0a, 0xac, 0x37, 0x3b,
+  0xb0, 0x9e, 0x0f, 0xac, 0x02, 0x73, 0xb1, 0xe4, 0xf7, 0xeb, 0x2b, 0x17,
+  0x2b, 0xe7, 0x88, 0xf0, 0x58, 0x45, 0x40, 0x1c, 0x8f, 0xac, 0x67, 0x9b,
+  0xa1, 0xf9, 0x26, 0x49, 0xf1, 0x66, 0x56, 0x23, 0x24, 0x8e, 0xa9, 0x42,
+  0x2a, 0x88, 0x59, 0x8d, 0xcb, 0x33, 0x26, 0x7c, 0x88, 0xa9, 0x00, 0x9f,
+  0x5a, 0xd6, 0x07, 0x42, 0x3c, 0x60, 0x82, 0x7e, 0x0a, 0x59, 0x13, 0xd8,
+  0x94, 0x7f, 0x69, 0x13, 0x26, 0x38, 0x8c, 0xe3, 0x4b, 0x90, 0x2b, 0x01,
+  0x65, 0x9c, 0x67, 0x9f, 0x26, 0x61, 0xc6, 0x5e, 0xcb, 0x32, 0x24, 0x94,
+  0x84, 0xfd, 0x7b, 0x07, 0xf7, 0x61, 0x23, 0xfe, 0x03, 0x27, 0xd8, 0x17,
+  0x55, 0xf8, 0x55, 0x29, 0x10, 0xff, 0x49, 0x28, 0x2e, 0x60, 0x2f, 0x3f,
+  0x91, 0x0e, 0x23, 0xb1, 0x10, 0xf8, 0x19, 0xc3, 0xdf, 0xdd, 0xa5, 0x5a,
+  0x4b, 0x76, 0xba, 0xf7, 0x04, 0x0b, 0x3a, 0x53, 0x03, 0x09, 0x0d, 0xb0,
+  0x90, 0x44, 0x2a, 0xc5, 0xf1, 0xe7, 0xe8, 0xa5, 0x67, 0x05, 0x33, 0xba,
+  0xd7, 0x2d, 0x0b, 0x4f, 0x75, 0x58, 0x26, 0xf1, 0xc3, 0x12, 0xad, 0xf2,
+  0x39, 0x05, 0x6f, 0x31, 0xa4, 0x4e, 0xbd, 0x08, 0x48, 0x79, 0x88, 0xab,
+  0x6f, 0x60, 0xaf, 0x29, 0xc0, 0x1a, 0xf3, 0xd9, 0xaa, 0x24, 0xaa, 0x60,
+  0x7c, 0xe2, 0x9e, 0x9f, 0x93, 0x9f, 0xce, 0x5f, 0x52, 0x50, 0xfe, 0x67,
+  0x56, 0x59, 0xaa, 0xc6, 0xb7, 0x77, 0x9b, 0xe1, 0x1a, 0x58, 0x41, 0xe3,
+  0xbe, 0x3e, 0xb9, 0x65, 0x85, 0xef, 0xee, 0xe0, 0xbe, 0x33, 0x0b, 0xdf,
+  0xde, 0x9d, 0x14, 0x15, 0xd0, 0x9e, 0x09, 0xf9, 0x7f, 0x14, 0x11, 0xe9,
+  0x64, 0x3b, 0xb4, 0x91, 0xce, 0x0e, 0x81, 0x74, 0x56, 0x80, 0x74, 0x76,
+  0x7c, 0x48, 0xff, 0x1c, 0x96, 0xca, 0x5f, 0x1c, 0xfc, 0x85, 0x2e, 0x82,
+  0x80, 0x54, 0xb7, 0x91, 0xef, 0x1d, 0x02, 0xf9, 0x5e, 0x01, 0xf2, 0xbd,
+  0x20, 0xf2, 0x4f, 0xa5, 0x30, 0x16, 0x97, 0x42, 0x9e, 0x51, 0x59, 0xac,
+  0xe2, 0x2e, 0x9f, 0x76, 0x51, 0xac, 0x58, 0x02, 0x11, 0xa1, 0x81, 0x42,
+  0xe9, 0xea, 0xa8, 0x7a, 0x3a, 0xa1, 0x4d, 0x89, 0x6a, 0x0c, 0xa2, 0x6a,
+  0x33, 0x7c, 0x19, 0xd2, 0x0d, 0x84, 0xb4, 0x57, 0xc2, 0x5e, 0x2b, 0x4c,
+  0x1b, 0x0d, 0xdb, 0x23, 0xb7, 0x7b, 0x17, 0x18, 0x0e, 0xba, 0xbf, 0xaf,
+  0xe0, 0xe2, 0x0b, 0x38, 0x7d, 0x93, 0x91, 0x80, 0x9c, 0xc0, 0xc8, 0xa5,
+  0x93, 0xbc, 0x39, 0x4f, 0xa0, 0x27, 0xa7, 0x4a, 0x7f, 0x02, 0x02, 0xa0,
+  0xaa, 0xbc, 0x81, 0xa3, 0x74, 0x00, 0x06, 0x05, 0xc1, 0x58, 0x5d, 0x12,
+  0x94, 0xe9, 0x48, 0xe4, 0x7b, 0x0b, 0x58, 0xd6, 0x67, 0x68, 0xfd, 0x4b,
+  0x60, 0x27, 0x61, 0x51, 0x48, 0x0a, 0x9e, 0x02, 0x16, 0x0c, 0x52, 0x20,
+  0x3c, 0x9c, 0x3e, 0xd2, 0x76, 0xc1, 0x47, 0xba, 0x6e, 0xc9, 0x1b, 0xf0,
+  0xeb, 0x43, 0xd2, 0xd5, 0xc8, 0xdc, 0x60, 0xef, 0x73, 0x23, 0xaa, 0x5b,
+  0xc8, 0xc4, 0x96, 0x11, 0xa5, 0x94, 0xa8, 0x88, 0xb2, 0x95, 0x8d, 0xf2,
+  0xb1, 0x20, 0x5a, 0x89, 0xd7, 0xa9, 0x1c, 0xdd, 0x59, 0x32, 0x84, 0xce,
+  0x27, 0x4b, 0xd2, 0x2d, 0xce, 0xa3, 0xae, 0x20, 0x56, 0x45, 0xf2, 0x46,
+  0xa8, 0xab, 0xee, 0xae, 0xa4, 0x6a, 0x17, 0xef, 0x6f, 0xe8, 0x8c, 0x7a,
+  0x6e, 0x4f, 0x36, 0x66, 0xee, 0xdb, 0x5b, 0xf3, 0xb7, 0x3b, 0x70, 0x13,
+  0x5d, 0x92, 0x37, 0x1b, 0x05, 0x7b, 0xa3, 0x9b, 0xa7, 0x62, 0x95, 0x48,
+  0x2f, 0x7b, 0x9c, 0x18, 0xa1, 0x59, 0xfc, 0xc0, 0xa1, 0xe7, 0xf4, 0x83,
+  0x1a, 0xc7, 0x6a, 0x8f, 0x34, 0x3d, 0x17, 0xcb, 0xb4, 0x40, 0x76, 0x07,
+  0x9e, 0x06, 0x48, 0xf2, 0x25, 0x47, 0x09, 0x64, 0xbb, 0x7e, 0x0f, 0xd2,
+  0x7d, 0xed, 0x67, 0x68, 0x56, 0x93, 0xa5, 0x80, 0xf5, 0x90, 0x69, 0xe9,
+  0x76, 0xc1, 0xda, 0x71, 0xea, 0x25, 0x9c, 0xb7, 0x70, 0x13, 0x92, 0xf3,
+  0xde, 0x5b, 0xf2, 0x96, 0x01, 0x6b, 0x39, 0xca, 0xee, 0xdc, 0x49, 0x47,
+  0xdf, 0x41, 0x3e, 0x7c, 0xa5, 0x7b, 0x6f, 0x29, 0x59, 0x7c, 0xb1, 0x33,
+  0x1f, 0x79, 0x8d, 0x39, 0x57, 0x16, 0x4f, 0xf1, 0xd7, 0x59, 0xfe, 0xad,
+  0xbd, 0x9d, 0xac, 0x97, 0x8d, 0xef, 0x7b, 0x28, 0x08, 0x0a, 0x5c, 0x19,
+  0x8e, 0xd2, 0x6b, 0xa3, 0x4b, 0x7f, 0xb6, 0xd7, 0xed, 0xdb, 0x65, 0xcc,
+  0x8a, 0x4b, 0xdc, 0xb1, 0xda, 0x76, 0x76, 0x89, 0x3b, 0xd2, 0xfd, 0x8b,
+  0x99, 0x37, 0xe5, 0xe8, 0x54, 0x91, 0xb9, 0x40, 0xd1, 0x34, 0x53, 0x2e,
+  0x2d, 0xb4, 0xda, 0x5a, 0x6e, 0x75, 0x37, 0xbf, 0x68, 0x1a, 0x79, 0x84,
+  0xe2, 0xe6, 0xd2, 0x0f, 0xec, 0xfa, 0x69, 0x72, 0x06, 0xaf, 0xc9, 0x10,
+  0x52, 0x63, 0xbb, 0x65, 0x08, 0xe3, 0x75, 0xfb, 0x4a, 0x7e, 0x07, 0x73,
+  0x7e, 0x71, 0xd2, 0x09, 0xb8, 0xf6, 0x14, 0x8a, 0x1d, 0xcc, 0xf2, 0xc0,
+  0x9e, 0x08, 0x2f, 0xac, 0x66, 0x64, 0xc1, 0xb1, 0xe2, 0x41, 0xe1, 0x06,
+  0x5a, 0xd1, 0x28, 0x53, 0x88, 0x16, 0x5a, 0x99, 0xe4, 0x37, 0x4e, 0x7d,
+  0x21, 0xc6, 0x82, 0x75, 0xf8, 0x52, 0xac, 0xf2, 0x14, 0x6b, 0x1b, 0xd1,
+  0x43, 0x2a, 0xbc, 0xaa, 0x55, 0x55, 0xe3, 0xec, 0x7f, 0xb6, 0xca, 0x6a,
+  0xee, 0xa6, 0x8f, 0xab, 0xb7, 0x15, 0x46, 0xb3, 0x68, 0xb8, 0xab, 0x52,
+  0x2a, 0x50, 0x45, 0xcd, 0x1b, 0x52, 0x2b, 0xd1, 0xd6, 0x49, 0xb5, 0x0a,
+  0xe4, 0x83, 0xc8, 0x85, 0xcd, 0xe2, 0x2a, 0x02, 0x93, 0x98, 0xae, 0x5c,
+  0xe2, 0xc9, 0xd4, 0xe5, 0x21, 0x6e, 0x14, 0xd7, 0x99, 0x73, 0xe8, 0xda,
+  0x54, 0xa6, 0x3f, 0xad, 0xa4, 0x3c, 0xf7, 0x9b, 0x56, 0xe4, 0x9e, 0x5c,
+  0x85, 0x5e, 0x7d, 0x79, 0xff, 0x41, 0xac, 0xee, 0x38, 0xbc, 0x43, 0x65,
+  0x8c, 0xf7, 0xe1, 0x1c, 0xb2, 0x3c, 0x17, 0x03, 0xf4, 0x9f, 0xbc, 0x44,
+  0x17, 0x9f, 0x9b, 0x35, 0x10, 0xf2, 0x9d, 0x1a, 0x5d, 0x62, 0xbe, 0x57,
+  0xdc, 0xc9, 0x92, 0x47, 0x55, 0xa5, 0x32, 0x55, 0x82, 0xd8, 0x6d, 0xf9,
+  0x49, 0x5b, 0xeb, 0xf9, 0x42, 0xa5, 0xaa, 0x1c, 0xb0, 0xda, 0xaf, 0xc5,
+  0x79, 0x1e, 0x28, 0xd2, 0xc5, 0x10, 0x15, 0x9e, 0x62, 0x85, 0x8e, 0x2d,
+  0x32, 0xeb, 0x72, 0x9a, 0xe7, 0xdd, 0x3b, 0xe9, 0x2c, 0xa3, 0x90, 0x9f,
+  0x14, 0x8e, 0xc2, 0x05, 0xab, 0x46, 0xe1, 0x3e, 0xaf, 0x30, 0x8a, 0x53,
+  0x15, 0x46, 0x31, 0xe2, 0xc7, 0xed, 0x2c, 0x63, 0x11, 0x1f, 0xb6, 0x65,
+  0xa7, 0x85, 0x43, 0x0a, 0xf7, 0x61, 0x87, 0x24, 0xb9, 0x6f, 0x2b, 0x0c,
+  0x6f, 0x1e, 0xf7, 0x90, 0xf7, 0x74, 0xa6, 0x0a, 0x6b, 0x62, 0xfd, 0x8a,
+  0x55, 0x7b, 0xd9, 0x3d, 0x6f, 0xb4, 0xcb, 0xab, 0x44, 0x34, 0xe8, 0xf3,
+  0xb6, 0xae, 0x78, 0x99, 0xce, 0x3a, 0x6a, 0x4b, 0x99, 0xeb, 0xcc, 0xff,
+  0x4d, 0x03, 0x74, 0x82, 0x1d, 0xa5, 0x87, 0xe9, 0xaa, 0x8c, 0xa6, 0x2b,
+  0x8a, 0x80, 0x93, 0x11, 0x3a, 0xda, 0x1d, 0x97, 0x86, 0x1c, 0xec, 0x80,
+  0x67, 0x18, 0xbe, 0xb8, 0x3d, 0xa6, 0x8a, 0x6c, 0xf0, 0xaf, 0xe8, 0xa4,
+  0x61, 0xf7, 0x69, 0x35, 0x87, 0x41, 0x76, 0x69, 0x2f, 0xcf, 0xb0, 0x18,
+  0xf0, 0x9b, 0x36, 0xde, 0xf2, 0xa3, 0xeb, 0x40, 0x72, 0x45, 0x17, 0x36,
+  0xbf, 0x31, 0x7a, 0x2f, 0x03, 0x35, 0xe5, 0x70, 0x24, 0x30, 0xbd, 0x18,
+  0x17, 0x63, 0xcf, 0xae, 0x3b, 0xbf, 0xf6, 0x60, 0x69, 0x90, 0x4c, 0x72,
+  0x38, 0x21, 0x23, 0x17, 0x91, 0x09, 0xcb, 0xe0, 0x3e, 0xc4, 0x5e, 0x52,
+  0x43, 0x85, 0xb1, 0xf1, 0xfc, 0xca, 0x8c, 0x94, 0x0b, 0x0b, 0x89, 0x8a,
+  0x3c, 0x64, 0x5f, 0xc1, 0x95, 0xcb, 0x23, 0xfa, 0xe2, 0x62, 0xb0, 0xe5,
+  0xc2, 0x6d, 0x3b, 0x69, 0xb3, 0x82, 0x0a, 0xd8, 0xc8, 0xcf, 0x2a, 0x44,
+  0x95, 0x5e, 0x36, 0xe7, 0xb1, 0x3d, 0x99, 0x6a, 0xc1, 0x3e, 0xf5, 0x10,
+  0xd3, 0xf6, 0xc2, 0x61, 0x63, 0x4c, 0xab, 0x05, 0x99, 0x46, 0x23, 0x47,
+  0xad, 0xd0, 0xd1, 0x2c, 0x5f, 0x95, 0xc3, 0x17, 0x4c, 0x82, 0x88, 0x6d,
+  0x6d, 0x0f, 0x8f, 0x3c, 0xa5, 0xe1, 0xa2, 0x0e, 0x14, 0x11, 0x84, 0x68,
+  0xfa, 0x39, 0x96, 0x18, 0xd1, 0xa4, 0xb1, 0x72, 0x11, 0x7d, 0x77, 0xdd,
+  0xbe, 0x9a, 0xb3, 0x06, 0x8f, 0x6a, 0xfd, 0x8f, 0xb8, 0x6d, 0x29, 0x26,
+  0x50, 0x1c, 0x37, 0xaa, 0x2e, 0x46, 0x01, 0x03, 0xb7, 0x12, 0x86, 0x19,
+  0x9c, 0xdb, 0x91, 0x1a, 0x5a, 0x4e, 0xd7, 0x4b, 0x18, 0x35, 0xf1, 0x81,
+  0x2c, 0x10, 0x2b, 0xb4, 0xa1, 0x98, 0x75, 0x94, 0xee, 0x18, 0x1f, 0x1f,
+  0xbc, 0xe1, 0x69, 0x6c, 0xf0, 0xed, 0x27, 0x68, 0xf6, 0x13, 0x4a, 0x1d,
+  0x99, 0xa7, 0xf4, 0x09, 0xac, 0x1c, 0x0c, 0xac, 0x7f, 0x53, 0x85, 0xd5,
+  0x1f, 0xfc, 0xf4, 0xe0, 0xcd, 0x8e, 0xca, 0xf1, 0x6f, 0xab, 0x95, 0xde,
+  0x3d, 0xf8, 0x31, 0xc0, 0x78, 0x6f, 0xfa, 0xf1, 0xf4, 0xe1, 0x92, 0x58,
+  0x7c, 0xba, 0xf8, 0x2c, 0x2a, 0x9a, 0x7e, 0xc2, 0xad, 0x88, 0x8f, 0x1d,
+  0xa7, 0xf3, 0x78, 0xe1, 0x5b, 0x27, 0x7e, 0x32, 0x7e, 0x5f, 0xe0, 0x24,
+  0xd2, 0x46, 0x54, 0xf1, 0xb2, 0x23, 0xa5, 0x0e, 0xa2, 0xb0, 0x28, 0x5f,
+  0x93, 0xe5, 0xa2, 0x2c, 0xbb, 0xdd, 0x40, 0xdf, 0xb7, 0x9c, 0xef, 0xc2,
+  0xe5, 0x14, 0x75, 0x8e, 0xf8, 0x92, 0x7b, 0xfd, 0xfc, 0x53, 0xb8, 0xc4,
+  0x23, 0x36, 0x36, 0x92, 0xfa, 0x5e, 0x21, 0xb5, 0x59, 0xcc, 0x0b, 0x96,
+  0xaf, 0x8b, 0xfc, 0x95, 0x2c, 0xb7, 0xd7, 0x65, 0xdc, 0x97, 0x87, 0x5d,
+  0x3f, 0x62, 0x17, 0x5d, 0x7f, 0x9d, 0xb7, 0xa4, 0x8c, 0x77, 0xbc, 0x8b,
+  0xbe, 0x6a, 0x3b, 0x3d, 0x93, 0xe1, 0x4d, 0xe2, 0xa3, 0x5e, 0xba, 0x4f,
+  0xe4, 0xb6, 0xf0, 0x76, 0x82, 0x50, 0xa2, 0x7e, 0x4a, 0xec, 0xf5, 0x0d,
+  0x8c, 0x30, 0x50, 0xb2, 0xed, 0x61, 0xb7, 0x87, 0x5b, 0xaa, 0xb9, 0xda,
+  0xe6, 0x98, 0x81, 0x26, 0x4a, 0x5d, 0xc0, 0xe6, 0x47, 0x29, 0x0d, 0x9e,
+  0xd2, 0x3a, 0x29, 0x07, 0xfa, 0x94, 0x99, 0x62, 0x04, 0x85, 0x59, 0x99,
+  0x63, 0xa7, 0x76, 0x9c, 0x9c, 0x69, 0x86, 0xca, 0x82, 0xce, 0x8d, 0xab,
+  0x0f, 0xb8, 0xb7, 0xd5, 0x31, 0x55, 0xb1, 0xba, 0xe0, 0x91, 0xf8, 0x60,
+  0xc4, 0x8b, 0x64, 0x16, 0xbf, 0x0f, 0x87, 0x4b, 0x91, 0x20, 0x21, 0x7e,
+  0x54, 0xa8, 0x3b, 0x68, 0x8d, 0xff, 0xb8, 0xb3, 0x45, 0x27, 0xdf, 0xdf,
+  0xcb, 0xc7, 0xd9, 0xd6, 0x7d, 0x92, 0x93, 0xe1, 0xad, 0x9d, 0xc1, 0x6f,
+  0x3f, 0xeb, 0x8d, 0xb7, 0xb1, 0xe5, 0xfc, 0x1f, 0xb1, 0x38, 0xee, 0xc2,
+  0x14, 0x6c, 0x91, 0xd0, 0x19, 0x81, 0xbd, 0x17, 0x3c, 0xe3, 0x85, 0xce,
+  0x14, 0xa5, 0x33, 0x0b, 0xa6, 0x32, 0x93, 0x80, 0x8f, 0x96, 0xba, 0x2c,
+  0x92, 0xb6, 0xac, 0x12, 0xec, 0xb2, 0x34, 0x65, 0xde, 0x10, 0x45, 0xc5,
+  0x8a, 0xf0, 0x14, 0x56, 0x0c, 0xa5, 0x8f, 0x16, 0xb5, 0x90, 0x49, 0x5d,
+  0xe5, 0x39, 0xca, 0xe8, 0xa3, 0x1e, 0x1d, 0x3d, 0x54, 0xd5, 0xdc, 0x2f,
+  0xf9, 0x16, 0xd4, 0x6b, 0x1b, 0x93, 0x70, 0xeb, 0xde, 0xdc, 0x22, 0x17,
+  0x6c, 0x00, 0x30, 0x29, 0x82, 0xf1, 0xbc, 0x25, 0x39, 0x7d, 0x82, 0x2e,
+  0x0f, 0xd2, 0xcc, 0x16, 0xcb, 0x58, 0x39, 0x17, 0x2c, 0x6e, 0x51, 0xad,
+  0xf6, 0x08, 0x3f, 0xaa, 0x6d, 0xdc, 0x9f, 0x5a, 0x2d, 0x4a, 0xaf, 0xd0,
+  0x24, 0xd3, 0x4e, 0xf9, 0xce, 0x75, 0xc5, 0x87, 0x40, 0xdc, 0xc5, 0xb3,
+  0x8c, 0xf5, 0x32, 0x47, 0xcf, 0x6e, 0x48, 0xff, 0x1b, 0x65, 0xbc, 0xa2,
+  0x75, 0x9b, 0xb5, 0xe6, 0x49, 0x99, 0xb4, 0x3b, 0xa6, 0x04, 0xea, 0x59,
+  0x92, 0xf0, 0xfa, 0x53, 0x06, 0x5b, 0x1a, 0xae, 0xe0, 0x86, 0xdd, 0xcb,
+  0x82, 0x1d, 0x08, 0x0d, 0xe5, 0x8e, 0x81, 0x2a, 0xf4, 0xc0, 0xb2, 0x4f,
+  0xc7, 0x2c, 0xe6, 0x38, 0x5e, 0x56, 0xeb, 0x5b, 0x7d, 0xec, 0x75, 0x6d,
+  0xdc, 0x3a, 0x43, 0xbd, 0x51, 0x05, 0xb0, 0xc3, 0xf6, 0x96, 0x0d, 0xca,
+  0x7b, 0x33, 0x46, 0xbb, 0x2a, 0x84, 0x24, 0x18, 0xa8, 0xac, 0x88, 0x50,
+  0x70, 0x5b, 0xc2, 0xb2, 0xc9, 0x67, 0x69, 0x86, 0x78, 0x99, 0xb4, 0xd2,
+  0xd1, 0xb0, 0x2f, 0xfd, 0xa1, 0xb0, 0xc5, 0x79, 0x9c, 0x7a, 0x70, 0xad,
+  0xd5, 0xbd, 0x81, 0xc1, 0xb6, 0xd5, 0x4a, 0xf5, 0x99, 0x8f, 0x8a, 0x6a,
+  0xf5, 0x39, 0xa0, 0x9d, 0x1b, 0xd0, 0xa1, 0x02, 0x2d, 0x75, 0x92, 0x1c,
+  0x00, 0xea, 0xd5, 0xb2, 0x74, 0xfa, 0xb3, 0x2a, 0xd1, 0x45, 0x3b, 0xbd,
+  0xa5, 0x41, 0xf1, 0x52, 0x96, 0x4c, 0x06, 0x73, 0x6c, 0x95, 0xaa, 0x14,
+  0x40, 0x85, 0x2d, 0xee, 0x7c, 0x19, 0x50, 0x99, 0x46, 0x60, 0x3b, 0x94,
+  0x72, 0x5a, 0x91, 0x86, 0x2c, 0xf8, 0x9d, 0x3a, 0x11, 0xc2, 0x2a, 0x6c,
+  0xf2, 0xe4, 0xa8, 0x80, 0xb6, 0xb4, 0xd8, 0xc6, 0x95, 0xd6, 0x04, 0xc8,
+  0xc1, 0x51, 0x7e, 0x04, 0xe0, 0x79, 0x23, 0xc3, 0xce, 0x18, 0x3a, 0xe2,
+  0x4c, 0x2b, 0xaf, 0x1e, 0xeb, 0x49, 0x68, 0xd6, 0x2e, 0x33, 0x17, 0x68,
+  0x56, 0x35, 0xd6, 0x80, 0x0e, 0xd5, 0x8c, 0x0d, 0x5c, 0xa5, 0xa5, 0xb0,
+  0x29, 0xaf, 0xd3, 0xa6, 0x9e, 0xa1, 0x5f, 0x11, 0x36, 0x54, 0xa1, 0x51,
+  0x7b, 0x97, 0xb7, 0x54, 0x4d, 0x5a, 0x79, 0x15, 0x2f, 0x05, 0x20, 0x6a,
+  0x2f, 0xd6, 0x9b, 0x6e, 0x85, 0x43, 0x01, 0xc8, 0xbb, 0xc3, 0xcf, 0x71,
+  0xa3, 0x79, 0x69, 0xc1, 0x5a, 0x2d, 0xa8, 0x60, 0x07, 0x72, 0x49, 0xb4,
+  0xfc, 0x00, 0x37, 0xe7, 0xe6, 0xcf, 0x8a, 0xda, 0x96, 0xde, 0xc5, 0x2a,
+  0x84, 0xb9, 0x7a, 0x5a, 0xa0, 0x48, 0x80, 0x6b, 0x52, 0x6a, 0xff, 0x0b,
+  0x55, 0x59, 0x2c, 0x3c, 0xf2, 0xa3, 0xe6, 0xcc, 0xd8, 0x15, 0x52, 0x37,
+  0x99, 0xb9, 0xe2, 0x22, 0xff, 0xbc, 0x82, 0xab, 0x3d, 0xbb, 0x7a, 0x16,
+  0xdb, 0x4a, 0x8f, 0xe2, 0x70, 0xff, 0x73, 0x57, 0xfd, 0xf6, 0x94, 0xfc,
+  0xec, 0x15, 0xca, 0x74, 0xef, 0x12, 0x3f, 0x62, 0x15, 0x15, 0x0d, 0x67,
+  0x56, 0x4c, 0x3b, 0xca, 0x8f, 0x23, 0x79, 0xca, 0x16, 0x6c, 0xad, 0xbb,
+  0x58, 0xb3, 0x6e, 0xa6, 0x32, 0xd6, 0x01, 0x59, 0xf7, 0xec, 0x6f, 0xae,
+  0x08, 0xc6, 0x54, 0xfc, 0xd1, 0x29, 0xbb, 0x66, 0x32, 0x2c, 0x72, 0x97,
+  0xf7, 0x06, 0x3f, 0x23, 0x23, 0x55, 0xe8, 0xc5, 0xa2, 0x6d, 0x04, 0xe2,
+  0x27, 0xfc, 0x21, 0x4c, 0x40, 0x41, 0x09, 0xc3, 0xc2, 0x58, 0x26, 0x3a,
+  0xfb, 0x8e, 0x4c, 0x79, 0x6a, 0xf5, 0x77, 0xce, 0xfa, 0xd9, 0xb1, 0x9a,
+  0x2e, 0x25, 0xed, 0x6f, 0x7c, 0xe3, 0x1b, 0xd6, 0xd8, 0xa9, 0xd5, 0x25,
+  0xd4, 0x76, 0xe0, 0xa8, 0x6d, 0xc0, 0x80, 0x0b, 0xb6, 0x17, 0xb6, 0x8c,
+  0xab, 0xdd, 0xab, 0xd6, 0x6b, 0xc7, 0xf0, 0x15, 0x32, 0x4c, 0x71, 0x44,
+  0x9a, 0x33, 0xd6, 0xb6, 0x3c, 0x44, 0x71, 0xcb, 0x00, 0x6f, 0xf9, 0xd2,
+  0xc6, 0x6b, 0xf8, 0xb7, 0x89, 0x2f, 0x43, 0x79, 0x4b, 0xee, 0xa8, 0xf3,
+  0x05, 0x94, 0xb8, 0x3c, 0x64, 0xf7, 0x4f, 0xb1, 0xcc, 0xa5, 0x96, 0xcd,
+  0x8e, 0xb1, 0xc8, 0xa5, 0x67, 0x64, 0xfe, 0x92, 0x97, 0xb6, 0x8c, 0x7a,
+  0xc8, 0x54, 0x0e, 0x76, 0xf1, 0xea, 0x5b, 0x16, 0xdc, 0x5a, 0xbe, 0xa8,
+  0xb0, 0x17, 0x3f, 0x38, 0xc0, 0x24, 0xa4, 0xfc, 0x00, 0x8f, 0xd6, 0x0f,
+  0xc9, 0x14, 0xfa, 0x23, 0x95, 0x26, 0x2c, 0x12, 0x16, 0xa0, 0x13, 0x52,
+  0x4a, 0x31, 0xdb, 0x4e, 0x49, 0xe9, 0xd5, 0x84, 0x98, 0x25, 0x27, 0xa5,
+  0x52, 0xbc, 0x08, 0x66, 0x7d, 0x2e, 0xa9, 0x8f, 0xa4, 0x1e, 0x8a, 0x92,
+  0x55, 0xda, 0x05, 0x23, 0x74, 0xe1, 0x3d, 0xfb, 0x0b, 0x6e, 0x44, 0xc0,
+  0x4f, 0xd7, 0x9f, 0x7f, 0xc0, 0x59, 0x7a, 0x67, 0x3c, 0xbc, 0x9c, 0xdd,
+  0x4b, 0x7b, 0x8d, 0x85, 0xe6, 0x64, 0xdd, 0x5e, 0xd6, 0xa5, 0xcc, 0x69,
+  0x26, 0xd2, 0x3a, 0xf5, 0x34, 0x3d, 0x31, 0xb2, 0x42, 0xcc, 0x85, 0x88,
+  0x33, 0x62, 0x94, 0x0e, 0xa9, 0x5a, 0x8a, 0x03, 0x91, 0x02, 0x3c, 0x78,
+  0xd6, 0xe0, 0x8c, 0xf8, 0x10, 0xb9, 0xa9, 0x58, 0x7a, 0xbd, 0x0b, 0x1b,
+  0x10, 0x49, 0x66, 0xbf, 0xa3, 0x94, 0x52, 0xd2, 0xfb, 0x3d, 0xb6, 0x94,
+  0x84, 0x3a, 0x97, 0x0d, 0x31, 0xa8, 0x39, 0xd0, 0x89, 0xb3, 0xd8, 0xcb,
+  0x9a, 0x97, 0xfb, 0x2a, 0xec, 0x1c, 0x63, 0x17, 0x11, 0x95, 0xd7, 0x9c,
+  0xc0, 0x32, 0x2a, 0x73, 0x5a, 0x08, 0x4b, 0x2c, 0xde, 0x0a, 0x72, 0xca,
+  0x4d, 0x44, 0x29, 0x6c, 0x78, 0x44, 0xa1, 0x33, 0x4a, 0xad, 0xbc, 0x2a,
+  0x27, 0x9a, 0xfa, 0x83, 0x6e, 0x26, 0xde, 0x6e, 0x31, 0xbb, 0xfe, 0xf1,
+  0xf4, 0x73, 0x66, 0xc5, 0x3e, 0xf8, 0x61, 0xe5, 0xe9, 0xf1, 0xf5, 0x48,
+  0x6a, 0x6e, 0xf4, 0x1b, 0x8f, 0xb6, 0x8e, 0xf6, 0x9c, 0x65, 0x3a, 0x21,
+  0x2d, 0xba, 0xaf, 0xcf, 0x0a, 0xe9, 0xd1, 0x7f, 0x13, 0xca, 0x95, 0x1b,
+  0x2e, 0x32, 0xe2, 0xf5, 0xa8, 0x94, 0x5b, 0xd6, 0x69, 0x57, 0xd8, 0xdb,
+  0xcf, 0x64, 0xc6, 0xc4, 0xcf, 0x64, 0xfc, 0x47, 0xac, 0x9c, 0x49, 0xf5,
+  0xf9, 0xae, 0xb8, 0xa3, 0x64, 0x3e, 0xbd, 0x27, 0x18, 0xf2, 0x87, 0xfd,
+  0xb6, 0x12, 0x0a, 0x33, 0x21, 0xf3, 0x6a, 0x45, 0xee, 0xec, 0x6f, 0xa9,
+  0x98, 0x12, 0x55, 0x6f, 0x2b, 0xa7, 0x41, 0xd9, 0x0c, 0x32, 0x75, 0x2b,
+  0x23, 0xa9, 0xaf, 0xe0, 0x0d, 0x51, 0xf6, 0x6f, 0xe1, 0xf6, 0xf6, 0xc9,
+  0xc1, 0x4f, 0x30, 0x1f, 0xa7, 0xb2, 0x1b, 0xcb, 0x34, 0x7b, 0x9f, 0x61,
+  0x25, 0xa2, 0x4a, 0xf3, 0xd9, 0x87, 0xfb, 0x0f, 0xeb, 0xff, 0xc4, 0x4c,
+  0x08, 0xfc, 0x82, 0x98, 0xd6, 0x4c, 0x08, 0x84, 0xa6, 0x39, 0x12, 0x1e,
+  0xe7, 0x93, 0xdd, 0xd3, 0x1f, 0x3b, 0x54, 0x57, 0xef, 0xc3, 0x01, 0x75,
+  0x61, 0x45, 0x36, 0xc0, 0x80, 0xbd, 0xbf, 0x99, 0x6e, 0xc3, 0xd9, 0x99,
+  0x8e, 0xce, 0x50, 0x4e, 0x1e, 0xd2, 0x58, 0xfc, 0x36, 0x92, 0x92, 0xf1,
+  0xe0, 0x9d, 0x63, 0x8b, 0x27, 0xfc, 0xf5, 0xf4, 0x3d, 0xec, 0x0a, 0xed,
+  0xf9, 0x87, 0x5c, 0xa0, 0x28, 0x3e, 0xb8, 0x4c, 0x2c, 0x1b, 0xf4, 0x81,
+  0xef, 0xb5, 0xc9, 0x0d, 0x52, 0xdb, 0x15, 0x17, 0xd1, 0xa8, 0x95, 0xe0,
+  0x29, 0xd8, 0x26, 0xc3, 0x97, 0x31, 0x79, 0xf9, 0x12, 0x44, 0xed, 0x6c,
+  0xf1, 0x42, 0x14, 0x91, 0x78, 0x62, 0xde, 0x69, 0x2d, 0xe0, 0x2e, 0x53,
+  0x2b, 0xb1, 0x1e, 0xb8, 0x98, 0xcc, 0x38, 0xc1, 0xd9, 0xa0, 0x78, 0x82,
+  0xb3, 0x41, 0xf5, 0x09, 0xce, 0xc8, 0x15, 0x6b, 0xbe, 0x70, 0x96, 0xf5,
+  0x2c, 0x3c, 0x3c, 0x86, 0xf3, 0x1c, 0x53, 0x7c, 0xea, 0x43, 0xc1, 0x92,
+  0x52, 0x78, 0x26, 0xcf, 0x67, 0x5b, 0x09, 0xae, 0x62, 0x2e, 0xcd, 0x80,
+  0x02, 0x3f, 0x90, 0x20, 0xd4, 0xd5, 0x71, 0x94, 0x57, 0x51, 0x8b, 0x78,
+  0x8a, 0x1f, 0x6b, 0xb5, 0xd4, 0xa3, 0x0f, 0x71, 0x21, 0x36, 0xc4, 0x85,
+  0xe3, 0x18, 0xa2, 0xc8, 0x1d, 0xfa, 0x0f, 0x30, 0xbc, 0xf7, 0x65, 0x4a,
+  0x50, 0xe3, 0x70, 0xe3, 0x25, 0x04, 0x3d, 0x8e, 0xe1, 0x2c, 0xc6, 0x86,
+  0xb3, 0x78, 0x1c, 0xc3, 0x59, 0x3c, 0x4a, 0xf5, 0xd7, 0xa3, 0x0f, 0xee,
+  0x54, 0x6c, 0x70, 0xa7, 0x8e, 0x63, 0x70, 0xa2, 0x54, 0x2a, 0x86, 0x1c,
+  0xab, 0xe1, 0xc9, 0xb8, 0x29, 0x0c, 0x43, 0x7d, 0x02, 0xdc, 0xe2, 0xaf,
+  0x4c, 0xf6, 0xef, 0x10, 0x57, 0xf6, 0x4e, 0x84, 0x52, 0xb1, 0xb5, 0xd4,
+  0xa1, 0xbe, 0x92, 0xec, 0xea, 0x2b, 0x26, 0xab, 0xcb, 0xb1, 0x3f, 0xa3,
+  0x08, 0xdb, 0x47, 0x62, 0x97, 0x55, 0x74, 0x11, 0xa8, 0x70, 0xed, 0x32,
+  0xca, 0x11, 0xc6, 0xec, 0x63, 0x26, 0x30, 0xd7, 0xa7, 0x42, 0xbe, 0xb7,
+  0x44, 0x4d, 0x6f, 0x7c, 0xf6, 0x64, 0xcf, 0x46, 0xf6, 0x78, 0x4c, 0x46,
+  0xc5, 0xbb, 0x82, 0xad, 0x3d, 0xae, 0x4e, 0xed, 0x5f, 0xbb, 0x0b, 0xe9,
+  0x30, 0x37, 0x58, 0xd7, 0x24, 0xa7, 0xeb, 0xcd, 0x8b, 0xe7, 0xfe, 0xc1,
+  0xa8, 0xcc, 0x71, 0x70, 0x20, 0x02, 0xa9, 0xdc, 0x13, 0xf1, 0x67, 0xe8,
+  0x9f, 0x06, 0xb3, 0xfd, 0x18, 0x79, 0x6e, 0x60, 0xad, 0x07, 0xcf, 0x46,
+  0x97, 0xa2, 0xf1, 0x58, 0x9d, 0x30, 0x01, 0x2d, 0x95, 0x7d, 0x30, 0x79,
+  0x31, 0x17, 0x59, 0xfa, 0xe9, 0x56, 0xc8, 0x53, 0xaa, 0xb0, 0x8c, 0x86,
+  0xe3, 0xf5, 0xe3, 0xf9, 0x60, 0x81, 0xac, 0xb2, 0x09, 0xc2, 0x52, 0x3a,
+  0xde, 0xc7, 0x12, 0x1e, 0x61, 0xaf, 0xa0, 0x80, 0x6f, 0x16, 0x9c, 0xf3,
+  0xaa, 0x07, 0x91, 0x5e, 0x19, 0xe3, 0xad, 0x13, 0x47, 0x06, 0x83, 0xc6,
+  0xa6, 0xc4, 0x26, 0x72, 0x79, 0x25, 0x00, 0x94, 0xe8, 0x37, 0x5d, 0xb7,
+  0xee, 0xc2, 0xdc, 0x08, 0x2f, 0x24, 0xd3, 0x9f, 0x47, 0x1d, 0x9d, 0xb9,
+  0x82, 0xd3, 0xec, 0x87, 0xd8, 0xac, 0x49, 0x7f, 0x3f, 0x67, 0xc2, 0xbc,
+  0x19, 0x10, 0xea, 0x76, 0x95, 0x74, 0xe5, 0x29, 0xa6, 0xa4, 0x08, 0x5a,
+  0xf4, 0x9e, 0x51, 0x6e, 0x8a, 0x8a, 0x7d, 0x3f, 0xed, 0x24, 0x15, 0x64,
+  0x7d, 0xe3, 0x8e, 0x4e, 0x51, 0x1f, 0xdc, 0x0e, 0xd0, 0xfa, 0x52, 0x77,
+  0x73, 0xfb, 0x99, 0x99, 0xdd, 0x6c, 0x6f, 0x0e, 0x2b, 0x80, 0xee, 0x81,
+  0x8e, 0xb2, 0x08, 0xbb, 0xe4, 0x66, 0xda, 0xc3, 0x57, 0xd4, 0x8e, 0x9a,
+  0x04, 0x53, 0x70, 0x58, 0x76, 0xd8, 0xa3, 0xe6, 0xe2, 0xd0, 0x61, 0xe2,
+  0x84, 0x5b, 0x41, 0x71, 0x49, 0xd1, 0x5f, 0x41, 0x69, 0x49, 0xab, 0x41,
+  0xb3, 0x28, 0xb4, 0x3c, 0x9a, 0xe0, 0x43, 0xbe, 0x2f, 0x0c, 0xb3, 0xf5,
+  0xc2, 0xd6, 0x8a, 0x0b, 0xcc, 0xfd, 0xc1, 0x04, 0x00, 0x3d, 0x8d, 0x22,
+  0x73, 0xa6, 0x9d, 0x5d, 0x5b, 0xce, 0xd8, 0x49, 0x13, 0x27, 0xd6, 0x66,
+  0xd9, 0x6a, 0x67, 0x7b, 0xe9, 0x55, 0x09, 0xe7, 0xe1, 0x01, 0x3c, 0x2b,
+  0xbd, 0xc9, 0xfa, 0x72, 0x3c, 0x30, 0xa9, 0x30, 0x20, 0x69, 0x79, 0xae,
+  0x5a, 0x40, 0x52, 0xc5, 0x48, 0x24, 0xdb, 0x40, 0x38, 0x4b, 0x28, 0x11,
+  0x37, 0x3e, 0x5d, 0xee, 0x77, 0x81, 0xd9, 0xa1, 0x2e, 0x55, 0x3a, 0x4b,
+  0xaa, 0x0a, 0x8f, 0x3b, 0xe9, 0x28, 0xaf, 0xe0, 0xeb, 0x54, 0x17, 0x2d,
+  0x99, 0x99, 0x8a, 0xf9, 0x96, 0xa9, 0x42, 0x8a, 0x95, 0x00, 0xe9, 0xc6,
+  0x61, 0x58, 0xa8, 0xff, 0xac, 0x84, 0x8f, 0xd1, 0x93, 0x86, 0x01, 0xc9,
+  0x0d, 0x59, 0x05, 0x56, 0xd7, 0xe2, 0x0f, 0x0c, 0x46, 0x3a, 0xd8, 0xbc,
+  0x0f, 0xa7, 0xc2, 0x38, 0xad, 0x02, 0x45, 0x37, 0x5e, 0x23, 0x52, 0xd5,
+  0x4d, 0xf4, 0xb8, 0x4d, 0xe5, 0xa6, 0x43, 0x75, 0x65, 0xe9, 0x43, 0xd8,
+  0x30, 0x3f, 0x9d, 0x71, 0xea, 0x56, 0xe6, 0x64, 0x9f, 0x7a, 0x8f, 0xdc,
+  0xaf, 0x73, 0xfd, 0x35, 0xa7, 0x64, 0xd3, 0xa2, 0xab, 0xd7, 0xe3, 0x9e,
+  0xed, 0xca, 0xc7, 0xfa, 0x73, 0x1e, 0xb8, 0x5f, 0x76, 0x75, 0x6f, 0x1e,
+  0xa9, 0x9a, 0x3e, 0xf5, 0xbc, 0x7e, 0x37, 0x81, 0x44, 0x7c, 0xc5, 0xa2,
+  0x6c, 0xd1, 0x95, 0xe6, 0x03, 0x52, 0xf6, 0xac, 0x52, 0x52, 0x06, 0x2b,
+  0xe4, 0x93, 0xb3, 0x01, 0x3c, 0xa5, 0x28, 0x07, 0x83, 0xfc, 0x06, 0x7f,
+  0xaf, 0x81, 0x6c, 0xd3, 0x60, 0x95, 0x24, 0xcd, 0xb2, 0x02, 0x88, 0x19,
+  0xe3, 0x1b, 0x96, 0xa7, 0xc3, 0x59, 0xf4, 0x73, 0x78, 0xc9, 0xb4, 0x57,
+  0x4a, 0x71, 0xe7, 0x1b, 0xf6, 0x98, 0x7d, 0x84, 0x6e, 0x52, 0x64, 0x54,
+  0x56, 0x11, 0x8b, 0x88, 0x87, 0xf6, 0xea, 0xc1, 0x12, 0x47, 0xb5, 0x8b,
+  0xdf, 0x5a, 0x5b, 0x58, 0xa8, 0x2d, 0xd9, 0x4f, 0x16, 0x17, 0xe5, 0x13,
+  0x33, 0x61, 0xa2, 0xbf, 0xaf, 0x7e, 0xd5, 0x46, 0x80, 0xc7, 0xd5, 0x2a,
+  0xae, 0xa2, 0x63, 0x0d, 0x63, 0xf6, 0xbb, 0x7f, 0x7f, 0x78, 0x21, 0x39,
+  0x69, 0x42, 0x12, 0x2d, 0xd4, 0x79, 0xbb, 0x3f, 0xd2, 0x9c, 0x4e, 0x66,
+  0x18, 0xb0, 0x70, 0x39, 0x6c, 0xd7, 0x21, 0xa0, 0xd5, 0xc7, 0x54, 0x05,
+  0x59, 0xf9, 0xef, 0xc6, 0x28, 0xed, 0xbe, 0xa6, 0x1c, 0x51, 0x88, 0xb2,
+  0x57, 0xd7, 0x2e, 0x84, 0xe9, 0x7a, 0xf4, 0xb1, 0x44, 0xfb, 0x5c, 0xbb,
+  0x76, 0xf3, 0xc2, 0xb7, 0x5e, 0xfd, 0xe6, 0xd5, 0x8b, 0xc7, 0xd5, 0xf3,
+  0x7c, 0x73, 0x52, 0xa1, 0xdb, 0xf3, 0x57, 0xcf, 0xbf, 0x72, 0xed, 0x9b,
+  0xc7, 0x38, 0xda, 0xc2, 0x3e, 0x65, 0x7a, 0xa1, 0x67, 0x42, 0x5b, 0x3b,
+  0xb0, 0xb8, 0xd6, 0x3e, 0xd9, 0xae, 0x85, 0x4e, 0xb7, 0x9b, 0x2b, 0x62,
+  0xe7, 0xa3, 0x1b, 0xe5, 0x9e, 0x75, 0xc0, 0x09, 0x79, 0x49, 0xb0, 0x44,
+  0x2d, 0x25, 0x39, 0x31, 0x4b, 0xfc, 0x75, 0x33, 0x12, 0x00, 0x46, 0x71,
+  0x5e, 0x1f, 0x93, 0x40, 0xf4, 0x3a, 0xf9, 0x03, 0xbc, 0xa9, 0x42, 0x5b,
+  0xad, 0x38, 0x57, 0x65, 0xe0, 0x95, 0x69, 0xff, 0xb5, 0xfe, 0x4c, 0x78,
+  0x44, 0x6a, 0x29, 0x03, 0x5f, 0x2d, 0xd5, 0x5a, 0xc4, 0xff, 0x22, 0xe1,
+  0x78, 0x0c, 0x27, 0x7d, 0x01, 0x90, 0x32, 0xe7, 0xaa, 0x23, 0x14, 0x09,
+  0x5e, 0x75, 0xa7, 0x3f, 0xdc, 0xe8, 0xf6, 0x0f, 0xed, 0x6c, 0x66, 0xc1,
+  0xee, 0x64, 0x3d, 0x16, 0xe0, 0xcf, 0x21, 0x9b, 0x09, 0xe6, 0x4f, 0x3b,
+  0x8e, 0x23, 0x9a, 0x0d, 0x6c, 0xf3, 0xee, 0x72, 0xe8, 0x1b, 0x9b, 0x8b,
+  0xba, 0x1f, 0x6d, 0xdf, 0xb5, 0x6f, 0x11, 0x16, 0x0f, 0x3f, 0xf4, 0x28,
+  0x0b, 0x0a, 0x4a, 0xe4, 0xdc, 0xc1, 0xce, 0x3a, 0x2e, 0xf6, 0x58, 0xf5,
+  0xeb, 0xe2, 0xe2, 0x3c, 0xc1, 0xc2, 0xa3, 0xae, 0x5c, 0xf3, 0x2d, 0xf2,
+  0xc9, 0x9a, 0x09, 0xae, 0x70, 0xe3, 0x12, 0x60, 0xb9, 0x44, 0x61, 0x48,
+  0x01, 0x67, 0x85, 0x8b, 0xad, 0x9d, 0x33, 0x30, 0xcb, 0x95, 0x73, 0x9f,
+  0xf9, 0xca, 0x9e, 0xb6, 0xd3, 0x67, 0xf4, 0xe9, 0xa7, 0x3e, 0xba, 0x6b,
+  0x4e, 0x5f, 0xac, 0x4c, 0x1e, 0x39, 0x97, 0x0d, 0x40, 0xb9, 0x68, 0x5c,
+  0x4c, 0x9c, 0xec, 0x33, 0x0a, 0x15, 0x10, 0x74, 0x65, 0x39, 0x55, 0x94,
+  0x73, 0x59, 0x5f, 0x11, 0x28, 0x22, 0x73, 0x04, 0x79, 0xc1, 0xd8, 0x50,
+  0x6c, 0x07, 0x18, 0x96, 0x52, 0x2c, 0x4c, 0x6e, 0xb3, 0x86, 0xc3, 0xef,
+  0x0f, 0x87, 0x6e, 0x14, 0x5a, 0x65, 0xb4, 0xf5, 0x72, 0x9f, 0x45, 0x17,
+  0x60, 0x95, 0xbb, 0x0a, 0x6a, 0x04, 0x9e, 0xa2, 0xff, 0xa9, 0x68, 0x51,
+  0x71, 0x29, 0xaf, 0x47, 0x5c, 0xa1, 0xd8, 0x08, 0xac, 0xbc, 0x22, 0x16,
+  0xf6, 0xb0, 0xbe, 0xfd, 0xce, 0x9a, 0xce, 0xad, 0xd0, 0xac, 0x71, 0xfe,
+  0x6d, 0xc1, 0x2a, 0x9f, 0x6d, 0x9d, 0x73, 0xa0, 0x3a, 0xdf, 0x84, 0x8f,
+  0x55, 0x7c, 0xf9, 0xb8, 0x6e, 0x57, 0x81, 0x35, 0x14, 0x00, 0x37, 0xfb,
+  0xfa, 0x91, 0xda, 0xa4, 0x2f, 0xfd, 0x11, 0x22, 0x7a, 0x45, 0xe5, 0x64,
+  0xd5, 0x25, 0x24, 0xf5, 0x9a, 0x39, 0x9d, 0xf3, 0xb0, 0x76, 0xdc, 0x2e,
+  0xf5, 0x02, 0x12, 0xdd, 0xba, 0xa0, 0xb9, 0x78, 0x62, 0x79, 0x50, 0x47,
+  0xaf, 0x10, 0x16, 0xe2, 0xcb, 0xce, 0xc7, 0xd5, 0x96, 0x4d, 0x04, 0x84,
+  0x8b, 0x9b, 0xb3, 0x6c, 0xd6, 0x85, 0x22, 0xc2, 0x1b, 0x60, 0xf2, 0xe7,
+  0x89, 0x76, 0xd6, 0x43, 0x2c, 0xc5, 0x03, 0x86, 0x89, 0x2b, 0xbc, 0xc5,
+  0xd5, 0x70, 0x37, 0x57, 0xc4, 0x1d, 0x35, 0x2c, 0x2f, 0x89, 0xeb, 0x69,
+  0x4c, 0x5c, 0x12, 0x6f, 0x9f, 0xa2, 0xb4, 0xc4, 0xad, 0x8d, 0xd5, 0xa4,
+  0x25, 0x81, 0x92, 0xbb, 0xd2, 0x69, 0x88, 0xee, 0x42, 0x97, 0xc5, 0xe7,
+  0x13, 0xde, 0xa6, 0x93, 0xc1, 0xae, 0x79, 0xce, 0x15, 0x10, 0x08, 0xa6,
+  0x0c, 0xff, 0xb4, 0xdd, 0x7f, 0x9d, 0xaf, 0xed, 0x9c, 0x42, 0x9b, 0xc3,
+  0xbd, 0xc1, 0xb8, 0x37, 0xdc, 0x1f, 0xac, 0xa2, 0x23, 0x47, 0xc1, 0x82,
+  0xa6, 0x0e, 0x2e, 0xa8, 0xd6, 0x5e, 0x7e, 0x25, 0xa3, 0x9f, 0x29, 0x8d,
+  0xe7, 0x22, 0x48, 0x6d, 0xfc, 0x6f, 0x9b, 0xac, 0x4b, 0x6e, 0x02, 0x3b,
+  0x1d, 0xdc, 0xcf, 0x31, 0xc3, 0xd9, 0xd5, 0xd0, 0xed, 0x8d, 0x89, 0xd3,
+  0xb9, 0xdf, 0x1d, 0x0d, 0x1a, 0xeb, 0x38, 0x9b, 0x22, 0xf1, 0xfb, 0x47,
+  0xa2, 0x3c, 0x2e, 0x16, 0xb0, 0xfb, 0x6b, 0x9a, 0x2c, 0xe1, 0x30, 0xf2,
+  0x26, 0x3c, 0xb8, 0xb9, 0xa2, 0x93, 0xfa, 0x5a, 0x86, 0xe2, 0x44, 0xe4,
+  0xbe, 0xd0, 0x39, 0x11, 0xa8, 0x2c, 0xa8, 0x3b, 0xcc, 0x82, 0xb4, 0xbe,
+  0x88, 0x9d, 0xde, 0x62, 0x42, 0x29, 0x9f, 0xaf, 0x0d, 0xd7, 0xf4, 0x53,
+  0x6b, 0x9e, 0x3b, 0xa3, 0xb1, 0x26, 0x1c, 0x1b, 0xa6, 0xb3, 0xb5, 0x0c,
+  0x48, 0x49, 0x18, 0xac, 0xfc, 0xa6, 0xf8, 0x6b, 0x7d, 0xa3, 0xdf, 0xd5,
+  0x99, 0xf8, 0x98, 0xd6, 0x59, 0xc2, 0xe7, 0x34, 0x92, 0x1f, 0x7c, 0xe5,
+  0x6b, 0x17, 0xce, 0x5f, 0x7e, 0x71, 0x5e, 0x31, 0x60, 0x73, 0xd1, 0x3d,
+  0x61, 0x7f, 0x8a, 0x67, 0x98, 0xf5, 0x24, 0x0f, 0x00, 0x43, 0x9e, 0x6e,
+  0x38, 0xb9, 0x3b, 0x0e, 0xfb, 0x28, 0xa0, 0x7f, 0x55, 0xc1, 0x3b, 0x35,
+  0x89, 0x98, 0x59, 0x8b, 0x34, 0x58, 0xee, 0x02, 0x1d, 0x2d, 0x07, 0x18,
+  0x41, 0x88, 0xa0, 0xe3, 0xe1, 0x18, 0xd9, 0x15, 0xbd, 0x30, 0x4a, 0x67,
+  0xfe, 0x34, 0x39, 0x8d, 0x6a, 0x64, 0xeb, 0xc9, 0x19, 0x99, 0x95, 0x58,
+  0xea, 0x4d, 0x86, 0x7b, 0x23, 0x7c, 0x76, 0xa5, 0x3b, 0xde, 0xee, 0x6c,
+  0xf5, 0x87, 0x18, 0x03, 0xc2, 0x5b, 0x9f, 0x4c, 0x4e, 0x7d, 0x9d, 0x32,
+  0x43, 0xea, 0xa0, 0xc5, 0x6c, 0xb0, 0x37, 0x4e, 0x9d, 0x4f, 0xec, 0x6f,
+  0xfe, 0x48, 0x7c, 0x03, 0xdf, 0x7e, 0x9d, 0x7f, 0x99, 0x6b, 0x04, 0x9c,
+  0xd6, 0x5f, 0xe7, 0x08, 0xed, 0x76, 0x29, 0x93, 0xd4, 0x60, 0x6f, 0x87,
+  0x84, 0x24, 0x39, 0x52, 0xfc, 0xd9, 0x81, 0x57, 0xab, 0xe8, 0x61, 0xd3,
+  0x58, 0x6c, 0x25, 0xf5, 0x79, 0x55, 0x72, 0x4a, 0x5d, 0x5d, 0xe1, 0x6d,
+  0x83, 0x46, 0xd3, 0x9c, 0x2c, 0x89, 0x5f, 0x12, 0x55, 0xfd, 0x5b, 0x22,
+  0x40, 0x97, 0x66, 0x37, 0x58, 0xfd, 0xa2, 0xd4, 0x03, 0x36, 0x2c, 0x75,
+  0x2b, 0x4e, 0x4a, 0xd9, 0x76, 0xae, 0xe9, 0x46, 0x35, 0x16, 0x26, 0x5e,
+  0x9d, 0x1d, 0xd4, 0x74, 0xa3, 0xf0, 0xf7, 0x3f, 0x18, 0x0e, 0xd2, 0xb2,
+  0xcf, 0xb1, 0x8d, 0xf9, 0x5a, 0x46, 0x0a, 0xc2, 0x90, 0xba, 0x3a, 0x8b,
+  0x33, 0xc5, 0x24, 0x80, 0x04, 0xc2, 0xc7, 0x5a, 0x97, 0xc1, 0x87, 0x14,
+  0xd0, 0xa8, 0x47, 0xd1, 0xd2, 0xab, 0x74, 0xc9, 0xe0, 0x6f, 0x1e, 0xfe,
+  0x77, 0xe8, 0x6a, 0x49, 0x23, 0x26, 0x2a, 0xd9, 0x41, 0x7f, 0xc3, 0xcd,
+  0xd7, 0xd2, 0x31, 0x99, 0xb7, 0xdd, 0xec, 0xac, 0x0a, 0x15, 0x8a, 0x3e,
+  0xb2, 0x57, 0xf4, 0xf8, 0x82, 0x38, 0x1d, 0x11, 0xa1, 0xcb, 0x98, 0x9f,
+  0x00, 0x7a, 0xc2, 0xbf, 0xed, 0x80, 0x3f, 0xd3, 0x06, 0x0b, 0x3b, 0xa6,
+  0xfb, 0x89, 0x68, 0xc2, 0xd6, 0xcc, 0xfd, 0xb4, 0x8b, 0xbb, 0x4c, 0xae,
+  0x15, 0xf6, 0x01, 0x12, 0xeb, 0xf2, 0x5e, 0xbf, 0xff, 0xa7, 0xd0, 0xa0,
+  0xd1, 0xe4, 0xab, 0x18, 0x58, 0xcc, 0x76, 0xf4, 0x93, 0x2b, 0xf8, 0xb6,
+  0x41, 0xd5, 0x03, 0xed, 0x55, 0x57, 0x9b, 0xaf, 0x31, 0x20, 0x3d, 0xca,
+  0x8a, 0x17, 0x06, 0x21, 0x70, 0x0c, 0x7d, 0x6d, 0x2d, 0x2e, 0xf8, 0x18,
+  0x25, 0x88, 0xe7, 0x1f, 0xe0, 0x10, 0x26, 0x70, 0x10, 0x10, 0x62, 0xf8,
+  0x07, 0x00, 0xc7, 0x75, 0xea, 0x6d, 0xd4, 0x70, 0x77, 0xdf, 0xc2, 0xb7,
+  0xe1, 0xfe, 0xfc, 0x8d, 0x1b, 0x19, 0xb4, 0x78, 0x5f, 0x0c, 0xc4, 0xec,
+  0xe1, 0x30, 0x10, 0xb9, 0xa9, 0x8b, 0x81, 0x48, 0xae, 0x2e, 0x06, 0x4e,
+  0xe3, 0xc2, 0x1d, 0x2a, 0xf1, 0xc3, 0x3f, 0x65, 0x2f, 0xd6, 0xf8, 0x67,
+  0xdd, 0x4a, 0xcb, 0x87, 0xde, 0xc4, 0xa2, 0xb8, 0xab, 0xe6, 0xd2, 0x77,
+  0x55, 0xc8, 0x9e, 0xc0, 0x7a, 0x59, 0x08, 0x31, 0xce, 0x4b, 0x39, 0x97,
+  0xce, 0xa7, 0xe8, 0x21, 0x89, 0x69, 0xde, 0x17, 0x6a, 0x85, 0x4b, 0xdf,
+  0xe6, 0x39, 0x15, 0xd6, 0xbb, 0x59, 0x39, 0x9c, 0xfc, 0xe3, 0xe1, 0xca,
+  0xea, 0x35, 0x39, 0x2d, 0x4d, 0xca, 0xfc, 0x34, 0x6e, 0xd4, 0xd6, 0x6a,
+  0x4d, 0x4a, 0x8d, 0x18, 0x20, 0xbe, 0xfd, 0x2d, 0x3b, 0x56, 0xf4, 0xc7,
+  0x09, 0x7d, 0xdc, 0xc9, 0x29, 0x87, 0xd4, 0x7c, 0x2b, 0x79, 0x51, 0x5e,
+  0x57, 0xa2, 0x61, 0xb7, 0x38, 0xdf, 0x08, 0xaf, 0xd6, 0xf4, 0x29, 0x53,
+  0xf6, 0x1d, 0x22, 0xc0, 0xbe, 0xe3, 0xe4, 0x8e, 0x7d, 0x27, 0x38, 0xcb,
+  0xac, 0xbd, 0xc1, 0x57, 0xb1, 0xbe, 0x1c, 0xd1, 0xbb, 0x3f, 0xec, 0xf6,
+  0x2e, 0x67, 0x7d, 0x9b, 0x1f, 0x89, 0xc7, 0x42, 0x7f, 0x59, 0xb4, 0xa2,
+  0x78, 0x3b, 0xbe, 0x1c, 0xb7, 0xb2, 0x7e, 0xf9, 0x72, 0xd4, 0x8d, 0xdc,
+  0x2f, 0x65, 0xe5, 0x80, 0xa8, 0x12, 0x4a, 0xb5, 0xa9, 0x3b, 0xdf, 0xe1,
+  0xad, 0x47, 0xc1, 0x44, 0xd3, 0x6e, 0x9a, 0xab, 0x65, 0xc1, 0xf1, 0x74,
+  0xc4, 0xaf, 0x5a, 0xcd, 0xe4, 0x93, 0xc2, 0x6f, 0x4c, 0x2a, 0xd6, 0xf8,
+  0x27, 0xd3, 0xff, 0x45, 0x32, 0xe5, 0x27, 0xd2, 0x16, 0xfd, 0x08, 0xee,
+  0x0f, 0xef, 0x09, 0x77, 0x90, 0x5a, 0xf0, 0x42, 0xa0, 0x10, 0x76, 0xe0,
+  0xf8, 0xc8, 0x76, 0xd0, 0xb5, 0x6a, 0xb9, 0x18, 0xe1, 0x3a, 0xce, 0x96,
+  0x36, 0xf0, 0xd6, 0xd9, 0xb2, 0x87, 0x66, 0x70, 0x31, 0x13, 0xc6, 0x65,
+  0x84, 0x48, 0xd0, 0xd4, 0x3a, 0xef, 0xc0, 0x5a, 0xd8, 0x1d, 0xee, 0xc2,
+  0xc2, 0x1f, 0x0f, 0x5f, 0x19, 0xee, 0x83, 0x98, 0xdf, 0xcd, 0xd3, 0x06,
+  0xa3, 0x60, 0x96, 0x5f, 0xce, 0x46, 0x3b, 0x20, 0x63, 0x23, 0x1d, 0x19,
+  0x28, 0x4c, 0x0f, 0xb0, 0x91, 0x0d, 0x6a, 0xbc, 0xe5, 0xcb, 0x7b, 0xe8,
+  0xe1, 0xe8, 0xb7, 0xdb, 0xdc, 0xba, 0xf3, 0x83, 0x1a, 0xc3, 0xe8, 0xca,
+  0xf9, 0xff, 0xf6, 0xea, 0x8d, 0x4b, 0x6b, 0x37, 0x56, 0x2e, 0xad, 0x42,
+  0xe3, 0x53, 0x06, 0x04, 0x3e, 0xfc, 0xd3, 0x57, 0x2f, 0x5e, 0x7a, 0xe5,
+  0xfc, 0x9f, 0xc2, 0x8b, 0xc5, 0xf9, 0x79, 0xca, 0x93, 0x82, 0x92, 0x2f,
+  0x90, 0x6e, 0x74, 0x9f, 0xae, 0x20, 0x42, 0x8a, 0x13, 0x4f, 0xef, 0x6d,
+  0x8f, 0x4c, 0xc5, 0x63, 0x20, 0xa8, 0x5a, 0xbf, 0xe9, 0xbd, 0x74, 0x13,
+  0x38, 0xea, 0x4d, 0x22, 0x97, 0x53, 0x97, 0x04, 0x6f, 0xc0, 0x52, 0x3e,
+  0x40, 0x0e, 0x73, 0x59, 0xfe, 0x54, 0xb9, 0xc5, 0xd5, 0xeb, 0x4e, 0x77,
+  0x77, 0x17, 0x8f, 0x74, 0x5a, 0x8f, 0x70, 0xaf, 0xa3, 0x45, 0xc0, 0xef,
+  0x28, 0x86, 0x30, 0x46, 0x42, 0x2e, 0x5c, 0x1d, 0xe8, 0x7e, 0xfb, 0x5b,
+  0xb8, 0x6c, 0xbe, 0x35, 0xfd, 0x10, 0x75, 0x2b, 0x58, 0x80, 0x84, 0x96,
+  0xcb, 0xf4, 0x61, 0xa7, 0xd3, 0xa9, 0x69, 0x53, 0xbc, 0x1c, 0x13, 0xa0,
+  0xf6, 0xdf, 0xae, 0xbc, 0xf2, 0xad, 0xf1, 0x78, 0xf7, 0x46, 0xfa, 0x67,
+  0x7b, 0x69, 0x3e, 0x6e, 0xe8, 0x6b, 0x08, 0xb4, 0xe8, 0x0c, 0x01, 0xb9,
+  0x46, 0xed, 0xfa, 0xb5, 0xd5, 0xb5, 0x5a, 0xcb, 0x50, 0xfe, 0x5c, 0x52,
+  0x3b, 0x39, 0x82, 0xb6, 0x43, 0x8c, 0xc8, 0x59, 0x82, 0x1f, 0x66, 0x23,
+  0x3b, 0xe9, 0xda, 0x25, 0x94, 0x01, 0xbe, 0xc6, 0x75, 0xa1, 0x28, 0xd7,
+  0xe0, 0xda, 0x07, 0x1c, 0x27, 0x36, 0xcb, 0xe5, 0x8e, 0x3f, 0x43, 0x73,
+  0xc2, 0x5b, 0x54, 0xdc, 0x10, 0x07, 0x6f, 0xc1, 0x9d, 0x0a, 0xdd, 0xa8,
+  0x7f, 0x8c, 0x77, 0x68, 0x8c, 0x2f, 0x50, 0xa4, 0xf8, 0x1d, 0xde, 0xcd,
+  0x4e, 0xd4, 0x96, 0x19, 0x44, 0x91, 0x85, 0x44, 0x8c, 0xc8, 0xee, 0x8b,
+  0xf2, 0x59, 0x8c, 0xc6, 0xc2, 0x11, 0x87, 0x2c, 0xb5, 0x8d, 0x26, 0xff,
+  0xd2, 0x4a, 0x3b, 0xae, 0x55, 0x18, 0xc3, 0x4d, 0x8a, 0x42, 0xc5, 0x94,
+  0x64, 0xb4, 0x1a, 0xac, 0x2f, 0xe6, 0x0a, 0xbe, 0x15, 0x0e, 0xbb, 0xa4,
+  0xc9, 0xc2, 0x54, 0x93, 0x89, 0xf8, 0x6b, 0xdd, 0x4e, 0x6e, 0xf8, 0xfc,
+  0x03, 0xa4, 0x10, 0x10, 0x7d, 0x17, 0x56, 0x17, 0xa9, 0x63, 0xf0, 0xbe,
+  0x6a, 0xa8, 0x86, 0x4f, 0xe0, 0x0a, 0xc9, 0x7a, 0x55, 0x7d, 0x4e, 0x9c,
+  0xa9, 0x48, 0xa5, 0x5a, 0x30, 0x3c, 0x17, 0x02, 0x99, 0xab, 0x22, 0x54,
+  0x54, 0x60, 0xa2, 0x61, 0xba, 0x90, 0xba, 0x1b, 0xc3, 0xd1, 0xf8, 0x18,
+  0x20, 0x91, 0x4c, 0xab, 0x36, 0x44, 0xd1, 0x2d, 0xb8, 0x70, 0x11, 0xfc,
+  0x92, 0x42, 0x49, 0x28, 0xf5, 0x23, 0x9f, 0xf9, 0x0f, 0x45, 0x4e, 0x8e,
+  0xcf, 0x29, 0xfa, 0xe1, 0xc7, 0x14, 0x62, 0x08, 0x0f, 0xd8, 0x56, 0x28,
+  0xdb, 0x08, 0xde, 0x36, 0x28, 0x58, 0xee, 0xd8, 0x76, 0x2c, 0x4a, 0x06,
+  0x20, 0xc7, 0x99, 0x27, 0xce, 0xa2, 0xdf, 0x88, 0xcf, 0x80, 0x70, 0xbb,
+  0xa3, 0xe1, 0x1d, 0x98, 0xca, 0xdc, 0xa2, 0x1d, 0x5b, 0x84, 0xe4, 0x3d,
+  0x20, 0x1d, 0x95, 0x2e, 0x0c, 0x77, 0x80, 0x47, 0xe3, 0x2d, 0xd6, 0x57,
+  0xd8, 0xed, 0xa6, 0xa3, 0x4d, 0x31, 0x7c, 0xba, 0x29, 0x8e, 0x80, 0x6f,
+  0xf5, 0x1a, 0xf8, 0x25, 0x74, 0x03, 0x97, 0xde, 0x93, 0x09, 0x8a, 0x1d,
+  0x70, 0x11, 0x6c, 0x26, 0x7f, 0x2c, 0xab, 0x0f, 0x54, 0xd8, 0x4e, 0xeb,
+  0x1e, 0x07, 0x09, 0x10, 0x0f, 0xd6, 0xa3, 0xec, 0xdc, 0xb3, 0x3f, 0x4f,
+  0xd8, 0x88, 0x0b, 0x37, 0x7e, 0xf9, 0xb6, 0x2f, 0x9c, 0xef, 0x5f, 0x59,
+  0x48, 0x3d, 0xf4, 0x76, 0xfb, 0xf4, 0x61, 0x0b, 0x95, 0x2d, 0xef, 0x1f,
+  0xfc, 0x2d, 0xfa, 0x7a, 0x7b, 0x7a, 0xb5, 0xe9, 0x07, 0x16, 0x3b, 0x2c,
+  0xda, 0xf3, 0xde, 0x9e, 0x0d, 0xef, 0x58, 0x7b, 0x33, 0x9a, 0xad, 0x18,
+  0x22, 0x4b, 0xd1, 0x26, 0x8c, 0x6f, 0x1c, 0x1b, 0x46, 0xd1, 0xf6, 0xab,
+  0x0a, 0xc3, 0x2c, 0xd6, 0xc3, 0x43, 0xf1, 0xb7, 0xef, 0xc4, 0x3a, 0x25,
+  0x43, 0x50, 0x58, 0xaa, 0x72, 0x76, 0xe4, 0x9e, 0xe6, 0x47, 0x36, 0x77,
+  0xb0, 0x54, 0x2d, 0x5e, 0x78, 0x61, 0x79, 0xae, 0xc2, 0x02, 0x7e, 0x17,
+  0x05, 0x22, 0x0c, 0x66, 0x43, 0x43, 0xf3, 0xa3, 0x83, 0x77, 0xb0, 0xfe,
+  0x56, 0xd2, 0xc0, 0x2a, 0x82, 0xb0, 0x94, 0xdf, 0xa6, 0xfa, 0x8d, 0x0f,
+  0x61, 0x05, 0x1b, 0xb8, 0x93, 0x93, 0xcf, 0x3f, 0x60, 0x5d, 0x4f, 0x9a,
+  0xb0, 0x74, 0xb0, 0xf5, 0x23, 0x51, 0x78, 0x3e, 0xa1, 0xe2, 0x5d, 0xa8,
+  0xbd, 0xfd, 0x10, 0x3e, 0xe3, 0xd2, 0xc3, 0x49, 0xdc, 0x57, 0xf3, 0x13,
+  0xb2, 0x67, 0x7f, 0x0c, 0x0b, 0x6a, 0x5d, 0x2f, 0x28, 0xaf, 0x78, 0xc8,
+  0x83, 0x39, 0xf7, 0xc0, 0xb3, 0x4f, 0x1d, 0x24, 0x25, 0x4d, 0x69, 0x23,
+  0xc0, 0xc4, 0x13, 0x57, 0xd6, 0xd0, 0x8b, 0xab, 0xc5, 0xa5, 0x99, 0xa6,
+  0xa5, 0x77, 0xb3, 0xa7, 0xd1, 0x5d, 0xae, 0xa4, 0x98, 0xf6, 0xd2, 0x49,
+  0x73, 0xc6, 0x29, 0x03, 0x42, 0xfe, 0x42, 0x89, 0x9b, 0x9f, 0x53, 0xfc,
+  0xd8, 0x27, 0x42, 0x01, 0x2a, 0x8a, 0x99, 0x51, 0x44, 0x9c, 0x2a, 0x6a,
+  0x66, 0xe8, 0xfb, 0x64, 0xfa, 0x71, 0xad, 0xd9, 0x74, 0xac, 0x78, 0xce,
+  0x82, 0x10, 0x58, 0xd0, 0x46, 0x88, 0x69, 0xce, 0xf9, 0x09, 0x08, 0x9c,
+  0x56, 0xb4, 0x5d, 0x9e, 0x2b, 0x9f, 0x7f, 0xfb, 0xe4, 0xa4, 0xef, 0x3a,
+  0x32, 0x0e, 0x62, 0xb2, 0x6e, 0x92, 0xae, 0x38, 0xa2, 0x1e, 0x61, 0xe9,
+  0xd1, 0x19, 0x9e, 0xa2, 0x0c, 0x08, 0xec, 0x2e, 0x1b, 0xf6, 0xb2, 0xcd,
+  0xeb, 0x70, 0x7f, 0x93, 0x7a, 0x74, 0x25, 0x11, 0xb2, 0x4b, 0xe7, 0xa0,
+  0x87, 0xef, 0xbf, 0x9b, 0x8d, 0xb7, 0xd5, 0xe4, 0xdb, 0xc7, 0x81, 0x4a,
+  0xd2, 0x44, 0x2a, 0x35, 0x9c, 0x8b, 0xeb, 0xa3, 0xe1, 0x4e, 0x06, 0xa2,
+  0x30, 0x6c, 0x03, 0x18, 0xfa, 0xdd, 0x94, 0xd9, 0x2d, 0x45, 0x1e, 0x7f,
+  0x52, 0xfb, 0x50, 0x21, 0x08, 0xa1, 0x00, 0x1a, 0xa5, 0xdd, 0xde, 0x7d,
+  0x4a, 0x91, 0x95, 0x9c, 0x00, 0x8e, 0xf9, 0xdd, 0x74, 0x63, 0x55, 0xbc,
+  0xb8, 0x76, 0xfd, 0xd2, 0x55, 0xbe, 0x67, 0x08, 0x5c, 0x83, 0xb2, 0x68,
+  0xe9, 0xd5, 0xc2, 0x53, 0x57, 0xd5, 0x29, 0x40, 0x83, 0x82, 0x21, 0x44,
+  0x5a, 0x2a, 0x11, 0xd9, 0xf4, 0x06, 0x49, 0x51, 0x2a, 0xa1, 0x95, 0x0c,
+  0xec, 0x43, 0x3d, 0x35, 0x4d, 0xff, 0x9b, 0xb8, 0x0f, 0x28, 0x34, 0xe6,
+  0x49, 0x5d, 0xd5, 0xeb, 0x5a, 0x98, 0xaf, 0xa6, 0xb9, 0x06, 0x2a, 0x48,
+  0x27, 0x55, 0x6f, 0x67, 0xc4, 0x71, 0xc6, 0x30, 0x7c, 0xd1, 0xd8, 0x4e,
+  0xad, 0x23, 0xd6, 0xd0, 0xf5, 0xa1, 0x48, 0x4c, 0x24, 0x0b, 0x25, 0x31,
+  0x58, 0x30, 0xb7, 0xde, 0x71, 0xd9, 0x13, 0xe2, 0x38, 0x2b, 0x73, 0x24,
+  0xf2, 0x88, 0xf4, 0xb8, 0xd8, 0x61, 0xea, 0x38, 0x74, 0xe8, 0xad, 0x48,
+  0x77, 0x08, 0x52, 0xd7, 0x9d, 0xba, 0xbd, 0x5f, 0x37, 0xfb, 0x69, 0x77,
+  0xe4, 0xcc, 0x32, 0xcb, 0xbd, 0x4f, 0xe4, 0x56, 0x53, 0x86, 0x99, 0x5c,
+  0x2e, 0x21, 0x34, 0x74, 0x0c, 0x47, 0x0f, 0xe7, 0x46, 0x5d, 0x2e, 0x47,
+  0xa0, 0xa2, 0x19, 0x8a, 0xf5, 0xb1, 0xa2, 0x86, 0x53, 0xf3, 0x4f, 0x8b,
+  0x75, 0x09, 0xc8, 0x9b, 0xe8, 0x5f, 0xa7, 0x77, 0x50, 0xf0, 0xb8, 0x91,
+  0x28, 0x74, 0x7b, 0xbd, 0x6a, 0xfd, 0xf3, 0x8f, 0x42, 0xba, 0xc6, 0x07,
+  0x5a, 0xcf, 0xb9, 0x8b, 0xde, 0xa5, 0x22, 0x71, 0x5a, 0x40, 0x97, 0x0e,
+  0x0b, 0xed, 0x4a, 0x77, 0xb0, 0xd7, 0xed, 0xdf, 0x48, 0xb7, 0x60, 0x24,
+  0xdb, 0x32, 0x88, 0x48, 0x72, 0x7e, 0xdc, 0x50, 0x32, 0x1d, 0x89, 0x2a,
+  0xd4, 0x77, 0x69, 0xf5, 0x7a, 0xfb, 0xfc, 0xf5, 0x1a, 0xbb, 0xfa, 0x48,
+  0xed, 0x09, 0x77, 0x4a, 0xbf, 0xce, 0xc6, 0x69, 0x7f, 0xef, 0x36, 0xce,
+  0xf3, 0xac, 0x77, 0xfe, 0x3a, 0xee, 0x1b, 0x03, 0xd9, 0x62, 0x8d, 0x8e,
+  0x0b, 0xb5, 0xb8, 0xcf, 0xea, 0x44, 0x90, 0xea, 0xf2, 0x5f, 0x90, 0x6b,
+  0x4e, 0x99, 0xee, 0x25, 0x1e, 0x26, 0x0d, 0x64, 0xdd, 0x32, 0xbb, 0x5a,
+  0xa0, 0xf9, 0x0a, 0xb2, 0xf1, 0xb7, 0x9a, 0x75, 0x28, 0x38, 0x03, 0x44,
+  0xd0, 0x7a, 0x87, 0x67, 0x80, 0xaa, 0x37, 0x69, 0xa9, 0xe6, 0x38, 0x35,
+  0x30, 0x3c, 0x4f, 0x3c, 0x89, 0x80, 0xae, 0x61, 0x50, 0x37, 0x46, 0x2d,
+  0x4f, 0x3f, 0x4a, 0xbe, 0x9b, 0x5d, 0xce, 0xc8, 0xfb, 0x0a, 0x76, 0xf2,
+  0xe3, 0x9a, 0x91, 0x50, 0x14, 0xf7, 0x2b, 0x62, 0xab, 0xbf, 0xff, 0x25,
+  0x9c, 0x0f, 0xff, 0xe2, 0xf3, 0x06, 0x3a, 0x0d, 0xec, 0xca, 0x97, 0xd3,
+  0x27, 0x1d, 0xac, 0x75, 0x8e, 0x71, 0x75, 0x2c, 0x97, 0x31, 0x9e, 0x19,
+  0x78, 0xc6, 0x7c, 0x2c, 0xd0, 0xa8, 0x3f, 0xff, 0x80, 0x21, 0x3a, 0xa9,
+  0x27, 0x94, 0x12, 0x5e, 0xcb, 0x69, 0x2a, 0x44, 0x8b, 0xba, 0x13, 0xb1,
+  0x2e, 0x7f, 0x79, 0xf0, 0x16, 0xea, 0x3b, 0xe0, 0x74, 0x02, 0x80, 0x98,
+  0xe9, 0xf7, 0xa7, 0xae, 0x9d, 0xc1, 0x93, 0xe1, 0xf4, 0x72, 0xcb, 0xb9,
+  0x71, 0xc6, 0x7a, 0x64, 0x73, 0x73, 0xf1, 0x2a, 0x13, 0xfe, 0xbd, 0xc2,
+  0xd2, 0x26, 0x52, 0x63, 0xf2, 0x13, 0x0c, 0x33, 0x0f, 0xa9, 0x06, 0x46,
+  0x98, 0xe1, 0xdf, 0xc8, 0xd2, 0x2a, 0x66, 0x15, 0x98, 0xae, 0x98, 0xa5,
+  0x0b, 0x59, 0xc8, 0x0a, 0x86, 0x5f, 0xdd, 0xed, 0xf6, 0xed, 0x36, 0x9a,
+  0x63, 0x87, 0x71, 0xd4, 0xc7, 0xaa, 0x17, 0x4d, 0x22, 0xb5, 0xc3, 0xfc,
+  0x0c, 0x31, 0x88, 0x59, 0xd9, 0x7e, 0x35, 0xf0, 0x76, 0x7b, 0x79, 0xae,
+  0xc2, 0xa1, 0x4a, 0x09, 0x5a, 0xde, 0xd7, 0xf9, 0x69, 0x02, 0xc7, 0xc4,
+  0x43, 0x71, 0x33, 0x50, 0xca, 0x65, 0xe1, 0xe6, 0xf7, 0xf1, 0x3a, 0xdb,
+  0xd3, 0x6a, 0x16, 0x4e, 0x5b, 0xc5, 0x54, 0x6d, 0x72, 0xf2, 0xc3, 0x2a,
+  0xcc, 0x43, 0x58, 0x3d, 0x9c, 0x24, 0xe9, 0xe6, 0xf7, 0x07, 0x9b, 0x66,
+  0x6a, 0x68, 0x13, 0xca, 0x18, 0x9a, 0x6a, 0x54, 0x90, 0x2c, 0x60, 0x6f,
+  0x73, 0x53, 0x5c, 0xc9, 0xba, 0xfb, 0xdd, 0x6c, 0x1c, 0x3c, 0xcb, 0xb9,
+  0x62, 0x46, 0xb6, 0x67, 0x93, 0x69, 0x3a, 0x06, 0x0a, 0x6e, 0x64, 0xfd,
+  0x6c, 0x7c, 0xbf, 0xd1, 0xf4, 0x0c, 0xa1, 0x9a, 0x02, 0x20, 0x0f, 0x30,
+  0x0a, 0x98, 0x33, 0x91, 0xc1, 0x69, 0x25, 0x2f, 0xea, 0x5b, 0x9b, 0x23,
+  0xd3, 0x1d, 0x96, 0x64, 0xae, 0x2c, 0x16, 0xc6, 0xba, 0x8a, 0x16, 0x52,
+  0x54, 0xe6, 0x16, 0xe9, 0xfe, 0x49, 0xcf, 0xf4, 0x06, 0x19, 0xbb, 0xdf,
+  0xc3, 0x1c, 0x19, 0xa2, 0xf4, 0x38, 0x3d, 0xe1, 0x57, 0x6d, 0x36, 0x4a,
+  0x31, 0x6b, 0xf6, 0xf9, 0x5f, 0x3c, 0x4d, 0x87, 0x99, 0xa8, 0xc8, 0x54,
+  0xc5, 0xc8, 0x57, 0x3c, 0xe2, 0xdf, 0xff, 0xe2, 0x87, 0x11, 0xfe, 0xf7,
+  0x5b, 0x92, 0x8c, 0xa8, 0xce, 0x2c, 0xd7, 0x31, 0x95, 0x0c, 0x97, 0x97,
+  0xeb, 0x1d, 0x74, 0xfb, 0xab, 0xd5, 0xc6, 0x65, 0x2b, 0xb0, 0xf8, 0x97,
+  0xcd, 0x99, 0x34, 0x52, 0x21, 0x1d, 0x56, 0xe1, 0xe8, 0x63, 0xdc, 0x1f,
+  0x36, 0xb9, 0x60, 0xd8, 0x0f, 0x63, 0x07, 0xc1, 0xbb, 0xb3, 0xf1, 0xf4,
+  0x5a, 0x44, 0x73, 0xd6, 0x22, 0x4d, 0x6d, 0xfc, 0x56, 0x5e, 0xb8, 0x5a,
+  0x83, 0xf3, 0xf6, 0xb9, 0xba, 0xd5, 0x31, 0xcd, 0xc1, 0x43, 0x3c, 0x1b,
+  0xa1, 0xc9, 0x3b, 0x62, 0xdd, 0x06, 0xe6, 0x32, 0xb2, 0x41, 0xb5, 0xe4,
+  0xc5, 0xf0, 0x9c, 0x08, 0x4b, 0xb1, 0x3a, 0x79, 0x4e, 0xcd, 0x2f, 0xcf,
+  0x79, 0x2c, 0x1d, 0x20, 0xeb, 0x23, 0xc0, 0x62, 0xe2, 0x54, 0x31, 0x52,
+  0x9a, 0xf7, 0x39, 0x53, 0x0b, 0x1c, 0x79, 0xd7, 0xd9, 0xe5, 0xa4, 0x61,
+  0xfc, 0x14, 0xbc, 0x3b, 0x8b, 0xb5, 0xa5, 0x42, 0x37, 0x1a, 0x8e, 0x8c,
+  0xbf, 0x66, 0x67, 0xda, 0x80, 0xe6, 0x0a, 0xe3, 0x71, 0x4a, 0xee, 0x51,
+  0x53, 0xfb, 0xfd, 0x3f, 0xfd, 0xf3, 0xff, 0xf7, 0xf8, 0x9d, 0xb8, 0x64,
+  0x41, 0x29, 0xc2, 0x88, 0xcf, 0xfc, 0x48, 0x4c, 0x0e, 0xb9, 0xdf, 0x24,
+  0x28, 0x7e, 0xd6, 0x9e, 0xc1, 0xc5, 0xc6, 0xf0, 0x4d, 0x9a, 0xec, 0x79,
+  0x8f, 0xfc, 0xc3, 0xdd, 0xea, 0xd4, 0x97, 0x64, 0xb4, 0x8e, 0x7d, 0xbf,
+  0x99, 0x18, 0x54, 0xfc, 0xc2, 0x29, 0x8f, 0xbe, 0x93, 0x27, 0x95, 0x8c,
+  0xf5, 0x39, 0xe6, 0x31, 0x10, 0x7a, 0x4e, 0x4a, 0xa2, 0x86, 0x35, 0x10,
+  0x12, 0xa1, 0xfd, 0xf8, 0x44, 0x8c, 0x2d, 0x41, 0x39, 0x0c, 0xe9, 0x80,
+  0x1e, 0x4a, 0x62, 0xa7, 0x3e, 0x14, 0x72, 0xe0, 0xeb, 0x92, 0x85, 0x7f,
+  0x20, 0x54, 0x1e, 0xa2, 0x6c, 0xee, 0xf4, 0x53, 0xdc, 0x95, 0xec, 0xbe,
+  0xaf, 0x76, 0xca, 0xe7, 0x96, 0x4c, 0x27, 0x1d, 0xd4, 0x08, 0x13, 0xd2,
+  0x00, 0x7c, 0x46, 0x5b, 0x88, 0x74, 0xef, 0x4f, 0xbc, 0xcc, 0x12, 0xb4,
+  0xcd, 0x04, 0x1f, 0x78, 0xd2, 0x99, 0x13, 0x6b, 0xe9, 0xc2, 0xb5, 0xab,
+  0x6b, 0x37, 0xae, 0xbd, 0xf2, 0xea, 0xda, 0xb5, 0xeb, 0x2b, 0x17, 0xd0,
+  0x4a, 0x73, 0xab, 0x2e, 0x0a, 0x8a, 0xc3, 0x24, 0xd4, 0xa5, 0x93, 0x25,
+  0xfe, 0x29, 0x7c, 0xcf, 0xf0, 0xaf, 0x2d, 0x0c, 0xdb, 0xab, 0xdf, 0x5e,
+  0x96, 0x00, 0xf6, 0xf3, 0xd5, 0xbd, 0x0d, 0x1d, 0x0e, 0x98, 0x4b, 0x4d,
+  0x2e, 0x5c, 0x03, 0xe8, 0x0c, 0xd0, 0xd3, 0xa4, 0x9b, 0x6d, 0xc0, 0x85,
+  0x6a, 0xb8, 0x9b, 0x6d, 0xca, 0xe5, 0x28, 0xfe, 0xd6, 0x7e, 0x72, 0xf4,
+  0x13, 0xd7, 0xbb, 0x03, 0x16, 0xef, 0x4f, 0xe2, 0x65, 0x53, 0x67, 0x38,
+  0x96, 0x37, 0xf3, 0xaf, 0x7e, 0x35, 0x70, 0x33, 0x3f, 0x13, 0xbd, 0x99,
+  0x57, 0xba, 0x5a, 0xe5, 0x0a, 0x57, 0x5c, 0x8a, 0x84, 0xa1, 0xbe, 0x67,
+  0x59, 0x8b, 0x6f, 0x3f, 0xbf, 0x39, 0xc8, 0x8f, 0x34, 0x2e, 0x91, 0x26,
+  0xf4, 0x19, 0x0e, 0x6d, 0x6f, 0x50, 0x75, 0x70, 0x32, 0x8f, 0x09, 0x01,
+  0xbd, 0x86, 0xfa, 0x77, 0x56, 0x1e, 0x79, 0xbf, 0x9b, 0x5f, 0xba, 0x4b,
+  0x09, 0xc8, 0x06, 0x2a, 0x00, 0x55, 0xe5, 0xaf, 0xaf, 0x46, 0xe0, 0x74,
+  0xfc, 0xea, 0xee, 0x68, 0x38, 0x1e, 0x6e, 0x0e, 0xfb, 0x80, 0xc6, 0x06,
+  0x9c, 0xa2, 0xa3, 0xfb, 0x22, 0x31, 0xba, 0x42, 0x06, 0xe9, 0xe0, 0x52,
+  0x0b, 0x93, 0x52, 0x62, 0x41, 0xfa, 0x23, 0x4e, 0xe6, 0x52, 0x72, 0x0b,
+  0x0e, 0x17, 0x07, 0xf8, 0x6d, 0x43, 0x85, 0xb9, 0x23, 0xf2, 0xb3, 0x47,
+  0x74, 0x02, 0x0b, 0x71, 0x8c, 0xeb, 0xbc, 0x9f, 0x9c, 0xa8, 0xeb, 0xc2,
+  0x02, 0x2f, 0x4a, 0xdf, 0xae, 0x4d, 0x41, 0xc2, 0xf3, 0x63, 0x74, 0xd8,
+  0x1f, 0xeb, 0xeb, 0x51, 0xe0, 0x54, 0x59, 0x8e, 0xce, 0xce, 0x05, 0xbc,
+  0xad, 0xf2, 0xe9, 0x11, 0xa6, 0xb5, 0xeb, 0x20, 0x78, 0xde, 0x24, 0x03,
+  0x80, 0x25, 0xcc, 0x49, 0xd2, 0x3a, 0x33, 0xa8, 0x2f, 0xf6, 0x4f, 0x53,
+  0x45, 0x25, 0x48, 0xeb, 0x71, 0x6c, 0x9d, 0xb3, 0x3c, 0xcb, 0x85, 0xf0,
+  0xdc, 0xbf, 0x4f, 0x43, 0xd2, 0x11, 0x5c, 0x2a, 0xc4, 0xf4, 0x86, 0x22,
+  0x57, 0xa3, 0x64, 0xbd, 0x7a, 0xba, 0x4d, 0x5b, 0xb3, 0x59, 0x97, 0x67,
+  0x9e, 0xde, 0x47, 0x42, 0xb5, 0xb9, 0x54, 0xe7, 0x3a, 0xce, 0xa7, 0x85,
+  0x67, 0xa0, 0x11, 0x9b, 0x34, 0x1b, 0x30, 0xea, 0x4f, 0xfc, 0x35, 0x72,
+  0xf6, 0x4c, 0xb2, 0xd3, 0xbd, 0x77, 0xc3, 0x7d, 0x6e, 0x07, 0xd3, 0xb3,
+  0x78, 0x35, 0xa7, 0x9d, 0x50, 0xe2, 0xab, 0x98, 0x74, 0x51, 0xf8, 0x94,
+  0xec, 0x57, 0x3b, 0xd9, 0xa0, 0xb1, 0xd1, 0xcd, 0x0d, 0x66, 0x17, 0xe9,
+  0xed, 0x1f, 0x8b, 0xb7, 0xbb, 0xc3, 0xfd, 0xc6, 0x42, 0xe7, 0xc5, 0x56,
+  0x00, 0x21, 0x5d, 0x5f, 0x7b, 0x7e, 0xde, 0x04, 0x04, 0xc1, 0x41, 0x42,
+  0x76, 0xbc, 0x15, 0x98, 0x95, 0x0b, 0x30, 0xa4, 0x0d, 0x74, 0x65, 0x4d,
+  0x32, 0xe0, 0x9a, 0xd9, 0xa0, 0x37, 0xdc, 0x37, 0xd8, 0x7a, 0xad, 0x3c,
+  0xb5, 0xa4, 0xec, 0x6f, 0x4d, 0xab, 0x72, 0x99, 0x34, 0x98, 0x0d, 0xb2,
+  0xb1, 0x9e, 0xc7, 0x96, 0x18, 0x90, 0xba, 0x6d, 0x35, 0xbd, 0x22, 0xd5,
+  0x87, 0x84, 0x35, 0x51, 0x5a, 0xe8, 0x2c, 0x7f, 0x65, 0x78, 0x67, 0x55,
+  0x24, 0xb0, 0x40, 0xa6, 0x68, 0x34, 0x0d, 0xc2, 0x7b, 0x61, 0x33, 0xcd,
+  0xee, 0xa6, 0xbd, 0x15, 0x80, 0x93, 0x75, 0xfb, 0xd0, 0x34, 0x37, 0x0d,
+  0xe6, 0xe2, 0x61, 0xda, 0xb8, 0x73, 0x65, 0x5c, 0x55, 0xbd, 0x19, 0xd0,
+  0x15, 0x52, 0xca, 0x10, 0xe4, 0x1d, 0x72, 0x0d, 0x29, 0x77, 0x2a, 0x86,
+  0xba, 0xf5, 0x8a, 0x2b, 0xd6, 0x36, 0x4b, 0xaa, 0x02, 0xc9, 0xde, 0x65,
+  0xc3, 0xba, 0x93, 0xb9, 0x5e, 0x8e, 0x51, 0xbe, 0x75, 0xea, 0xe5, 0x9e,
+  0x38, 0x63, 0x57, 0xf7, 0x0e, 0x10, 0x47, 0x40, 0x50, 0xb7, 0xc1, 0xc3,
+  0x9f, 0x6d, 0x6a, 0x7b, 0x20, 0x34, 0x7e, 0xcf, 0xe2, 0x72, 0xc5, 0xad,
+  0x7a, 0x7f, 0x88, 0xa2, 0x49, 0xfc, 0x86, 0x62, 0x9f, 0xd7, 0x7e, 0x7b,
+  0x75, 0x69, 0x8d, 0xd2, 0x0a, 0x3e, 0xd0, 0xb5, 0x16, 0x60, 0xa6, 0xfc,
+  0xf2, 0xc1, 0x34, 0xec, 0x50, 0x79, 0x68, 0xfb, 0x8a, 0xed, 0x0e, 0xa3,
+  0x70, 0xe1, 0x58, 0x97, 0x1b, 0x7b, 0x48, 0x96, 0x24, 0x5f, 0x37, 0xec,
+  0x2c, 0xcb, 0x93, 0xc1, 0x90, 0x2a, 0x49, 0x08, 0xee, 0x5e, 0xe7, 0xfa,
+  0x07, 0xc9, 0x8e, 0x27, 0x96, 0x80, 0x46, 0x32, 0x31, 0xf6, 0xcb, 0xb8,
+  0xd1, 0x53, 0x14, 0x43, 0xe8, 0xdf, 0x57, 0x91, 0xfe, 0xaf, 0x52, 0xcf,
+  0x75, 0x5d, 0x01, 0xa4, 0x9c, 0xfa, 0xf0, 0x1b, 0x68, 0x1f, 0xaa, 0xdd,
+  0x17, 0xfd, 0x72, 0x30, 0x6c, 0x63, 0x5f, 0x2a, 0x17, 0x57, 0x60, 0xea,
+  0x58, 0xd1, 0x7b, 0x8b, 0xc6, 0xb3, 0x51, 0x78, 0xe2, 0x79, 0x5d, 0x23,
+  0x49, 0xd7, 0x86, 0xe4, 0x62, 0x27, 0x12, 0xf5, 0xb0, 0xe8, 0x1f, 0xf8,
+  0xc0, 0x7a, 0xc6, 0xdd, 0xe5, 0x67, 0x12, 0xa7, 0x18, 0x35, 0xb1, 0x4f,
+  0x6d, 0x15, 0x88, 0x58, 0x7a, 0xd0, 0x85, 0x5f, 0x3b, 0xfe, 0xad, 0xc3,
+  0x67, 0x9d, 0xf1, 0xbd, 0xb1, 0x0a, 0x7f, 0x88, 0x62, 0xa4, 0x57, 0xe3,
+  0x44, 0xdd, 0xba, 0xed, 0xbc, 0x31, 0x63, 0xec, 0x5f, 0x87, 0xef, 0x70,
+  0x0b, 0x50, 0xc8, 0xa0, 0x03, 0xac, 0x9e, 0x10, 0xae, 0x7b, 0x11, 0x58,
+  0x62, 0xed, 0x53, 0x7b, 0xfc, 0x5b, 0xad, 0x7f, 0x39, 0x55, 0xe7, 0xfb,
+  0xb4, 0x3b, 0x1a, 0xf8, 0x8a, 0x99, 0xbd, 0x42, 0xdb, 0x47, 0xab, 0x8d,
+  0x2d, 0xfd, 0x9f, 0x8b, 0x08, 0x5c, 0x57, 0x10, 0x91, 0x3a, 0x2e, 0x73,
+  0x8f, 0x81, 0xc1, 0xb3, 0x00, 0x6c, 0x66, 0x04, 0x01, 0x5e, 0x7d, 0x35,
+  0xdd, 0x87, 0x87, 0x0d, 0x69, 0xc4, 0x2a, 0xeb, 0xce, 0x2c, 0x79, 0x5c,
+  0x33, 0x06, 0xd0, 0xe1, 0x17, 0xfd, 0xf1, 0x2c, 0xfb, 0x8a, 0x78, 0xa3,
+  0x50, 0x62, 0xd0, 0x16, 0x76, 0x0b, 0xcf, 0x10, 0xe6, 0x9b, 0x92, 0xeb,
+  0x22, 0x4e, 0x10, 0x8d, 0x7e, 0xa8, 0x9e, 0x37, 0xdb, 0x48, 0x62, 0x86,
+  0x62, 0x81, 0x5c, 0x41, 0xb6, 0x10, 0x06, 0x1b, 0x8a, 0x73, 0xa9, 0xd0,
+  0x22, 0x60, 0x8e, 0xab, 0x86, 0x56, 0x45, 0x07, 0x1e, 0xa7, 0xa8, 0x91,
+  0x84, 0x06, 0x43, 0x04, 0x29, 0xf5, 0xb5, 0x45, 0x9f, 0x7b, 0x44, 0x25,
+  0xe2, 0x19, 0xa0, 0xde, 0x24, 0x29, 0xa9, 0x91, 0x56, 0x36, 0x08, 0x74,
+  0xf8, 0x6f, 0x30, 0x0b, 0x92, 0x85, 0x42, 0x11, 0x87, 0xf2, 0x64, 0xbc,
+  0x92, 0x2f, 0xcd, 0x19, 0x44, 0x7d, 0x8f, 0x60, 0x5e, 0xd1, 0xfa, 0xda,
+  0xd4, 0xf7, 0x53, 0x78, 0x6c, 0xd8, 0x03, 0xac, 0x69, 0x80, 0x76, 0x69,
+  0x00, 0x1b, 0x18, 0x5f, 0xb4, 0xd8, 0xd8, 0xb4, 0xad, 0x11, 0x99, 0xcb,
+  0xe6, 0x68, 0x28, 0xe7, 0x41, 0x9a, 0x48, 0x9d, 0xa2, 0xe1, 0x72, 0x63,
+  0xc0, 0xd7, 0x17, 0x35, 0x53, 0xf8, 0xc2, 0xe7, 0xa9, 0x32, 0xa5, 0x1c,
+  0x2a, 0xe0, 0x10, 0x38, 0x25, 0xb8, 0xdf, 0x99, 0xa0, 0xc4, 0xda, 0x50,
+  0x0e, 0xd8, 0xa7, 0x84, 0x4d, 0x4e, 0x9d, 0xb6, 0xb0, 0x95, 0xec, 0x8e,
+  0x52, 0xf4, 0x3e, 0x55, 0xdc, 0xd5, 0xa1, 0x11, 0x7d, 0xc3, 0x87, 0xb8,
+  0x09, 0x07, 0xf0, 0x38, 0xd5, 0x69, 0xc4, 0x7a, 0xd9, 0x5d, 0x41, 0x19,
+  0xd5, 0xb6, 0x43, 0xf9, 0xe2, 0x50, 0x6e, 0x24, 0x85, 0x09, 0x52, 0xb0,
+  0x9d, 0xe2, 0x0b, 0xb3, 0x48, 0x45, 0x3b, 0x31, 0xee, 0x8d, 0xe1, 0x08,
+  0x24, 0xce, 0x97, 0x87, 0xc0, 0xf0, 0x77, 0x70, 0xf0, 0x0b, 0xbb, 0xf7,
+  0xe0, 0xbc, 0xc1, 0x6c, 0x2f, 0x5f, 0x49, 0xd3, 0xd4, 0xac, 0x5c, 0x89,
+  0xa5, 0x5a, 0xa6, 0x45, 0xbd, 0x6d, 0x67, 0x77, 0xb6, 0xfb, 0x98, 0xe5,
+  0xb9, 0xde, 0x74, 0x6a, 0xaf, 0xa1, 0x06, 0x09, 0x6e, 0xb5, 0x3b, 0xbb,
+  0x05, 0x03, 0xc2, 0x94, 0xce, 0xe2, 0x43, 0xdd, 0xda, 0x09, 0x33, 0xab,
+  0x7f, 0xe5, 0xeb, 0x5f, 0xff, 0x7a, 0x3d, 0xd4, 0x02, 0x33, 0x4c, 0xaf,
+  0xa2, 0x7e, 0x00, 0x1a, 0xcd, 0x77, 0xbe, 0x91, 0xee, 0x38, 0xad, 0x1c,
+  0x73, 0xda, 0xad, 0xe7, 0x1f, 0xd0, 0xc1, 0xa7, 0xde, 0x4f, 0x6e, 0x27,
+  0x3c, 0x16, 0x63, 0xc7, 0x5f, 0x5f, 0x51, 0x5c, 0x65, 0x5b, 0xa7, 0x07,
+  0x84, 0x2e, 0xdf, 0xa8, 0x7b, 0x23, 0x3e, 0xca, 0xf2, 0x55, 0xb8, 0x53,
+  0x48, 0x4a, 0xee, 0x58, 0xcb, 0xd0, 0x8c, 0x71, 0x7e, 0xfe, 0x4f, 0x36,
+  0xb6, 0xb6, 0xe4, 0x56, 0xb7, 0x1b, 0xe1, 0x30, 0xbf, 0x4b, 0x79, 0xb4,
+  0x89, 0x25, 0x0c, 0xfb, 0xbd, 0xba, 0x26, 0xb4, 0x9e, 0x18, 0xe1, 0xd3,
+  0x7c, 0x61, 0x3b, 0xeb, 0xf7, 0x1a, 0x7a, 0x84, 0xf6, 0x4a, 0xe1, 0x4d,
+  0x64, 0x0f, 0xcd, 0xd8, 0x84, 0x9b, 0x9a, 0x5c, 0xf2, 0x45, 0x43, 0x81,
+  0x69, 0x86, 0xe4, 0x25, 0xd9, 0x96, 0xf7, 0x60, 0xb7, 0x77, 0xae, 0xc3,
+  0xf6, 0xe6, 0xf1, 0x6e, 0x36, 0xbe, 0x02, 0xbc, 0x4a, 0x81, 0x34, 0x47,
+  0x54, 0x37, 0xea, 0x70, 0x56, 0x50, 0x9a, 0x3b, 0x21, 0x48, 0xa4, 0x15,
+  0x36, 0xbb, 0x4a, 0x11, 0xa3, 0x65, 0x66, 0x4f, 0xf1, 0xcc, 0xd8, 0x1f,
+  0x35, 0x27, 0x7e, 0x40, 0x78, 0x7e, 0x19, 0x90, 0x47, 0x9c, 0xce, 0x25,
+  0xf3, 0xc9, 0x92, 0xf7, 0xfe, 0x5b, 0xb4, 0x7a, 0x42, 0x63, 0x73, 0x2c,
+  0xb9, 0x96, 0x98, 0x88, 0x7e, 0xf1, 0xe8, 0x77, 0x61, 0x9d, 0xb7, 0x14,
+  0xb8, 0x20, 0xc3, 0x0d, 0xe8, 0xa5, 0xc8, 0xfd, 0x26, 0x63, 0x0e, 0x5a,
+  0x35, 0x96, 0x3c, 0xaf, 0x81, 0xef, 0x89, 0x18, 0x14, 0x96, 0x00, 0x42,
+  0xec, 0x4e, 0xa3, 0xd9, 0xb4, 0xf2, 0xf0, 0xd9, 0x4d, 0x78, 0x34, 0x10,
+  0x69, 0x3b, 0xe0, 0x13, 0xea, 0x8c, 0xc5, 0x11, 0x90, 0x0b, 0xd9, 0x45,
+  0xa9, 0xc2, 0x58, 0x54, 0xce, 0xbe, 0x70, 0xa8, 0x11, 0xa5, 0x24, 0x82,
+  0x08, 0x2c, 0x19, 0x6e, 0x09, 0x64, 0x35, 0x0f, 0x93, 0xb1, 0x06, 0x02,
+  0xa4, 0x9c, 0x69, 0xf2, 0x49, 0xd0, 0xc6, 0x15, 0x75, 0x6d, 0xa7, 0x8b,
+  0xe3, 0x36, 0x46, 0x5d, 0x34, 0xd4, 0x17, 0xa7, 0x39, 0x46, 0x20, 0x23,
+  0xfa, 0x26, 0x16, 0xdb, 0xfd, 0x09, 0x01, 0x97, 0xc4, 0x23, 0x94, 0xc5,
+  0x24, 0x18, 0x92, 0x70, 0x61, 0x59, 0xf9, 0xa3, 0x6b, 0x5b, 0xd0, 0x56,
+  0x0a, 0xa2, 0x58, 0xa3, 0x76, 0x52, 0xcd, 0x1d, 0x7c, 0xcd, 0x4d, 0x8c,
+  0x3b, 0xe9, 0x78, 0x7b, 0xd8, 0x5b, 0x4a, 0xa4, 0x2b, 0x35, 0x7b, 0xb3,
+  0x31, 0xec, 0x61, 0xfa, 0x5a, 0x89, 0x41, 0x8b, 0xa7, 0x5a, 0xcd, 0xb3,
+  0x3b, 0x83, 0x6e, 0x7f, 0x29, 0x39, 0x8f, 0xce, 0x91, 0xab, 0xf4, 0x43,
+  0x39, 0x59, 0x37, 0xc8, 0xc5, 0xba, 0x69, 0x00, 0x4d, 0x38, 0x8e, 0x24,
+  0xf5, 0x28, 0x14, 0x3b, 0xc3, 0xd7, 0x6c, 0x03, 0xe9, 0x78, 0x1b, 0x6b,
+  0x64, 0x46, 0x1c, 0xee, 0x7d, 0x0f, 0x72, 0x13, 0x46, 0x91, 0x3c, 0xff,
+  0x40, 0x51, 0x64, 0xb2, 0x44, 0x6e, 0xa4, 0xb2, 0x07, 0xcb, 0x13, 0x9f,
+  0x7b, 0x6c, 0x39, 0x54, 0x03, 0x41, 0x6a, 0x43, 0x53, 0x4c, 0x7f, 0x8d,
+  0x4f, 0x1b, 0x5e, 0x5a, 0x85, 0xbd, 0x11, 0xd6, 0x3d, 0x16, 0x2a, 0xab,
+  0xce, 0xcd, 0x1b, 0xaf, 0xc8, 0x63, 0xe0, 0xda, 0xc6, 0xf7, 0xe1, 0x9a,
+  0x00, 0xbf, 0x1b, 0xf8, 0x99, 0xf7, 0x55, 0x37, 0x7e, 0x70, 0xd4, 0xba,
+  0x35, 0xd6, 0xbc, 0xdb, 0xd9, 0x1e, 0xa5, 0x5b, 0x18, 0x1e, 0x3d, 0xea,
+  0xf3, 0xa7, 0x6a, 0xfe, 0xd8, 0xe6, 0x32, 0xaf, 0x35, 0x64, 0x9c, 0x34,
+  0x8b, 0xcf, 0x76, 0x2d, 0xd0, 0xa4, 0x36, 0x6a, 0xf0, 0x19, 0x11, 0x43,
+  0x8e, 0xfa, 0x3d, 0x32, 0xc6, 0x25, 0x1f, 0x93, 0x56, 0xaf, 0xc9, 0x41,
+  0xd8, 0x9d, 0x0b, 0xd7, 0x3a, 0xbf, 0x73, 0x46, 0x30, 0x90, 0x36, 0x87,
+  0xaf, 0x31, 0x82, 0xc1, 0x48, 0x39, 0x3c, 0xb3, 0xe1, 0xd8, 0x7d, 0x2d,
+  0x76, 0xab, 0x50, 0x7e, 0xa3, 0xb0, 0xef, 0x8c, 0x2b, 0xb2, 0x7b, 0xd9,
+  0x58, 0x27, 0xab, 0x9c, 0xeb, 0x68, 0x0c, 0x9f, 0xa0, 0x97, 0xb1, 0xd9,
+  0xb8, 0x13, 0x9d, 0x23, 0x20, 0xbc, 0xb2, 0xd6, 0xcd, 0x3d, 0xc4, 0x5a,
+  0xd1, 0x21, 0x26, 0xd0, 0xe4, 0xde, 0x5f, 0x87, 0x22, 0xb3, 0x61, 0x65,
+  0x16, 0xb5, 0x13, 0x9b, 0xc7, 0x69, 0x35, 0x2d, 0x7b, 0xfa, 0xc7, 0x09,
+  0x69, 0x65, 0x95, 0xf6, 0xb5, 0xc0, 0xc1, 0xc0, 0x25, 0xd3, 0x8c, 0xfe,
+  0xc7, 0x8c, 0x38, 0xdc, 0x36, 0xe9, 0xd0, 0xd4, 0x72, 0x42, 0x5e, 0xb7,
+  0xc7, 0xc2, 0x6d, 0x0b, 0x87, 0xde, 0xee, 0x8e, 0x37, 0xb1, 0x16, 0xc4,
+  0x3d, 0x07, 0x4d, 0xee, 0x05, 0x7b, 0x88, 0x19, 0x79, 0x51, 0x2c, 0x7c,
+  0xed, 0xe7, 0x94, 0x38, 0xae, 0x5e, 0x57, 0x7a, 0x03, 0x10, 0x7e, 0x07,
+  0xaf, 0x39, 0x1a, 0xd7, 0x1d, 0x78, 0x5c, 0x16, 0xfc, 0x58, 0xdf, 0xb9,
+  0x78, 0x75, 0xd5, 0x56, 0xb5, 0xee, 0x48, 0x68, 0x85, 0x5f, 0x41, 0x9b,
+  0x76, 0x1f, 0x1a, 0xd5, 0xad, 0x08, 0x35, 0xd3, 0x23, 0x66, 0xd0, 0x50,
+  0x80, 0xdc, 0x68, 0x15, 0xee, 0xd7, 0xfd, 0x7f, 0x9c, 0x7c, 0x19, 0x88,
+  0x8e, 0xc9, 0xac, 0x6b, 0x32, 0x6b, 0x9c, 0xe0, 0xac, 0x2a, 0xea, 0x5b,
+  0xbc, 0x3d, 0xcc, 0xc7, 0x03, 0xe1, 0xea, 0xa8, 0x51, 0x11, 0x81, 0xa7,
+  0xf2, 0x98, 0x67, 0xc8, 0xaa, 0xb6, 0x7e, 0x2c, 0xcd, 0xd6, 0x5e, 0xbf,
+  0x7f, 0x93, 0x98, 0xed, 0xfa, 0xf6, 0x78, 0xbc, 0xbb, 0x74, 0xf2, 0x24,
+  0x46, 0x4e, 0x8b, 0xd6, 0x93, 0x0e, 0xfa, 0xd2, 0xf4, 0xd7, 0x0d, 0x32,
+  0x6a, 0x94, 0x8a, 0x7d, 0xca, 0xaf, 0x03, 0x0d, 0x9c, 0xa0, 0x4b, 0xde,
+  0xce, 0xdb, 0x22, 0x2e, 0x54, 0xd7, 0xa9, 0x15, 0x58, 0xd7, 0x75, 0xd8,
+  0x81, 0xa5, 0xbd, 0x14, 0x7e, 0x67, 0x8b, 0xbf, 0xa2, 0x4c, 0xe8, 0x15,
+  0x45, 0x37, 0x67, 0x31, 0x65, 0xb3, 0x2f, 0xa4, 0xb4, 0x97, 0x8d, 0x5f,
+  0x1e, 0x0f, 0x4a, 0xd7, 0x11, 0xb6, 0x6b, 0x6f, 0x8c, 0x07, 0xf6, 0x5a,
+  0xca, 0x44, 0xee, 0x95, 0x80, 0x7f, 0x5e, 0x26, 0xf4, 0x5f, 0x2a, 0x41,
+  0x5e, 0xc6, 0x8b, 0x6c, 0x8b, 0xef, 0xe9, 0x89, 0xb9, 0x13, 0x8a, 0x91,
+  0x35, 0xea, 0xdb, 0x59, 0xaf, 0x97, 0x86, 0xba, 0x61, 0x6d, 0xa5, 0x8c,
+  0x9a, 0x9b, 0xd6, 0x96, 0xb3, 0x98, 0x2b, 0x4f, 0x8b, 0xcf, 0xb7, 0x60,
+  0x7c, 0x79, 0xa3, 0xc9, 0xfd, 0x44, 0x0c, 0x1e, 0xca, 0x51, 0xd7, 0x43,
+  0xdb, 0xfc, 0xb4, 0x95, 0x5e, 0x76, 0x38, 0x24, 0x1b, 0x1e, 0x99, 0x39,
+  0xe2, 0x40, 0x9b, 0x9e, 0x0f, 0x97, 0xcd, 0x1c, 0x96, 0xed, 0xc0, 0xc6,
+  0xee, 0xdd, 0x14, 0x9d, 0x6f, 0x75, 0xb2, 0xf7, 0x60, 0xac, 0x89, 0xf0,
+  0x0a, 0x28, 0xe8, 0x94, 0xad, 0x24, 0x3d, 0xcb, 0xbe, 0xd9, 0xe8, 0xe2,
+  0xb5, 0x2b, 0x72, 0x4d, 0xbe, 0x42, 0x01, 0x69, 0xae, 0x05, 0xe9, 0x08,
+  0x4c, 0x8b, 0x6a, 0xb2, 0xab, 0x8f, 0x9a, 0xce, 0x16, 0x12, 0x1c, 0xc0,
+  0xc7, 0x87, 0xc6, 0x13, 0x42, 0xa2, 0x9c, 0x76, 0x13, 0xe3, 0x73, 0x6a,
+  0x99, 0x2d, 0x54, 0xba, 0xf2, 0x9b, 0x83, 0xec, 0xcf, 0xf6, 0x28, 0xca,
+  0x9a, 0x2c, 0x98, 0xf8, 0x07, 0x1c, 0xdf, 0xf7, 0xa0, 0x6b, 0xa0, 0xf2,
+  0x0a, 0x16, 0x5a, 0x68, 0xd1, 0xad, 0x42, 0x55, 0x3c, 0x45, 0x9f, 0x34,
+  0xf4, 0xe1, 0x06, 0xf9, 0xf8, 0xb5, 0x34, 0xdd, 0xbd, 0x36, 0xca, 0xee,
+  0xa0, 0x27, 0xdf, 0xff, 0xdf, 0xda, 0xb1, 0xec, 0x34, 0x0c, 0xc3, 0xee,
+  0x7c, 0xc5, 0xa8, 0x10, 0x6a, 0x01, 0x81, 0x76, 0x1d, 0x42, 0x95, 0x90,
+  0x40, 0x70, 0x45, 0xdc, 0xd6, 0xa1, 0x95, 0xad, 0x9b, 0x26, 0x10, 0x9b,
+  0x56, 0x40, 0x1c, 0xe8, 0xbf, 0xe3, 0xf8, 0x91, 0xd8, 0x6d, 0x06, 0x05,
+  0x71, 0x6b, 0xd3, 0xc4, 0x71, 0xec, 0x3c, 0xfc, 0x88, 0x5d, 0x11, 0xfb,
+  0x4f, 0x60, 0xce, 0x6d, 0x4a, 0x00, 0x8c, 0x0a, 0xb9, 0xcb, 0x12, 0x10,
+  0x12, 0x9e, 0x1b, 0xa8, 0xb8, 0xe5, 0x9a, 0x12, 0xb6, 0xec, 0xb5, 0x32,
+  0x9b, 0x9b, 0x4e, 0xf2, 0x81, 0xe0, 0x48, 0xbf, 0xbb, 0x94, 0xb7, 0xc6,
+  0x5d, 0xdd, 0xe5, 0x6e, 0x9b, 0xe1, 0xb4, 0x65, 0x40, 0x71, 0x46, 0xe3,
+  0x97, 0x4b, 0x69, 0x78, 0xe1, 0x61, 0x80, 0x80, 0x85, 0xff, 0xd8, 0xc0,
+  0xd0, 0xa2, 0xbb, 0x6a, 0x79, 0xf5, 0xb1, 0x49, 0xa7, 0x45, 0xa1, 0x61,
+  0x15, 0xc5, 0xfc, 0xf8, 0x60, 0x0a, 0x2b, 0x25, 0xd1, 0xc1, 0xf6, 0x82,
+  0xb6, 0x03, 0x52, 0x63, 0x34, 0xb7, 0x1e, 0x06, 0x2a, 0x6d, 0xee, 0xd6,
+  0x3b, 0xad, 0x38, 0x78, 0x18, 0x6b, 0x02, 0x4e, 0xf0, 0x6a, 0xbf, 0x06,
+  0xb7, 0xad, 0x96, 0x98, 0xc7, 0x4a, 0xa3, 0xf1, 0x00, 0xc7, 0x75, 0x3d,
+  0x2b, 0x37, 0x15, 0x17, 0x98, 0x31, 0x64, 0x4d, 0x9a, 0x8f, 0x2c, 0xa2,
+  0xa9, 0xc3, 0x34, 0xcb, 0xf2, 0x83, 0xa9, 0x4e, 0xeb, 0xe1, 0x04, 0xc1,
+  0x08, 0x9e, 0xf8, 0xde, 0x55, 0x1e, 0x11, 0x0f, 0xd8, 0x90, 0xeb, 0x57,
+  0x2a, 0x0b, 0x66, 0x8d, 0x7d, 0xc3, 0x05, 0xcd, 0x39, 0x02, 0xb5, 0x7a,
+  0x99, 0x3d, 0xbf, 0xcd, 0xab, 0xba, 0x85, 0xa6, 0xbe, 0xc5, 0x6c, 0x70,
+  0x89, 0x1a, 0x71, 0x75, 0xc2, 0x1e, 0x03, 0x27, 0xc2, 0x5d, 0x7f, 0x90,
+  0x3a, 0x05, 0x11, 0xa4, 0x28, 0xf9, 0x57, 0x02, 0xeb, 0xa3, 0xb6, 0x33,
+  0x9f, 0x6d, 0xd1, 0x8f, 0xd4, 0x3a, 0x4e, 0xb0, 0xb6, 0xa3, 0xbf, 0x9b,
+  0x13, 0xf8, 0x92, 0x22, 0x29, 0x32, 0x9b, 0x5e, 0x90, 0xcf, 0x26, 0xe9,
+  0x8a, 0x5a, 0x81, 0x0e, 0x8b, 0x0f, 0xe3, 0xe1, 0x04, 0x66, 0x27, 0xc6,
+  0xe6, 0xdc, 0x82, 0xae, 0x22, 0x65, 0xb8, 0xc5, 0x0e, 0x46, 0x82, 0xd7,
+  0x40, 0xe3, 0x4a, 0x22, 0x69, 0xf9, 0x91, 0x4a, 0xd9, 0x89, 0xe9, 0x42,
+  0xb9, 0xe2, 0xf7, 0xfa, 0x12, 0x07, 0x25, 0xca, 0x5b, 0xff, 0xd7, 0xea,
+  0xb0, 0x10, 0x48, 0xdc, 0x31, 0x54, 0xa9, 0xd7, 0xb0, 0xe4, 0xad, 0xe5,
+  0x00, 0xf9, 0x11, 0x67, 0x21, 0xf7, 0x6e, 0x3e, 0x06, 0xf3, 0x59, 0x84,
+  0x09, 0xfd, 0x58, 0xd0, 0x8b, 0x01, 0xff, 0x46, 0xfe, 0x5f, 0x12, 0x9f,
+  0x49, 0xff, 0x37, 0xc2, 0x6b, 0x51, 0xc5, 0xac, 0x64, 0x72, 0x43, 0x9a,
+  0x70, 0x3a, 0x2a, 0xf2, 0xdb, 0xd1, 0xd9, 0xf8, 0xf4, 0xe8, 0x38, 0x87,
+  0x1d, 0xa0, 0x49, 0xb3, 0xcf, 0x71, 0x31, 0x29, 0x8a, 0xc9, 0xd9, 0x12,
+  0xb6, 0x20, 0x58, 0xf1, 0x87, 0x49, 0xd7, 0x7b, 0x28, 0x19, 0xd9, 0xf1,
+  0x7c, 0x4b, 0x25, 0x7b, 0x33, 0x13, 0xed, 0xe7, 0x5c, 0xf7, 0x9c, 0xe1,
+  0x51, 0x18, 0x2c, 0x0d, 0x72, 0xff, 0xe8, 0x33, 0xbd, 0x8f, 0xc4, 0xb2,
+  0xc3, 0x57, 0x3a, 0x7c, 0xe8, 0x18, 0xdd, 0xe1, 0x58, 0xc0, 0x49, 0x79,
+  0x1f, 0x8a, 0xb0, 0xec, 0x91, 0x74, 0x96, 0x7b, 0x15, 0x44, 0x47, 0x37,
+  0x41, 0xd5, 0xc7, 0x6b, 0xdd, 0x2e, 0x16, 0x9b, 0xa8, 0x74, 0x1f, 0x56,
+  0x5e, 0x58, 0xc1, 0x0c, 0x87, 0x8e, 0x43, 0xc5, 0x59, 0xb8, 0x68, 0xec,
+  0xef, 0xe5, 0x56, 0x80, 0x7f, 0x97, 0x48, 0x85, 0xac, 0x1e, 0x0c, 0x5a,
+  0xd2, 0x2f, 0xe9, 0xd8, 0xb8, 0x36, 0xf6, 0xb4, 0xb5, 0x46, 0x6a, 0x98,
+  0x21, 0x68, 0xfb, 0x1b, 0x08, 0x65, 0xd5, 0xa5, 0xc7, 0x44, 0xdb, 0x34,
+  0xb9, 0x25, 0x1b, 0xa7, 0xd7, 0x9b, 0x72, 0xb6, 0xc2, 0xc3, 0x95, 0xa7,
+  0xea, 0x0e, 0xda, 0xec, 0x8c, 0x40, 0xb4, 0xe0, 0x82, 0x5f, 0x26, 0x71,
+  0x7e, 0x99, 0xc4, 0x47, 0x24, 0xca, 0xa5, 0xef, 0xe6, 0x5c, 0x1f, 0x8f,
+  0xab, 0xd9, 0xd3, 0x0d, 0xde, 0x01, 0xdb, 0xb6, 0x90, 0xfc, 0x99, 0x1a,
+  0xfd, 0xe8, 0x81, 0xb1, 0xbc, 0x81, 0x14, 0x22, 0x9f, 0x78, 0xce, 0xc4,
+  0xe2, 0x0c, 0x13, 0xc4, 0x0b, 0xc4, 0x0c, 0x8d, 0x9f, 0x42, 0x5e, 0x46,
+  0xac, 0x9d, 0x86, 0xca, 0x6d, 0x20, 0x9f, 0x83, 0xa8, 0x4c, 0x9d, 0x00,
+  0xdb, 0xc9, 0x6e, 0xe2, 0xf2, 0x21, 0xe0, 0x2c, 0xa2, 0xa3, 0xb8, 0x5b,
+  0xdf, 0xb9, 0x66, 0x2a, 0xce, 0xd2, 0xca, 0x35, 0x5d, 0xca, 0x10, 0x69,
+  0x9e, 0x19, 0x2c, 0x3a, 0x74, 0x47, 0x9f, 0x63, 0x62, 0xea, 0xac, 0x17,
+  0x0b, 0xe0, 0x9f, 0x58, 0x91, 0xf7, 0x76, 0xcf, 0x81, 0xa1, 0x4d, 0xa5,
+  0xd4, 0x91, 0x07, 0x77, 0x91, 0x26, 0x80, 0xec, 0x31, 0x67, 0xfe, 0x48,
+  0xfc, 0x08, 0x23, 0x39, 0xd2, 0x95, 0x52, 0x35, 0xa0, 0x45, 0xfc, 0x0b,
+  0x90, 0xce, 0x43, 0x31, 0x17, 0x7a, 0x02, 0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+  {"/", "text/html; charset=utf-8", web_asset_index_gz, sizeof(web_asset_index_gz), "\"c3a4fba9\"", false},
+  {"/assets/app.66510136.css", "text/css", web_asset_app_css_gz, sizeof(web_asset_app_css_gz), "\"66510136\"", true},
+  {"/assets/app.6c06ff1b.js", "application/javascript", web_asset_app_js_gz, sizeof(web_asset_app_js_gz), "\"6c06ff1b\"", true},
+};
+
+static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
+
+#endif
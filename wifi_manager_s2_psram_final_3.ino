@@ -1,21 +1,8 @@
 /*
   # Форматируем
   prettier --print-width 120 --html-whitespace-sensitivity css --write compressed.html
-  Далее сжатие gzip -k -9 index.html
-  Перевод .gz в .h - % xxd -i index.html.gz > index_html_gz.h
-
-  #ifndef INDEX_HTML_GZ_H
-  #define INDEX_HTML_GZ_H
-
-  #include <stdint.h>
-
-  static const uint8_t index_html_gz[] PROGMEM = {
-  ... 0x00
-  };
-
-  static const unsigned int index_html_gz_len = sizeof(index_html_gz);
-
-  #endif
+  Встроенный UI (оболочка + app.<hash>.css/js) генерируется из index.html:
+  python3 tools/build_web_assets.py  ->  web_assets_gz.h
 */
 
 
@@ -30,7 +17,10 @@
 #include "build_flags.h"
 #include "Log.h"
 #include "AppState.h"
+#include "Persistence.h"
+#include "ConfigBundle.h"
 #include "Control.h"
+#include "Metrics.h"
 #include <EEPROM.h> 
 #include <esp_task_wdt.h>
 #include "esp_err.h"
@@ -75,18 +65,21 @@ struct BootState {
 };
 
 AppState appState;
-Settings configSettings(appState);
+Persistence persistence;
+ConfigBundle configBundle(persistence);
+Settings configSettings(appState, persistence);
 Info sysInfo(configSettings); 
-Logger logger;
+Logger logger(persistence);
 
 TimeModule timeModule(logger, appState, configSettings);
 Ota ota(configSettings, logger, appState);
-DeviceManager deviceManager;
+DeviceManager deviceManager(persistence);
 Control control(deviceManager, logger);
 
 WiFiManager wifiManager(configSettings, timeModule, logger, appState);
-WebServer webServer(wifiManager, configSettings, deviceManager, timeModule, sysInfo, ota, logger, appState);
+WebServer webServer(wifiManager, configSettings, deviceManager, timeModule, sysInfo, ota, logger, appState, configBundle);
 TelegramBot telegramBot(configSettings, webServer, logger, appState, ota, sysInfo, deviceManager);
+Metrics metrics(deviceManager, wifiManager, webServer, telegramBot, logger);
 
 // === SETUP ===
 
@@ -209,6 +202,7 @@ delay(1000);
 #endif
 
   configSettings.begin();
+  configBundle.begin();
   Serial.printf("Free heap befor LoadSetting: %d\n", ESP.getFreeHeap());
 
   if (!configSettings.loadSettings()) {
@@ -218,6 +212,11 @@ delay(1000);
 
   deviceManager.deviceInit();
 
+  configBundle.onReload([]() {
+    configSettings.loadSettings();
+    deviceManager.deviceInit();
+  });
+
   if (configSettings.ws.isWifiTurnedOn) {
     wifiManager.begin();
     unsigned long startTime = millis();
@@ -246,6 +245,7 @@ delay(1000);
     timeModule.updateTime();
   }
 
+  webServer.api().onGet("/metrics", [](AsyncWebServerRequest* request) { metrics.serve(request); });
   if (configSettings.ws.isWifiTurnedOn) {
     webServer.begin();
     Serial.printf("Free heap after web sever: %d\n", ESP.getFreeHeap());
@@ -270,6 +270,22 @@ delay(1000);
 }
 
 
+void printMemoryPlacement() {
+  MemoryPlacementReport report;
+  deviceManager.reportMemoryPlacement(report);
+  logger.reportMemoryPlacement(report);
+  wifiManager.reportMemoryPlacement(report);
+  configSettings.reportMemoryPlacement(report);
+  JsonArena::reportMemoryPlacement(report);
+
+  char buffer[512];
+  report.format(buffer, sizeof(buffer));
+  Serial.print(buffer);
+
+  JsonArena::printStats();
+  MemTrack::print();
+}
+
 void loop() {
 
   static bool bootSuccessHandled = false;
@@ -285,6 +301,7 @@ void loop() {
     }
 
     Serial.println("Система работает стабильно. Запуск считаем успешным.");
+    printMemoryPlacement();
     state.bootSuccess = true;
     state.bootCount = 0;
 
@@ -300,20 +317,37 @@ void loop() {
 
   unsigned long loopStartTime = micros();
 
-  if (deviceManager.isSaveControl && !ota.isUpdate) {
+  configBundle.loop();
+
+  if (deviceManager.isSaveDue() && !ota.isUpdate && !configBundle.isBusy()) {
     delay(10);
-    deviceManager.writeDevicesToFile(deviceManager.myDevices, "/devices.json");
-    deviceManager.isSaveControl = false;
+    deviceManager.saveDevices("/devices.json");
+  }
+
+  if (!ota.isUpdate && !configBundle.isBusy()) {
+    persistence.loop();
   }
 
-  if (!ota.isUpdate && !deviceManager.isSaveControl && !appState.isStartWifi && !webServer.saveNetwork.isSaveNetwork && !wifiManager.isScanning && appState.connectState == AppState::CONNECT_IDLE && !appState.isFormat) {
+  MemTrack::loop();
+
+  if (!ota.isUpdate && !appState.isStartWifi && !webServer.saveNetwork.isSaveNetwork && !wifiManager.isScanning && appState.connectState == AppState::CONNECT_IDLE && !appState.isFormat && !configBundle.isRestarting()) {
+    MemScope memScope(MEM_TAG_CONTROL);
     control.loop();
   }
 
   if (configSettings.ws.isWifiTurnedOn) {
-    webServer.loop();
-    wifiManager.loop();
-    ota.loop();
+    {
+      MemScope memScope(MEM_TAG_WEB);
+      webServer.loop();
+    }
+    {
+      MemScope memScope(MEM_TAG_WIFI);
+      wifiManager.loop();
+    }
+    {
+      MemScope memScope(MEM_TAG_OTA);
+      ota.loop();
+    }
 
     if (configSettings.ws.telegramSettings.isTelegramOn &&
         !configSettings.ws.isAP &&
@@ -322,9 +356,8 @@ void loop() {
         appState.connectState == AppState::CONNECT_IDLE &&
         !ota.isUpdate &&
         timeModule.isInternetAvailable &&
-        !wifiManager.isReconnecting() &&
-        //!appState.isStartWifi &&
-        !deviceManager.isSaveControl) {
+        !wifiManager.isReconnecting()) {
+      MemScope memScope(MEM_TAG_TELEGRAM);
       telegramBot.loop();
     }
   }
@@ -347,7 +380,7 @@ void loop() {
       configSettings.ws.isWifiTurnedOn = !configSettings.ws.isWifiTurnedOn;
 
 
-      if (configSettings.saveSettings()) {
+      if (configSettings.saveSettingsNow()) {
         Serial.println("Settings saved successfully.");
       } else {
         Serial.println("ERROR: Failed to save settings!");
@@ -362,6 +395,7 @@ void loop() {
   #endif
 
   unsigned long loopDuration = micros() - loopStartTime;
+  MemTrack::recordLoop(loopDuration);
 
 
   unsigned long totalCycleTime = loopDuration + 10000;
@@ -375,5 +409,10 @@ void loop() {
 
   configSettings.ws.systemLoading = calculatedLoad;
 
-  delay(10);
+  // Incoming WebSocket commands cut the idle pause short.
+  if (configSettings.ws.isWifiTurnedOn) {
+    webServer.idle(10);
+  } else {
+    delay(10);
+  }
 }